@@ -0,0 +1,255 @@
+/* COMPUTER PLAYER */
+// Alpha-beta search over the 8x8 Board with iterative deepening and a transposition
+// table keyed by positionHash(). Each iteration searches one ply deeper than the last
+// and seeds its move order from the table, so the search can stop as soon as the time
+// budget runs out and still play the best move of the last finished iteration.
+// On the DE1-SoC the budget is measured with the interval timer; a host build
+// (HOST_BUILD, on by default off the board) uses the system clock and a larger table.
+// Positions in the opening book (book.h), if one is set, are played without a search.
+
+#ifndef AI_H
+#define AI_H
+
+/* LIBRARIES */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "engine.h"
+#include "book.h"
+
+#if !defined(HOST_BUILD) && (defined(__linux__) || defined(__APPLE__) || defined(_WIN32))
+#define HOST_BUILD
+#endif
+
+#ifdef HOST_BUILD
+#include <time.h>
+#endif
+
+
+/* AI INITIALIZATIONS */
+#ifdef HOST_BUILD
+#define AI_TABLE_BITS 20 // 16 MB transposition table
+#define TICKS_PER_MS 1000 // microseconds
+#else
+#define AI_TABLE_BITS 14 // 256 KB transposition table
+#define TICKS_PER_MS 100000 // interval timer runs at 100 MHz
+#define INTERVAL_TIMER_BASE_ADDRESS 0xFF202000
+#endif
+
+#define AI_MAX_DEPTH 64 // a game never lasts longer than the cells on the board
+#define AI_TIME_SHARE 4 // the computer thinks for a quarter of the time left on the turn clock
+#define AI_WIN 10000 // value of a won game, plus the final margin
+#define AI_CHECK_NODES 1023 // look at the clock every 1024 nodes
+
+enum { AI_EXACT, AI_LOWER, AI_UPPER };
+
+typedef struct {
+    uint64_t key;
+    int16_t value;
+    int8_t depth;
+    int8_t bound; // AI_EXACT, AI_LOWER or AI_UPPER
+    int8_t move; // best color found here, -1 if none
+} AiEntry;
+
+typedef struct {
+    AiEntry *table;
+    uint64_t tableMask;
+    uint32_t start, budget; // ticks, no limit when budget is 0
+    long nodes;
+    bool stopped;
+    int maxDepth; // iterations stop here, AI_MAX_DEPTH unless the caller wants a weaker player
+    int depth; // deepest iteration finished by the last aiChooseMove(), 0 for a book move
+    const Book *book; // consulted before searching, NULL for none
+} Ai;
+
+
+/* CLOCK */
+#ifdef HOST_BUILD
+static inline uint32_t aiTicks(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)(now.tv_sec * 1000000 + now.tv_nsec / 1000);
+}
+
+// seconds on a clock that does not wrap, for timing whole runs of the host tools;
+// aiTicks() wraps every 71 minutes and is only for search deadlines
+static inline double wallSeconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + now.tv_nsec * 1e-9;
+}
+#else
+// the interval timer counts down from 2^32 - 1 forever; invert it so ticks go up
+static inline uint32_t aiTicks(void) {
+    volatile int *timer = (int*) INTERVAL_TIMER_BASE_ADDRESS;
+    static bool running = false;
+    if (!running) {
+        timer[2] = 0xFFFF; // periodl
+        timer[3] = 0xFFFF; // periodh
+        timer[1] = 0x6; // START | CONT
+        running = true;
+    }
+    timer[4] = 0; // latch the count into snapl/snaph
+    uint32_t count = (timer[4] & 0xFFFF) | ((uint32_t)(timer[5] & 0xFFFF) << 16);
+    return ~count;
+}
+#endif
+
+// how long the computer may think when remainingTime seconds are left on the turn
+static inline int aiBudgetMs(int remainingTime) {
+    return remainingTime * 1000 / AI_TIME_SHARE;
+}
+
+
+/* SETUP */
+static inline bool aiInit(Ai *ai, int tableBits) {
+    ai->table = calloc((size_t)1 << tableBits, sizeof(AiEntry));
+    ai->tableMask = ((uint64_t)1 << tableBits) - 1;
+    ai->nodes = 0;
+    ai->maxDepth = AI_MAX_DEPTH;
+    ai->depth = 0;
+    ai->book = NULL;
+    return ai->table != NULL;
+}
+
+// forget every stored position, so the next search does not depend on earlier ones
+static inline void aiClearTable(Ai *ai) {
+    memset(ai->table, 0, (size_t)(ai->tableMask + 1) * sizeof(AiEntry));
+}
+
+static inline void aiFree(Ai *ai) {
+    free(ai->table);
+    ai->table = NULL;
+}
+
+
+/* SEARCH */
+// free cells touching a territory, a rough count of what it can still reach
+static inline int aiFrontierCells(const Board *board, int me) {
+    int cells = 0;
+    for (int c = 0; c < COLOR_COUNT; c++) cells += popcount64(board->frontier[me][c][0]);
+    return cells;
+}
+
+// scores only grow, so once a player holds more than half the board the winner is known
+static inline bool aiDecided(const Board *board) {
+    return 2 * board->score[0] > BOARD_SIZE * BOARD_SIZE || 2 * board->score[1] > BOARD_SIZE * BOARD_SIZE
+        || isGameOver(board);
+}
+
+// value of the position for the player to move. A decided game is worth AI_WIN plus the
+// margin, so the loser cannot gain anything by stalling and both sides still take cells.
+static inline int aiEvaluate(const Board *board, int player) {
+    int me = player - 1, opp = 1 - me;
+    int margin = board->score[me] - board->score[opp];
+    if (aiDecided(board)) return (margin > 0) ? AI_WIN + margin : (margin < 0) ? -AI_WIN + margin : 0;
+    return 4 * margin + aiFrontierCells(board, me) - aiFrontierCells(board, opp);
+}
+
+// colors the player may pick, best guess first: the table's move, then the biggest gains
+static inline int aiOrderMoves(const Board *board, int player, int first, int moves[COLOR_COUNT]) {
+    int gains[COLOR_COUNT], seeds[COLOR_COUNT], count = 0;
+    int legal = moveGains(board, player, gains);
+    for (int c = 0; c < COLOR_COUNT; c++) {
+        if (!((legal >> c) & 1)) continue;
+        seeds[count] = (c == first) ? BOARD_SIZE * BOARD_SIZE + 1 : gains[c];
+        moves[count++] = c;
+    }
+    for (int i = 1; i < count; i++) {
+        for (int j = i; j > 0 && seeds[j] > seeds[j - 1]; j--) {
+            int s = seeds[j]; seeds[j] = seeds[j - 1]; seeds[j - 1] = s;
+            int m = moves[j]; moves[j] = moves[j - 1]; moves[j - 1] = m;
+        }
+    }
+    return count;
+}
+
+static inline int aiSearch(Ai *ai, const Board *board, int player, int depth, int alpha, int beta) {
+    if ((++ai->nodes & AI_CHECK_NODES) == 0 && ai->budget && aiTicks() - ai->start >= ai->budget) ai->stopped = true;
+    if (ai->stopped) return 0;
+    if (depth == 0 || aiDecided(board)) return aiEvaluate(board, player);
+
+    uint64_t key = positionHash(board, player);
+    AiEntry *entry = &ai->table[key & ai->tableMask];
+    int first = -1;
+    if (entry->key == key) {
+        first = entry->move;
+        if (entry->depth >= depth) {
+            if (entry->bound == AI_EXACT) return entry->value;
+            if (entry->bound == AI_LOWER && entry->value >= beta) return entry->value;
+            if (entry->bound == AI_UPPER && entry->value <= alpha) return entry->value;
+        }
+    }
+
+    int moves[COLOR_COUNT], count = aiOrderMoves(board, player, first, moves);
+    int best = -AI_WIN * 2, bestMove = -1, startAlpha = alpha;
+    for (int k = 0; k < count; k++) {
+        Board child = *board;
+        fill(&child, player, moves[k]);
+        int value = -aiSearch(ai, &child, (player == PLAYER1) ? PLAYER2 : PLAYER1, depth - 1, -beta, -alpha);
+        if (ai->stopped) return 0;
+        if (value > best) {
+            best = value;
+            bestMove = moves[k];
+        }
+        if (value > alpha) alpha = value;
+        if (alpha >= beta) break;
+    }
+
+    entry->key = key;
+    entry->value = (int16_t)best;
+    entry->depth = (int8_t)depth;
+    entry->bound = (best <= startAlpha) ? AI_UPPER : (best >= beta) ? AI_LOWER : AI_EXACT;
+    entry->move = (int8_t)bestMove;
+    return best;
+}
+
+// pick a color for the player within budgetMs (0 for no limit, every iteration up to
+// maxDepth is searched); always returns a legal color
+static inline int aiChooseMove(Ai *ai, const Board *board, int player, int budgetMs) {
+    int bookColor = bookMove(ai->book, board, player);
+    if (bookColor >= 0) {
+        ai->nodes = 0;
+        ai->depth = 0;
+        return bookColor;
+    }
+
+    int moves[COLOR_COUNT], count = aiOrderMoves(board, player, -1, moves);
+    int bestMove = moves[0];
+
+    ai->start = aiTicks();
+    ai->budget = (uint32_t)budgetMs * TICKS_PER_MS;
+    ai->stopped = false;
+    ai->nodes = 0;
+    ai->depth = 0;
+    for (int depth = 1; depth <= ai->maxDepth; depth++) {
+        int alpha = -AI_WIN * 2, iterationMove = -1;
+        for (int k = 0; k < count; k++) {
+            Board child = *board;
+            fill(&child, player, moves[k]);
+            int value = -aiSearch(ai, &child, (player == PLAYER1) ? PLAYER2 : PLAYER1, depth - 1, -AI_WIN * 2, -alpha);
+            if (ai->stopped) break;
+            if (value > alpha) {
+                alpha = value;
+                iterationMove = moves[k];
+            }
+        }
+        if (ai->stopped) break; // keep the move of the last finished iteration
+        bestMove = iterationMove;
+        ai->depth = depth;
+
+        // search the best move first next time
+        for (int k = 0; k < count; k++) {
+            if (moves[k] == bestMove) {
+                for (; k > 0; k--) moves[k] = moves[k - 1];
+                moves[0] = bestMove;
+                break;
+            }
+        }
+        if (alpha >= AI_WIN || alpha <= -AI_WIN) break; // the winner is settled within this depth
+    }
+    return bestMove;
+}
+
+#endif
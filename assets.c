@@ -0,0 +1,28 @@
+/* LINKED PICTURES */
+// Puts the packed pictures listed in assets.h into read-only data, byte for byte from
+// the files the Makefile writes to build/assets/ (ASSET_DIR), under the names assets.h
+// declares. The assembler's .incbin reads them, so no picture is ever a C initializer and
+// this file compiles in no time. Build it from the top of the repository, after the
+// pictures: "make" on the host, then compile it for the board alongside filler.c.
+
+/* LIBRARIES */
+#include "assets.h"
+
+
+/* LINKING */
+#ifndef ASSET_DIR
+#define ASSET_DIR "build/assets/"
+#endif
+
+#define ASSET_STRING(text) #text
+#define ASSET_EXPANDED_STRING(text) ASSET_STRING(text)
+#define ASSET_SYMBOL(name) ASSET_EXPANDED_STRING(__USER_LABEL_PREFIX__) #name // C names have the prefix in assembly on some targets
+
+#define ASSET_INCBIN(name, file) \
+    __asm__(".section .rodata\n" \
+            ".balign 4\n" \
+            ".global " ASSET_SYMBOL(name) "\n" \
+            ASSET_SYMBOL(name) ":\n" \
+            ".incbin \"" ASSET_DIR file ".img\"\n" \
+            ".previous\n");
+ASSETS(ASSET_INCBIN)
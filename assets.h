@@ -0,0 +1,49 @@
+/* PICTURES */
+// The pictures of the game. Each is drawn in assets/ as a PNG or BMP file; the Makefile
+// packs it (image.h) with tools/mkimages.c into build/assets/, and assets.c links the
+// packed files in as they are. Changing a picture only needs a rebuild, no source edits.
+// The list gives each picture's name in the code and its file in assets/. The yellow2,
+// magenta2, ... icons in assets/ are not drawn by the game, so they are not linked.
+
+#ifndef ASSETS_H
+#define ASSETS_H
+
+/* LIBRARIES */
+#include <stdint.h>
+
+
+/* PICTURE LIST */
+#define ASSETS(X) \
+    X(Image, "start") \
+    X(Instructions, "instructions") \
+    X(BgImage, "background") \
+    X(Player1Win, "player1win") \
+    X(Player2Win, "player2win") \
+    X(Num0, "digit0") \
+    X(Num1, "digit1") \
+    X(Num2, "digit2") \
+    X(Num3, "digit3") \
+    X(Num4, "digit4") \
+    X(Num5, "digit5") \
+    X(Num6, "digit6") \
+    X(Num7, "digit7") \
+    X(Num8, "digit8") \
+    X(Num9, "digit9") \
+    X(r1, "red1") \
+    X(g1, "green1") \
+    X(b1, "blue1") \
+    X(c1, "cyan1") \
+    X(m1, "magenta1") \
+    X(ye1, "yellow1") \
+    X(r3, "red3") \
+    X(g3, "green3") \
+    X(b3, "blue3") \
+    X(c3, "cyan3") \
+    X(m3, "magenta3") \
+    X(ye3, "yellow3")
+
+#define ASSET_DECLARATION(name, file) extern const uint8_t name[];
+ASSETS(ASSET_DECLARATION)
+#undef ASSET_DECLARATION
+
+#endif
@@ -0,0 +1,176 @@
+/* BATCHED 8x8 ENGINE */
+// Advances BATCH_LANES independent 8x8 games at once, one game per 64-bit lane: every
+// mask of Board becomes a vector of masks and fill(), the legality test and the scores
+// run on all lanes together. Lanes uses GCC vector extensions, so the same code is
+// AVX2 with 4 lanes, AVX-512 with 8, and two AVX-512 registers with 16 (build with
+// -mavx2, -mavx512f or -march=native; without them it still runs, just narrower).
+// All lanes take turns in lockstep; lanes whose game is over are left out of a move
+// through an active mask. A batch fill floods each lane from its whole territory,
+// which on an 8x8 board is a handful of shift-and-mask rounds.
+
+#ifndef BATCH_H
+#define BATCH_H
+
+/* LIBRARIES */
+#include <stdint.h>
+#include <stdbool.h>
+#include "engine.h"
+
+
+/* BATCH INITIALIZATIONS */
+#ifndef BATCH_LANES
+#if defined(__AVX512F__)
+#define BATCH_LANES 8
+#else
+#define BATCH_LANES 4
+#endif
+#endif
+
+#if BATCH_LANES != 4 && BATCH_LANES != 8 && BATCH_LANES != 16
+#error "BATCH_LANES must be 4, 8 or 16"
+#endif
+
+#define NO_COLOR 7 // territoryColor of a lane whose player has no territory
+
+// every function here is static inline, so the vector ABI never crosses a real call
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+typedef uint64_t Lanes __attribute__((vector_size(BATCH_LANES * sizeof(uint64_t))));
+typedef int64_t SignedLanes __attribute__((vector_size(BATCH_LANES * sizeof(int64_t))));
+
+typedef struct {
+    Lanes colors[COLOR_COUNT]; // free cells of each color index
+    Lanes territory[2]; // cells owned by PLAYER1 and PLAYER2
+    Lanes territoryColor[2]; // color index, or NO_COLOR
+} BatchBoard;
+
+
+/* LANE HELPERS */
+static inline Lanes lanesOf(uint64_t value) {
+    Lanes lanes = {0};
+    return lanes + value;
+}
+
+static inline bool anyLane(Lanes lanes) {
+    uint64_t any = 0;
+    for (int l = 0; l < BATCH_LANES; l++) any |= lanes[l];
+    return any != 0;
+}
+
+// all ones in lanes where a == b
+static inline Lanes lanesEqual(Lanes a, Lanes b) {
+    return (Lanes)(a == b);
+}
+
+// bit count of every lane, without needing a vector popcount instruction
+static inline Lanes popcountLanes(Lanes x) {
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    x += x >> 8;
+    x += x >> 16;
+    x += x >> 32;
+    return x & 0x7F;
+}
+
+// the cells next to any cell of region, on an 8x8 board
+static inline Lanes batchGrow(Lanes region) {
+    const uint64_t notFirstColumn = ~0x0101010101010101ULL, notLastColumn = ~0x8080808080808080ULL;
+    return ((region << 1) & notFirstColumn) | ((region >> 1) & notLastColumn) | (region << 8) | (region >> 8);
+}
+
+
+/* BOARD ACCESS */
+// copy a Board (after claimCorners()) into one lane
+static inline void batchLoad(BatchBoard *batch, int lane, const Board *board) {
+    for (int c = 0; c < COLOR_COUNT; c++) batch->colors[c][lane] = board->colors[c][0];
+    for (int me = 0; me < 2; me++) {
+        batch->territory[me][lane] = board->territory[me][0];
+        batch->territoryColor[me][lane] = (board->territoryColor[me] < 0) ? NO_COLOR : (uint64_t)board->territoryColor[me];
+    }
+}
+
+// all ones in lanes where color is legal for either player to pick
+static inline Lanes batchLegal(const BatchBoard *batch, Lanes color) {
+    return ~lanesEqual(color, batch->territoryColor[0]) & ~lanesEqual(color, batch->territoryColor[1]);
+}
+
+static inline Lanes batchScore(const BatchBoard *batch, int player) {
+    return popcountLanes(batch->territory[player - 1]);
+}
+
+// all ones in lanes where no cell is left unowned
+static inline Lanes batchGameOver(const BatchBoard *batch) {
+    return lanesEqual(batchScore(batch, PLAYER1) + batchScore(batch, PLAYER2), lanesOf(BOARD_SIZE * BOARD_SIZE));
+}
+
+
+/* GAME LOGIC */
+// territory of the player after taking color in every lane of active, without changing the batch
+static inline Lanes batchFlood(const BatchBoard *batch, int player, Lanes color, Lanes active) {
+    Lanes target = lanesOf(0);
+    for (int c = 0; c < COLOR_COUNT; c++) target |= batch->colors[c] & lanesEqual(color, lanesOf(c));
+    target &= active & batchLegal(batch, color);
+
+    Lanes region = batch->territory[player - 1];
+    for (;;) {
+        Lanes grown = region | (batchGrow(region) & target);
+        if (!anyLane(grown ^ region)) return region;
+        region = grown;
+    }
+}
+
+// fill() in every lane of active with that lane's color; illegal colors change nothing.
+// Returns the cells absorbed in each lane.
+static inline Lanes batchFill(BatchBoard *batch, int player, Lanes color, Lanes active) {
+    int me = player - 1;
+    Lanes region = batchFlood(batch, player, color, active);
+    Lanes absorbed = region & ~batch->territory[me];
+    Lanes moved = active & batchLegal(batch, color);
+
+    batch->territory[me] = region;
+    for (int c = 0; c < COLOR_COUNT; c++) batch->colors[c] &= ~absorbed;
+    batch->territoryColor[me] = (color & moved) | (batch->territoryColor[me] & ~moved);
+    return popcountLanes(absorbed);
+}
+
+
+/* BOTS */
+// a uniformly random legal color in every lane; rng holds one xorshift state per lane
+static inline Lanes batchRandomMove(const BatchBoard *batch, Lanes *rng) {
+    Lanes x = *rng;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *rng = x;
+
+    Lanes count = lanesOf(0);
+    for (int c = 0; c < COLOR_COUNT; c++) count += batchLegal(batch, lanesOf(c)) & 1;
+    Lanes pick = (((x >> 32) & 0xFFFFFFFFULL) * count) >> 32; // 0 .. count - 1
+    Lanes move = lanesOf(0), seen = lanesOf(0);
+    for (int c = 0; c < COLOR_COUNT; c++) {
+        Lanes legal = batchLegal(batch, lanesOf(c));
+        move |= lanesOf(c) & legal & lanesEqual(seen, pick);
+        seen += legal & 1;
+    }
+    return move;
+}
+
+// the legal color that absorbs the most cells in every lane, the lowest color on ties
+static inline Lanes batchGreedyMove(const BatchBoard *batch, int player, Lanes active) {
+    Lanes move = lanesOf(0), territory = batch->territory[player - 1];
+    SignedLanes best = (SignedLanes)lanesOf(0) - 1;
+    for (int c = 0; c < COLOR_COUNT; c++) {
+        Lanes color = lanesOf(c), legal = batchLegal(batch, color);
+        SignedLanes gain = (SignedLanes)popcountLanes(batchFlood(batch, player, color, active) & ~territory);
+        Lanes better = legal & (Lanes)(gain > best);
+        move = (color & better) | (move & ~better);
+        best = (SignedLanes)(((Lanes)gain & better) | ((Lanes)best & ~better));
+    }
+    return move;
+}
+
+#pragma GCC diagnostic pop
+
+#endif
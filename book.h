@@ -0,0 +1,120 @@
+/* OPENING BOOK */
+// Moves for early positions, built from self-play by tools/mkbook.c and looked up by
+// positionHash(). The book is one flat file: a BookHeader followed by an open-addressed
+// table of BookEntry slots (linear probing, a power of two of them, key 0 for an empty
+// slot). The table is used where it lies, with no parsing, so on the host the file is
+// mmap'd and ready at once; anywhere else bookAttach() takes the same bytes from memory.
+
+#ifndef BOOK_H
+#define BOOK_H
+
+/* LIBRARIES */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "engine.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define BOOK_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+
+/* BOOK INITIALIZATIONS */
+#define BOOK_MAGIC 0x314B4F4F42464C46ULL // "FLFBOOK1"
+#define BOOK_KEY_CHECK (cellKey(1, 2) ^ territoryColorKey(PLAYER2, 3)) // changes if the hash keys do
+
+typedef struct {
+    uint64_t magic; // BOOK_MAGIC
+    uint64_t keyCheck; // BOOK_KEY_CHECK of the engine that built the book
+    uint32_t tableBits; // the table has 1 << tableBits slots
+    uint32_t boardSize;
+    uint64_t entries; // slots in use
+} BookHeader;
+
+typedef struct {
+    uint64_t key; // positionHash() with the player to move, 0 for an empty slot
+    uint16_t games; // self-play games through the position, saturated at 65535
+    uint16_t score; // share of the points the player to move took with move, out of 65535
+    int8_t move; // color to play
+    uint8_t unused[3];
+} BookEntry;
+
+typedef struct {
+    const BookEntry *table; // NULL when no book is loaded
+    uint64_t mask;
+    const void *mapped; // what bookClose() unmaps, NULL unless bookOpen() mapped it
+    size_t bytes;
+} Book;
+
+
+/* LOADING */
+// use a book already in memory; false, with the book left empty, if it does not fit this engine
+static inline bool bookAttach(Book *book, const void *data, size_t bytes) {
+    const BookHeader *header = data;
+    book->table = NULL;
+    book->mask = 0;
+    book->mapped = NULL;
+    if (!data || bytes < sizeof(BookHeader)) return false;
+    if (header->magic != BOOK_MAGIC || header->keyCheck != BOOK_KEY_CHECK || header->boardSize != BOARD_SIZE) return false;
+    // sizes in 64 bits, where a 2^40-slot table still fits whatever the width of size_t
+    if (header->tableBits > 40 || (uint64_t)bytes != sizeof(BookHeader) + ((uint64_t)sizeof(BookEntry) << header->tableBits)) return false;
+    if (header->entries >= (uint64_t)1 << header->tableBits) return false; // a lookup must reach an empty slot
+    book->table = (const BookEntry*)(header + 1);
+    book->mask = ((uint64_t)1 << header->tableBits) - 1;
+    return true;
+}
+
+#ifdef BOOK_MMAP
+// map a book file; false, with the book left empty, if it is missing or does not fit
+static inline bool bookOpen(Book *book, const char *path) {
+    book->table = NULL;
+    book->mapped = NULL;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat info;
+    void *data = MAP_FAILED;
+    if (fstat(fd, &info) == 0 && info.st_size > 0) data = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return false;
+
+    if (!bookAttach(book, data, (size_t)info.st_size)) {
+        munmap(data, (size_t)info.st_size);
+        return false;
+    }
+    book->mapped = data;
+    book->bytes = (size_t)info.st_size;
+    return true;
+}
+
+static inline void bookClose(Book *book) {
+    if (book->mapped) munmap((void*)book->mapped, book->bytes);
+    book->table = NULL;
+    book->mapped = NULL;
+}
+#endif
+
+
+/* LOOKUP */
+// the entry for a positionHash(), NULL if the book does not know the position
+static inline const BookEntry *bookFind(const Book *book, uint64_t key) {
+    if (!book || !book->table || key == 0) return NULL;
+    for (uint64_t slot = key & book->mask;; slot = (slot + 1) & book->mask) {
+        const BookEntry *entry = &book->table[slot];
+        if (entry->key == key) return entry;
+        if (entry->key == 0) return NULL;
+    }
+}
+
+// the book's color for the player to move, -1 if there is none or it is not legal here
+static inline int bookMove(const Book *book, const Board *board, int player) {
+    const BookEntry *entry = bookFind(book, positionHash(board, player));
+    if (!entry || entry->move < 0 || entry->move >= COLOR_COUNT) return -1;
+    if (entry->move == board->territoryColor[0] || entry->move == board->territoryColor[1]) return -1;
+    return entry->move;
+}
+
+#endif
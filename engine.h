@@ -0,0 +1,255 @@
+/* BITBOARD GAME ENGINE */
+// Each board keeps one bitmask per color and one per player's territory, so a move is
+// a handful of shifts and ANDs and a score is a popcount. The masks are built from
+// engine_impl.h once per board size: Board is the 8x8 board the VGA game plays on
+// (a single 64-bit word per mask), Board16 ... Board256 are specialised multi-word
+// versions, and BoardDyn takes any size chosen at runtime. AnyBoard picks the right
+// one through a BoardOps table so callers can choose the size at runtime.
+
+#ifndef ENGINE_H
+#define ENGINE_H
+
+/* LIBRARIES */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* GAME INITIALIZATIONS */
+#define BOARD_SIZE 8 // size of the board the VGA game plays on
+#define BOARD_MIN_SIZE 3 // smallest and largest boards the tools and record files take
+#define BOARD_MAX_SIZE 256
+#define COLOR_COUNT 6
+#define PLAYER1 1
+#define PLAYER2 2
+
+#define BOARD_WORDS(n) (((n) * (n) + 63) / 64) // 64-bit words per mask of an n x n board
+
+
+typedef uint64_t Bitboard;
+
+// per-size function table, filled in by each engine_impl.h instance
+typedef struct {
+    void (*clear)(void *board);
+    void (*setColor)(void *board, int row, int col, int color);
+    int (*colorAt)(const void *board, int row, int col);
+    int (*ownerAt)(const void *board, int row, int col);
+    int (*playerColor)(const void *board, int player);
+    void (*claimCorners)(void *board);
+    int (*fill)(void *board, int player, int color);
+    int (*score)(const void *board, int player);
+    int (*isGameOver)(const void *board);
+    uint64_t (*hash)(const void *board, int toMove);
+    int (*moveGains)(const void *board, int player, int gains[COLOR_COUNT]);
+    void (*generate)(void *board, uint64_t seed);
+    int (*changedCells)(const void *board, int *cells);
+} BoardOps;
+
+
+/* BIT HELPERS */
+static inline int popcount64(uint64_t b) {
+    return __builtin_popcountll(b);
+}
+
+static inline int testBit(const uint64_t *mask, int cell) {
+    return (mask[cell >> 6] >> (cell & 63)) & 1;
+}
+
+static inline void setBit(uint64_t *mask, int cell) {
+    mask[cell >> 6] |= 1ULL << (cell & 63);
+}
+
+static inline void clearBit(uint64_t *mask, int cell) {
+    mask[cell >> 6] &= ~(1ULL << (cell & 63));
+}
+
+static inline uint64_t wordAt(const uint64_t *mask, int words, int i) {
+    return (i >= 0 && i < words) ? mask[i] : 0;
+}
+
+// word i of the whole bitset shifted towards higher cells by shift bits
+static inline uint64_t shiftWordLeft(const uint64_t *mask, int words, int i, int shift) {
+    int q = shift >> 6, r = shift & 63;
+    uint64_t word = wordAt(mask, words, i - q) << r;
+    if (r) word |= wordAt(mask, words, i - q - 1) >> (64 - r);
+    return word;
+}
+
+// word i of the whole bitset shifted towards lower cells by shift bits
+static inline uint64_t shiftWordRight(const uint64_t *mask, int words, int i, int shift) {
+    int q = shift >> 6, r = shift & 63;
+    uint64_t word = wordAt(mask, words, i + q) >> r;
+    if (r) word |= wordAt(mask, words, i + q + 1) << (64 - r);
+    return word;
+}
+
+// player 1 starts in the top left corner, player 2 in the bottom right corner
+static inline int cornerCell(int size, int player) {
+    return (player == PLAYER1) ? 0 : size * size - 1;
+}
+
+
+/* ZOBRIST KEYS */
+// A position hashes to the XOR of one key per cell for its state (free color
+// 0 .. COLOR_COUNT - 1, or COLOR_COUNT + player - 1 once owned), one key per territory
+// color, and SIDE_KEY when player 2 is to move. Keys come from a fixed 64-bit mixer
+// rather than a table, so every board size has them without any setup and hashes
+// are the same from run to run.
+#define SIDE_KEY 0x9E3779B97F4A7C15ULL
+
+static inline uint64_t mix64(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+static inline uint64_t cellKey(int cell, int state) {
+    return mix64(((uint64_t)cell << 4 | (uint64_t)state) + SIDE_KEY);
+}
+
+static inline uint64_t territoryColorKey(int player, int color) {
+    return mix64(~(((uint64_t)player << 4) | (uint64_t)color));
+}
+
+
+/* RANDOM NUMBERS */
+// Counter-based generator (SplitMix64): number n of a stream is mix64(key + n * gamma), so
+// a stream is just a key and a counter, any board can be rebuilt from its 64-bit seed
+// and every game or thread owns its stream instead of sharing rand()'s hidden state.
+// splitSeed() hands out independent child seeds, e.g. one per game of a run.
+#define RNG_GAMMA 0x9E3779B97F4A7C15ULL
+#define BOARD_GENERATOR 1 // version of generateBoard(); bump it when a seed would give a different board
+
+typedef struct {
+    uint64_t key;
+    uint64_t counter;
+} Rng;
+
+static inline Rng newRng(uint64_t seed) {
+    Rng rng = { mix64(seed), 0 };
+    return rng;
+}
+
+static inline uint64_t rngNext(Rng *rng) {
+    return mix64(rng->key + ++rng->counter * RNG_GAMMA);
+}
+
+// uniform in 0 .. n - 1
+static inline int rngBelow(Rng *rng, int n) {
+    return (int)(((rngNext(rng) >> 32) * (uint64_t)n) >> 32);
+}
+
+// seed of child number index of seed
+static inline uint64_t splitSeed(uint64_t seed, uint64_t index) {
+    return mix64(mix64(seed) ^ mix64(index + RNG_GAMMA));
+}
+
+
+/* BOARD SIZES */
+#define BOARD_N 8
+#define BOARD_TYPE Board
+#define BOARD_FN(name) name
+#include "engine_impl.h"
+
+#define BOARD_N 16
+#define BOARD_TYPE Board16
+#define BOARD_FN(name) name##16
+#include "engine_impl.h"
+
+#define BOARD_N 32
+#define BOARD_TYPE Board32
+#define BOARD_FN(name) name##32
+#include "engine_impl.h"
+
+#define BOARD_N 64
+#define BOARD_TYPE Board64
+#define BOARD_FN(name) name##64
+#include "engine_impl.h"
+
+#define BOARD_N 128
+#define BOARD_TYPE Board128
+#define BOARD_FN(name) name##128
+#include "engine_impl.h"
+
+#define BOARD_N 256
+#define BOARD_TYPE Board256
+#define BOARD_FN(name) name##256
+#include "engine_impl.h"
+
+#define BOARD_TYPE BoardDyn
+#define BOARD_FN(name) name##Dyn
+#include "engine_impl.h"
+
+
+/* RUNTIME-SIZED BOARDS */
+// a BoardDyn and all of its masks live in one allocation; sizes past BOARD_MAX_SIZE are
+// refused, since working masks go on the stack with room for that size
+static inline BoardDyn *newBoardDyn(int size) {
+    if (size < 1 || size > BOARD_MAX_SIZE) return NULL;
+    int words = BOARD_WORDS(size);
+    int masks = COLOR_COUNT + 2 + 2 * COLOR_COUNT + 1 + 2 + 3; // colors, territories, frontiers, absorbed, edges and geometry
+    BoardDyn *board = malloc(sizeof(BoardDyn) + (size_t)masks * words * sizeof(uint64_t));
+    if (!board) return NULL;
+
+    uint64_t *bits = (uint64_t*)(board + 1);
+    memset(bits, 0, (size_t)masks * words * sizeof(uint64_t));
+    board->size = size;
+    board->words = words;
+    for (int c = 0; c < COLOR_COUNT; c++) board->colors[c] = bits + c * words;
+    bits += COLOR_COUNT * words;
+    for (int p = 0; p < 2; p++) {
+        board->territory[p] = bits;
+        bits += words;
+        for (int c = 0; c < COLOR_COUNT; c++) {
+            board->frontier[p][c] = bits;
+            bits += words;
+        }
+    }
+    board->absorbed = bits;
+    board->edges[0] = bits + words;
+    board->edges[1] = bits + 2 * words;
+    board->firstColumn = bits + 3 * words;
+    board->lastColumn = bits + 4 * words;
+    board->cells = bits + 5 * words;
+
+    for (int row = 0; row < size; row++) {
+        setBit(board->firstColumn, row * size);
+        setBit(board->lastColumn, row * size + size - 1);
+    }
+    for (int cell = 0; cell < size * size; cell++) setBit(board->cells, cell);
+    clearBoardDyn(board);
+    return board;
+}
+
+typedef struct {
+    int size;
+    const BoardOps *ops;
+    void *board; // Board, Board16 ... Board256 or BoardDyn depending on size
+} AnyBoard;
+
+// allocate a board of any size, using a specialised engine when one exists
+static inline bool newAnyBoard(AnyBoard *any, int size) {
+    any->size = size;
+    switch (size) {
+        case 8: any->ops = &boardOps; any->board = malloc(sizeof(Board)); break;
+        case 16: any->ops = &boardOps16; any->board = malloc(sizeof(Board16)); break;
+        case 32: any->ops = &boardOps32; any->board = malloc(sizeof(Board32)); break;
+        case 64: any->ops = &boardOps64; any->board = malloc(sizeof(Board64)); break;
+        case 128: any->ops = &boardOps128; any->board = malloc(sizeof(Board128)); break;
+        case 256: any->ops = &boardOps256; any->board = malloc(sizeof(Board256)); break;
+        default: any->ops = &boardOpsDyn; any->board = newBoardDyn(size); break;
+    }
+    if (!any->board) return false;
+    any->ops->clear(any->board);
+    return true;
+}
+
+static inline void freeAnyBoard(AnyBoard *any) {
+    free(any->board);
+    any->board = NULL;
+}
+
+#endif
@@ -0,0 +1,482 @@
+/* BOARD TEMPLATE */
+// Included by engine.h once per board size. Before each include define
+//   BOARD_TYPE      name of the board struct
+//   BOARD_FN(name)  how function names are spelled for this size
+//   BOARD_N         cells per side, or leave it undefined for a board sized at runtime
+// Masks are row-major bitsets: cell (row, col) is bit row * size + col, packed into
+// 64-bit words, so an 8x8 board is one word and a 64x64 board is one word per row.
+// With BOARD_N defined every loop bound and column mask is a compile-time constant.
+//
+// colors[] only holds free (unowned) cells; a territory is one color, kept in
+// territoryColor[], so recoloring it on a move costs nothing. Each player also keeps a
+// frontier: the free cells touching their territory, bucketed by color. A move takes
+// the bucket of the chosen color as seeds, floods from there and then settles the
+// border in one more pass over the same words: the newly exposed frontier cells and
+// the territory's edge cells (the outline the VGA game draws). absorbed[], score[] and
+// edges[] are all a move produces, and nothing outside the words it touched is visited.
+// changedCells() lists the cells whose color a move changed, for a display to redraw.
+// hash is the Zobrist hash of the position, updated with two keys per absorbed cell.
+
+#ifdef BOARD_N
+
+#if (64 % BOARD_N) != 0 && (BOARD_N % 64) != 0
+#error "specialised board sizes must divide 64 or be a multiple of 64"
+#endif
+
+#define B_SIZE(b) BOARD_N
+#define B_WORDS(b) BOARD_WORDS(BOARD_N)
+#define B_SCRATCH(b, name) uint64_t name[BOARD_WORDS(BOARD_N)]
+
+typedef struct {
+    uint64_t colors[COLOR_COUNT][BOARD_WORDS(BOARD_N)]; // free cells of each color index
+    uint64_t territory[2][BOARD_WORDS(BOARD_N)]; // cells owned by PLAYER1 and PLAYER2
+    uint64_t frontier[2][COLOR_COUNT][BOARD_WORDS(BOARD_N)]; // free cells touching each territory
+    uint64_t absorbed[BOARD_WORDS(BOARD_N)]; // cells taken by the last fill()
+    uint64_t edges[2][BOARD_WORDS(BOARD_N)]; // territory cells touching another cell or the side of the board
+    int territoryColor[2];
+    int score[2]; // cells in each territory, kept up to date by fill()
+    uint64_t hash; // Zobrist hash of colors, owners and territory colors, kept up to date by fill()
+    int frontierLo[2][COLOR_COUNT], frontierHi[2][COLOR_COUNT]; // word range of each bucket
+    int absorbedLo, absorbedHi; // word range of absorbed, empty when lo > hi
+    int mover; // player index of the last fill(), -1 if it changed nothing
+} BOARD_TYPE;
+
+#else
+
+#define B_SIZE(b) ((b)->size)
+#define B_WORDS(b) ((b)->words)
+#define B_SCRATCH(b, name) uint64_t name[BOARD_WORDS(BOARD_MAX_SIZE)] // on the stack, so const boards stay untouched
+
+typedef struct {
+    int size; // cells per side
+    int words; // 64-bit words per mask
+    uint64_t *colors[COLOR_COUNT];
+    uint64_t *territory[2];
+    uint64_t *frontier[2][COLOR_COUNT];
+    uint64_t *absorbed;
+    uint64_t *edges[2];
+    int territoryColor[2];
+    int score[2];
+    uint64_t hash;
+    int frontierLo[2][COLOR_COUNT], frontierHi[2][COLOR_COUNT];
+    int absorbedLo, absorbedHi;
+    int mover;
+    uint64_t *firstColumn; // col 0 of every row
+    uint64_t *lastColumn; // col size - 1 of every row
+    uint64_t *cells; // every cell on the board, clears the padding in the last word
+} BOARD_TYPE;
+
+#endif
+
+
+/* GEOMETRY */
+static inline uint64_t BOARD_FN(firstColumnWord)(const BOARD_TYPE *board, int i) {
+    (void)board; (void)i;
+#if !defined(BOARD_N)
+    return board->firstColumn[i];
+#elif BOARD_N == 64
+    return 1ULL;
+#elif BOARD_N < 64
+    return ~0ULL / ((1ULL << BOARD_N) - 1); // bit 0 repeated every BOARD_N bits
+#else
+    return (i % (BOARD_N / 64) == 0) ? 1ULL : 0;
+#endif
+}
+
+static inline uint64_t BOARD_FN(lastColumnWord)(const BOARD_TYPE *board, int i) {
+    (void)board; (void)i;
+#if !defined(BOARD_N)
+    return board->lastColumn[i];
+#elif BOARD_N <= 64
+    return BOARD_FN(firstColumnWord)(board, i) << (BOARD_N - 1);
+#else
+    return (i % (BOARD_N / 64) == BOARD_N / 64 - 1) ? 1ULL << 63 : 0;
+#endif
+}
+
+static inline uint64_t BOARD_FN(cellsWord)(const BOARD_TYPE *board, int i) {
+    (void)board; (void)i;
+#ifdef BOARD_N
+    return ~0ULL; // every specialised size fills its last word
+#else
+    return board->cells[i];
+#endif
+}
+
+// how many words away a one-cell step can reach
+static inline int BOARD_FN(stepReach)(const BOARD_TYPE *board) {
+    (void)board;
+    return B_SIZE(board) / 64 + 1;
+}
+
+// word i of the cells next to any cell in mask
+static inline uint64_t BOARD_FN(grownWord)(const BOARD_TYPE *board, const uint64_t *mask, int i) {
+    int size = B_SIZE(board), words = B_WORDS(board);
+    return ((shiftWordLeft(mask, words, i, 1) & ~BOARD_FN(firstColumnWord)(board, i))  // right, minus row wrap
+          | (shiftWordRight(mask, words, i, 1) & ~BOARD_FN(lastColumnWord)(board, i))  // left, minus row wrap
+          | shiftWordLeft(mask, words, i, size)                                        // down
+          | shiftWordRight(mask, words, i, size))                                      // up
+          & BOARD_FN(cellsWord)(board, i);
+}
+
+// grow region in place through the cells of mask that touch it. Only the words
+// between *lo and *hi (the region's word range, widened as it grows) and one step
+// around them are visited; words of region outside that range must be zero.
+// Sweeping upwards and then downwards carries the fill across many rows per pass.
+static inline void BOARD_FN(floodMask)(const BOARD_TYPE *board, uint64_t *region, const uint64_t *mask, int *lo, int *hi) {
+    int words = B_WORDS(board), reach = BOARD_FN(stepReach)(board);
+    bool changed;
+    do {
+        changed = false;
+        int from = (*lo - reach > 0) ? *lo - reach : 0;
+        int to = (*hi + reach < words - 1) ? *hi + reach : words - 1;
+        for (int i = from; i <= to; i++) {
+            uint64_t grown = region[i] | (BOARD_FN(grownWord)(board, region, i) & mask[i]);
+            if (grown != region[i]) {
+                region[i] = grown;
+                changed = true;
+                if (i < *lo) *lo = i;
+                if (i > *hi) *hi = i;
+            }
+        }
+        for (int i = to; i >= from; i--) {
+            uint64_t grown = region[i] | (BOARD_FN(grownWord)(board, region, i) & mask[i]);
+            if (grown != region[i]) {
+                region[i] = grown;
+                changed = true;
+                if (i < *lo) *lo = i;
+                if (i > *hi) *hi = i;
+            }
+        }
+    } while (changed);
+}
+
+// word i of the cells of mask whose four neighbours are all in mask
+static inline uint64_t BOARD_FN(interiorWord)(const BOARD_TYPE *board, const uint64_t *mask, int i) {
+    int size = B_SIZE(board), words = B_WORDS(board);
+    return mask[i]
+         & (shiftWordRight(mask, words, i, 1) & ~BOARD_FN(lastColumnWord)(board, i))
+         & (shiftWordLeft(mask, words, i, 1) & ~BOARD_FN(firstColumnWord)(board, i))
+         & shiftWordRight(mask, words, i, size)
+         & shiftWordLeft(mask, words, i, size);
+}
+
+// after a player's territory grew by grown (word range lo..hi): add the free cells next
+// to it to their frontier buckets and refresh their edge cells. Only cells within one
+// step of grown can change, so both are settled in the same pass over those words.
+static inline void BOARD_FN(extendFrontier)(BOARD_TYPE *board, int me, const uint64_t *grown, int lo, int hi) {
+    int words = B_WORDS(board), reach = BOARD_FN(stepReach)(board);
+    int from = (lo - reach > 0) ? lo - reach : 0;
+    int to = (hi + reach < words - 1) ? hi + reach : words - 1;
+    for (int i = from; i <= to; i++) {
+        board->edges[me][i] = board->territory[me][i] & ~BOARD_FN(interiorWord)(board, board->territory[me], i);
+        uint64_t border = BOARD_FN(grownWord)(board, grown, i);
+        if (!border) continue;
+        for (int c = 0; c < COLOR_COUNT; c++) {
+            uint64_t add = border & board->colors[c][i];
+            if (!add) continue;
+            board->frontier[me][c][i] |= add;
+            if (i < board->frontierLo[me][c]) board->frontierLo[me][c] = i;
+            if (i > board->frontierHi[me][c]) board->frontierHi[me][c] = i;
+        }
+    }
+}
+
+
+/* BOARD ACCESS */
+// empty every mask; set the colors and then call claimCorners() to start a game
+static inline void BOARD_FN(clearBoard)(BOARD_TYPE *board) {
+    int words = B_WORDS(board);
+    for (int i = 0; i < words; i++) {
+        for (int c = 0; c < COLOR_COUNT; c++) {
+            board->colors[c][i] = 0;
+            board->frontier[0][c][i] = board->frontier[1][c][i] = 0;
+        }
+        board->territory[0][i] = board->territory[1][i] = 0;
+        board->edges[0][i] = board->edges[1][i] = 0;
+        board->absorbed[i] = 0;
+    }
+    for (int c = 0; c < COLOR_COUNT; c++) {
+        board->frontierLo[0][c] = board->frontierLo[1][c] = words;
+        board->frontierHi[0][c] = board->frontierHi[1][c] = -1;
+    }
+    board->territoryColor[0] = board->territoryColor[1] = -1;
+    board->score[0] = board->score[1] = 0;
+    board->hash = 0;
+    board->absorbedLo = words;
+    board->absorbedHi = -1;
+    board->mover = -1;
+}
+
+// color a free cell; only valid before claimCorners()
+static inline void BOARD_FN(setColor)(BOARD_TYPE *board, int row, int col, int color) {
+    int cell = row * B_SIZE(board) + col;
+    for (int c = 0; c < COLOR_COUNT; c++) clearBit(board->colors[c], cell);
+    setBit(board->colors[color], cell);
+}
+
+// PLAYER1, PLAYER2 or 0 for an unowned cell
+static inline int BOARD_FN(ownerAt)(const BOARD_TYPE *board, int row, int col) {
+    int cell = row * B_SIZE(board) + col;
+    if (testBit(board->territory[0], cell)) return PLAYER1;
+    if (testBit(board->territory[1], cell)) return PLAYER2;
+    return 0;
+}
+
+// color index of a cell, -1 if it has not been set yet
+static inline int BOARD_FN(colorAt)(const BOARD_TYPE *board, int row, int col) {
+    int owner = BOARD_FN(ownerAt)(board, row, col);
+    if (owner) return board->territoryColor[owner - 1];
+
+    int cell = row * B_SIZE(board) + col;
+    for (int c = 0; c < COLOR_COUNT; c++) {
+        if (testBit(board->colors[c], cell)) return c;
+    }
+    return -1;
+}
+
+// color index of a player's territory (the color of their corner)
+static inline int BOARD_FN(playerColor)(const BOARD_TYPE *board, int player) {
+    return board->territoryColor[player - 1];
+}
+
+// Zobrist hash of the whole position worked out from scratch; fill() keeps board->hash
+// equal to this without visiting any cell it did not absorb
+static inline uint64_t BOARD_FN(rehash)(const BOARD_TYPE *board) {
+    int words = B_WORDS(board);
+    uint64_t hash = 0;
+    for (int i = 0; i < words; i++) {
+        for (int state = 0; state < COLOR_COUNT + 2; state++) {
+            uint64_t w = (state < COLOR_COUNT) ? board->colors[state][i] : board->territory[state - COLOR_COUNT][i];
+            while (w) {
+                hash ^= cellKey(i * 64 + __builtin_ctzll(w), state);
+                w &= w - 1;
+            }
+        }
+    }
+    for (int me = 0; me < 2; me++) {
+        if (board->territoryColor[me] >= 0) hash ^= territoryColorKey(me + 1, board->territoryColor[me]);
+    }
+    return hash;
+}
+
+// give each player the same-colored region around their corner and set up their frontier
+static inline void BOARD_FN(claimCorners)(BOARD_TYPE *board) {
+    for (int player = PLAYER1; player <= PLAYER2; player++) {
+        int me = player - 1, corner = cornerCell(B_SIZE(board), player);
+        int color = -1;
+        for (int c = 0; c < COLOR_COUNT; c++) {
+            if (testBit(board->colors[c], corner)) color = c;
+        }
+        if (color < 0) continue; // corner already taken by the other player
+
+        int lo = corner >> 6, hi = corner >> 6;
+        uint64_t *region = board->territory[me];
+        setBit(region, corner);
+        BOARD_FN(floodMask)(board, region, board->colors[color], &lo, &hi);
+        for (int i = lo; i <= hi; i++) {
+            board->colors[color][i] &= ~region[i];
+            board->score[me] += popcount64(region[i]);
+        }
+        board->territoryColor[me] = color;
+    }
+    // both territories are settled, so neither frontier can pick up the other's cells
+    int words = B_WORDS(board);
+    BOARD_FN(extendFrontier)(board, 0, board->territory[0], 0, words - 1);
+    BOARD_FN(extendFrontier)(board, 1, board->territory[1], 0, words - 1);
+    board->hash = BOARD_FN(rehash)(board);
+}
+
+// clear the board and fill it with random colors, never the same as the cell above or
+// to the left, then give the players their corners. The same seed always gives the same board.
+// Each color is drawn straight from the ones its up and left neighbours allow, so nothing
+// is ever redrawn; row[] remembers the row above, and one random number covers two cells.
+static inline void BOARD_FN(generateBoard)(BOARD_TYPE *board, uint64_t seed) {
+    int size = B_SIZE(board);
+    signed char row[size]; // colors of the row above, then of this row up to the cell
+    Rng rng = newRng(seed);
+    uint64_t bits = 0;
+    BOARD_FN(clearBoard)(board);
+    for (int i = 0, cell = 0; i < size; i++) {
+        for (int j = 0; j < size; j++, cell++) {
+            int up = (i > 0) ? row[j] : -1, left = (j > 0) ? row[j - 1] : -1;
+            int low = (up < left) ? up : left, high = (up < left) ? left : up;
+            if (low == high) low = -1; // at most one color is ruled out
+            int allowed = COLOR_COUNT - (low >= 0) - (high >= 0);
+
+            if ((cell & 1) == 0) bits = rngNext(&rng);
+            else bits <<= 32;
+            int color = (int)(((bits >> 32) * (uint64_t)allowed) >> 32); // 0 .. allowed - 1
+            if (low >= 0 && color >= low) color++; // skip the ruled out colors in order
+            if (high >= 0 && color >= high) color++;
+
+            row[j] = (signed char)color;
+            board->colors[color][cell >> 6] |= 1ULL << (cell & 63);
+        }
+    }
+    BOARD_FN(claimCorners)(board);
+}
+
+#ifdef BOARD_N
+// fill boards[0 .. count - 1] for a simulation: boards[k] is generateBoard() of
+// splitSeed(seed, first + k), so threads can each take a range of the same run
+static inline void BOARD_FN(generateBoards)(BOARD_TYPE *boards, long count, uint64_t seed, long first) {
+    for (long k = 0; k < count; k++) BOARD_FN(generateBoard)(&boards[k], splitSeed(seed, (uint64_t)(first + k)));
+}
+#endif
+
+// hash of the position with toMove (PLAYER1 or PLAYER2) to play next; fill() does not
+// know whose turn follows, since a turn can also pass on a timeout
+static inline uint64_t BOARD_FN(positionHash)(const BOARD_TYPE *board, int toMove) {
+    return board->hash ^ ((toMove == PLAYER2) ? SIDE_KEY : 0);
+}
+
+// a player's territory cells that touch another cell or the side of the board,
+// kept up to date by fill()
+static inline const uint64_t *BOARD_FN(territoryEdges)(const BOARD_TYPE *board, int player) {
+    return board->edges[player - 1];
+}
+
+
+/* GAME LOGIC */
+// which colors the player may pick (bit c of the result) and how many cells each would
+// absorb, in one pass over their frontier. A bucket is the gain unless it touches more
+// free cells of its color; only then is a copy of it flooded (never on boards from
+// generateBoard(), where no two neighbours share a color). gains[] of an illegal color is 0.
+static inline int BOARD_FN(moveGains)(const BOARD_TYPE *board, int player, int gains[COLOR_COUNT]) {
+    int me = player - 1, words = B_WORDS(board), reach = BOARD_FN(stepReach)(board), legal = 0;
+    for (int c = 0; c < COLOR_COUNT; c++) {
+        gains[c] = 0;
+        if (c == board->territoryColor[0] || c == board->territoryColor[1]) continue;
+        legal |= 1 << c;
+
+        const uint64_t *bucket = board->frontier[me][c];
+        int lo = board->frontierLo[me][c], hi = board->frontierHi[me][c];
+        int from = (lo - reach > 0) ? lo - reach : 0;
+        int to = (hi + reach < words - 1) ? hi + reach : words - 1;
+        bool spreads = false;
+        for (int i = from; i <= to; i++) {
+            gains[c] += popcount64(bucket[i]);
+            if (BOARD_FN(grownWord)(board, bucket, i) & board->colors[c][i] & ~bucket[i]) spreads = true;
+        }
+        if (!spreads) continue;
+
+        B_SCRATCH(board, region);
+        memset(region, 0, sizeof(uint64_t) * words);
+        for (int i = lo; i <= hi; i++) region[i] = bucket[i];
+        BOARD_FN(floodMask)(board, region, board->colors[c], &lo, &hi);
+        gains[c] = 0;
+        for (int i = lo; i <= hi; i++) gains[c] += popcount64(region[i]);
+    }
+    return legal;
+}
+
+// fill the player's blocks with the selected color, returns how many cells were absorbed
+static inline int BOARD_FN(fill)(BOARD_TYPE *board, int player, int color) {
+    board->mover = -1;
+    if (color < 0 || color >= COLOR_COUNT) return 0;
+
+    int me = player - 1, opp = 1 - me;
+    if (board->territoryColor[me] == color) return 0; // don't change anything if the target color is the same as the selected color
+    if (board->territoryColor[opp] == color) return 0; // don't change anything if the other player's color is the same as the selected color
+
+    // forget the previous move, then seed this one with the bucket of the chosen color
+    uint64_t *absorbed = board->absorbed, *bucket = board->frontier[me][color];
+    for (int i = board->absorbedLo; i <= board->absorbedHi; i++) absorbed[i] = 0;
+    int lo = board->frontierLo[me][color], hi = board->frontierHi[me][color];
+    for (int i = lo; i <= hi; i++) {
+        absorbed[i] = bucket[i];
+        bucket[i] = 0;
+    }
+    board->frontierLo[me][color] = B_WORDS(board);
+    board->frontierHi[me][color] = -1;
+
+    // same-colored free cells connected to the seeds come along too
+    BOARD_FN(floodMask)(board, absorbed, board->colors[color], &lo, &hi);
+    int gain = 0;
+    uint64_t hash = board->hash;
+    for (int i = lo; i <= hi; i++) {
+        board->territory[me][i] |= absorbed[i];
+        board->colors[color][i] &= ~absorbed[i];
+        board->frontier[opp][color][i] &= ~absorbed[i];
+        gain += popcount64(absorbed[i]);
+        for (uint64_t w = absorbed[i]; w; w &= w - 1) {
+            int cell = i * 64 + __builtin_ctzll(w);
+            hash ^= cellKey(cell, color) ^ cellKey(cell, COLOR_COUNT + me); // free color out, owner in
+        }
+    }
+    if (board->territoryColor[me] >= 0) hash ^= territoryColorKey(player, board->territoryColor[me]);
+    board->hash = hash ^ territoryColorKey(player, color);
+    board->territoryColor[me] = color;
+    board->score[me] += gain;
+    board->absorbedLo = lo;
+    board->absorbedHi = hi;
+    board->mover = me;
+
+    BOARD_FN(extendFrontier)(board, me, absorbed, lo, hi);
+    return gain;
+}
+
+// the cells whose color the last fill() changed, as row * size + col in rising order:
+// the mover's territory, which all took the new color, absorbed cells included; cells[]
+// needs room for the whole board. Returns how many, 0 if the last fill() changed nothing
+static inline int BOARD_FN(changedCells)(const BOARD_TYPE *board, int *cells) {
+    if (board->mover < 0) return 0;
+    const uint64_t *territory = board->territory[board->mover];
+    int count = 0;
+    for (int i = 0; i < B_WORDS(board); i++) {
+        for (uint64_t w = territory[i]; w; w &= w - 1) cells[count++] = i * 64 + __builtin_ctzll(w);
+    }
+    return count;
+}
+
+// calculate the player's current score
+static inline int BOARD_FN(calculateScore)(const BOARD_TYPE *board, int player) {
+    return board->score[player - 1];
+}
+
+// check if the game is over (no unowned blocks remaining)
+static inline int BOARD_FN(isGameOver)(const BOARD_TYPE *board) {
+    return board->score[0] + board->score[1] == B_SIZE(board) * B_SIZE(board);
+}
+
+
+/* DISPATCH TABLE */
+// void* wrappers so a board picked at runtime can reach this size through BoardOps
+static void BOARD_FN(opClear)(void *board) { BOARD_FN(clearBoard)((BOARD_TYPE*)board); }
+static void BOARD_FN(opSetColor)(void *board, int row, int col, int color) { BOARD_FN(setColor)((BOARD_TYPE*)board, row, col, color); }
+static int BOARD_FN(opColorAt)(const void *board, int row, int col) { return BOARD_FN(colorAt)((const BOARD_TYPE*)board, row, col); }
+static int BOARD_FN(opOwnerAt)(const void *board, int row, int col) { return BOARD_FN(ownerAt)((const BOARD_TYPE*)board, row, col); }
+static int BOARD_FN(opPlayerColor)(const void *board, int player) { return BOARD_FN(playerColor)((const BOARD_TYPE*)board, player); }
+static void BOARD_FN(opClaimCorners)(void *board) { BOARD_FN(claimCorners)((BOARD_TYPE*)board); }
+static int BOARD_FN(opFill)(void *board, int player, int color) { return BOARD_FN(fill)((BOARD_TYPE*)board, player, color); }
+static int BOARD_FN(opScore)(const void *board, int player) { return BOARD_FN(calculateScore)((const BOARD_TYPE*)board, player); }
+static int BOARD_FN(opIsGameOver)(const void *board) { return BOARD_FN(isGameOver)((const BOARD_TYPE*)board); }
+static uint64_t BOARD_FN(opHash)(const void *board, int toMove) { return BOARD_FN(positionHash)((const BOARD_TYPE*)board, toMove); }
+static int BOARD_FN(opMoveGains)(const void *board, int player, int gains[COLOR_COUNT]) { return BOARD_FN(moveGains)((const BOARD_TYPE*)board, player, gains); }
+static void BOARD_FN(opGenerate)(void *board, uint64_t seed) { BOARD_FN(generateBoard)((BOARD_TYPE*)board, seed); }
+static int BOARD_FN(opChangedCells)(const void *board, int *cells) { return BOARD_FN(changedCells)((const BOARD_TYPE*)board, cells); }
+
+static const BoardOps BOARD_FN(boardOps) = {
+    BOARD_FN(opClear),
+    BOARD_FN(opSetColor),
+    BOARD_FN(opColorAt),
+    BOARD_FN(opOwnerAt),
+    BOARD_FN(opPlayerColor),
+    BOARD_FN(opClaimCorners),
+    BOARD_FN(opFill),
+    BOARD_FN(opScore),
+    BOARD_FN(opIsGameOver),
+    BOARD_FN(opHash),
+    BOARD_FN(opMoveGains),
+    BOARD_FN(opGenerate),
+    BOARD_FN(opChangedCells),
+};
+
+
+#undef B_SIZE
+#undef B_WORDS
+#undef B_SCRATCH
+#undef BOARD_TYPE
+#undef BOARD_FN
+#undef BOARD_N
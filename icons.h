@@ -1,941 +0,0 @@
-int y1 [48][42];
-int y2 [48][42];
-int y3 [48][42];
-
-int m1 [48][42];
-int m2 [48][42];
-int m3 [48][42];
-
-int c1 [48][42];
-int c2 [48][42];
-int c3 [48][42];
-
-int b1 [48][42];
-int b2 [48][42];
-int b3 [48][42];
-
-int g1 [48][42];
-int g2 [48][42];
-int g3 [48][42];
-
-int r1 [48][42];
-int r2 [48][42];
-int r3 [48][42];
-
-int y1 [48][42] = {
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65532,65532,65532,65532,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65532,65532,65532,65532,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65532,65532,65532,65532,65532,65532,65092,65092,65092,65092,65092,65092,65092,65092,65532,65532,65532,65532,65532,65532,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,39872,39872,39872,39872,39872,39872,65092,65092,65092,65092,65092,65092,65092,65092,39872,39872,39872,39872,39872,39872,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,39872,39872,39872,39872,39872,39872,65092,65092,65092,65092,65092,65092,65092,65092,39872,39872,39872,39872,39872,39872,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65532,65532,65532,65532,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65532,65532,65532,65532,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,65180,65180,65180,65180,65092,65092,65092,65092,65092,65092,65092,65092,39872,39872,39872,39872,39872,39872,39872,39872,65092,65092,65092,65092,65092,65092,65092,65092,65180,65180,65180,65180,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,65180,65180,65180,65180,65092,65092,65092,65092,65092,65092,65092,65092,39872,39872,39872,39872,39872,39872,39872,39872,65092,65092,65092,65092,65092,65092,65092,65092,65180,65180,65180,65180,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,65180,65180,65180,65180,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65180,65180,65180,65180,59227,59227,59227,59227,10500},
-	{10500,59227,59227,65092,65092,65180,65180,65180,65180,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65180,65180,65180,65180,65092,65092,59227,59227,10500},
-	{10500,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,10500},
-	{10500,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,10500},
-	{10500,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,10500},
-	{10500,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,10500},
-	{10500,65092,65092,65092,65092,65092,65092,65290,65092,65092,65092,65290,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65290,65092,65092,65290,65290,65092,65092,65092,65092,65092,65092,65092,65092,65092,10500},
-	{10500,65092,65092,65092,65092,65092,65092,65290,65290,65092,65092,65290,65290,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65290,65290,65092,65092,65290,65290,65092,65092,65092,65092,65092,65092,65092,65092,10500},
-	{10500,54595,54595,65092,65092,65092,65092,65092,65290,65290,65092,65092,65290,65290,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65290,65290,65092,65092,65290,65290,65092,65092,65092,65092,65092,54595,54595,10500},
-	{10500,54595,54595,65092,65092,65092,65092,65092,65092,65290,65092,65092,65092,65290,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65290,65092,65092,65092,65290,65092,65092,65092,65092,65092,54595,54595,10500},
-	{10500,54595,54595,54595,54595,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,54595,54595,54595,54595,10500},
-	{10500,54595,54595,54595,54595,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,54595,54595,54595,54595,10500},
-	{10500,54595,54595,54595,54595,54595,54595,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,54595,54595,54595,54595,54595,54595,10500},
-	{10500,54595,54595,54595,54595,54595,54595,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,54595,54595,54595,54595,54595,54595,10500},
-	{10500,54595,54595,54595,54595,54595,54595,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,54595,54595,54595,54595,54595,54595,10500},
-	{10500,54595,54595,54595,54595,54595,54595,54595,54595,54595,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,54595,54595,54595,54595,54595,54595,54595,54595,54595,10500},
-	{10500,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,10500},
-	{10500,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,10500},
-	{10500,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,10500},
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-};
-
-int y2 [48][42] = {
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65532,65532,65532,65532,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65532,65532,65532,65532,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65532,65532,65532,65532,65532,65532,65092,65092,65092,65092,65092,65092,65092,65092,65532,65532,65532,65532,65532,65532,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,39872,39872,39872,39872,39872,39872,65092,65092,65092,65092,65092,65092,65092,65092,39872,39872,39872,39872,39872,39872,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,39872,39872,39872,39872,39872,39872,65092,65092,65092,65092,65092,65092,65092,65092,39872,39872,39872,39872,39872,39872,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65532,65532,65532,65532,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65532,65532,65532,65532,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,65180,65180,65180,65180,65092,65092,65092,65092,65092,65092,65092,65092,39872,39872,39872,39872,39872,39872,39872,39872,65092,65092,65092,65092,65092,65092,65092,65092,65180,65180,65180,65180,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,65180,65180,65180,65180,65092,65092,65092,65092,65092,65092,65092,65092,39872,39872,39872,39872,39872,39872,39872,39872,65092,65092,65092,65092,65092,65092,65092,65092,65180,65180,65180,65180,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,65180,65180,65180,65180,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65180,65180,65180,65180,59227,59227,59227,59227,10500},
-	{10500,59227,59227,65092,65092,65180,65180,65180,65180,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65180,65180,65180,65180,65092,65092,59227,59227,10500},
-	{10500,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,10500},
-	{10500,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,10500},
-	{10500,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,10500},
-	{10500,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,10500},
-	{10500,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,10500},
-	{10500,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,10500},
-	{10500,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,10500},
-	{10500,65092,65092,65092,65092,65092,65092,65290,65092,65092,65092,65290,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65290,65092,65092,65290,65290,65092,65092,65092,65092,65092,65092,65092,65092,65092,10500},
-	{10500,65092,65092,65092,65092,65092,65092,65290,65290,65092,65092,65290,65290,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65290,65290,65092,65092,65290,65290,65092,65092,65092,65092,65092,65092,65092,65092,10500},
-	{10500,54595,54595,65092,65092,65092,65092,65092,65290,65290,65092,65092,65290,65290,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65290,65290,65092,65092,65290,65290,65092,65092,65092,65092,65092,54595,54595,10500},
-	{10500,54595,54595,65092,65092,65092,65092,65092,65092,65290,65092,65092,65092,65290,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65290,65092,65092,65092,65290,65092,65092,65092,65092,65092,54595,54595,10500},
-	{10500,54595,54595,54595,54595,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,54595,54595,54595,54595,10500},
-	{10500,54595,54595,54595,54595,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,54595,54595,54595,54595,10500},
-	{10500,54595,54595,54595,54595,54595,54595,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,54595,54595,54595,54595,54595,54595,10500},
-	{10500,54595,54595,54595,54595,54595,54595,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,54595,54595,54595,54595,54595,54595,10500},
-	{10500,54595,54595,54595,54595,54595,54595,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,54595,54595,54595,54595,54595,54595,10500},
-	{10500,54595,54595,54595,54595,54595,54595,54595,54595,54595,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,54595,54595,54595,54595,54595,54595,54595,54595,54595,10500},
-	{10500,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,10500},
-	{10500,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,10500},
-	{10500,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,10500},
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-};
-
-int y3 [48][42] = {
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65532,65532,65532,65532,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65532,65532,65532,65532,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65532,39872,39872,39872,39872,65532,65092,65092,65092,65092,65092,65092,65092,65092,65532,39872,39872,39872,39872,65532,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,39872,39872,39872,39872,39872,39872,65092,65092,65092,65092,65092,65092,65092,65092,39872,39872,39872,39872,39872,39872,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,39872,65532,65532,65532,65532,39872,65092,65092,65092,65092,65092,65092,65092,65092,39872,65532,65532,65532,65532,39872,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65532,65532,65532,65532,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65532,65532,65532,65532,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,65180,65180,65180,65180,65092,65092,65092,65092,65092,65092,65092,65092,39872,39872,39872,39872,39872,39872,39872,39872,65092,65092,65092,65092,65092,65092,65092,65092,65180,65180,65180,65180,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,65180,65180,65180,65180,65092,65092,65092,65092,65092,65092,65092,65092,39872,39872,39872,39872,39872,39872,39872,39872,65092,65092,65092,65092,65092,65092,65092,65092,65180,65180,65180,65180,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,65180,65180,65180,65180,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65180,65180,65180,65180,59227,59227,59227,59227,10500},
-	{10500,59227,59227,65092,65092,65180,65180,65180,65180,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65180,65180,65180,65180,65092,65092,59227,59227,10500},
-	{10500,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,10500},
-	{10500,59227,59227,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,59227,59227,10500},
-	{10500,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,10500},
-	{10500,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,10500},
-	{10500,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,10500},
-	{10500,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,10500},
-	{10500,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,10500},
-	{10500,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,10500},
-	{10500,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,10500},
-	{10500,65092,65092,65092,65092,65092,65092,65290,65092,65092,65092,65290,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65290,65092,65092,65290,65290,65092,65092,65092,65092,65092,65092,65092,65092,65092,10500},
-	{10500,65092,65092,65092,65092,65092,65092,65290,65290,65092,65092,65290,65290,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65290,65290,65092,65092,65290,65290,65092,65092,65092,65092,65092,65092,65092,65092,10500},
-	{10500,54595,54595,65092,65092,65092,65092,65092,65290,65290,65092,65092,65290,65290,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65290,65290,65092,65092,65290,65290,65092,65092,65092,65092,65092,54595,54595,10500},
-	{10500,54595,54595,65092,65092,65092,65092,65092,65092,65290,65092,65092,65092,65290,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65290,65092,65092,65092,65290,65092,65092,65092,65092,65092,54595,54595,10500},
-	{10500,54595,54595,54595,54595,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,54595,54595,54595,54595,10500},
-	{10500,54595,54595,54595,54595,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,54595,54595,54595,54595,10500},
-	{10500,54595,54595,54595,54595,54595,54595,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,54595,54595,54595,54595,54595,54595,10500},
-	{10500,54595,54595,54595,54595,54595,54595,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,54595,54595,54595,54595,54595,54595,10500},
-	{10500,54595,54595,54595,54595,54595,54595,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,54595,54595,54595,54595,54595,54595,10500},
-	{10500,54595,54595,54595,54595,54595,54595,54595,54595,54595,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,65092,54595,54595,54595,54595,54595,54595,54595,54595,54595,10500},
-	{10500,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,10500},
-	{10500,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,10500},
-	{10500,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,54595,10500},
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-};
-
-int m1 [48][42] = {
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,65343,65343,65343,65343,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,65343,65343,65343,65343,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,65343,65343,65343,65343,65343,65343,55774,55774,55774,55774,55774,55774,55774,55774,65343,65343,65343,65343,65343,65343,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,32914,32914,32914,32914,32914,32914,55774,55774,55774,55774,55774,55774,55774,55774,32914,32914,32914,32914,32914,32914,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,32914,32914,32914,32914,32914,32914,55774,55774,55774,55774,55774,55774,55774,55774,32914,32914,32914,32914,32914,32914,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,65343,65343,65343,65343,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,65343,65343,65343,65343,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,64828,64828,64828,64828,55774,55774,55774,55774,55774,55774,55774,55774,32914,32914,32914,32914,32914,32914,32914,32914,55774,55774,55774,55774,55774,55774,55774,55774,64828,64828,64828,64828,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,64828,64828,64828,64828,55774,55774,55774,55774,55774,55774,55774,55774,32914,32914,32914,32914,32914,32914,32914,32914,55774,55774,55774,55774,55774,55774,55774,55774,64828,64828,64828,64828,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,64828,64828,64828,64828,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,64828,64828,64828,64828,59227,59227,59227,59227,10500},
-	{10500,59227,59227,55774,55774,64828,64828,64828,64828,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,64828,64828,64828,64828,55774,55774,59227,59227,10500},
-	{10500,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,10500},
-	{10500,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,10500},
-	{10500,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,10500},
-	{10500,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,10500},
-	{10500,55774,55774,55774,55774,55774,55774,60191,55774,55774,55774,60191,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,60191,55774,55774,60191,60191,55774,55774,55774,55774,55774,55774,55774,55774,55774,10500},
-	{10500,55774,55774,55774,55774,55774,55774,60191,60191,55774,55774,60191,60191,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,60191,60191,55774,55774,60191,60191,55774,55774,55774,55774,55774,55774,55774,55774,10500},
-	{10500,45401,45401,55774,55774,55774,55774,55774,60191,60191,55774,55774,60191,60191,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,60191,60191,55774,55774,60191,60191,55774,55774,55774,55774,55774,45401,45401,10500},
-	{10500,45401,45401,55774,55774,55774,55774,55774,55774,60191,55774,55774,55774,60191,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,60191,55774,55774,55774,60191,55774,55774,55774,55774,55774,45401,45401,10500},
-	{10500,45401,45401,45401,45401,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,45401,45401,45401,45401,10500},
-	{10500,45401,45401,45401,45401,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,45401,45401,45401,45401,10500},
-	{10500,45401,45401,45401,45401,45401,45401,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,45401,45401,45401,45401,45401,45401,10500},
-	{10500,45401,45401,45401,45401,45401,45401,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,45401,45401,45401,45401,45401,45401,10500},
-	{10500,45401,45401,45401,45401,45401,45401,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,45401,45401,45401,45401,45401,45401,10500},
-	{10500,45401,45401,45401,45401,45401,45401,45401,45401,45401,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,45401,45401,45401,45401,45401,45401,45401,45401,45401,10500},
-	{10500,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,10500},
-	{10500,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,10500},
-	{10500,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,10500},
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-};
-
-int m2 [48][42] = {
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,65343,65343,65343,65343,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,65343,65343,65343,65343,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,65343,65343,65343,65343,65343,65343,55774,55774,55774,55774,55774,55774,55774,55774,65343,65343,65343,65343,65343,65343,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,32914,32914,32914,32914,32914,32914,55774,55774,55774,55774,55774,55774,55774,55774,32914,32914,32914,32914,32914,32914,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,32914,32914,32914,32914,32914,32914,55774,55774,55774,55774,55774,55774,55774,55774,32914,32914,32914,32914,32914,32914,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,65343,65343,65343,65343,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,65343,65343,65343,65343,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,64828,64828,64828,64828,55774,55774,55774,55774,55774,55774,55774,55774,32914,32914,32914,32914,32914,32914,32914,32914,55774,55774,55774,55774,55774,55774,55774,55774,64828,64828,64828,64828,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,64828,64828,64828,64828,55774,55774,55774,55774,55774,55774,55774,55774,32914,32914,32914,32914,32914,32914,32914,32914,55774,55774,55774,55774,55774,55774,55774,55774,64828,64828,64828,64828,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,64828,64828,64828,64828,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,64828,64828,64828,64828,59227,59227,59227,59227,10500},
-	{10500,59227,59227,55774,55774,64828,64828,64828,64828,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,64828,64828,64828,64828,55774,55774,59227,59227,10500},
-	{10500,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,10500},
-	{10500,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,10500},
-	{10500,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,10500},
-	{10500,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,10500},
-	{10500,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,10500},
-	{10500,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,10500},
-	{10500,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,10500},
-	{10500,55774,55774,55774,55774,55774,55774,60191,55774,55774,55774,60191,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,60191,55774,55774,60191,60191,55774,55774,55774,55774,55774,55774,55774,55774,55774,10500},
-	{10500,55774,55774,55774,55774,55774,55774,60191,60191,55774,55774,60191,60191,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,60191,60191,55774,55774,60191,60191,55774,55774,55774,55774,55774,55774,55774,55774,10500},
-	{10500,45401,45401,55774,55774,55774,55774,55774,60191,60191,55774,55774,60191,60191,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,60191,60191,55774,55774,60191,60191,55774,55774,55774,55774,55774,45401,45401,10500},
-	{10500,45401,45401,55774,55774,55774,55774,55774,55774,60191,55774,55774,55774,60191,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,60191,55774,55774,55774,60191,55774,55774,55774,55774,55774,45401,45401,10500},
-	{10500,45401,45401,45401,45401,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,45401,45401,45401,45401,10500},
-	{10500,45401,45401,45401,45401,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,45401,45401,45401,45401,10500},
-	{10500,45401,45401,45401,45401,45401,45401,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,45401,45401,45401,45401,45401,45401,10500},
-	{10500,45401,45401,45401,45401,45401,45401,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,45401,45401,45401,45401,45401,45401,10500},
-	{10500,45401,45401,45401,45401,45401,45401,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,45401,45401,45401,45401,45401,45401,10500},
-	{10500,45401,45401,45401,45401,45401,45401,45401,45401,45401,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,45401,45401,45401,45401,45401,45401,45401,45401,45401,10500},
-	{10500,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,10500},
-	{10500,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,10500},
-	{10500,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,10500},
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-};
-
-int m3 [48][42] = {
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,65343,65343,65343,65343,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,65343,65343,65343,65343,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,65343,32914,32914,32914,32914,65343,55774,55774,55774,55774,55774,55774,55774,55774,65343,32914,32914,32914,32914,65343,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,32914,32914,32914,32914,32914,32914,55774,55774,55774,55774,55774,55774,55774,55774,32914,32914,32914,32914,32914,32914,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,32914,65343,65343,65343,65343,32914,55774,55774,55774,55774,55774,55774,55774,55774,32914,65343,65343,65343,65343,32914,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,65343,65343,65343,65343,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,65343,65343,65343,65343,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,64828,64828,64828,64828,55774,55774,55774,55774,55774,55774,55774,55774,32914,32914,32914,32914,32914,32914,32914,32914,55774,55774,55774,55774,55774,55774,55774,55774,64828,64828,64828,64828,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,64828,64828,64828,64828,55774,55774,55774,55774,55774,55774,55774,55774,32914,32914,32914,32914,32914,32914,32914,32914,55774,55774,55774,55774,55774,55774,55774,55774,64828,64828,64828,64828,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,64828,64828,64828,64828,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,64828,64828,64828,64828,59227,59227,59227,59227,10500},
-	{10500,59227,59227,55774,55774,64828,64828,64828,64828,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,64828,64828,64828,64828,55774,55774,59227,59227,10500},
-	{10500,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,10500},
-	{10500,59227,59227,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,59227,59227,10500},
-	{10500,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,10500},
-	{10500,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,10500},
-	{10500,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,10500},
-	{10500,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,10500},
-	{10500,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,10500},
-	{10500,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,10500},
-	{10500,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,10500},
-	{10500,55774,55774,55774,55774,55774,55774,60191,55774,55774,55774,60191,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,60191,55774,55774,60191,60191,55774,55774,55774,55774,55774,55774,55774,55774,55774,10500},
-	{10500,55774,55774,55774,55774,55774,55774,60191,60191,55774,55774,60191,60191,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,60191,60191,55774,55774,60191,60191,55774,55774,55774,55774,55774,55774,55774,55774,10500},
-	{10500,45401,45401,55774,55774,55774,55774,55774,60191,60191,55774,55774,60191,60191,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,60191,60191,55774,55774,60191,60191,55774,55774,55774,55774,55774,45401,45401,10500},
-	{10500,45401,45401,55774,55774,55774,55774,55774,55774,60191,55774,55774,55774,60191,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,60191,55774,55774,55774,60191,55774,55774,55774,55774,55774,45401,45401,10500},
-	{10500,45401,45401,45401,45401,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,45401,45401,45401,45401,10500},
-	{10500,45401,45401,45401,45401,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,45401,45401,45401,45401,10500},
-	{10500,45401,45401,45401,45401,45401,45401,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,45401,45401,45401,45401,45401,45401,10500},
-	{10500,45401,45401,45401,45401,45401,45401,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,45401,45401,45401,45401,45401,45401,10500},
-	{10500,45401,45401,45401,45401,45401,45401,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,45401,45401,45401,45401,45401,45401,10500},
-	{10500,45401,45401,45401,45401,45401,45401,45401,45401,45401,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,55774,45401,45401,45401,45401,45401,45401,45401,45401,45401,10500},
-	{10500,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,10500},
-	{10500,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,10500},
-	{10500,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,45401,10500},
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-};
-
-int c1 [48][42] = {
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,63487,63487,63487,63487,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,63487,63487,63487,63487,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,63487,63487,63487,63487,63487,63487,18262,18262,18262,18262,18262,18262,18262,18262,63487,63487,63487,63487,63487,63487,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,7309,7309,7309,7309,7309,7309,18262,18262,18262,18262,18262,18262,18262,18262,7309,7309,7309,7309,7309,7309,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,7309,7309,7309,7309,7309,7309,18262,18262,18262,18262,18262,18262,18262,18262,7309,7309,7309,7309,7309,7309,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,63487,63487,63487,63487,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,63487,63487,63487,63487,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,64858,64858,64858,64858,18262,18262,18262,18262,18262,18262,18262,18262,7309,7309,7309,7309,7309,7309,7309,7309,18262,18262,18262,18262,18262,18262,18262,18262,64858,64858,64858,64858,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,64858,64858,64858,64858,18262,18262,18262,18262,18262,18262,18262,18262,7309,7309,7309,7309,7309,7309,7309,7309,18262,18262,18262,18262,18262,18262,18262,18262,64858,64858,64858,64858,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,64858,64858,64858,64858,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,64858,64858,64858,64858,59227,59227,59227,59227,10500},
-	{10500,59227,59227,18262,18262,64858,64858,64858,64858,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,64858,64858,64858,64858,18262,18262,59227,59227,10500},
-	{10500,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,10500},
-	{10500,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,10500},
-	{10500,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,10500},
-	{10500,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,10500},
-	{10500,18262,18262,18262,18262,18262,18262,28665,18262,18262,18262,28665,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,28665,18262,18262,28665,28665,18262,18262,18262,18262,18262,18262,18262,18262,18262,10500},
-	{10500,18262,18262,18262,18262,18262,18262,28665,28665,18262,18262,28665,28665,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,28665,28665,18262,18262,28665,28665,18262,18262,18262,18262,18262,18262,18262,18262,10500},
-	{10500,13874,13874,18262,18262,18262,18262,18262,28665,28665,18262,18262,28665,28665,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,28665,28665,18262,18262,28665,28665,18262,18262,18262,18262,18262,13874,13874,10500},
-	{10500,13874,13874,18262,18262,18262,18262,18262,18262,28665,18262,18262,18262,28665,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,28665,18262,18262,18262,28665,18262,18262,18262,18262,18262,13874,13874,10500},
-	{10500,13874,13874,13874,13874,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,13874,13874,13874,13874,10500},
-	{10500,13874,13874,13874,13874,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,13874,13874,13874,13874,10500},
-	{10500,13874,13874,13874,13874,13874,13874,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,13874,13874,13874,13874,13874,13874,10500},
-	{10500,13874,13874,13874,13874,13874,13874,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,13874,13874,13874,13874,13874,13874,10500},
-	{10500,13874,13874,13874,13874,13874,13874,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,13874,13874,13874,13874,13874,13874,10500},
-	{10500,13874,13874,13874,13874,13874,13874,13874,13874,13874,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,13874,13874,13874,13874,13874,13874,13874,13874,13874,10500},
-	{10500,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,10500},
-	{10500,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,10500},
-	{10500,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,10500},
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-};
-
-int c2 [48][42] = {
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,63487,63487,63487,63487,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,63487,63487,63487,63487,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,63487,63487,63487,63487,63487,63487,18262,18262,18262,18262,18262,18262,18262,18262,63487,63487,63487,63487,63487,63487,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,7309,7309,7309,7309,7309,7309,18262,18262,18262,18262,18262,18262,18262,18262,7309,7309,7309,7309,7309,7309,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,7309,7309,7309,7309,7309,7309,18262,18262,18262,18262,18262,18262,18262,18262,7309,7309,7309,7309,7309,7309,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,63487,63487,63487,63487,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,63487,63487,63487,63487,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,64858,64858,64858,64858,18262,18262,18262,18262,18262,18262,18262,18262,7309,7309,7309,7309,7309,7309,7309,7309,18262,18262,18262,18262,18262,18262,18262,18262,64858,64858,64858,64858,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,64858,64858,64858,64858,18262,18262,18262,18262,18262,18262,18262,18262,7309,7309,7309,7309,7309,7309,7309,7309,18262,18262,18262,18262,18262,18262,18262,18262,64858,64858,64858,64858,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,64858,64858,64858,64858,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,64858,64858,64858,64858,59227,59227,59227,59227,10500},
-	{10500,59227,59227,18262,18262,64858,64858,64858,64858,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,64858,64858,64858,64858,18262,18262,59227,59227,10500},
-	{10500,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,10500},
-	{10500,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,10500},
-	{10500,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,10500},
-	{10500,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,10500},
-	{10500,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,10500},
-	{10500,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,10500},
-	{10500,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,10500},
-	{10500,18262,18262,18262,18262,18262,18262,28665,18262,18262,18262,28665,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,28665,18262,18262,28665,28665,18262,18262,18262,18262,18262,18262,18262,18262,18262,10500},
-	{10500,18262,18262,18262,18262,18262,18262,28665,28665,18262,18262,28665,28665,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,28665,28665,18262,18262,28665,28665,18262,18262,18262,18262,18262,18262,18262,18262,10500},
-	{10500,13874,13874,18262,18262,18262,18262,18262,28665,28665,18262,18262,28665,28665,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,28665,28665,18262,18262,28665,28665,18262,18262,18262,18262,18262,13874,13874,10500},
-	{10500,13874,13874,18262,18262,18262,18262,18262,18262,28665,18262,18262,18262,28665,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,28665,18262,18262,18262,28665,18262,18262,18262,18262,18262,13874,13874,10500},
-	{10500,13874,13874,13874,13874,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,13874,13874,13874,13874,10500},
-	{10500,13874,13874,13874,13874,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,13874,13874,13874,13874,10500},
-	{10500,13874,13874,13874,13874,13874,13874,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,13874,13874,13874,13874,13874,13874,10500},
-	{10500,13874,13874,13874,13874,13874,13874,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,13874,13874,13874,13874,13874,13874,10500},
-	{10500,13874,13874,13874,13874,13874,13874,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,13874,13874,13874,13874,13874,13874,10500},
-	{10500,13874,13874,13874,13874,13874,13874,13874,13874,13874,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,13874,13874,13874,13874,13874,13874,13874,13874,13874,10500},
-	{10500,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,10500},
-	{10500,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,10500},
-	{10500,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,10500},
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-};
-
-int c3 [48][42] = {
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,63487,63487,63487,63487,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,63487,63487,63487,63487,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,63487,7309,7309,7309,7309,63487,18262,18262,18262,18262,18262,18262,18262,18262,63487,7309,7309,7309,7309,63487,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,7309,7309,7309,7309,7309,7309,18262,18262,18262,18262,18262,18262,18262,18262,7309,7309,7309,7309,7309,7309,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,7309,63487,63487,63487,63487,7309,18262,18262,18262,18262,18262,18262,18262,18262,7309,63487,63487,63487,63487,7309,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,63487,63487,63487,63487,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,63487,63487,63487,63487,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,64858,64858,64858,64858,18262,18262,18262,18262,18262,18262,18262,18262,7309,7309,7309,7309,7309,7309,7309,7309,18262,18262,18262,18262,18262,18262,18262,18262,64858,64858,64858,64858,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,64858,64858,64858,64858,18262,18262,18262,18262,18262,18262,18262,18262,7309,7309,7309,7309,7309,7309,7309,7309,18262,18262,18262,18262,18262,18262,18262,18262,64858,64858,64858,64858,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,64858,64858,64858,64858,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,64858,64858,64858,64858,59227,59227,59227,59227,10500},
-	{10500,59227,59227,18262,18262,64858,64858,64858,64858,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,64858,64858,64858,64858,18262,18262,59227,59227,10500},
-	{10500,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,10500},
-	{10500,59227,59227,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,59227,59227,10500},
-	{10500,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,10500},
-	{10500,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,10500},
-	{10500,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,10500},
-	{10500,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,10500},
-	{10500,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,10500},
-	{10500,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,10500},
-	{10500,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,10500},
-	{10500,18262,18262,18262,18262,18262,18262,28665,18262,18262,18262,28665,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,28665,18262,18262,28665,28665,18262,18262,18262,18262,18262,18262,18262,18262,18262,10500},
-	{10500,18262,18262,18262,18262,18262,18262,28665,28665,18262,18262,28665,28665,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,28665,28665,18262,18262,28665,28665,18262,18262,18262,18262,18262,18262,18262,18262,10500},
-	{10500,13874,13874,18262,18262,18262,18262,18262,28665,28665,18262,18262,28665,28665,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,28665,28665,18262,18262,28665,28665,18262,18262,18262,18262,18262,13874,13874,10500},
-	{10500,13874,13874,18262,18262,18262,18262,18262,18262,28665,18262,18262,18262,28665,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,28665,18262,18262,18262,28665,18262,18262,18262,18262,18262,13874,13874,10500},
-	{10500,13874,13874,13874,13874,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,13874,13874,13874,13874,10500},
-	{10500,13874,13874,13874,13874,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,13874,13874,13874,13874,10500},
-	{10500,13874,13874,13874,13874,13874,13874,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,13874,13874,13874,13874,13874,13874,10500},
-	{10500,13874,13874,13874,13874,13874,13874,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,13874,13874,13874,13874,13874,13874,10500},
-	{10500,13874,13874,13874,13874,13874,13874,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,13874,13874,13874,13874,13874,13874,10500},
-	{10500,13874,13874,13874,13874,13874,13874,13874,13874,13874,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,18262,13874,13874,13874,13874,13874,13874,13874,13874,13874,10500},
-	{10500,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,10500},
-	{10500,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,10500},
-	{10500,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,13874,10500},
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-};
-
-int b1 [48][42] = {
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,63423,63423,63423,63423,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,63423,63423,63423,63423,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,63423,63423,63423,63423,63423,63423,17311,17311,17311,17311,17311,17311,17311,17311,63423,63423,63423,63423,63423,63423,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,4563,4563,4563,4563,4563,4563,17311,17311,17311,17311,17311,17311,17311,17311,4563,4563,4563,4563,4563,4563,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,4563,4563,4563,4563,4563,4563,17311,17311,17311,17311,17311,17311,17311,17311,4563,4563,4563,4563,4563,4563,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,63423,63423,63423,63423,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,63423,63423,63423,63423,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,60892,60892,60892,60892,17311,17311,17311,17311,17311,17311,17311,17311,4563,4563,4563,4563,4563,4563,4563,4563,17311,17311,17311,17311,17311,17311,17311,17311,60892,60892,60892,60892,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,60892,60892,60892,60892,17311,17311,17311,17311,17311,17311,17311,17311,4563,4563,4563,4563,4563,4563,4563,4563,17311,17311,17311,17311,17311,17311,17311,17311,60892,60892,60892,60892,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,60892,60892,60892,60892,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,60892,60892,60892,60892,59227,59227,59227,59227,10500},
-	{10500,59227,59227,17311,17311,60892,60892,60892,60892,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,60892,60892,60892,60892,17311,17311,59227,59227,10500},
-	{10500,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,10500},
-	{10500,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,10500},
-	{10500,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10500},
-	{10500,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10500},
-	{10500,17311,17311,17311,17311,17311,17311,25791,17311,17311,17311,25791,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,25791,17311,17311,25791,25791,17311,17311,17311,17311,17311,17311,17311,17311,17311,10500},
-	{10500,17311,17311,17311,17311,17311,17311,25791,25791,17311,17311,25791,25791,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,25791,25791,17311,17311,25791,25791,17311,17311,17311,17311,17311,17311,17311,17311,10500},
-	{10500,10970,10970,17311,17311,17311,17311,17311,25791,25791,17311,17311,25791,25791,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,25791,25791,17311,17311,25791,25791,17311,17311,17311,17311,17311,10970,10970,10500},
-	{10500,10970,10970,17311,17311,17311,17311,17311,17311,25791,17311,17311,17311,25791,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,25791,17311,17311,17311,25791,17311,17311,17311,17311,17311,10970,10970,10500},
-	{10500,10970,10970,10970,10970,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10970,10970,10970,10970,10500},
-	{10500,10970,10970,10970,10970,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10970,10970,10970,10970,10500},
-	{10500,10970,10970,10970,10970,10970,10970,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10970,10970,10970,10970,10970,10970,10500},
-	{10500,10970,10970,10970,10970,10970,10970,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10970,10970,10970,10970,10970,10970,10500},
-	{10500,10970,10970,10970,10970,10970,10970,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10970,10970,10970,10970,10970,10970,10500},
-	{10500,10970,10970,10970,10970,10970,10970,10970,10970,10970,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10970,10970,10970,10970,10970,10970,10970,10970,10970,10500},
-	{10500,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10500},
-	{10500,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10500},
-	{10500,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10500},
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-};
-
-int b2 [48][42] = {
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,63423,63423,63423,63423,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,63423,63423,63423,63423,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,63423,63423,63423,63423,63423,63423,17311,17311,17311,17311,17311,17311,17311,17311,63423,63423,63423,63423,63423,63423,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,4563,4563,4563,4563,4563,4563,17311,17311,17311,17311,17311,17311,17311,17311,4563,4563,4563,4563,4563,4563,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,4563,4563,4563,4563,4563,4563,17311,17311,17311,17311,17311,17311,17311,17311,4563,4563,4563,4563,4563,4563,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,63423,63423,63423,63423,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,63423,63423,63423,63423,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,60892,60892,60892,60892,17311,17311,17311,17311,17311,17311,17311,17311,4563,4563,4563,4563,4563,4563,4563,4563,17311,17311,17311,17311,17311,17311,17311,17311,60892,60892,60892,60892,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,60892,60892,60892,60892,17311,17311,17311,17311,17311,17311,17311,17311,4563,4563,4563,4563,4563,4563,4563,4563,17311,17311,17311,17311,17311,17311,17311,17311,60892,60892,60892,60892,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,60892,60892,60892,60892,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,60892,60892,60892,60892,59227,59227,59227,59227,10500},
-	{10500,59227,59227,17311,17311,60892,60892,60892,60892,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,60892,60892,60892,60892,17311,17311,59227,59227,10500},
-	{10500,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,10500},
-	{10500,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,10500},
-	{10500,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10500},
-	{10500,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10500},
-	{10500,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10500},
-	{10500,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10500},
-	{10500,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10500},
-	{10500,17311,17311,17311,17311,17311,17311,25791,17311,17311,17311,25791,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,25791,17311,17311,25791,25791,17311,17311,17311,17311,17311,17311,17311,17311,17311,10500},
-	{10500,17311,17311,17311,17311,17311,17311,25791,25791,17311,17311,25791,25791,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,25791,25791,17311,17311,25791,25791,17311,17311,17311,17311,17311,17311,17311,17311,10500},
-	{10500,10970,10970,17311,17311,17311,17311,17311,25791,25791,17311,17311,25791,25791,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,25791,25791,17311,17311,25791,25791,17311,17311,17311,17311,17311,10970,10970,10500},
-	{10500,10970,10970,17311,17311,17311,17311,17311,17311,25791,17311,17311,17311,25791,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,25791,17311,17311,17311,25791,17311,17311,17311,17311,17311,10970,10970,10500},
-	{10500,10970,10970,10970,10970,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10970,10970,10970,10970,10500},
-	{10500,10970,10970,10970,10970,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10970,10970,10970,10970,10500},
-	{10500,10970,10970,10970,10970,10970,10970,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10970,10970,10970,10970,10970,10970,10500},
-	{10500,10970,10970,10970,10970,10970,10970,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10970,10970,10970,10970,10970,10970,10500},
-	{10500,10970,10970,10970,10970,10970,10970,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10970,10970,10970,10970,10970,10970,10500},
-	{10500,10970,10970,10970,10970,10970,10970,10970,10970,10970,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10970,10970,10970,10970,10970,10970,10970,10970,10970,10500},
-	{10500,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10500},
-	{10500,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10500},
-	{10500,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10500},
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-};
-
-int b3 [48][42] = {
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,63423,63423,63423,63423,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,63423,63423,63423,63423,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,63423,4563,4563,4563,4563,63423,17311,17311,17311,17311,17311,17311,17311,17311,63423,4563,4563,4563,4563,63423,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,4563,4563,4563,4563,4563,4563,17311,17311,17311,17311,17311,17311,17311,17311,4563,4563,4563,4563,4563,4563,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,4563,63423,63423,63423,63423,4563,17311,17311,17311,17311,17311,17311,17311,17311,4563,63423,63423,63423,63423,4563,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,63423,63423,63423,63423,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,63423,63423,63423,63423,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,60892,60892,60892,60892,17311,17311,17311,17311,17311,17311,17311,17311,4563,4563,4563,4563,4563,4563,4563,4563,17311,17311,17311,17311,17311,17311,17311,17311,60892,60892,60892,60892,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,60892,60892,60892,60892,17311,17311,17311,17311,17311,17311,17311,17311,4563,4563,4563,4563,4563,4563,4563,4563,17311,17311,17311,17311,17311,17311,17311,17311,60892,60892,60892,60892,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,60892,60892,60892,60892,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,60892,60892,60892,60892,59227,59227,59227,59227,10500},
-	{10500,59227,59227,17311,17311,60892,60892,60892,60892,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,60892,60892,60892,60892,17311,17311,59227,59227,10500},
-	{10500,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,10500},
-	{10500,59227,59227,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,59227,59227,10500},
-	{10500,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10500},
-	{10500,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10500},
-	{10500,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10500},
-	{10500,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10500},
-	{10500,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10500},
-	{10500,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10500},
-	{10500,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10500},
-	{10500,17311,17311,17311,17311,17311,17311,25791,17311,17311,17311,25791,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,25791,17311,17311,25791,25791,17311,17311,17311,17311,17311,17311,17311,17311,17311,10500},
-	{10500,17311,17311,17311,17311,17311,17311,25791,25791,17311,17311,25791,25791,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,25791,25791,17311,17311,25791,25791,17311,17311,17311,17311,17311,17311,17311,17311,10500},
-	{10500,10970,10970,17311,17311,17311,17311,17311,25791,25791,17311,17311,25791,25791,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,25791,25791,17311,17311,25791,25791,17311,17311,17311,17311,17311,10970,10970,10500},
-	{10500,10970,10970,17311,17311,17311,17311,17311,17311,25791,17311,17311,17311,25791,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,25791,17311,17311,17311,25791,17311,17311,17311,17311,17311,10970,10970,10500},
-	{10500,10970,10970,10970,10970,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10970,10970,10970,10970,10500},
-	{10500,10970,10970,10970,10970,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10970,10970,10970,10970,10500},
-	{10500,10970,10970,10970,10970,10970,10970,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10970,10970,10970,10970,10970,10970,10500},
-	{10500,10970,10970,10970,10970,10970,10970,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10970,10970,10970,10970,10970,10970,10500},
-	{10500,10970,10970,10970,10970,10970,10970,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10970,10970,10970,10970,10970,10970,10500},
-	{10500,10970,10970,10970,10970,10970,10970,10970,10970,10970,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,17311,10970,10970,10970,10970,10970,10970,10970,10970,10970,10500},
-	{10500,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10500},
-	{10500,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10500},
-	{10500,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10970,10500},
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-};
-
-int g1 [48][42] = {
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,65535,65535,65535,65535,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,65535,65535,65535,65535,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,65535,65535,65535,65535,65535,65535,23663,23663,23663,23663,23663,23663,23663,23663,65535,65535,65535,65535,65535,65535,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,8808,8808,8808,8808,8808,8808,23663,23663,23663,23663,23663,23663,23663,23663,8808,8808,8808,8808,8808,8808,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,8808,8808,8808,8808,8808,8808,23663,23663,23663,23663,23663,23663,23663,23663,8808,8808,8808,8808,8808,8808,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,65535,65535,65535,65535,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,65535,65535,65535,65535,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,62999,62999,62999,62999,23663,23663,23663,23663,23663,23663,23663,23663,8808,8808,8808,8808,8808,8808,8808,8808,23663,23663,23663,23663,23663,23663,23663,23663,62999,62999,62999,62999,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,62999,62999,62999,62999,23663,23663,23663,23663,23663,23663,23663,23663,8808,8808,8808,8808,8808,8808,8808,8808,23663,23663,23663,23663,23663,23663,23663,23663,62999,62999,62999,62999,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,62999,62999,62999,62999,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,62999,62999,62999,62999,59227,59227,59227,59227,10500},
-	{10500,59227,59227,23663,23663,62999,62999,62999,62999,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,62999,62999,62999,62999,23663,23663,59227,59227,10500},
-	{10500,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,10500},
-	{10500,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,10500},
-	{10500,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,10500},
-	{10500,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,10500},
-	{10500,23663,23663,23663,23663,23663,23663,30035,23663,23663,23663,30035,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,30035,23663,23663,30035,30035,23663,23663,23663,23663,23663,23663,23663,23663,23663,10500},
-	{10500,23663,23663,23663,23663,23663,23663,30035,30035,23663,23663,30035,30035,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,30035,30035,23663,23663,30035,30035,23663,23663,23663,23663,23663,23663,23663,23663,10500},
-	{10500,17292,17292,23663,23663,23663,23663,23663,30035,30035,23663,23663,30035,30035,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,30035,30035,23663,23663,30035,30035,23663,23663,23663,23663,23663,17292,17292,10500},
-	{10500,17292,17292,23663,23663,23663,23663,23663,23663,30035,23663,23663,23663,30035,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,30035,23663,23663,23663,30035,23663,23663,23663,23663,23663,17292,17292,10500},
-	{10500,17292,17292,17292,17292,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,17292,17292,17292,17292,10500},
-	{10500,17292,17292,17292,17292,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,17292,17292,17292,17292,10500},
-	{10500,17292,17292,17292,17292,17292,17292,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,17292,17292,17292,17292,17292,17292,10500},
-	{10500,17292,17292,17292,17292,17292,17292,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,17292,17292,17292,17292,17292,17292,10500},
-	{10500,17292,17292,17292,17292,17292,17292,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,17292,17292,17292,17292,17292,17292,10500},
-	{10500,17292,17292,17292,17292,17292,17292,17292,17292,17292,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,17292,17292,17292,17292,17292,17292,17292,17292,17292,10500},
-	{10500,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,10500},
-	{10500,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,10500},
-	{10500,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,10500},
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-};
-
-int g2 [48][42] = {
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,65535,65535,65535,65535,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,65535,65535,65535,65535,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,65535,65535,65535,65535,65535,65535,23663,23663,23663,23663,23663,23663,23663,23663,65535,65535,65535,65535,65535,65535,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,8808,8808,8808,8808,8808,8808,23663,23663,23663,23663,23663,23663,23663,23663,8808,8808,8808,8808,8808,8808,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,8808,8808,8808,8808,8808,8808,23663,23663,23663,23663,23663,23663,23663,23663,8808,8808,8808,8808,8808,8808,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,65535,65535,65535,65535,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,65535,65535,65535,65535,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,62999,62999,62999,62999,23663,23663,23663,23663,23663,23663,23663,23663,8808,8808,8808,8808,8808,8808,8808,8808,23663,23663,23663,23663,23663,23663,23663,23663,62999,62999,62999,62999,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,62999,62999,62999,62999,23663,23663,23663,23663,23663,23663,23663,23663,8808,8808,8808,8808,8808,8808,8808,8808,23663,23663,23663,23663,23663,23663,23663,23663,62999,62999,62999,62999,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,62999,62999,62999,62999,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,62999,62999,62999,62999,59227,59227,59227,59227,10500},
-	{10500,59227,59227,23663,23663,62999,62999,62999,62999,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,62999,62999,62999,62999,23663,23663,59227,59227,10500},
-	{10500,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,10500},
-	{10500,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,10500},
-	{10500,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,10500},
-	{10500,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,10500},
-	{10500,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,10500},
-	{10500,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,10500},
-	{10500,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,10500},
-	{10500,23663,23663,23663,23663,23663,23663,30035,23663,23663,23663,30035,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,30035,23663,23663,30035,30035,23663,23663,23663,23663,23663,23663,23663,23663,23663,10500},
-	{10500,23663,23663,23663,23663,23663,23663,30035,30035,23663,23663,30035,30035,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,30035,30035,23663,23663,30035,30035,23663,23663,23663,23663,23663,23663,23663,23663,10500},
-	{10500,17292,17292,23663,23663,23663,23663,23663,30035,30035,23663,23663,30035,30035,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,30035,30035,23663,23663,30035,30035,23663,23663,23663,23663,23663,17292,17292,10500},
-	{10500,17292,17292,23663,23663,23663,23663,23663,23663,30035,23663,23663,23663,30035,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,30035,23663,23663,23663,30035,23663,23663,23663,23663,23663,17292,17292,10500},
-	{10500,17292,17292,17292,17292,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,17292,17292,17292,17292,10500},
-	{10500,17292,17292,17292,17292,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,17292,17292,17292,17292,10500},
-	{10500,17292,17292,17292,17292,17292,17292,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,17292,17292,17292,17292,17292,17292,10500},
-	{10500,17292,17292,17292,17292,17292,17292,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,17292,17292,17292,17292,17292,17292,10500},
-	{10500,17292,17292,17292,17292,17292,17292,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,17292,17292,17292,17292,17292,17292,10500},
-	{10500,17292,17292,17292,17292,17292,17292,17292,17292,17292,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,17292,17292,17292,17292,17292,17292,17292,17292,17292,10500},
-	{10500,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,10500},
-	{10500,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,10500},
-	{10500,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,10500},
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-};
-
-int g3 [48][42] = {
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,65535,65535,65535,65535,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,65535,65535,65535,65535,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,65535,8808,8808,8808,8808,65535,23663,23663,23663,23663,23663,23663,23663,23663,65535,8808,8808,8808,8808,65535,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,8808,8808,8808,8808,8808,8808,23663,23663,23663,23663,23663,23663,23663,23663,8808,8808,8808,8808,8808,8808,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,8808,65535,65535,65535,65535,8808,23663,23663,23663,23663,23663,23663,23663,23663,8808,65535,65535,65535,65535,8808,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,65535,65535,65535,65535,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,65535,65535,65535,65535,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,62999,62999,62999,62999,23663,23663,23663,23663,23663,23663,23663,23663,8808,8808,8808,8808,8808,8808,8808,8808,23663,23663,23663,23663,23663,23663,23663,23663,62999,62999,62999,62999,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,62999,62999,62999,62999,23663,23663,23663,23663,23663,23663,23663,23663,8808,8808,8808,8808,8808,8808,8808,8808,23663,23663,23663,23663,23663,23663,23663,23663,62999,62999,62999,62999,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,62999,62999,62999,62999,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,62999,62999,62999,62999,59227,59227,59227,59227,10500},
-	{10500,59227,59227,23663,23663,62999,62999,62999,62999,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,62999,62999,62999,62999,23663,23663,59227,59227,10500},
-	{10500,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,10500},
-	{10500,59227,59227,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,59227,59227,10500},
-	{10500,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,10500},
-	{10500,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,10500},
-	{10500,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,10500},
-	{10500,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,10500},
-	{10500,23663,23663,23663,23663,23663,23663,23663,23631,23631,23631,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,10500},
-	{10500,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,10500},
-	{10500,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,10500},
-	{10500,23663,23663,23663,23663,23663,23663,30035,23663,23663,23663,30035,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,30035,23663,23663,30035,30035,23663,23663,23663,23663,23663,23663,23663,23663,23663,10500},
-	{10500,23663,23663,23663,23663,23663,23663,30035,30035,23663,23663,30035,30035,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,30035,30035,23663,23663,30035,30035,23663,23663,23663,23663,23663,23663,23663,23663,10500},
-	{10500,17292,17292,23663,23663,23663,23663,23663,30035,30035,23663,23663,30035,30035,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,30035,30035,23663,23663,30035,30035,23663,23663,23663,23663,23663,17292,17292,10500},
-	{10500,17292,17292,23663,23663,23663,23663,23663,23663,30035,23663,23663,23663,30035,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,30035,23663,23663,23663,30035,23663,23663,23663,23663,23663,17292,17292,10500},
-	{10500,17292,17292,17292,17292,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,17292,17292,17292,17292,10500},
-	{10500,17292,17292,17292,17292,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,17292,17292,17292,17292,10500},
-	{10500,17292,17292,17292,17292,17292,17292,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,17292,17292,17292,17292,17292,17292,10500},
-	{10500,17292,17292,17292,17292,17292,17292,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,17292,17292,17292,17292,17292,17292,10500},
-	{10500,17292,17292,17292,17292,17292,17292,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,17292,17292,17292,17292,17292,17292,10500},
-	{10500,17292,17292,17292,17292,17292,17292,17292,17292,17292,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,23663,17292,17292,17292,17292,17292,17292,17292,17292,17292,10500},
-	{10500,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,10500},
-	{10500,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,10500},
-	{10500,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,17292,10500},
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-};
-
-int r1 [48][42] = {
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,65437,65437,65437,65437,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,65437,65437,65437,65437,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,65437,65437,65437,65437,65437,65437,64232,64232,64232,64232,64232,64232,64232,64232,65437,65437,65437,65437,65437,65437,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,39234,39234,39234,39234,39234,39234,64232,64232,64232,64232,64232,64232,64232,64232,39234,39234,39234,39234,39234,39234,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,39234,39234,39234,39234,39234,39234,64232,64232,64232,64232,64232,64232,64232,64232,39234,39234,39234,39234,39234,39234,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,65437,65437,65437,65437,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,65437,65437,65437,65437,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,64917,64917,64917,64917,64232,64232,64232,64232,64232,64232,64232,64232,39234,39234,39234,39234,39234,39234,39234,39234,64232,64232,64232,64232,64232,64232,64232,64232,64917,64917,64917,64917,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,64917,64917,64917,64917,64232,64232,64232,64232,64232,64232,64232,64232,39234,39234,39234,39234,39234,39234,39234,39234,64232,64232,64232,64232,64232,64232,64232,64232,64917,64917,64917,64917,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,64917,64917,64917,64917,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64917,64917,64917,64917,59227,59227,59227,59227,10500},
-	{10500,59227,59227,64232,64232,64917,64917,64917,64917,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64917,64917,64917,64917,64232,64232,59227,59227,10500},
-	{10500,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,10500},
-	{10500,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,10500},
-	{10500,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,10500},
-	{10500,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,10500},
-	{10500,64232,64232,64232,64232,64232,64232,64525,64232,64232,64232,64525,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64525,64232,64232,64525,64525,64232,64232,64232,64232,64232,64232,64232,64232,64232,10500},
-	{10500,64232,64232,64232,64232,64232,64232,64525,64525,64232,64232,64525,64525,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64525,64525,64232,64232,64525,64525,64232,64232,64232,64232,64232,64232,64232,64232,10500},
-	{10500,53830,53830,64232,64232,64232,64232,64232,64525,64525,64232,64232,64525,64525,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64525,64525,64232,64232,64525,64525,64232,64232,64232,64232,64232,53830,53830,10500},
-	{10500,53830,53830,64232,64232,64232,64232,64232,64232,64525,64232,64232,64232,64525,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64525,64232,64232,64232,64525,64232,64232,64232,64232,64232,53830,53830,10500},
-	{10500,53830,53830,53830,53830,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,53830,53830,53830,53830,10500},
-	{10500,53830,53830,53830,53830,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,53830,53830,53830,53830,10500},
-	{10500,53830,53830,53830,53830,53830,53830,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,53830,53830,53830,53830,53830,53830,10500},
-	{10500,53830,53830,53830,53830,53830,53830,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,53830,53830,53830,53830,53830,53830,10500},
-	{10500,53830,53830,53830,53830,53830,53830,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,53830,53830,53830,53830,53830,53830,10500},
-	{10500,53830,53830,53830,53830,53830,53830,53830,53830,53830,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,53830,53830,53830,53830,53830,53830,53830,53830,53830,10500},
-	{10500,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,10500},
-	{10500,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,10500},
-	{10500,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,10500},
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-};
-
-int r2 [48][42] = {
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,65437,65437,65437,65437,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,65437,65437,65437,65437,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,65437,65437,65437,65437,65437,65437,64232,64232,64232,64232,64232,64232,64232,64232,65437,65437,65437,65437,65437,65437,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,39234,39234,39234,39234,39234,39234,64232,64232,64232,64232,64232,64232,64232,64232,39234,39234,39234,39234,39234,39234,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,39234,39234,39234,39234,39234,39234,64232,64232,64232,64232,64232,64232,64232,64232,39234,39234,39234,39234,39234,39234,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,65437,65437,65437,65437,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,65437,65437,65437,65437,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,64917,64917,64917,64917,64232,64232,64232,64232,64232,64232,64232,64232,39234,39234,39234,39234,39234,39234,39234,39234,64232,64232,64232,64232,64232,64232,64232,64232,64917,64917,64917,64917,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,64917,64917,64917,64917,64232,64232,64232,64232,64232,64232,64232,64232,39234,39234,39234,39234,39234,39234,39234,39234,64232,64232,64232,64232,64232,64232,64232,64232,64917,64917,64917,64917,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,64917,64917,64917,64917,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64917,64917,64917,64917,59227,59227,59227,59227,10500},
-	{10500,59227,59227,64232,64232,64917,64917,64917,64917,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64917,64917,64917,64917,64232,64232,59227,59227,10500},
-	{10500,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,10500},
-	{10500,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,10500},
-	{10500,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,10500},
-	{10500,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,10500},
-	{10500,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,10500},
-	{10500,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,10500},
-	{10500,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,10500},
-	{10500,64232,64232,64232,64232,64232,64232,64525,64232,64232,64232,64525,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64525,64232,64232,64525,64525,64232,64232,64232,64232,64232,64232,64232,64232,64232,10500},
-	{10500,64232,64232,64232,64232,64232,64232,64525,64525,64232,64232,64525,64525,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64525,64525,64232,64232,64525,64525,64232,64232,64232,64232,64232,64232,64232,64232,10500},
-	{10500,53830,53830,64232,64232,64232,64232,64232,64525,64525,64232,64232,64525,64525,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64525,64525,64232,64232,64525,64525,64232,64232,64232,64232,64232,53830,53830,10500},
-	{10500,53830,53830,64232,64232,64232,64232,64232,64232,64525,64232,64232,64232,64525,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64525,64232,64232,64232,64525,64232,64232,64232,64232,64232,53830,53830,10500},
-	{10500,53830,53830,53830,53830,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,53830,53830,53830,53830,10500},
-	{10500,53830,53830,53830,53830,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,53830,53830,53830,53830,10500},
-	{10500,53830,53830,53830,53830,53830,53830,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,53830,53830,53830,53830,53830,53830,10500},
-	{10500,53830,53830,53830,53830,53830,53830,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,53830,53830,53830,53830,53830,53830,10500},
-	{10500,53830,53830,53830,53830,53830,53830,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,53830,53830,53830,53830,53830,53830,10500},
-	{10500,53830,53830,53830,53830,53830,53830,53830,53830,53830,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,53830,53830,53830,53830,53830,53830,53830,53830,53830,10500},
-	{10500,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,10500},
-	{10500,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,10500},
-	{10500,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,10500},
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-};
-
-int r3 [48][42] = {
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,65437,65437,65437,65437,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,65437,65437,65437,65437,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,65437,39234,39234,39234,39234,65437,64232,64232,64232,64232,64232,64232,64232,64232,65437,39234,39234,39234,39234,65437,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,39234,39234,39234,39234,39234,39234,64232,64232,64232,64232,64232,64232,64232,64232,39234,39234,39234,39234,39234,39234,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,39234,65437,65437,65437,65437,39234,64232,64232,64232,64232,64232,64232,64232,64232,39234,65437,65437,65437,65437,39234,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,65437,65437,65437,65437,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,65437,65437,65437,65437,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,64917,64917,64917,64917,64232,64232,64232,64232,64232,64232,64232,64232,39234,39234,39234,39234,39234,39234,39234,39234,64232,64232,64232,64232,64232,64232,64232,64232,64917,64917,64917,64917,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,64917,64917,64917,64917,64232,64232,64232,64232,64232,64232,64232,64232,39234,39234,39234,39234,39234,39234,39234,39234,64232,64232,64232,64232,64232,64232,64232,64232,64917,64917,64917,64917,59227,59227,59227,59227,10500},
-	{10500,59227,59227,59227,59227,64917,64917,64917,64917,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64917,64917,64917,64917,59227,59227,59227,59227,10500},
-	{10500,59227,59227,64232,64232,64917,64917,64917,64917,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64917,64917,64917,64917,64232,64232,59227,59227,10500},
-	{10500,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,10500},
-	{10500,59227,59227,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,59227,59227,10500},
-	{10500,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,10500},
-	{10500,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,10500},
-	{10500,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,10500},
-	{10500,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,10500},
-	{10500,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,10500},
-	{10500,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,10500},
-	{10500,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,10500},
-	{10500,64232,64232,64232,64232,64232,64232,64525,64232,64232,64232,64525,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64525,64232,64232,64525,64525,64232,64232,64232,64232,64232,64232,64232,64232,64232,10500},
-	{10500,64232,64232,64232,64232,64232,64232,64525,64525,64232,64232,64525,64525,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64525,64525,64232,64232,64525,64525,64232,64232,64232,64232,64232,64232,64232,64232,10500},
-	{10500,53830,53830,64232,64232,64232,64232,64232,64525,64525,64232,64232,64525,64525,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64525,64525,64232,64232,64525,64525,64232,64232,64232,64232,64232,53830,53830,10500},
-	{10500,53830,53830,64232,64232,64232,64232,64232,64232,64525,64232,64232,64232,64525,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64525,64232,64232,64232,64525,64232,64232,64232,64232,64232,53830,53830,10500},
-	{10500,53830,53830,53830,53830,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,53830,53830,53830,53830,10500},
-	{10500,53830,53830,53830,53830,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,53830,53830,53830,53830,10500},
-	{10500,53830,53830,53830,53830,53830,53830,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,53830,53830,53830,53830,53830,53830,10500},
-	{10500,53830,53830,53830,53830,53830,53830,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,53830,53830,53830,53830,53830,53830,10500},
-	{10500,53830,53830,53830,53830,53830,53830,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,53830,53830,53830,53830,53830,53830,10500},
-	{10500,53830,53830,53830,53830,53830,53830,53830,53830,53830,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,64232,53830,53830,53830,53830,53830,53830,53830,53830,53830,10500},
-	{10500,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,10500},
-	{10500,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,10500},
-	{10500,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,53830,10500},
-	{10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500,10500},
-};
@@ -0,0 +1,135 @@
+/* PACKED IMAGES */
+// Full-screen pictures are stored run-length encoded instead of as one int per pixel. A
+// packed image is a byte array:
+//   width, height   2 bytes each, little-endian
+//   row offsets     4 bytes per row, little-endian, from the start of the image
+//   rows            runs, each row on its own; a run starts with a count byte n:
+//                     n < 128    n + 1 copies of the next pixel
+//                     n >= 128   n - 127 pixels, one after the other
+//                   a pixel is RGB565 in 2 bytes, little-endian
+// The pictures have thousands of colors each, so there is no palette. A row decodes
+// straight into a pixel buffer row: a repeat is one vgaFillSpan() and a stretch of
+// pixels is one copy. imagePack() only writes repeats of IMAGE_MIN_REPEAT pixels or
+// more, since a run costs a branch and the pictures are mostly short repeats: the packed
+// images come out a quarter bigger than with every repeat of two, but decode several
+// times faster. The row offsets let imageDrawArea() redraw any part of an image, such as
+// the background behind an icon. imagePack() is the encoder tools/mkimages.c uses.
+
+#ifndef IMAGE_H
+#define IMAGE_H
+
+/* LIBRARIES */
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "vga.h"
+
+
+/* IMAGE INITIALIZATIONS */
+#define IMAGE_HEADER_BYTES 4
+#define IMAGE_MAX_RUN 128
+#define IMAGE_MIN_REPEAT 8 // shorter repeats go in with the pixels around them
+// most bytes imagePack() can write for a width x height image
+#define IMAGE_MAX_BYTES(width, height) \
+    (IMAGE_HEADER_BYTES + 4 * (size_t)(height) + (size_t)(height) * (2 * (size_t)(width) + ((width) + IMAGE_MAX_RUN - 1) / IMAGE_MAX_RUN))
+
+
+/* FORMAT */
+static inline int imageWidth(const uint8_t *image) {
+    return image[0] | (image[1] << 8);
+}
+
+static inline int imageHeight(const uint8_t *image) {
+    return image[2] | (image[3] << 8);
+}
+
+// the first run of a row
+static inline const uint8_t *imageRow(const uint8_t *image, int row) {
+    const uint8_t *offset = image + IMAGE_HEADER_BYTES + 4 * row;
+    return image + (offset[0] | (offset[1] << 8) | ((uint32_t)offset[2] << 16) | ((uint32_t)offset[3] << 24));
+}
+
+
+/* ENCODER */
+static inline uint8_t *imagePutPixel(uint8_t *out, uint16_t pixel) {
+    out[0] = (uint8_t)pixel;
+    out[1] = (uint8_t)(pixel >> 8);
+    return out + 2;
+}
+
+// pack width x height RGB565 pixels, row by row, into out (room for IMAGE_MAX_BYTES());
+// returns the size of the packed image
+static inline size_t imagePack(uint8_t *out, const uint16_t *pixels, int width, int height) {
+    uint8_t *at = out + IMAGE_HEADER_BYTES + 4 * (size_t)height;
+    out[0] = (uint8_t)width;
+    out[1] = (uint8_t)(width >> 8);
+    out[2] = (uint8_t)height;
+    out[3] = (uint8_t)(height >> 8);
+    for (int row = 0; row < height; row++) {
+        uint32_t offset = (uint32_t)(at - out);
+        for (int i = 0; i < 4; i++) out[IMAGE_HEADER_BYTES + 4 * row + i] = (uint8_t)(offset >> (8 * i));
+
+        const uint16_t *line = pixels + (size_t)row * width;
+        int col = 0;
+        while (col < width) {
+            int same = 1;
+            while (col + same < width && same < IMAGE_MAX_RUN && line[col + same] == line[col]) same++;
+            if (same >= IMAGE_MIN_REPEAT) {
+                *at++ = (uint8_t)(same - 1);
+                at = imagePutPixel(at, line[col]);
+                col += same;
+                continue;
+            }
+            // pixels up to the next repeat long enough to write as one
+            int count = 1;
+            while (col + count < width && count < IMAGE_MAX_RUN) {
+                int next = 1;
+                while (col + count + next < width && next < IMAGE_MIN_REPEAT && line[col + count + next] == line[col + count]) next++;
+                if (next >= IMAGE_MIN_REPEAT) break;
+                count++;
+            }
+            *at++ = (uint8_t)(127 + count);
+            for (int k = 0; k < count; k++) at = imagePutPixel(at, line[col + k]);
+            col += count;
+        }
+    }
+    return (size_t)(at - out);
+}
+
+
+/* DECODER */
+// draw the part of an image from (x, y), width x height of it, with the image's top left
+// corner at (left, top) on the screen
+static inline void imageDrawArea(uintptr_t buffer, const uint8_t *image, int left, int top, int x, int y, int width, int height) {
+    int end = x + width;
+    for (int row = y; row < y + height; row++) {
+        const uint8_t *run = imageRow(image, row);
+        volatile uint16_t *line = (volatile uint16_t *)(buffer + ((uintptr_t)(top + row) << 10) + ((uintptr_t)left << 1)); // column 0 of the image
+        for (int col = 0; col < end;) {
+            int n = *run++;
+            int count = (n < 128) ? n + 1 : n - 127;
+            int from = (col > x) ? col : x, to = (col + count < end) ? col + count : end;
+            if (n < 128) {
+                if (from < to) vgaFillSpan((uintptr_t)(line + from), (uintptr_t)(line + to), (uint16_t)(run[0] | (run[1] << 8)));
+                run += 2;
+            } else {
+                const uint8_t *pixel = run + 2 * (from - col);
+#ifdef HOST_BUILD
+                if (from < to) memcpy((void*)(line + from), pixel, 2 * (size_t)(to - from)); // both little-endian
+#else
+                for (int k = from; k < to; k++, pixel += 2) line[k] = (uint16_t)(pixel[0] | (pixel[1] << 8));
+#endif
+                run += 2 * count;
+            }
+            col += count;
+        }
+    }
+    vgaCountPixels((uint64_t)width * height);
+}
+
+// draw a whole image with its top left corner at (left, top)
+static inline void imageDraw(uintptr_t buffer, const uint8_t *image, int left, int top) {
+    imageDrawArea(buffer, image, left, top, 0, 0, imageWidth(image), imageHeight(image));
+}
+
+#endif
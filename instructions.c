@@ -1,243 +0,0 @@
-[240][320] = {
-	{35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35730,35503,37486,37486,37486,37486,37486,37486,37486,37486,37486,37486,37486,37486,37486,35438,35438,35438,37486,37486,37486,37486,35438,35438,37486,35438,35438,35438,37486,35438,37486,37486,37486,37486,37486,37486,37486,37486,37486,37486,37486,37486,37487,37487,37487,37487,35439,35439,35439,35439,37487,37487,37487,35471,35471,37519,37519,35471,35471,37519,37519,37519,37519,35471,37519,37519,37519,37519,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37583,37583,37583,37583,37583,37583,37584,37584,37584,37584,37584,37584,37584,37584,37584,37584,37584,37648,37648,37648,37616,37584,37584,37584,37584,37584,37584,37616,37648,37648,37648,37648,37648,37648,37648,37648,37616,37584,37616,37648,37584,37584,37616,37648,37648,37648,37648,37648,37648,37648,37648,37648,37648,37648,37616,37583,37584,37583,37583,37583,37583,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37551,37519,37519,37519,37519,35471,35471,37519,37519,37519,37519,37519,37519,37519,35471,35471,37519,37519,37519,37519,37519,35471,35471,35439,35439,35439,37487,35439,37487,37487,35439,35439,35439,35439,37487,37487,37486,37486,37486,37486,37486,37486,37486,37486,37486,37486,37486,37486,37486,37486,37486,37486,35438,35438,35438,35438,35439,37486,37487,35439,35439,35601,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796},
-	{33682,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,33682,33682,33682,33682,35633,35503,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35406,35406,35406,35406,35406,35405,35438,35438,35438,35438,35438,35438,35438,35438,37486,37486,35438,35438,35438,35438,37518,35470,37518,37518,37518,37518,35470,35470,35470,35470,35470,35470,37518,37518,35470,37518,37518,37550,35502,35502,35502,37551,37551,37551,35503,35503,35503,35503,35503,35503,35503,35503,37551,37615,37615,37615,37583,37551,37551,37551,37551,35503,37551,37583,37615,37615,37615,37615,37615,37615,37615,37615,37583,37551,37583,37583,37551,37551,37583,37615,37615,37615,37615,37615,37615,37615,37615,37615,37615,37615,37583,35502,35502,37550,35502,35502,35502,35470,35470,35470,35470,35470,35470,37518,35470,35470,35470,35470,35470,37518,37518,37518,37518,35470,35438,35438,35438,35438,37486,35438,35438,35438,35438,37486,35438,35438,35438,35438,35438,35438,35438,35438,35438,35405,35405,35405,35406,35406,35406,35406,35406,35406,35406,35406,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35503,35730,35762,35762,33714,33714,33714,33714,35762,35762,35762,35763,35763,35730,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764},
-	{33714,35762,35730,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35762,35568,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35405,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35405,35405,35373,35373,35373,35405,35373,35405,35405,35405,37454,35406,35406,35406,35406,35406,35406,35405,35406,35406,35406,35406,35406,35406,35438,35438,35438,35438,35438,35438,35438,35438,35438,37486,35438,35438,35438,37486,37486,35470,37518,37518,35470,37518,35470,37518,37518,37518,35470,35470,37518,35470,35470,37550,37518,37550,35502,35503,35502,37551,37551,37551,35503,37551,37551,37551,37551,37551,37551,35503,35503,37615,37615,37615,37583,37551,37551,37551,37551,35503,37551,37583,37615,37615,37615,37615,37615,37615,37615,37615,37583,37551,37583,37583,37551,37551,37583,37615,37615,37615,37615,37615,37615,37615,37615,37615,37615,37615,37583,37551,37550,37550,35502,35502,35502,35502,37518,37550,37518,37518,35470,37518,37518,35470,35470,37518,37518,37518,37518,37518,37518,37486,37486,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35437,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35405,35405,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35405,35405,35405,35405,35405,35405,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35438,35698,35762,35762,33714,33714,33714,33714,35762,35762,35763,35762,35763,35763,35730,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{33682,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35762,35568,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35405,35405,35405,35373,35405,35405,35405,37454,35406,35406,35406,35406,35406,35405,35405,35406,35406,35406,35406,35437,35437,35405,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,37486,35438,35438,37486,37518,37518,35470,35470,37518,37518,37518,35470,37518,35470,35470,35470,37518,35502,35502,35502,35502,35503,35502,35502,35503,35503,37551,37551,37551,37551,37551,35503,37551,37551,37615,37615,37615,37583,37551,35503,35503,35503,35503,37551,37583,37615,37615,37615,37615,37615,37615,37615,37615,37583,37551,37583,37583,37551,35503,37583,37615,37615,37615,37615,37615,37615,37615,37615,37615,37615,37615,37551,37551,37551,35503,37550,35502,35470,35502,35470,37518,37518,37518,37518,35470,35470,37518,37518,37518,35470,35470,35470,37518,37518,37486,35438,37486,37486,35438,35438,35438,37486,35438,35438,35438,35438,35438,35438,35438,37486,37486,35438,35438,35405,35438,35406,35406,35406,35406,35406,35406,35406,35406,35405,35405,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35405,35405,35405,35373,35405,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,37421,37421,35373,35373,35503,33682,33714,33714,33714,33714,33714,33714,35762,35763,35763,35763,35762,35762,35731,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{33682,33682,33682,33682,33714,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35762,35698,35471,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35405,35373,35405,35405,35405,35406,35406,35406,35406,35406,35405,35406,35406,35406,35406,35406,35406,35405,35438,37486,35438,35438,35438,35438,35438,35438,35438,35438,37486,37486,37486,37486,35470,37518,37518,37518,37518,37518,37518,37518,37518,37518,37518,37518,37518,37518,35470,35502,35502,37550,37551,35503,35502,35503,37551,37551,37551,37551,37551,35503,37551,37551,37615,37615,37615,37583,35503,37551,37551,37551,35503,37551,37583,37615,37615,37615,37615,37615,37615,37615,37615,37583,37551,37583,37583,35503,35503,37583,37615,37615,37615,37615,37615,37615,37615,37615,37615,37615,37615,37551,37550,35502,35502,37550,37518,35470,35470,37518,37518,37518,37518,37518,35470,37518,37518,37518,37518,35470,35470,37518,37518,37486,37486,37486,37486,35438,37486,35438,35438,35438,35438,35438,35438,35438,35438,35438,37486,35438,35438,35438,35438,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35405,35406,35406,35406,35406,35406,35406,35406,35406,35405,35405,35405,35405,35405,35405,35373,35405,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35406,35438,35438,35438,35438,35665,33714,35762,33714,33714,35762,35762,35762,35762,35763,35763,35762,35762,35763,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{33682,33682,33682,33682,33714,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35762,35762,35633,35405,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35405,35405,35405,35405,35405,35405,35405,35406,35406,35406,35406,35405,35406,35406,35406,35406,35406,35437,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,37486,35438,35438,35438,37486,37486,35438,37518,37518,37518,37518,37518,37518,35470,37518,37518,37518,37518,35470,35470,35502,37550,37551,35503,35502,35503,37551,37551,37551,37551,37551,35503,37551,37551,37615,37615,37615,37583,35503,37551,37551,37551,35503,37551,37583,37615,37615,37615,37615,37615,37615,37615,37615,37583,37551,37583,37583,35503,35503,37583,37615,37615,37615,37615,37615,37615,37615,37615,37615,37615,37615,37551,35502,35502,35502,37550,37550,35470,35470,37518,37518,37518,37518,37518,37518,37518,37518,37518,37518,35470,35438,37486,35438,37486,37486,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35405,35405,35405,35405,35405,35405,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,37421,35406,35600,35698,35698,35698,35698,35730,33714,33714,33714,35762,35762,35762,35762,35762,35763,35762,35763,35763,35763,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{35730,35730,33682,35730,33714,33714,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35665,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35405,35405,35405,35405,35406,35406,35406,35405,35406,35406,35406,35406,35406,35406,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,37486,37486,35438,35470,37518,37518,37518,37518,37518,37518,37518,37518,37518,37518,37518,37518,35470,37518,37550,35503,35502,37551,37551,35503,35503,37551,37551,35503,37551,37551,37615,37615,37615,37583,37551,35503,37551,37551,35503,37551,37583,37615,37615,37615,37615,37615,37615,37615,37615,37583,37550,37583,37583,35502,35503,37583,37615,37615,37615,37615,37615,37615,37615,37615,37615,37615,37615,37551,35502,35470,37518,35470,37518,37518,37518,37518,37518,37518,35470,35470,37518,37518,35470,35470,35470,37486,37486,35438,37486,35438,37486,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35405,35406,35406,35406,35406,35406,35406,35406,35406,35405,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35405,35405,35405,35373,35405,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,37421,35373,35535,35730,33714,33714,33714,33714,33714,33714,35730,35730,35762,35762,35762,35762,35762,35763,35762,35763,35763,35763,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{35730,35730,33682,35730,33682,33682,33714,33714,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35665,35373,37421,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35405,35405,35405,35405,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35437,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,37486,37486,35438,35438,37486,37518,37518,37518,37518,37518,35470,37518,37518,37518,37518,37518,35470,37518,37550,37551,35503,37551,37551,35503,35503,37551,37551,35503,37551,35503,37615,37615,37615,37551,37551,35503,37551,37551,35503,37551,37583,37615,37615,37615,37615,37615,37615,37615,37615,37583,37551,37583,37583,35503,37551,37583,37615,37615,37615,37615,37615,37615,37615,37615,37615,37615,37615,37551,35470,37518,37518,35470,37518,37518,37518,37518,37518,35470,37518,37518,37518,37518,35470,35470,37486,37486,37486,35438,37486,37486,37486,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35405,35437,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35405,35405,35405,35373,35405,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35471,35698,35762,33714,35762,35762,35762,35762,35762,35730,35730,35762,35762,35730,35762,35762,35763,35762,35762,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{35730,35730,35730,35730,33682,33682,33682,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35665,35373,35373,35373,35373,35373,35373,37421,37421,37421,37421,37421,37421,37421,37421,37421,37421,37421,37421,37421,37421,37421,37421,37421,37421,37421,37421,37421,37421,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35405,35373,35405,37454,35406,35406,35406,35406,35405,35406,35406,35406,35406,35406,35437,35437,35405,35438,35438,37486,35438,35438,35438,35438,35438,35438,37486,35438,35438,35438,37486,35438,37486,35470,37518,37518,37518,35470,35470,37518,37518,37518,37518,37518,35470,37550,35502,35502,37551,37550,35502,35503,37551,37551,35503,37551,37551,37615,37615,37615,37551,35503,35503,37551,37551,35503,37551,37583,37615,37615,37615,37615,37615,37615,37615,37615,37583,37550,37583,37583,35503,37551,37583,37615,37615,37615,37615,37615,37615,37615,37615,37615,37615,37615,37551,37518,35502,35470,37518,37518,37518,37518,35470,35470,37518,37518,37518,37518,37518,37518,37486,37486,35438,35438,35438,35438,37486,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35405,35405,35405,35438,35438,35406,35406,35406,35406,35406,35406,35406,35406,35405,35406,35406,35406,35406,35406,35406,35406,35406,35406,37454,35405,35405,35405,35373,35405,35405,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,37421,37421,37421,35373,35373,35373,35373,35373,35373,35406,35665,35762,33714,35730,35730,35762,35762,35730,35762,35762,35762,35762,35762,35730,35762,35762,35763,35762,35762,35731,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{35730,35730,35730,35730,35730,35730,35730,35730,33682,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35698,35600,35438,35373,35373,35373,35373,37421,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,37421,37421,37421,37421,37421,37421,37421,37421,37421,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35405,35405,35405,35406,35406,35406,35406,35405,35405,35406,35406,35406,35406,35406,35406,35406,35438,37486,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,37486,37486,37486,35438,37486,37518,37518,37518,37518,35470,37518,37518,37518,37518,37518,35502,35470,35502,37550,37550,35503,35503,35503,37551,35503,37551,37551,37615,37615,37615,37551,37551,35503,37551,37551,35503,37551,37551,37615,37615,37615,37615,37615,37615,37615,37615,37551,37550,37583,37583,35502,37551,37583,37615,37615,37615,37615,37615,37583,37615,37615,37583,37583,37583,37551,37518,35470,37518,37518,37518,37518,35470,37518,37518,37518,37518,37518,37518,37486,35438,37486,37486,37486,37486,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35405,35437,35438,35406,35406,35406,35406,35406,35406,35406,35406,35405,35405,35406,35406,35406,35406,35406,35406,35406,35406,35406,35405,35405,35405,35373,35373,35405,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35600,35730,33714,35762,35730,35730,35762,35762,35762,35762,35762,35762,35762,35730,35762,35762,35763,35762,35762,35762,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{35730,35730,35730,35730,35730,35730,35730,33682,33682,35730,33682,33714,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35762,35762,35600,35405,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,37421,37421,37421,37421,37421,37421,37421,37421,37421,37421,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35405,35373,35405,37454,35406,35406,35406,35406,35406,35405,35405,35406,35406,35406,35406,35406,35438,35438,35438,37486,37486,35438,35438,35438,35438,35438,35438,35438,37486,37486,37486,35438,37486,37518,37518,37518,37518,35470,35470,37518,37518,37518,37518,37550,37550,37518,37550,37550,37551,37550,37550,37550,35503,37551,35503,37615,37615,37615,37551,37551,35503,37551,37551,37551,35503,37551,37615,37615,37615,37615,37615,37615,37615,37615,37551,37550,37583,37583,35502,37550,37583,37615,37615,37583,37583,37615,37583,37583,37583,37583,37583,37583,37551,37518,35470,37518,37518,35470,35470,37518,37518,37518,37518,35470,35438,35438,35438,37486,37486,35438,37486,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35437,35438,35406,35406,35406,35406,35406,35406,35406,35406,35405,35405,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35405,35405,35373,35405,35405,35373,35373,35373,35373,35373,35373,35373,35373,35373,37421,37421,35373,35373,35373,35373,35373,35373,35373,35373,37421,37421,35373,35406,35698,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35762,35762,35763,35762,35730,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{35730,35730,35730,35730,35730,35730,33682,35730,35730,35730,35730,33682,33682,33714,33714,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35665,35536,35633,35665,35665,35535,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,37421,37421,37421,37421,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35405,35405,35405,35406,35406,35406,35406,35406,35405,35406,35406,35406,35406,35406,35406,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,37486,37486,37486,37486,37518,37518,37518,37518,37518,35470,35470,37518,37518,37518,37518,37518,37550,37550,37550,37550,37551,37550,35503,37551,37551,37615,37615,37615,37551,35503,37551,37551,37551,37551,37551,37551,37615,37615,37615,37615,37615,37615,37615,37615,37551,37550,37583,37583,35502,37550,37583,37615,37615,37615,37615,37615,37583,37583,37583,37583,37583,37583,37551,35470,37518,37518,35470,37518,37518,37518,37518,37518,37518,35438,37486,35438,35438,37486,37486,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35405,35406,35406,35406,35406,35406,35406,35406,35406,35406,35405,35405,35405,35405,35405,35373,35405,35373,35373,35373,35373,35373,35373,35373,35373,35373,37421,37421,35373,35373,35373,35405,35405,35405,35405,35405,35405,35406,35373,35373,35536,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35762,35762,35763,35763,35730,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,33682,33682,33682,33714,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35730,35762,33714,33714,35698,35471,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,37421,37421,37421,37421,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35405,35405,35405,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,37486,35438,35438,37486,35438,35470,37518,37518,37518,35470,35470,37518,37518,37518,37518,37518,37550,37550,35502,35502,35502,37551,35503,37550,37551,37583,37615,37615,37551,35502,37551,37551,37551,35503,37551,37551,37615,37615,37615,37615,37615,37615,37615,37615,37551,35502,37583,37583,35502,37550,37583,37615,37615,37615,37583,37583,37583,37583,37583,37583,37583,37583,37551,35470,37518,37518,37518,37518,37518,37518,37518,37518,37486,35438,37486,35438,35438,37486,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35405,35405,35405,35405,35405,35405,35405,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35438,35633,35697,35665,35665,35665,35665,35697,35503,35470,35698,35762,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35762,35762,35763,35763,35762,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{35730,35730,35730,35730,35730,35730,35730,35730,33682,35730,35730,35730,35730,33682,35762,33714,33714,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35762,35762,35762,35762,35730,35762,35633,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,37421,37421,37421,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35405,35405,35406,35406,35406,35406,35406,35406,35405,35406,35406,35406,35406,35406,35406,35406,35405,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35470,37518,37518,37518,37518,37518,37518,37518,37518,37518,37518,37550,37518,35502,35502,35502,35502,35502,37550,37551,37583,37615,37615,37551,35502,37551,37551,37551,35503,37551,37551,37615,37615,37615,37615,37615,37615,37615,37615,37551,35502,37583,37583,37550,37550,37583,37615,37583,37583,37583,37583,37583,37583,37583,37583,37583,37583,37551,35470,37518,35470,37518,37518,37518,37518,35470,37518,37486,35438,37486,37486,35438,35438,35438,35438,35438,35438,35438,35438,35438,37486,37486,37486,35438,35405,35406,35406,35438,35406,35406,35406,35406,35406,35406,35406,35406,35406,35405,35405,35405,35406,35406,35406,35406,35406,35406,35406,35406,35405,35405,35405,35373,35373,35405,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35503,35698,35730,35762,35730,33714,33714,33714,35762,35697,35568,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35762,35763,35763,35762,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,33682,33682,33682,33682,33714,33714,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35762,35762,35762,35762,35762,35762,35697,35438,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,37421,37421,37421,37421,35373,35373,35373,35373,35373,35373,35373,35373,35373,35405,35405,35405,35405,35405,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,37486,35438,35438,37486,37518,37518,37518,37518,37518,37518,37518,37518,37518,37518,37518,35502,35470,35502,35502,35502,37550,37551,37583,37615,37615,35503,35502,37551,37551,37551,37551,37550,37551,37615,37615,37615,37615,37583,37615,37615,37583,37551,37550,37583,37583,35502,37550,37551,37583,37583,37583,37583,37583,37583,37583,37583,37583,37583,37583,37550,35470,37518,37518,37518,37518,37518,35470,35438,37486,37486,35438,35438,37486,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35405,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35405,35405,35405,35373,35405,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35406,35665,35762,35762,35730,35730,35762,35762,35730,35730,35730,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35730,35762,35762,35763,35763,35762,35763,35763,35731,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,33682,33682,33682,33682,33682,33682,33682,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35730,35730,35730,35762,35762,35762,35568,35373,35373,37421,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,37421,37421,37421,37421,35373,35373,35373,35373,35373,35373,35405,35405,35405,35373,35405,35405,35406,35406,35406,35406,35406,35406,35405,35406,35406,35406,35406,35406,35406,35406,35437,35405,35438,35438,37486,37486,35438,35438,35438,35438,35438,35438,35438,35438,37486,37486,37486,35470,37518,37518,37518,37518,35470,37518,37518,37518,37518,37550,37550,37518,35470,35502,37550,37550,37583,37615,37583,37551,35502,37550,37550,37550,37551,35502,37551,37583,37583,37583,37615,37615,37615,37583,37583,37551,37550,37583,37583,35470,37518,37551,37583,37583,37583,37583,37583,37583,37583,37583,37583,37583,37583,37550,37518,37518,37518,37518,37518,35470,37486,37486,35438,35438,37486,35438,35438,35438,35438,35438,35438,35438,35438,37486,35438,35438,35438,35405,35438,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35405,35405,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,37454,35405,35405,35405,35373,35405,35405,35373,35373,35373,35373,35373,35373,35373,35373,35373,37421,35373,35373,35373,35373,35373,35373,35471,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,33714,35762,35762,35763,35763,35763,35763,35763,35763,35763,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,33682,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35568,35373,37421,37421,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,37421,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35405,35405,35405,35405,35406,35406,35406,35406,35406,35405,35406,35406,35406,35406,35406,35406,35406,35406,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,37486,35470,37518,37518,37518,37518,37518,37518,37518,37518,37518,37518,37518,37550,35470,35502,37550,37550,37583,37583,37583,37551,37550,37551,37551,37551,37551,37550,37551,37583,37583,37583,37583,37583,37583,37583,37583,37551,37518,37583,37583,37518,37518,37551,37583,37583,37583,37583,37583,37583,37583,37583,37583,37583,37583,37550,37518,37518,37518,35470,35438,37486,37486,37486,37486,37486,37486,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35406,35438,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35405,35405,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35405,35405,35405,35373,35373,35405,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35406,35665,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,33714,35762,35762,35762,35762,35762,35762,35763,35763,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,33682,33682,33682,33682,33682,35730,35762,35762,35762,33714,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35665,35406,37421,37421,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,37421,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35405,35405,35405,35405,35405,35405,35406,35406,35406,35406,35405,35406,35405,35406,35406,35406,35406,35406,35406,35438,35405,35405,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35470,37518,37518,37518,35470,35470,35470,35470,35470,35470,35502,35502,35502,37518,37550,37583,37583,37583,37551,37550,35503,35503,35503,35503,37550,37551,37583,37583,37583,37583,37583,37583,37583,37583,37550,37518,37551,37583,35470,35470,37551,37583,37583,37583,37583,37583,37583,37583,37583,37583,37583,37583,37550,37518,37518,37518,35438,35438,35438,35438,35438,35438,37486,35438,35438,35438,35438,35438,35438,35438,35438,35438,35437,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35406,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35503,35730,33714,35730,35762,35762,35762,35762,35762,35762,35762,35730,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,33714,33714,33714,33714,35730,35730,35730,35762,35762,35762,35763,35763,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35471,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35341,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35405,35405,35405,35405,35405,35405,35405,35406,35406,35405,35406,35406,35406,35406,35406,35406,35405,35405,35405,35406,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35470,35470,35470,35470,35470,35470,35470,35470,35470,35470,35470,35470,35502,37583,37583,37583,35503,35470,35502,35502,35502,35502,37550,37551,37583,37583,37583,37583,37583,37583,37583,37583,35503,37518,37551,37551,35502,35470,37551,37583,37583,37583,37583,37583,37551,37551,37551,37551,37551,37583,37550,35470,35470,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35405,35405,35405,35405,35405,35406,35406,35406,35406,35406,35406,35406,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35341,35503,35730,35730,35730,35762,35730,35730,35730,35730,35730,33682,33682,33682,33682,33682,33682,35730,35730,35762,35762,35730,35730,35730,35762,35762,35730,35730,35730,35730,35762,35762,35762,35763,35762,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35665,35633,35633,35633,35438,35341,35341,35341,35341,35341,35341,35341,35341,35341,35341,35341,35341,35341,35341,35341,35341,35373,35373,35341,35341,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35405,35405,35405,35405,35405,35405,35406,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35470,35470,35470,35470,35470,35470,35470,35470,35470,35502,35535,35535,35535,35502,35470,35470,35470,35470,35502,35470,37551,37583,37583,37583,37583,37583,37583,37583,37583,35503,35470,37551,37551,35470,35470,37551,35535,35503,35503,35503,35503,35503,35503,37551,37551,37551,37551,37518,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35405,35406,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35341,35341,35341,35470,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,35730,35762,35730,35730,35730,35762,35762,35730,35730,35730,35730,35762,35762,35762,35763,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{35730,35730,35730,35730,35730,35730,35730,33682,33682,35730,33682,33682,33682,35730,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,33714,33682,35633,35406,35373,35341,35341,35341,35341,35341,35341,35341,35341,35341,35341,35341,35341,35341,35341,35341,35341,35341,35341,35341,35341,35341,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35437,35438,35438,35438,35438,35438,35438,35438,35437,35437,35437,35438,35438,35438,35470,35470,35470,35470,35470,35470,35502,35535,35535,35535,35470,35470,35470,35470,35470,35470,35470,37551,37583,37583,35535,35535,35503,35503,35503,35503,35502,35470,37551,37551,35470,35470,35502,35503,35502,35502,35502,35502,35502,35502,35502,35502,37550,37551,35470,35438,35438,35438,35438,35437,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35405,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35405,35405,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35341,35341,35341,35470,33682,33682,33682,33682,33682,33682,33682,33682,33682,33649,33649,33649,33649,33682,33682,33682,33682,33682,35730,35730,33682,35730,35730,35730,35762,35762,35762,35762,35762,35763,35763,35763,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35730,35762,33682,33682,33650,33617,33422,33293,33260,33260,33260,33260,33260,33260,33260,33260,33260,35340,35341,35341,35341,35341,35340,35340,33292,35341,35341,35341,35341,35341,35373,35341,35341,35341,35341,35341,35341,35341,35341,35341,35373,35373,35341,35341,33293,33293,33293,33292,33292,33293,33293,35373,35373,35373,35373,35405,35405,35405,35373,35373,35373,33325,33325,33325,33325,33325,33325,33325,33325,33325,33325,33325,35405,35405,35405,35405,35405,35405,35405,33357,33357,33357,33357,33357,33357,33357,33357,33389,33389,35437,35438,35470,35470,35470,35503,35502,35502,35470,35437,35438,35470,35470,35470,35470,35502,35535,35503,35502,35502,35502,35502,35502,35502,35470,35470,35503,37551,35470,35438,35470,35502,35470,35470,35470,35470,35470,35470,35470,35502,35502,35502,35470,35437,35405,35405,35405,33357,33325,33325,33325,33325,33325,33325,33325,33325,33325,33325,35373,35405,35373,35373,35373,33325,33325,33325,33293,33293,33292,33292,33293,33293,33293,33293,35373,35373,35373,35373,35373,35373,35373,35373,35341,33293,33293,33292,33292,33292,33292,33292,33292,35341,35373,35373,35373,35373,35341,35341,35341,33292,33292,35341,35341,35341,35341,35341,35373,35341,35341,35341,35340,33260,33390,33649,33649,33682,33682,33681,33649,33649,31601,31569,31569,31569,31569,31569,31601,33649,33649,33682,33682,33682,33682,33682,35730,35730,35730,35762,35762,35762,35762,35762,35762,35763,35762,35731,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{33682,33682,33682,35730,35730,33682,35730,35730,35730,35730,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,33682,33682,35794,37875,35827,35794,35664,35502,35470,35470,35470,35470,35470,35470,35470,35470,35437,33260,33292,35470,37550,37550,37550,35470,33292,33260,33292,35341,35341,35341,35373,37518,37551,37550,37550,35470,33292,33292,33293,35341,35438,37551,37551,37550,35502,35502,35502,35502,35502,35502,33325,33293,35373,35373,35373,35405,35405,37551,37583,37583,37583,35502,35502,35502,35502,35502,35502,35502,35502,35502,35534,35469,33325,33389,37583,37615,37583,37583,35535,35535,35535,35534,35534,35567,35567,35567,35567,35567,33421,33389,33389,35437,35470,37680,37680,37680,37647,35535,33389,33389,35438,35470,35470,35502,37583,39728,37680,37680,37680,35567,33422,35502,35470,35470,35502,35502,35502,37648,37680,37680,37648,37647,37647,37647,35599,37647,35502,33422,35470,35470,35470,37583,37615,37615,37615,37583,35535,35534,35534,35534,35534,35534,35502,35534,35534,35437,33325,35405,37583,37583,37583,35502,35502,35502,35502,35502,35502,35502,35502,35502,35502,35502,35405,33293,33325,35373,35405,37551,37583,37551,37550,35502,35502,35502,35502,35502,35502,35502,35470,33292,33292,33293,35341,35405,37551,37550,37550,37550,35405,33260,33292,35341,35341,35341,35341,37453,37551,37550,37550,37518,33454,31569,33649,33649,33649,35794,35827,35826,35794,35794,35794,35794,35794,35794,33713,31569,31569,33649,33682,33682,33682,33682,35762,35762,35762,35762,35762,35762,35762,35762,35763,35730,35730,35731,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{35730,35730,35730,35730,35730,33682,35730,35730,35730,35730,35730,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,33682,33682,46423,59197,59197,59197,59164,59132,59132,59132,59132,59132,59132,59132,59132,59132,52664,33292,33292,52631,61180,59132,59132,54809,35469,31180,33260,33292,35341,35341,37518,54777,61180,59132,61180,54776,33357,31212,33260,33292,48276,61180,59132,59132,59132,59132,59132,59132,59132,56922,35502,31212,33292,33325,35373,35373,35438,54712,61212,59132,59132,59132,59132,59132,59132,59132,59132,59132,59132,59132,59132,46196,31244,37647,56987,59132,59132,59132,59132,59132,59132,59132,59132,59132,59132,59132,59132,59067,39792,31276,33357,33357,37647,56954,61212,59164,61212,52631,33389,33357,33389,35438,35470,35470,39825,56987,61212,59164,61212,50551,33421,33421,33389,35437,35502,35470,39761,56987,61212,59164,59164,59132,59132,59132,59132,59132,44115,31309,33389,33421,35470,52664,61212,59132,59132,59132,59132,59132,59132,59132,59132,59132,59132,59132,59132,46260,31212,37615,56954,59132,59132,59132,59132,59132,59132,59132,59132,59132,59132,59132,59132,59067,39760,31212,33292,33293,37583,56922,61180,59132,59132,59132,59132,59132,59132,59132,59132,59132,54777,33389,31212,33292,33260,41873,59099,59132,59132,59132,44115,31179,33260,33260,35340,35341,35340,44018,59100,59132,59132,59132,44148,29456,31568,31569,33681,52761,59197,59197,59196,59164,59164,59164,59164,59197,50680,31568,31536,31569,33649,33650,33682,33682,35730,35762,35762,35762,35762,35762,35762,35762,35731,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{35730,35730,35730,35730,35730,33682,35730,35730,35762,35730,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,33682,33682,48568,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,56954,31244,31244,56922,65535,65535,65535,59132,33421,29099,31179,33260,33292,35340,37518,59067,65535,65535,65535,59067,33356,29131,31179,31212,50454,65535,65535,65535,65535,65535,65535,65535,65535,61244,33454,29131,31212,33292,33325,35373,35438,56954,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,46325,29131,37680,63358,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63422,37777,29163,31276,31276,37647,61245,65535,65535,65535,54841,31341,31276,33357,33389,35438,35470,41905,63357,65535,65535,65535,54809,31341,31309,33357,33357,35470,35438,39825,63357,65535,65535,65535,65535,65535,65535,65535,65535,44212,29228,31308,33389,35470,56954,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,48438,29131,37647,61309,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63422,39825,31179,31212,33260,37583,61245,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,59099,33389,29131,31179,31179,44018,65502,65535,65535,65535,46260,29098,31179,31211,33260,33292,33260,46164,65535,65535,65535,65535,44245,27343,29455,29488,31601,54971,65535,65535,65535,65535,65535,65535,65535,65535,54906,29455,29423,29488,31569,33649,33682,33682,35730,35762,35762,35762,35762,35762,35762,35763,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796},
-	{35762,35762,35730,35730,35730,35730,35730,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35730,35762,35762,35762,35762,35762,35762,35762,35762,35730,33682,33650,48536,63454,63422,63422,63422,65503,65535,65535,65535,65535,63422,63422,63422,63422,54841,29163,29163,54874,65535,65535,65535,59132,33421,29131,29131,31179,33260,33260,35438,59067,65535,65535,65535,57019,29228,27050,31211,31244,50486,65535,65535,63422,63422,63422,63422,63454,65535,61244,33486,29163,31211,31212,33292,33293,35438,56922,65502,63422,63422,63422,65535,65535,65535,65535,65503,63422,63422,63422,63422,46260,27082,35599,63357,65535,65535,65535,65503,63422,63422,63422,63422,63422,63422,63422,65535,63422,37808,29195,29228,29196,35566,61244,65535,65535,65535,54841,29228,29195,31276,33357,35437,35438,39825,63357,65535,65535,65535,52728,29228,29228,31276,33357,35470,35502,39857,63357,65535,63454,63422,63422,63422,63422,65535,65535,44212,29260,29260,31308,33389,54841,63454,63422,63422,63422,65535,65535,65535,65535,65503,63422,63422,63422,63422,46325,27082,35566,61212,63422,63422,63422,63454,65535,65535,65535,65535,65502,63422,63422,63422,61309,37712,29099,31244,33324,37615,61245,65535,65502,63422,63422,63422,63422,63422,63422,65502,65535,59099,31373,29163,29131,29099,41938,65502,65535,65535,65535,46292,27082,29163,29131,31211,33260,33260,46163,65503,65535,65535,65535,42196,25261,27375,29488,31601,54971,65535,65503,63422,63422,63422,63422,65503,65535,52858,29455,27407,29455,29488,31569,33649,33682,33682,35730,35762,35762,35762,35762,35762,35763,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796},
-	{35762,35762,35730,35730,35730,35730,35730,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35730,35762,35762,35762,35762,35762,35762,35762,35762,35730,33682,33650,37907,42165,40052,37971,37971,57019,65535,65535,65535,61277,37873,33582,35663,35663,33518,27050,29163,54874,65535,65535,65535,63422,54873,52728,37712,29098,31179,31212,35437,59067,65535,65535,65535,56986,27115,27115,48470,54841,61212,65535,59131,37808,35663,35663,35663,46389,65535,63422,54874,54809,39825,29131,31244,33292,35405,41872,41969,39857,37776,42034,61277,65535,65535,65535,54906,33647,33615,35663,35696,31373,27050,35598,63357,65535,65535,65535,54873,33647,33615,35695,35695,35696,35695,44179,63422,65503,56986,54841,42067,27115,33486,61244,65535,65535,65535,52761,27147,27114,29196,33357,33389,33389,39825,63357,65535,65535,65535,52728,25098,27147,29196,31276,44115,54874,56986,65503,65502,46325,35728,35728,35728,39954,61245,65535,59131,54841,46357,29260,31276,37712,39889,39857,37776,42034,61277,65535,65535,65535,56986,35695,33615,35663,35696,31405,27050,31276,39792,39857,37776,37744,46357,65503,65535,65535,65535,48470,33582,33615,35663,35663,29228,27050,39825,54809,56954,63422,65535,48438,35663,35663,35663,35663,35663,35663,50551,65535,63390,54841,52728,35599,27018,39857,65502,65535,65535,65535,59132,52761,48405,29163,29099,31179,31179,44083,65503,65535,65535,65535,40148,23148,31632,52793,54938,63390,65535,52825,35857,33777,33777,35857,52858,65535,61309,54906,50713,33681,29423,31536,33649,33682,33682,33682,35762,35762,35762,35762,35762,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796},
-	{35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35730,35762,35762,35730,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,33682,33682,31569,29488,27375,25262,25261,52793,65535,65535,65535,59164,25098,18662,20775,22856,24937,24969,29163,54873,65535,65535,65535,65535,65535,65503,39921,24937,29098,29131,33357,57019,65535,65535,65535,56986,25034,27114,57051,65535,65535,65535,54906,25001,20775,20808,20775,37873,65503,65535,65535,65535,44115,27050,31211,31244,33324,33324,31243,29131,27018,31373,59164,65535,65535,65535,50615,18759,18727,20808,22888,24969,25002,35566,63357,65535,65535,65535,48502,18759,18727,20808,20840,22888,22888,33550,63390,65535,65535,65535,48470,25002,31405,59164,65535,65535,65535,52760,25034,25034,29195,31276,33357,33389,39825,63357,65535,65535,65535,50648,22985,25066,27115,29196,48406,65535,65535,65535,63422,35728,20872,20873,20872,27244,59131,65535,65535,65535,54874,29260,29163,29163,29163,27083,27050,31340,59164,65535,65535,65535,50680,18792,18727,20808,22888,24969,27050,29131,29131,27050,27050,24937,37809,63454,65535,65535,65535,39985,16646,18727,20808,22889,24969,27018,44115,65535,65535,65535,65535,39921,20775,20776,20808,22856,22856,22856,42099,65535,65535,65535,65502,37808,24937,39857,63454,65535,65535,65535,65535,65535,56986,27115,27018,29099,29099,44083,65503,65535,65535,65535,40115,18955,33713,63390,65535,65535,65535,46454,21035,18954,18954,21035,48567,65535,65535,65535,61342,33745,27342,29456,31569,33650,33682,33682,35762,35762,35762,35762,35762,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796},
-	{35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35730,35730,35762,35762,35730,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,33682,33682,33649,31537,29455,27342,25294,52793,65535,65535,65535,59164,23050,16646,18727,22856,24937,24969,29163,54873,65535,65535,65535,65535,65535,65503,37841,22888,27018,27050,31308,56987,65535,65535,65535,54938,22953,25066,57019,65535,65535,65535,54906,22953,18727,20808,20776,37873,65503,65535,65535,65503,42034,27050,29131,31212,33292,33292,31244,29163,27050,31373,61244,65535,65535,65535,50615,18759,18727,20808,22889,25001,25002,35566,63357,65535,65535,65535,48502,18759,18727,20840,22920,22921,22921,33582,63390,65535,65535,65535,46389,22921,29324,59164,65535,65535,65535,52760,22953,22953,27115,31276,33357,33357,39793,61309,65535,65535,65535,50647,20905,22953,27114,29163,48405,65535,65535,65535,63422,35728,20872,20873,22921,27244,59131,65535,65535,65535,54873,27179,27115,29163,29163,29163,27050,31373,59164,65535,65535,65535,50680,18791,18727,20808,22889,25001,27082,29131,29131,29131,27082,24969,39889,65502,65535,65535,65535,37937,16646,18727,20808,22889,27017,27018,44115,65535,65535,65535,65535,37873,18727,20807,20808,22888,22889,22889,42131,65535,65535,65535,63454,35728,22824,37776,63454,65535,65535,65535,65535,65535,54906,25034,24937,27050,29066,44082,65503,65535,65535,65535,38035,18922,31632,63390,65535,65535,65535,46454,18954,18922,18954,21035,48535,65535,65535,65535,61309,33713,27310,29455,31568,33649,33682,33682,35730,35762,35762,35762,35762,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796},
-	{35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35730,35730,35762,35762,35762,35762,35762,35762,35762,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35730,33682,33682,33649,31569,29456,27375,27342,52793,65535,65535,65535,59164,23114,16647,20775,22856,24937,27018,29163,54873,65535,65535,65535,65535,65535,65535,52760,46324,39921,27050,29228,56986,65535,65535,65535,54938,20872,22985,57019,65535,65535,65535,54873,20872,18727,20775,20808,29324,42066,42066,42066,42067,31405,27018,29131,31212,33292,33292,31244,31211,27050,31405,61244,65535,65535,65535,48567,16711,16679,20808,22921,25002,27050,35566,63357,65535,65535,65535,46454,16679,18727,20840,22921,25001,24969,33583,63390,65535,65535,65535,46389,20840,27244,59164,65535,65535,65535,50680,20904,22921,27082,31244,33357,33357,37744,61309,65535,65535,65535,50647,18824,23018,42099,48438,56986,65535,61244,44244,40018,27243,20872,22953,22953,27147,39986,42131,42131,42131,37841,27147,27115,29163,29163,29163,27082,31373,59196,65535,65535,65535,50680,16711,16679,20808,22921,27050,29131,29163,29163,29163,29131,27050,39889,65502,65535,65535,65535,37937,16614,18727,20808,24969,27050,27050,44115,65535,65535,65535,65535,37840,18694,18727,20808,22889,23018,23116,42229,65535,65535,65535,63454,35695,20743,35695,63454,65535,65535,65535,65535,65535,61244,46357,44244,31373,24937,42002,65503,65535,65535,65535,38002,16809,29551,63390,65535,65535,65535,46422,16873,18922,18954,21035,33712,42164,42196,40148,40116,27374,25261,29423,31536,33649,33682,33682,35730,35762,35762,35762,35762,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796},
-	{35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35730,35730,35730,35762,35762,35762,35762,35762,35762,35762,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35763,35730,33682,33682,33650,31569,31536,29455,27375,52826,65535,65535,65535,59164,23115,16711,20776,22889,27018,27050,29163,54874,65535,65535,65535,65535,65535,65535,65535,65535,52728,25001,27147,56986,65535,65535,65535,54938,20872,22953,57018,65535,65535,65535,54873,20872,18695,20808,20808,22888,22888,22856,20808,22856,22889,27018,29131,31212,33292,33292,33292,31212,29131,33453,61244,65535,65535,65535,48567,16711,18727,20840,24969,27082,27082,35599,63357,65535,65535,65535,46454,16678,18727,20840,25001,25002,25002,35631,63390,65535,65535,65535,44309,18759,27211,59164,65535,65535,65535,50680,20872,20840,27082,29196,33325,33357,37744,61309,65535,65535,65535,48567,18791,23050,57018,65535,65535,65535,56986,25066,18792,20872,20873,22953,25034,25066,25034,25034,22953,22953,25033,27114,27115,29163,31244,29163,29131,33453,61244,65535,65535,65535,50680,16711,18727,20840,24969,27082,29163,31212,31212,31212,31211,27050,39889,65502,65535,65535,65535,37905,16614,18727,22888,24969,27050,29098,44115,65535,65535,65535,65535,35792,16646,20775,22888,25034,25229,25229,44309,65535,65535,65535,63454,33647,18662,35695,63454,65535,65535,65535,65535,65535,65535,65535,63422,35663,22856,39954,65535,65535,65535,65535,35922,14728,29519,63390,65535,65535,65535,44374,16841,16873,18954,21003,22986,20970,20970,21003,21035,23083,25197,27375,31536,33649,33682,33682,35730,35762,35762,35762,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796},
-	{35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35730,35730,35762,35762,35730,35730,35730,35730,35762,35762,35762,35762,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35762,33682,33682,33682,33650,31569,29488,29456,52826,65535,65535,65535,59164,23115,16744,20840,24937,27050,29099,31244,54874,65535,65535,65535,65535,65535,65535,65535,65535,50648,22888,25034,56986,65535,65535,65535,54938,18792,20905,57019,65535,65535,65535,54873,18792,16647,20775,22856,22888,22888,22888,22856,22856,22889,24970,29131,31212,33292,33293,33293,33292,31211,35502,61244,65535,65535,65535,48567,16711,18727,22888,25002,27083,29131,35599,63357,65535,65535,65535,46454,16678,18759,22888,25002,27082,27050,35631,63390,65535,65535,65535,44308,16679,25131,59164,65535,65535,65535,50680,18824,20840,25034,29196,33325,33357,37744,61309,65535,65535,65535,48567,16711,23017,57018,65535,65535,65535,54938,23017,18759,20872,22953,25034,27115,27147,27147,27115,27114,25034,27114,27115,29163,31244,31244,31244,29163,33453,61244,65535,65535,65535,50680,16711,18727,22888,27050,29131,31212,33292,33292,33292,31212,29131,41970,65502,65535,65535,65535,37905,16614,18727,22889,27050,29131,29099,44115,65535,65535,65535,65535,35792,16646,20775,22921,25196,27342,27310,44342,65535,65535,65535,63454,33614,16614,33615,63422,65535,65535,65535,65535,65535,65535,65535,63422,33582,20743,37906,65535,65535,65535,65535,35922,14728,29518,63390,65535,65535,65535,44373,16809,16841,18922,22921,22889,22986,20970,20938,20970,23083,25229,27375,31536,31601,33682,33682,35730,35762,35762,35762,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796},
-	{35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35730,35762,35762,35762,35762,35762,35762,35762,35762,35763,35763,35731,35730,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35730,35730,33682,33682,33649,31569,31536,52826,65535,65535,65535,59164,23115,16744,22921,27018,29099,31179,31244,54874,65535,65535,65535,65535,65535,65535,65535,65535,57018,37873,39986,59164,65535,65535,65535,54906,18792,18792,42131,48470,57019,65535,59131,37905,35792,37841,39921,39921,39953,39921,39921,39921,31373,24969,29130,31211,33292,33325,35373,33293,31212,35534,61244,65535,65535,65535,48567,16711,18727,22921,27050,29163,29163,37679,63357,65535,65535,65535,46454,16678,18759,22921,25002,35631,42034,48405,63422,65535,65535,65535,44308,16678,25130,59164,65535,65535,65535,50680,18792,20840,25002,29195,33325,33357,37712,61309,65535,65535,65535,48567,16711,23017,56986,65535,65535,65535,54938,22985,18759,20872,25033,27115,29195,29228,29228,29228,29195,27147,29195,29195,31244,31244,33324,33324,31244,35534,61244,65535,65535,65535,50680,18759,18727,22889,27050,29163,33292,33293,35373,33293,33292,31179,41970,65502,65535,65535,65535,37905,16614,20808,24969,27050,29131,29131,44147,65535,65535,65535,65535,35792,16614,20808,25131,27342,27375,27375,44374,65535,65535,65535,63454,31566,16581,33614,63422,65535,65535,65535,65535,65535,65535,65535,63454,44276,35760,48535,65535,65535,65535,65535,35921,14728,25260,46454,48599,61277,65535,52825,35857,35890,37938,39921,39921,39986,40018,40018,37906,27341,25261,27375,29488,31569,33650,33682,33682,35762,35762,35763,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796},
-	{35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35730,35730,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35730,35730,35730,33682,33682,31569,31569,54906,65535,65535,65535,59196,23147,16776,22953,27018,29131,31180,33292,56922,65535,65535,65535,65535,65535,65535,65535,65535,65535,65502,65503,65535,65535,65535,65535,54906,18792,16646,20807,20808,44244,65535,65535,65503,65502,65502,65503,65503,65503,65503,65503,63454,42034,24969,27050,31211,33292,33293,35373,35373,33292,35535,61244,65535,65535,65535,48567,18759,18759,24969,27082,31211,31211,37679,63357,65535,65535,65535,46454,16678,18759,22921,27082,48438,65503,65503,65535,65535,65535,65535,44308,16646,25130,59164,65535,65535,65535,50680,18792,20840,25002,29195,31276,33325,37712,61309,65535,65535,65535,48567,16711,20937,56986,65535,65535,65535,54938,20937,18759,22921,25034,29195,31276,31309,31309,31308,31276,31276,31276,31276,31276,33324,33325,33325,31244,35534,61244,65535,65535,65535,50680,18759,18727,24969,27083,31212,33293,35373,35373,35373,33293,31212,41970,65502,65535,65535,65535,37937,16646,20808,24969,29131,31211,31179,46195,65535,65535,65535,65535,35792,16646,20905,25229,27374,29455,29455,46422,65535,65535,65535,63454,31566,14533,33614,63422,65535,65535,65535,65535,65535,65535,65535,65535,65503,63454,65503,65535,65535,65535,65535,35889,14728,16873,21035,23180,52825,65535,65503,65502,65502,65502,65502,65503,65503,65503,65503,61309,31632,25229,27342,29456,31569,33650,33682,33682,35730,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35796,35796,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796},
-	{35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35730,35762,35762,35762,35762,35762,35762,35762,35762,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35762,35730,33682,33649,31601,54906,65535,65535,65535,59196,23147,18824,22986,27051,31179,31180,33293,56922,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,54906,18791,16646,18727,20808,44244,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,39986,22889,27050,29131,31212,33292,35373,35373,33292,37615,61244,65535,65535,65535,48567,18759,20807,24969,29131,31212,31212,37679,63357,65535,65535,65535,46422,16646,18727,22888,25002,48438,65535,65535,65535,65535,65535,65535,44308,16646,25130,59164,65535,65535,65535,50680,18792,20840,25002,29163,31276,33325,37712,61309,65535,65535,65535,48567,16711,20937,54938,65535,65535,65535,54938,20937,18759,22953,27114,29228,33357,33389,33389,33357,33357,33357,33357,33357,33357,33325,35405,33325,33292,35534,61244,65535,65535,65535,50680,18759,18759,24969,29131,31244,35373,35373,35373,35373,35373,33260,44050,65502,65535,65535,65535,37937,16646,20808,24969,29131,31212,31179,46196,65535,65535,65535,65535,35792,16646,20970,25261,27375,29488,29456,46423,65535,65535,65535,63454,31566,14533,33614,63422,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,35889,14728,18921,18954,23148,52826,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61309,31632,23148,27310,29455,31568,33649,33682,33682,35730,35762,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35796,35796,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796},
-	{35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35762,35762,35730,35730,35762,35762,35762,35762,35762,35763,35731,35731,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35762,33682,33650,33649,54906,65535,65535,65535,59196,23147,18824,23051,27148,31212,33260,33325,56922,65535,65535,65535,63422,52825,50712,59196,65535,65535,65535,65535,65535,65535,65535,65535,54906,18791,16646,20775,22856,39921,54873,54841,52793,52793,52793,54841,54841,54841,54906,63422,65535,46389,33550,33486,29131,31211,33292,33325,35373,33292,37615,61244,65535,65535,65535,48567,18759,20808,24969,29131,31244,31212,37680,63357,65535,65535,65535,50712,29421,31469,33550,35663,52696,65535,63389,54873,52793,52793,52793,37905,16679,25130,59164,65535,65535,65535,50680,18792,20840,25002,29195,31276,33325,37712,61309,65535,65535,65535,48567,16678,20937,54938,65535,65535,65535,54938,20904,18759,22953,27115,31276,33357,35437,35437,35437,33389,33357,33357,33389,33357,35405,35405,35405,33325,35535,61244,65535,65535,65535,50680,18759,20808,24969,29131,33292,35373,35373,35373,35373,35373,33260,44050,65502,65535,65535,65535,37937,16646,20808,27018,31179,33260,31180,46196,65535,65535,65535,65535,35792,16679,21035,25261,29423,31536,29488,46423,65535,65535,65535,63454,31566,14533,33614,63422,65535,65535,65535,57115,50712,54938,63454,65535,65535,65535,65535,65535,65535,65535,65535,35889,14728,18922,21035,23180,46422,54906,52858,52858,52858,52858,54873,54874,54906,57083,65535,63390,40116,33745,31568,27375,29488,31569,33650,33682,33682,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35796,35796,35796,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796},
-	{35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35730,35730,35762,35762,35730,35730,35762,35762,35730,35762,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,33682,33650,33649,54906,65535,65535,65535,59196,23147,18825,23051,27213,31277,33260,33325,56922,65535,65535,65535,57083,21033,14695,46454,65535,65535,65535,65535,65535,65535,65535,65535,54906,18792,16646,20808,22888,25002,27082,25034,22985,22953,25033,25034,25034,25034,29325,59164,65535,63422,63390,52696,29163,29131,31212,33293,35373,33292,37615,61244,65535,65535,65535,50615,18759,20808,24969,29131,31244,31212,37680,63357,65535,65535,65535,63422,61309,61309,61309,63357,63422,65535,54906,25130,20904,18824,18856,18792,18727,27211,59164,65535,65535,65535,50680,18792,20840,25002,29163,33324,33325,37712,61309,65535,65535,65535,48567,16678,20937,54938,65535,65535,65535,54938,20904,18760,25001,27147,31276,33389,35438,35438,35438,35437,33389,33389,33389,35405,35405,35405,35405,33325,35535,61244,65535,65535,65535,50680,18759,20808,24969,29131,33292,35373,35373,35373,35373,35373,33260,44050,65502,65535,65535,65535,37937,16646,22856,27018,31179,33260,31180,46196,65535,65535,65535,65535,35792,16711,21035,25261,29455,31536,29488,46423,65535,65535,65535,63454,31566,14533,31599,63454,65535,65535,65535,38067,12646,25324,61309,65535,65535,65535,65535,65535,65535,65535,65535,35889,14728,18922,21067,23148,25261,25261,23180,23148,23148,23180,25196,25196,23180,35922,63422,65535,63390,63390,44309,25262,29455,31568,33649,33682,33682,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35796,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796},
-	{35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35730,35730,35762,35762,35762,35762,35762,35762,35762,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35731,33650,33649,54906,65535,65535,65535,59196,23147,18825,23051,27245,31309,33260,33325,56922,65535,65535,65535,57051,16840,10469,44373,65535,65535,65535,65535,65535,65535,65535,65535,54906,18791,16646,20808,22888,24937,22857,22856,20808,20808,20808,22856,22856,22856,27179,59132,65535,65535,65535,54841,27082,27050,31211,33292,33293,33292,37615,61244,65535,65535,65535,50615,18759,20808,24969,29131,31244,31212,37680,63357,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,52793,18824,16646,16646,16678,18759,20808,27211,59164,65535,65535,65535,50680,18792,20808,25002,29163,31276,33324,37712,61309,65535,65535,65535,48567,16678,20937,54938,65535,65535,65535,54906,20904,18759,25001,27115,31276,33389,35438,35438,35437,33389,33357,33389,33389,35405,35405,35405,35405,33325,35535,61244,65535,65535,65535,50680,18791,20808,24969,29131,33292,35373,35373,35373,35373,35373,33260,44050,65502,65535,65535,65535,37937,16646,22856,27018,31179,33260,31180,46196,65535,65535,65535,65535,35792,16646,20905,25261,29455,31536,29488,46423,65535,65535,65535,63454,31566,14598,31664,63454,65535,65535,65535,35954,8421,23211,61309,65535,65535,65535,65535,65535,65535,65535,65535,35889,14728,18922,21067,23148,23148,23116,21035,21035,21003,21035,21035,21035,21035,33777,63422,65535,65535,65535,44342,25229,27374,29488,31569,33650,33682,35730,35731,35698,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796},
-	{35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35730,35730,35762,35762,35762,35762,35762,35730,35763,35763,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,33683,33650,33649,54906,65535,65535,65535,59196,23147,18825,23051,27213,31309,31212,33325,56922,65535,65535,65535,57051,18920,12550,40115,59131,59196,65535,65535,65535,65535,65535,65535,54906,18791,18727,27211,31373,31405,31405,29260,22889,22888,22888,22889,22889,22889,27179,59132,65535,65535,65535,52793,25002,27050,29131,33292,33292,33292,37615,61244,65535,65535,65535,50615,18759,20808,24969,29131,31244,31212,37680,63357,65535,65535,65535,63390,57051,59131,63454,65535,65535,65535,54906,27243,23050,18791,18727,20808,22888,29292,59164,65535,65535,65535,50680,18792,20808,25001,29163,31244,31276,37712,61309,65535,65535,65535,48567,16711,20904,50647,59132,61309,65535,57019,27308,25163,25066,27115,31276,33357,35470,37648,39728,37680,37680,37615,33389,33357,35373,35405,35373,33293,35535,61244,65535,65535,65535,50680,18791,20808,24969,29131,33292,35373,35373,35373,35373,35341,33292,44083,65503,65535,65535,65535,37937,16646,20808,27018,29131,31212,31179,46196,65535,65535,65535,65535,35792,16614,20841,25229,29423,31536,29488,46423,65535,65535,65535,63454,31598,14663,31696,63454,65535,65535,65535,38002,10501,21099,54906,57116,63422,65535,65535,65535,65535,65535,65535,35889,14728,21067,29487,31600,31600,31600,27374,21067,21067,21068,23116,23148,21067,35857,63422,65535,65535,65535,44341,23148,27310,29455,31569,33650,33682,35730,35730,35504,35601,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796},
-	{35762,35762,35762,35762,35762,35762,35762,35730,35730,35730,35730,35730,35762,35762,35762,35763,35730,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,33682,33650,31601,54906,65535,65535,65535,59196,23147,18825,23019,27213,29261,31212,33293,56922,65535,65535,65535,57083,18921,12582,18921,23115,35857,63422,65535,65535,65535,65535,65535,54906,18791,20872,52728,61244,61212,61244,52728,27114,22889,24937,24969,24969,24937,29260,59132,65535,65535,65535,52793,22953,24969,29131,31212,33292,33292,37583,61244,65535,65535,65535,50615,18759,20808,24969,29131,31244,31212,37680,63357,65535,65535,65535,48567,21001,27308,59131,65535,65535,65535,63422,59131,54938,27308,18727,20840,22921,29324,59164,65535,65535,65535,50680,18792,20808,25001,29163,31244,31276,37712,61309,65535,65535,65535,48567,16711,18791,25131,27243,46389,65535,63422,59132,57019,33615,27082,29195,31276,35567,56922,61212,61212,61244,52696,33421,33324,33325,35373,35373,33293,35535,61244,65535,65535,65535,50680,18791,20808,24969,29131,33292,35341,35373,35373,35373,33357,31342,42165,65503,65535,65535,65535,37937,16646,20808,24969,29131,31212,31179,46195,65535,65535,65535,65535,35792,16614,20840,25229,27375,29488,29455,46422,65535,65535,65535,63454,31663,14695,31696,63454,65535,65535,65535,38002,12614,14760,21099,25292,52825,65535,65535,65535,65535,65535,65535,35889,14695,27438,57083,61277,59229,61277,46422,23148,23116,23148,23148,23181,23148,35858,63422,65535,65535,65535,42261,21035,25261,27375,31537,33650,33682,35730,35730,35601,35666,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35764,35796,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796},
-	{35762,35762,35762,35762,35762,35730,35730,35730,35730,35730,35762,35762,35762,35762,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,33683,33682,31569,31569,54906,65535,65535,65535,59196,23115,16744,23019,27180,29294,31277,31309,54874,65535,65535,65535,57083,21001,14631,16744,16744,31599,63422,65535,65535,65535,65535,65535,54906,18791,22953,57019,65535,65535,65535,56986,27114,22889,24937,24969,24970,24969,29260,59132,65535,65535,65535,52761,22921,24937,27050,31212,33292,33292,37583,61244,65535,65535,65535,50615,18759,20808,24969,29131,31244,31212,37680,63357,65535,65535,65535,46421,12485,18856,57051,65535,65535,65535,65535,65535,63390,29421,18727,22888,24969,31373,59164,65535,65535,65535,50680,18791,18759,22921,27083,29163,31244,35631,61277,65535,65535,65535,48567,16711,18759,20840,20840,42163,65535,65535,65535,63422,35728,25001,27115,29196,35566,59164,65535,65535,65535,56954,33389,31244,33292,33325,35373,33292,35535,61244,65535,65535,65535,50680,18791,20808,24969,29131,33292,35341,35373,35373,35373,33487,31504,42165,65503,65535,65535,65535,37937,16614,20776,24937,29098,31179,31179,44147,65535,65535,65535,65535,35792,16614,20840,25196,27342,29455,29423,46422,65535,65535,65535,63454,31664,14728,33744,63454,65535,65535,65535,38034,12647,14728,16809,18954,50712,65535,65535,65535,65535,65535,65535,35889,14695,29519,63390,65535,65535,65535,48567,23148,23148,23148,25229,25229,23149,35858,63422,65535,65535,65535,42260,21035,25229,27375,31536,33649,33682,35730,35633,35569,35633,35731,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35764,35764,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796},
-	{35762,35762,35762,35762,35762,35730,35730,35762,35762,35762,35762,35762,35763,35763,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35795,35795,35795,33682,33682,54906,65535,65535,65535,59196,25260,20970,25164,29326,31406,29326,31439,54906,65535,65535,65535,57083,21002,16711,18825,18857,33680,61277,63390,65503,65535,65535,65535,54906,18791,20905,54873,63390,63422,65535,56986,29260,27114,27115,29195,29195,29195,33453,59164,65535,63422,63389,50615,22920,22889,27050,31212,33292,33292,37615,61244,65535,65535,65535,50615,18759,20808,24969,29131,31244,33260,37680,63357,65535,65535,65535,46422,14565,18856,54873,63389,63422,65535,65535,65535,63390,31566,22953,25034,24969,31373,57019,63390,63454,65535,52760,23017,22985,27146,29228,31308,31341,37744,61309,65535,63390,63390,46454,18791,20840,22921,22921,42131,63389,63390,65535,63422,37841,27147,29260,31340,35631,59164,65535,63422,63390,52761,31308,29195,31244,33325,33325,33292,35535,61244,65535,65535,65535,50680,18791,20808,24969,29131,33292,35341,35373,37518,35600,33681,31601,42229,65503,65535,65535,65535,40083,18856,22985,27114,31244,31211,29099,44083,63357,63390,65535,65535,37905,20840,23050,27341,29487,31568,29488,46455,65535,65503,63390,61277,31631,14728,33744,63454,65535,65535,65535,38035,14728,16841,18922,21067,48632,63390,63422,65535,65535,65535,65535,35889,14696,29486,59196,63390,65503,65535,48600,25293,25293,27342,27374,27374,27374,38003,63422,65535,63390,61342,40148,18954,23181,27343,31536,33649,33682,35698,35601,35569,35601,35666,35698,35731,35763,35763,35731,35763,35763,35763,35763,35763,35763,35763,35764,35796,35764,35764,35764,35796,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796},
-	{35762,35762,35762,35730,35730,35762,35730,35730,35762,35762,35762,35762,35731,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,46391,57052,57051,57019,57019,63390,65535,65535,65535,63422,54906,52793,54874,54906,48503,29358,29358,54906,65535,65535,65535,57083,21034,16744,20937,23018,27244,33647,33712,57083,65535,65535,65535,54906,18792,18727,31405,35631,50615,65535,63390,54873,54841,54841,54873,54873,54841,56954,63422,65535,44309,29389,27243,20808,24937,27050,31212,33292,33260,37583,61244,65535,65535,65535,50615,18759,20808,24969,29131,31244,33260,37680,63357,65535,65535,65535,46422,14598,16678,27276,29421,48567,65535,65535,65535,65503,57018,54873,44212,25034,27115,35631,35695,52760,65535,61309,52793,52793,54841,54873,54874,54874,57019,65503,65503,42163,29421,25195,18792,20872,25001,25001,29325,33583,39986,63390,65535,57051,54841,54873,54874,56986,63422,65535,48470,35663,33518,27115,29163,31244,33292,33325,33292,35535,61244,65535,65535,65535,50680,18792,20808,24969,29131,33292,33293,39663,54809,57019,57019,54971,59164,65535,65535,65535,65535,57116,52825,52793,54841,54809,35567,29098,33389,35631,39889,61277,65535,57051,52760,52825,54906,54938,54938,54938,59197,65535,59164,33744,27438,21066,16841,33777,63454,65535,65535,65535,38067,14760,18922,21035,23116,29519,31632,44341,65535,65535,65535,65535,35889,14728,21099,31664,35858,57051,65535,61277,54906,54906,54906,54938,54938,54938,57084,65535,63390,37970,29518,23212,21035,23181,27375,31536,33649,33682,35698,35601,35569,35601,35601,35601,35666,35666,35666,35634,35666,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796},
-	{35730,35730,35730,35730,35730,35762,35730,35730,35762,35762,35762,35762,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35731,50649,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,56987,29358,29326,54906,65535,65535,65535,57083,23115,18825,23018,25099,25132,23019,25164,54938,65535,65535,65535,54938,20872,18695,20808,22856,46293,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,37873,16614,18695,20808,24969,29131,31212,33292,33260,37583,61244,65535,65535,65535,50647,20840,20808,27018,29131,31212,33260,37680,63357,65535,65535,65535,46454,16646,16646,18727,18727,44276,65535,65535,65535,65535,65535,65535,50615,25034,27050,27082,25034,48470,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,33647,16646,18759,20840,22953,25034,27082,27082,24969,31437,61309,65535,65535,65535,65535,65535,65535,65535,65535,42066,22920,25001,27082,29163,31212,33292,33325,33292,35535,61244,65535,65535,65535,50680,20840,20808,27018,29131,33292,33292,39728,63357,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63422,37712,27050,27050,26985,29260,59164,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,57051,21067,16808,16841,18922,35857,63454,65535,65535,65535,40115,16841,18954,23116,23181,23148,21035,37970,65503,65535,65535,65535,35922,16808,18954,21067,25261,54906,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61309,27405,16808,18921,21035,25229,27375,31537,33649,33682,35698,35601,35569,35601,35601,35601,35601,35601,35601,35601,35602,35699,35763,35763,35763,35763,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796},
-	{35730,35730,35730,35762,35762,35762,35762,35762,35762,35762,35762,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35763,35763,35763,33683,48569,65503,65503,65503,65503,65503,65503,65503,65503,65503,65503,65503,65503,65535,54906,29326,29326,54874,65535,65503,65503,57051,23147,20906,23051,27212,27213,27180,27277,54938,65535,65503,65535,54906,20872,18727,22888,24937,46292,65503,65503,65503,65503,65503,65503,65503,65503,65503,65503,65502,37873,18695,20776,22888,27018,29131,31212,33293,33292,37583,61212,65503,65503,65535,50615,20840,22888,27050,29131,33292,33260,37680,61277,65503,65503,65535,46422,18727,18727,20808,20840,44276,65503,65503,65503,65503,65503,65535,50583,25034,27050,27082,27114,48470,65535,65503,65503,65503,65503,65503,65503,65503,65503,65503,63422,33679,18759,20840,22921,25034,27115,29163,29195,27082,33518,61277,65503,65503,65503,65503,65503,65503,65503,63454,39986,22888,25001,27082,29163,31212,33292,33325,33293,37583,61212,65503,65503,65535,50680,20840,22888,27050,29163,33292,33292,39760,61277,65503,65503,65503,65503,65503,65503,65503,65503,65503,65503,65503,65503,63390,37711,27018,27050,27018,31340,59132,65503,65503,65503,65503,65503,65503,65503,65503,65503,65535,54971,23148,16841,18954,21003,35858,63422,65503,65503,65503,40115,18922,21035,23181,25262,25262,23181,40083,63454,65503,65503,65503,35922,16841,21035,23148,25293,52826,65535,65503,65503,65503,65503,65503,65503,65503,65503,65503,61277,27438,16841,18954,23148,25262,29455,31569,33650,33682,35633,35569,35601,35601,35601,35601,35601,35601,35601,35601,35634,35731,35763,35763,35763,35763,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796},
-	{35730,35730,35762,35762,35762,35762,35762,35762,35763,35763,35763,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35796,35764,35764,35764,35763,33683,40053,44343,44310,42229,40117,40084,38003,35922,35890,35857,35857,35858,37938,40019,35794,27213,27213,37874,40052,40019,37938,35793,23051,23019,25132,27245,29294,29293,27277,37874,39986,37873,37841,33615,20840,20808,24937,24969,33518,42002,39954,39953,39921,39953,39953,39954,39954,39921,39921,37873,27243,20776,22856,24969,27050,31211,33292,33293,33293,35405,41970,42034,39953,37873,31502,20840,22889,27050,31211,33292,33292,35437,42002,42034,39953,37873,31469,20807,20808,22889,22921,33518,39953,37873,37840,35792,35792,37873,33550,25001,27050,27115,27115,35631,39986,39953,37873,37873,37873,39953,39953,39954,39954,39953,37873,27211,20840,22921,25034,27115,29195,31244,31244,29195,31308,39921,39986,39953,37905,39953,39953,39953,39953,39953,29356,22921,25001,27082,29163,31244,33325,35373,33325,35437,41970,42034,39953,37873,33582,20840,22953,27147,29390,31504,33455,35665,44278,44310,42229,42164,40084,38003,37970,35890,35889,35889,35890,37970,38003,39921,29228,27018,29098,27050,29163,39857,39921,37873,37873,37873,37873,40019,40083,40051,39953,37938,33745,21035,18954,21035,23148,29487,40084,40083,38003,37970,27406,18955,23148,25261,27342,27375,27342,31600,40083,38003,35922,35890,25325,18954,21068,23181,25261,35890,40116,40083,38003,38003,38003,38035,40083,40083,38035,38003,35890,23180,18954,21067,25229,27342,29488,31569,33650,35665,35569,35601,35666,35601,35601,35601,35601,35601,35601,35601,35699,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796},
-	{35762,35762,35762,35762,35762,35762,35763,35763,35763,35763,35730,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35764,35763,33715,33650,31569,29456,27343,25262,23149,21035,18954,18857,16777,16777,18857,20938,23019,25100,25133,27213,27181,25132,23019,20938,20938,23019,25100,27213,29326,31406,31406,29326,27213,23019,20841,20776,20776,20808,22889,27018,27050,27018,24970,25002,22986,20938,20938,22986,22986,22986,22921,22856,20808,20808,22888,24937,27050,29131,31212,33293,35341,35341,33292,31179,27050,24937,22856,20808,22888,24969,29131,31212,33292,33293,33292,29131,27050,24937,20808,20808,22888,24969,24969,27050,25002,24969,22888,20807,18727,18727,20808,22888,25001,27082,29163,29163,27082,25001,22889,20840,20840,20840,22888,22921,22921,22953,22921,20873,20938,23018,25066,27115,29196,31244,33324,33325,31276,29163,27082,25001,22921,22920,22920,22920,22920,22920,22920,22921,25001,25034,29163,31212,33292,33325,35373,35373,33292,31211,27050,24937,22856,20808,22985,25228,27310,29488,31569,33617,33617,31536,29455,27342,25229,23148,21035,18954,16873,16841,16841,16841,18922,20905,22889,24969,27050,29098,29099,27083,27050,24937,22856,20776,20776,20905,21035,21035,22953,22856,20905,20970,21003,21068,23149,25261,25262,25261,23149,21067,21035,21035,23116,25229,27342,29455,29456,29455,27342,25229,21067,18954,18922,18954,21067,23181,25261,27342,25261,25229,23148,21067,21035,21035,21067,21068,21068,21067,21035,21035,21035,21068,23181,27342,29455,31536,33617,33553,35600,35569,35569,35601,35601,35601,35601,35601,35601,35601,35666,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35796,35764,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796},
-	{35762,35762,35762,35762,35762,35762,35763,35763,35763,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35764,35763,33715,33682,31570,29489,27375,25262,25229,23149,21068,21003,20938,20938,20971,23019,25100,25133,27213,27213,27246,27213,25133,25100,23052,25132,27213,29294,31407,31407,31407,31407,29326,27213,25034,22889,22889,24937,27018,27051,29131,29131,27083,27180,25131,25099,23051,23051,23051,23051,23019,22921,22889,24937,24969,27050,29131,31212,33292,35341,35373,35341,33293,31212,29131,27050,24969,24969,24969,27050,29131,33260,33293,33293,33292,31212,29131,27050,24969,24969,24969,27050,27082,29131,29131,27050,24969,22921,22888,22888,22889,24969,27050,29131,29196,31244,29195,27083,27050,24969,24969,22921,22953,23018,25099,25099,23051,23051,23083,25131,27244,29228,31276,33325,33325,33357,33357,31276,29163,27114,25034,25001,25001,25001,25001,25001,25001,25001,25034,27083,29195,31244,33293,35373,35373,35373,33293,31212,29131,27050,24969,25001,25164,27342,29455,31536,31601,33649,33649,31569,29456,27375,25262,25229,23148,21067,21035,18986,18954,20905,22888,22889,24969,27018,29098,29131,29196,29293,27213,27147,24969,24937,22921,23116,23148,23019,24937,22889,22986,23051,23116,25229,25262,27342,27375,27342,25262,25229,23148,23148,25229,27342,29423,29488,31536,31536,29455,27342,25229,23148,23116,23148,23181,25262,27342,27375,27374,27342,25261,23181,23148,23148,23148,23148,23148,23148,23116,23148,23148,25229,27310,27375,31504,33520,33520,35568,35569,35569,35569,35569,35601,35601,35633,35633,35633,35634,35699,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796},
-	{35762,35762,35762,35762,35762,35762,35763,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35764,35764,35763,33683,31602,31537,29456,27375,27343,25262,25230,23181,23084,25100,25132,25133,27213,27213,27246,29294,29294,29294,27246,27213,27213,27213,29294,31407,31408,33488,33488,33488,31407,29326,27148,27083,27051,27050,29099,29131,31180,31212,29261,29293,27212,27212,25132,25132,25132,25132,25132,25067,27018,27018,27050,29131,31212,33292,33293,35373,35373,35373,35341,33292,31212,29131,27050,27050,27050,29131,31212,33292,35373,35373,33293,33292,31211,29131,27050,27050,27050,29131,31211,31212,31211,29131,27082,27050,25001,24969,25002,27050,27083,29163,31276,31276,31244,29163,29131,27082,27082,27115,25132,25164,25164,25164,25164,27212,27212,27245,29325,31341,33357,33357,35405,35405,33357,33389,31276,29196,29163,27082,27082,27082,27082,27082,27082,27082,27115,29195,31244,33324,33325,35373,35373,35373,35373,33292,31211,29131,27050,27180,27342,27375,29488,31569,33649,33649,33649,31569,31536,29455,27342,25261,25261,23181,23148,23116,23019,24969,24969,27017,27050,27083,29163,31244,31341,31374,29326,29293,27115,27050,25067,25197,25132,25002,24969,25034,25132,25132,25197,27342,27375,29456,29456,29455,27375,27342,25262,25262,27342,27375,29488,31569,31569,31569,31536,29455,27342,25262,25261,25261,27342,27375,29455,29456,29455,27375,27342,25262,25261,25229,25229,25229,25261,25261,25197,25197,25229,27310,29390,29423,31472,33488,35568,35568,35569,35569,35569,35569,35601,35666,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35796,35796,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796},
-	{35762,35762,35762,35762,35762,35762,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35764,35764,35763,33683,33650,31570,31537,29456,29424,27375,27343,27343,27246,27214,27246,27246,29294,29327,29327,31407,31407,31407,29327,29327,29326,29327,31407,31408,33488,33521,33521,33520,33488,31407,29326,29294,29229,29164,31180,31212,33261,31342,31407,31406,29326,29293,27245,27245,27245,27245,27245,27180,29099,29131,29131,31212,33260,33293,35373,35373,35373,35373,35373,33293,33260,31212,29131,29131,29131,31212,33292,33293,35373,35373,35373,33292,31244,31211,29131,29131,29163,31212,31244,33292,33292,31244,31211,29163,29131,27082,27083,29131,29163,31244,33325,33325,33325,31244,31244,29196,29260,27245,27277,27245,27245,27277,29325,29325,29325,29358,31438,33487,33422,35405,35405,35437,35437,33390,33422,31276,31244,29195,29163,29163,29163,29163,29163,29163,31244,31244,33325,33325,35373,35373,35405,35373,35373,33293,33292,31211,29131,29293,29455,29488,31568,33649,33649,33682,33649,33649,31569,29488,29455,27375,27342,27342,27245,27147,27050,27050,27050,29098,29131,29293,31374,31406,31406,31407,31406,31406,29325,29261,27278,27180,27050,29098,29098,27115,27245,27245,29325,29391,29423,31504,31569,31536,29456,29455,27375,27375,29455,29488,31569,31601,33649,33649,31569,31536,29456,29423,27375,27375,29423,29456,31536,31536,31536,29488,29455,27375,27342,27342,27342,27342,27342,27342,27342,27245,29293,29325,31406,31407,33487,35568,35568,35568,35568,35569,35569,35569,35601,35731,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35796,35796,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796},
-	{35762,35762,35762,35762,35762,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35764,35764,35763,33683,33650,31570,31569,31537,29489,29489,29456,29359,31375,31375,31407,31408,31408,31408,33488,33488,33488,31440,31408,31408,31408,33488,33488,33521,35569,35569,35569,33520,33488,31407,31407,31407,31342,33261,33293,33358,33487,33487,31407,31407,31406,31374,31374,31374,31374,31374,31342,31277,31212,31212,33260,33293,35341,35373,35373,35373,35373,35373,35341,33292,33260,31212,31212,31212,33292,33293,35373,35373,35373,35373,35373,33292,33292,31212,31212,31212,33292,33293,33325,33325,33293,33292,31244,31212,31212,31212,31244,31244,33325,33357,35405,35405,33325,33324,31374,31406,29358,29358,29358,29358,31406,31406,31406,31406,31439,33519,33520,35535,35405,35405,35438,35438,35503,33455,33325,33325,31276,31276,31244,31244,31244,31244,31244,33324,33325,35405,35405,35373,35373,35373,35373,35373,35373,33293,33292,31276,31439,31536,31569,33649,33649,33682,33682,33682,33649,31601,31569,31536,29488,29455,29358,31211,31179,31179,31179,31179,31179,31277,31406,31406,33455,33487,33487,33487,33455,31439,31504,29423,29229,31211,31179,31244,29229,29326,29326,31406,31407,31407,33552,31569,31569,31569,31536,29488,29488,31536,31569,33649,33649,33650,33650,33649,31569,31569,31536,29488,29488,31536,31569,31569,31569,31569,31569,31536,29488,29456,29456,29455,29455,29456,29455,29455,29358,31374,31406,33455,33488,33488,35568,35568,35568,35569,35569,35569,35569,35601,35731,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35796,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796},
-	{35763,35763,35763,35731,35730,35730,35762,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35764,35764,35796,35796,35796,35764,35764,35764,35796,35764,35764,35764,35763,33683,33683,33650,33650,31602,31570,33521,33489,33488,33488,33489,33489,33489,33489,33521,33521,33521,33521,33489,33489,33489,33521,35569,35601,35601,35601,35569,35569,33521,33488,33488,33488,33456,33358,35341,35503,35568,33520,33488,33487,33487,33487,33455,33455,33455,33455,33487,31439,33390,33293,35341,35341,35373,35373,35373,35373,35373,35373,35373,35341,33292,33292,33292,33293,35341,35373,35373,35373,35373,35373,35373,35406,33422,33422,33422,33422,33422,35438,35373,35373,35373,33325,33293,33292,33292,33356,35436,35405,33325,35405,35437,35405,35405,35373,33455,33487,31439,31439,31439,31439,33487,33487,33487,33519,33519,33520,35600,35535,35406,35406,35438,35503,35568,35503,35405,33357,33357,33357,33325,33325,33325,33325,33325,33357,35405,35405,35405,35405,35405,35405,35405,35373,35373,35373,33325,33487,31569,31569,33649,33649,33682,33682,33682,33682,33682,33649,33649,31569,31569,31569,31471,33292,33260,33260,33260,33260,33260,31374,33487,33487,33487,33487,33488,33487,33552,31569,31569,31504,31407,33357,31406,31439,31374,31407,31407,33487,33487,33487,33552,33650,33649,33649,31569,31569,31569,31569,33649,33649,33682,33682,33682,33682,33649,33649,31569,31569,31569,31569,33649,33649,33649,33649,33649,31569,31569,31569,31569,31536,31537,31568,31568,31536,31439,33455,33487,33488,33488,35568,35568,35568,35568,35569,35569,35601,35569,35634,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35796,35796,35764,35764,35764,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796},
-	{35730,35730,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35764,35764,35796,35796,35796,35764,35764,35796,35796,35796,35764,35764,35764,35763,35731,33683,33683,33683,33586,33521,35570,35569,33521,35569,35569,35569,35569,35569,35569,35569,35569,35569,35569,35569,35569,35601,35601,35601,35601,35601,35601,35569,35569,35569,35569,35569,35536,35504,35568,35569,35568,35568,33520,33520,33520,33488,33488,33488,33488,33488,33520,33487,35438,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35341,35341,35341,35341,35373,35373,35373,35373,35373,35373,35373,35470,33520,33520,33520,33520,35568,35503,35373,35373,35373,35373,35373,35373,35373,35437,37549,35437,35405,35438,35438,35438,35405,35405,33422,33520,33520,33520,33520,33520,33520,33520,33520,33552,35600,35600,35600,35503,35406,35406,35503,35600,35600,35535,35406,35437,35405,35405,35405,35405,35405,35405,35405,35405,35405,35438,35405,35405,35405,35405,35405,35373,35373,35373,35405,33585,33649,33649,33682,33682,33682,33682,33682,33682,33682,33682,33649,33649,33649,33649,33617,33357,35340,35340,35340,35340,35341,33455,33487,33520,33520,35568,35568,35600,33617,33649,33552,33519,33487,33422,33552,33519,33487,33487,33487,33487,33520,33520,33617,33682,33682,33682,33649,33649,33649,33649,33650,33682,33682,33682,33682,33682,33682,33650,33649,33649,33649,33649,33650,33682,33682,33682,33650,33649,33649,33649,33649,33649,33649,33649,33649,33649,33520,33488,33488,33520,35568,35568,35568,35568,35569,35569,35569,35601,35569,35666,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35796,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35764,35764,35764,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796},
-	{35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35764,35764,35764,35764,35764,35763,35731,35634,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35601,35601,35601,35569,35569,35569,35601,35601,35601,35601,35601,35569,35568,35568,35568,35568,35568,35568,35568,35568,35568,35568,35536,35406,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35406,35405,35438,35536,35600,35600,35600,35600,35600,35568,35438,35373,35405,35373,35373,35373,35373,35437,37517,35437,35406,35438,35438,35438,35406,35406,35503,35600,35600,35600,35600,35600,35600,35600,35600,35600,35600,35600,35600,35470,35438,35471,35600,35632,35600,35535,35438,35438,35438,35437,35405,35405,35405,35405,35438,35438,35438,35438,35405,35405,35406,35405,35373,35373,35373,35373,35405,33617,33682,33682,33682,33682,33682,35730,35730,33682,33682,33682,33682,33682,33682,33682,33649,35438,35341,35341,35341,35341,35341,35503,35568,35568,35568,35568,35633,33650,33682,33585,35568,35568,33520,33552,33520,33520,33520,35568,35568,35568,35600,33649,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33650,33650,33650,33650,33650,33682,33649,33520,35568,35568,35568,35568,35568,35568,35600,35569,35569,35569,35601,35569,35666,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35796,35764,35764,35764,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35764,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796},
-	{35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35764,35764,35764,35764,35764,35667,35603,35603,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35601,35601,35601,35601,35601,35601,35601,35601,35601,35601,35601,35601,35569,35568,35568,35568,35568,35568,35568,35568,35600,35568,35406,35373,35373,35373,37421,37421,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35406,35503,35568,35568,35600,35600,35600,35600,35600,35600,35600,35536,35406,35406,35406,35406,35374,35406,35405,35405,35405,35406,37486,37486,37486,35406,35406,35536,35601,35600,35601,35600,35600,35601,35600,35600,35600,35633,35633,35633,35600,35568,35600,35633,35632,35632,35536,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35406,35405,35405,35405,35373,35373,35373,35373,35406,35633,33682,33682,33682,33682,35730,35762,35762,35762,35730,33682,33682,33682,33682,33682,33649,35438,35341,35341,35341,35341,35373,35503,35568,35568,35600,35697,35730,33682,35730,35633,35568,35568,35633,35632,35568,35568,35568,35600,35633,35600,35665,33682,33682,35730,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33617,35568,35568,35568,35568,35568,35568,35568,35601,35569,35569,35569,35601,35569,35666,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35796,35764,35764,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796},
-	{35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35764,35764,35764,35699,35603,35603,37651,37651,35603,35603,35603,35603,35603,35603,35603,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35601,35601,35601,35601,35601,35601,35601,35601,35601,35601,35601,35601,35601,35601,35600,35600,35600,35600,35600,35568,35406,35373,35373,37421,37421,37421,37421,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35373,35536,35600,35600,35600,35600,35600,35600,35600,35600,35600,35600,35503,35438,35406,35406,35406,35406,35406,35406,35406,35406,37486,37486,37486,35406,35471,35601,35601,35601,35601,35601,35601,35633,35633,35633,35633,35633,35633,35633,35633,35633,35633,35633,35633,35633,35535,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,35438,37486,35406,35405,35405,35405,35405,35405,35373,35373,35373,35503,35730,35762,35730,35762,35762,35762,35762,35762,35762,35730,35730,35730,35730,35762,35568,35373,35341,35373,35341,35341,35373,35535,35600,35600,35665,33682,35762,35698,35600,35600,35600,35665,35697,35632,35600,35600,35600,35633,35730,35730,35730,35762,35762,35762,35730,35762,35730,35730,35730,35730,35730,35730,35730,33682,35730,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,33682,35633,35568,35568,35568,35568,35568,35568,35569,35601,35569,35569,35601,35601,35569,35666,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796},
-	{35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35732,35635,37651,37651,37651,37651,37651,37651,37651,37683,37651,37683,35603,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35601,35601,35601,35601,35601,35601,35601,35601,35601,35601,35601,35601,35601,35601,35600,35600,35601,35568,35406,35373,35373,37421,37421,37421,37421,37421,37421,37421,37421,37421,37421,35373,35373,35373,35373,35373,35536,35600,35600,35600,35600,35600,35600,35600,35600,35600,35600,35600,35568,35470,35406,35406,35406,35406,35406,35406,35406,37486,37486,37486,35406,35503,35601,35601,35601,35601,35601,35601,35633,35633,35633,35633,35633,35633,35633,35633,35633,35601,35633,35633,35568,35438,35438,37486,37486,37486,37486,35438,35438,35438,35438,35438,35438,37486,37454,35405,35373,35405,35405,35373,35373,35373,35373,35471,35730,35762,35730,35762,35762,35762,35762,35762,35762,35730,35762,35762,35762,35730,35503,35373,37421,35373,35406,35406,35438,35568,35665,35730,35730,35762,35730,35633,35568,35568,35600,35698,35730,35730,35730,35730,35730,35730,35730,35762,35762,35730,35730,35730,35730,35762,35762,35762,35762,35762,35762,35730,35730,35730,35730,35730,35730,35730,35730,35730,33682,33682,33682,33682,35730,35730,35730,35730,35730,33682,33682,33682,35730,35730,35665,35600,35568,35568,35568,35568,35569,35569,35569,35601,35569,35569,35601,35569,35601,35698,35763,35763,35763,35763,35763,35763,35763,35763,35763,35796,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35797},
-	{35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35731,35699,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35731,35732,35732,35732,35732,35732,35764,35796,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35764,35699,35667,37715,37651,37651,37651,37651,37651,37651,37651,37651,35635,37683,35603,35603,35603,35603,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35601,35601,35601,35601,35601,35601,35601,35601,35601,35601,35601,35601,35601,35600,35600,35601,35536,35406,35373,35373,37421,37421,37421,37421,37421,37421,37421,37421,35373,37421,35373,35373,35373,35373,35373,35536,35600,35600,35600,35600,35600,35600,35600,35600,35600,35600,35601,35601,35601,35503,35406,35406,35406,35406,35406,35406,37486,37486,37486,35438,35601,35601,35601,35601,35601,35601,35633,35633,35633,35633,35633,35633,35633,35633,35633,35633,35601,35633,35633,35503,35406,35438,37486,37486,37486,37486,37486,35438,37486,37486,35438,35438,37486,35406,35405,35373,35405,35405,35373,35373,35374,35373,35438,35698,35762,35762,35730,35762,35762,35762,35762,35762,35762,35665,35601,35601,35568,35406,35373,35373,35406,35600,35633,35633,35730,35730,35762,35762,35730,35665,35568,35568,35601,35665,35730,35762,33714,35762,35730,35730,35730,35762,35762,35762,35730,35730,35697,35730,35762,35762,35762,35762,35762,35762,35730,35730,35730,35730,35730,35730,35730,33682,35730,33682,33682,33682,33682,35730,35730,35730,35730,35730,35730,35730,35730,35730,35698,35600,35568,35568,35568,35568,35568,35569,35569,35568,35601,35569,35569,35601,35569,35633,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35764,35796,35796,35796,35796,35796,35796,35796,35764,35764,35796,35796,35796,35796,35796,35797,35797},
-	{35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35699,35602,35699,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35732,35667,35603,35603,37651,35603,35603,35635,35732,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35764,35764,35764,35667,37651,37651,37651,37651,37651,37651,37651,37651,37651,37683,37683,37683,37651,37651,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35602,35601,35601,35601,35601,35601,35601,35601,35601,35601,35601,35601,35601,35600,35601,35568,35438,35373,35373,35373,37421,37421,37421,37421,37421,37421,37421,35373,35373,35373,35470,35503,35373,35406,35471,35568,35600,35600,35600,35600,35600,35600,35600,35600,35600,35601,35601,35601,35601,35600,35439,35406,35406,35406,35406,35406,37486,37486,37486,35503,35601,35601,35601,35601,35601,35601,35633,35633,35633,35633,35633,35633,35633,35633,35633,35633,35601,35633,35600,35470,37454,35438,37486,35438,35438,37486,37486,35438,37486,37486,37486,35438,37486,35406,35405,35405,35373,35373,35373,35373,35373,35373,35373,35503,35730,35762,35730,35762,35762,35762,35762,35762,35762,35536,35373,35470,35503,35373,35406,35503,35536,35697,35762,35762,33714,35762,35762,35730,35665,35600,35568,35601,33682,33714,35730,35762,35730,35730,35762,35762,35762,35762,35730,35730,35762,35730,35730,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,33682,33682,33682,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35633,35568,35568,35568,35568,35568,35569,35568,35568,35568,35569,35569,35569,35569,35633,35698,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35796,35764,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35764,35796,35764,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35764,35765,35796,35797,35796},
-	{35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35699,35602,35602,35731,35764,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35635,35602,35603,35667,35699,35699,35699,35699,35699,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35764,35764,35764,35732,37683,37651,37651,37651,37651,35635,35700,35667,35603,37651,35635,37651,35603,35603,35667,35699,35699,35699,35699,35699,35634,35602,35602,35602,35602,35602,35601,35601,35601,35601,35601,35601,35601,35601,35601,35601,35601,35601,35536,35438,35373,35373,35373,37421,37421,37421,37421,37421,37421,37421,37421,35373,35471,35568,35665,35698,35568,35471,35568,35600,35600,35600,35600,35600,35600,35600,35600,35601,35600,35601,35601,35601,35601,35601,35568,35503,35503,35438,35406,37454,37486,37486,37486,35568,35601,35601,35601,35601,35601,35601,35601,35633,35633,35633,35633,35633,35633,35633,35633,35633,35601,35633,35536,35406,35406,35406,37486,37486,37486,37486,37486,37486,35438,35438,35438,35438,37486,35406,35406,35373,35406,35503,35503,35503,35503,35503,35503,35438,35568,35730,35762,35730,35762,35762,35762,35762,35762,35536,35406,35633,35698,35568,35600,35730,33714,35730,35762,35762,35730,35665,35665,35633,35568,35568,35601,35698,33714,35762,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,33682,35697,35568,35568,35568,35568,35568,35569,35568,35601,35666,35633,35601,35569,35569,35601,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35764,35764,35764,35765,35796,35796,35797},
-	{35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35699,35602,35602,35699,35764,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35699,35699,35699,35764,35764,35764,35764,35764,35732,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35764,35764,35764,35764,35732,37683,37651,37651,37683,35732,35796,35764,35667,37651,37651,35603,35635,35699,35764,35796,35796,35796,35796,35796,35731,35634,35602,35602,35602,35602,35602,35602,35601,35601,35601,35601,35601,35601,35601,35601,35601,35568,35406,35373,35373,37422,37422,37421,37421,37421,37421,37421,37421,35373,35373,35438,35665,35762,35762,35762,35730,35665,35665,35601,35600,35600,35601,35601,35601,35601,35601,35601,35600,35601,35601,35601,35601,35601,35601,35601,35601,35471,37454,37454,37487,37486,37487,35568,35601,35601,35601,35601,35601,35601,35601,35633,35633,35633,35633,35633,35633,35633,35633,35633,35601,35601,35503,37454,35406,35406,37486,37486,37486,35438,35438,35438,35438,37486,37486,35438,37486,35406,35406,35471,35536,35600,35600,35600,35600,35600,35600,35536,35536,35698,35762,35730,35762,35762,35762,35762,35762,35568,35568,35730,35762,35762,35762,35762,35762,35730,35730,35698,35633,35600,35568,35568,35600,35600,35665,35730,35730,35730,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,33682,33682,35730,35633,35568,35568,35568,35568,35568,35569,35633,35698,35763,35730,35633,35569,35569,35633,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35764,35764,35796,35796,35796,35796,35796,35796,35764,35796,35764,35764,35764,35765,35765,35797,35797,35797},
-	{35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35699,35602,35602,35699,35764,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35764,35764,35764,35796,35764,37715,37683,37683,35700,35796,35796,35796,35732,37683,37651,35667,35732,35796,35796,35796,35796,35796,35796,35796,35764,35699,35602,35602,35602,35602,35602,35602,35601,35601,35601,35601,35601,35601,35601,35601,35504,35438,35374,37422,35373,37422,37422,37421,35373,35405,35405,35373,35405,37518,37681,35698,35730,35730,35730,35730,35762,35762,35762,35697,35601,35601,35601,35600,35601,35601,35601,35600,35601,35601,35601,35633,37778,37714,35601,35601,35601,35471,37454,37454,37487,37487,37487,35536,35601,35601,35601,35601,35601,35601,35633,35633,35633,35633,35633,35633,35633,35633,35633,35601,35568,35471,37486,37454,35406,35406,37486,37486,35438,37486,39631,39631,37486,35438,37486,35438,37486,35438,35503,35568,35601,35601,35600,35600,35600,35600,35600,35600,35600,35633,35730,35762,35762,35762,35762,35762,35697,35568,35730,35762,35762,35762,35762,35762,35762,35730,35665,35601,35568,35568,35568,35568,35601,35698,35730,35762,37907,35827,35762,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,35730,33682,35665,35568,35568,35568,35568,35568,35569,35666,35730,35762,35763,37876,37876,37843,37843,37843,35763,35763,35828,37908,37908,37908,37908,37908,35796,35763,35763,35764,35796,37909,37909,37909,35796,35796,35796,35796,35796,37909,39989,39989,37909,37844,35764,37877,37941,37941,39989,39989,39989,39989,37877,35764,35796,35764,35764,35765,35765,35764,35797,35797,35796,35796},
-	{35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35731,35634,35602,35602,35667,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35764,35732,35732,35764,35796,35796,35796,35764,35635,35635,35764,35796,35796,35796,35796,35796,35796,35796,35764,35796,35764,35666,35602,35602,35602,35602,35602,35601,35601,35601,35601,35601,35601,35601,35601,35471,37454,37422,37422,35374,37421,37422,37421,35406,35601,35633,35503,35633,48471,61245,46391,33682,35730,35730,35730,35730,35762,35762,35730,35601,35600,35601,35601,35601,35601,35601,35600,35601,35601,35601,46262,61245,50552,35601,35601,35601,35471,37454,37454,37487,37487,37487,35471,35601,35601,35601,35601,35601,35601,35633,35633,35633,35633,35633,35633,35633,35633,35601,35503,35471,35439,37486,35438,35406,35406,37486,37486,35406,39632,56954,56955,39664,35406,37486,35438,35471,35568,35600,35601,35601,35600,35600,35600,35600,35600,35601,35601,35601,35665,35730,35762,35762,35762,35762,35762,35730,35698,35762,35762,35762,35762,35762,35762,35730,35730,35633,35568,35600,35600,35600,35601,35698,35762,33682,42133,59197,52794,35763,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,35730,35730,35730,35730,35730,35730,33682,35730,35730,35730,35698,35600,35568,35568,35568,35568,35568,35601,35730,35762,35730,37875,56987,61277,61277,61277,57052,37908,35731,48536,61277,61277,61277,61277,61277,46359,35763,35763,35764,42134,59165,61277,54875,35796,35796,35796,35796,37877,54907,61277,61277,59165,40054,35764,46424,61277,61277,61277,61277,61277,61277,48505,35764,35764,35764,35764,35765,35765,35796,35796,35796,35796,35796},
-	{35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35731,35666,35602,35602,35602,35602,35634,35699,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35764,35764,35765,35765,35765,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35764,35796,35764,35700,35732,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35764,35667,35602,35602,35602,35602,35602,35602,35602,35601,35601,35601,35601,35601,35601,35569,35568,35471,37422,37422,37421,37422,35373,35536,35730,35762,35730,35730,52761,65535,48504,33682,35730,35730,35730,35730,35762,35762,35730,35665,35600,35600,35601,35601,35600,35601,35601,35601,35601,35569,48406,65535,52729,35601,35601,35601,35471,37454,37454,37487,37487,37487,35536,35601,35601,35601,35601,35601,35601,35633,35633,35633,35633,35633,35633,35633,35633,35568,35536,35568,35601,35601,35568,35438,35406,37486,37486,35406,39664,61245,61277,39696,35406,37486,37486,35471,35600,35600,35601,35600,35600,35600,35600,35601,35600,35600,35600,35633,35730,35762,35762,35730,35762,35762,35730,35762,35762,35730,35762,35762,35730,35730,35730,35762,35665,35601,35600,35600,35568,35633,35698,35730,35730,33682,42166,65503,57019,35763,35730,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35762,35730,33682,35730,35730,35730,35730,33682,33682,35730,35698,35633,35600,35568,35568,35568,35568,35568,35568,35665,35730,35730,35795,50681,61310,50649,46424,48568,61310,52794,37876,50681,65535,54939,46424,48504,59132,59132,42166,35763,40021,54939,61245,52794,61310,48537,35796,35796,35796,50617,61310,52730,48537,61277,54907,39989,48537,65535,57052,48505,48505,48505,48505,42134,35764,35764,35765,35765,35764,35764,35797,35796,35796,35796,35796},
-	{35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35699,35602,35602,35602,35602,35602,35602,35602,35731,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35764,35764,35765,35765,35764,35764,35765,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35764,35796,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35764,35667,37650,35602,35602,35602,35602,35602,35602,35601,35601,35601,35601,35601,35601,35601,35601,35471,37422,37422,35374,35373,35373,35568,35730,35730,35762,35730,52729,65535,48503,33682,35730,35730,35730,35730,35730,35730,35730,35730,35633,35600,35600,35600,35600,35601,35601,35601,35601,35569,46326,65535,52729,35601,35601,35601,35504,35439,35439,37519,37519,35504,35601,35601,35601,35601,35601,35601,35601,35601,35633,35633,35633,35633,35601,35601,35601,35601,35601,35633,35633,35633,35568,35438,35406,35406,35438,35406,39664,61245,61277,39696,35406,37486,35438,35503,35600,35600,35600,35600,35600,35600,35600,35600,35601,35633,35601,35633,35730,35763,35762,35730,35762,35730,35730,35730,35730,35730,35730,35730,35762,35730,35730,33682,35633,35568,35568,35568,35601,35698,35762,33682,35730,33682,42166,65503,57019,35763,35730,35762,35762,35730,33682,35730,35730,35730,35730,35730,35730,35762,35730,35730,35730,35730,35730,35730,35730,35762,35730,35730,35730,35730,35730,35730,35730,35730,33682,33682,33682,33682,33682,35698,35698,35633,35600,35568,35568,35568,35568,35568,35568,35568,35601,35730,35762,35730,37875,59197,63390,40020,33650,35795,52794,52794,37876,50681,65535,48536,33683,35731,52794,65535,46424,37876,50617,63390,50649,42134,57084,59165,44247,35796,44279,61245,57052,40022,35796,52730,54907,39989,48537,65535,50682,35764,35764,35764,35764,35764,35764,35764,35765,35765,35765,35797,35797,35796,35796,35796,35796},
-	{35763,35763,35763,35763,35763,35763,35763,35763,35763,35731,35602,35602,35602,35602,35602,35602,35602,35602,35635,35699,35764,35764,35764,35764,35764,35764,35764,35764,37845,37909,37877,35764,35796,37877,35731,33585,33585,35731,35796,35796,35796,35796,35731,33585,33585,33585,35731,39957,37877,35797,35797,35765,35765,35764,35765,35765,35765,35765,35764,35764,35796,35764,35796,35796,35796,35796,35796,35796,35764,35796,35796,35764,35764,35764,35796,35796,35796,35796,35796,35764,35796,35764,35667,37650,35602,35602,35602,35602,35602,35602,35601,35602,35601,37714,39859,39827,39827,39859,37616,37422,37422,37422,39599,39631,39826,37940,37908,35762,33682,52761,65535,48504,33682,35730,35763,37908,37908,37908,37908,37908,35763,35730,35633,37746,39858,39826,39826,39826,35633,35601,35633,48471,65535,54842,39859,37746,35601,35601,35601,35601,35601,37681,39858,39859,39859,39859,37778,35601,35601,35601,35601,35633,35601,35633,37778,39859,39859,39859,39858,37713,35601,35633,37713,39826,39729,39696,39696,37551,35406,39664,61245,61277,39696,35406,35406,37551,39826,39858,39826,39826,37713,35633,35665,37778,37778,35730,37908,37908,37811,35730,35763,35762,35730,35730,35763,37908,37908,37908,37908,37908,35763,35730,35795,37908,37843,37778,37810,37810,35697,35666,35730,35763,37908,37908,37908,46359,65535,57019,35763,35730,35762,35730,35762,37875,37908,37908,37908,37908,37908,35763,35730,35795,37908,35827,35795,37908,37908,35827,35730,35762,37907,37908,37908,37908,37907,35762,35730,35730,35827,37908,37908,37908,37843,35633,35568,35568,35633,37778,37778,37778,37778,37713,35568,35568,35666,35762,35730,35827,57052,63390,42198,37908,37940,37908,35795,35763,50681,65535,50649,37908,37941,54907,63422,46359,42134,63455,59132,37876,35764,44279,65535,57020,37909,57052,65503,44247,35764,35796,35796,35796,35764,48537,65535,52794,39989,39990,37877,35764,35764,35764,35765,35765,35797,35797,35797,35796,35796,35796,35764,35764},
-	{35763,35763,35763,35763,35763,35763,35763,35763,35731,35634,35602,35602,35602,35602,35602,35602,35602,35602,35602,35635,35764,35764,35764,35764,35764,35764,35764,35764,46424,61277,42295,31603,42102,59132,52728,29260,27147,31407,33553,33553,33553,33553,31407,29195,29195,29163,37809,61245,50649,33553,33553,33585,35764,35765,35764,35765,35765,35765,35765,35700,35732,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35764,35699,35634,35602,35634,35634,35602,35602,35602,35602,35602,35601,44181,61277,61277,61277,61277,52535,37422,35374,39599,56954,61245,61277,61309,57052,37908,33682,52761,65535,48504,33682,33682,40021,59165,61277,61277,61309,54907,35795,35763,35730,54810,61277,61277,61277,61213,42004,35569,46262,63390,65535,63422,61277,50552,35601,35601,35601,35601,35601,39923,59132,61277,61277,61277,54874,37714,35601,35601,35633,35633,35601,35633,54810,61277,61277,61277,61245,42036,35601,35601,46294,61277,61277,61245,61277,50454,35406,39664,61245,61277,39696,35406,35406,50422,61277,61277,61277,61277,46294,35665,40053,61245,54906,42166,59197,61309,54842,35730,35762,35762,35762,35730,35827,57019,61309,61277,61277,59132,37940,33682,48536,61309,61245,61245,61277,61277,46391,33682,35730,40053,59197,61277,61277,63358,65535,57019,35763,35730,35730,35730,35730,54874,61310,61277,61277,61277,59197,40053,33682,46391,61310,50616,46423,61309,61309,48536,33682,37940,59132,61277,61277,61309,57019,35827,33682,35762,52761,61309,61277,61277,61245,42036,35568,35568,44148,61245,61277,61277,61277,50584,35568,35568,35666,35762,35730,35763,40053,61245,61310,61277,61309,59132,37940,35731,50681,65535,63390,61277,61277,63422,50617,35796,42166,65503,59132,37876,35764,44279,65535,57020,37909,59132,65503,42167,35764,35764,35764,35764,35764,48537,65535,63422,61277,61310,48537,35764,35764,35764,35765,35765,35765,35797,35797,35764,35764,35764,35764,35764},
-	{35763,35763,35763,35763,35763,35763,35763,35763,35699,35602,35602,35602,35602,35602,35602,35602,35602,37650,35602,35699,35764,35764,35764,35764,35764,35764,35764,35764,50617,65535,36085,14957,29651,63422,57019,29260,29163,29195,29195,29195,29195,29195,29195,29195,29163,27115,39889,65535,52760,29195,29195,29260,35731,35765,35764,35765,35765,35764,35765,35699,35700,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35764,35764,35796,35796,35796,35796,35764,35699,35602,35602,35634,35602,35602,35602,35602,35601,42004,59100,59100,46294,46294,46229,41809,35406,37584,52632,61277,48407,46294,48504,61309,52794,35795,52729,65535,48504,33682,37908,54939,61277,46423,46359,50649,61310,50649,35795,48536,61310,52665,46294,46326,61213,56987,39891,39859,54810,65535,57019,46294,42004,35601,35601,35601,35601,35601,37746,46262,46294,46262,50584,63358,50584,35633,35601,35601,35633,35633,48471,61309,50519,46196,46326,61213,57019,39891,42036,59132,57019,46326,46294,54777,61245,46164,39664,61245,61277,39696,35406,46132,61212,54874,46294,46294,56987,59132,42133,42133,63422,63422,52794,46423,46391,42198,35763,35762,35763,35763,35763,35795,44246,46391,46359,46456,61309,54874,35827,50617,65535,54906,46391,46391,57052,59165,42166,37940,56987,61245,46423,46391,50681,65535,57019,35763,35730,35763,35698,35665,56987,65535,50681,46391,46423,61245,54939,37908,46423,65535,61277,50681,46391,46391,40053,37875,54874,61277,46455,44310,48536,61310,50681,35795,48504,61310,52762,44311,46326,46261,37746,35568,41971,59100,59100,46261,46261,46261,42003,35568,35568,35665,35762,35762,35730,35763,44278,46391,46391,48504,61309,54874,37876,50681,65535,54907,46391,46424,46392,40021,35763,42166,63455,63390,54939,54907,59132,65535,57020,37909,59132,65503,42167,35764,35796,35764,35796,35764,48537,65535,57020,46424,46424,42134,35764,35764,35765,35797,35765,35765,35797,35765,35764,35764,35764,35764,35764},
-	{35763,35763,35763,35763,35763,35763,35763,35731,35634,35602,35667,35667,35667,35667,35667,35667,35602,35602,35634,35731,35764,35764,35764,35764,35764,35764,35764,35699,42036,48665,25585,2473,15086,61342,57019,29260,27115,27147,27147,27115,27115,27115,27115,27115,27147,27115,39889,65535,52728,29195,29163,29228,35699,35797,35765,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35764,39989,46359,42166,35796,35796,35796,35796,35796,35764,35666,35602,35602,35634,35602,35602,35602,35601,42004,59100,59100,46294,46294,46262,41842,35504,37746,61245,63422,48471,46326,48536,63422,61277,37908,50681,65535,48504,33682,40053,63422,61309,46423,46391,50649,65535,57052,35827,57019,65535,44149,35569,35601,50519,54810,39891,35569,46326,65535,52697,35569,35601,35601,35601,35601,35601,35601,37746,46262,46326,46294,50584,65503,59068,37714,35601,35601,35633,35633,56955,65535,41938,33325,35568,50519,54810,39891,46294,65535,54809,35601,35536,48342,65535,52567,39664,61245,61277,39696,35406,50519,65535,48471,35568,35568,52697,65535,46423,40085,63422,63422,50649,35763,33682,35730,35763,35763,35763,35763,35763,35763,44278,46391,46391,48504,63390,61310,37875,50584,65535,48536,33650,33682,52762,65535,46423,40053,63454,59132,35795,33650,42166,65503,57019,35763,35730,35763,35666,35601,56987,65503,42166,33650,35795,59132,63422,40053,46423,65535,61277,46391,33682,33682,33682,37940,61310,63390,48504,46391,48568,63455,59164,35827,46423,61309,52794,46391,46358,46261,37745,35536,41971,59099,59100,46294,46294,46294,42003,35568,35665,35730,35730,35730,35730,35730,33682,33682,33682,37908,61309,61310,37940,50681,65535,48536,33683,35763,35763,35763,35763,42166,63455,63390,54907,54907,57052,65535,57020,37909,59132,65503,42166,35764,35764,35764,35764,35764,48537,65535,52730,35764,35764,35764,35764,35765,35765,35765,35765,35797,35797,35765,35765,35765,35765,35765,35765},
-	{35763,35763,35763,35763,35763,35763,35763,35731,35699,35699,35764,35764,35796,37909,39957,39957,39924,37812,35731,35764,37909,37909,37844,37909,37844,37909,37909,31375,23052,12941,8747,4554,21360,63422,59099,25294,16972,14827,14826,16972,19085,19085,19085,19053,14859,14794,37841,65535,54841,33453,33421,33453,35665,35764,35764,35764,39957,39990,39990,39990,37910,35797,35764,35764,37877,39989,39989,39989,39989,37877,35764,35796,35796,35796,35764,44279,65503,54939,35796,35796,35796,35796,35796,35796,35732,35634,35602,35602,35634,35602,35602,35602,35601,44182,61245,61245,61245,63390,54842,37714,37746,61245,65535,61277,61277,61277,61277,57052,37875,52729,65535,48504,33682,40053,63422,65503,61277,61277,61277,61309,54906,35795,57019,65535,44149,35601,35601,39859,39891,37714,35601,48407,65535,52729,35601,35601,35601,35601,35601,35601,35634,44181,63390,61277,61245,61309,65535,57020,37714,35601,35633,35633,35633,56955,65535,43987,33293,35536,39859,39891,35633,46294,65535,54810,35601,35569,48342,65535,52632,39762,61277,61277,39664,35471,50584,65535,50519,35601,35601,52697,65535,46423,42101,63454,59132,35795,35763,35763,35763,35763,35763,35763,35763,35763,40053,61245,61310,61277,61277,65503,61309,37875,50616,65535,48536,33682,35730,52762,65535,46423,40053,63422,59132,35795,33682,42166,65503,57019,35763,35730,35730,35698,35633,56987,65503,42198,33682,35795,59132,63422,40053,46423,65535,52762,35730,35730,35762,33682,37940,61310,65503,61277,61277,61277,61277,54939,35795,35730,52729,61277,61277,61277,63422,46326,35601,35568,44148,61245,61245,61245,63390,54906,37843,35730,35730,35762,35730,35763,37940,39988,35795,35731,37908,61309,61310,37940,50681,65535,48536,35763,35763,35763,35763,35763,42166,65503,59132,37876,35764,44279,65535,57020,37877,54907,63422,46392,37844,35796,39989,40022,35796,48537,65535,52730,35764,35764,35764,35764,35764,35765,35765,35797,35797,35765,35765,35765,35765,35765,35765,35765},
-	{35731,35731,35731,35731,35763,35763,35731,35763,35763,35764,35764,35731,44279,61277,61277,61277,61310,50649,35764,37877,57052,59132,40086,54875,40086,57084,57020,27246,31762,57148,29811,12973,55003,65535,63454,57148,46552,21036,18955,42294,57116,55068,57116,55036,21360,4522,27569,65503,63422,59164,61212,61244,48471,29326,31342,33487,56955,61310,61277,61278,59132,39990,35764,35764,50617,61310,61277,61277,61277,46392,35764,35796,35796,35796,35764,44279,65535,56987,35796,35764,35796,35796,35796,35796,35764,35634,35602,35602,35634,35634,35602,35602,35602,37714,39859,39859,39827,50520,65503,50584,37746,61213,63390,44116,39859,37908,37940,37908,35763,50681,65535,48504,33682,40053,63390,59197,40053,37940,37940,37940,37876,35795,54939,65503,44181,35601,37714,54906,61245,42004,35569,46326,65535,52729,35633,35633,35601,35601,35633,35601,39924,61245,59165,41972,39859,46262,65503,57020,37714,35601,35633,35633,35633,54874,65503,44019,33325,35569,54874,61277,42004,46294,65535,54810,35633,35601,48439,65535,52664,39826,61277,61277,39761,35569,50584,65535,50519,35601,35633,52729,65535,46423,40053,63454,59132,35795,35763,35763,35763,35763,35763,35763,35763,35827,57019,63390,44246,37908,42036,61277,63358,39956,50649,65535,48536,33682,35730,52762,65535,46423,40053,63422,59132,35827,35730,42198,65503,57019,35698,35633,35633,35633,35730,57019,65503,44246,35730,35827,59132,63422,40053,46423,65535,52762,35730,35730,35762,33682,37940,61310,61309,42133,37908,37940,37940,37875,35762,35762,37875,37940,37908,37940,57019,63358,42036,35568,35633,39826,39826,37778,48471,65503,50681,35730,35730,35762,35730,35827,57052,59197,40021,35763,37940,61309,61309,37940,50681,65535,48536,35763,35763,35763,35763,35763,42166,65503,59132,37876,35764,44279,65535,57020,37844,39989,59132,61310,42134,37909,57052,61245,40022,48537,65535,52762,35796,37845,37845,37845,35797,35764,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765},
-	{35731,35731,35731,35731,35731,35763,35763,35731,35763,35764,35731,42134,59132,59132,46424,46392,46424,42134,35764,37909,61277,59229,25521,50778,23441,59229,57148,12876,31892,65535,36085,8715,33972,63454,57148,29811,23440,10731,33842,59196,42391,27666,27698,52923,50810,15054,23440,65535,52923,29747,37939,48567,61244,35890,25132,48438,61277,46292,44148,48472,61310,54875,37909,46392,61277,54907,46424,46424,46424,40022,35764,35796,35796,35796,35764,39989,46424,44247,35796,35764,35796,35796,35796,35796,35764,35634,35602,35602,35602,35602,35602,35602,42037,56955,56955,56955,56955,61213,57019,41972,35633,46262,61277,57019,56955,57019,52794,37876,35730,40053,57019,61277,44246,35795,48504,61310,57019,57019,57019,50681,35795,35763,42166,59164,59132,56955,56987,63358,50520,37746,35601,39859,52729,61277,56987,48407,35601,35601,35633,35601,37746,48439,63358,56987,56955,59100,65535,59068,37714,35601,35633,35633,35633,42036,59100,59099,54842,56955,63358,50519,37746,39827,52729,61309,56955,56955,61245,56987,41971,37713,46294,61277,54842,37746,39891,56954,61245,56955,56955,61277,52794,37908,42133,63454,59132,35795,35763,35763,35763,35763,35763,35763,35763,35763,44278,61277,57084,56987,56987,63422,61310,37940,50649,65535,48568,35730,35731,52762,65535,46423,35795,48536,63390,57019,57019,59132,65535,56987,35633,35600,35601,35601,35730,57019,65535,59132,57019,57019,63358,48536,35795,46423,65535,52762,35730,35730,35762,35730,35795,46423,61310,57051,56987,57019,52761,35795,35730,48536,57019,56987,56987,57019,61310,50584,37713,42003,56954,56954,56954,56954,59164,57052,40053,35730,35730,35730,35730,35763,44311,61277,59132,57019,57052,61310,46391,35795,50681,65535,48536,35763,35763,35763,35763,35763,42166,65503,59132,37876,35764,44279,65535,57020,37844,35796,44279,61245,59165,57052,63390,48537,37877,48537,65535,61278,57020,57020,57020,57020,46392,35764,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765},
-	{35763,35731,35731,35731,35763,35763,35763,35731,35763,35764,35731,42134,59164,59132,46392,46391,46392,42102,35732,37909,61277,59229,19279,48729,19279,59197,57116,8780,31892,65535,36085,2474,15086,61342,52890,6667,4522,4554,42391,65535,25585,2442,4554,31859,44504,15086,23441,65535,46584,4555,6538,27634,65535,42391,12876,57051,63422,44212,42002,46261,63357,61310,37876,46359,61278,54907,46392,46392,46392,40022,35764,35796,35796,35796,35796,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35731,35634,35602,35634,35634,35634,35602,42005,52730,54778,54778,54778,54810,46262,35601,35601,37714,50552,54777,52729,54810,50649,37875,35762,35730,44311,52794,42166,33682,37908,52729,52794,52794,52826,48536,35795,35763,35763,48471,54810,54778,54778,52697,39859,35601,35601,35601,42036,52729,54810,46262,35601,35601,35633,35633,35601,39827,52697,54810,54810,54778,52730,48439,37682,35569,35569,35569,35569,35569,46229,52632,52632,52729,52664,37648,35536,35537,42036,52762,52762,52762,52794,46262,35601,35601,37746,50584,50616,37746,35569,44181,54777,52762,52794,52794,42166,33682,37940,52762,48536,35795,35763,35763,35763,35763,35763,35763,35763,35763,35795,48569,52794,52794,52794,52794,50649,37876,44278,52794,44246,35731,35763,46359,52794,42166,33682,37940,52762,52794,52794,52762,52729,48407,35601,35601,35601,35601,35730,57019,65535,57019,52794,52794,52762,37940,33682,42165,52794,44311,35730,35730,35763,35763,35730,37875,50681,52794,52794,52794,50616,35795,35730,46423,52826,52794,52794,52794,52762,39891,35536,41971,52729,52729,52761,52762,52794,46391,33682,35730,35762,35730,35763,35763,35795,50617,52794,52794,52794,50649,37876,35763,44311,52794,44246,35763,35763,35763,35763,35764,40021,52762,48537,35796,35764,40054,52794,48505,35796,35764,35796,48537,54875,54875,52762,39989,35764,44247,52795,52795,54843,54875,54875,54875,44279,35764,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765},
-	{35763,35731,35731,35731,35763,35763,35763,35763,35763,35764,35763,35731,44279,61277,61277,61277,63422,54907,37876,37909,61277,59229,19279,48729,19279,59197,57116,10828,31892,65535,36085,2474,17134,63390,52922,8747,4554,4554,42391,65535,25585,4522,4554,10860,12973,6635,23473,65535,46584,6635,4522,27666,65535,42391,14924,57051,65535,59197,57116,57116,61244,56986,33454,33553,50650,61310,61278,61278,63422,50617,37877,35764,35796,35796,35764,37877,40022,37909,35796,35764,35764,35796,35796,35796,35796,35796,35699,35634,35634,35699,35699,35634,35602,35602,35602,35601,35601,35601,35601,35601,35601,35601,35601,35601,35601,35633,35731,35763,35763,35763,35762,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35633,35601,35601,35601,35633,35634,35633,35601,35601,35601,35601,35601,35601,35601,35601,35633,35601,35633,35633,35601,35601,35601,35601,35601,35601,35601,33358,33390,35471,33325,35504,33326,33293,33293,35471,35471,33325,35504,33358,35666,35763,35763,35763,35763,35698,35601,35601,35601,35601,35601,35601,35601,35601,35601,35698,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35731,35731,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35698,35601,35601,35601,35601,35601,35601,35666,35763,57019,65503,42198,33682,35763,35763,35763,35763,35730,35730,35730,35763,35763,35730,35731,35762,35730,35730,35730,35730,35730,35730,35730,35762,35730,35730,35730,35730,35730,35730,35633,35568,35568,35568,35601,33617,35730,35730,35730,35762,35762,35762,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35796,35796,35796,35796,35764,35764,35796,35796,35764,35796,35796,35764,35764,35796,35764,35764,35764,35764,35764,35764,35764,35764,35765,35765,35765,35765,35765,35765,35765,35765,35764,35764,35764},
-	{35763,35731,35731,35731,35763,35763,35763,35731,35763,35764,35763,35763,37844,39989,39989,39989,50617,65503,50649,35796,57116,59229,21360,48697,21359,59197,57116,10828,31892,65535,36085,2474,17134,61342,52923,8748,4554,4554,42391,65535,27666,4554,6635,42359,57148,19279,21392,65535,46584,6635,4522,27666,65535,42391,10828,55003,61342,21360,19085,19117,25261,29357,31243,33455,37779,39957,40022,40022,54907,63422,46392,35764,35796,35796,35764,44247,61310,54875,35796,35764,35764,35796,35796,35796,35796,35796,35764,35667,35634,35634,35667,35699,35667,35634,35602,35602,35602,35601,35601,35601,35601,35601,35601,35601,35601,35633,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35633,35601,35633,35698,35763,35763,35698,35634,35601,35602,35601,35602,35601,35634,35634,35601,35633,35634,35634,35633,35634,35601,35601,35602,35634,35601,33358,33358,35439,33293,35439,35374,33293,33293,33293,33325,33326,35504,33358,35698,35763,35763,35763,35763,35763,35666,35601,35601,35633,35601,35601,35601,35601,35666,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35731,35698,35633,35601,35601,35601,35601,35633,35730,35763,35795,57020,65503,42198,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35762,35730,35762,35762,35762,35762,35762,35762,35762,35730,35730,35730,35762,35762,35698,35600,35568,35600,35698,35730,35730,35730,35730,35762,35762,35762,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35764,35764,35796,35796,35796,35796,35796,35764,35796,35764,35764,35765,35764,35764,35764,35764,35765,35765,35765,35765,35765,35765,35765,35764,35764,35764,35764,35764},
-	{35763,35731,35731,35731,35763,35763,35763,35763,35763,35764,35731,42166,54939,54939,54939,54939,59197,57052,42134,31602,27666,57148,46617,29779,46584,57148,27634,6602,31892,65535,36085,4522,8747,31892,59229,48697,36117,6635,17167,50810,52955,46584,46617,59229,38198,8780,23441,65535,46584,6635,4522,27666,65535,42391,6635,25553,57116,50778,52729,48665,42359,29293,29163,44082,54841,54907,56988,56988,61310,54875,39990,35764,35796,35796,35764,44279,65535,56987,35796,35764,35764,35796,35796,35796,35796,35796,35796,35731,35602,37651,35602,35634,35731,35731,35634,35602,35602,35601,35601,35601,35601,35601,35601,35601,35601,35633,35763,35763,35763,35763,35763,35731,35731,35731,35763,35763,35763,35763,35763,35763,35763,35763,35763,35666,35601,35666,35763,35763,35763,35763,35731,35634,35601,35602,35633,35633,35601,35634,35602,35634,35634,35634,35634,35634,35601,35601,35601,35602,35601,33358,33294,33326,33293,33293,33293,33293,33293,33293,33293,33293,33326,33358,35698,35763,35763,35763,35763,35763,35731,35633,35601,35601,35601,35601,35601,35601,35665,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35698,35601,35601,35601,35601,35601,35601,35666,35763,35763,35795,57020,65503,42198,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35762,35730,35730,35762,35730,35762,35730,35665,35633,35600,35600,35600,35698,35730,35730,35730,35762,35730,33682,33682,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35796,35764,35796,35796,35796,35796,35796,35796,35764,35796,35764,35796,35796,35796,35796,35796,35764,35796,35764,35764,35764,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35764,35764,35764,35764,35764},
-	{35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35731,42134,54875,54875,54875,54875,54875,46392,35764,29490,8747,36085,38198,12973,38197,36117,8715,4522,21360,42391,23473,4554,4522,10893,40278,42423,33972,6635,4522,27666,42423,42391,42391,40311,15054,2474,15086,42391,29779,6603,4522,19247,42391,27666,4554,6667,36085,42423,42391,42423,40246,21100,16875,31729,50616,52663,52663,52664,54842,42167,35764,35796,35764,35796,35764,42102,54875,48505,35796,35764,35764,35796,35796,35796,35796,35796,35796,35764,35699,35634,35602,35602,37812,42134,39989,35666,35602,35602,35601,35601,35601,35601,35601,35633,35633,35633,35763,35763,35763,35763,35763,39988,42166,42166,37908,35763,35763,35763,35763,35763,35763,35763,35763,35763,35698,35731,35763,35763,35763,35763,35763,35698,35633,35601,37714,37681,35601,35634,35633,35634,35634,35634,35634,35602,37714,42037,42004,35634,35602,35504,37616,41841,35438,33293,33293,33293,33293,33293,33293,33293,33293,35504,35763,35763,35763,35763,35763,35763,35763,35666,35601,37714,42004,42004,37682,35601,35633,39988,42166,37908,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35730,35601,35601,35601,35601,35601,35601,35601,35666,35763,35763,35763,46424,50681,40020,35731,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35698,35666,35666,35666,35666,35730,35763,35762,35762,35762,35698,35633,35600,35568,35600,35600,35568,35633,35730,35730,35730,35730,35763,40053,42133,35795,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35796,35796,35796,35796,35796,35796,35764,35796,35796,35764,35796,35796,35796,35796,35796,35764,35764,35765,35765,35797,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35764,35764,35764,35764,35764},
-	{35763,35763,35763,35763,35763,35763,35763,35763,35731,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,29522,6634,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4555,4554,4555,4555,4554,4555,4555,4555,4554,4554,4554,4555,4554,4554,4554,4554,4554,4554,6602,6602,6602,18923,29195,29195,29228,35699,35764,35698,31407,31407,31407,31407,31407,31406,31407,33520,35764,35796,35796,35764,35796,35796,35796,35796,35796,35796,35731,35731,35667,46262,63422,54875,35764,35699,35634,35602,35601,35601,35601,35601,35666,35731,35698,35763,35763,35763,35763,35795,52794,63422,61310,46391,35731,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35666,35634,37713,37713,35602,35633,35633,35634,35634,35634,35634,35601,41972,63358,59100,37746,35602,37682,54842,63390,41906,33261,33293,33293,33293,33293,33293,33293,33391,35699,35763,35763,35763,35763,35763,35763,35763,35666,35601,39859,61245,61245,39859,35601,35601,52729,65503,46391,35731,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35731,35634,35601,35601,35601,35601,35601,35601,35601,35666,35763,35763,35763,35763,35731,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35730,35666,35698,35633,35569,35601,35569,35601,35633,35665,35730,35763,35763,35633,35568,35568,35600,35568,35568,35568,35601,35698,35730,35730,35730,35795,57052,63390,40053,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35796,35796,35796,35796,35796,35796,35764,35796,35764,35796,35796,35796,35796,35796,35796,35764,35764,35764,35765,35765,35765,35765,35765,35765,35765,35765,35765,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,29522,6634,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4555,4554,4554,4554,4554,4554,4554,4554,4555,4554,4554,4554,4554,4554,4554,4555,4555,4555,4554,4554,4554,4554,4555,4555,4554,4554,4554,4554,4555,6602,6602,4555,12779,27147,27147,29195,31341,31374,31341,27147,27147,27147,27147,27147,27147,29163,31342,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,46327,65535,54907,35796,35763,35731,35731,35731,35731,35731,35731,35731,35763,35763,35763,35763,35763,35763,48536,63422,50681,42133,37908,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35699,35634,35633,35602,35602,35602,35634,35634,35634,35634,35601,41972,63422,59132,37746,35602,37682,56955,65503,41906,33261,33293,33261,33261,33261,33293,33358,35666,35763,35763,35763,35763,35763,35763,35763,35763,35666,35601,39859,61277,61277,39859,35601,35601,52762,65535,46424,35731,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35731,35666,35634,35601,35601,35601,35601,35601,35601,35601,35601,35666,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35698,35601,35601,35601,35601,35601,35601,35601,35601,35601,35633,35698,35763,35665,35568,35568,35600,35600,35600,35569,35569,35666,35730,35731,35730,35795,59132,63422,42133,35730,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35764,35764,35796,35796,35796,35796,35796,35796,35796,35764,35765,35796,35764,35765,35765,35765,35765,35765,35765,35765,35765,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{35763,35763,35763,35763,35763,35763,35763,35763,35731,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,29522,6634,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4555,4555,4554,4554,4554,4554,6602,6602,4554,4554,4555,4554,4555,4555,4555,4555,4555,4555,4554,4555,4555,4555,4554,4554,4554,4554,4554,4555,4554,6602,6602,6602,8650,12779,14826,20971,27147,27147,23019,10698,10699,10698,10698,10698,16875,27147,31374,35764,35796,35796,35764,35764,35796,35796,35796,35796,35796,35796,35764,35764,46392,65535,54907,35764,35763,35763,35763,35763,35763,35763,35763,35763,35731,35731,35763,35763,35763,35731,52762,65535,46424,33650,35763,35763,35763,35763,35763,35731,35731,35763,35763,35763,35763,35731,35763,35763,35763,35763,35763,35763,35763,35763,35731,35634,35602,35602,35602,35602,35601,35633,35634,35601,41972,63422,59132,37714,35602,35634,56955,65503,41906,33261,33261,33261,33260,33260,33293,35601,35763,35763,35763,35763,35763,35763,35763,35763,35763,35698,35601,39859,61277,61277,39827,35601,35601,44182,48537,40053,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35731,35731,35763,35763,35763,35763,35763,35666,35569,35569,35601,35569,35601,35601,35666,35731,35699,35731,35731,35763,35763,35731,35763,35763,35731,35731,35731,35731,35731,35763,35763,35763,35763,35731,35731,35731,35666,35569,35601,35601,35601,35601,35601,35601,35601,35569,35568,35666,33682,35633,35601,35601,35698,33650,35665,35601,35569,35633,33682,35731,35730,35795,59132,63422,40053,33682,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35796,35764,35796,35796,35796,35796,35796,35764,35764,35796,35796,35796,35796,35796,35796,35796,35765,35797,35764,35765,35765,35765,35765,35765,35765,35765,35765,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{35763,35763,35763,35763,35763,35763,35763,35763,35732,35764,35763,35763,35764,35764,35764,35764,35764,35764,35764,27409,6634,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4555,4554,4554,4554,4554,8618,12649,8585,4554,4555,4554,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,4554,6602,6602,6602,6602,14827,21003,14827,10699,10699,8651,6602,6602,6603,6603,6602,12779,29195,31341,35731,35796,35796,35764,35732,35764,35764,35796,35796,35796,35796,35796,35764,46391,65535,57052,44279,44279,44279,40053,35763,35763,35795,42166,44246,44246,44246,42166,35795,35763,40021,56987,65535,52762,44246,37940,35763,37876,44246,44278,44246,44278,40053,35763,35763,42134,44246,37876,42166,44278,42198,35828,35763,37940,44246,44278,44214,44150,39892,35602,35602,35634,35633,35601,37714,48375,63422,61245,46262,42005,37682,56955,65535,48406,41874,41906,41841,35406,33260,33423,37908,44278,44278,44278,44278,40021,35763,35763,35763,35763,35731,35698,46294,63390,63390,46294,42036,37682,39956,44246,37908,37876,42198,44246,44246,44246,44278,42134,35763,35763,35763,42134,44279,44278,44278,44246,37876,35763,39989,44278,40021,39989,44278,44246,40021,35763,35763,35763,35698,37714,44117,42037,37746,44117,44182,42134,35763,40053,44246,37908,35763,35763,42133,44246,37876,37908,44246,44246,44246,44246,44246,40021,35763,35763,35795,42166,44246,44246,44214,42036,37681,35601,35601,35601,35601,35601,35601,39891,44149,44213,44246,44214,37875,35698,35827,42198,40053,35666,35601,37811,42198,40053,35763,42166,61277,65503,48504,42166,35827,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35765,35797,35765,35765,35765,35765,35765,35765,35765,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{35731,35731,35731,35763,35763,35763,35763,35731,35763,35763,35763,35764,35764,35764,35764,35731,29522,29522,31602,14925,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4555,4555,4554,4554,4554,8585,14664,10633,4555,4555,4555,4555,4554,6570,6570,6602,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,6603,6603,6603,6602,8650,8650,6602,6602,6602,6602,6602,6602,6602,6603,6602,12778,23051,25099,33553,35797,35764,35764,35764,35699,35699,35764,35796,35796,35796,35796,35764,46391,65535,63455,61310,61310,63422,54874,37876,35763,40021,61245,63390,61310,63390,61277,40053,35763,50649,65503,65535,63422,61310,46391,35763,44311,63390,61310,61310,63422,54939,37876,37876,59132,63422,44311,57052,63390,59197,40021,35763,48536,63422,61310,61310,63422,52697,37714,35602,35601,35601,35601,39892,61245,65535,65503,63390,56955,37747,56955,65535,63390,61309,61277,63357,41906,33358,35731,48536,63422,61310,61310,63422,52762,35796,35763,35763,35763,35763,37908,59164,65535,65535,63390,59100,37779,52729,65535,46391,42134,63390,63422,63390,63422,63422,57020,37908,35763,37908,57052,63390,61310,63390,63390,44246,35763,48504,65535,52762,48537,63390,63390,48536,35763,35763,35763,35666,39891,61277,61213,44182,59165,63390,57020,37876,54874,65503,44311,35731,35795,56987,63454,42166,44311,63455,63422,61310,61310,63422,52826,35796,35763,40021,61245,63390,61310,63358,59100,39826,35601,35601,35601,35601,35601,35666,52762,63422,61310,61310,63422,48504,35763,42165,63422,57019,35763,33650,44246,65503,54907,35827,54939,65535,65535,63390,61245,40021,35731,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35765,35765,35765,35765,35765,35765,35765,35765,35765,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{35731,35731,35731,35731,35731,35731,35731,35731,35763,35764,35764,35764,35764,35764,35764,29522,8683,6602,14957,10764,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4555,4554,4555,4555,4554,8618,12649,8585,4554,4555,4555,4555,4554,10633,10633,6602,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,6603,6603,6603,6603,6603,6602,6602,6602,6602,6603,6602,6602,6602,6602,6602,6602,8650,12746,31472,35797,35732,35700,35764,35764,35732,35667,35732,35764,35796,35796,35764,46391,65535,57020,42134,40054,50649,63422,50617,37876,57020,63390,44279,40021,44246,61310,57052,37908,37908,54907,65535,50649,40053,37876,42134,61277,59132,42134,40053,48536,63422,52762,37876,59132,65535,59197,44279,40053,40053,35795,44311,63390,54939,40053,40053,52730,63422,48472,35666,35666,35666,35634,37682,46262,63422,61245,44085,39892,37682,56955,65535,48439,39956,39794,59100,61180,39988,44279,63390,54939,40053,40053,50682,63422,48536,35763,35763,35763,35763,35795,44246,63390,63390,44214,39891,35634,52730,65535,46391,42101,63454,59165,48536,57052,48536,63422,52794,37876,54874,63422,46424,40053,42166,59197,59197,40021,48504,65535,63422,50681,40053,42101,37908,35763,35763,35763,35667,39892,63358,65535,57052,42166,40053,40021,35795,54907,65535,46359,35731,35795,57020,65535,42198,44311,65535,57019,40053,40053,50649,63422,50617,37876,57020,63358,44278,39956,41972,39891,35633,35601,35601,35601,35601,35601,48471,63422,50681,40021,40053,54939,63390,44278,42133,65503,57052,35795,33682,44278,65535,54939,35763,40053,59197,63455,46391,40021,35795,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35765,35765,35765,35765,35765,35765,35765,35765,35765,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,21199,4554,4521,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4522,4554,4554,4554,4522,4522,4554,4555,4554,4554,8618,8585,8586,8586,8618,8618,8586,8553,6570,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,6603,6603,6603,6603,6603,6602,6602,6602,6602,6602,6602,6602,6602,6602,6602,6602,6602,12746,31374,35666,35764,35667,35635,35764,35796,35700,37683,35667,35732,35731,35764,46391,65535,54907,35764,35764,46424,65535,52762,37876,61277,65503,54907,52794,54907,63455,61277,37940,35731,52762,65535,46424,35731,35731,44246,65503,57052,35795,35731,44279,65535,54939,37876,59132,65503,50681,37908,35763,35763,35763,46424,65535,61245,52794,52794,59132,65535,52730,35763,35763,35763,35731,35634,41972,63422,59132,37714,35602,35634,56955,65535,44246,35666,35504,57052,65503,42166,46424,65535,61245,52794,52794,59132,65535,52730,35763,35763,35763,35763,35763,39989,61310,61310,39924,35601,35602,54778,65535,46326,42004,63422,57052,44279,54939,44279,65535,57020,37876,57052,65535,56987,52794,54874,63390,63422,40053,48504,65535,57052,42166,35763,35763,35763,35763,35763,35763,35666,39892,63358,63390,48504,35796,35763,35763,35763,54907,65535,46359,35763,35796,57020,65535,42198,44311,65535,54907,35763,35731,46424,65535,52794,35795,48504,61310,54907,52730,52729,50552,37714,35601,35601,35601,35601,35601,52729,65535,48504,33682,35731,52794,65535,46391,42134,65503,57052,35795,33683,44278,65535,54939,35763,35795,59132,63422,42133,35731,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35765,35765,35765,35765,35765,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{33683,23247,19118,19118,19118,19119,21167,19119,19119,21167,21199,33650,35764,35764,35731,12844,4521,4553,4554,4554,4554,4554,4554,4554,4554,4554,4554,4522,21328,40278,23440,4522,10861,36117,31892,6635,4554,4555,4554,8586,14664,14631,14631,14631,14631,14599,14565,8585,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,6603,6603,6603,6603,6603,6603,25585,40278,40278,40278,40278,40278,17134,6602,6602,6602,6602,12746,27147,29260,33520,35667,35667,35667,35732,35764,35667,37651,35602,35634,35667,46327,65535,54907,35764,35764,46424,65535,52730,37811,61245,65503,57052,57019,57019,57019,52794,37876,35763,52762,65535,48504,35731,35731,42198,65503,57052,35795,35731,44279,65535,54939,37876,59164,63422,42134,35763,35763,35763,35763,46424,65535,61310,57019,57019,57019,57019,46424,35763,35763,35763,35763,35634,41972,63422,59132,37714,35602,35634,56955,65535,44279,35699,37682,59132,65503,42166,46423,65535,61310,57019,57019,57019,57019,46424,35763,35763,35763,35763,35763,39989,61310,61310,39956,35634,35602,54810,65535,46327,42005,63422,57084,44311,54939,44311,65535,57020,37876,57052,65535,59132,57020,57020,57019,54907,37941,48504,65535,52730,35763,35764,35763,35763,35763,35763,35731,35602,39892,63358,61245,37844,35731,35764,35763,35763,54907,65535,46359,35731,35796,57020,65535,44246,44311,65535,54907,35763,35763,46424,65535,52794,35763,37876,52794,57019,56987,57019,61277,46294,37682,35601,35601,35601,35634,52729,65535,48504,33683,35763,52826,65535,46391,42134,65503,57052,35795,33683,44278,65535,54939,35763,35795,59132,63422,42133,35731,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35765,35765,35765,35765,35765,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764},
-	{23247,6601,2472,2473,2473,2473,2473,2473,2473,8682,12876,29489,35764,35764,33683,10796,4521,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4522,33940,65535,36085,4522,17134,61342,52923,8748,4554,4555,4555,4554,10600,14566,14565,14533,14533,14533,14565,8553,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,6603,6603,6603,6603,6603,42391,65535,55003,48697,48697,48697,19247,6570,6602,6602,6602,8650,16875,25099,29228,35634,37780,35635,35635,35700,35732,35699,37683,37651,35602,46263,65535,56987,39989,37909,48569,65503,50585,37747,59100,63390,44246,39989,39989,37941,35796,35763,35763,52762,65535,48504,35763,35763,42166,63390,57084,40021,37908,46424,65503,52794,37876,59164,63422,42134,35763,35763,35763,35763,46391,63422,54907,39989,39989,40021,37908,35795,35763,35763,35763,35763,35699,39924,61277,59165,39892,37747,37682,56955,65535,44279,35763,37876,59132,65503,42166,46359,63422,54907,39989,39989,39989,37908,35795,35763,35763,35763,35763,35763,37940,59165,61310,42134,37876,37682,54778,65535,46327,42005,63422,57084,44311,54939,44311,65535,57020,37876,54939,63422,46391,37941,40021,39989,35828,35764,48537,65535,52762,35764,35764,35764,35764,35763,35763,35731,35602,39892,63358,61245,37779,35634,35731,35763,35763,52794,65503,48472,37908,39989,57052,63390,42166,46359,65535,54907,35763,35763,46424,65535,52794,35763,37908,39989,39989,39891,42037,61310,59100,37747,35601,35601,35634,35731,50649,65503,50617,37908,37908,54907,63422,44311,42133,63390,59132,39989,37908,46391,63455,54874,35763,35795,57019,63422,44278,37908,35795,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35765,35765,35765,35765,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35765},
-	{14957,2472,4521,4521,4521,4521,4521,4521,4521,6634,8715,12844,14957,14957,23280,10796,4521,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4522,31924,65535,36085,4522,17134,61342,52923,8748,4554,4555,4554,4554,8552,14566,14631,14631,14631,14631,14566,8553,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,4555,6603,6603,6603,6603,6603,42391,65535,27698,6602,8683,6635,6603,6602,6602,6602,6602,6602,6602,12746,23051,35602,35700,35732,35635,37651,35699,35764,37748,37683,35603,46263,65535,63422,61277,61277,63422,54875,37779,35634,42005,61245,61310,61277,61277,57052,37908,35763,35763,52762,65535,48504,35763,35763,35796,46424,63422,61277,61277,63390,57052,37941,37876,59164,63422,42134,35763,35763,35763,35763,37876,50617,63422,61277,61277,61309,48569,35763,35763,35763,35763,35666,35731,35699,44182,63390,61277,54875,37747,56955,65535,44279,35763,37876,59132,65503,42166,35796,50617,63422,61277,61277,61309,48569,35763,35763,35763,35763,35763,35763,35795,42166,61310,61310,57052,37876,52794,65535,46359,42037,63422,57084,44311,54939,44311,65535,57020,35796,40021,59165,63390,61277,61277,59165,40054,35764,48537,65535,52762,35764,35764,35764,35764,35764,35764,35667,35602,39892,63358,61245,37779,35602,35634,35731,35763,37941,57020,63390,61277,61277,63422,46424,35795,46359,65535,54907,35763,35763,46424,65535,52794,37908,57052,61277,61277,61277,61277,61277,42037,35602,35601,35602,35699,35763,37876,54874,63422,61277,61277,63422,48569,35795,35795,46391,63422,61277,61277,63390,57052,37940,35763,35763,40021,59165,63390,59165,40053,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35764,35765,35765,35765,35765,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35765,35765,35764},
-	{14924,2472,4521,4521,4521,4521,4521,4521,4521,4521,4521,4521,4521,4521,8683,6634,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4554,4522,31924,65535,36085,4522,17134,61342,52923,8748,4554,6602,6602,6570,12583,14566,14664,14664,14664,14664,14631,12616,10634,6602,6602,6602,6602,6602,6602,6602,6602,4555,4555,4554,4554,4554,6603,6603,6603,6603,6603,42391,65535,27666,4522,6602,6602,6602,6602,6602,6602,6602,6602,6602,6602,18956,35570,37683,35732,35732,35667,35635,35667,35667,37780,35635,39860,46327,48375,48407,48407,48375,42037,35699,35731,37812,44311,46424,46424,46424,46359,35828,35763,35763,42134,46424,40021,35763,35763,35763,37908,46423,46424,46424,46424,44246,35763,35795,44279,46391,37908,35763,35763,35763,35763,35763,40021,46424,46424,46424,46424,42134,35763,35763,35731,35634,35602,35634,35666,37779,46294,48375,44182,37682,44117,46327,39989,35763,35796,44246,46262,37909,35763,40021,46424,46424,46424,46424,42134,35763,35763,35763,35763,35763,35763,35763,37876,46391,46424,46359,37876,42166,46424,40021,37876,46392,44279,39989,44246,39989,46424,44247,35796,35796,44279,46424,46424,46424,46424,37909,35764,40054,46424,42134,35764,35796,35764,35764,35764,35731,35634,35602,37715,46294,46262,37714,35602,35602,35666,35763,35763,42198,46424,46424,46424,46424,37941,35763,40021,46424,42166,35763,35763,40021,46424,42166,35796,46359,46424,46424,46359,46327,46262,37682,35602,35602,35698,35763,35763,35763,42134,46424,46424,46424,46424,40021,35763,35763,37908,46391,46424,46424,46424,42198,35763,35763,35763,35763,44279,46424,46391,37908,35763,35763,35763,35763,35763,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35797,35765,35764,35765,35765,35765,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35765,35764,35764,35764},
-	{6601,4520,4521,4521,4521,4521,4521,4521,4521,4521,4521,17134,42391,27698,4554,4521,19247,42391,25585,4522,6667,36085,42391,42391,42391,36117,8747,4522,31924,65535,36085,4522,17134,61342,52923,8748,8586,12616,31729,44439,44406,46454,44374,23180,12584,23181,46422,33777,25326,31729,25326,44407,31697,8618,8618,10633,10633,6635,10861,10861,10861,10828,6635,6603,6603,6603,6603,42391,65535,50810,42391,42391,42359,17134,4522,6602,6602,6603,6602,6602,6602,18956,35602,37651,35635,37779,37844,35700,37651,35635,37715,37748,35667,35603,35667,35732,35732,35634,35667,35764,35764,35764,35764,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35731,35634,35602,35602,35602,35634,35634,35602,35602,35602,35602,35602,35602,35731,35763,35764,35731,35699,35764,35764,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35763,35763,35764,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35764,35764,35764,35796,35796,35764,35764,35764,35764,35666,35602,35602,35602,35602,35602,35602,35634,35699,35764,35764,35763,35763,35763,35763,35763,35764,35764,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35731,35602,35602,35634,35634,35731,35763,35763,35763,35763,35763,35763,35731,35731,35731,35763,35763,35763,35763,35731,35731,35731,35731,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35797,35765,35764,35765,35765,35765,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35765,35764,35764,35764},
-	{2472,4521,4521,4521,4521,4521,4521,4521,4521,4521,2441,25553,65535,44471,4554,2473,27698,65535,40278,6634,25585,57148,48697,44536,48697,57148,27666,6635,31892,65535,36085,4522,17134,61342,52923,12811,8585,25261,52826,54971,46584,46584,59197,38165,10795,23440,65535,44504,27666,46454,33745,65535,46422,10633,8585,12649,12649,14924,50810,57116,57116,48697,10828,6603,6603,6603,6603,29779,46584,46584,46584,46617,59197,38198,10828,6602,6602,6602,6602,6602,6602,18956,35570,37651,37683,37874,37907,35732,35635,35635,37683,35635,35667,35732,35764,35764,35764,35732,35731,35764,35764,35796,35764,35764,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35699,35634,35634,35634,35602,35602,35602,35602,35602,35602,35634,35634,35602,35634,35699,35763,35764,35764,35796,35764,35764,35763,35763,35763,35763,35763,35763,35763,35763,35795,35795,35795,35795,35795,35795,35763,35764,35764,35764,35796,35764,35764,35764,35796,35764,35764,35764,35764,35764,35764,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35764,35796,35796,35764,35796,35732,35634,35634,35602,35602,35634,35602,35634,35731,35796,35764,35764,35764,35764,35796,35796,35796,35796,35764,35764,35764,35764,35764,35764,35764,35764,35764,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35797,35764,35764,35765,35765,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35765,35765,35764,35765,35764,35764},
-	{4520,4521,4521,4521,4521,4521,4521,4521,4521,4521,2441,25553,65535,44471,4554,2473,27698,65535,40278,8780,55036,61309,19279,10861,19247,59229,57116,10828,31892,65535,36085,4522,17134,61342,52923,8748,8618,44407,65535,27634,4554,6635,46617,65503,21360,21392,65535,44504,27666,44439,33745,65535,46422,14632,14566,14664,6570,8715,25553,27698,27698,25553,8715,6603,6603,6603,6603,6635,6635,6635,6635,8683,46584,65535,23473,8650,12779,12779,12779,8650,6602,18955,35570,37651,37683,37874,37906,35732,35764,35764,35699,35635,37651,35667,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35666,35731,35731,35666,35634,35602,35602,35602,35602,35666,35763,35731,35666,35666,35763,35764,35764,35763,35698,35764,35764,35763,35763,35763,35763,35763,35763,35763,35795,35795,35795,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35796,35796,35764,35764,35764,35764,35796,35764,35764,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35764,35796,35796,35764,35796,35764,35731,35634,35602,35602,35602,35602,35634,35731,35796,35732,35732,35764,35764,35796,35796,35764,35764,35796,35796,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35796,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35797,35765,35764,35765,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35765,35765,35764,35765,35765,35765,35765},
-	{4520,4521,4521,4521,4521,4521,4521,4521,4521,4521,2441,25553,65535,44471,4554,2473,27698,65535,40278,8780,55036,65535,59197,57116,57148,65503,57116,10828,31892,65535,36085,4522,17134,61342,52923,8748,4554,42391,65535,25586,4522,6635,46585,65535,21360,21392,65535,44504,27666,44439,33745,65535,44406,14599,16614,14664,8618,6570,4522,4522,4522,4522,6603,6603,6603,6603,6603,6603,6635,6602,6602,6635,46584,65535,29617,20939,29195,29195,29195,20971,8650,18955,35570,37651,37651,37746,37747,35667,35699,35764,35732,35732,35667,35667,35732,35764,35764,35764,35764,35764,35764,35764,35764,35764,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35795,35796,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35666,35602,35602,35602,35634,35731,35763,35763,35763,35764,35764,35764,35764,35731,35601,35764,35764,35763,35763,35763,35763,35763,35763,35764,35795,35795,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35764,35764,35796,35796,35796,35796,35796,35796,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35764,35764,35796,35796,35796,35764,35667,35602,35602,35602,35602,35602,35731,35764,35667,35602,35731,35764,35764,35796,35764,35764,35796,35796,35796,35796,35764,35764,35764,35764,35764,35764,35764,35796,35764,35764,35764,35796,35796,35764,35764,35764,35764,35764,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35765,35765,35765,35765,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35765,35764,35764,35765,35765,35765,35765,35765,35765,35765},
-	{4520,4521,4521,4521,4521,4521,4521,4521,4521,4521,2441,25553,65535,42423,4521,2441,27666,65535,40278,8780,55036,61342,31859,25553,25553,25553,23441,6635,31892,65535,36085,2442,17134,61342,52923,8716,4554,42391,65535,25586,2442,4555,46584,65535,21360,21392,65535,44504,27666,44407,31697,65535,42391,12583,16646,14664,12583,8553,6603,6602,4555,6602,6603,6603,6603,6603,6602,29779,46584,19247,4522,6602,46584,65535,39857,31309,33487,31341,31341,27147,10698,18955,35569,37651,35603,35603,35635,35764,35732,35764,35732,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35795,35796,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35699,35602,35602,35602,35666,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35763,35763,35763,35763,35763,35763,35764,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35764,35764,35764,35764,35796,35796,35764,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35667,35602,35602,35602,35602,35602,35699,35764,35667,35602,35731,35796,35764,35796,35764,35764,35796,35796,35796,35796,35764,35764,35764,35764,35764,35764,35796,35796,35764,35764,35764,35796,35796,35796,35796,35796,35764,35764,35764,35764,35764,35764,35764,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35797,35765,35765,35764,35765,35765,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35765,35764,35764,35765,35765,35765,35765,35765,35765,35765},
-	{4520,4520,4521,4521,4521,4521,4521,4521,4521,4521,2473,17134,50810,52890,27698,27666,42391,65535,40278,6667,38230,59197,31924,27666,27666,23473,6635,4522,21392,55003,48697,15054,10861,44504,57116,25585,6635,27698,57148,42391,27666,27699,52923,48730,15054,15054,48730,52923,33972,38133,46454,59164,31729,14631,16614,14566,14565,12583,12616,8618,4555,6602,6602,6603,6603,6603,6603,29747,57148,42391,27666,29746,54971,56921,37549,33455,37845,33520,33520,29196,20971,25100,35569,37683,35700,35700,35700,35764,35764,35796,35764,35764,35796,35796,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35731,35699,35634,35634,35731,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35763,35763,35764,35764,35764,35764,35764,35796,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35731,35699,35667,35602,35602,35634,35699,35764,35699,35634,35731,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35764,35764,35764,35764,35796,35796,35796,35764,35764,35764,35796,35796,35796,35796,35796,35764,35764,35796,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35797,35765,35765,35765,35765,35765,35765,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765},
-	{2472,2472,4521,4521,4521,4521,4521,4521,4521,4521,4521,2473,21392,55036,57116,57116,59261,65535,40278,4522,8780,48697,57116,57116,57116,48730,10860,4522,4522,29779,57148,31859,4522,15054,55003,46584,8716,4555,38198,57148,57116,57116,55036,21360,4522,4522,21360,57116,40213,25521,57116,42196,14664,14598,16613,10535,8552,12583,10600,6570,4555,6603,6603,6603,6603,6603,6603,6603,38165,57148,57116,57116,57084,39759,31113,33488,35797,33520,35634,31374,29195,29228,35634,35732,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35634,35634,35764,35796,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35764,35667,35602,35667,35764,35796,35764,35731,35764,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35764,35796,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35764,35764,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35797,35765,35764,35765,35765,35764,35765,35765,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765},
-	{2472,2472,4521,4521,4521,4521,4521,4521,4521,4521,4521,4521,6634,10828,10828,8779,31891,65535,40278,4522,4554,8780,10860,10860,10860,10828,6603,4554,4554,8715,10861,8716,4555,6635,10861,8780,4555,4555,8748,12876,16907,16907,16907,8683,4555,4555,6635,12876,12779,8683,14924,18858,14632,16614,16613,8552,4555,6570,6602,4555,6603,6603,6603,6603,6603,6603,6603,6603,10796,12909,12908,10861,17005,29195,31276,35698,35797,33520,35699,33487,29195,29228,35698,35796,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35666,35731,35763,35764,35763,35763,35763,35763,35763,35763,35764,35731,35601,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35764,35667,35732,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35764,35796,35764,35764,35796,35764,35764,35796,35796,35796,35764,35796,35796,35796,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35764,35764,35796,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35797,35797,35765,35765,35764,35765,35765,35764,35764,35765,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765},
-	{2472,2472,4520,4521,4521,4521,4521,4521,4521,4521,4521,4521,4521,2441,2441,2409,27666,65535,40278,4522,4554,4522,4522,4522,4522,4554,4554,4554,4555,4554,4522,4554,4555,4555,4555,4555,4555,4555,4554,6570,12649,12616,12616,8586,6602,4554,8618,12649,14664,12649,12584,14566,14566,14566,14598,14664,10633,4555,4555,6602,6603,6603,6603,6603,6602,6603,6603,6603,6602,6602,6602,6602,8650,20971,27180,33553,35764,33520,35699,33488,31341,31407,35698,35796,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35699,35731,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35699,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35764,35796,35796,35764,35764,35764,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35797,35765,35765,35764,35764,35765,35765,35765,35765,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765},
-	{2472,2472,4520,4521,4521,4521,4521,4521,4521,4521,4521,4521,12973,29811,29811,29779,44504,55036,25553,4522,4554,4554,4554,4554,4554,4554,4554,4555,4555,4555,4554,4555,4555,4555,4555,4555,4555,4555,4554,4554,6570,6570,6570,10633,12648,10633,12649,14632,14566,14566,14566,14566,14566,10600,6570,12649,12681,4555,4554,6602,6603,6603,6603,6603,6602,6603,6603,6603,6602,6603,6602,6602,6602,8650,14827,27181,35666,33553,35699,35731,33520,33488,35666,35796,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35795,35763,33488,31245,33456,35764,35796,35763,35764,35764,35763,35763,35763,35731,35731,35763,35763,35763,35764,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35763,35699,35699,35731,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35765,35797,35796,35764,35765,35765,35764,35764,35764,35765,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35765,35764,35764,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765},
-	{2472,2472,4520,4521,4521,4521,4521,4521,4521,4521,4521,2473,21360,55003,55003,55003,55036,34004,4522,4522,4554,4554,4554,4554,4554,4554,4554,4554,4554,4555,4555,4555,4555,4555,4555,4555,4555,4555,4554,4554,4555,4555,4555,6570,10601,12649,14696,12616,12550,14566,14566,14566,14599,8618,4555,10633,12649,6602,6602,6602,6603,6603,6603,6603,6602,6603,6603,6603,6603,6603,6603,6602,6602,6602,6602,8651,23149,33586,35699,37812,35764,33553,35699,35796,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35763,35763,35763,35763,35764,35764,35764,35764,35763,35763,35763,35764,35764,35764,35764,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35666,33553,31213,31148,33423,35699,35666,35666,35666,35698,35763,35763,35763,35569,35602,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35764,35764,35796,35666,33359,33359,35602,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35765,35765,35765,35765,35765,35765,35764,35764,35764,35765,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35765,35764,35764,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765},
-	{2472,4520,4520,4521,4521,4521,4521,4521,4521,4521,4521,4521,6634,8747,8747,8747,8747,6667,4522,4522,4554,4522,4554,4554,4554,4554,4554,4554,4554,4555,4555,4554,4554,4555,4555,4555,4555,4554,4555,4555,4555,4555,4555,4555,4554,6570,10633,4554,8553,14566,14664,12648,12649,6570,4555,10634,12649,8618,6603,6603,6603,6603,6603,6603,6602,6603,6603,6602,6602,6603,6603,6602,6602,6602,6602,6602,6602,16876,23151,31538,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35763,35763,35763,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35763,35698,31213,31180,31148,31148,33423,33423,33294,33294,33294,33359,35731,35763,35763,35569,35570,35764,35763,35763,35763,35763,35763,35763,35763,35763,35763,35731,35763,35763,35763,35731,35731,35764,35796,35764,35764,35796,35634,35343,33294,35602,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35765,35765,35764,35765,35765,35765,35765,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35765,35765,35764,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765},
-	{2472,2472,4520,4521,4521,4521,4521,4521,4521,4521,4521,4521,4521,4522,4522,4522,4522,4522,4554,4554,4554,4522,4554,4554,4554,4554,4554,4554,4554,4555,4555,4554,4554,4555,4555,4555,4555,4555,4554,4555,4555,4554,4555,4555,4555,6570,10601,8553,10535,14566,14664,8618,4555,4555,4555,4554,6602,6602,6603,6603,6603,6603,6603,6603,6603,6603,6603,6603,6603,6602,6602,6602,6602,6602,6602,6602,6602,6602,8650,23052,33488,35699,35796,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35763,35764,35764,35764,35763,35764,35764,35764,35764,35764,35764,35764,35764,35796,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35763,35763,35763,35763,35763,35763,35763,35763,35763,35666,31212,31148,31148,31148,33423,33423,33262,33262,33262,33326,35731,35796,35763,35569,35505,35699,35763,35763,35763,35763,35763,35763,35763,35763,35763,35569,35634,35764,35667,35602,35635,35634,33521,35667,35764,35796,35634,33295,33294,35505,35763,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35764,35796,35796,35796,35796,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35764,35765,35765,35765,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35765,35765,35765,35764,35764,35765,35765,35764,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765},
-	{2472,2472,4521,4521,4521,4521,4521,4521,4521,4521,4521,4521,4522,4522,4522,4522,4554,4554,4554,4522,4522,4522,4522,4554,4554,4554,4554,4554,4554,4555,4555,4554,4522,4522,4555,4555,4555,4554,4555,4555,4554,4555,4555,4554,8586,6570,12648,14598,14533,14566,14664,8618,4555,4555,4555,4554,4522,4522,4522,4554,6603,6603,6603,6603,6603,6603,6602,6603,6603,6603,6603,6602,6602,6602,6602,6602,6602,6602,8650,16875,20971,31374,35731,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,40022,42134,42134,37876,37909,42134,39989,35796,40054,42102,37844,35764,37909,42134,37941,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35763,35763,35763,35763,35763,35763,35763,35763,35763,35666,31212,31148,31148,31148,33423,33423,33262,33262,33261,33294,33488,33489,35634,35569,33359,35634,35795,35763,35763,35763,35763,35763,35731,37844,42134,41972,37811,35764,35602,35570,35635,33423,33261,39891,42134,35796,35634,33294,37552,39794,37876,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,40022,42166,37909,35796,35796,37909,42134,40022,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35764,35796,35796,35796,35796,35796,35796,35764,35764,35765,35764,35765,35764,37877,42134,40022,35765,35764,35796,40022,42134,37877,35764,35764,35764,35764,35765,35765,35765,35765,35765,35764,35764,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765},
-	{2472,2472,4521,4521,4521,4521,4521,4521,4521,4521,4521,4521,4521,4522,4522,4522,4522,4554,4522,6634,19247,19279,6667,4554,4554,4554,4554,4554,4554,4554,4554,8716,21360,17199,4587,4555,4555,4555,4555,4554,4555,4555,4555,8618,8585,6570,12616,14566,14533,14566,12616,6570,4555,4555,4522,14956,23440,23440,23440,15022,6602,6603,6603,6603,6603,6603,6602,6603,6603,6603,6603,6602,6602,6603,6602,6602,6602,6602,6602,6602,12746,29195,33488,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,37877,57020,63390,61277,42134,46392,63454,52730,37909,59165,61277,40021,35731,48537,63455,50617,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35634,35763,35764,35764,35763,35763,35763,35666,35698,35763,35666,31212,31148,31148,31148,33423,33423,33262,33262,33261,33261,33261,33262,33456,35666,33359,35601,35795,35763,35763,35763,35763,35763,35699,44214,63390,63358,52762,35764,35602,35570,35635,33391,35439,59132,59197,37909,33456,33294,48342,63422,48537,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,52827,63422,46360,35764,35764,44311,63422,54875,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35764,35764,35796,35796,35796,35796,35796,35764,35765,35765,35764,35765,35764,42167,63390,57020,37845,35764,37845,57020,63390,42167,35764,35764,35764,35764,35764,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765},
-	{2472,2472,4521,4521,4521,4521,4521,4521,4521,4521,4521,4521,4521,4522,4522,4522,4522,4554,4522,8780,55003,57148,12941,4522,4554,4554,4554,4554,4554,4554,4522,15086,61309,50842,8748,4554,4555,4555,6570,6570,4554,4554,4554,10633,6570,6570,12583,14565,14533,14566,10600,4554,4555,4555,6635,33939,61342,61309,65503,36117,4522,6602,6603,6603,6603,6603,6603,6602,6603,6603,6602,6602,6602,6603,6603,6603,6603,6602,6602,6602,12746,29163,31341,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,52762,63390,48537,42166,37876,48472,65535,52762,37909,61277,63390,40021,35731,50617,65535,50649,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35731,33488,35731,35763,35731,33456,33390,35698,35601,35666,33585,33521,31212,31148,31180,31180,33293,33326,33262,33262,33261,33262,33262,33262,33456,33521,33294,33489,35764,35763,35763,35763,35763,35763,42134,61213,57020,41973,39860,35732,35602,35570,35635,33391,35439,61245,61245,37617,33261,33229,50455,65535,50617,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35764,35764,35796,54907,65535,46392,35764,35764,46359,65535,54939,35796,35796,35796,35796,35796,35796,35796,35796,35796,35764,35764,35796,35796,35796,35764,35764,35796,35796,35796,35796,35764,35764,35765,35765,35765,35765,35764,44215,65503,59100,37845,35764,37877,59132,65503,42167,35764,35764,35764,35764,35764,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765},
-	{2472,2472,4521,4521,4521,4521,4521,4521,4521,4521,4521,4521,4521,4522,4522,4522,4554,4554,4522,8780,57084,59229,12973,4522,4554,4554,4554,4554,4554,4554,4522,15086,61342,52923,8748,4554,4554,4554,8585,12648,10600,12648,12648,12648,12648,12648,14631,14565,14565,14566,10600,4554,4555,4522,25553,61309,42423,36117,65535,38166,4522,6602,6603,6603,6603,6603,6603,6602,6603,6603,6602,6602,6602,6602,6603,8651,8651,8650,8650,8650,14827,29195,31374,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,57020,65503,42167,35732,35764,42134,50649,44247,37909,61277,63390,40021,35731,50617,65535,50649,35763,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,33521,33391,35731,33423,33325,31148,31115,33553,33521,33586,33488,33456,31212,31148,31148,31181,31181,31181,33261,33261,33261,33261,33262,33262,33359,33359,33294,35505,35635,33521,35699,35732,35699,33521,44214,65535,54875,33425,33360,33489,35570,35571,35635,33391,35439,61245,61245,35407,31149,33197,50422,65535,48569,35764,35764,35764,35796,35796,35796,35796,35764,35764,35764,35764,35764,37876,37876,35796,35796,35796,35796,35796,35764,35764,35764,35764,35764,35764,35796,35796,35796,35764,35764,35764,35764,35764,35796,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35796,35796,35796,35796,35764,35764,35764,35764,35764,35796,35796,35764,35764,35764,35764,35764,35764,35796,35796,35764,35796,35796,35764,35764,54907,65535,46392,35732,35764,46359,65535,54907,35764,35764,35764,35764,35796,35796,35796,35764,35764,35764,35764,35764,35764,35796,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35765,35764,42167,65503,57052,37845,35764,37877,59132,65503,42167,35732,35764,35764,35764,35764,35765,35764,35764,35764,35764,35764,35764,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765},
-	{2472,2472,4521,4521,4521,4521,4521,4521,4521,4521,4521,4521,2441,2441,2473,2473,2473,4522,4522,6635,25553,25585,8715,4522,2474,2474,4522,4522,2474,4522,4522,15086,61342,52923,10763,6537,6537,8553,12616,14664,14664,14664,14664,12616,12648,12616,12551,14566,14598,14632,14664,6570,6538,23246,52858,50810,17167,31859,65535,38166,4522,6602,6603,6603,6603,6603,6603,6603,6603,6603,6602,6602,6602,8651,14827,25099,25067,25099,25100,25100,27278,33487,35666,35764,35764,35764,35764,35764,35764,35764,35764,35764,42134,59165,65535,48537,42166,37876,37909,42166,39989,37909,61277,63390,40021,35731,48569,65535,50649,35763,35763,35764,35764,35763,37876,42166,42166,44214,42166,44214,42102,35796,35764,35764,40054,42134,39826,39826,42134,33390,31115,35374,39729,37616,35503,42101,42004,35503,31148,33260,39696,39761,39762,39761,39697,33294,33261,33294,33294,33294,33360,33392,39762,42005,42037,41940,42005,37715,35635,35699,48440,65535,59068,41973,39795,35538,35570,35570,35603,33423,41874,63357,63325,43987,39664,33229,50422,65535,52794,42166,42199,44247,37909,35732,35764,37877,42166,44247,44247,44247,42134,35796,35796,35796,35796,35796,35796,35796,42134,44247,44247,44247,42166,37877,35764,35796,40021,44247,44247,44247,44247,39989,35764,37876,42166,42134,37877,42166,44247,42102,35796,35764,42102,44247,44215,44247,42166,37877,35764,35764,37909,42167,44247,44247,44247,40022,35764,37844,42134,44247,44247,44247,44247,42166,37844,35764,35796,35796,35764,35764,40054,57052,65535,50650,42166,37877,46359,65535,57052,44247,44247,44247,40022,35764,35764,37844,42134,44247,44247,44247,42166,37845,35764,39989,44247,44247,44247,44215,44215,39990,35764,35764,35764,35764,35764,37877,48505,65503,59197,44247,42102,37877,59132,65503,48505,42167,44215,42167,37845,35764,35764,39990,44215,44215,44215,44215,39990,35764,35765,35765,35765,35765,35765,35765,35765,35765,35765,35765,35764,35765},
-	{2440,2472,4520,4521,4521,4521,4521,4521,4521,4521,2473,10860,23472,23472,23473,23473,23505,15086,4522,6634,19279,21360,6635,12973,23473,23473,23505,23505,23505,12973,2474,15086,61342,52923,8715,10763,27536,25358,14696,14664,14664,14664,14664,8585,4554,4554,6570,12583,14598,14664,14664,8585,10861,40278,59196,29746,2442,31859,65535,38165,4522,6602,6602,6602,6602,6602,6603,6603,6602,6602,6603,6602,6602,16875,27147,31276,31308,29195,31342,33455,35666,33553,35699,35796,35764,35764,35764,35764,35764,35764,35764,35796,54907,65535,65535,63390,61277,42134,46424,65503,52730,37909,61277,63390,40021,35731,48569,65535,50617,33651,33683,33683,33683,33651,40021,61310,63422,63390,63422,63390,57052,37876,35731,37876,57020,63390,61277,61277,63358,41841,31116,44019,65502,52600,46165,63357,63358,48309,31148,37551,61180,63357,61277,63357,59067,37552,33261,33294,33424,33294,33392,35537,54842,63390,61310,61309,63358,44118,35634,42102,63358,65535,65503,63358,52698,35570,35570,35570,35505,35471,59035,65535,65503,63357,56955,35406,50422,65535,63422,63390,61310,63422,48439,33457,35731,44247,63390,63390,63358,63390,57020,37909,35796,35796,35796,35796,35796,39989,59165,63390,63358,63390,59197,40022,35764,35796,50682,63422,63358,63358,63422,48537,35796,42134,63390,59132,44279,61277,63390,54907,37844,37909,57020,63390,63358,63390,63358,44247,35764,35796,46392,63422,63390,63358,63422,54875,37876,37909,59165,63455,63390,63358,63390,61277,40054,35764,35764,35796,35764,35796,52762,65503,65535,63422,61310,44247,44311,65535,65503,63390,63358,63422,54875,37877,35764,37909,59132,63390,63358,63390,61277,42102,35764,48537,65503,63422,63358,63358,63422,50650,37845,35764,35764,35764,35764,42134,61310,65535,65503,63390,54907,37877,59132,65535,63390,63358,63390,61310,42167,35764,35765,50617,63422,63358,63358,63422,50650,35797,35764,35765,35765,35765,35765,35765,35765,35765,35765,35764,35765,35764},
-	{2440,2472,2472,2473,4521,4521,4521,4521,4521,4521,2441,23472,63455,61342,57148,57148,61342,42423,6667,8780,55035,59229,12941,31924,65535,61342,57148,57148,61342,34005,4587,15086,61342,52923,10763,27504,61342,48567,14729,12616,14664,14664,14696,33875,42424,42424,42391,21034,14566,14664,14664,6537,27666,65535,46519,14956,10860,36053,65535,38165,4522,4554,6602,6602,6602,6602,6602,6603,6603,6603,6602,6603,6603,18923,31308,33520,35633,29196,33455,29391,33618,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,35764,40054,59165,65503,48504,42102,37844,48472,65535,52762,37909,61277,63390,40022,35732,50617,65535,46424,27312,29392,29392,29392,27312,35763,63390,61277,48537,59132,48537,63390,50681,29457,50649,63422,48439,39729,39794,59132,59099,37551,44019,65535,63390,50519,39729,39697,35438,35471,56922,61277,41939,39762,44019,63325,54777,35406,33327,35570,33425,35473,52601,63390,48440,41973,41940,59100,59165,39957,35667,48408,65535,57020,41940,39795,35570,35570,35570,35505,33294,41842,63325,61277,41874,37584,33229,50423,65535,52762,42037,39762,54777,61277,44052,39957,59197,59165,42134,42102,48504,63422,52794,35796,35796,35796,35796,37877,54907,63390,46392,42134,42134,42102,37844,35764,48504,63390,52794,42134,42134,54907,63390,46359,42134,63422,65503,54939,42166,42134,40022,37844,52794,63422,48504,42134,42167,59197,59165,40022,42199,61277,57052,42134,42134,50650,63422,50617,37909,61245,63422,46392,42134,44311,61310,57052,37909,35764,35796,35764,35764,40022,57020,65535,50617,42134,37877,46359,65535,57052,42166,42134,50650,63422,50617,35764,35796,42102,42134,42134,44279,61310,57052,37909,48537,65535,54875,42134,42134,54875,63390,46424,35764,35764,35764,35764,37845,46424,65503,59165,44215,40022,37877,59132,65503,48472,42134,44247,61245,59165,39990,46392,63390,54875,42102,42102,54843,63390,46424,35764,35765,35765,35765,35765,35765,35764,35765,35765,35765,35764,29458},
-	{2472,2472,2472,2473,4521,4521,4521,4521,4521,4521,2441,23505,65535,46616,12941,10860,33972,63422,34004,8780,55036,59229,12941,33972,65535,38230,12941,12941,42391,61342,25586,15054,61342,52890,19247,57116,52890,19020,14664,12616,14664,12616,14696,38003,48600,48599,48502,23082,12518,14664,14664,8585,29714,65535,61342,57116,57116,61309,65535,38165,4522,4554,4554,6602,6602,6602,6602,6603,6603,6603,6602,6603,8651,23051,31374,33455,31439,23052,33618,27409,31603,35796,35764,35796,35764,35764,35764,35764,35764,35764,35764,35764,35796,57020,65503,44215,35732,35732,48472,65535,52730,35764,61245,63390,37908,33586,48504,65535,46423,27280,27312,27312,27312,27311,33714,63390,59164,44247,57020,44280,65503,57019,29425,54874,65535,43987,31181,33293,56955,63422,39696,44019,65535,59067,41874,33262,31181,31213,37747,61277,63422,52665,50585,52697,65502,59100,35439,35505,35603,35505,33425,54842,65535,44118,35570,35602,57020,65503,42102,33554,44118,65535,54875,35570,35570,35570,35603,35603,35473,33229,35439,61245,61245,35407,31149,33197,50422,65535,48407,33327,33230,52568,65535,46198,39892,63422,61310,50649,50682,54939,65535,57052,37844,35796,35699,33651,37844,48505,61310,54907,52762,52762,50649,37909,35764,50650,65535,50617,35764,35764,44247,48569,42102,42134,63422,63358,46424,35796,35764,35764,35796,57052,65535,54939,52762,52794,63390,63422,42134,44311,65535,61277,52762,52730,57020,65535,52794,37909,61245,63390,40022,35732,39989,61310,61310,39989,35764,35796,35796,35764,35764,54907,65535,46392,35764,35764,46359,65535,54939,35764,35732,46424,65535,54875,35764,37877,48537,52762,52762,54875,63422,61310,39989,48537,65535,52730,35764,35732,50650,65535,50617,35764,35764,35764,35764,35764,42167,65503,57052,37845,35764,37877,59132,65503,42167,35732,37877,59165,63422,42102,48505,65535,59165,52730,52730,59133,65535,50617,35732,35765,35764,35765,35765,35765,35765,35765,35764,35765,35732,19021},
-	{2472,2472,2473,2473,4521,4521,2473,4521,6536,6537,2441,23505,65535,42423,4522,2441,27698,65535,40278,8780,55036,59229,12941,33972,65535,34004,2474,2474,36118,65535,29779,15054,61342,61309,50810,57051,27471,12648,12616,12616,12616,12583,12551,12583,14631,14631,14566,12517,12518,12615,14664,8585,14989,27666,29681,29681,27666,44472,65535,38165,4522,4554,4554,4554,4554,6602,6602,6602,6602,6603,6603,6603,12779,29195,29196,29262,25165,19021,31506,35764,35764,33651,35732,33619,33618,33618,33618,33651,35764,35764,35764,35764,37844,57052,65503,44247,35764,35732,46424,65535,50617,31505,59165,61310,33650,27279,46391,65535,46423,27280,27312,27312,27312,27311,33714,63390,57084,40053,57020,46328,65503,57020,33651,54907,65503,41907,33229,33294,56955,63422,39729,44051,65535,52600,31214,33262,31181,31213,37748,61278,65503,59100,57020,57020,56955,52600,35406,35505,35603,35505,33425,54842,65535,44150,35668,37878,59133,65503,42069,33522,44150,65535,54875,35603,35603,35635,35635,35635,35473,33295,35471,61245,61245,35439,33197,33197,48374,65535,48310,33197,33262,52568,65535,46198,39795,63422,63390,56954,57020,57052,57052,50682,37844,35764,31473,29393,33619,37877,52794,57052,57052,59132,61310,46424,37844,50650,65535,50617,35764,35764,40022,44279,37941,42134,63422,59165,37876,35764,35764,35764,37844,57052,65535,59165,57052,57052,57052,54939,40021,44311,65535,63390,57052,57052,57052,57052,48537,37909,61245,63390,40054,35764,39989,61310,61310,39989,35764,35796,35764,35796,35796,54907,65535,46392,35764,35764,46360,65535,54939,35796,35764,46424,65535,54843,37844,44311,61277,59165,57052,59132,65503,61310,39989,48537,65535,52730,35764,35764,50650,65535,50617,35764,35764,35764,35764,35764,44215,65503,57052,37845,35764,37845,59132,65503,42167,35764,37877,59165,63422,42102,48505,65535,61310,57052,57052,57052,57052,46392,35764,37813,37813,33651,27376,27376,27377,35732,35765,35765,35732,16973},
-	{2472,2472,2473,2473,4521,4521,2473,4489,10536,8520,2441,23505,65535,42423,4522,2441,27698,65535,40278,8780,55036,59229,12941,33972,65535,34005,2474,2474,38198,65535,29779,15054,61342,61309,50810,57051,27438,12551,12551,12551,12550,12518,12485,12485,12485,12485,12485,12485,12517,12583,14664,10633,6569,8552,10568,6537,2441,29811,65535,38165,4522,4554,4554,4554,4554,4554,6602,6602,6602,6602,6602,6603,12779,29195,27180,23150,29360,29361,29361,33554,33554,29393,31474,29361,29361,29361,29360,31441,33586,33586,31538,31538,33618,56987,65503,40053,31506,31506,44279,65535,50617,31505,57052,61310,35795,27280,44278,65503,48536,29392,27312,27312,27312,27311,33715,63390,57052,37940,57020,46328,65503,59100,39926,54843,63422,44052,35407,35504,59035,63358,39763,44084,65535,52632,33327,33392,33294,33359,37780,59165,61277,42005,37780,37780,37650,33294,33261,35505,35603,35538,35473,54778,65503,46360,39828,39698,59068,63390,42005,33490,44150,65535,54875,35635,35668,35668,35668,35635,35473,33327,35471,59100,61245,39697,35472,33327,48374,65535,48310,33197,33230,50519,65535,46165,39698,61277,59067,37584,37811,39989,37812,37748,35699,35764,31474,29361,29393,35796,39989,39989,39989,42134,61277,61245,39989,48537,65503,50682,37909,37909,52794,63422,46392,42134,63422,59165,37877,35764,35764,35764,35796,54939,63455,46392,37941,39989,39989,37877,35764,44279,63422,57020,39989,39989,39989,37909,35796,37909,61245,63390,40054,35764,39989,61310,61310,39989,35764,35764,35796,35732,33587,52730,65503,46360,35732,33619,44214,65535,54875,33587,33554,44279,65535,52730,35700,57020,63358,42102,35764,42134,63390,61310,39990,48537,65535,52730,35764,35764,50650,65535,50617,35764,35700,33555,33555,33555,39990,63358,59132,39990,37877,37845,57052,63455,39990,33555,35700,59165,63390,39957,48473,65503,52795,39958,39990,39990,31570,23215,23215,23215,23215,21102,12779,12779,12779,25296,35765,35765,35732,16973},
-	{6504,6472,4488,2473,4521,4521,2473,4488,10568,8520,2441,23505,65535,46616,12941,10860,33972,63422,34004,8780,55036,59229,12941,33972,65535,34005,2474,2474,38198,65535,29779,15054,61342,52923,21295,57084,54906,18889,12485,12485,12485,12485,12485,12485,12485,12485,12485,12485,12518,12615,12616,12648,8585,14664,10600,6570,4522,31859,65535,38165,4522,4554,4554,4554,4554,4554,4554,4554,4554,6602,6602,6602,12747,29195,25099,18987,23150,29361,29361,29361,29361,29361,29361,29361,29361,29360,29360,29360,29360,29361,29360,29360,29393,54907,65503,37908,27280,27280,44246,65535,50617,29360,35795,61245,57052,31537,29425,48568,63390,44246,27312,27312,27312,27311,33714,63390,57052,37940,54939,44248,65503,59132,37878,39958,59100,61277,59132,61180,63390,46198,33392,46165,65535,52665,35505,35570,33425,35538,35603,44086,61277,61245,61213,61245,54842,35407,31213,33457,35603,35570,33425,37747,57020,63390,61213,61148,63390,48473,37748,33490,44150,65535,54875,35635,35668,35667,35700,35701,35505,33327,33294,41842,61245,61245,56955,37618,48407,65535,48310,33197,33262,52568,65535,46165,33263,43987,63358,61180,59165,61277,52698,35538,33489,31506,29393,29393,31506,54874,61277,61245,61245,61277,63358,44279,35796,37909,52795,63422,61245,61245,63422,50682,37876,42134,63422,59165,37877,35764,35764,35796,35796,40054,59133,61310,61245,61277,59165,42102,35764,37845,48537,63422,61277,61245,61277,50650,35764,37909,61245,63390,40054,35764,39989,61310,61310,39990,35764,35764,33619,31473,29361,33618,54907,61310,59132,37876,40021,65535,52794,29361,29329,42166,65535,50650,29361,37844,59197,61245,59165,61277,65535,61277,35732,46392,65535,50617,31474,31474,48537,65535,48472,31474,31442,29361,29362,29362,31442,44182,63390,61278,52762,33619,57020,63455,37845,29329,33523,59132,63390,37780,33587,50617,63422,61245,61245,61278,35955,12714,12746,12746,12746,12779,12779,12779,12779,14860,27345,33555,25264,14860},
-	{4488,6504,4488,4489,4521,4521,4521,4489,6537,4489,2441,23505,65535,63422,57148,57148,61342,42423,6667,8780,55036,59229,10893,31924,65535,34004,2474,2474,36117,65535,29779,15054,61342,52923,10763,27471,61309,48534,14598,12485,12485,12485,12485,12517,12485,12485,12485,12485,12550,12616,12616,12648,8585,8585,6569,4554,4521,29811,65535,36117,4522,4554,4554,4554,4554,4554,6602,6602,6602,14826,23019,20971,23019,27147,21003,18987,18987,25231,29361,29361,29361,29361,29361,29361,29361,29360,29360,29360,29361,29361,29360,29360,29361,39989,44246,33586,29360,29360,35731,44246,37876,29360,29392,42133,42166,31473,27280,35763,44278,35763,27312,27312,27312,27312,31505,44214,40053,31569,42134,39991,48505,46361,37878,37846,46360,50586,48538,46294,46197,35570,33360,37682,46262,42005,35570,35537,35505,35570,35571,37683,46295,48408,48408,48440,46198,33326,33261,33457,35603,35538,33424,35538,44183,48538,48505,48278,48440,39990,35700,35570,37748,46327,44118,35635,35667,35635,35700,37814,35506,35441,35440,35505,44084,46229,44052,35441,39730,46165,39665,33197,33230,41810,46165,39633,33230,35407,46132,46165,46165,48311,44086,35506,33458,29361,31474,35700,31506,42102,46359,48505,48537,48537,46424,37877,35764,35764,42134,48537,48505,48505,48505,42102,35764,37909,48472,46360,35796,35764,35764,35764,35764,35764,44279,48505,48505,48505,46424,33651,31505,31473,35731,44278,44278,44278,44278,39989,31505,31538,42166,46392,37877,35764,37845,46392,46360,33618,31474,31474,29393,29361,29361,29361,39957,44279,44279,33619,33619,44247,39957,29361,29361,35700,44279,37877,29361,31442,42102,44279,44279,44279,44247,42134,31442,35732,44247,37844,29329,29329,37812,44247,35764,29329,29362,29362,31410,31410,29362,33587,44215,46327,39990,31442,42070,44215,33555,29330,31410,42070,44215,33523,29330,37780,46295,46295,46296,42166,23311,12746,12746,12746,12747,12779,12779,12779,12779,12779,16908,25167,14828,12779},
-	{2440,6406,8454,8519,8519,8519,8519,8520,8552,4521,2441,23505,65535,50810,23505,23473,23505,15086,2474,6634,21360,21392,6667,12973,23505,12973,2506,4554,15054,23505,10893,6667,21424,19280,4554,12778,27503,25390,12550,12485,12517,12518,12518,12517,12517,12517,12517,12517,12550,12616,12616,10568,8585,6537,6569,10601,4521,12973,25553,15053,4554,4554,4554,4554,4554,6602,20971,23051,23019,27115,27147,27147,27147,21035,18987,18987,18987,25230,29361,29361,29361,29361,29361,29360,29361,29361,29361,29361,29360,29360,29360,29360,29360,29328,29328,29360,29360,29360,29360,27280,29360,29360,27312,27280,27280,27312,27312,27312,27280,25231,23117,23150,27311,27312,31538,33620,27312,27311,31539,35700,35668,37813,37846,37846,37846,37814,37814,35635,33360,33392,33392,33392,33392,33490,35603,35570,35570,35570,35603,35603,35570,35570,35538,35538,35538,35537,33391,33457,35603,35538,35505,35538,35635,35797,35571,37197,35441,37846,35700,35570,35538,33490,35538,35603,35667,35635,35700,37813,35506,35473,35505,33425,33360,35635,35570,33360,33230,31117,33197,33229,33229,33230,33197,33230,33230,33197,33197,33197,33197,35506,35701,37781,37781,31507,31474,37814,31474,29361,29361,33587,35732,35732,35732,35764,35764,35764,35732,35732,35732,35732,35732,35732,35764,35732,35732,35732,35764,33619,29425,31473,29425,29425,29425,29425,29393,29393,29393,29360,29360,29360,29360,29360,29360,29360,29360,29360,29360,29360,29361,29393,31473,31473,31473,29393,29393,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29329,29361,29361,29362,29329,29329,29361,29361,29361,29329,29361,29329,29329,29329,29362,29362,29329,29329,29329,29362,29362,29362,29362,31410,31410,29362,29329,29329,29330,31410,29330,29330,29330,31410,29330,29330,29330,29330,31410,29330,29330,29330,31378,23119,12746,12746,12778,12746,12779,14827,12779,12779,12779,12779,12779,14828,12779,12779},
-	{2440,8421,10437,10437,10437,10437,10469,10502,6504,4521,2441,23505,65535,42423,2473,2441,2473,2474,4522,4522,2474,2474,2474,2474,2474,2474,4554,4554,2474,2474,2474,2506,2474,2474,2506,4521,8585,12746,10470,10437,10502,10536,10536,10535,10567,12615,12583,12583,12615,12616,12616,10568,8585,6537,6569,10600,4554,4554,2473,4522,4554,4554,4554,4554,4554,6602,25067,23051,25099,25099,21035,18987,18987,16939,16939,18987,18987,23150,29360,29361,29360,29360,29360,29361,29361,29360,29360,29361,29361,29360,29360,29360,29360,29360,29360,29360,29360,29360,29360,29360,29360,29360,29360,27312,27312,27312,27312,27312,27279,23117,21037,21037,23117,25231,33619,35701,29360,27312,33619,35700,35668,37813,37846,37846,37846,35733,35733,37813,37781,35505,33392,33425,35538,35570,35571,35538,35538,35570,35603,35602,35602,35603,35408,35473,35603,35603,33424,33457,35570,35538,35505,35570,35667,37846,37781,37392,37684,37846,35700,35570,35570,35570,35570,35603,35635,35668,37813,37813,35570,35506,35505,35473,33327,35635,37813,35538,33230,33197,33197,33230,33262,35408,33295,33197,33197,33197,33197,33197,33198,35538,37846,37814,37846,33587,31474,35733,31442,29361,29361,29393,31441,31441,31441,31441,31441,31441,31441,29393,29393,29393,29393,29393,29393,29393,29393,29393,29393,29393,29361,29360,29360,29360,29360,29360,29360,29360,29360,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29362,29361,29361,29361,29361,29362,29362,29361,29362,29362,29361,29361,29361,29361,29362,29362,29362,29362,29362,29362,29361,29362,29362,29362,29362,31410,31410,31410,31410,29362,31410,31410,31410,31410,31410,29330,31410,31410,29330,31378,31410,31410,29329,27281,27248,16908,12778,12778,12778,12779,12779,14827,12779,12779,12779,12779,12779,12779,12779,12779},
-	{4488,8421,10437,10469,10469,10469,10437,8454,4521,4521,2441,23505,65535,44471,4554,2474,2474,4522,2474,2474,4554,4554,2506,2506,4554,4554,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,6634,10730,10470,10437,10502,10568,10568,10568,10568,10568,10568,10568,10568,12616,12616,10600,8585,8585,6569,6569,4554,4554,4554,4554,4554,4554,4554,4554,4554,6602,23019,21003,16939,18987,16939,16939,16939,16939,16939,18987,18987,18988,27312,29361,29360,29360,29360,29360,29361,29361,29360,29361,29360,29360,29360,29360,29360,29360,29360,29360,29360,29360,29360,29360,29360,27312,27280,27312,27312,27312,27312,25198,21037,21037,21037,21037,21037,23117,31538,33587,27312,29425,37813,35700,35667,37813,37846,37846,37846,35732,35733,37813,37846,35505,33392,35505,35505,35538,35570,35570,35570,35570,35570,35570,35570,35603,37424,35408,35570,35570,33391,33425,35570,35570,35538,35570,35667,37846,37846,37456,37748,37846,35700,35570,35538,35538,35570,35603,35635,35668,37813,37846,37814,37813,35603,35538,35537,37781,35635,35636,35440,35408,35408,33295,33263,35441,33295,33198,33198,33197,33165,33197,33230,35570,35701,35668,35701,33587,31474,37813,33490,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29360,29360,29361,29360,29360,29360,29360,29360,29360,29360,29360,29360,29360,29361,29361,29360,29360,29360,29360,29360,29360,29361,29361,29361,29361,29360,27312,27280,27280,29360,29361,29361,29361,29361,29361,29361,29361,29361,29328,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29361,29362,29362,29362,29362,29362,29362,29362,29362,29362,29362,29362,29362,29362,29362,29362,29362,29362,29361,29361,29361,29361,29361,29361,29361,29362,29362,31410,31410,31410,31410,29362,31410,31410,31410,31410,31410,29330,31410,31378,29362,31410,29362,27281,18989,14827,14827,12779,12779,12779,12779,12779,14827,14827,12779,12779,12779,12779,12779,12779,12779,12779},
-	{6504,8454,10502,10535,10535,10535,10470,8421,4488,4521,2441,23473,63455,42391,4554,2474,2474,2474,2474,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,8649,10469,10437,10502,10568,10568,10600,10632,10632,10568,10567,10567,10567,10567,10568,8584,8552,8552,8584,4521,4553,4553,4553,4554,4554,4554,4554,4554,6602,23019,21003,16939,16939,16939,16939,16939,16939,16939,16939,16939,18987,25231,29361,29361,29361,29361,29360,29361,29361,29360,29360,29360,29360,29360,29360,29360,29360,29360,29360,29360,29360,29360,29360,27312,33650,42198,35795,27312,27279,25263,35891,35859,23149,21037,21037,23150,21069,29425,33587,23150,29392,37813,35668,35667,37813,37781,37781,37846,37781,35732,37813,37846,35505,33393,33425,33392,33457,33457,33489,33489,35570,35603,35603,35602,35570,35408,41875,48375,39892,31279,33457,35635,35603,35668,35538,35635,37845,37813,37456,37748,37846,35733,35635,35635,35635,35603,35603,35668,35700,37845,37846,37846,35733,37813,37813,37813,37846,37846,37846,37814,37814,37814,35538,35376,35473,33360,33360,35473,41907,46132,37618,33263,35570,37748,35636,35700,33587,31474,35733,33523,29361,29361,29361,29361,29361,31473,42102,42134,31473,35796,35763,31473,42134,42101,29425,37876,44246,44246,44246,44246,44246,33650,33586,37940,29361,29360,29360,33618,44246,37908,29361,29360,29361,29361,29361,29361,29361,27280,25134,23085,23085,25134,27279,27280,29328,29361,29361,29361,29361,27280,25166,27247,27280,27280,27280,27280,27280,27280,27280,27280,27280,27280,27280,27280,29329,29329,29329,29329,29329,29329,29329,29361,29362,29362,29362,29362,29362,29362,29362,29362,29362,29362,29362,29362,29362,29362,29362,29362,29362,29362,31410,31410,31410,29362,29362,31410,31410,31410,31410,29330,29362,31410,29329,25167,16908,14827,12779,12779,12779,12779,12779,12779,12779,14827,14827,12779,12779,12779,12779,12779,12779,12779,12779},
-	{8487,10535,10535,10535,10535,10535,10502,8454,6472,6536,6504,10795,21359,15053,2474,2474,2474,2474,2474,2506,2474,2474,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,8649,10469,10437,10502,10568,10568,10730,12843,10762,10665,10600,10567,10567,10567,10567,8552,6569,6569,4553,4553,4553,4553,4553,4554,4554,4554,4554,4554,6602,23018,21003,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,19020,25230,25230,25231,29360,29361,29361,29360,29360,29360,29360,29360,29360,29360,29360,29360,29360,29360,29360,29360,29360,29360,27280,44246,65535,48569,27279,21037,27375,61277,59164,25262,21036,23117,31539,25198,29425,33554,21037,25231,35765,35668,35667,35733,35700,35668,33652,31538,35700,35700,37813,35668,35505,33392,33392,33457,33457,35635,35668,35668,35733,35700,35602,35538,33392,50520,65535,48505,35635,35668,37845,35700,35700,35635,35700,37845,37813,37586,37781,37845,37845,35733,35732,37781,35733,35668,35700,35700,37813,35733,37814,35570,35733,37846,37846,37846,37846,37846,37846,37846,37846,35668,35539,35539,35474,35571,37813,56988,65535,46296,33360,35603,37716,35636,37748,33555,31474,37813,35668,29393,29361,29361,29361,29361,33586,61245,61310,33618,48472,46424,33651,61310,59197,31538,46391,61245,63390,65535,61310,59165,39989,37908,54939,33650,29361,29360,40021,65535,52794,29361,29361,29361,29361,29361,29361,29360,25166,23085,23085,23085,23085,23085,23085,25166,27279,27279,27247,27248,25166,23085,23086,23086,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,27215,27248,27248,27248,27248,27248,27248,27248,27248,27248,27248,29361,29362,29362,29362,29362,31410,31410,31410,29362,31410,31410,29362,29362,31410,31410,31410,31410,31410,31410,29362,21070,14827,12779,12779,12779,12779,12779,12779,12779,12779,14827,14827,14827,14827,12779,12779,12779,12779,12779,12779,12779},
-	{6503,6504,6504,6504,6504,6504,8520,4488,6504,10535,10535,8520,4456,2473,2474,2474,2474,2474,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,8649,10469,10437,10502,10567,10567,10729,10794,10794,12843,10632,10600,10665,10665,10665,8552,8552,6537,2505,4553,4553,4554,4554,4553,4553,4554,4554,4554,6602,23018,21035,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,18987,23149,23150,27312,29360,29360,29360,29360,29360,29360,29360,29360,29360,27312,23150,23150,23150,23150,23150,23150,42198,65535,48569,25231,23118,27375,61277,59164,25262,21036,25231,35733,25198,29425,35667,29425,31506,37813,35668,35635,35667,35667,35667,29425,29425,35700,35635,35700,35733,35538,33425,33392,33457,33457,37781,37845,37845,37845,35733,35602,35538,33360,50520,65535,50586,35765,37845,37845,37813,37813,35797,35797,37845,37813,37651,37781,37845,37813,35700,35635,35667,37813,37813,35733,35668,35765,35700,37813,35635,35668,35732,35732,35732,37781,37846,37845,37846,37846,35668,35539,35539,35506,35571,37748,56955,65535,46296,35506,37748,35668,35636,37748,35538,33425,35701,33555,27280,29361,29361,29361,29361,33586,61245,61310,33618,48472,46424,33651,61310,59197,31538,31473,31538,52762,65535,44311,31505,29393,37908,63422,52794,29425,29360,40053,65535,52794,29360,27247,27279,29361,29361,29361,25199,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23086,23086,23086,23086,23086,23086,23086,23086,23086,23086,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25102,25134,25134,25102,25134,25134,25134,27216,27248,27248,27248,27248,29329,27248,29329,31410,29362,29362,29362,29362,31410,31410,31410,31410,31410,27281,21070,14860,12779,12779,12779,12779,12779,12779,12779,12779,12779,12779,12779,14827,14827,12779,12779,12779,12779,12779,12779,12779},
-	{2472,2472,2473,2473,2473,2473,4489,4521,4489,6504,10536,8520,4489,4521,2474,2474,2474,2506,2474,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,4618,4618,2506,2506,2506,8649,8421,8389,8454,8519,8519,10729,10794,10794,10795,10730,10730,10795,10794,10762,10600,10568,4521,2505,2505,2505,2505,2473,2473,4553,4553,4553,4553,6602,23018,21003,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,21069,23149,23149,23149,23149,23149,27312,29360,27312,23117,21069,16939,16939,16907,16939,16939,16939,38036,65535,48536,27279,27279,29456,61277,59164,25262,18956,25198,33652,23150,29425,35700,35700,35700,35733,35667,35635,35635,35635,35635,29392,31538,35700,35635,35635,35635,35538,33457,33392,33457,33457,35667,35700,35733,35765,35733,33522,33522,33424,50520,65535,50586,35733,35765,35733,35668,35668,35733,35765,35765,35765,37456,35668,35765,37813,35700,35635,35635,35733,37813,37813,37813,35765,35765,35765,35668,35635,35635,35635,35635,35668,37814,35765,35765,35765,35636,35539,35539,35538,35603,35668,54907,65535,44183,35571,35701,35668,35636,35668,35506,33360,35700,33522,25134,25167,27280,29361,29361,33586,61245,61310,33619,48472,46424,33651,61310,59197,31538,29361,29361,50649,65535,40053,25166,25166,35795,63455,63390,46423,25166,37940,65535,52761,25166,23085,25166,25199,25199,25167,23086,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23086,23086,23086,23086,23086,23086,23086,23086,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25102,25102,25102,25135,25135,25102,27183,27216,29329,29362,23151,21070,21070,25199,31410,27248,18989,18989,14827,14827,14827,14827,14827,14827,14827,12779,12779,12779,12779,12779,12779,14827,14827,12779,12779,12779,12779,12779,12779,12779},
-	{2473,2473,2473,2473,2473,2473,2473,2473,2473,2473,4488,4489,2473,2473,2473,2473,2473,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,2506,4618,4618,2506,458,2506,6601,10501,10500,10533,8454,8519,10729,10794,10794,10794,10794,10794,10794,10794,10794,10665,8519,4488,6536,4521,2505,6634,8779,8779,8779,8779,8779,8779,8714,23018,21003,14891,16939,16939,16939,16939,16939,16939,16939,16939,16971,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,21069,21101,21101,31729,38100,38100,38100,38035,21165,16939,25390,48664,65535,57019,44310,35827,31569,61277,61310,42262,40117,42230,44279,27312,33587,35635,44182,48472,48505,48473,48440,39892,35635,39957,44310,42166,42070,48472,48472,44150,35538,33457,33392,33457,35569,46327,48472,48505,48537,48537,46359,37780,35667,50585,65535,48505,35700,35667,37812,46392,48472,48505,50586,46360,35732,35667,44248,48505,39925,35635,35635,44215,48505,39990,35668,39958,48505,48505,48505,48505,42070,35635,37748,46360,46360,39925,48441,50585,48473,37748,35538,35538,35571,31506,42102,61245,65535,54810,48473,39926,35603,39861,48473,48408,48343,50553,42070,27182,27215,25167,25199,25167,29425,59197,61310,33619,48472,44311,29457,61309,59164,29392,25166,25167,48568,65535,37972,23053,23053,33714,63454,65535,59164,35794,35827,65535,50681,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23086,23086,23086,23085,23086,23086,23086,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25102,25134,25134,25102,25134,25134,25102,25102,25135,18990,14860,12779,12779,14860,27280,23119,10698,12779,14827,14827,14827,14827,14827,14827,14827,14827,14827,12779,12779,12779,14827,14827,14827,12779,12779,12779,12779,12779,12779,12779},
-	{2472,2473,2473,2473,2473,2473,2473,2473,2473,2473,2473,2473,2473,2473,2473,2473,2473,2506,2506,2506,2473,2474,2474,2474,2506,2506,2505,2506,458,458,458,2506,2538,4586,2505,457,2506,6601,10565,21028,18916,8421,8421,10664,10795,10794,10794,10794,10794,10794,10794,10794,10697,8519,4521,4521,2505,4488,27665,55035,55003,55003,55003,55003,55035,35890,23018,16843,10667,12715,12715,12715,12715,12715,12715,12715,14827,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,25358,54970,59229,57083,57084,61309,33874,16971,31761,61277,65535,61342,59164,44278,31569,61277,65503,61245,59197,61278,61245,39957,35635,39860,56987,61310,59165,59165,63390,48440,35667,44279,65535,54939,46392,59165,61245,50585,35538,33522,35668,35700,37812,59165,65535,61245,59165,61277,61310,42070,35765,52730,65535,48472,33586,35635,39957,57052,59165,59165,61278,59197,42102,35797,54940,65535,44182,33554,35667,57020,65503,44215,35700,50553,63390,59165,59165,63358,54875,37780,37812,61277,63358,46328,57020,61245,54907,35635,35538,31409,33522,29425,48536,63423,65535,61278,59165,42070,37425,48279,63390,59165,59132,61277,56923,35537,31312,25134,23086,23086,27312,59165,61310,33618,46423,44278,27376,61309,59164,27311,23085,23085,48536,65535,37972,23053,23053,33714,63454,63390,61277,54906,42198,65535,50681,23085,23085,23085,23086,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23086,23086,23086,23085,23086,23086,23086,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25102,25102,25134,25134,25134,25102,25134,18957,12811,12811,14859,14859,12811,16908,14860,12779,14859,14827,14859,14827,14827,14827,14827,14827,14827,14827,12779,14827,14827,14827,14827,14827,12779,12779,12779,12779,12779,12779,12779},
-	{2440,2472,2473,2473,2473,2473,2473,2473,2473,2473,2473,2473,2473,2473,2473,2473,2473,2473,2473,2473,2473,2473,2505,2505,2505,2505,457,457,458,458,458,458,457,6536,4488,2505,4586,8682,10597,21060,18948,8421,8389,8454,10730,10794,10794,10794,10794,10794,10794,10794,10697,8519,4520,2473,4521,4520,15085,29811,29811,31858,52793,65535,52793,31502,18890,10634,10603,14667,14667,14667,10635,10635,10635,10635,10635,12715,12715,12715,12715,14827,16971,16971,16971,16971,16939,16971,16971,16971,16939,19020,48632,63454,33809,19084,23245,54971,61309,27471,16939,38100,65535,46519,27343,27344,33618,61309,61277,39990,37846,42135,63390,59100,37553,52633,65535,48440,37845,37845,56988,63422,37940,42166,65535,65503,50649,35699,37779,35700,35700,35732,35765,35765,37845,59165,63390,42037,37780,42103,61310,61245,39958,50682,65535,48505,33587,35635,35700,37780,37812,37812,44280,63422,57020,37813,54907,65535,44182,35667,35764,57020,65503,42167,46328,63455,54875,37812,37780,50553,65535,50585,37780,61277,65535,59133,39925,37780,33619,29393,31441,29361,29361,27312,29457,54907,65535,46295,35732,35668,42005,63390,57052,39926,37781,46327,65503,52730,33392,27182,23118,23086,27312,59165,61309,29489,46391,44310,29456,61309,59164,27311,23085,23085,48536,65535,37972,23053,23053,33714,65503,54874,37940,63390,63422,65535,50681,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23086,23086,23086,23085,23085,23086,23086,25134,25134,23086,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25135,25135,25134,25102,25134,25134,25134,25134,21005,14860,12811,14859,14859,14859,14859,12811,12779,12779,14827,14827,14859,14827,14827,14827,14827,14827,14827,12779,14827,14827,14827,14827,14827,14827,12779,12779,12779,12779,12779,12779,12779},
-	{2472,2472,2473,2473,2473,2473,2473,2473,2473,2473,2473,2473,2473,2473,2473,2473,2473,2473,2473,2473,425,425,457,457,457,425,425,425,458,457,425,425,425,6472,8520,8649,8682,8682,10631,14724,14692,8388,8388,8389,8519,8746,8746,10794,10794,10794,10794,10794,10729,8584,8584,8552,8519,4488,2473,2473,425,19084,50648,57084,29553,10602,12683,10603,10603,12651,12651,12651,10635,10635,12683,12683,10635,10635,10635,10635,10635,14795,16939,16908,16908,16939,16971,16971,16971,16971,16939,19020,50777,65503,29616,16907,19052,54938,63422,27503,14859,35987,65535,44406,16939,21101,31569,61309,61277,37909,35733,39958,63422,59165,37715,54810,65535,61245,57052,57052,63390,65503,37940,40085,65535,57019,35795,31473,35635,35700,35732,35732,35732,35732,37845,59197,63390,39892,33587,37909,61310,61310,37910,50650,65535,48505,35700,33587,37877,54907,57052,57052,59165,65535,59132,37586,54842,65535,44182,33619,35699,57020,65503,42102,44247,65535,63358,57052,57020,61277,65535,50650,37780,61277,63390,44215,35700,35733,33619,29425,29426,29425,25231,25231,27312,52794,65535,42102,27312,27280,37908,65503,56988,35765,33652,44279,65535,52762,27280,25231,23118,23086,27312,59164,65503,54971,61245,59197,54971,65503,59164,27311,23085,23085,48536,65535,37972,23053,23053,33714,65503,52826,27311,44278,65503,65535,50681,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23086,23086,23086,23086,23086,23086,23086,23086,23086,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,23086,23086,23086,25134,25134,25134,25134,25134,25134,25135,25135,25134,25134,25134,25134,25134,23054,14860,12812,12812,12811,14859,14859,14859,12811,14859,14859,14859,14859,14859,14827,14827,14827,14827,14827,14827,14827,14827,14827,14827,14827,14827,14827,12779,12779,12779,12779,12779,12779,12779},
-	{2440,2473,2473,2473,2473,4488,4488,4488,2473,2473,2473,2473,4586,8779,8779,8779,8779,6666,2505,2506,6731,6731,2506,425,2506,6731,6731,2506,457,4618,6763,6763,8747,12778,10632,8520,10603,14796,12712,12679,12679,12679,12647,8421,8421,8584,8681,10762,8746,8714,8714,8714,8650,10698,10698,10601,8520,4520,2505,2505,4586,38165,65535,42230,14732,12587,14636,14636,14636,14636,14668,14668,12651,12651,16716,16684,12651,10635,10635,10635,12683,12683,12683,14700,18764,16876,16971,16971,16971,16971,16939,19020,50777,65503,29616,14859,19052,54938,63422,27503,14858,35987,65535,44406,14858,14891,23278,61277,61277,35795,31538,37876,63422,59132,33618,52762,65535,54907,50617,50617,50585,50585,33650,35891,65535,52794,33554,31473,31474,33554,35538,35538,35538,33522,37683,59165,63390,39795,33457,37747,61277,61310,37877,50585,65535,48440,33522,35732,50650,61277,50649,50617,52794,65535,59133,37812,54875,65535,44182,33587,33587,56987,65503,39989,44247,65535,59165,50585,50585,50585,50585,44150,35731,61277,61310,37812,33587,33652,31538,25263,27345,29393,25231,25231,25264,52794,65535,37940,25199,25199,35860,65503,54906,29458,27312,37972,65535,50713,25263,25231,23118,23086,27312,59164,65535,63390,48536,48536,63422,65535,59164,27311,23053,23053,48536,65535,37972,21005,21005,33714,65503,52826,23118,29424,50681,65535,50681,23086,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23086,23085,23085,23085,23086,23086,23086,23086,23086,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,23086,16908,14860,18989,25134,25134,25134,25134,25135,25135,25135,25135,25135,25135,25134,25134,25134,21038,14860,12812,12811,12811,12811,14859,14859,14859,14859,14859,14859,14859,14859,14827,14827,14827,14827,14827,14827,14827,14827,14827,14827,14827,14827,14827,12779,12779,12779,12779,12779,12779,12779},
-	{6472,4488,2472,2473,2472,8519,8487,8519,4456,2473,2473,425,21392,55036,55068,55068,57116,34036,425,6699,46649,50842,8844,425,8812,50810,48729,6731,425,27730,57116,55068,55036,57084,29681,6439,16942,52859,57083,57083,57083,57083,46454,10534,8388,8388,8486,8552,8616,23407,29713,27633,27505,14764,10539,10539,8554,4521,4521,2440,29745,61342,65535,61310,33779,12587,14636,14636,14636,14636,14636,16684,16684,16684,16684,16684,14668,12651,12683,12683,14700,14699,14699,16748,16812,16939,16971,16939,16939,16971,16939,16972,44406,61342,38068,27503,29616,57051,55003,25390,14859,31761,59229,48664,27503,21197,21229,59229,59197,27408,23150,31633,63390,57084,25327,44342,63390,48504,39989,39990,39957,35667,27312,35891,65535,52794,33554,25263,27344,33554,35473,35440,35440,33489,37585,59165,63390,46101,41843,44085,61277,57020,35764,46359,63390,52697,35699,37877,59132,61245,42102,39989,40150,63455,59133,35797,50617,63390,48440,39924,42069,59132,65503,41940,42005,61245,54907,39957,39989,42037,35732,29393,29489,59197,61309,37812,29393,25231,25231,25231,27312,27312,25231,25231,25264,46456,63390,44310,33715,27344,33715,59164,57019,35827,33715,44343,63390,46423,25263,25231,23150,23086,27279,52794,63422,52826,27311,27311,54874,63422,50713,25231,27344,31601,52761,65535,44342,31569,25230,33714,65503,52826,25166,23053,33681,59164,50681,23086,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23086,23086,23085,23085,23085,23085,23085,23086,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,23086,16941,12812,12812,14860,21038,25134,25134,25134,25134,25135,25103,25135,25135,25135,25134,25134,23086,14860,12812,12812,12811,12811,12812,14860,14860,14860,14859,14859,14859,14859,14859,14859,14859,14859,14827,14827,14827,14827,14827,14827,14827,14827,14827,14827,12779,12779,12779,12779,12779,12779,12779},
-	{8454,8519,4488,4488,4456,6504,6504,6504,4488,2473,425,15085,50810,50842,27698,25617,42423,57116,23537,6731,55036,59229,8877,425,8844,59229,57116,6763,425,10957,25617,25617,27600,48632,54970,23310,16974,61310,59197,33812,29617,38035,59196,35921,8453,8388,8388,8388,10501,46487,59197,59197,54971,21102,10539,10539,8554,6504,6504,6504,23179,37905,37841,50681,54971,27409,12587,14636,14636,14636,14636,14636,14636,16684,16684,16684,16684,16716,12651,14699,16716,16684,16716,16875,16939,16939,16939,16939,16939,16939,16939,16939,19084,50745,61342,61277,61309,61277,29616,16939,16939,16971,36019,61342,61309,40181,21197,57116,57084,27407,23149,29553,61277,54971,25295,23214,48633,63390,61309,61309,61277,40021,27311,35891,63422,52762,33554,25263,27344,31473,33554,33554,33554,33554,35699,59165,65535,63390,61310,63358,59164,37909,33619,33586,50617,63422,46327,33619,39989,61277,63358,61310,61310,63422,57020,35764,35699,54907,63390,61309,63358,65503,63422,41907,33392,46230,63390,61310,61310,63390,46423,23182,27408,57084,59164,31570,25231,23183,25231,25231,25231,25231,25231,25231,25231,27344,52794,63390,61277,35827,25231,37940,61310,61309,61309,63390,50713,27344,25231,25231,25231,25199,23086,29456,54874,29489,23086,23086,31537,52826,27376,23085,44342,61309,63390,63422,61310,61277,35827,33681,63390,52761,25166,23085,23085,37972,48568,23086,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23086,23086,23086,23085,23085,23085,23085,23085,23086,25134,25134,23086,23086,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,23086,14892,12844,12844,12812,16908,23086,25134,23086,18989,18989,25134,21038,18957,18989,21038,25134,21005,12812,12812,12811,12811,12812,12812,14860,14860,14860,14860,14860,14860,14859,14859,14859,14859,14859,14827,14859,14827,14827,14827,14827,14827,14827,14827,14827,12779,12779,12779,12779,12779,12779,12779},
-	{8421,8486,8519,8519,6471,2440,2473,2473,2473,2473,392,23504,65535,42423,425,392,17198,44504,25617,6731,55036,59229,8876,425,8844,59229,57116,6763,425,10925,21457,23472,25455,46551,65535,31794,16974,61310,54971,10636,6344,19018,63422,50745,8485,6340,8388,8388,8389,14795,16910,16910,16910,12652,10539,10539,8554,4488,4488,6504,14663,22888,18760,42165,65535,37972,12555,14635,14636,14636,14636,14636,14636,14636,16684,16684,16684,16716,12651,14700,16716,16684,16844,16939,16939,16939,16939,16939,16939,16939,16971,16939,16971,25358,27504,27535,29615,27503,19084,16939,16939,16939,21165,27503,27503,21229,17003,25423,25423,21133,23182,25262,31665,29553,23214,23182,27472,31665,31665,31665,31665,27375,25262,25327,31665,31601,29393,23182,27311,27312,33522,33554,33554,31473,31537,59164,63422,40085,35827,37908,35795,31570,33619,33554,35731,39989,37812,33619,35667,39924,39957,40021,33779,35860,35828,33652,33587,37876,39989,39957,39989,59132,65503,42069,31441,33618,35827,35828,35827,39957,29521,23183,25263,31634,31634,25263,23183,25231,25231,25231,25231,25231,25231,25231,25231,25232,31570,33747,33715,27377,25232,27377,33715,33715,33715,33747,31570,25231,25231,25231,25231,25231,23118,23118,29425,23087,23055,23086,25198,29456,23118,23085,27376,31601,31601,31601,31601,31601,25263,25230,31601,29456,23085,23085,23085,27279,29424,23085,23085,23085,23085,23086,23086,23086,23086,23085,23085,23085,23085,23085,23086,23085,23085,23085,23085,23086,25134,23086,23086,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,18989,14860,12812,12844,12812,12812,16909,23086,18989,12812,12812,16941,14860,12812,12812,14892,18989,16909,12812,12811,12811,12812,12812,12812,14860,14860,14860,14860,14860,14860,14859,14859,14859,14859,14859,14859,14827,14859,14827,14827,14827,14827,14827,14827,14827,12779,12779,12779,12779,12779,12779,10698},
-	{4423,6471,6471,4456,2440,2473,2473,2473,425,425,392,21456,65535,42423,457,425,4618,8844,4651,6731,55036,59229,8876,425,8844,59229,57116,6763,4586,36085,61342,57116,57116,61341,65535,31794,16974,61310,54971,12717,6376,23212,63422,50745,8485,6340,8388,8388,8389,8457,8491,8491,10539,10539,10539,10539,8522,6504,8649,14890,16841,18793,14634,40117,65535,37972,12555,14635,14636,14636,14636,14636,14636,14636,14636,14636,16684,14636,12651,14668,16684,14700,14859,16939,16939,16939,16939,16971,16971,16971,16939,16939,16939,16939,16939,19083,23306,16971,16939,16939,16939,16971,14891,14891,14891,14891,14891,14890,14890,16971,21101,23182,21102,23181,23182,23182,23181,21101,23181,21133,21133,23182,23182,23181,21101,23182,25262,23182,27311,25263,29392,33554,33522,27311,25327,57084,61342,29553,23182,25263,27312,25296,31506,27344,25263,25263,29425,33586,33554,33521,33521,31506,21134,27377,31506,33651,33586,31506,31441,31441,33522,56987,65503,39989,29392,27312,27312,27312,29392,31474,23183,23183,23183,23183,23183,23183,23183,23183,25231,25231,25231,25231,25231,25232,25232,25231,25231,25231,25231,25232,25232,25232,25231,25231,25231,25199,19021,19053,19053,19053,19053,19021,18957,14731,12522,14636,18926,18989,18989,18988,18989,18989,16940,16940,16940,18988,18988,18988,18988,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23086,23085,23086,23086,23086,23085,23086,23086,23085,23085,23085,23086,25134,23086,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,21037,14892,12844,12844,12844,12844,12812,12812,16941,14860,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,14860,14860,14860,14860,14860,14860,14860,14859,14859,14859,14859,14859,14827,14827,14827,14827,14827,14827,14827,14827,14827,14827,12779,12779,12779,12779,12779,8617},
-	{2440,4456,4456,2472,2473,2473,2473,2473,425,425,392,21424,65535,42423,2505,425,23537,59229,34004,6731,55035,59229,10924,425,8844,59229,57116,6731,27697,63390,40245,12810,12810,40245,65535,31794,16974,61310,54971,12717,6376,23245,63422,50745,8485,6340,6340,8388,8422,8490,10539,10539,10539,10539,10539,10539,10537,8487,31696,59196,40050,14666,10539,40117,65535,35924,12555,14635,14636,14636,14636,14636,14636,14636,14636,14636,14636,14636,12651,16684,16684,12651,12715,12715,12747,16939,16939,16939,16939,16939,12747,12715,12747,14827,16939,16971,17003,16971,16939,16939,16971,16939,14891,14923,14923,14891,14891,14891,14891,14891,16971,23181,23182,23182,23182,23182,23182,23182,23182,23182,23182,23182,23182,23182,23181,23181,23182,25263,25262,23182,23214,25263,25263,23182,25327,57084,61342,29553,21133,23182,23182,23214,27344,23182,21134,21134,23182,29393,33521,31473,31473,31538,23214,29457,33586,33619,33586,37908,42069,42069,40021,57052,57051,31634,23183,23215,23215,23215,25263,25264,23183,23183,23183,23183,23183,23183,23183,23183,23183,25231,25231,25231,25231,25232,25232,25232,25232,25232,25232,25232,25232,25232,25232,25231,25231,23183,16972,14924,14924,14924,14924,14924,12651,12555,12588,16749,16782,14763,14924,16972,16972,16972,16972,16972,16972,16972,16972,16972,16972,21037,23085,23085,23085,23085,19022,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,23086,23086,23086,23086,23086,23085,23086,23085,23085,23085,23086,25134,23086,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,18989,12844,12844,12812,12844,12844,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,14860,14860,14860,14860,14860,14860,14860,14859,14859,14859,14859,14859,14827,14827,14827,14827,14827,14827,14827,14827,14827,14827,12779,12779,12779,12779,12779,8617},
-	{6373,6438,4456,2440,2440,2473,2473,425,425,425,425,6731,38229,57148,44536,44536,52955,48729,13037,2538,23537,57148,48729,44536,46649,63454,55068,6731,12875,46519,57083,46519,46519,57083,65535,31794,16974,61310,54971,12717,6376,23212,63422,50745,8485,6340,6340,6373,8490,8491,8491,8491,8491,10539,10539,10539,10537,8519,16970,46519,59132,48600,48568,57084,46520,21038,12587,12587,12587,14636,14636,14636,14636,14636,14636,14636,14636,14636,12651,16684,16684,12652,12651,10635,10635,10667,12715,12715,10667,10667,12683,14668,10635,10667,12714,14827,16939,16971,16939,16939,14891,14923,14891,14891,14891,14891,14891,14891,14891,14891,16971,21133,21133,21133,23182,23182,23182,23182,23182,23182,23182,23182,23181,23182,23182,23181,23182,23214,23182,21133,21134,23182,23182,23182,25327,54971,59196,29520,21133,21134,21134,23182,23182,21134,21134,21134,21134,27344,31473,25263,27344,31538,23214,23215,27376,33619,33586,52794,63358,61309,61309,61277,33779,21134,21134,21134,21134,21134,21135,23183,23183,23183,23183,23183,23183,23183,23183,23183,23183,25231,25231,25231,25232,23183,23183,23183,23183,23183,23183,23183,25231,25231,21102,16973,16973,16973,16973,16941,16941,16941,16941,16941,18926,18862,25038,16749,12522,14731,16973,25198,29295,29295,29295,29295,29295,27247,19020,16972,16972,21037,23085,23085,23085,23086,14991,21070,23085,23085,23085,23085,23085,23086,23085,23085,23085,23085,23085,23086,23086,23086,23085,23086,23086,23086,23086,23086,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,18989,12844,12844,12811,12844,12844,12844,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,14860,12812,14860,14860,14860,14860,14860,14859,14859,14860,14859,14859,14827,14859,14827,14827,14827,12778,14827,14827,14827,14827,14827,14827,14827,12779,10698,8585},
-	{8388,8454,4456,4456,4456,2473,424,424,425,425,425,392,13037,40342,42391,40343,42423,23537,425,425,4618,34037,42423,40343,44536,63422,57116,6763,2408,23342,42358,44406,44406,42358,42358,21294,8779,38198,36021,10604,6376,14792,42260,33841,8453,6340,6340,8456,8491,8491,8491,8491,8491,10539,10539,10539,10537,8519,8487,27438,48503,44407,46455,46456,27409,12555,12587,12587,12587,14635,14635,14636,14636,14636,14636,14636,14636,14636,14636,16684,16684,12652,12619,10635,10635,10635,12651,12651,12651,10635,10635,10635,10635,10635,10635,10667,14859,16971,14891,14891,14891,14891,14891,14891,14891,14891,14891,14891,14891,14890,14923,19020,14891,14891,19053,21133,23182,23181,23182,23182,23182,23182,23181,23182,23182,23182,21133,23181,23182,21134,23182,23182,23182,23182,23214,29520,29553,23214,21134,21134,21134,21134,21134,21134,21134,21134,21134,23182,23182,21134,25263,31506,25295,29457,31506,33619,31506,35764,37844,35795,29585,29585,23247,21134,21134,21134,21134,23182,23183,23183,23183,23183,23183,23183,23183,23183,23183,23183,23183,25231,25232,23183,23183,16973,14892,14924,14925,14925,14925,16973,16973,21102,16973,14924,14924,16941,27150,25102,25102,25102,25102,25102,27053,25038,27053,18797,10442,18796,27151,31311,31247,31247,29199,29199,29199,29199,23053,18988,18988,23085,23085,23085,23086,18990,12846,16942,23085,23085,23086,23085,23085,23086,23085,23085,23085,23085,23085,23086,23086,23086,23086,23086,23086,23086,23086,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,18989,16940,14892,12844,12844,12844,12844,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,14860,14860,14860,14860,14860,14860,14860,14859,14859,14860,14860,14859,14827,14859,14827,14827,14827,14827,14827,12779,12779,12779,12779,12779,12747,10698,8585,8585},
-	{8388,8421,4455,2472,4456,2440,424,424,424,425,425,425,425,425,425,425,425,425,425,457,425,425,425,425,8844,59229,57116,6763,425,4456,6471,6471,6471,6471,6471,2440,457,2441,4523,6441,6373,6340,6340,6340,6340,6340,6340,8457,8491,8491,8491,8491,10539,10539,10539,10539,8489,10567,16777,18825,18826,10539,10539,10539,12587,12587,12587,12587,12587,12587,14635,14635,14636,14636,14636,14636,14636,14636,14636,16684,16684,12619,12620,10635,12651,14667,16684,16684,16684,14668,10635,10635,10635,10635,10634,10634,12747,18988,19020,19020,19020,19020,19020,16971,14891,14891,14891,14891,14859,14827,14827,14827,14827,14890,14890,16972,23181,23182,23182,23182,23182,23182,23182,23182,23182,21134,23182,21133,21133,23182,21133,21134,21134,21134,21134,21134,21134,21134,21134,23182,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,25263,31506,27344,31506,31506,33619,31506,31506,29393,23183,21102,21134,21134,21134,21134,21134,21134,23183,21135,23183,23183,23183,23183,23183,23183,23183,23183,23183,23183,23183,21102,14925,12844,12844,12844,12844,12844,12844,12844,14892,14924,14925,14925,14924,14924,16941,21038,16941,16941,16940,16941,16940,22987,16943,12684,14636,14603,25038,31279,31279,29199,29167,29167,29167,29167,29167,25102,18988,18989,23085,23085,23085,23085,14894,527,8750,23086,23086,23086,23085,23085,23085,23085,23086,23086,23086,23086,23085,23085,23085,23085,23085,23085,21037,21037,23085,23085,23085,23085,23085,23085,23085,23085,23085,23085,25134,25134,25134,25134,25134,25134,25134,25134,25134,25134,27183,31312,31344,29263,14892,16941,18989,14892,12844,12844,12812,12812,12812,12812,12812,12812,12812,12844,12812,12812,12812,12812,12812,12812,12812,14860,14860,14860,14860,14860,14860,14860,14860,14859,14859,14859,14859,14860,14859,14859,14859,14827,14827,14827,14827,12779,8617,8617,8617,8617,8617,8585,8585,8585,8585},
-	{8388,8421,6471,2440,4455,4456,2440,2440,2440,4456,424,425,425,425,425,425,425,425,425,425,457,2505,2538,457,8876,59229,55036,6763,425,2473,6471,6471,6471,6471,6471,2440,457,457,459,2375,6406,6340,6340,6340,6340,6340,6340,8457,8490,8457,8457,8457,8457,8490,8523,8523,8522,8552,16777,20905,18826,10539,10539,10539,12587,12587,12587,12587,12587,12587,12587,14635,14635,14636,14636,14636,14636,14636,14636,14636,14636,12619,12652,12651,16684,16684,16684,14668,14668,14667,10635,10635,10635,12651,10635,16844,21005,29295,31343,29294,29262,29262,29294,21068,16907,19053,21102,21101,18926,18894,18894,18894,18926,19021,19053,21134,25263,23182,23182,23182,23181,23182,23182,23181,21134,21134,23182,21134,23181,23182,23182,23182,23182,23182,23182,23182,23182,23182,23182,23182,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,25263,27344,25263,29425,27377,29457,27377,29393,27312,21134,21134,21134,21134,21134,21134,21134,21135,23183,23183,23183,23183,23183,23183,23183,23183,23183,23183,23183,23183,21103,12844,12844,12844,12844,12844,12844,12844,12844,12844,14892,14892,14924,14924,14924,14924,14924,14925,14925,14924,14924,14924,14924,12910,2836,4590,12490,22665,29036,29199,31279,29199,29167,29167,29167,29167,29166,23053,18989,18989,23085,23085,23086,17007,12911,689,10864,23086,23085,23085,23085,23085,23085,23085,23086,23085,23085,23086,23086,23086,23086,23085,18988,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16940,21037,25134,25134,25134,25134,25134,25134,25134,25134,27215,33360,33360,33328,29231,16940,27215,33360,23086,16941,12844,12844,12844,12844,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,12812,14860,14860,14860,14860,14860,14860,14860,14859,14859,14859,14859,14859,14859,14859,14859,14827,14827,12779,10698,8617,8617,8617,8617,8617,8585,8585,8585,8585,8585},
-	{8388,8389,8454,6439,6439,6438,6438,6439,6439,6471,2440,2440,2440,2440,425,425,425,425,425,425,4650,40342,46649,46649,50810,57148,21456,2537,457,425,6471,6471,6471,6471,6471,4456,425,458,458,457,2407,6340,6340,6340,6340,6340,6340,8457,8457,6341,6340,6340,8389,8455,8555,8555,8555,6537,14761,20905,18826,10538,10539,10539,10539,12587,12587,12587,12587,12587,12587,12587,12587,14635,14635,14636,14636,14636,14636,14636,14636,12651,12651,12620,16684,16684,14668,10635,10635,10635,10635,10635,10635,10603,14699,25101,27182,27182,29262,29198,27117,27117,27181,18956,16876,23183,23215,27345,31475,31475,29427,29427,29427,29427,29459,27345,23183,19052,19052,21133,21133,23182,23182,23182,21134,21134,23182,23182,23182,21133,19052,17004,17004,17004,17004,17004,17004,17004,17004,21133,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,23215,23183,21134,21134,21134,21134,23215,21134,21134,21134,21134,21134,21134,21134,21135,23183,23183,23183,23183,23183,23183,23183,23183,23183,23183,23183,25231,21135,12844,12844,12844,12844,12844,12844,12844,12844,12844,14892,14892,14924,14924,14925,14924,14925,14925,14924,14924,14924,14924,14924,16908,18731,20714,24648,28678,28937,29199,27182,23054,23053,23053,23053,23053,23053,21037,18989,16940,21037,23085,23086,8881,4850,557,10896,23086,23085,23085,23086,23086,23086,23086,23086,23085,23086,23086,23085,21037,21037,16940,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16940,18989,23086,25134,25134,25134,25134,25134,25134,31312,33295,33328,31215,29199,16940,27215,33328,33296,27150,16908,14892,12844,12844,12812,12844,12844,12812,14892,21103,21104,21104,21104,23152,23152,23152,16941,12812,14860,14860,14860,14860,14860,14860,14859,14859,14859,14859,14859,14827,14827,14859,14827,12779,10666,8617,8617,8617,8617,8617,8617,8617,8617,8585,8585,8585},
-	{8389,4358,4423,4455,4455,6471,6438,6438,6438,6438,6471,2408,2408,2440,425,425,425,425,425,425,4618,31956,38230,38230,38230,31956,4618,425,457,425,4423,6471,6471,6471,6471,4423,425,458,2507,2408,4390,6340,6340,6340,6340,6340,6340,8423,8422,6340,8421,12583,10502,8421,6506,6539,6507,6537,8618,18858,18826,12651,10571,10539,10539,10539,12587,12587,12587,12587,12587,12587,12587,12587,14635,14635,14636,14636,14636,14636,14636,12619,12651,12619,14636,16684,14668,10635,10635,12651,12651,12651,10635,10603,12651,14763,16811,18860,27117,22989,18892,18892,27215,29328,25231,23215,23215,27345,29426,23215,27378,27345,21135,21135,23183,17005,12842,12842,12842,16972,17004,16972,16972,19053,23182,23182,21133,17004,16972,14923,12842,12842,12842,10794,10762,10794,10762,10762,12842,21133,23182,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21135,23183,21135,23183,23183,23183,23183,23183,23183,19053,16973,16973,16973,16973,12843,12844,12844,12844,12844,12844,12844,12844,12844,12844,12844,12844,14892,14924,14924,14924,14924,14924,14924,14924,14924,14924,18890,28709,30725,30725,30790,31115,25101,16940,14892,14924,14924,14892,14892,16940,18988,14892,14924,16940,18989,18989,17006,10928,4720,10896,23085,23085,23085,23086,23086,23086,23086,23086,23086,23085,21037,18988,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16940,16940,18988,23086,25134,25134,25134,25134,25134,31312,33295,33328,31215,29199,16940,27183,31183,31183,31183,18957,12844,12844,12812,12844,12812,12812,12812,21103,33524,27314,23184,23184,23184,23184,23184,14893,12812,14860,14860,14860,14860,14860,14860,14859,14859,14859,14859,14859,14827,14859,14859,12778,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8585,8585,8585},
-	{6340,2407,424,424,392,6471,6438,6438,6438,6438,6471,2408,4455,2440,425,425,425,425,425,425,457,425,425,425,425,425,425,457,457,424,6471,6471,6471,6471,6471,4489,2507,2507,6440,6341,6340,6340,6340,6340,6340,6340,6340,6340,6340,6340,8421,16744,14664,8389,6506,4556,6539,6537,10666,16810,16778,14764,12619,10539,10539,10539,12587,12587,12587,12587,12587,12587,12587,12587,12587,14635,14636,14636,14636,14636,14636,12651,12651,12619,14636,14636,14668,10635,10603,14636,14636,14636,16748,21005,23053,23053,21005,25101,27117,18892,8586,10667,23184,23183,21134,21134,21134,21134,19053,14891,19053,16972,12842,12842,12842,12842,12842,12842,12842,12842,12842,12842,12810,14891,16971,16971,14923,12842,12842,12842,12842,12810,12842,10794,10794,10794,10762,10762,10762,14923,16971,21133,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21135,23183,23183,23183,23183,23183,23183,23183,19054,10763,8715,10763,10763,10763,10795,10795,10796,12844,12844,12844,12844,12844,12844,12844,12844,12844,12844,14892,14925,14925,14924,14924,14924,14924,14924,14924,23144,30854,30758,30758,30855,33195,18956,14924,14924,14924,14924,14892,14892,14892,14892,14892,14924,14892,14892,14892,16940,25037,26957,25006,23085,23085,23086,23086,23086,23085,23085,23085,23085,21037,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16940,16940,16940,18956,16940,16940,23085,25134,25134,25134,25134,25134,31312,33328,33328,31215,29166,16940,27183,31183,31183,31183,18957,12844,12844,12844,12844,16941,25135,25233,31475,33525,21103,12812,12812,12812,12812,12812,12811,12812,14860,14860,14860,14860,14860,14860,14860,14859,14859,14859,14859,14859,14859,12779,10697,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8585,8585,8585},
-	{6340,4325,4390,4423,4423,6438,6438,6438,6438,6438,6471,2440,2440,2440,424,425,425,425,425,425,425,425,425,425,425,425,425,457,425,2440,6471,6471,6471,6471,6471,4489,2507,4424,6373,6373,6373,6373,6341,6340,6340,6340,6341,6372,6340,6340,10501,16777,14664,8389,6507,4556,6539,8585,12714,12746,10634,16812,14764,10539,10539,10539,10539,10539,12587,12587,12587,12587,12587,12587,12587,12587,14635,14635,14635,14636,14636,12651,12651,12619,14636,14636,14667,8587,10603,14636,14636,14636,18796,29262,29198,29198,29198,27150,27118,18892,14763,10667,21103,14859,12842,12842,12842,12842,12842,12842,12842,12842,12842,12842,12842,12842,12842,12842,12842,12842,12842,12842,12842,12810,12810,12842,12842,12842,12842,12842,12842,12810,10794,10762,10794,10762,10762,10762,10762,10761,12810,19053,21134,21134,21133,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,23183,16973,8715,10763,10763,10763,10763,10795,10795,10796,10796,12844,12844,12844,12844,12844,12844,12844,12844,12844,14892,14892,14924,14924,14924,14924,14924,14924,14924,23240,29193,33163,33163,33163,33227,18988,14924,14924,14924,14924,14924,14924,14924,14892,14892,14924,14924,14892,14892,16972,25004,33004,27021,23086,23086,23085,23085,23085,23085,23085,23085,18988,16940,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,21005,27182,27214,27214,29263,29262,29263,27215,23085,25134,25134,25134,25134,31311,33295,33328,31215,29166,16908,27183,31183,31183,31183,18957,12844,14892,12844,14860,20973,27119,33426,33557,33459,29232,27183,27248,27314,27314,23152,12811,12779,10731,10730,10731,12812,14860,12779,10698,10698,10698,10698,10698,10698,12778,10698,8617,8617,8617,8617,8617,8617,8617,8617,8585,8585,8585,8585,8585,8585},
-	{6340,6340,6373,6438,6438,6438,6438,6438,6438,6439,6439,4423,4455,4456,424,425,425,425,425,425,457,457,425,425,457,457,457,457,2440,4423,6471,6471,6471,6471,6471,6471,4423,6373,4391,2474,2474,4489,6373,6340,6340,6340,6439,6439,6373,6373,10535,16810,14663,8389,6507,4588,4588,6635,6636,12779,12747,18924,16844,14731,12619,10539,10539,10539,12587,12587,12587,12587,12587,12587,12587,12587,12587,12587,14635,14635,14635,12619,12619,12619,14636,14636,12619,10603,10603,14636,14636,14636,18796,27182,27117,27117,27117,27117,27117,18892,18892,12715,21103,10699,10698,10666,10666,10666,10666,10666,8618,8618,10698,10730,10762,12842,12842,12842,12842,12842,12842,12842,12810,12810,12842,12842,12842,12842,12842,12842,12842,12810,10762,10794,10794,10762,10762,10762,10761,10761,10762,12842,12842,12842,12842,14923,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,16972,10762,12811,10763,12811,12811,12811,12811,12843,12843,10763,8715,8715,10763,10763,10763,10763,10763,10796,10796,10796,12844,12844,12844,12844,12844,12844,12844,12844,12844,12844,12844,12844,12844,12844,14892,14924,14925,14859,22889,35276,33228,33228,33228,20972,14892,14924,14924,14924,14924,14924,14924,14924,14924,14924,14924,14924,14892,14892,21005,27021,23053,23086,23085,23085,23085,21037,16940,16940,16940,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,14859,14764,29231,33359,33327,33327,33327,31247,33360,27215,25134,25134,25134,25134,31279,31215,33328,31215,29166,18957,31279,31183,31183,31183,21005,16908,23021,16876,14828,27086,29135,33329,33525,33426,33263,33263,33329,35540,33426,31280,27182,25167,14827,8649,8650,10698,10698,8650,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8585,8617,8617,8585,8585,8584},
-	{6340,6340,6340,6373,6405,6406,6406,6438,6438,6438,4390,19116,46551,31826,424,425,425,425,425,4618,38230,40342,6731,425,457,457,457,424,4423,6471,6471,6471,6471,6471,6471,6471,6438,6374,4456,492,2540,2507,6406,6340,6340,6340,4424,2507,2507,2507,4555,6603,8454,6406,4458,19313,46617,46649,46649,48665,31762,16875,16844,16812,12619,10539,10539,10539,10539,12619,16780,16780,14667,14667,14668,14667,12587,12587,12587,12587,14635,12587,12619,12587,14636,14636,12619,12619,12651,14635,14636,14636,18796,27182,27117,27117,27117,27117,27117,18860,20940,16844,21071,12715,8586,8586,8586,8586,8586,8586,8586,8586,8618,8618,10762,12842,10698,12810,12842,12842,12842,12842,12746,12810,12842,12842,12842,12842,12842,12810,12810,12842,10794,10762,10794,10794,10762,10761,10761,10761,10761,10761,10761,10729,8681,12842,19053,19085,19085,19085,19085,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,14892,8681,8682,8682,8682,8682,8682,8682,8682,8714,8715,8715,8715,8715,10763,10763,10763,10763,10763,10764,10796,10796,12844,12844,12844,12844,12844,12844,12844,12844,12844,12844,12844,12844,12844,14892,14892,14924,14796,22858,35275,33227,33195,33131,29035,14892,14924,12844,14892,14892,16940,16940,16940,14892,16940,16940,16940,16972,16940,21037,23085,23085,23085,23085,23085,21037,16940,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,18988,18988,18988,23052,16907,12715,12683,29198,33295,33263,31215,33295,31214,33295,29231,25134,25134,25134,25134,31279,31215,31247,31215,29166,25134,33328,31183,31183,31183,18957,14860,27118,29134,27086,31183,31183,31216,33459,33426,31183,31183,31216,35540,33361,31183,20973,12779,10698,8650,8650,8650,8650,8617,8617,8649,8649,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8585,8617,8617,8585,8585,8584},
-	{6340,6340,6340,6373,6405,6405,6405,6438,6438,6438,4358,25455,65535,42423,424,425,425,425,424,6731,55036,59229,8844,425,457,425,424,2440,4423,6471,6471,6471,6471,6471,6471,6471,4489,2507,2508,2540,2540,2540,4489,6406,6406,4391,2507,2540,2540,2540,2540,2540,2507,2507,12974,44504,55068,40343,40311,52891,50810,25424,20972,18924,12619,10539,10539,10539,10539,12619,16812,16812,14731,18892,21005,18924,16747,14667,12587,12587,12587,12587,14635,14635,14635,14635,14635,12619,12619,14635,14635,14636,18796,27182,27117,25069,25069,25069,27117,18892,20940,18892,21071,16844,14763,10634,8586,10634,8586,8586,8586,8586,10730,12842,12842,10762,8650,12842,12842,12842,12842,12842,12810,12842,12842,12842,12842,12842,12842,12810,12810,10794,10794,10762,10794,10762,10762,10761,10761,10762,10761,10761,10761,10761,10729,10761,10762,10762,10762,10762,10762,17004,19053,21134,21134,21134,21134,21134,21134,21134,21134,21134,21134,23215,19117,10827,8682,8682,8682,8682,8682,8682,8714,8714,8715,8715,8715,8715,8715,10763,10763,10763,10763,10764,10796,10796,12844,12844,12844,12877,17070,14989,12844,12844,12844,12844,12844,12844,12844,12844,12844,14892,16845,24907,33131,33131,33099,33003,28971,14892,12844,16973,21166,25230,25102,27118,27150,21005,25102,27118,29198,29263,29263,29263,23086,21037,23085,23085,21037,16940,14891,14891,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,16939,21036,31343,31311,31311,33359,20973,10635,20909,33327,33295,33295,33295,31215,31182,31214,25101,23086,25134,25134,25134,31247,31214,22926,31182,31183,31247,33295,31183,31183,31183,18957,14860,27118,33231,31183,31183,31183,31183,33427,33426,31183,31183,31249,35540,33329,31182,20941,8650,8650,8650,8650,8650,8650,8649,8617,8649,8649,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8585,8617,8617,8584,8584,8584},
-	{6340,6340,6340,6373,6373,6405,4357,4390,4390,6439,4390,25455,65535,42423,424,425,425,425,424,6731,55036,59229,8844,425,425,2440,4423,4423,4423,6439,6471,6471,6471,6471,6471,6471,4522,2540,2540,2540,2540,2540,2540,2507,2507,2507,2540,2540,2540,2540,2540,2540,2540,2508,21426,55036,34037,2540,2507,29812,65535,38198,14827,16876,14731,14731,12619,12651,14699,14731,16844,18892,21005,21005,21005,21005,21005,16812,14668,12587,12587,12587,12587,12587,12587,12587,12587,12587,12587,14635,14635,14635,18796,27182,25069,25069,25069,25069,25069,18892,20940,20940,21103,18892,25069,18892,14763,23021,12715,8586,8586,10634,16907,16971,16971,16939,16939,14891,12842,12842,12842,12842,12842,12842,12842,12842,12842,12842,12842,12810,12842,10794,10794,10794,10794,10762,10762,10762,10761,10761,10761,10761,10761,10761,10761,8681,8681,8681,8681,8681,8681,8713,10762,16972,19053,21134,21134,21134,21134,21134,21134,19053,16973,29617,57084,42358,8714,8682,8682,8682,8682,8682,8714,8714,8714,8715,8715,8715,8715,10763,10763,10763,10763,10764,10764,10764,10796,10796,10764,23408,55036,44439,12877,12844,12844,12844,12844,12844,12844,12844,12844,12844,14731,22794,30955,30955,30955,33003,28971,14892,12844,25295,54939,50745,21134,25070,25102,18989,25101,29166,29199,31279,29166,29231,23086,21037,21037,21037,16940,14891,14891,14891,14891,14891,14891,16939,16939,16939,16939,16939,16939,16939,16939,16939,21036,33359,33327,33295,33327,20941,10635,20941,33327,31214,31214,31215,31215,31183,31182,23021,21037,25134,25134,25134,31247,31182,24974,31183,31183,33295,33295,31183,31183,31183,20973,14860,27118,31183,31183,31183,31183,31183,33459,33426,31183,31183,33427,35573,33329,31183,16844,8650,8650,8650,8650,8650,8650,8649,8617,8649,8649,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8584,8584,8584},
-	{6340,6340,6340,6340,6373,4357,6405,4390,4391,4391,4390,25455,65535,44471,2505,2537,2537,457,424,6731,55036,59229,8876,425,2505,6536,6471,6471,6471,6471,8552,6471,6471,6471,8552,6536,4620,2573,2573,2540,2540,2540,2540,2540,2540,492,2508,492,2508,2540,2540,2540,2540,2540,4620,8813,8813,4620,4588,31892,65535,36118,2507,8684,10668,10668,12780,12812,14860,14860,14860,14860,14860,14860,14861,18957,21005,21005,18925,16780,12587,12587,12587,12587,14667,12587,12587,12587,12587,12587,14635,12587,16748,27149,25069,25069,25069,25069,25069,16844,20940,25069,25199,16844,25069,25069,25069,25069,12715,12715,14763,18892,27181,27181,27181,27181,27181,21036,14891,16971,19019,16939,12842,10794,12842,12842,12842,12842,12842,12810,12842,10794,10794,10794,10762,10762,10762,10762,10761,10761,10761,10761,10761,10761,10761,8681,8681,8681,8681,8681,8681,8681,8681,8681,8714,16972,21134,21134,21134,21134,21134,10762,6601,25520,65535,48664,8714,8682,8682,8682,8682,8682,8714,8715,8715,8715,8715,8715,8715,8715,10763,10763,10763,10764,10796,10764,10796,10796,10764,25521,65503,50745,12877,12844,12844,12844,12844,12844,12844,12844,12844,12844,16780,24875,30955,30955,30955,33003,28971,14892,12844,21263,61309,57116,17069,14892,14892,14892,16940,23053,29198,29198,29166,29231,23086,21037,21037,16940,14891,14891,14891,14891,14891,14891,14891,14891,16939,16939,16939,16939,16907,14827,14827,14827,18956,31246,31214,31214,31214,20909,10635,20909,31214,31182,31182,31182,31215,31214,31182,25069,21037,25134,25134,25134,29166,31183,27054,31183,31183,33263,31215,31183,31183,31183,29134,18957,27118,31183,31183,31183,31183,31183,33459,33426,31183,31183,33427,35573,33329,31183,16844,8650,8650,8650,8650,8650,8650,8649,8617,8649,8649,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8616,8616,8584,8584,8584},
-	{6373,6373,6373,6373,4358,4390,4358,4390,4390,4390,4358,25455,65535,59229,48729,48729,48729,27730,392,6698,55035,59229,10859,360,25520,50745,27568,4391,4391,29648,50745,25422,4358,12842,46551,50745,48730,48762,36150,2572,2540,2540,2540,2540,2540,10926,15120,15120,13071,6701,2540,2540,2540,2540,2507,19313,48730,48730,48730,57116,46617,13006,2540,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,10732,12813,12813,14861,21005,16812,16780,16780,16812,18893,16812,16780,16780,16780,14699,12587,12587,16748,27149,25069,25069,25069,25037,25069,16843,20940,25069,23151,16844,25037,27180,33516,25133,18892,20972,18956,18956,18956,18956,18923,18955,25101,25133,16939,19020,21068,16939,10762,10762,10762,10762,10762,10794,12842,10762,10762,10762,10762,10762,10762,10762,10762,10761,10761,10761,10729,10729,8681,8681,10761,8681,8681,8681,8681,8681,8681,8681,8681,8681,8681,12811,21134,21134,21134,21134,21134,10762,6601,23439,65535,46616,8714,8682,16908,16908,16908,16908,16908,16876,14796,16844,16844,16876,18957,18989,18989,16941,10763,8715,10764,10764,10764,10796,10764,25521,65503,50746,12877,12844,12844,12844,12844,12844,12844,12844,12844,12844,18926,26956,30954,30954,30955,30923,28971,14892,12844,21230,61309,57116,17069,12843,12844,12844,14892,16908,27182,29198,29134,29231,23085,21037,18989,14891,14891,14891,14891,14859,14859,14859,14859,14891,14891,16939,16939,14859,12747,12715,10635,10603,20973,31247,31182,31182,31182,20909,8555,20876,31182,31182,31182,31182,31182,31182,31182,25038,23054,25134,25134,25102,29166,31183,27022,31183,31183,31183,31183,31183,31183,31183,31183,27086,29134,31183,31183,31183,31183,31183,33459,33426,31183,31183,33427,35573,33329,31183,16843,8650,8650,8650,8650,8650,8649,8649,8649,8649,8649,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8616,8616,8584,8584,8584},
-	{6438,6438,6438,4390,4390,4390,4390,4390,4390,4390,4358,25455,65535,55035,38164,38132,50745,52890,19246,10729,57083,59229,14890,4358,33906,65535,35987,4391,4391,38100,65535,31793,8616,38100,57148,38231,36150,44505,55068,25619,2572,2540,2540,2540,2572,40344,59261,59229,57148,17232,2508,2540,2540,2508,13007,44537,55036,38230,38230,38230,21425,2508,2540,2540,2540,4588,4588,4588,4588,4588,4588,4588,4588,8651,10699,4588,4588,4588,6636,10765,12812,12813,12813,12812,12812,12813,12812,16909,21005,18892,14667,14668,21038,29327,25069,25069,25101,29327,27214,16843,20940,29294,29457,23182,29327,29358,27245,25069,27181,23214,14987,10794,10794,14987,17100,14955,16939,19020,14890,10794,10794,12874,17100,17100,17100,17100,14988,12842,10794,12842,17036,17068,17068,17068,17068,12842,10762,12875,17068,17068,17068,17068,17068,12874,8681,10762,14987,15020,15019,15019,15020,12907,8681,8649,6569,14924,25328,25328,25360,27440,23214,10762,8714,27665,65535,50777,15020,17004,27149,27150,27150,27118,27118,27150,29295,29296,31376,31376,31376,27151,27150,27183,21070,17038,14957,14958,14958,10764,8619,25489,65503,48698,12877,10701,8621,14958,19150,17102,19150,17102,12877,12844,18925,27053,35245,35245,35245,35245,31116,14860,12844,25456,61309,57116,23375,21166,14892,12843,18956,21005,27150,33424,33424,31343,23085,21037,21166,19149,16972,14891,16972,21197,21197,21197,21197,19084,14891,16939,19085,19053,12715,10667,10667,16941,31408,31247,33327,35472,33327,23054,16941,25166,33295,31182,31182,31182,31182,31182,33295,27215,25263,29392,29392,27279,29166,31183,35440,35472,33295,35408,33295,35440,35441,33263,33296,35473,35473,35441,35441,35441,33296,31183,33459,33426,31183,31183,33427,35573,33329,31182,16843,8649,8650,8650,8650,8649,8649,8617,8649,8649,8649,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8584,8616,8617,8617,8584,8584,8584},
-	{4390,4390,4390,4390,4390,4390,4390,4390,4390,4390,4358,25455,65535,44438,4390,2310,27600,65535,40213,10697,57083,59229,12842,4358,33906,65535,35987,4391,4391,38100,65535,31761,14955,61341,55036,17265,13072,25651,63455,48762,4653,2540,2540,2540,2540,13039,19345,19313,17265,6733,2540,2540,2540,2507,25619,65535,40343,2508,2508,2508,2540,8651,4588,2540,2540,4588,4588,4588,4588,4588,4588,4588,4588,8651,8651,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,8684,18957,21005,16844,27408,57084,50648,25101,22988,35697,59164,48503,16843,21005,52729,59197,59164,59196,57019,29391,22988,40020,59229,36019,10794,10794,36052,59229,31858,10762,10794,10794,10794,10762,23406,57083,57148,57148,59196,44439,12842,10762,14923,46584,59196,57116,57148,55003,19181,10729,31826,59196,57148,57116,57116,59196,31858,8681,17100,54970,57148,57116,57116,59196,46552,8650,6505,6505,42326,59197,59196,59197,59164,29618,8682,21326,59196,65535,63422,57148,46455,25069,25037,25037,25005,25005,29327,54907,61245,61245,61245,54874,29263,27086,27118,46359,59197,57116,57116,57116,25489,4427,23377,65503,48665,10700,6509,8590,44440,59197,57148,57148,55035,21296,12812,18893,37876,61212,61180,61180,61212,42100,12811,19150,54971,65535,63455,59229,50745,17037,12843,14892,16908,27150,48471,61245,33746,16908,16940,44439,57116,27536,12810,29649,57116,59196,59164,59196,42294,14859,16972,50745,54939,16973,8554,14893,52858,56955,33391,46262,61245,44052,46294,57148,59164,41940,31182,31182,31182,31182,31182,37650,59100,59165,59197,61245,50616,31247,33295,54745,59132,39763,52633,39763,54810,59100,35505,44053,61245,61213,61213,61213,61245,46198,31151,33459,33426,31183,31183,33426,33525,33329,31182,16843,8650,8650,8650,8649,8649,8649,8617,8649,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8585,8584,8584,8584,8584,8584},
-	{4390,4390,4390,4390,4390,4390,4390,4390,4390,4390,4358,25455,65535,44438,4423,4358,27600,65535,40213,10697,57083,59229,12842,4358,33906,65535,35987,4391,4391,38100,65535,29779,13006,61310,63455,59229,59229,59261,63422,46650,4653,2540,2540,2540,2540,492,460,460,460,2540,2540,2540,2540,2507,25619,65535,40343,2540,2540,4620,6701,6668,4588,2540,4588,4588,2540,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,8684,8684,8684,25457,65503,52826,23085,20972,35762,65535,52729,23053,44278,61277,44375,33778,42100,59164,48632,19116,38100,65535,40245,10794,10762,40245,65535,36051,10762,10794,10794,10762,19181,50777,55035,31858,29745,42326,59229,36052,12842,12842,25520,29745,29745,31858,57116,46584,14988,36019,65535,48696,29745,29745,48696,55035,25487,19181,61309,59229,31794,27569,36020,59197,36020,6538,31827,59197,44407,35924,38069,57084,52826,25294,19052,44342,65535,59100,39988,35665,25069,25005,25005,25005,27182,48536,61245,42101,39892,39924,37779,27119,27054,39956,61213,44440,29714,29747,52890,52890,17103,21297,65503,48665,8588,8557,35958,59197,38134,29715,31827,57084,48665,19150,29553,57019,54810,41907,39891,50681,57116,29682,14924,33940,63422,59229,35988,27601,12876,12843,12843,18956,27118,50617,65535,31795,12844,14924,50745,65535,27601,23343,52890,54971,33908,33875,46520,59196,33875,16973,57084,61309,19119,10667,19054,59197,61245,33424,48439,65535,59100,40117,29650,37875,35504,31182,31182,31182,31182,35505,54842,57052,33811,37940,46423,61277,46230,33327,56955,63422,41875,54842,41875,59068,63390,37585,46198,65535,48634,35796,44053,54810,59132,41876,33427,33426,31183,31183,33426,33525,33329,31182,16843,8650,8650,8650,8650,8650,8649,8617,8649,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8584,8584,8584,8584,8584},
-	{4390,4390,4390,4390,4390,4390,4390,4390,4390,4390,4358,25455,65535,44438,4390,2310,27600,65535,40213,10697,57083,59229,12842,4358,33906,65535,35987,4358,4358,38100,65535,27764,13039,61342,55068,19345,17232,17232,17232,13039,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2507,25619,65535,40343,2507,427,23506,50843,29812,2540,2540,2540,2540,2540,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4556,23409,65503,50746,14732,16779,35762,65535,52729,27181,54939,63422,33715,20908,25133,57052,61341,19213,36051,65535,38197,10762,10762,40245,65535,36051,10762,10794,10794,10762,25487,63454,50809,12874,10729,21261,44471,36019,12842,12842,25520,31793,29745,31858,59228,61341,19181,36019,65535,38164,8649,8649,38164,65535,33971,17101,61341,55003,10794,4456,17069,63422,50810,12812,50713,65535,33779,18989,23215,54939,63455,33714,14827,31633,65535,52761,25005,22989,25069,25005,25005,22957,27150,48504,61245,42101,39924,39924,37779,27118,25006,48472,65535,48536,35828,31795,52891,65535,27602,21297,65503,48665,8589,8558,48666,65535,38102,29715,31859,57148,63422,21296,33908,65535,44375,18796,18796,31666,46584,29714,10763,19182,61309,57116,14989,10763,12844,12876,12876,14893,16941,48600,65535,33908,14958,17070,50778,65535,29683,31795,65535,48665,17006,14926,33909,65535,46520,21232,57116,61310,25426,17007,23313,59229,61245,33424,48439,65535,59068,29489,8522,20876,31182,31182,31182,31182,31182,39730,65470,50778,12716,10635,31633,65535,54810,33327,56955,63422,41875,54842,41875,59068,63390,37585,46198,65535,38102,16717,31150,48343,65535,48310,33426,33426,31182,31183,33427,33525,33329,31182,16843,8650,8649,8649,8650,8649,8649,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8616,8584,8584,8584,8584,8584},
-	{4390,4390,4390,4390,4390,4390,4390,4390,4390,4390,4358,25454,65535,55003,36019,36019,48664,52922,21293,8584,33906,59196,38100,8616,19116,50777,50777,36019,36019,52858,48697,15119,6765,38231,57148,36150,34037,34038,25651,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2507,25619,65535,52955,36118,34038,48730,65535,36150,2507,2540,2540,2540,2540,4588,2540,2540,2540,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4556,19312,63455,50746,12651,12586,33681,65535,50681,25133,54939,63422,35795,22988,27213,57052,61309,17101,36019,65535,38197,10762,10762,40245,65535,36051,10762,10794,10794,10762,25487,63454,50810,12875,10762,12907,19181,17068,12842,19181,54971,59229,57116,57148,63455,61309,19181,36019,65535,38165,8649,8649,38165,65535,33939,17101,61341,55003,10730,4424,19150,63422,52890,21166,50746,65535,33843,21102,23215,54939,63455,31699,14860,31730,65535,52761,25037,25037,25069,22957,25005,25005,25005,27215,54874,59165,59164,61245,59164,33521,25038,48472,65535,61310,59165,59165,59165,59165,21297,21296,65503,48666,8557,8558,48698,65535,59229,57116,57116,57148,55003,19215,33908,65535,42359,12715,12585,14957,19182,14989,10763,19182,61309,57116,17102,12876,14957,14990,14990,14990,14990,46585,65535,31795,12781,14926,50778,65535,29683,31796,65535,48666,17039,17007,35989,65535,46521,21233,57116,61310,25458,17039,25425,59229,61245,29360,46391,65535,46229,18828,14731,29134,31182,31182,31182,31182,31182,39730,65470,52826,12716,8522,27473,65535,54810,33327,56955,63422,41875,54810,41875,59068,63390,33457,44149,65535,38102,16749,31150,48375,65535,48310,33426,33427,31183,31182,33427,33525,33328,31182,16843,8650,8650,8650,8650,8649,8649,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8584,8584,8584,8584,8584,8584,8584},
-	{4390,4390,4390,4390,4390,4390,4390,4390,4390,4390,4358,19149,50777,50777,52857,52857,52858,31793,4390,4390,8616,44471,46584,10729,4358,27568,50842,52858,52858,52857,25487,2474,460,10927,46650,50843,50843,52923,38263,4620,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2507,21361,50810,50810,50810,50810,50810,50810,27731,2475,2507,2507,2507,2507,2507,2540,2540,4588,2540,2540,2540,2540,2540,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,6636,4588,2507,19280,63422,52826,14764,10538,33681,65535,50681,25133,54906,63422,35795,23021,27246,57052,59261,14989,33907,65535,40245,10794,10794,40245,65535,36019,10761,10794,10794,10761,23407,63422,52858,14955,10794,25520,59228,44438,14955,46616,61342,27633,17068,21294,57084,61341,19181,33939,65535,38132,6505,6473,36053,65535,31827,14956,61309,54971,12779,8521,25327,63422,54939,25295,50746,65535,35892,21135,23247,54939,63422,31699,14860,31730,65503,52761,25069,25037,25037,25005,25005,25005,25005,25038,29295,29328,29296,35666,61277,54907,29231,48472,65535,44214,31344,31377,31377,29297,10637,21265,63455,48666,8558,8589,48698,63455,29683,17039,17071,17102,17070,10796,33908,65535,42326,12747,12618,33875,61309,36053,10796,21263,59261,57116,19216,14990,14990,14990,14990,14990,17038,46585,65535,31730,8522,14829,50778,65535,29683,31796,65535,48698,19119,17039,36021,65535,46520,21233,57084,61310,25458,19087,25457,59229,59197,23313,44408,65535,46197,18828,14731,31182,31182,31182,31182,31182,31182,39730,63422,52826,12748,10603,27537,65503,52761,33327,56923,63422,41875,54810,41875,59068,61310,19056,33844,65535,38102,16749,31150,48375,65535,48310,33426,33492,31248,31182,33426,33525,33329,31150,16843,8649,8649,8649,8649,8649,8649,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8584,8584,8584,8584,8584,8584,8584,8584},
-	{4390,4390,4390,4390,4390,4358,4390,4390,4390,4390,4390,6471,6503,8551,8551,8551,6503,6503,4391,4391,4456,4587,6569,4456,4391,6504,6602,8584,8584,6569,4554,2540,2540,2540,4653,4653,4653,4653,4620,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2475,4523,4556,6571,6571,6571,6571,6571,4491,2410,2410,2410,2410,4491,4491,2507,2540,4588,2540,2540,2540,2540,2540,2540,2540,2540,2540,4588,4588,4588,4588,4588,4588,4588,4588,8684,4588,4588,8781,34005,59229,48665,48601,54939,65535,50681,23052,31601,57084,57020,52761,54874,61277,31794,8650,14956,44471,57148,48697,48697,57148,44471,17069,8682,12810,16971,16939,21165,42229,59229,48729,48696,55003,57051,29584,19019,31697,57084,52890,48664,48729,63422,61309,19181,33907,65535,38101,6473,6473,36052,65535,35923,14957,61309,54971,16876,20875,31504,63422,54971,25295,25424,54971,57052,52826,52826,61309,42294,25328,14892,23247,44375,61277,52794,44213,22957,22957,25005,22957,27182,48504,52762,52762,52762,54874,61245,39892,27119,33489,54874,59100,52730,52762,52730,35635,18798,16879,40150,59229,35990,8589,23377,54972,52891,46585,48665,46584,19183,10764,17070,44375,59164,48633,48601,57084,46552,19183,14957,17070,33972,59229,52890,44440,17103,14990,14990,14990,14990,25490,52923,55003,48633,50713,61309,65503,29715,21232,42360,59229,50778,50778,57084,52891,27538,19120,33876,59197,54939,50778,52891,59229,35989,19120,44408,65535,46229,18828,14731,29134,31182,31182,31182,31182,31182,33327,46262,61277,48665,48633,54939,55003,29552,25101,39794,59132,56955,46165,52665,61277,33844,10637,33845,65535,38102,14669,29102,48375,65535,48310,33426,33427,31182,31182,33426,33525,31280,31150,16843,8649,8649,8649,8649,8586,8618,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8585,8585,8617,8584,8584,8584,8584,8584,8584,8584},
-	{4390,4390,4390,4390,4357,4324,4325,4357,4390,4390,4390,4390,4390,4390,4390,4390,4390,4390,4423,4456,2474,459,459,2507,4489,4456,2441,2442,4489,2507,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2508,2475,2508,2540,2540,2540,2540,2507,2443,2443,2443,2378,2378,2378,2378,2378,2378,2410,4458,4458,2443,2475,2508,2475,2508,2507,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,4588,4588,4588,4588,4588,4588,4588,4588,2507,12974,40279,42327,44375,52794,65535,50681,23020,14699,35924,48569,48536,48536,42262,12843,6537,6505,23376,42359,42359,42359,42358,21295,6505,6537,14827,27213,27181,27149,31472,48471,48536,50584,50584,42100,27181,27149,27181,44213,50584,50584,48535,48503,44342,14988,21295,42326,25456,6505,8554,25456,42326,29520,12811,38133,33940,8618,20875,29294,46422,40181,23215,16941,38037,48601,48601,48601,46520,27473,21102,14924,16973,27473,48503,48536,39988,22957,22957,25005,22957,27150,46327,48536,48504,48504,50552,46294,27151,25006,25006,39924,50585,50553,50553,50553,35602,27055,27055,33457,44408,31860,8653,8685,33909,44472,44440,44472,42359,17135,10829,10796,23344,42326,42326,46488,44374,25391,8651,14990,12909,19183,42359,46552,40246,17071,14990,14990,14990,14990,14958,35989,46520,44375,44440,59229,65503,31764,14958,25490,46520,46553,46553,46553,35957,17039,19087,21200,42295,46553,46553,46553,42328,21233,19088,33877,46553,33747,18990,16974,23119,23151,23151,27150,31182,29134,29134,35504,46391,44407,44407,44439,35987,12779,14859,27118,46230,50520,37553,46262,40215,14830,8492,23313,42328,27506,8524,18797,33650,44375,39795,33427,33394,31150,31182,33426,33525,31280,31150,16843,8649,8649,8649,8586,6411,8554,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8585,8584,8584,8584,8584,8584,8584,8584},
-	{4390,4390,4390,4423,4324,4292,4292,4292,4357,4390,4390,4390,4390,4390,4390,4390,4390,4423,2474,2507,2507,459,459,2507,2507,2474,2474,2507,2540,2508,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2475,2475,2443,2378,2443,2540,2540,2540,2540,2475,2475,2475,2475,2443,2410,2410,2410,4491,2475,2475,2475,2475,2508,2540,2475,2475,4523,2442,2507,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4588,4555,8522,10506,29585,65535,50681,23020,12619,10603,21102,14827,14826,10697,6569,6569,6537,6537,6537,6537,6537,6537,12714,14763,14763,20972,25101,25036,25069,25101,25036,25036,25036,25036,25036,25036,20972,16875,16875,16875,16875,16875,16875,12714,8618,6505,6505,6505,12682,16779,6473,6505,16779,12682,4425,4425,6505,20907,25004,18859,16908,23150,21135,21135,21134,21135,21134,23118,23150,23183,19053,21102,19022,21005,22957,22957,22957,22957,22957,22957,22957,22957,25005,25005,25006,25006,25006,25006,25006,25006,27054,27054,27054,27055,27055,27055,27087,20974,18925,12780,8716,10764,10764,10764,10764,10764,10764,10764,10796,12909,8650,8553,6440,8489,12619,8489,8553,12877,14989,14990,14990,14958,14958,14958,14990,14990,14990,14990,14990,17038,17039,14926,14894,17006,50778,65535,31764,17007,17039,17039,17039,17039,17039,17039,19087,19087,19087,19088,19087,19088,19088,19088,19088,19120,19088,19088,19088,19120,19120,19120,19120,19120,21136,23151,23152,23152,23152,18893,8587,10635,10667,10699,10667,14859,23021,31182,31182,31182,27054,10572,8524,8524,8524,8492,8524,8524,8524,8492,12620,29102,33427,33394,31150,31182,33426,33524,31280,31150,25069,21005,21004,10666,6411,6379,8554,8617,8617,8617,8617,8617,8617,8617,10698,8617,8617,8617,8617,10698,12780,14828,8618,8584,8584,8584,8584,8584,8584,8584},
-	{2376,2408,2440,2408,4292,4292,4292,4292,4324,4358,4390,4390,4390,4390,4390,4390,4423,2441,459,459,2507,2507,2507,459,459,2540,2540,2540,2508,2508,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2475,2410,2378,2378,2378,2411,2507,2507,2540,2540,2540,2540,2540,2540,2475,2410,2410,2411,2475,2507,2507,2540,2540,2540,2475,2410,4426,4426,2443,2540,2540,2507,4523,2507,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,4588,4588,4588,4588,4588,4588,4588,6668,10635,10571,31666,65535,50648,23020,12619,10570,19054,6633,4584,6632,6632,6601,6601,6601,6601,6601,14827,18956,25133,27181,27181,27213,25101,25036,25069,23052,16907,16907,16907,16907,16907,16907,12810,10762,10762,10762,10762,10762,10762,6537,6505,6505,6505,10602,20907,22955,10602,6505,16779,18827,6505,4425,6505,20907,25004,20907,20939,23021,23118,21135,23183,25166,25166,27181,25166,23183,23183,21102,18990,21038,22957,22957,22957,22957,22957,22957,22957,22957,25006,25006,25006,25006,25006,25006,25006,25006,27054,27055,27055,27055,27087,27087,27087,14829,8716,8716,10764,10764,10764,10764,10764,10764,10764,10764,10829,12909,8618,8520,8520,8489,8521,8553,12812,12942,14990,14989,14990,14990,14990,14990,14990,14990,14990,14990,14990,17038,17071,17071,17071,19152,50778,63455,29715,17007,17039,17039,17039,19087,19087,19087,19087,19087,19087,19088,19088,19088,19088,19088,19120,19120,19088,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19087,17007,19088,14861,8554,10635,14859,14859,25069,20877,16781,16749,10605,10637,10605,8524,8524,8524,8524,8524,8524,12620,29102,33394,31280,31150,31182,33426,33524,31248,31150,33327,35440,31311,10571,6379,6379,8554,8617,8617,8617,8617,8617,8617,14893,19055,16974,14860,19055,19055,19055,16942,16942,16941,8617,8617,8617,6536,8584,8584,8584},
-	{2311,4357,4358,4325,4357,4324,4292,4292,4292,4325,4390,4390,4390,4423,2441,2441,2474,459,459,2507,2507,2507,2507,459,459,2507,2507,2508,2540,2507,2540,2540,2540,2540,2540,2540,2540,2540,2540,2540,2475,2410,2379,2379,2379,2378,2378,2411,2443,2475,2443,2443,2508,2475,2443,2410,2410,2410,2443,2475,2475,2475,2443,2442,2442,2410,4426,2378,2410,2507,2475,2507,2443,4458,4490,2442,2475,4587,2540,2540,2540,2540,2540,2540,2540,2540,2540,4588,2540,4588,2540,2507,15119,48697,50746,50746,57084,54939,25263,14699,10538,10539,19022,6601,4521,4521,6569,6569,4521,4552,6600,6569,12778,25100,25101,25101,25101,27181,25101,23020,23021,23020,18955,12810,10794,10794,10794,10794,10794,10762,10762,10762,10762,10762,10730,6537,6505,6505,6505,12682,25004,25004,12682,4457,16779,22956,10602,4425,6505,20907,22956,22956,22956,22923,23053,21134,25198,27181,27149,25036,23085,19022,19022,18990,16942,21038,22957,22957,22957,22957,22957,22957,22957,22958,25006,25006,25006,25006,25006,25006,25006,25006,27055,27055,27055,29070,27055,27055,27055,18893,8684,8716,8716,8716,8716,8684,8716,8652,6571,8684,10860,12941,12909,10731,8585,8586,10796,12877,12909,12941,14989,14989,14989,14990,17070,14990,14990,14990,14990,14990,14990,17038,40214,52891,52891,52891,61309,40247,21232,17039,17039,17007,17039,17039,17039,19087,19087,19087,19088,19088,19088,19088,19088,19088,19120,19120,19088,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19088,16845,8587,12747,14859,20972,14668,8492,8556,16944,16976,19023,8524,8524,8524,8524,8524,8524,12620,29134,33393,31215,31150,31150,33426,33524,31280,29101,31279,33359,31311,23054,14733,8524,10636,10699,10731,10731,10731,10731,10730,19055,21169,21136,21136,21136,21137,21136,21104,21136,21136,19055,14860,10699,6536,8584,8584,8584},
-	{4292,4292,4292,4292,4325,4292,4292,4357,2408,2441,4391,4324,2375,2474,2507,459,2507,459,459,2507,2507,2507,2507,459,2507,2507,2507,2507,2507,2507,2508,2540,2540,2540,2540,2508,2508,2540,2475,2411,2410,2378,2379,2379,2378,2378,2410,2443,2443,2443,2378,2411,2508,2443,4426,4426,4426,4458,8618,2475,2475,2475,2410,2378,2378,2378,2378,4426,4458,4458,2410,2410,2410,2410,4458,4426,2442,2539,2540,2540,2540,2540,2508,2540,2508,2540,2540,2540,2540,2540,2540,2507,13006,38166,40182,42230,46390,37907,12619,8490,10538,10539,16942,8586,8554,6537,6537,6505,12844,19214,14924,6537,10666,22988,23020,23020,22988,23020,16875,12810,14859,14859,14858,10762,10762,10762,10762,10762,10762,10762,10762,10762,10730,8617,6537,6505,6506,8553,14731,22956,25004,25036,12682,4457,16779,25004,20907,6505,6505,20907,22956,22956,22956,29326,33649,29359,27149,25036,27181,33584,29456,18990,16942,16942,16942,21038,22989,22957,22957,22957,22958,22958,22957,22957,25006,26990,25006,25006,25006,25006,25006,25006,25007,27055,27055,27023,27055,27055,29200,27441,19215,10764,8716,8716,19215,21328,12877,6540,4460,8684,10893,12941,12941,12909,12909,12909,12941,12941,12941,12941,14989,14989,14990,14990,14990,14990,14990,14990,14990,14990,14990,17038,33908,44440,44440,44440,42360,25425,17007,17039,21232,27603,25426,19087,17039,19087,19087,19087,19088,19088,19088,19088,19088,19088,19120,19120,19088,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,21169,19088,10667,8586,10666,19053,23280,16943,10605,16943,12749,16910,8524,8524,8524,8524,8524,8492,12620,29101,33426,33361,31150,31150,33426,27281,14827,14794,14827,23118,27280,23217,21137,21169,21137,21136,21136,21136,21136,21136,21136,21136,21137,21137,21136,21136,21136,21136,21136,21136,21136,21136,21136,14860,8617,8584,6536,6536},
-	{2343,2441,2441,393,2408,4325,4292,2408,426,426,2375,4325,2441,459,459,459,459,459,459,459,459,459,2507,459,2507,2507,2507,2507,2507,2507,2508,2508,2508,2540,2475,2410,2443,2443,2410,2378,2410,2411,2379,2379,2378,2378,2410,2410,2443,2443,4426,4458,2475,2410,8522,14665,14665,8522,4490,2443,2475,2475,2410,2378,2378,2378,2378,8490,4426,2410,4458,2410,2410,4426,4426,4426,2442,2475,2507,2507,2442,4458,4458,4458,4458,4458,2442,2539,2540,2540,2540,2540,2539,6507,8458,10506,18859,20939,12619,8490,10538,10538,10667,12714,18892,12715,6537,10634,35956,63454,42197,18891,12714,20940,25068,18923,10698,8618,8617,8618,8618,6569,6537,6538,8586,8586,8586,8586,8586,6538,6537,8586,8586,8586,8554,6505,8586,20908,25036,25036,25036,25036,20908,10634,18859,25036,22955,8553,6505,20907,22956,22956,22956,48471,63422,39955,22956,22924,35665,63390,50681,19022,16942,16942,18990,21102,23054,22957,22957,22957,25005,22958,22957,22958,25006,24974,25006,25006,25006,25006,25006,25006,25007,27054,29038,29038,27055,27055,35570,61309,50810,10829,8716,10797,48665,61342,21296,4459,6540,10797,10893,12941,12941,12941,12941,12941,12941,12941,12941,12909,14990,14989,14990,14990,14990,14990,14990,14990,17038,17038,17038,17038,14958,17006,17006,17007,17007,17039,17039,17007,31796,63422,48633,19087,17039,17039,17039,19087,19088,19088,19088,19088,19088,19088,19088,19088,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19121,19120,21169,16974,14861,14893,33875,63422,42295,8524,14862,12750,14863,8524,8524,8524,8524,8524,8524,12620,29101,33426,33394,31150,31150,33394,21103,8649,8649,12845,21168,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21137,21169,21137,21136,21136,21136,21136,21136,21136,21136,21136,21104,16974,12779,12779,12779},
-	{2408,426,426,426,426,2310,2375,426,426,426,425,2375,2474,458,458,458,459,459,2507,2507,2507,2507,2507,459,2507,2507,2507,2507,2507,2507,2507,2508,2540,2540,2508,2443,2410,2378,2378,2378,2443,2411,2378,2378,2378,2378,2410,2443,2443,2443,6506,6506,4458,6474,14665,16713,16713,8522,2410,2410,2475,2475,2410,2378,2378,2378,6603,29649,25457,4491,2410,2410,2410,10570,14665,8489,4458,2474,2475,2475,2410,4426,4426,6474,4426,4426,2442,2507,2539,2540,2540,2540,4555,8490,10538,10538,18859,20940,12618,8490,10538,10539,16942,14795,23020,14763,6537,14730,38036,65535,44278,22988,14763,20940,23020,18923,12811,12810,14827,20940,20940,12682,10634,10634,10634,10634,8586,6506,8554,10634,12682,20940,22988,22988,20940,8586,18859,25036,25036,25036,27116,27149,27148,25100,27148,27116,22955,8553,6505,20907,22956,22956,25004,48504,65535,39955,22924,22924,35697,65535,52762,21038,16942,16942,16942,21102,23086,22957,22957,22957,26989,24974,24974,22958,25006,26958,25006,25006,25006,25006,25006,25006,27055,25007,27055,27055,27055,27055,33554,63422,52891,10829,8716,10797,50778,63455,21329,4427,8620,12941,10893,8780,10861,12941,12909,12941,12941,12941,12909,12909,14990,14990,14990,14958,14958,14990,14990,14990,17070,17038,14990,17038,17038,17039,17039,17039,17039,17039,17039,17007,31796,65535,48666,19087,17039,19087,17039,19087,19088,19088,19088,19088,19088,19088,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19121,19120,19121,21169,21169,21169,38070,65535,42327,8524,8524,8556,14862,8524,8492,8524,8524,8524,8524,12620,29101,33426,31378,27183,27183,25233,16974,14893,14893,17007,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21137,21136,21136,21136,21136,21136,21136,21136,21136,21104,21136,21136,21136,21136},
-	{425,426,426,426,426,425,426,426,426,426,426,2474,426,2474,2442,426,459,427,2507,2507,2507,2507,459,2507,2507,2507,2507,2507,2507,2507,2539,2507,2508,2508,2540,2540,2475,2410,2378,2410,2475,2443,2378,2378,2378,2378,2410,2475,2410,2410,2410,4458,10570,16713,16713,16713,16713,8522,4426,6506,4523,4523,2410,2378,2378,4459,21328,61342,52923,6603,4426,4426,4426,12617,12552,6343,8522,2474,2475,2475,4458,4426,2410,6474,6474,4426,2442,4523,6538,2442,2507,2507,4523,8458,8458,8458,14699,16779,10570,8490,10538,10538,18990,14762,20940,16810,8586,18859,38036,65535,44278,22988,14762,20940,22988,22988,22988,22988,22988,25036,25036,22988,22988,22988,22988,22988,10634,6505,8586,20940,25036,25036,25036,25036,20907,14698,22956,25004,25004,25036,25004,25004,25004,25004,25004,25036,22923,8553,8553,20907,22956,25036,27117,50584,65535,39955,22924,22924,35697,65535,52729,22989,16910,16910,16942,19054,23054,22957,22925,22925,24909,24941,24941,24973,22958,26990,25006,25006,25006,25006,25006,24974,26990,24975,26990,27023,27055,25007,29425,63422,52891,10797,8684,10797,50778,63455,21297,4395,6572,8780,8780,4586,8780,12909,10861,12909,12909,12909,12909,12941,12909,12909,12909,14958,14958,14958,14958,14990,14990,14990,14990,17038,14958,14958,14958,17007,17007,17007,17039,17007,31796,65535,48666,19087,17039,17039,17007,17007,17007,17007,17007,19088,19088,21168,19088,21168,21168,19120,19088,19088,19088,19120,19120,19088,19088,19088,19088,19120,19120,19120,19120,19120,19120,19120,19120,19088,27571,52859,57084,25457,8524,8524,8524,16943,14862,14830,14862,12782,8524,8524,14700,29101,33426,29362,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21137,21137,21169,21169,21137,21136,21136,21136,21136,21136,21136,21136,21136,21136,21104,19056,19056,19056},
-	{425,425,426,426,426,426,426,426,394,426,426,2409,2409,2409,2410,426,459,459,459,2507,2507,459,459,2507,2507,2507,2507,2507,2507,2507,2507,2507,2507,2507,2539,2540,2508,2475,2443,2507,2540,2443,2378,2378,2378,2410,2410,2475,2410,2410,4458,8522,16713,18761,16713,16713,16713,10569,10569,14665,8618,6570,2410,2378,2378,12877,55003,65535,54971,10699,10569,10569,10569,14665,10504,8423,8521,2474,2475,2442,2410,2378,2410,4426,6474,4426,4458,10602,12585,6474,2410,2475,8748,23279,25328,25328,25360,19054,10538,8490,10538,21135,31698,29552,33649,31568,18956,18859,38036,65535,44278,22988,14762,23053,33617,35697,35697,35697,33584,25069,25036,31439,35697,29294,31439,35729,27472,10763,8586,22988,25036,25036,25036,29294,33649,29520,35697,35697,31407,25004,25068,33584,33552,27149,33584,37777,31504,14763,20939,25036,25068,25069,33520,54874,65535,48439,35730,27182,35697,65503,54939,33682,31666,31666,25393,18990,23054,22989,31505,33618,35666,35666,33586,25070,22958,22958,22958,25006,25006,25006,29329,35667,35667,37715,39699,33328,27055,27152,37973,63454,55036,25554,19248,10797,50778,65535,33941,21265,23409,23472,8812,425,4587,17167,27634,27634,27634,27634,19248,12909,15022,25554,25521,17103,27602,29683,25522,17070,14990,14990,14990,17038,25457,29683,29683,29683,29683,29683,21232,17007,31796,65535,48666,19087,17039,19119,27570,31764,31764,31764,29651,21200,19088,25425,33812,25458,21168,19120,25426,31764,25426,19088,21201,29684,31764,31764,31764,29651,19120,19120,27571,31764,23314,27571,31796,31764,35957,54971,40215,16975,16943,16975,25426,31764,33845,33845,31764,21201,16975,16976,23152,27280,27346,25266,21169,21201,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21137,21169,21137,21136,21136,21136,21136,21136,21136,21136,21136,21136,21136,19088,19056,19056},
-	{425,425,2441,393,426,2474,2409,2409,2345,2409,2442,2442,394,394,426,426,426,426,426,459,426,426,459,427,427,427,2507,2507,2507,427,427,427,427,2507,2507,2508,2507,2507,2475,459,459,2410,2378,2378,2378,2346,2378,2443,2378,2378,10570,16713,16745,16713,16713,16713,16681,16713,16713,16713,12649,8554,4458,4426,2378,10635,33778,63422,54971,18859,16713,16713,16713,16713,16713,12584,8554,2474,2475,2410,2410,6474,4426,4426,6474,4426,8521,14633,14601,10537,6474,4523,21425,61309,59197,59196,61309,46584,10699,8490,14796,52826,63390,61277,61277,61245,31536,20939,40084,65535,44278,22988,14763,29423,59164,61277,61277,61309,57051,29359,25036,48503,65503,42068,48503,61277,61245,27472,8553,22988,25036,25036,25069,42100,63390,61277,61277,63390,48471,25068,29294,59164,59164,35729,57019,61309,54874,27214,25068,27117,27149,25004,46358,63455,65535,63390,61245,35698,35665,65503,63422,61277,59229,61342,48633,21135,21006,27247,57019,61310,61277,61277,59165,31473,22958,22958,22958,22958,22958,25039,46359,63390,61277,61277,63390,44182,25039,33490,59165,65535,63455,61309,46585,12877,48730,65535,61309,59229,59229,59229,19311,425,4586,36085,61342,59229,59229,61342,40311,10829,12974,57149,55036,23473,55003,61309,50810,19151,14958,14990,14990,17038,46553,65503,61310,59229,61277,61342,33908,17007,31796,65535,48666,19087,17039,19152,50778,61309,61277,61309,59229,29651,17039,40182,65535,42327,19088,19088,42327,65535,40183,19088,29652,59229,61310,61277,61342,54971,23346,21201,50746,63454,35990,48666,61310,59197,31732,21201,21201,21169,21169,27507,57084,61310,61277,61310,57052,25426,21201,23249,21201,21201,21201,21201,21169,21169,21201,21169,21169,21169,23249,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21137,21137,21137,21136,21136,21136,21136,21136,21136,21136,21136,19056,19056,19056},
-	{425,393,2409,2441,2474,2409,2344,2345,2345,2345,2377,361,10861,29811,29844,29844,29843,29844,17232,4619,25618,27699,8813,25651,31892,25651,4620,427,15119,29844,29844,29844,29844,15119,2507,2443,6700,27731,29844,29844,31924,23441,2410,4458,23376,31827,31827,31860,31828,29747,20972,16681,16713,16745,16713,16713,16713,18794,18826,18826,16745,12617,12617,8522,2378,10537,23149,61342,54971,18858,16713,16713,16713,16713,16713,14665,8554,2474,2475,2410,2442,10569,10569,8490,8490,10569,12585,14633,14601,14601,14601,21198,55068,52858,19118,15052,29810,61342,38197,8650,44439,61310,33779,27343,31568,59132,54971,23181,42164,65535,44278,20907,16940,52826,61245,35729,31439,35794,61277,52761,27181,48536,65535,61245,42068,31439,31472,25133,16811,25036,25036,25004,37810,61277,52729,31471,31439,46358,63390,42100,29294,61245,65535,54906,35665,31440,31407,25036,25036,25004,25068,25036,27214,52729,65535,44213,31439,27150,35698,65503,54906,27441,25361,40150,63390,42295,25199,52729,61309,35763,29361,33618,59165,54907,27216,22958,22958,22958,22926,39989,63390,48472,31409,31409,50617,61310,37844,27087,35796,63422,55003,21328,17103,10797,50778,65503,29779,17135,21361,55036,52955,10892,21425,61309,42423,10925,10925,38198,61342,31892,17135,59229,63455,48730,19280,17167,23376,17038,14958,14990,14990,17038,46585,65535,38166,25457,25490,52891,59197,27570,31796,65535,48666,19087,17039,19087,25425,27506,27506,29651,57116,55004,23345,40182,65535,42328,19088,19088,42328,65535,40215,25426,55004,57117,29684,27538,35989,61342,48666,23281,50778,65535,59197,35990,27539,27571,21233,19120,21169,21169,23313,50778,61310,33909,27539,27571,27539,21201,21169,21201,21201,21169,21169,21169,21201,21201,21201,21201,21201,21169,21201,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21168,21169,21169,21169,21169,21137,21137,21136,21136,21136,21136,21136,21136,21136,21136,19088,19056,19056},
-	{425,393,393,425,426,2441,2441,2441,2441,2377,2344,4490,31859,61309,54971,54971,59197,65535,38230,6732,55036,61309,25618,48697,55035,46649,6733,6700,38231,59261,52955,52923,61309,38198,6636,4490,23441,59261,55036,52955,57116,52923,14990,10602,50648,65535,59164,54971,55003,61309,35794,18794,16681,16713,16713,16681,31600,52826,52825,52826,33713,16681,16713,12617,4426,10569,23149,61342,54971,18859,16713,16713,16713,16713,16713,16713,8554,2474,2474,2410,4490,12617,14665,10538,10538,14633,14633,14601,14601,14601,12553,23311,63455,48697,6600,2471,10890,29777,21390,6697,50842,63422,19181,8617,14891,55003,61309,17100,35987,65535,44310,20939,19053,59196,59197,27246,22956,29359,61310,59132,27214,48536,65535,50616,31407,25004,25036,25036,25036,25036,22988,12714,31762,65535,44406,12713,10633,35955,65535,40213,23149,61245,63390,42100,25069,22956,22956,25004,25036,25004,27117,25036,22956,48503,65535,37875,22924,25037,35698,65535,52729,20974,16909,33844,65535,48601,25231,57020,65503,50649,46424,48537,63390,61277,29328,22926,22958,22958,22926,44247,65535,44214,22926,22926,46392,65535,42070,20878,23313,63422,52891,10797,8684,10797,50778,63455,23409,6604,12909,55003,61342,13005,27698,65535,52955,38230,38230,50842,65535,34005,10893,59229,61342,36053,12909,2475,8749,14990,14990,14990,17038,17038,46585,65535,33876,14926,17039,50746,65535,29683,31796,65535,48666,19087,17039,19119,38134,46521,46520,46553,61342,61342,25458,40182,65535,42328,19088,19088,42328,65535,40183,27506,61342,61342,48633,46521,50746,65535,54971,25361,50778,65535,46553,25426,19120,19120,19120,21169,21169,21169,21201,38102,59229,50746,46521,46553,42328,23314,21169,21201,21201,21169,21201,21201,21201,21201,21201,21201,21201,21201,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21168,21169,21169,21169,21169,21169,21137,21136,21136,21136,21136,21136,21136,21136,21136,19088,19056,19056},
-	{328,393,425,425,426,426,2474,426,426,2409,6376,25391,63422,44472,8618,10602,29746,65535,40214,12747,57051,65535,52955,13006,6700,4652,427,29812,65503,38198,8781,8748,38198,65503,27634,10829,57148,55036,12974,8749,21361,63422,46585,16779,50648,65535,33649,10731,12812,54874,61309,27310,16681,16713,14633,14632,27342,42229,42229,44309,29455,16681,16713,14665,6473,10537,23149,61342,54971,18859,16713,16713,16713,16713,16713,14665,6473,6538,6570,12617,12649,14665,16713,12586,10538,14633,14601,14601,14601,14601,8488,19247,63455,48729,6632,2503,8777,21390,17164,6697,50842,63422,17196,2503,8777,55003,61309,15052,31890,65535,46390,25100,27343,61277,59197,27278,22956,29391,61310,59100,27214,48536,65535,39923,22956,25036,25036,25036,25036,25036,22988,6600,27665,65535,42358,4552,4520,31858,65535,36116,14955,59196,61245,29262,25004,25004,25004,25004,25004,25004,25068,25036,22956,48503,65535,39923,22924,25037,35698,65535,52729,25102,25232,40054,65535,50682,29426,57084,65503,54907,52794,52794,52762,48536,27216,22926,22958,22958,22926,44247,65535,44214,22927,22927,46392,65535,40021,12717,19248,63422,52891,10797,8684,10797,50778,63455,23409,6636,12909,55003,61342,13005,29811,65535,57116,46617,46617,46585,46617,21457,8813,59229,57116,15022,12909,8716,2507,14958,14958,12878,12878,14958,46585,65535,33876,14958,17039,50746,65535,29683,31796,65535,48666,17039,19087,31763,57116,54971,50778,52859,63422,61342,25458,40182,65535,42328,19088,19088,42328,65535,36086,21330,61342,61374,48730,48698,52826,50778,44408,23281,50778,65535,33845,19088,21169,21168,19121,19121,21169,21169,21169,21233,46521,52859,52859,52891,61277,38070,21233,21169,21169,21201,21201,21169,21169,21201,21169,21169,21169,21169,21169,21201,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21168,21169,21169,21169,21168,21169,21169,21136,21136,21136,21136,21136,21136,21136,21136,21136,19056,19056},
-	{2344,2409,2473,425,425,425,426,426,426,2441,6376,27439,65535,44407,8456,8392,31665,65535,42261,16778,57051,61342,23473,4555,2475,2474,329,31860,65535,57149,50810,50778,59197,65535,29747,12909,61309,63422,50842,50810,52923,65535,50778,16810,50648,65535,31535,12585,10634,52826,63422,27342,16681,16713,14632,14632,12584,12552,14632,16681,16681,16713,16713,16713,14665,14633,23149,61342,52923,10665,14633,16713,16713,16713,14665,14665,6506,10602,8586,14665,14665,16713,16713,12586,10538,14633,14601,14601,14601,12585,4487,17197,59229,50809,10922,8777,25616,61374,40310,8745,46616,61342,21422,8810,15052,55035,57116,19116,33874,63454,48471,25133,29326,57051,59197,31504,27214,33617,61309,54906,27182,48536,65535,39955,22923,22924,22924,25036,25036,25004,22956,6569,25552,63422,44471,10859,10826,36051,63454,33971,10859,57148,61245,29294,25004,25004,25004,25004,25004,25068,27116,25036,22956,46358,65503,42100,27182,27149,35698,65535,52761,22989,25167,42134,65535,52762,31539,54940,63390,37909,31538,31539,29361,25071,22991,22991,22991,22991,22959,42134,65503,46359,27184,27216,48505,65503,33844,6604,19216,59197,52923,17103,12910,10797,50778,63455,23409,6636,10829,52923,61342,13005,27666,63422,40311,8812,14924,16941,6667,2442,10861,59229,57116,10893,8716,6636,2507,14958,10797,2475,427,4588,46553,65535,36021,21232,21265,52858,61342,29651,29683,61342,50778,21232,19120,50746,63390,33844,23313,27538,57116,61342,25458,38070,63455,46488,23313,21233,42360,65535,29845,8879,55068,55036,13040,12976,21297,23346,21201,21201,50778,65535,33845,19120,19121,19120,19121,19121,21169,19121,21201,23346,25426,25426,25426,29652,59229,57084,25426,21169,21201,21201,21169,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21168,21169,21168,21136,21136,21136,21136,21136,21136,21136,21136,21136,19088,19056},
-	{8423,8456,4424,2441,393,393,2441,2377,2377,2377,4328,27471,65535,46455,10472,8391,31665,65535,42261,14762,57084,59229,14892,6441,2410,2410,297,31860,65535,50778,33973,36021,33973,36021,17070,12909,61309,59229,36085,36053,36053,36021,29650,14698,50648,65535,31535,14601,10634,52826,63422,27342,14632,16681,14632,14632,12584,12584,16713,16713,14633,16713,16713,16713,16713,16681,23149,61310,52922,6602,14665,16713,16713,16713,12585,8490,8522,8490,8522,8490,10538,14665,14665,10538,10538,14633,12553,14601,12553,8552,4551,4585,25616,61341,57116,57115,59261,48729,10890,4584,15051,52922,59229,57115,57148,61277,31632,16874,23085,46390,63422,42100,22988,33616,61245,61245,59164,61245,59132,31472,25036,48536,65535,39955,22891,22891,22892,25036,25036,25004,20875,8649,8714,33940,61342,57116,57116,61341,42390,8746,10859,57148,59197,25198,20907,20907,22956,25004,25004,25004,25069,25036,22956,27214,52729,61310,59132,35730,35698,65535,52729,22989,22957,40021,65535,50682,27313,33684,59165,61310,59197,61245,57020,33619,27314,29362,29362,29362,29362,31507,50650,63390,59165,59165,63390,48505,21136,6636,8717,27634,61310,59197,44504,10829,48730,63455,23409,6604,10829,52923,63422,17134,8748,38166,61342,57116,59164,59164,31859,10569,12877,59229,57116,15054,8716,6636,8716,14958,4588,427,427,427,42424,65535,61309,59197,59197,63390,36021,17071,19119,38102,63422,44440,19087,25426,55004,61277,59197,59197,63455,61310,25458,21200,44440,63390,59197,57117,61342,65535,29845,461,19346,59229,57117,55068,57117,48666,21233,21169,50778,65535,33845,19120,19121,19121,19120,19121,19121,19121,23313,50779,59197,59197,59197,59229,61277,31764,21201,21169,21169,21169,21169,21201,21201,21201,21201,21201,21201,21201,21201,21201,21169,21201,21169,21169,21169,21169,21169,21169,21169,21169,21169,21168,21169,21168,21169,21168,21168,21168,21136,21136,21136,21136,21136,21136,21136,21136,19088,19088},
-	{8390,8423,8455,4392,2377,2377,2377,2344,2344,2344,4360,25294,57084,50713,23181,23149,40116,65535,38230,8748,55036,59229,10893,2442,2474,2474,394,25554,59229,42327,15022,17070,17070,10699,10472,14860,50778,55003,19215,17135,17102,21069,16681,16713,50648,65535,31535,14601,12682,52825,63422,25261,12551,14633,14632,12584,12584,12584,16681,14632,12584,14632,16713,16713,16713,16746,33681,63390,57084,19182,14665,16713,14665,14665,10538,8490,8490,8490,8490,8490,8490,10538,12585,8490,8490,10537,12585,12585,10537,6536,4551,2503,8810,25616,27697,27697,27697,19309,4551,4551,4584,21422,27697,27697,31794,35826,25133,20939,22987,31471,40019,31504,18891,21004,35794,39987,39987,39987,37810,25069,25036,33585,39923,29262,22891,22892,22892,25036,25036,25004,20843,8649,4520,14957,27634,29682,29682,29714,17133,4520,6665,25552,25552,8714,6569,6569,16811,25004,25004,25004,25004,25004,22956,22956,33553,39956,39956,31408,27215,37907,33617,22957,22957,27279,37908,33586,22990,23022,35796,42134,42166,42199,42134,31539,29394,29394,29394,29394,29394,29394,35797,44247,44247,44247,44248,29523,8685,8684,6636,12910,27667,29780,25522,8717,23441,29747,12942,8684,8717,25522,29714,17005,6636,21198,37938,37938,37938,39954,29455,18826,8651,21457,21425,6668,6668,6669,6669,6668,2507,427,395,427,42424,65535,40311,27699,33909,35989,21265,17039,17007,23345,35989,29683,17039,19087,31764,36021,36021,36021,35989,35957,23281,19087,27538,36022,36022,35989,48730,65535,29845,428,4654,23539,31861,33942,36022,33877,21201,19121,31764,36022,25426,19120,19121,19121,19120,19121,19121,19121,21233,33909,38102,38102,38102,38102,35990,23281,21169,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21168,21168,21168,21136,21136,21136,21136,21136,21136,21136,21136,19088,19088},
-	{8391,8423,10471,8456,4392,2344,2344,2344,2344,4360,8456,12584,31632,61309,59197,59197,61342,65535,38230,6700,52923,57116,10893,426,2474,2474,2475,2507,31924,61309,59197,59197,59229,33778,12520,10505,19118,57116,59229,59229,61277,50648,18794,16713,48535,63390,29455,16649,18794,50681,61309,27310,16681,16681,14632,12584,12584,12584,14633,16713,16681,16713,16713,16713,16681,23116,57051,63390,61342,48665,16810,14665,14665,14665,10537,8490,8490,8490,8490,8490,8490,8490,8490,8490,8490,8490,8490,8490,8490,6537,4551,4551,4551,2471,2471,2471,2471,4551,4551,4551,4551,2503,2503,2503,4519,10697,20939,22988,22988,22988,22987,20939,8649,6600,12746,18859,22956,22956,22988,25036,25036,25004,22891,22891,22892,22891,22891,25004,25004,25004,20843,8649,6569,6505,4425,4426,4426,4394,4457,4552,4520,4520,4520,4520,4552,4520,12714,16811,18859,22956,25004,22956,22956,22956,22924,22924,22924,25037,22957,22925,22925,22957,22957,22925,20877,20877,22957,22957,20909,23023,25201,27346,27346,29394,29394,29394,29394,29394,29394,29394,29394,29394,29394,25233,21104,10766,6637,8685,8684,8684,6604,6604,6636,8684,6636,6604,8684,8684,8684,6636,8684,10732,8684,12779,18890,20906,22890,24906,20906,22923,14730,6506,4426,394,394,394,427,492,524,524,427,427,42392,65535,23506,363,4556,6637,6669,6669,12910,17039,17007,17039,17039,17039,17007,17007,17007,17007,17007,17039,19120,19120,19087,17007,17007,17007,42327,65535,29845,429,461,2509,14959,17040,17040,19120,19120,19120,19120,19120,19120,19121,19121,19121,19120,19121,19121,19121,19121,19120,19120,19120,19120,19121,19121,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21168,21168,21168,21168,21136,21136,21136,21136,21136,21136,21136,21136,19088,19087},
-	{8390,8391,8423,8423,8423,6408,4360,2344,6408,8456,10504,12552,14730,23181,23181,23181,40116,65535,38230,2442,12973,13038,4554,2410,2442,2442,2442,2442,12779,23181,23181,23149,23149,16810,12552,12552,10602,14990,17070,19118,27310,25165,16713,16681,23084,27309,16777,14632,14632,21036,23181,16745,14632,14632,14632,14632,12584,14632,14632,12584,12584,12584,12584,12584,12584,14697,23181,25262,17070,14957,14665,14665,14665,12585,10537,8490,8490,8490,8490,8490,8490,8490,8490,8490,8490,8490,6474,6505,6505,6536,4551,4551,4551,4551,4551,4551,4551,4551,4551,4551,4551,4552,4552,4552,4552,4552,12746,20940,22988,22988,20940,10697,4552,4584,4552,10697,16875,18891,22988,20939,25036,25004,22924,22892,22891,22891,22891,24972,22892,22924,20843,8649,6569,6538,6506,6475,6475,6475,4427,4489,4521,4552,4552,4552,4552,4552,4520,4520,6569,20908,25004,25004,22956,22956,22956,22957,22957,22957,22957,22957,22957,22957,23022,25135,25135,25135,25135,25135,25136,27313,29394,29394,29394,29394,29394,29394,29394,29394,29394,29394,29394,29395,25265,10765,6636,6637,6637,6636,8684,8685,8685,8685,8685,8685,8684,8684,8684,8684,8684,8684,8685,8684,8684,12779,18922,20906,24938,24938,22955,24971,22955,18826,16714,6506,426,394,427,556,589,589,556,524,42424,65535,23506,395,427,427,427,427,4556,6637,12878,17039,17039,17039,17039,17039,19087,19087,19087,19087,19087,19088,21233,25426,25426,25394,46521,63422,33941,10831,10831,4589,6670,6670,6670,6670,14960,19120,19120,19120,19120,19121,19121,19121,19120,19121,19121,19153,19153,19121,19153,19153,21201,21201,21201,21201,21201,21201,21201,21201,21201,21169,21201,21201,21169,21201,21201,21201,21201,21201,21169,21201,21201,21201,21169,21169,21169,21169,21169,21169,21169,21169,21168,21169,21168,21168,21168,21168,21136,21136,21136,21136,21136,21136,19088,19088,19088,19088},
-	{8390,8391,8423,8423,8423,8423,8424,4392,4360,6408,10472,10504,10472,8391,10439,8359,31632,65535,40213,6408,6440,6473,6441,6409,6409,6409,6441,6441,8456,12520,12520,12520,10440,12520,12552,12552,10504,2345,2313,8424,14600,16681,16681,16681,16680,16648,12552,12584,12584,12552,12552,12584,12584,14632,16681,16681,14632,16681,14632,12584,12584,12584,12584,12584,12584,12584,12584,14632,4425,2377,12617,14665,10537,8490,8490,8490,6473,6473,8490,8490,8490,8490,8490,8490,8490,8490,4456,2471,4488,6536,4551,4551,4551,4551,4551,4551,4551,4551,4551,4551,4552,4552,4552,4552,4552,4552,6600,16843,20940,22988,18891,6600,4584,4584,4584,4584,4552,8649,12746,10697,14794,16811,22891,22892,22892,22891,22892,24972,22892,22892,20843,8649,4553,6538,6506,6475,6475,6475,4427,4427,4458,4489,4520,4552,4520,4520,4520,4521,6537,20908,25005,25005,25102,27215,27183,25070,25167,25167,25167,25167,25167,25167,27281,29394,29394,27346,27346,27346,29394,29394,29394,29394,29394,29394,29394,29394,29394,29394,29394,29394,29394,31443,19056,6636,12781,18959,18959,16910,8685,6637,6637,6637,8685,8685,8684,8685,8685,8685,8685,8685,8685,8685,8684,8684,16874,14795,14763,24938,20907,22955,22955,20907,18762,10570,426,394,2475,6635,556,589,589,589,40408,65535,23506,395,427,427,427,427,428,428,2508,4589,6637,14959,17039,17039,17039,19087,19087,19087,19087,17039,38102,59229,59197,59197,63422,42360,19152,17040,17040,2541,461,461,461,461,10831,19120,19120,19120,19120,19121,19121,19121,19120,19121,19121,19153,19153,19153,19153,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21169,21201,21201,21201,21169,21169,21169,21169,21169,21169,21169,21169,21169,21169,21168,21168,21168,21168,21168,21168,21136,21136,21136,19088,19088,19088,19088,19088},
-	{8390,8391,8423,8423,10471,8423,6408,4392,4360,6408,8424,10471,14730,25294,25294,25261,40181,61277,33778,10472,10472,10472,10472,10472,12520,12520,12520,12552,12520,12520,12552,12552,12520,12520,12552,12552,12520,6409,8424,10472,16680,16681,16681,16681,16681,16681,16681,16681,16681,16681,14632,12584,12584,12584,16681,16681,16681,16681,14632,12584,12584,12584,14632,16713,16713,16713,14665,14665,4425,2377,10537,12585,8490,8490,8490,8490,6473,6504,8490,8490,8490,8490,8490,8490,8490,8490,4487,2471,4520,4488,2503,2503,4551,4551,4551,2503,4551,4551,4551,4551,4552,4552,4552,4552,4552,4552,4584,8680,27407,40084,25391,4552,4584,4584,4584,4584,4552,4552,4552,4552,4552,8649,18827,22892,22892,22891,22892,24972,22892,24972,20843,8649,4553,4458,6475,6475,6475,4427,4427,4395,4427,4489,4520,4552,4520,4521,4489,4489,6506,20908,25037,25167,27313,27378,27346,27313,27346,29394,29394,29394,29394,29394,29394,29394,29394,29394,29394,29394,27346,29394,29394,29394,29394,29394,29394,29394,29394,29394,29394,29394,29394,27314,12846,6636,16911,27120,27088,25040,14798,8685,8685,8685,8685,8685,8685,8685,8685,8685,8684,8684,8685,8684,8684,8684,16874,12779,10700,22890,22922,22955,24970,20939,10634,8522,2442,394,4522,10699,524,556,556,556,15184,23571,8878,427,427,427,427,427,428,428,428,428,428,2508,2509,2509,10830,14959,17039,19087,19087,19087,25458,35957,33909,33909,33909,19249,2541,2541,2541,461,461,461,461,461,2541,14991,19120,19120,19120,19121,19121,19121,19120,19121,19121,19153,19153,19153,19153,21201,19153,21201,19153,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21169,21169,21201,19121,21201,21169,19121,19121,21169,21169,21169,21169,21169,21169,21168,21169,21168,21168,21168,21168,21168,21136,19088,19088,19088,19088,19088,19087},
-	{8390,8391,8423,8423,8423,8423,8424,8456,8424,8423,8423,8391,27407,59196,59196,59196,61277,42229,10504,10471,10472,10472,10504,10472,10472,12520,12520,12520,12520,12520,12552,12552,12520,12520,12552,12552,12520,10472,10472,10471,14632,16681,16681,16681,16681,16681,16681,16681,16681,16681,16680,14632,14632,12583,14632,16680,16681,16681,14632,12584,14632,14632,14664,16713,16713,14665,14665,14665,4425,2378,8490,8490,8490,8490,8490,8490,6473,4487,4488,4488,6473,8490,4456,6473,8490,6505,2471,2503,4520,4488,2503,4551,4551,4551,2503,2503,4551,4551,4551,4551,4552,4552,4552,4552,4552,4552,6632,17096,42323,65535,36084,4552,4552,4552,4552,4552,4552,4552,4552,4552,4552,6601,16779,22891,22892,22892,22892,22924,22892,22924,18827,8586,6537,4426,6475,6475,4427,4427,4427,4427,4490,4520,4552,4520,4520,4489,4457,4458,6506,20908,22957,14893,14893,14893,21135,27346,27346,27345,27345,27345,27346,27346,27346,27346,27345,27345,29394,29394,27346,29394,29394,29394,21136,12846,12846,12846,12846,14894,14894,14894,14894,12846,6637,6636,16910,25040,22960,25008,25072,23056,23056,23056,23055,23055,23056,12782,6637,6637,6637,6637,6637,6636,6636,8684,16874,12779,10700,22858,22890,22954,24970,20907,10602,10570,14731,426,4522,10699,427,427,427,427,427,395,427,427,427,427,427,427,427,427,428,428,428,428,428,428,460,2509,10798,17039,19087,19087,17039,17039,17039,17039,17007,4589,461,461,461,461,461,461,461,461,461,6702,14992,14992,14992,14992,14992,19120,19121,19120,19121,19121,19121,19153,19153,19153,19153,19153,19153,19153,19153,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,21169,15023,17072,19121,15023,17072,21169,21169,21169,21169,21169,21169,21169,21168,21168,21168,21168,21168,21168,21168,21136,19088,19088,19088,19088,19087},
-	{8390,8391,8423,8423,8423,8424,10471,10471,10471,10471,10471,10471,12649,18988,21036,21036,21036,16810,10472,10472,10472,10472,10472,10472,10472,10472,12520,12520,12520,12520,12520,12520,12520,12520,12552,12552,12520,12520,10471,10471,10471,14600,14600,16680,16680,16680,16680,16680,16680,14632,14632,14632,14632,12583,14632,16681,16681,16680,14632,12584,14632,14632,14632,14632,14664,14664,14665,14665,4425,4426,8490,8490,8490,8490,8490,8490,6473,2471,2471,2471,4487,6504,4488,4519,4488,4519,2471,2471,4488,4488,2503,2503,4551,4551,2503,4551,4551,4551,4551,4552,4551,4551,4552,4552,4552,4552,4584,15015,38194,65535,36084,4552,4552,4552,4552,4552,4552,4552,4552,6600,4552,6601,8649,14730,22892,22892,22892,16779,8617,8617,8649,8585,6537,6474,6475,6475,6475,4427,4395,4458,4521,4552,4552,4552,4521,4457,4457,4457,6506,20908,16779,6570,6634,6634,10763,12844,12844,12844,10796,10796,10796,10796,10764,10796,10764,14926,25265,27346,29394,29394,29394,25265,12813,6636,6636,6636,6636,6636,6636,6636,6636,6636,6636,6637,16910,25040,22960,22960,25040,25008,20847,20848,20847,22928,25040,12782,6637,8685,8685,8685,6637,6637,6636,8684,16843,14827,10700,20810,22890,22954,24970,22923,20778,20779,18762,2442,4522,16843,8619,394,395,395,395,395,395,427,427,427,427,427,427,427,427,428,428,428,428,428,428,428,2508,12879,19087,19087,19087,19087,19087,19120,17039,6669,4621,4622,4621,4621,4621,4622,4622,4622,2541,461,2541,2541,2541,4654,6702,17072,19121,19120,19120,19121,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,21201,19153,19153,21201,21201,21201,21201,21201,21201,21201,21201,21201,21201,17072,12943,12943,12943,15024,21169,21169,21169,21169,21168,21168,21168,21168,19120,21168,21168,19120,19120,19120,19088,19088,19088,19088,19088,19087},
-	{8390,8391,8423,8423,8424,8423,8423,8423,8423,8423,10471,10471,10471,8391,8391,8391,10439,10471,10472,10472,10472,10472,10472,10472,10472,10472,12520,10472,12520,12520,12520,12552,12520,12520,12552,12520,12520,12520,10439,10439,8391,12552,12552,16680,16680,14632,12551,12551,10503,10503,12551,12551,12551,10503,14632,16681,16681,16681,14632,10503,12583,10535,10535,10503,10535,10535,12584,14665,4425,4394,8490,8490,8490,8490,8490,8490,6473,2471,2471,2471,2471,2471,2471,2471,2471,2471,2471,2471,4519,4488,2503,4551,2503,2471,2471,2471,2471,2471,4551,4551,4552,4520,6568,6568,6568,4520,4552,4551,31922,65535,36084,4552,4552,4552,4552,4552,4552,4520,4552,4552,6600,4552,4552,10665,20811,22859,18795,8617,4552,4552,4553,4553,6569,4458,6475,6475,6475,4427,4395,4458,4553,4553,4552,4553,4521,4457,6506,8554,14731,22957,20908,14763,8682,6634,6634,6634,6634,6634,6634,6634,6634,4587,2507,4587,6635,6635,10797,25265,29394,29394,29394,27346,23185,10765,6636,6636,6636,6636,6636,6636,6636,6637,6637,6637,16910,25040,22960,22960,22960,20847,18767,18767,18767,18767,22928,12750,6637,8685,8685,8685,6637,6636,6636,8653,14765,16812,14702,20812,22889,20906,22922,22922,20778,20778,20810,6538,6538,18891,16843,2443,394,427,395,395,427,427,427,427,427,427,427,427,427,428,428,428,428,428,428,428,428,6669,19087,19087,19087,19087,19087,19119,19120,17072,17072,17072,17072,19120,19120,19120,19120,19120,10863,4622,461,461,4622,17072,19120,19120,19120,19120,19120,19121,19121,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,21201,19153,19153,21201,21201,21201,21201,21201,19120,15023,10895,15023,17072,21169,21169,21169,21169,21168,21168,21168,19120,19120,21168,21168,19120,19120,19120,19088,19088,19088,19088,19088,19088},
-	{8390,8391,8423,8423,8423,8423,8423,8423,8423,8423,8423,10471,10471,10471,10471,10471,10471,10471,10472,10472,10472,10472,10472,10472,10472,10472,12520,10472,12520,12520,12520,12520,10472,10472,12520,12520,12520,12520,10471,10439,8391,12552,12552,16680,16680,16680,14632,14632,12552,12584,12552,12552,12552,10503,14632,16680,16680,16680,14632,12583,12584,12584,12584,12583,12584,14632,14632,12617,4425,4394,8490,8490,8490,6441,6473,6441,6473,2471,2471,2471,2471,2471,2471,2471,2471,2471,2471,4519,4519,4519,2503,2471,10858,31890,33971,33971,34003,23471,4551,4551,4552,31697,40148,40116,40148,33906,8777,2471,31922,65535,36084,4552,4552,8745,29777,34003,34003,34003,27697,6665,4552,23439,33971,17100,29552,44181,38036,15020,4552,4552,4552,4553,4553,4553,4521,4489,4427,4427,4427,4521,4553,4553,4553,4553,4521,4457,14731,22957,22957,22957,22957,12715,6634,6634,6634,6634,6634,6635,6635,6635,6635,4587,4555,6635,6635,6635,6636,23217,29394,29394,27313,23217,16975,6636,6636,6636,6636,6636,6636,6636,6637,6637,6637,6637,16911,25040,22960,22960,22960,20847,18767,18767,18767,18767,18799,10702,6637,6637,6637,6637,8685,10701,10701,10701,12717,14764,14734,20813,22858,20906,22954,20907,18730,20778,24939,14699,12618,22923,16843,2443,394,426,394,395,395,427,427,427,427,427,427,427,427,427,428,428,428,428,428,428,428,4589,10798,8750,14959,19087,17039,17039,19119,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,12911,493,6702,14991,19120,19120,19120,19153,19153,19153,19121,19153,19121,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,21201,19153,19153,19153,19153,19153,15024,19121,19153,21169,21169,21168,21168,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19088,19088,19088,19088,19087},
-	{8390,8391,8423,8423,8423,8423,8423,8423,8423,8423,8423,10471,10471,10471,10471,10471,10471,10471,10472,10472,10471,10471,10471,10471,10472,10472,12520,12520,12520,12520,12520,12520,16745,18955,16745,12520,12520,12519,10471,10439,10471,14600,16680,16680,16680,16680,16680,16680,14632,14632,16874,18955,18955,18987,21003,16745,14632,14632,14632,10535,10503,10503,12584,12583,14632,14664,14633,6473,2377,4394,8490,8490,8490,4456,2439,6472,6473,2471,2470,2471,2471,2471,2471,2471,2471,2471,2471,4487,4519,2503,2503,6664,27729,61309,52922,52922,57148,50809,13003,4552,17133,54971,59164,57019,57051,59229,25551,4584,31922,65535,36084,4520,6632,21391,59196,55003,52922,55035,57116,19278,6633,42390,65535,36084,40278,52955,52922,21326,4520,4553,4553,4553,4553,4552,4552,4553,4490,4458,4489,4552,4521,4553,4521,4521,4521,4457,12683,22957,25005,22957,22957,18892,12747,12747,8651,6571,6571,6571,6571,6603,6635,6635,6635,6635,6635,6635,6636,21135,27346,23217,14926,8684,6636,6636,6636,6636,6636,6636,6637,6637,6637,6637,6637,6637,16911,25040,22960,22960,22960,18800,18767,18767,16751,14702,10606,6605,6637,6637,6637,6637,10701,14734,14734,14734,14734,14734,14734,14702,18796,22954,22922,20906,18762,22859,24939,14699,14666,24939,16811,2474,394,394,394,395,427,427,427,427,427,427,427,427,427,427,427,427,428,428,6669,6669,428,428,428,428,10830,19087,17039,17039,17040,17072,17072,19120,19120,19120,19120,19120,19120,19120,19120,17039,10863,17072,19120,19120,19120,19120,12943,8782,8782,8782,14992,19153,19152,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19152,19152,19153,19153,19121,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19088,19088,19087},
-	{8390,8391,8423,8423,10471,10471,10471,10471,10471,10471,10471,10471,10471,8423,8423,10471,10471,10471,10471,10471,10471,10471,10471,10471,10471,10471,10472,10472,10472,10472,12520,10471,37971,61309,33745,12520,12520,10439,10439,10439,12520,14632,16680,16680,16680,14632,14632,12584,12551,14697,50680,59197,59196,59196,57051,23116,14632,12584,12584,12584,12584,12584,12584,10503,12584,12584,8488,2377,2377,4393,8490,8490,8490,4456,2471,4456,6472,2471,2471,2471,2471,2471,2471,2471,2471,2471,2471,2471,2471,2471,2471,17196,61341,50809,8777,6664,23503,61341,40310,6697,48697,63390,29488,18891,25197,57084,59196,19116,35987,65535,36084,4520,10891,55035,57148,15052,8713,17165,61309,52890,8746,42358,65535,61309,25584,8713,8746,6633,4552,4553,4553,4553,4552,4553,4553,4553,4553,4521,4553,4553,4553,4553,4489,4458,4458,6506,12683,22957,25005,22957,22957,20877,20909,22957,12652,4427,4458,4458,4459,4427,6571,6571,6571,6603,6635,6635,6635,12845,27314,10733,6636,6636,6636,6636,6636,6636,6636,6637,6637,6637,6637,6637,6637,6637,16879,25008,22960,22960,22961,18800,16719,16719,10670,8685,8685,6637,6637,6637,6637,6637,6637,8685,8685,8685,8685,8685,6637,6636,8652,16843,24970,22922,18762,24907,24938,14698,14666,24907,16811,2474,394,426,2442,6507,395,427,427,395,427,427,427,427,427,427,427,4556,10797,10798,14958,14959,10830,10830,10830,10830,14959,8749,12911,17040,10830,6669,6669,6669,6669,6702,6702,6702,8750,17040,19120,19120,19120,19120,19120,19120,12911,6702,4621,493,493,493,4621,8782,8782,8782,8782,17072,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19153,19152,19152,19152,19153,19153,19153,19152,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19088,19088,19088,17039},
-	{8390,8391,8423,8424,10504,10504,10504,10504,10503,10504,10504,10504,10504,8423,8423,10471,10471,10471,10471,10471,10471,10471,10471,10471,10471,10471,10471,10471,10472,12520,12520,10439,40116,65535,35858,12520,12520,10439,10439,10439,10471,14632,14632,16680,14632,14632,12551,12551,12616,40148,59229,37970,29486,31600,57083,48632,18922,12551,12583,12583,12583,10535,10536,12583,12583,12583,8488,2377,2377,4393,8490,8489,8490,4456,2470,2471,4456,2471,2471,2471,2471,2471,2471,2471,2471,2471,2503,2503,2503,2503,2471,19245,63454,48729,4584,2471,6697,17164,12971,6664,50842,63422,21134,8425,21004,57051,61309,27310,40084,65535,36084,4520,12939,59196,57148,10891,4520,15020,61309,55003,8746,42358,65535,36084,8746,4520,4552,4552,4553,4521,4521,4553,4553,4553,4553,4553,4553,4553,4553,4553,4521,4521,4458,4426,4458,10603,20877,20877,20877,20877,18796,18764,18797,20877,12652,4427,4458,4490,4459,4427,4396,4428,4428,6603,6635,6635,6635,8716,23185,16911,6572,6636,6636,6636,6636,6636,6636,6636,6637,6637,6637,6637,6637,8685,16815,20880,20880,22960,22961,18800,18768,16752,10670,10701,8685,6637,6637,6637,6637,6637,6637,6637,6637,6637,6637,6637,6637,6636,6636,12779,24970,22922,20906,24938,24938,12682,16714,24907,18859,2442,2474,6571,10571,18731,4491,394,10571,8523,395,427,427,427,427,427,427,6637,8717,8749,14959,17039,17039,17039,17039,17039,14991,2508,2509,4621,2540,557,493,460,460,460,460,460,460,8750,17072,17072,19120,19120,19120,19120,8782,460,493,493,493,493,493,10863,12943,12943,12943,17072,19153,19153,19153,19153,19153,19153,19153,19152,19152,19153,19153,19153,19153,19153,19153,19153,19152,19152,19153,19153,19153,19153,19152,19152,19152,19152,19152,19152,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19088,19088,19087,17039},
-	{8390,8391,8423,8423,10503,10503,10503,10471,10471,10471,10471,10471,10471,8391,8423,8391,8391,10471,10471,10471,10471,10439,10439,10439,10439,10471,10472,10472,10471,10471,10439,10439,40084,65535,35858,10440,12519,10439,10439,8391,10471,14632,14632,14632,14632,14632,14632,14632,16745,52826,63422,25229,12519,31632,59229,61309,23116,12551,12583,12583,12584,14632,12616,12616,14632,10569,6473,2377,2377,4393,6442,6442,8490,4456,2470,2439,4456,2471,2471,2471,2470,2470,2471,2471,2471,2471,2471,2503,2471,2471,2471,19245,63454,48729,4584,2471,12970,34003,25583,6665,50842,63422,19054,6377,20972,57051,61310,27310,40084,65535,36084,2471,12939,59196,57148,10858,2440,12971,61309,55003,8746,42358,65535,27632,4520,4553,4553,4521,4489,4489,4457,4521,4553,4553,4553,4553,4521,4521,4489,4489,4489,4457,4458,4458,4458,8554,18764,18764,18764,18796,18764,18764,16716,18797,10604,4396,4396,4427,4458,4427,4427,4428,2348,4492,6635,6635,6636,6636,17007,25266,10702,4493,6572,6604,6636,6636,12781,18958,18958,18959,18959,18959,18959,12782,20912,18800,18768,20880,22961,18800,18800,18800,14735,12686,8653,6637,6637,6637,6637,6637,6637,6637,6637,6637,6637,6637,6637,6637,6636,12780,20906,22922,20939,22954,22922,16779,20810,24907,18795,2442,2442,2442,14667,22859,12683,6507,18699,16651,6507,427,395,395,427,427,427,428,428,427,2508,6669,14991,14959,14959,14959,12911,2508,460,557,589,622,590,590,525,460,460,460,460,460,4589,4621,10831,17072,17072,17072,8750,460,493,493,2541,2605,8847,19120,19152,19153,19153,19153,19153,19153,19153,19153,19153,19152,19152,19153,19152,19153,19153,19153,19153,19153,19153,19153,19152,19153,19153,19153,19153,19153,19153,19152,19152,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19119,19119,17039,17039},
-	{8390,8391,8423,8423,8423,8423,8423,8423,8423,8423,8423,12616,18987,14761,12617,18987,18987,16810,10471,10471,16874,21036,21036,21036,18955,12584,10471,10471,16777,21036,21036,21036,44342,65535,35858,10439,12519,10439,10439,8391,10439,14600,14600,14600,14632,14632,14632,14632,16745,52826,63422,25261,23116,57051,65535,61309,23116,10503,12583,12584,12584,10537,4425,4425,6473,4425,2377,2377,2377,4393,6442,6442,8490,4456,2470,2471,4487,2470,2471,2471,2471,2471,2471,2471,2471,2471,2471,2471,2471,2471,2471,15051,52922,52922,21358,17197,33970,61309,36084,8649,42294,61277,31731,23215,31601,59132,52826,21101,35794,61245,44471,10859,8778,46616,57148,25552,19278,27665,59229,44471,8714,42358,65535,27665,4488,4489,6537,6506,6506,4458,6506,4521,4553,4553,4553,4553,6506,16811,16812,16780,10603,4458,4458,4458,6506,16780,22925,20877,20877,20877,18764,16716,16716,18797,10604,4396,4427,4427,4427,4428,2380,4396,2348,4460,6636,6635,6636,6636,10765,17007,23153,6510,4429,4429,12717,18958,23055,25072,25040,25040,25040,25040,25040,14799,20912,18800,16720,20880,20880,18800,18768,18768,12687,12686,8653,6637,6637,6637,6637,6637,6637,6637,6637,6637,6637,6637,6637,6636,6636,8684,16843,16811,18826,20906,20906,18794,22858,24906,20843,2442,8522,4458,14666,22859,10602,10571,18699,18699,14635,2443,2443,8555,2443,427,427,427,427,427,427,428,2508,2508,2508,2508,2508,492,590,622,622,590,590,590,590,525,460,460,460,460,460,460,2540,2541,2541,2541,492,460,493,4621,14992,15024,17104,19152,19152,19152,19152,19152,19152,19153,19153,19153,19153,19152,19152,19153,19152,19153,19153,19153,19153,19153,19153,19153,19152,19153,19153,19153,19153,19153,19153,19152,19152,19152,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19119,17039,17039},
-	{8390,8391,8423,8423,8423,8423,8423,8423,8423,8423,8391,27406,61309,42261,29551,59196,61277,40116,8391,14697,50713,61277,59196,59197,57051,21036,10471,10471,35890,61277,59196,59196,63390,65535,35858,10439,10471,10439,10439,14729,35858,37938,37971,31567,14632,14600,14632,14600,16745,52826,63422,29487,50713,63454,65535,61309,23116,10503,14632,14632,6473,2377,2377,2377,2377,2377,2377,2377,2377,4393,6442,6441,6441,4456,2470,2470,2470,2470,2470,2470,2470,2470,2471,2471,2471,2471,2471,2471,2471,2503,2503,2471,19309,59228,59229,59228,61309,44503,6633,6441,12683,50713,61277,59197,61277,59164,27343,18891,22988,42164,61342,31890,4520,12971,55003,59229,59229,59261,52890,10859,4552,40277,61342,25584,4457,6506,6506,6506,6506,4458,6506,4489,4489,4489,4489,4489,6506,20909,25005,25005,12683,4458,4458,8555,18860,22924,20844,18796,18797,18796,16716,16716,16717,16717,14668,4396,4428,4396,4396,4396,4396,4396,2348,4460,6636,6636,6636,6636,6636,6636,21104,18993,4429,2349,14734,14734,10606,18831,20912,20912,20912,18799,18832,18864,20912,18800,16719,18768,18768,16720,16719,16720,12687,14703,12718,8686,8685,8654,6637,6637,6637,6637,6637,6637,6637,6637,6637,6636,6636,8684,14827,10700,16779,22858,22858,20778,22858,24906,20810,4490,12586,18730,22859,20779,16651,16651,18699,18699,18699,10571,4491,10571,10571,4491,427,427,427,427,427,427,427,427,428,428,428,492,622,622,590,492,460,460,460,460,460,460,460,460,460,460,460,461,460,492,525,525,493,2541,12943,19152,17072,14991,14992,15024,19152,19152,19152,19152,19152,19152,19153,19152,19153,19153,19152,19153,19153,19153,19152,19153,19153,19153,19153,19153,19153,19153,19153,19153,19152,19152,19152,19152,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19119,19120,19119,17071,17071,17039},
-	{8390,8391,8423,8423,8423,8423,8423,8423,8423,8423,8391,27439,65535,61277,42229,25294,25294,18955,10536,42261,61277,33745,23213,27407,57083,50680,16810,29487,59164,46455,25261,25293,46487,65535,35858,10439,10471,10439,10406,21035,52858,54971,57019,44309,16712,14632,14632,14600,16745,52826,65535,54971,59196,37971,57084,61309,23116,10503,12584,12584,4425,2377,2377,2377,2377,2377,2377,2377,2377,4393,6442,6442,6441,2439,2470,2470,2471,2470,2470,2470,2470,2470,2471,2471,2471,2471,2471,2471,2471,2471,2503,2471,6664,15083,15084,15084,15084,10890,6473,8457,8490,16941,19054,19054,27343,25230,18892,20907,22956,19020,17132,10858,6568,6633,15052,17133,17133,17133,15020,6601,4552,12939,17133,8746,4489,6506,6506,6506,4458,4458,4458,4458,4458,4458,4458,4458,6474,12651,20844,20844,10603,4458,6506,12683,20877,18764,18764,18764,16716,12651,16716,16716,16717,16717,10572,4396,4396,4396,4396,4396,4396,4396,2348,4460,6636,6636,6636,6636,6636,6636,16975,27314,14832,4397,16814,16751,12590,16719,20880,20880,20880,16719,18800,20912,20912,18768,16719,16720,16720,16720,16720,16720,16719,16719,16719,14703,14703,14703,6542,6637,6637,6637,6637,6637,6637,6637,6637,6637,6637,6636,14827,14827,10699,22858,24906,20777,22826,24874,22858,12586,18763,22826,22826,18698,18698,18699,18699,18699,18699,12619,2443,10571,14635,12619,427,427,427,427,427,4491,427,427,427,428,427,460,589,589,589,460,428,460,460,460,460,460,460,460,460,460,460,460,493,557,654,655,557,2573,10863,12943,6702,493,493,4653,15023,19152,19152,19152,19152,19153,19153,19152,19153,19153,19152,19153,19153,19153,19152,19152,19152,19153,19153,19153,19153,19153,19153,19152,19152,19152,19152,19152,19152,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19119,19119,17071,17071,17071,17039},
-	{8390,8391,8423,8423,8423,8423,8423,8423,8423,8423,8391,27439,65535,57051,29519,8391,8391,8391,12584,52826,65503,42229,35858,38003,61277,61277,18923,35858,65535,38003,10407,10407,40084,65535,35858,10439,10471,10439,10439,10471,14664,16777,16777,16745,14632,14632,14632,14600,16745,52825,65535,63454,44342,21035,54938,61309,23116,10503,10503,10536,4425,2377,2377,2377,2377,2377,2377,2377,2377,4393,6410,6410,6472,2438,2470,2470,2471,2470,2470,2470,2471,2471,2471,2471,2471,2471,2471,2471,2471,2471,2471,2503,2471,2471,2471,2471,2471,4456,6441,8489,8457,8457,8457,8457,16746,14698,16779,20940,22988,12714,4520,12713,20939,12746,4520,4520,4520,4457,4456,4552,4552,4520,4520,4552,4489,4458,6506,6506,6506,4458,4458,4458,4457,4458,4426,4426,6506,16715,20812,20812,10603,8555,18829,20909,18796,18764,18764,18764,16716,14700,16716,16717,16717,16717,8524,2348,4396,4396,4396,2348,4396,4396,2348,4428,6636,6636,6636,6636,6636,6636,8685,21137,27314,16815,22991,16751,14639,16751,20880,20880,20880,16719,16719,20880,20912,16752,16719,16720,16720,16720,16720,16720,16720,16720,16720,16719,14703,14703,8654,6637,6637,6637,6637,6637,6637,6637,6637,6637,6637,6636,8684,16875,16842,22889,22857,22858,22826,22826,22858,18698,22859,22859,20778,18698,18698,18698,18699,18699,18699,10571,2443,10571,12587,14635,2443,427,427,427,2443,10603,427,427,427,427,427,4491,525,525,492,460,428,460,460,460,460,460,460,460,460,460,460,460,525,589,589,590,525,492,492,493,493,493,4653,6734,12943,19152,19152,19152,19153,19153,19153,19153,19153,19153,19153,19153,19152,19153,19153,19153,19153,19153,19152,19152,19153,19153,19153,19152,19152,19152,19152,19152,19152,19152,19152,19120,19120,19120,19120,19120,19120,19120,19120,19120,19120,19119,17071,17071,17071,17071},
-	{8390,8391,8423,8423,8423,8423,8423,8423,8423,8423,8391,27439,65535,44406,8423,8423,8423,8423,12584,52826,65535,57051,54906,54906,54906,50680,16810,35890,65535,38003,10439,10439,40116,65535,35858,10439,10471,10439,10439,8391,10471,14600,14600,14600,14600,14632,14632,14632,16745,52825,65535,54906,21035,16777,54971,61309,23116,12552,12584,12584,6441,6441,4425,8488,4425,2377,2377,2377,2377,4393,6409,6409,6472,2438,2438,2470,2470,2470,2470,2470,2471,2471,2471,2471,2471,2471,2471,2471,2471,2471,2471,2471,2471,4519,4551,4551,2503,4519,4520,4488,8489,8458,8458,8458,10570,14699,16779,20908,22955,14794,6600,20907,22956,14762,4520,4520,4489,4457,4520,4552,4552,4521,4521,4521,4489,4457,4457,6506,4458,4458,4458,4426,6506,8554,10603,10603,10603,18764,20812,20812,10602,4458,14700,14700,12619,18764,18764,18764,16716,10635,16716,16717,16717,16717,8524,2348,4395,4395,4396,4396,4363,4364,2348,4428,6604,6636,6636,6636,6636,6636,6636,10765,25265,20944,16719,16719,14671,18831,20912,20912,20880,16751,16719,20880,20912,16752,16719,16720,16720,16720,16720,16720,16720,16720,18768,12719,10702,12750,10702,10702,10702,10702,8653,8653,8685,6637,6637,8653,8653,8653,8621,12748,16843,20906,20906,22890,22825,22826,22858,18730,22859,22826,16617,16618,18698,18698,18698,18699,18699,10571,2443,12587,10571,18699,6507,427,4491,427,2443,10603,427,427,2475,8555,10570,14635,4588,460,427,428,460,460,460,460,460,460,460,460,460,460,460,460,492,492,492,492,492,492,492,492,493,493,8814,19152,19152,19152,19152,19152,19152,19152,19152,19153,19153,19152,19152,19152,19152,19152,19152,19153,19153,19152,19152,19152,19153,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19120,19120,19120,19120,19120,19120,19120,17072,17072,17071,17071,17071,17071,17071},
-	{8390,8391,8423,8423,8423,8423,8423,8423,8423,8423,8390,27439,65535,46454,10471,8423,10471,8423,12584,50713,63390,25326,14729,16810,14729,14665,10439,35858,65535,40116,12584,12584,40148,65535,35858,10439,10471,10439,10439,8391,10471,14600,14600,14600,14600,14632,14632,14632,16745,50713,63422,29487,16745,18922,57019,59197,23116,12552,14632,14632,10536,8488,8488,8488,2345,2377,2377,2377,2377,4393,6409,6409,6440,2407,2439,2439,2407,2439,2439,2439,2439,2470,2471,2471,2471,2471,2471,2471,2471,2471,2471,2471,2471,2471,2503,4551,4519,2503,2503,2504,6504,6473,8489,8458,10538,16779,18827,20907,20907,14794,6600,20907,22956,14731,4457,4489,4457,6537,4552,4552,4552,4489,6537,4489,4457,4458,4457,4457,4458,4458,4458,4458,6506,18860,20909,22957,20844,20812,20812,20812,10634,6506,14668,14668,6474,12620,18764,16716,16716,8587,16717,16717,16717,16717,8492,4395,6379,6379,4363,4363,6379,4364,2349,4396,4492,6636,6636,6636,6636,6636,4588,6637,21136,25201,16719,14671,14671,18831,20911,20911,20880,16719,16719,18832,20912,18768,16720,16720,16720,18768,20880,16720,16720,18768,20881,18832,14735,18832,18832,18832,18832,20880,16783,12654,10669,6637,8653,14702,16719,16718,16718,16718,16718,18828,18891,20874,22825,22826,22858,20778,22859,18697,16616,16617,16618,18698,18698,18698,18698,14635,6506,16683,8523,16683,6507,395,10571,2443,8555,12619,427,427,8555,18699,18665,18666,14700,2475,428,427,428,460,460,460,460,460,460,460,460,460,460,460,460,460,492,492,492,492,492,492,6702,10863,15023,19152,17104,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,17104,19152,19152,19152,19152,19120,19120,19120,19120,19120,19120,19120,17072,17072,17071,17071,17071,17071,17071},
-	{8390,8391,8423,8423,8423,8423,8423,8423,8423,8423,8391,27439,65535,46454,10471,8423,8423,8423,10471,21100,54971,57051,52858,52858,50680,16842,10439,14729,44341,61277,52858,52858,59197,65535,35858,10439,10471,10439,10439,8390,10471,14600,14600,14600,14600,14632,14632,14632,14632,25229,54971,57051,54906,54938,61277,31632,14664,14632,12584,12584,10536,8488,10536,2345,2377,2377,2377,2377,2377,4393,6409,6409,6440,2375,2375,2375,2375,2375,2375,2375,2375,2439,2470,2471,2471,2471,2471,2471,2471,2471,2471,2471,2471,2471,2471,4551,4551,2503,4519,4551,4552,4520,6504,6473,10570,16779,18860,20907,20907,14794,6600,20907,22956,14730,4457,4489,4457,4489,4552,4552,4520,4489,4521,4521,6505,8554,12683,12683,12683,12683,12651,12650,14731,12652,16748,22892,20812,20812,20812,20812,10634,6506,16748,14668,4426,8523,16716,16716,14700,8587,16717,16717,16717,16717,8492,6411,8426,6379,4363,4363,6379,4364,4364,4364,6507,6636,6636,4588,4588,4588,4588,10766,27314,23089,14671,14671,14671,16751,18864,20911,20880,18800,14671,18832,18832,12623,16720,16720,10543,12623,20881,18768,16720,18768,18800,16720,16719,16719,16719,16719,16719,16719,16719,16719,14703,8653,12686,16719,16719,16719,16718,16718,16718,16718,18859,20874,22825,22858,22858,20778,22859,18698,16616,16617,16617,18698,18698,18698,18698,18699,8522,16683,8523,16683,6506,426,10571,2443,12619,12619,427,427,12619,20746,18665,18666,18699,8523,427,4491,6540,460,460,460,460,460,460,460,460,460,460,460,460,460,492,492,492,492,6702,12943,15024,19152,19152,17104,17104,19152,19152,17104,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,15023,8878,17104,12975,17104,19152,19120,17072,17072,17072,17072,17072,17072,17071,8845,12974,17071,17071,17071,17071},
-	{8390,8390,8423,8423,8423,8423,8423,8423,8423,8423,8391,18955,35923,27406,8423,8423,8423,10471,8423,10503,31632,38003,38003,38003,35890,14729,10439,8391,23148,38003,38003,38003,37971,37971,23148,10439,10471,8390,10439,8391,10471,14599,14600,14600,14600,14600,14632,14632,14600,14632,33712,40083,40083,40083,37938,16809,12552,14632,12584,12584,10536,8488,10536,2345,2377,4392,2377,2377,2377,4393,6409,6409,6441,2343,2375,2375,2375,2375,2375,2375,2375,2439,2471,2471,2471,2471,2471,2471,2471,2471,2471,2471,2471,2471,2471,4551,4551,4551,2503,4551,4551,4551,4552,4552,6537,10570,16779,20907,20907,14730,8553,20907,22956,14730,4457,4457,4457,4489,4520,4552,4520,4489,4489,4457,4458,12683,24972,22924,22924,22892,22860,22892,22892,14668,18764,20812,20812,20812,20812,18764,10634,4489,12651,14668,4426,6507,14668,16717,14700,8587,16717,16717,16717,16717,10508,8426,6379,4364,4363,4363,6379,4364,6379,6379,6507,4490,6604,4588,6636,6636,4588,10766,23121,16751,14671,14671,14671,16719,18832,20912,20912,18832,8495,16784,12655,6447,16752,12623,4398,6447,20880,18800,16720,16720,18800,16720,16720,16720,16720,16720,16719,16719,16719,16719,16719,12686,14671,16719,16719,16718,16718,16718,16718,16718,18859,22857,22857,22825,22858,20778,20778,20777,16616,16616,16617,18698,18698,18698,18698,18698,10570,16682,8523,16651,6506,426,10571,2443,12619,12619,427,427,12619,18698,18665,18666,18699,12586,427,6540,16716,4524,460,460,460,460,460,460,460,460,460,460,460,492,2540,4621,12943,12943,15023,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,19152,19152,17104,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,19152,17104,17104,19152,17104,12975,10927,15023,17104,17104,17072,17104,17072,17072,17072,17072,17072,15023,6797,15023,17071,17071,17071,15023},
-	{8390,8390,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8390,8390,8423,8423,8423,10471,8423,10471,8391,8391,8391,8391,8391,10471,10471,10471,10439,10439,10439,10439,8390,10439,10471,10471,10439,8390,10439,8391,10471,14599,14600,14600,14600,14600,14632,14632,14632,12584,12551,12551,12551,12551,12551,12584,12584,12584,12584,12584,10536,8488,12584,8488,2345,8488,8488,2377,2377,4393,6409,6409,6440,2343,2375,2343,2375,2375,2375,2375,2375,2407,2407,2407,2407,2439,2471,2471,2471,2471,2471,2471,2471,2471,2471,2503,2503,2503,2503,4519,4519,4552,4552,4552,4520,8490,16779,20907,20907,16747,10538,20907,22956,14730,4457,4457,4457,4521,4520,4552,4520,4489,4457,8554,14699,18795,22892,22860,22860,20812,22860,20812,20812,20812,20812,20812,20812,20812,18764,18764,10634,8586,12651,14668,4458,4458,8555,16716,16748,8587,16717,16717,16717,12588,10508,6378,6379,4364,4363,4363,6379,6379,6379,6379,6507,4522,6636,4588,6636,6636,4556,10702,23153,16783,14671,14671,14671,16719,18863,20912,20912,16783,4398,8527,8527,4398,12656,8527,2350,6479,20912,18800,16720,16720,18800,16720,16720,16720,16720,16720,16719,16719,16719,16719,16719,14703,16719,16719,16719,16718,16718,16718,16718,16718,18828,20811,22825,22857,24906,20778,20778,22826,16616,16616,16617,16650,16650,18698,18698,18698,16650,16650,8522,16651,6506,426,10571,2443,12619,12619,427,427,14667,18698,18665,18666,18698,18698,6540,6540,20780,12620,2475,459,459,460,460,460,460,460,460,460,492,10862,14991,15023,17072,17072,17072,17072,17072,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,19152,19152,17104,17104,17104,17104,17104,17104,17104,17104,17104,19152,15024,8878,10926,17072,17104,17072,17104,17072,17072,17071,17071,12974,10894,8845,17071,17071,17071,15023,15023},
-	{8390,8391,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8390,8423,8423,8423,8423,8423,10471,10471,10471,10439,10471,10471,10471,10471,10471,10471,10471,10471,10471,10439,10471,10471,10471,10439,8390,10439,8391,10471,12551,12551,14599,12552,12551,12584,14600,14600,12584,12584,12552,12552,12552,12584,12584,12584,12584,12584,12584,8488,8488,12584,12584,4392,8488,10536,2377,2377,4393,6409,6409,6440,2343,2343,2343,2375,2375,2375,2375,2375,2375,2376,2376,2376,2376,2407,2407,2407,2408,2408,2408,2471,2471,2471,2471,4519,4519,4519,4519,4520,4520,4552,4552,4520,8490,16779,20907,20907,14730,10570,20908,22956,14731,4457,4457,4489,4520,4520,4552,4552,4489,6537,16747,22860,22860,22860,22860,22860,22860,20812,20812,20812,20812,20812,20812,20812,20812,18764,18764,12682,10635,8586,12651,4426,4458,4458,10571,14668,8587,16717,16717,14669,10508,10508,6378,6378,6379,6379,4364,6379,6379,6379,6411,6572,6636,6636,4588,6636,4588,4556,10734,27314,16815,14671,14671,14671,16719,18831,18864,16751,14735,4398,2350,4398,4398,6447,4399,4398,4399,12624,16720,16720,16720,18800,16720,16720,16719,16720,16720,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16718,16718,16718,16718,16780,18763,22825,22857,24906,20778,20778,22858,18697,14536,16616,16650,16650,18698,18698,18698,18698,18698,10570,16651,6506,394,10571,4490,14635,14635,2443,6507,18699,18699,18665,18665,18665,18666,8555,6540,20780,20780,10603,2475,459,460,459,460,460,460,460,460,2540,14991,19120,17072,17072,17071,17072,17072,17072,17072,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,15055,8878,8878,15023,17072,17104,17104,17072,17072,17071,10926,10926,10894,10894,17071,17071,17071,15023,15023},
-	{8390,8391,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8390,8423,8423,8423,8423,8423,10471,8423,8423,10439,10471,10471,10471,10471,10471,10471,10471,10471,10471,10439,10439,10471,10471,10439,8390,8391,10471,12551,12551,12551,12551,12552,12552,12552,12552,12552,12552,12584,12584,12584,12584,12584,12584,12584,12584,12584,12584,8488,8488,10536,8488,4392,8488,10536,2377,2377,4393,6409,6409,4392,2343,2343,2343,2375,2375,2375,2375,2375,2376,2376,2376,2376,2376,2376,2376,2376,2376,4424,4424,2408,2408,2408,4456,4456,4456,4456,4456,4456,4488,4520,4520,4488,8490,16779,20907,20907,12714,8617,20907,16747,14730,4457,4457,4521,4552,4552,4552,4552,4489,8554,20811,22860,22860,22860,20812,20812,20812,20812,20812,20812,20812,20812,20812,20812,18764,18764,18764,10634,14699,10634,14700,8523,4426,4458,8555,14668,8587,14669,16717,14669,10507,10508,6379,6379,6379,6379,6379,6379,6347,6379,6539,4588,4588,6636,6636,6636,6636,4588,10766,27314,16783,14671,14671,14671,16719,18831,18864,18832,14767,4398,4398,4398,4398,4398,4398,4398,6447,14671,16720,16720,16720,18800,16720,16720,16719,16720,16720,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16718,16718,16718,16718,16780,18763,22825,22857,24906,22826,22858,22858,20777,16584,16616,16649,16650,16650,18698,18698,18698,18698,16650,18698,6506,394,10570,8522,18699,18699,6507,6507,18699,20747,18666,18665,18665,18666,10603,8587,20779,20748,18732,12620,4523,427,459,460,460,460,492,524,492,10862,12943,14991,17072,17072,17104,17072,17072,17072,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,15023,8878,8878,10926,15023,17104,17104,17103,17104,17071,17071,17072,17071,17071,17071,17071,15023,15023,15023},
-	{8390,8390,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8390,8423,8423,8423,8423,8423,8423,8423,8423,8423,10471,10471,10439,10439,10439,10439,10471,10471,10471,10439,10438,10471,10471,10439,8390,8390,10471,12551,12551,12551,12551,12551,12552,12552,12552,12552,12584,12584,12551,12551,12552,12584,12552,12584,12584,12584,12583,8488,8488,8488,8488,4392,8488,10536,2376,2377,4393,6409,6409,4392,2343,2343,2343,4391,4391,4391,2375,2375,2375,2376,2376,2376,2376,2376,2376,2376,2376,2376,2376,4424,4424,2408,4456,4456,4424,4424,4424,4424,4456,4456,6504,4456,6441,10570,20907,20907,12713,6568,16811,14698,14730,4425,4457,4489,4520,4520,4520,4520,4489,6537,20843,22859,20812,20812,20812,20812,20812,20812,20812,20812,20812,20812,20812,18764,18764,18764,18764,10634,14699,10634,16716,16716,10571,4458,8555,14700,8587,14669,16717,14669,10539,10507,6379,6378,6379,6379,6379,6347,6347,6475,6636,4588,4588,4588,6636,6636,6636,4588,10766,27314,16783,14671,14671,14671,16719,18831,18863,18832,8526,4398,4398,4398,4398,4398,4398,4398,6447,16719,16720,16720,16720,18800,16720,16720,16719,16720,16720,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16718,16718,16718,16718,16780,18763,22825,22857,22858,22858,22858,22858,20777,16616,16616,16649,16650,16650,18698,18698,18698,18698,18698,18698,6506,394,6506,8522,18699,18699,6507,6507,18699,18699,18666,18665,18665,18666,16683,8555,20779,20748,20748,14667,10604,8587,459,459,460,492,589,622,556,492,491,2572,10862,10862,14991,17104,17072,17104,17104,17104,19152,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,15055,12974,12974,15055,17104,17104,17103,17103,17103,17103,17071,17071,17071,17071,17071,15023,15023,15023,15023},
-	{8390,8390,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8390,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,10471,10471,10439,10439,10471,10471,10471,10439,8390,10471,10471,10439,8390,8390,8423,12551,12551,12551,12551,12551,12551,12551,12552,12552,12552,12552,10503,8454,12551,12552,12552,12584,12584,12584,10503,6407,8488,8488,6440,4392,8488,8488,2377,2377,4393,6409,6409,4392,2343,2343,4391,8423,8423,6407,2343,2375,2376,2376,2376,2376,2376,2376,2376,2376,2376,2376,4424,4424,2408,2439,2440,2408,4424,4424,4424,4424,4425,6473,12586,8553,6442,8553,16810,14762,6568,4520,6568,8617,10634,4425,4425,4457,4520,4520,4520,4520,4489,8586,20843,20812,20812,20812,20812,20812,20812,20812,20812,20812,20812,20812,18764,18764,18764,18764,14699,4521,8586,8586,16716,18765,12620,4458,6538,6538,6538,16717,14669,14636,12556,8427,6378,6378,6379,6379,6379,6347,6347,6507,6636,4588,4588,4588,6636,6636,6636,4556,10766,27314,16783,14638,14671,14671,16719,18831,18863,12623,4398,4398,4398,4398,4398,4398,4398,4398,6447,16720,16720,16720,16720,16720,16720,16720,16720,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16718,16718,16718,16718,16780,18764,22825,22857,22858,22858,22858,22858,20777,18696,16616,16649,16650,18698,18698,16650,18698,18698,18698,18698,6506,394,394,4490,14635,18699,8555,10571,18699,18699,18666,18665,18665,18666,18731,10603,16683,20748,20780,14667,12619,16684,4523,459,459,492,621,653,556,460,492,459,491,6701,12943,17071,17072,17072,17104,17104,19152,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17103,17103,17103,17103,17071,17071,17071,17071,17071,17071,15023,15023,15023,15023},
-	{8390,8390,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8390,8423,8423,8423,8423,8423,8423,8391,8423,8423,8423,8423,10471,10471,10471,10471,10439,10471,10471,10439,8390,10471,10471,10439,8390,8390,8423,12551,12551,12551,12551,12551,12551,12551,12551,12552,12552,12552,10503,12551,12552,12552,12552,12552,12552,12584,12584,10503,10503,10536,8488,4392,8488,8488,2344,2377,4393,6409,6409,4392,2343,4391,6407,8423,8391,8423,2343,2375,2376,2375,2376,2376,2376,2376,2376,2376,2376,2376,6440,4392,6472,6472,6472,6472,4424,6440,8488,8489,8521,8521,12586,8553,6441,4488,4520,4520,4520,4520,4520,4520,4520,4489,4457,4425,4457,4520,4520,6537,8585,16747,22860,20812,20812,20812,20812,20812,20812,20812,20812,20812,20812,20812,18764,18764,18764,18764,10635,4521,4521,4521,12651,16717,12620,4458,4521,2473,6538,14669,12588,8426,8427,8426,6378,6378,6379,6379,6379,6347,6379,6540,4588,4588,6636,6636,4588,6636,4588,6636,14926,27314,16783,14639,14671,14671,16719,18863,16815,4398,4398,4398,4398,4398,4398,4398,2350,4398,12624,16720,16719,16719,16719,16720,16720,16720,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16718,16718,16718,16718,16718,16779,16717,20778,22857,22858,22858,22858,22858,20777,18697,16616,16649,16649,18698,18698,16650,16650,18698,18698,18698,6506,394,394,394,6506,16651,8523,16683,18699,18699,18666,16617,16617,18666,20747,14667,6539,18731,20747,14667,12651,20779,8587,459,459,492,621,653,556,459,459,2540,8782,15023,17071,17071,17071,17071,17103,17104,17103,17103,17103,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17103,17103,17103,17103,17071,17103,17071,17071,17071,17071,17071,15023,15023,15023,15023,15023},
-	{8390,8390,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8390,8423,8423,8423,8423,8423,8423,8391,8423,8423,8423,8423,8423,8423,10471,10471,10439,10471,10471,10439,8390,10471,10471,10439,8390,8390,8391,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,10503,12551,12552,12551,12583,12552,12552,12584,12584,10503,10503,12584,10536,2344,8488,8488,2344,2345,4393,6409,6409,4392,4391,8423,8423,8423,8423,8423,2343,2375,2375,2375,2376,2376,2376,2376,2376,2376,2376,2376,6440,6440,10504,10504,12552,12552,8488,10504,8488,8489,8489,10537,14634,8553,6442,4488,4520,4520,4520,4520,4520,4488,4488,4520,4489,4457,4457,4489,4488,12618,16715,18763,20812,20812,20844,22892,22892,22892,22892,20844,20812,20812,20812,20812,18764,16747,18764,18764,8586,4521,4521,2473,8586,16716,12620,4489,2473,2473,6538,14669,8427,6378,6378,8426,6378,6378,6379,6347,6347,6379,6475,6636,6636,4588,4588,4588,6636,6636,4588,6605,23185,27314,16783,14639,14639,14671,16719,18863,12687,4398,4398,4398,4398,4398,4398,6447,8495,12591,16720,16719,16720,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16718,16718,16718,16718,16718,16779,16717,20778,22857,22858,22858,22858,22858,20777,20745,16616,16649,16649,18698,16649,16650,16650,18698,18698,18698,6506,4458,6506,10570,6506,16682,8523,16683,18699,18699,18666,16617,16617,18666,18699,16683,6539,8555,18699,14667,12619,20779,8587,459,459,492,589,621,524,459,491,8814,15023,17071,17071,17071,17071,17071,17103,17104,17104,17103,17103,17103,17103,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17103,17103,17103,17103,17103,17103,17103,17071,17071,17071,15023,15023,15023,15023,15023,15023},
-	{8390,8390,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8390,8423,8423,8423,8391,8391,8391,8423,8391,8391,8423,8423,8391,8423,10471,10471,10471,10471,10471,8391,8390,10471,10471,10439,8390,8390,8390,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,10503,12551,12551,12552,12552,12552,12584,12584,12584,10503,10503,12584,10536,2344,8488,8488,2344,2344,4393,6409,6409,6408,8423,8391,8391,8423,8423,8423,4391,2375,2375,2375,2375,2376,2376,2376,2376,2376,2376,2376,6440,6440,10504,12552,12552,12552,8488,10504,8488,8489,8489,14634,14634,8553,6441,4488,4520,4520,4520,4488,4456,4425,4457,4488,4520,4520,4457,4425,4457,16747,20812,20812,20812,20811,20844,22924,22924,22924,25005,20844,20812,20812,18764,18764,18764,10634,16748,18764,12651,4521,4521,2473,8586,16716,12651,2473,2473,2473,6538,14669,8426,6378,6378,6378,6378,6379,6379,6379,6347,6379,6571,6636,4588,4588,4588,4588,6572,6604,6541,12718,25234,27314,16783,14670,14671,14639,14671,16815,6510,2350,4398,4398,4398,2350,4398,12591,16719,16719,16720,16720,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16718,16718,16718,16718,16718,16717,16718,16717,18764,20811,22858,22858,22858,20777,20745,16616,16617,18697,18730,16649,16649,16650,16650,18698,18698,14634,14634,8522,16682,16682,16650,8522,16683,18699,18699,18666,16617,16617,18666,18699,18699,14667,4491,12619,14667,12651,18732,8587,459,459,492,524,589,524,459,459,4620,6701,15023,17071,17071,17071,15023,15023,15023,15023,17103,17103,17103,17103,17103,17104,17104,17104,17104,17104,17104,17103,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17103,17103,17103,17103,17103,17103,17071,17071,15023,15023,15023,15023,15023,15023,15023,15023,15023},
-	{8390,8390,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8390,8423,8423,8423,8391,8423,8423,8391,8391,8423,8423,8423,8391,8423,10471,10471,10471,10471,10471,8391,8390,10471,10471,10439,8390,8390,10471,12551,12551,12551,12551,12551,12551,10503,10502,10502,10503,12551,10503,12551,12551,10503,10503,10503,10503,10503,12583,10503,10503,12551,8455,4391,6407,8455,6440,2344,4393,6409,6409,6408,8423,8423,8423,8423,8423,8423,6375,6407,6407,6407,6407,4391,2375,2376,2376,2376,2376,2376,6440,6440,10504,12552,12552,12552,8488,10504,8488,8489,8489,14634,14634,8552,6472,4520,4520,4520,4520,4456,4425,4425,4425,4456,4488,4457,4457,4457,4426,16715,20811,20811,20811,20811,20811,20812,20811,20812,22957,20844,20812,18764,18764,18764,18764,10634,8586,10635,8586,4521,4521,2473,4521,8587,6538,2473,2473,2473,6538,14669,8426,8427,8427,6378,6378,4363,6379,6379,6475,6507,6604,4588,4588,4588,4588,6604,6509,6541,6413,16880,27346,27314,16783,14670,14670,14639,14639,16783,6510,2350,2350,4398,8495,10543,10543,14671,16719,16719,16720,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16718,16718,16718,16718,16718,16718,16718,16718,16717,16717,16717,16716,18764,20778,20777,18697,16616,16617,18698,18698,16649,16650,16650,16650,16650,16617,16617,16650,8522,16682,18698,16650,8554,16683,18699,18699,18698,16617,16617,18665,18699,18699,18699,12619,4491,10603,4491,4491,2475,459,459,492,524,491,491,459,459,459,491,10862,15023,15023,15023,4652,2572,4652,10894,17103,17103,17103,17103,17103,17103,17103,17103,17103,17103,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17104,17103,17103,17103,17103,17103,17103,17103,17103,17103,17103,17071,15055,15023,15023,15023,15023,15023,15023,15023,15023,15022},
-	{8390,8390,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8390,8423,8391,8391,8391,8423,8423,8391,8391,8423,8423,8423,8423,8391,8391,8423,10471,10471,10471,8391,8390,10439,10471,10439,8390,10470,12551,12551,12551,12551,12551,12551,12551,10503,10503,10503,8454,12551,10503,8454,10503,10502,10503,10503,10503,10503,10503,8454,10503,10503,8455,10503,10535,10503,10536,4392,4392,6409,6409,6408,8423,8423,8423,8391,8423,8423,8423,8423,8391,8423,8423,8455,6407,6407,6407,6407,4392,2376,6440,6440,10504,12552,12552,12552,8488,10504,8488,8489,8489,14602,14634,6504,4456,4520,4520,4520,4520,4456,4425,4425,4425,4425,4425,4425,8553,12650,6473,16714,20811,20811,20811,20811,20811,20812,20811,20812,22924,20812,20812,18764,18764,18764,18764,8586,4521,4521,4521,4521,4521,4521,2473,2473,2473,2473,2473,2473,6538,14669,12556,8427,8427,6378,6379,6379,6379,6379,6571,6604,6604,4556,4588,4588,6572,6540,6477,6413,6381,16880,27346,27314,16783,14670,14670,14670,14639,14703,6478,2350,4398,6446,14671,16719,14671,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16718,16718,16718,16718,16718,16718,16718,16717,16717,16717,16717,16717,16717,18730,18696,18696,16616,16649,18698,16649,16649,16649,16649,16650,16650,16617,16617,16650,8522,16650,18698,10570,4458,16650,18698,18698,18698,16617,16617,16617,18699,18699,18699,18731,8555,2475,8555,2475,459,427,459,459,459,459,459,459,459,459,459,2540,4620,2572,2540,2572,2572,10894,15023,17103,17103,17103,17103,17103,17103,17103,17103,17103,17103,17103,17103,17103,17103,17103,17103,17104,17104,17103,17103,17104,17103,17103,17103,17103,17103,17103,17103,17103,15055,15055,17103,17103,15055,15055,15055,15055,15023,15023,15023,15023,15023,15023,12975,12975},
-	{8390,8390,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8390,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8391,8423,10471,10471,8390,8390,10439,10471,10439,8390,10470,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,10502,12551,12551,10503,10503,10503,12551,12551,12551,10502,10503,10503,12551,10503,10503,12583,12584,12584,10536,4392,4393,6409,6409,6408,8423,8423,8423,8391,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,10471,6408,2376,6440,6440,10504,10504,12552,12552,8488,10504,8488,8489,8489,14602,14634,6504,4488,4488,4456,4456,4520,4456,4425,4425,4425,4425,4425,10570,16715,18763,6473,16715,20811,20811,20811,20811,20812,20811,20812,20844,22924,20812,18764,18764,18764,18764,14699,6569,4521,4521,4521,2473,2473,2473,4521,2473,2441,4458,2442,4521,10604,14669,14669,14669,8427,6378,6347,6378,6346,6379,6443,6443,6443,6539,4588,6604,6540,6508,6445,6381,6381,16880,27346,27314,16783,14638,14670,14670,12591,6478,6446,8494,12591,12623,14671,14671,14671,14671,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16719,16718,16718,16718,16718,16718,16718,16718,16717,16717,16717,16717,16717,16717,16683,18696,18696,16616,18697,18730,16649,16649,16649,16649,16650,16650,16617,16617,16650,8522,10538,12586,4458,12586,18698,18698,18698,18698,16617,16616,16617,18699,18699,18699,18699,16683,6539,6507,2475,459,427,459,459,459,2539,4620,4620,4620,4620,4620,4620,8781,6700,4620,12942,15023,15055,17103,15055,15055,15055,15055,15055,15055,17103,17103,15055,17103,15055,15055,17103,15055,15055,17103,17103,15055,15055,15055,17103,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15023,15023,15023,15023,12975,12975,12975,12975},
-	{8390,8390,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8390,8390,8423,8423,8423,8423,8391,8423,8423,8423,8423,8423,8423,8423,8423,8423,8391,8423,10471,8390,8390,10471,10471,10439,8390,8390,10503,12583,12551,12551,12551,12551,12551,12551,12551,12551,8454,10503,12551,12551,10503,8454,10503,12551,10503,8454,12551,10503,10503,10503,10503,12584,12583,12584,10536,4392,4393,6409,6409,6376,8391,8423,8423,8391,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,10471,10471,6408,2376,6440,6440,10504,10504,12552,12552,8488,10504,8488,8489,8489,14634,14634,6504,4456,4456,4456,4456,4488,4425,4425,4425,4425,4425,6473,8521,14666,16715,6473,16714,20811,20811,20811,20811,20812,20812,20812,20844,22924,18764,18764,18764,18764,18764,14699,4521,4521,4521,4521,4521,4521,4521,2473,4489,4458,2441,2410,4490,14668,16717,16749,16749,8427,6346,6346,6378,6346,6443,6539,6539,6539,6572,6540,6443,6508,6476,6445,6413,6381,16880,29394,27314,16815,16782,16750,14671,12622,4398,6446,12623,14671,14671,14671,14671,14671,16719,16719,16719,16719,16719,16719,16719,16719,12623,8494,14671,14671,16719,16719,16719,16719,16719,16719,16719,16718,16718,16718,16718,16718,16718,16718,16718,16718,16717,16717,16717,16717,16717,16717,16717,16716,18697,18696,18697,18730,18730,16649,16649,16649,16649,16649,16650,16617,16617,16650,6474,6505,6474,10570,18698,18698,18698,18698,18698,16617,16616,16617,18699,18699,18699,18699,18699,12619,4491,2475,427,459,427,459,4620,12942,15023,15022,15022,15023,15023,15023,15023,15023,15023,15023,15023,15055,15023,15023,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15023,15023,15023,15023,15023,15023,15023,12974,12974,12974,12975},
-	{6342,8390,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8422,8390,8390,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8391,8423,8423,8390,8390,8391,10471,8391,8390,8390,10471,10535,12551,12551,12551,12551,12551,12551,12551,12551,10502,8454,8454,8454,10503,8454,8422,8454,8454,10503,10503,8454,8454,8454,10503,12583,12583,12583,10536,4392,4393,6409,6409,6408,8391,8391,8391,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,10471,10471,6407,6408,6408,6440,10504,10504,12552,12552,8488,10504,8488,8489,8489,14634,14633,6504,4456,4424,4424,4424,4424,4425,4425,4425,4425,4425,10570,16715,18763,16715,6473,16714,20811,20811,20811,37875,48536,48536,48536,48536,50584,44278,22989,18764,18764,37908,46488,42391,42423,42423,42423,42423,42390,15053,2409,4458,4490,2441,6571,36021,46488,46488,44343,21007,8427,6346,6346,6379,6379,6379,27570,44440,44408,44408,44408,29651,6508,6379,10606,38103,44409,48569,52762,50714,48569,50649,48569,46457,23186,12590,8494,8494,12591,14671,14671,14639,23089,46425,48537,31572,16687,16719,16719,16719,16719,14671,6446,4398,6446,12622,14670,16719,16719,16719,16719,16718,16718,16718,16718,16718,16718,16718,16718,16718,16718,16717,16717,16717,16717,16717,16717,16717,18829,42165,48503,39987,20810,18697,16649,16649,16649,16649,16649,16649,16617,16617,16649,8522,14602,16650,16650,18698,18698,18698,18698,18698,16617,16616,16617,18698,18699,18698,25037,46359,46488,29586,2443,427,427,459,8749,14990,15022,15023,15023,15023,15023,15023,15023,15023,15023,15023,15023,15023,15023,15023,15023,15023,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15023,15023,15023,15023,15023,15023,12975,12974,12974,12974,12974},
-	{6342,8390,8391,8423,8423,8423,8423,8423,8423,8423,8423,8423,8391,8390,8390,8423,8390,8390,8422,8423,8423,8423,8423,8423,8423,8391,8423,8423,8423,8391,8423,8423,8390,8390,8391,10471,8391,8390,8391,10471,10471,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,10503,10503,10503,10503,10503,10503,10503,10503,10503,12551,12551,12551,12583,12583,12583,10535,4392,4360,6409,6408,6408,8391,8391,8391,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,10471,10471,6407,6407,6408,6440,10504,10504,10504,12552,8456,10504,8488,8489,10537,14601,14633,6504,4424,4424,4424,4424,4425,4425,4425,4425,4425,6473,16715,18763,20811,18763,8521,14666,20811,20843,22956,48536,65535,63390,63390,63390,65503,59165,27247,18796,18764,48568,65535,65535,63422,61342,61342,63422,63454,25521,4490,4426,4426,4458,12845,54971,65503,63422,61310,27345,8459,6346,6346,6379,4364,6509,42328,65535,61342,61342,65535,46520,10701,6379,12751,57117,65535,63455,63422,63422,63422,63422,63422,61310,27411,10542,6446,4397,12591,14671,14671,14639,27314,63390,65535,40087,14639,16719,16719,16719,16719,16719,8494,2350,4397,4398,6446,12622,12622,14670,16719,16718,16718,16718,16718,16718,16718,16718,16718,16718,16717,16717,16717,16717,16717,16717,16717,16717,18894,57019,65535,52729,20810,16649,16649,16649,16649,16649,16649,16649,16617,16617,16649,8522,14602,18698,18698,18698,18698,18698,18698,18698,16617,16617,16617,18698,18698,18698,27214,61309,65535,42198,2442,427,426,459,12910,15022,15022,15022,15023,15023,15023,15023,15023,15023,15023,15023,15023,15023,15023,15023,15023,15023,15023,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15023,15055,15023,15023,12974,12975,12974,12974,12974,12974,12974},
-	{6342,8390,8423,8423,8423,8423,8391,8423,8423,8422,8422,8423,8423,8390,8422,8423,8423,8391,8391,8390,8422,8422,8423,8423,8423,8423,8391,8423,8423,8423,8391,8423,8390,8390,8391,8423,8390,8390,8391,8391,10471,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,10503,8454,8454,8454,8454,8454,8454,8454,10503,12583,12583,12583,12583,12583,12551,10535,6440,8456,6409,6408,6408,8391,8391,8391,8391,8423,8423,8391,8423,8423,8423,8423,8423,8423,10471,8423,10471,6407,6407,6440,6440,10504,10504,10504,10504,12552,12552,8488,10537,12553,14601,14601,8521,4424,4424,4424,4424,4425,4425,4425,4425,4425,6473,18763,18763,18763,18763,16715,18795,20811,22989,50681,63390,52794,29359,29327,27279,44213,63455,57052,31505,18764,48568,65535,57148,19279,15053,15021,23409,61309,57148,31827,2378,2346,17039,54939,63454,42231,35828,63422,57084,27441,6314,6346,6346,8557,46521,61342,48698,17007,16975,48601,63422,48665,12685,12718,57117,65535,48634,31604,35797,33684,27345,25265,21105,8591,4398,4398,8494,12622,14671,14671,14638,27314,63390,65535,40087,14638,14671,14671,16719,16719,16719,8494,4397,4398,4397,4397,4398,4397,8494,14670,16718,16718,16718,16718,16718,16718,16718,16718,16718,16717,16717,16717,16717,16717,16717,16717,16685,18862,57019,65535,52729,20810,16649,16649,16649,16649,16649,16649,16649,16617,16617,16649,8522,14601,16617,16650,16650,18698,18698,18698,18698,18698,16617,16617,18698,18698,18698,27214,61309,65535,44246,12618,10603,10603,10732,14990,15022,15022,15022,15023,15022,15023,15023,15023,15023,15023,15023,15023,15023,15023,15023,15023,15023,15023,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,12975,12974,12974,12974,12974,12974,12974,12974},
-	{6342,8390,8423,8423,8423,8423,8391,8423,8422,8422,8423,8423,8422,8390,8422,8423,8391,8423,8423,8423,8391,8391,8423,8391,8423,8423,8391,8423,8423,8423,8391,8423,8390,8390,8391,8423,8390,8390,8391,8391,10471,10503,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12583,12551,12551,12551,12583,12583,12583,12551,10535,6440,8456,6409,6409,6376,8391,8391,8391,8423,8423,8423,8391,8391,8423,8423,8423,8423,8423,8423,8423,8423,6407,6407,6440,6440,10504,10504,10504,10504,12552,12552,8488,10537,14601,14601,14601,12585,4424,4424,4424,4424,4425,4425,4425,4425,4425,10570,18763,18763,18763,18763,20843,22956,20844,25069,59132,65535,50616,18763,18731,18731,33649,57019,57019,31505,18764,48568,65535,57116,8779,2440,2377,12909,59261,65535,38166,4426,12781,31731,63422,57084,31635,25264,54971,63455,38070,14765,6378,10571,21168,57116,59229,38070,6347,6347,35957,54972,48665,10637,12717,57117,65535,44409,23153,23153,23089,14670,12590,6445,2349,2349,4397,8494,14670,14671,14670,14638,27314,63390,65535,40087,16686,10542,10542,16718,16719,14670,6446,4397,4397,4397,4397,4397,4397,4397,8494,10542,14670,16718,16718,16718,16718,16718,16718,16717,16717,16717,16717,16717,16717,16717,16717,16717,18862,57019,65535,52729,18762,18697,16649,16649,16682,16682,16682,16683,16650,16616,16649,8521,14601,16617,16650,16650,18698,18698,18698,18698,18698,16617,16617,18698,18698,18698,27214,61309,65535,44246,18698,18699,18795,14958,15022,15022,15022,15022,15022,15022,15022,15022,15022,15022,15022,15023,15023,15023,15023,15023,15023,15023,15023,15055,15023,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,12975,13006,12974,12974,12974,12974,12974,12974,12974},
-	{6342,6342,8391,8423,8423,8423,8391,8423,8423,8423,8423,8423,8391,8390,8422,8423,8423,8423,8423,8423,8423,8423,8391,8423,8423,8423,8423,8423,8423,8423,8423,8423,8390,8390,8391,8423,8390,8390,8391,8391,10503,12583,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,10503,10503,10503,10503,10503,8455,8424,4328,6409,6376,8391,8390,8358,8390,8391,8390,8390,8390,8390,8391,8423,8423,8391,8390,8390,8391,6343,6375,6408,6440,10504,10504,10504,10472,10472,10472,8456,10505,12521,12521,12553,12585,4424,4424,4424,2344,2344,2344,4392,6441,8489,16682,18763,18763,18763,20843,20876,22956,20843,25069,59132,65535,50616,18763,18731,18731,20876,20909,20909,18796,18764,48568,65535,57116,8747,2377,2377,12909,59229,65535,38166,4395,40118,63422,61310,21232,14701,16749,25200,57084,65503,44408,12682,27536,61309,65535,31795,6475,6347,6347,8492,10572,8556,6379,12717,57116,65535,44408,23120,16846,16847,12590,8494,4397,2349,2349,2349,6446,12622,14670,14670,14638,25266,63390,65535,40086,14606,10510,4397,8526,10574,6445,2317,2317,2317,2317,2317,2317,4397,4397,4397,4397,8493,16718,16718,16718,16718,16718,16685,16685,16685,16685,16685,16685,16685,16717,16717,16684,18861,54971,65535,52729,18729,16617,16617,16682,14667,14635,14635,14635,14602,14536,16617,6441,8489,16617,16650,16618,16617,16617,16650,16617,16617,16585,16584,16617,18698,16618,27182,61309,65535,44213,16618,18666,16779,14990,15022,15022,15022,15022,15022,15022,15022,15022,15022,15022,15022,15022,15022,15023,15023,15023,15023,15023,15023,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,13007,13007,13007,13006,12974,12974,12974,12974,12974,12974,12974},
-	{6342,8390,8391,8423,8423,8423,8423,8423,8422,8423,8423,8423,8422,8390,8422,8422,8422,8422,8422,8422,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8390,8390,8423,8423,8390,8390,8391,8391,10503,10535,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,14729,29551,31664,31664,31664,31664,31664,29617,23311,6441,6376,8423,25325,29584,25293,10536,25326,29584,29584,27471,12616,8391,8391,21100,29584,29584,29584,29584,29584,27504,10633,10504,10504,10472,18923,31633,31633,29617,31665,33713,33681,20972,10505,4424,4424,8650,25520,27601,27601,27601,31698,33746,27246,18730,18763,18763,20843,20843,20843,20843,22956,44246,59164,56987,37843,35795,37843,37875,33650,20876,18764,18764,48568,65535,59229,31827,27602,27601,33940,61342,50746,25489,4394,42230,65535,61310,16975,8460,14669,23055,57052,65535,46553,6442,23376,63455,65535,29682,4330,6347,6379,6347,6347,6347,6347,12717,57116,65535,52858,40054,35892,35892,21169,4365,2349,2349,2349,2349,4397,6445,8494,12590,23153,42167,63422,65535,50650,33716,27540,8623,2349,2349,17041,27572,27572,27572,27572,27572,25459,6542,4397,4397,4397,4397,10542,16718,16718,16717,18863,33683,35796,35796,35796,35796,35796,27313,16717,16684,20974,35828,59197,65535,57019,35761,35761,23052,14634,14635,21005,33714,33746,33714,33681,33681,29649,18924,16617,16617,25069,35730,35729,22988,23020,35729,35729,35729,27246,16650,25133,42100,63390,65535,52729,35730,35730,21037,14990,15022,15022,15022,15022,15022,15022,15022,15022,15022,15022,15022,15022,15022,15022,15023,15023,15023,15023,15023,15023,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15054,15054,15055,15055,15054,13006,13006,13006,13007,13007,13006,12974,12974,12974,12974,12974,10926,10926,10926},
-	{6342,6342,8391,8423,8423,8423,8423,8423,8423,8423,8423,8423,8390,8390,8390,8422,8422,8422,8422,8422,8423,8423,8423,8423,8423,8422,8423,8423,8423,8423,8423,8423,8390,8390,8423,8423,8390,8390,8391,8391,10503,10535,10503,10503,10503,12551,12551,12551,10503,12551,12551,12551,12551,12551,12551,12551,12551,12583,12583,12583,12583,10503,21067,61309,65535,65535,65535,65535,65535,65535,52858,10601,6376,10536,52825,65535,52793,14729,52858,65535,65535,61309,18987,8390,8390,40148,65535,65535,65535,65535,65535,59197,14859,10472,10504,10440,29519,65503,65535,65535,65535,65535,65503,31569,10505,4424,2344,17069,61342,65535,65535,65535,65535,65535,40052,16682,18763,18763,18763,18763,18763,18763,18763,18763,48471,65535,65535,65535,65535,65535,59164,23054,18731,18764,48568,65535,65535,65535,65535,65535,65535,63454,21296,2346,4426,42230,65535,61310,16975,10508,16749,23055,57052,65535,46553,4363,21265,63455,65535,29619,6314,6379,6379,6379,6379,6379,6347,12717,57116,65535,65535,65535,65535,65535,42295,4365,2349,2349,2349,2349,2349,2349,4397,4365,33910,65535,65535,65535,65535,65535,61342,14993,2317,2317,38135,65535,65535,65535,65535,65535,59229,12847,4365,4397,4397,4397,8493,16718,16718,16685,23120,61277,65535,65535,65535,65535,65535,44279,16684,16684,29425,63422,65535,65535,65535,65535,65535,35827,14635,14635,31602,65503,65535,65535,65535,65535,65503,31536,16585,16617,35729,65535,65503,31504,35761,65535,65535,65535,44278,16617,37907,65535,65535,65535,65535,65535,63422,27440,12910,14990,14990,14990,15022,15022,15022,15022,15022,15022,15022,15022,15022,15022,15022,15023,15023,15023,15023,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15055,15054,13006,13006,13006,13006,13007,13006,13006,13006,12974,12974,12974,12974,10926,10926,10926},
-	{6342,6342,8391,8423,8423,8423,8423,8423,8423,8423,8423,8423,8390,8390,8390,8422,8390,8390,8390,8422,8423,8423,8423,8423,8391,8423,8422,8422,8423,8423,8423,8423,8390,8390,8422,8423,8390,8390,8391,8391,10503,10567,10567,10535,10567,10567,10567,10567,10567,10567,12615,10567,10567,10567,10567,12615,12615,10567,12615,12615,12615,10567,21099,61309,65535,50745,33809,33841,33809,48664,61309,40213,14795,10503,52825,65535,59197,42261,33810,31697,31697,31632,12648,10536,35890,55003,57051,33777,31697,31697,42293,63390,44407,23181,10472,29552,50713,61309,38003,33778,33778,33778,33778,21004,10505,4392,21262,46552,63390,38133,35826,33810,31762,37907,27278,18730,18763,18763,18763,18763,18763,18763,18763,18763,31504,37940,37907,37908,37907,50584,63390,48504,27279,18764,48568,65535,61309,33940,29715,29715,29715,29714,10797,2378,4426,42198,65535,63422,46489,42263,46424,48536,61310,65535,48633,8459,23313,63455,65535,29619,6346,6347,6379,6379,6379,6379,6347,12717,57116,65535,54939,38005,31730,38005,21169,4365,2349,2349,2349,2349,2349,4397,2349,2349,14960,38135,63422,65535,46586,29684,27604,8622,6509,31829,55004,55036,29717,29716,29684,40248,63390,44441,17073,4365,4397,4397,4397,8493,14637,27313,48537,63390,44376,35828,35860,35860,35861,27345,14669,14636,20974,37941,59197,65535,57052,35859,35859,23118,14635,14635,21038,35859,35859,35859,35794,40019,61309,52761,33649,16617,35729,65535,65535,52761,42132,37874,37875,37875,29358,16618,27214,42165,63422,65535,52761,37875,37842,21037,12942,14990,14990,14990,15022,15022,15022,15022,15022,15022,15022,15022,15022,15022,15022,15022,15022,15022,15022,15055,15055,15054,15055,15023,15023,15054,15055,13007,15055,15055,15055,15055,13007,13007,13007,13007,15055,15055,13007,13007,15055,13006,13007,15055,13006,13006,13006,13006,13006,13006,13006,13006,13006,12974,13006,12974,12974,10926,10926,10926,10926,10926},
-	{6342,6342,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8390,8390,8390,8422,8422,8422,8390,8422,8422,8422,8422,8423,8423,8423,8391,8390,8391,8423,8391,8423,8390,8390,8422,8423,8390,8390,8391,8391,10503,10566,10566,10566,10566,10567,10567,10567,10567,10567,10567,10567,10567,10567,10567,10567,12647,12647,12647,12647,10599,10566,21131,61309,65535,40180,10534,10567,10534,38034,65535,63390,19053,10503,52825,65535,65535,61277,18987,6310,8390,8390,8391,12648,54938,65535,50680,12616,10504,10503,27471,65503,65535,31633,10439,42261,65535,59196,21036,12585,14666,14666,14666,14634,10537,4392,31826,65503,63422,23279,14698,12682,8585,18827,18795,18762,18763,18763,18763,18763,18763,18763,18763,18763,18731,18731,18731,18731,18731,37843,65535,65503,33650,16684,48568,65535,57084,8684,2345,2346,2345,2345,2378,4426,4426,42230,65535,65535,63454,63422,63422,63454,65535,65535,50682,14668,25328,63455,65535,29619,6346,6379,6379,6379,6379,6379,6347,12717,57116,65535,44408,16845,6376,16846,8427,6380,2349,2349,2349,2349,2349,4397,4397,4397,2316,17041,61342,65535,33910,2284,2316,2317,8590,52891,65535,48666,4429,2317,2284,21298,65503,65535,27604,2316,4397,4397,4397,4397,4364,27571,63455,63455,25458,6477,8557,8557,8557,6476,6444,6443,4363,8588,54971,65535,48633,6443,4362,4394,6443,6442,6474,8555,8555,8555,10537,20971,59196,65535,46423,16617,35729,65535,65535,65535,44277,16584,16617,16617,16617,18698,16618,25134,61309,65535,44213,16618,18666,16715,14925,14990,14990,14990,14990,15022,14990,15022,15022,15022,15022,15022,15022,15022,15022,15022,15022,12974,15022,15022,15022,15054,15054,15054,12974,13006,13006,13006,13006,13006,13007,13006,13006,13007,13007,13006,13007,13007,13007,13007,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,12974,10926,10926,10926,10926,10926,10926},
-	{6342,6342,8423,8423,8423,8423,8423,8423,8391,8391,8391,8423,8390,8390,8390,8422,8422,8422,8422,8390,8390,8422,8422,8423,8423,8423,8423,8423,8422,8390,8391,8423,8390,8390,8391,8423,8390,8390,8391,8391,8455,10566,10566,10566,10566,10566,10566,10566,10566,10567,10567,10567,10567,10567,12647,12647,12647,12647,12615,12615,12615,10566,21131,61309,65535,40180,10567,12647,10567,38035,65535,63390,21100,10503,52825,65535,54971,23213,10536,8391,8423,8423,8391,12616,54938,65535,61309,52858,52826,52826,57051,65535,65535,31633,10440,16875,38003,63422,54939,52858,54906,54906,52826,27343,10473,4392,8682,27633,61342,57051,54906,52858,52858,54906,35762,16682,18763,18763,18763,18763,18763,18763,18763,18763,18731,18763,18763,18763,18763,37875,65535,65503,33650,16684,48568,65535,57084,10764,2378,4426,4426,4426,4426,4426,4426,42230,65535,63390,27571,21168,27345,31602,59165,65535,50682,18830,29522,63455,65535,29619,6314,6346,6379,6346,6346,6346,6346,12717,57116,65535,46456,16878,8456,16878,8427,6379,2349,2349,2349,4397,4397,4397,4397,2349,2317,17073,61342,65535,35957,6347,6412,4397,8622,52923,65535,48666,4429,4397,2316,23346,65503,65535,27604,2316,4397,4397,4397,4396,4396,8622,25459,61309,57084,50811,50811,50811,52859,29716,2315,4395,4363,8620,54971,65535,48633,4427,4395,4394,4394,2314,19151,50778,50810,50810,50810,54939,63454,65535,46423,16617,35729,65535,65503,40020,22987,16616,16649,16617,16616,16650,16618,27214,61309,65535,44245,18698,18698,18730,16876,14990,14990,14990,14990,12942,15022,15022,15022,12974,12974,15022,15022,15022,12974,12974,15022,12974,12974,12974,12974,13006,13006,13006,12974,12974,12974,12974,13006,13006,13006,13006,13006,13007,13007,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,12974,10926,10926,10926,10926,10926,10926,10926},
-	{6342,6342,8423,8423,8423,8423,8423,8423,8391,8423,8423,8423,8390,6342,8390,8422,8422,8422,8422,8422,8422,8390,8422,8422,8422,8422,8423,8423,8423,8391,8423,8423,8390,8390,8423,8423,8390,8390,8391,8391,8455,10566,10566,10566,10566,10567,10567,10567,10567,10567,10567,10567,10567,10567,10599,10599,10599,12647,10599,10599,10599,10567,21131,61309,65535,40180,10567,10599,10567,38035,65535,63390,21100,10503,52825,65535,52793,10503,8390,8423,8391,8423,8391,12616,54938,65535,63422,57084,57083,57083,57083,57051,57051,27439,10472,10439,25294,57051,57084,57084,57084,59164,63454,35859,16811,4424,2344,14956,54938,57084,57084,57084,59164,65503,44278,23020,18763,18763,18763,18763,18795,20843,20875,25133,27246,23021,18763,18763,18731,37875,65535,65503,33650,16683,48568,65535,57084,10764,2378,4426,4426,4426,4426,4426,4426,42198,65535,61310,16975,8460,14668,18894,57052,65535,50682,18862,29490,57052,63455,35957,12684,6379,6347,12685,16910,14797,6379,12717,57116,65535,44408,16878,8456,16878,8427,6379,4364,4364,4397,2349,4397,4397,4397,4397,2317,17073,61342,65535,35925,6347,6380,4364,8589,52891,65535,48666,6477,4364,4332,23346,65503,65535,27571,4364,4396,4396,4396,4396,4396,2316,10734,50778,57084,57084,57084,57084,63454,42360,10734,4396,4363,8620,54971,65535,48633,4427,4395,4394,4394,8620,29715,63454,57116,57084,57084,57116,65503,65535,46422,16617,35729,65535,65503,31504,14504,16616,16649,16617,16616,16650,16618,27214,61309,65535,44245,16650,18730,18730,16876,14990,12942,12942,12942,12942,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,10926,10926,10926,10926,10926,10926,10926,10926},
-	{6342,6342,8423,8423,8423,8423,8423,8423,8391,8423,8423,8423,8391,6342,8390,8422,8423,8391,8422,8422,8422,8422,8422,8422,8422,8422,8423,8423,8423,8391,8423,8423,8390,8390,8423,8423,8390,8390,8391,8391,8423,8486,10534,10534,10534,10534,10534,10534,10534,10534,10534,10534,10534,10534,10534,10534,10534,10534,10534,10566,10566,10534,21099,61309,65535,40148,10502,10534,8454,38002,65535,63390,21100,10503,52825,65535,52825,10536,8390,8423,8423,8423,8391,12616,54938,65535,50713,14729,12649,12649,12649,14729,14762,12585,10472,10472,10504,14730,14730,16778,16779,23149,59197,63422,42229,6440,2344,6472,18859,16843,18891,18891,21036,57019,65503,50648,18827,18762,18762,18795,20875,20843,25133,54939,63390,46423,18763,16683,16683,37843,65535,65503,33650,16683,48568,65535,57084,10764,2378,4426,4426,4426,4426,4426,4426,42230,65535,61310,19055,12620,16749,18926,57052,65535,50682,18894,18894,23184,59164,63422,42295,6346,6314,40150,61310,54939,12685,12717,57116,65535,44408,16845,10570,18958,6347,6314,6347,6347,4364,2349,2349,2349,2349,4396,4332,17040,61342,65535,35925,6314,6347,6347,10573,54939,65535,48633,8427,6347,6315,25329,65503,65535,29587,6347,6412,6412,4396,4396,4396,4364,4364,8589,8621,8621,8621,8653,48698,65535,48698,6540,4363,8620,54971,65535,46585,4395,2314,2314,4394,38134,63422,59197,14990,8587,8587,21068,59196,65535,46422,16585,35729,65535,65503,31535,14536,16616,16617,16649,16616,16650,16618,27214,61309,65535,42165,16714,14828,14860,14925,12942,12942,12942,12942,12942,12942,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,10958,10926,10926,10926,10926,10926,10926,10926,10926,10926},
-	{6342,6342,8423,8423,8423,8423,8423,8423,8391,8423,8423,8423,8391,6342,8390,8423,8423,8422,8422,8422,8422,8390,8422,8390,8422,8422,8422,8422,8423,8423,8423,8423,8390,8390,8423,8423,8390,8390,8391,8423,6343,8422,8453,8421,8453,8453,10501,10501,10501,10501,10501,10501,10501,10501,10501,10501,10501,10501,10501,10501,10501,10469,19018,61309,65535,48599,27470,27470,27438,46486,61341,46487,16874,10503,52825,65535,52825,10536,8390,8423,8391,8423,8391,10536,40116,59164,54938,27471,27407,27439,27439,25326,12617,10472,10472,21101,29520,27439,27439,29488,29488,33746,61309,54939,35826,12585,16972,29552,31601,31601,31601,31601,33713,59164,59132,42132,18795,18762,18762,18763,18763,18763,23020,46390,61245,54907,33650,33649,33649,46391,63422,50681,27312,16715,48568,65535,57084,10764,2378,4426,4426,4426,4426,4426,4426,40182,65535,61310,23216,16781,18861,21007,57052,65535,50682,18894,18829,21006,44343,59197,52859,27473,25393,50746,59229,42263,10572,12717,57116,65535,52826,33780,35859,37973,29586,29554,29554,21071,14798,14831,8590,2348,2349,4364,6347,14830,44408,61310,46488,25361,25361,10572,10540,38070,57116,54971,27474,29554,29554,40150,63422,48633,23216,8395,8427,8427,6411,6412,6379,12782,25426,25426,23378,23378,23378,25458,54971,57117,38102,6508,4363,6508,38102,57116,54971,25458,23377,12813,2314,27635,52891,61309,29683,23376,27440,35761,61309,65535,46422,16617,35729,65535,65503,31535,14536,16616,16617,16649,16617,16649,16650,23020,48503,61309,50681,31730,29747,17135,12941,12942,12942,12942,12942,12942,12942,12942,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,10958,10958,10958,10958,10926,10926,10926,10926,10926,10926,10926,10926},
-	{6342,6342,8423,8423,8423,8423,8423,8423,8391,8423,8423,8423,8391,6342,8390,8423,8423,8422,8422,8422,8422,8390,8422,8390,8422,8422,8422,8422,8423,8423,8423,8423,8390,8390,8390,8423,8390,8390,8391,8423,8391,8422,8453,8453,8453,8453,8453,10501,10469,10501,10501,10501,10501,10501,10501,10501,10501,10501,10501,10501,10502,10469,19018,61309,65535,65535,65535,65535,65535,65535,52857,10601,8391,10536,52825,65535,52825,10536,8390,8423,8423,8423,8423,8423,8423,40180,65535,65535,65535,65535,65535,59197,18923,10472,10472,44342,65535,65535,65535,65535,65535,65535,65503,31601,12553,14633,38004,65535,65535,65535,65535,65535,65535,65535,40052,16714,18762,18762,18762,18762,18762,18763,20843,18795,46455,65535,65535,65535,65535,65535,59164,23086,16715,16748,48568,65535,57084,10764,6474,4426,4426,4426,4426,4426,8555,42230,65535,63390,27345,18829,18861,21007,57052,65535,50682,18894,18861,18861,18862,46456,65535,65535,65535,65535,44408,10540,16878,23216,59197,65535,65535,65535,65535,65535,65535,65535,65503,37974,27314,27346,23153,16912,16944,16911,18959,18927,23120,54939,65535,65535,63390,29490,18927,21007,46424,65535,65535,65535,65535,65535,61277,27378,20975,18895,8492,6411,6412,6412,4331,29619,65535,65535,65535,65535,65535,65535,65535,38134,4395,4395,4395,4395,4395,38134,65535,65535,65535,29683,2314,2314,23409,65503,65535,65535,65535,65535,65535,65535,46422,16617,35729,65535,65503,31535,14536,16584,16617,16650,16617,16649,18698,18698,20811,52761,65535,65535,63422,25553,12909,12941,12941,12941,12942,12942,12942,12942,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,10958,10958,10958,10926,10958,10958,10926,10926,10926,10926,10926,10926,10926},
-	{6342,6342,8423,8423,8423,8423,8423,8423,8423,8391,8423,8423,8391,6342,8390,8423,8423,8422,8422,8390,8390,8390,8422,8422,8422,8390,8422,8422,8423,8423,8423,8423,8390,8390,8390,8423,8390,8390,8391,8423,8391,8422,8421,8453,8453,8453,8453,10501,8453,10501,10501,10501,10501,10501,10501,10501,10501,10501,10501,10501,10501,10469,19018,61309,65535,52825,35921,35921,35921,35922,29583,8488,8423,10503,29551,35922,29551,10503,8391,8391,8423,8423,8391,8391,8391,23213,35890,35890,35890,35890,35890,33777,14697,10472,10472,25326,35923,35923,35923,35923,38003,40083,37971,21037,12553,14633,27310,40052,40052,40052,40052,40052,40052,40052,27310,16714,16714,18762,18762,18762,18762,18762,20843,18763,33617,40052,40052,40052,40052,42133,37907,18860,10570,8522,27473,33940,27634,6571,6474,4426,2378,4426,4426,4426,12684,31538,42166,37973,18926,14668,14668,16781,35828,40118,33715,18861,18861,18861,18861,31602,40118,40086,35957,33844,23313,8459,12685,14830,35957,46392,44344,44344,44344,44344,44344,35990,31829,17040,10670,10670,12750,12750,12750,23185,29394,29394,29426,42167,46424,46424,44312,33619,29394,29394,37941,46424,46392,46392,46392,46424,44280,21105,12718,12718,4396,4396,4396,4396,4396,14959,33877,33877,33877,33909,33909,33877,33909,19184,4395,4395,4395,4395,4395,19184,33908,31828,33876,14958,2314,2314,12845,31828,31828,35923,37938,37938,37938,37939,29423,16617,25133,40019,39987,23019,14536,14536,16617,16649,16617,16649,18698,18698,18730,33746,38166,38166,36085,19215,12941,12941,12941,12941,12941,12941,12942,12942,12974,12974,12942,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,15086,13038,13006,13006,13006,13006,13006,13006,13006,13006,13006,13006,10958,10958,10958,10958,10958,10926,10958,10958,10926,10926,10926,10926,10926,10926,10926},
-	{6342,6342,8423,8423,8423,8423,8423,8423,8423,8391,8423,8423,8391,6342,8390,8423,8391,8391,8422,8391,8423,8422,8390,8422,8390,8422,8390,8422,8422,8422,8422,8423,8390,8390,8391,8423,8390,8390,8391,8423,8423,8423,8423,8422,8422,8421,8421,8453,8421,10470,10502,10501,10502,10502,10502,10502,10502,10502,10502,10502,10502,8421,19018,61309,65535,40147,8421,8421,10469,10469,10469,8455,8423,8390,8390,8358,8390,8390,8391,8391,8423,8423,8423,8423,8423,8390,8390,8390,8390,8390,8390,8391,10472,10504,10504,10472,10472,10472,10472,10473,18888,21000,12521,12553,12553,14633,16746,16746,16746,16746,16746,18794,18794,18794,16714,16714,16714,18762,18762,18762,18762,18762,20875,20875,20875,18731,16683,16683,18731,16747,12587,12619,4425,4425,4426,2345,2345,4426,2378,4458,6570,4458,4426,4426,12684,20877,18829,16748,14668,16781,14668,16749,16716,16749,16781,16781,14636,14701,16813,16781,14636,12588,10508,4331,2315,4363,4363,2315,6477,21104,27313,23152,8589,8557,8557,4396,2316,2316,2348,2348,2348,2348,2348,10670,27313,29394,29394,29394,29394,29394,29394,29394,29394,29394,29394,29362,29362,29362,29362,29362,21073,8525,4396,4364,4396,4396,4396,4396,4396,4396,2315,2315,2315,12815,12815,2315,2315,4395,4395,4395,4395,4395,4395,4363,2314,2314,2314,4362,4394,4394,2314,2314,2313,6376,14503,14503,14503,14503,14536,14536,16616,16617,16585,14536,16616,14536,16617,16649,16616,16649,18698,16650,16682,12844,12909,12909,12909,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,12942,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,13006,13006,12974,12974,13006,13006,13006,13006,13006,23469,21358,13006,13006,13006,13006,13006,13006,10958,13006,10958,10958,10926,10958,10958,10958,10958,10926,10926,10926,10926,10926,10926,10926,8910,8878,8878},
-	{6342,6342,8423,8423,8423,8423,8423,8423,8391,8423,8423,8423,8391,6342,8391,8423,8423,8391,8423,8391,8422,8422,8390,8423,8423,8422,8422,8390,8422,8422,8422,8423,8390,8390,8391,8423,8390,8390,8391,8423,8391,8391,8391,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,18987,61309,65535,40148,8423,10471,10471,10471,10471,8456,8423,8390,8390,8390,8390,8390,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8391,10471,10504,10472,10504,10504,10472,10504,10505,10505,18857,18921,12553,12553,12553,14633,16714,16714,16714,16714,16746,18826,18858,20907,18794,16714,16714,16714,16714,16714,16714,18762,20875,22955,20875,20843,16715,16715,18763,14699,10570,6474,4425,4425,4425,4425,4425,4426,4426,6570,19145,8650,4426,4426,12684,20909,20909,16781,12588,14636,16749,18861,18829,14668,14668,14636,12588,16781,14701,14669,12588,12556,10508,6444,2348,2348,2348,2348,2348,10670,23185,21104,4396,2348,2348,2348,2348,2348,2348,2348,2348,2348,4396,4396,14863,25265,25265,25265,25265,27345,25265,25265,27313,29394,29394,29394,29394,29394,29394,29394,27314,25233,16911,6477,4396,4396,4396,4396,4396,4396,4396,4396,4396,6509,6509,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4394,4394,4394,4394,4394,4394,4394,6409,14536,14535,14535,14535,14536,14536,16617,16649,16617,16584,14536,14536,16617,16617,16616,16649,16650,16650,16682,14925,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,12974,10926,12974,12974,12974,10926,13006,13006,19309,17230,13006,13006,10958,13006,13006,13006,10958,10958,10958,10926,10958,10958,10958,10958,10958,10926,10958,10926,10925,10925,10926,10926,10926,8878,8878},
-	{6342,6342,8423,8423,8423,8423,8423,8423,8391,8423,8423,8423,8391,6342,8391,8423,8423,8423,8423,8423,8391,8390,8423,8422,8422,8422,8422,8390,8422,8422,8422,8423,8390,8390,8391,8423,8390,8390,8391,8423,8391,8391,8391,8391,8391,8391,8391,8391,8423,8423,8423,8391,8391,8423,8423,8423,8423,8424,8424,8424,8424,8391,18988,61309,65535,40148,8391,8424,10472,10472,10472,8456,8423,8390,8390,8390,8390,8390,8423,8423,8423,8422,8423,8423,8423,8423,8423,8423,8423,8423,8391,10471,10504,10472,10504,10504,10472,10504,10505,10505,12553,12553,12553,12553,12553,14633,14665,16713,16714,16714,16713,16746,18826,18826,16746,16714,16682,16714,16714,16714,16714,16714,20875,20843,18795,20875,16715,16715,18763,14699,10570,4425,4425,4425,4425,4425,4425,4426,4426,4490,12873,6570,4426,4426,14732,20909,20909,16781,12556,12588,16748,18861,18861,16781,16749,16749,16781,16781,12588,12588,12588,12556,12556,8492,4396,2348,2348,2348,2348,4396,6509,14830,4395,2348,2348,2348,2348,2348,2348,2348,2348,2348,4396,4396,4428,6509,6508,6508,8556,21071,12750,12718,18992,29394,29394,29394,29394,29394,29394,29394,29394,29394,29394,23153,10638,6476,4396,4396,4396,4396,4396,4396,4396,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4394,4394,4394,4394,4394,4394,4394,4394,10472,14535,14535,14535,14535,14536,16617,16649,16617,16584,14536,14536,16617,16617,16616,16649,16650,16650,16682,14925,12941,12909,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,12974,12974,12974,12974,12974,12974,12974,12974,12973,12974,12973,12973,12974,12974,12974,10926,10926,12974,12974,10926,10926,10926,10926,10926,10958,10958,10958,13006,13006,10958,10958,10958,10958,10958,10958,10958,10958,10958,10958,10958,10926,10926,10926,10926,10926,10926,10925,10925,10925,10926,10926,8878,8877},
-	{6342,6342,8423,8423,8423,8423,8423,8423,8391,8423,8423,8423,8391,6342,8391,8423,8423,8423,8391,8423,8423,8423,8423,8391,8391,8390,8390,8390,8390,8390,8423,8423,8390,8390,8391,8423,8390,8390,8390,8423,8391,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8391,8391,8423,8423,8423,8423,8423,8424,8423,8424,8391,18988,61309,65535,40148,8391,8424,10472,10472,10472,8456,8423,8390,8390,8390,8390,8390,8423,8422,8422,8423,8423,8423,8423,8423,8423,8423,8423,8423,8391,10471,10504,10472,10504,10504,10472,10504,10505,12553,12553,12553,12553,12553,12553,14633,14665,14665,16714,16714,16714,16713,16713,16714,16714,16714,16681,16714,16714,16714,16714,16714,16714,16714,18763,18795,16715,16715,16715,12650,4425,6473,4425,4425,4425,4425,4425,4426,4426,4426,4426,4426,6474,10539,14700,20909,18861,16749,12556,14636,16749,16781,16781,16749,12556,12556,12588,14701,12588,12621,12588,12556,12588,10572,4396,2348,2348,2348,2348,2348,2348,4395,2314,2348,2348,2348,2348,2348,2348,2348,2348,2348,4396,4396,4396,4396,4396,4396,4396,16911,21072,21072,21104,27314,29394,29394,29394,29394,29394,29394,29394,29394,29394,27346,21104,8589,4396,4396,4396,4396,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4394,4394,4394,4394,4394,4394,4394,4394,8457,14536,14535,14535,14536,14536,16616,16617,16617,14536,14536,14536,16617,16617,16617,16649,16649,16650,16682,14925,12909,12909,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,12973,12973,12973,12973,12973,12973,12973,12973,12973,12973,12973,12973,12974,12974,10925,10925,10925,10926,12974,10926,10926,10926,10926,10926,10926,10926,10926,10926,10926,10958,10957,10957,10958,10958,10958,10925,10925,10958,10957,10957,10957,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,8877,8877},
-	{6342,6342,8423,8423,8423,8423,8423,8423,8391,8391,8391,8423,8391,6342,8390,8423,8423,8423,8391,8423,8423,8423,8423,8423,8423,8423,8422,8423,8423,8422,8423,8423,8422,8390,8423,8423,8422,8390,8390,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8391,8391,8423,8423,8423,8423,8423,8424,8423,8424,8423,16842,46487,50713,31665,8423,8423,10472,10472,10472,8456,8423,8390,8390,8390,8390,8390,8423,8422,8423,8391,8391,8423,8423,8423,8391,8423,8423,8423,8391,10471,10472,10472,10504,10504,10472,10504,10505,10505,12553,12553,12553,12553,12553,14633,14665,14665,14666,16714,16714,16713,16713,16714,16714,16714,14633,16714,16714,16714,16714,16714,16714,16714,18763,18795,16715,14667,6473,4425,4425,8522,4425,4425,4425,4425,4426,4426,4426,4426,4426,4426,8523,8523,10571,18829,20909,16781,12588,12555,12587,12587,12588,12556,12556,12556,12588,14701,12556,14668,14636,12556,14701,14733,4395,2348,2348,2348,2348,2348,2348,2348,2348,2348,2348,2348,2348,2348,2348,2348,2348,2348,4396,4396,4395,4395,4395,4395,4395,4395,4396,4428,4427,16911,29394,29394,29394,29394,29394,29394,29394,29394,29394,27313,12749,4396,4396,4396,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4394,4394,4394,4394,4394,4394,4394,4394,4394,4393,10472,14536,14536,14536,14536,14536,16617,16617,14536,14536,14536,16617,16617,16617,16650,16650,16650,16682,14925,12909,12909,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,12973,12973,12973,12973,12973,12973,12973,12973,12973,12973,10925,10925,10925,10925,10925,10926,12974,10926,10926,10926,10926,10925,10925,10925,10925,10925,10925,10957,10925,10925,10957,10958,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,8877,8877,8877,8877,8877,8877},
-	{6342,8391,8423,8423,8423,8423,8423,8423,8423,8423,8423,8391,8391,6342,8390,8423,8423,8423,8423,8423,8391,8423,8390,8390,8455,8455,8423,8423,8423,8423,10503,10503,10503,10503,10503,10503,10503,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8424,8423,8424,8424,10472,10504,10536,10504,10472,10471,10472,10472,10472,8424,8423,8390,8390,8390,8390,8390,8390,8423,8423,8391,8391,8423,8423,8423,8391,8423,8423,8423,8423,10472,10472,10472,10472,10504,10472,10504,10505,10505,10505,12553,12553,12553,12553,14665,14665,14665,16713,16713,16714,16713,16714,14633,16682,16714,14633,16714,16714,16714,16714,16714,16714,16714,18762,18795,16715,12618,4425,4425,4425,4425,4425,4425,4425,4425,4426,4426,4426,4426,4426,4426,4426,4426,8491,16716,18829,16749,12588,12556,12556,12555,12556,12556,12556,12556,12588,14701,12556,14668,14669,12556,14701,14733,4395,2347,2347,2347,2348,2348,2348,2348,2348,2348,2348,2348,2348,2348,2348,2348,2348,4395,4396,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,6476,21104,29394,29394,29394,29394,29394,29394,29394,29394,29394,18992,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4361,6409,10472,14536,14536,14536,16617,16617,16584,14536,14536,16617,16617,16617,16650,16649,16714,14860,12909,12909,12909,12909,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,12973,12973,12973,12973,12973,12973,12973,10925,12973,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,8877,10925,8877,8877,8877,8877,8877,8877,8877},
-	{6342,8391,8423,8423,8423,8423,8423,8423,8423,8423,8423,8391,8391,6342,8423,8423,8423,8423,8423,8423,8423,8423,6342,6342,8423,8455,8423,8455,8455,10503,10503,10503,10503,10503,10503,10503,10503,10503,8423,8423,8391,8423,8423,8423,8423,8423,8423,8423,8423,8391,8391,8423,8423,8423,8423,8423,8423,8424,8424,8423,8424,8424,8424,8423,10472,10472,10472,10471,10472,10472,10472,8424,8423,8390,8390,8390,8390,8390,8391,8391,8391,8423,8423,8391,8391,8391,8423,8423,8391,8423,8423,10472,10472,10472,10472,10504,10472,10504,10505,10505,10505,12553,12553,12553,12553,14665,14633,14665,12585,14665,16714,16713,16714,14633,14633,14634,14633,16714,16714,16682,16682,16714,16714,16714,18762,18795,16715,12618,4425,4425,4425,4425,4425,4425,4425,4425,4425,4426,2378,4426,4426,4426,2378,4426,8491,12555,16748,16781,12556,12556,12588,12555,12588,12588,12588,14668,12588,14701,14668,14701,14668,12556,14701,14733,4395,2347,2347,2347,2348,2348,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,14830,29394,29394,29394,29394,29394,29394,29394,29394,29394,18992,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4393,4393,4361,10472,14536,14536,16616,16617,16616,14536,14536,16617,16617,16617,16682,16682,14860,12909,12909,12909,12909,12909,12909,12909,12909,12941,12941,12941,12941,12941,12941,12941,12941,12941,12973,12973,12973,12973,12973,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877},
-	{6342,8391,8423,8423,8423,8423,8423,8423,8423,8423,8423,8391,8391,6342,8423,8423,8423,8423,8423,8423,8423,8423,6342,6342,8423,8455,8455,8455,8455,8423,10503,10503,10503,10503,10503,10503,10503,10503,8423,8423,8391,8423,8423,8423,8423,8423,8423,8423,8423,8423,8391,8423,8423,8423,8423,8423,8423,8424,8424,8423,8424,8424,10472,8423,10471,10472,10472,10471,10472,10472,10472,8424,8423,8390,8390,8390,8390,8391,8391,8391,8391,8423,8423,8423,8423,8423,8423,8423,8391,8423,8423,10472,10472,10472,10472,10504,10472,10504,10505,10505,10505,12553,12553,10505,12553,14633,14633,14633,12585,14665,14665,14666,16714,14633,14633,14633,14633,16714,16714,14633,14601,14634,16714,16714,16714,18795,16715,12618,4425,4425,4425,4425,4425,4425,4425,4425,4425,2378,4426,4426,4426,4426,2378,4426,8491,12555,14668,16749,12587,12555,12587,12555,12588,12587,12588,14700,12588,14701,14701,14701,14668,12555,14701,14733,4395,2347,2347,2347,2347,2347,2347,2347,2347,2347,2348,2347,2347,2347,2347,2347,2347,4395,4395,4395,10669,18991,18991,18991,18991,18991,18991,18991,18991,18991,23152,29394,29394,29394,29394,29394,29394,29394,29394,27314,10669,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4393,4393,4393,4361,8456,14536,16616,16617,16617,14536,16584,16617,16617,16649,14860,14892,12909,12909,12909,12909,12909,12909,12909,12941,12909,12941,12941,12941,12941,12941,12941,12941,12941,12941,12973,12973,12941,10925,10925,10925,10925,12973,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877},
-	{6342,8391,8423,8423,8423,8423,8423,8423,8391,8423,8423,8423,8391,6342,8390,8423,8423,8423,8423,8423,8423,8423,6342,6342,8423,8423,8423,8423,8455,8455,10503,10503,10503,10503,10503,10503,10503,10503,8423,8391,8423,8423,8423,8423,8423,8423,8391,8423,8423,8423,8391,8423,8423,8423,10503,10503,8423,8424,8424,10471,10472,10472,8424,10472,10472,10472,10472,10472,10472,10472,10472,8424,8423,8391,8390,8390,8390,8391,8391,8391,8391,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,10472,10472,10472,10472,10504,10472,10504,10505,10505,10505,12553,12553,10505,12553,14633,12585,14633,14665,14665,14665,12585,16714,14633,14633,14633,14633,16714,16714,14633,14601,14634,16714,16714,16714,18795,16715,10570,4425,4425,4425,4425,4425,4425,4425,4425,4425,4426,4426,4426,4426,4426,2378,2378,8491,12555,12588,16748,12587,12555,12587,12587,12555,12555,12587,14700,12588,14700,14700,14668,14668,12555,14701,14733,4395,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,4395,4395,4395,6508,10669,10669,10669,10669,10669,10669,10669,10669,14830,27345,29394,29394,29394,29394,29394,29394,29394,29394,25233,6476,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4393,4393,4393,2345,8457,14536,16616,16617,16617,16584,16584,16649,16682,16714,14925,12909,12909,12909,12909,12909,12909,12909,12909,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,8877,10925,10925,10925,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877},
-	{6342,8391,8423,8423,8423,8423,8423,8423,8391,8391,8391,8423,8391,6342,8390,8391,8391,8423,8391,8423,8423,8423,6342,6342,8391,6343,8391,8423,8455,8423,8455,8455,8455,8455,10503,10503,10503,10503,8423,8391,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8391,8423,8423,8423,14727,14696,8424,8424,10471,10471,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,8424,8423,8391,8391,8391,8391,8391,8391,8391,8391,8390,8391,8391,8391,8423,8423,8391,8391,8423,8391,10472,10472,10472,10472,10504,10472,10504,10505,10505,10505,10505,10505,10505,12553,14633,12585,14665,14665,14665,14665,14633,16714,14633,14633,14633,14633,16714,16714,14633,14601,14634,16714,16714,16714,18795,16715,10538,4425,4425,4425,4425,4425,4425,4425,4425,2377,2377,2378,4426,2378,4426,2378,2378,8491,12555,14636,16748,12587,12555,12587,12587,12587,12555,12587,14700,12588,16748,14700,14668,14668,10507,14700,16813,8524,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,4395,4395,4395,4395,2347,2347,2347,4395,6475,6475,6475,6475,10637,27313,29394,29394,29394,29394,29394,29394,29394,27314,14798,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4394,4394,4395,4394,4394,4394,4394,4394,4394,4394,4394,4393,4393,4393,4393,4393,4393,8457,14535,16584,16617,16617,16584,16616,14827,14925,12877,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877},
-	{6342,8391,8423,8423,8423,8423,8423,8423,8423,8391,8423,8423,8391,6342,8391,8423,8391,8391,8391,8423,8423,8423,6342,6342,8391,8423,8391,8391,8423,8423,8423,8423,8423,8423,8423,8455,8423,8423,8423,8391,8423,8423,8423,8423,8423,8423,8423,8423,8391,8391,8391,8423,8423,10471,16775,14695,8424,10472,10471,10471,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,8424,8423,8390,8391,8391,8390,8390,8391,8391,8391,8391,8391,8391,8391,8391,8423,8391,8391,8423,8391,10472,10472,10472,10472,10504,10472,10504,10504,10505,10505,10505,10505,12553,12553,14633,12585,14665,14665,14665,14665,14665,14665,14633,14633,14633,14633,16714,16714,14634,12554,14634,14634,14634,16714,16714,14634,10538,4425,4425,4425,4425,4425,2377,2377,4425,6474,6506,4426,2377,2377,2378,2378,2378,8491,12555,12587,16748,12587,12555,12555,12555,12555,12555,12587,16748,12587,16781,16781,14700,12620,6443,12652,18861,10604,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,4395,4395,4395,4395,4395,4395,6508,14830,25265,25265,25265,25233,25265,27346,29394,29394,29394,29394,29394,29394,29394,21072,6475,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4393,4393,4393,4393,4361,4393,8456,14535,14536,16617,16617,16584,14762,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,10893,10925,10893,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877},
-	{6342,8391,8423,8391,8423,8423,8423,8423,8423,8391,8423,8423,8391,6342,8423,8423,8391,8391,8391,8423,8423,8423,6342,6342,8391,8423,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8391,8423,8423,8423,12616,12583,8424,10472,10471,10471,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,8424,8423,8391,8390,8390,8391,8390,8391,8391,8390,8391,8391,8391,8391,8423,8423,8423,8423,8423,8391,10472,10472,10472,10472,10504,10472,10504,10504,10505,10505,10505,10505,12553,12553,14633,12585,14665,14665,14665,14665,14665,14665,14633,14633,14633,14633,16714,16714,12586,12554,14634,14634,14634,16714,14634,14634,12586,8521,4425,4425,6473,6473,4425,2377,6474,16748,18860,10603,6506,6506,6474,2378,2378,8490,12555,12587,16748,12587,12555,12555,12587,12587,12555,12587,16748,12587,16781,16781,14700,10572,2346,10604,18861,10604,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,4395,2347,4395,4395,4395,4395,4395,4395,16910,21104,23184,23184,23184,25265,29394,29394,29394,29394,29394,29394,29394,29394,29394,16911,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4394,4394,4395,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4393,4393,4393,4393,8456,14536,14536,16616,16616,14568,14892,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,10893,10893,10893,10893,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,8877,10925,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877},
-	{6342,8391,8423,8423,8423,8423,8423,8423,8423,8391,8423,8423,8391,6342,8391,8391,8391,8423,8391,8423,8423,8423,6342,6342,8391,8423,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8423,8423,8423,8423,8423,8423,8391,8391,8391,8391,8423,8423,8423,8423,8423,8423,10472,10472,10471,10471,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,8424,8423,8391,8390,8390,8391,8390,8391,8390,8390,8391,8391,8391,8391,8423,8423,8391,8423,8423,8391,10471,10472,10472,10472,10504,10504,10504,10504,10505,10505,10505,10505,10505,12553,14633,12585,14665,14665,14665,14665,14665,14665,14633,14633,14633,14633,16714,14666,12586,12554,14634,14634,14634,16714,14666,14634,14634,12586,6473,8522,12586,12586,10538,6474,10570,16748,20908,18860,18860,18861,14732,4426,2377,4426,10539,12587,16748,12587,12555,12587,12555,12555,12555,12587,16748,12587,16781,16781,14668,10572,2346,10604,18861,10604,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,4395,2347,4395,4395,4395,4395,4395,4395,4395,4427,4427,4427,4427,4395,14830,29394,29394,29394,29394,29394,29394,29394,29394,21072,6476,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4394,4394,4395,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4393,4393,4361,4393,8457,14536,16584,16584,16584,14568,14892,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12941,12941,12941,12941,12941,12941,12941,12941,12941,12941,10893,10893,10893,10893,10893,10893,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877},
-	{6342,8391,8423,8423,8423,8423,8423,8423,8423,8391,8423,8423,8391,6342,8391,8391,8391,8391,8423,8423,8423,8423,6342,6342,8391,8423,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8423,8423,8423,8391,8423,8391,8423,8423,8423,8423,8423,8423,8423,8423,8423,10471,10472,10472,10471,10471,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,8424,8391,8391,8390,8390,8391,8391,8391,8390,8391,8391,8391,8391,8391,8423,8423,8391,8423,8423,8423,10471,10472,10472,10472,10504,10504,10504,10505,10505,10505,10505,10505,10505,12585,12585,12585,14665,14665,14665,14665,14665,14665,14633,14633,14633,14633,14634,14634,12554,12554,14634,14666,14634,16714,14634,12586,12586,12554,12586,12586,12586,12587,12587,14635,16748,18796,20908,20908,20908,20909,20909,12684,4426,8554,12587,12587,16748,12587,12555,12587,12555,10507,10539,12587,16748,12587,16781,16781,14668,10572,2346,10604,18861,10604,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,14829,29394,29394,29394,29394,29394,29394,29394,27346,12717,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4361,4393,4393,4393,4361,4393,4361,12488,16584,16584,16584,14568,14892,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,14990,15022,12941,12941,12941,12941,12941,12941,12941,12941,10893,10893,10893,10893,10893,10893,10893,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877},
-	{6342,8391,8423,8423,8423,8423,8423,8423,8423,8391,8391,8423,8391,6342,8391,8391,8391,8391,8391,8391,8423,8423,6342,6342,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8423,8423,8391,8391,8423,8391,8423,8423,8423,8423,8423,8423,8423,8423,8423,10471,10471,10471,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,8424,8391,8391,8391,8391,8390,8391,8391,8391,8391,8391,8391,8391,8391,8391,8423,8423,8423,8423,8423,10471,10472,10472,10472,10472,10504,10504,10505,10505,10505,10505,10505,10505,12585,12585,12553,14665,14665,14665,14665,14665,14665,14633,14633,14633,12585,14633,14634,12554,12554,14634,14666,14666,16714,14634,12586,12586,12554,12586,12586,12586,12586,12587,14635,16747,16748,20908,20908,20909,18828,16748,16748,8555,12651,14636,12588,16748,12587,12587,12587,12587,12587,8491,12587,16748,12587,16781,16781,14668,10572,2346,10604,18861,10604,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,4395,2347,2347,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4394,6475,19023,27346,27346,29394,29394,29394,29394,29394,29394,18959,6443,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4393,4393,4393,4393,4393,4361,4361,10472,14536,14536,16584,14568,14892,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,14957,17103,19151,14989,12941,12941,12941,12941,12941,12941,10893,12941,10893,4683,8812,10893,10893,10893,10893,10893,10925,10925,10925,10925,10893,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,8877,8877,8877,8876,8877,8877,8876,8876,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877},
-	{6342,8423,8423,8423,8423,8423,8423,8423,8423,8391,8423,8423,8391,6342,8391,8391,8391,8391,8391,8423,8391,8423,6342,6342,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8423,8391,8391,8391,8423,8391,8423,8423,8423,8423,8423,8423,8423,8423,10471,10471,10471,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,8424,8391,8391,8391,8391,8390,8390,8391,8391,8391,8391,8391,8391,8391,8391,8423,8423,8423,8423,8423,10472,10472,10472,10472,10472,10504,10504,10504,10504,10505,10504,10504,10504,12553,12585,12553,14665,14665,14665,14665,14665,14665,14633,14633,12585,12585,14634,14634,12586,12554,14634,14666,14666,14666,14634,12586,12586,12554,12586,12586,12586,12586,12587,14635,16747,16748,20908,20908,20908,16716,12555,14636,14700,12651,14636,12587,14668,12587,12587,12587,12587,8491,6443,12587,16748,12587,16781,18829,14700,10604,2346,10604,18861,10604,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4394,6475,14798,25233,27346,27346,27346,27346,29394,29394,27346,27314,14798,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4393,4393,4393,4393,4361,4361,4361,4361,6408,12520,16584,14600,14892,12909,12877,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,17070,19184,19184,17071,12941,12941,12941,12941,12941,12941,12941,10893,10892,4682,8844,10893,10893,10893,10893,10893,10925,10925,10925,10925,10924,8876,10925,10925,10925,10925,8877,10925,10925,10925,8877,8877,8876,8876,8876,8877,8876,8876,8876,8877,8877,8877,8876,8876,8876,8877,8877,8876,8877,8877,8877,8877,8877,8877,8877,8877,8877,8877},
-	{6342,8423,8423,8423,8423,8391,8423,8423,8423,8391,8423,8423,8391,6342,8391,8391,8391,8391,8423,8423,8391,8423,6342,6342,8391,8391,8391,8391,8391,8391,8391,8391,8391,8423,8423,8423,8391,8391,8391,8423,8423,8391,8391,8391,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,10439,10471,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,8424,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8423,8423,8423,8391,10472,10472,10472,10472,10472,10504,10504,12585,12584,12584,12585,10504,10504,10505,12553,12553,14633,14665,14665,14665,14665,14665,14633,14633,12585,12553,12553,12585,12586,12554,12586,14666,14666,14666,14634,12586,12586,12586,12586,12586,12554,12586,12587,14635,16747,16748,20908,20908,20908,14668,12587,14635,12651,6506,12587,12555,12555,12587,12587,12587,12587,10539,6443,10539,16748,12587,16748,16748,16781,10603,2346,6475,16781,10604,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,4395,4395,4395,4395,4395,4395,4395,4395,4394,4394,4395,8556,18991,25265,27346,27346,27346,27346,29394,29394,27346,29394,18991,6475,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4393,4361,4361,4393,4361,4361,4361,4393,4361,10472,16584,16648,14892,12909,12877,12877,12909,12909,12909,12909,12909,12909,12909,12909,12909,14957,19151,19152,14989,12909,12909,12941,12909,12941,12941,10893,8812,6763,4715,10893,10893,10893,10893,10893,10893,10925,10925,10893,10924,10892,8876,10924,10924,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8877,8876,8877,8877,8876,8876,8876,8876,8877,8877,8876,8876,8876,8876,8877,8877,8876,8877},
-	{6342,8423,8423,8423,8423,8423,8423,8423,8423,8391,8423,8423,8391,8391,8391,8391,8391,8391,8423,8423,8391,8423,6342,6342,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8423,8423,8391,8391,8423,8423,8391,8391,8391,8423,8423,8423,8423,8423,8423,8423,8424,8424,8424,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,8424,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,10472,10472,10472,10472,10504,12584,12584,12585,12585,12617,12585,10504,10504,12553,10505,10505,12585,12585,14665,14665,14633,14633,14633,12585,12585,12553,10472,12553,12554,12554,12586,14666,14666,14666,14634,12554,12586,12586,12586,12586,12554,12586,12586,12587,14635,16748,20908,18860,18860,14668,12555,12587,6474,4426,10539,12555,12587,12587,12587,12587,12587,12587,8491,6443,12652,6443,6443,12652,18861,10603,8491,10539,16781,10604,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,4395,4395,4395,4395,4395,4395,4395,4394,4394,4394,4394,12749,23152,27345,27345,27346,27346,27346,27346,27346,27346,27346,29394,25265,18991,6475,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4393,4393,4361,4393,4393,4393,4361,4361,4361,4361,4360,12520,14568,14892,12877,12877,12877,12877,12909,12909,12909,12909,12909,12909,12909,12909,12909,14990,14990,12909,12909,12909,12909,12941,12941,12941,8812,8812,6763,6763,10893,10893,10893,10893,10893,10893,10893,10893,10892,10892,10892,8844,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8877,8877,8876,8876,8876,8876,8876,8876,8877,8877},
-	{6342,8423,8423,8391,8423,8423,8423,8391,8391,8423,8423,8391,8423,8423,8423,8423,8423,8391,8423,8423,8423,8423,6342,6342,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8423,8423,8423,8423,8423,8423,8423,8391,8391,8391,8423,8423,8423,8423,8391,8423,8424,8424,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,8424,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,10472,10472,10472,10472,10504,12584,12584,12585,12617,12617,12585,10504,10504,12553,10505,10505,12553,12585,14665,14665,12585,12585,12585,12553,12553,12553,10472,12553,12554,12554,12586,14666,14667,14666,14634,12554,12586,12586,12586,12586,12554,12554,12554,12555,12555,16748,18828,16747,18828,14668,12555,12587,4426,4426,10539,12587,12587,12555,12555,12587,12555,12555,10539,6443,10604,4395,2347,10604,18861,10604,10539,12587,16781,10604,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,4395,4395,4395,4395,4395,4394,4394,4394,4394,4394,8588,25233,27346,27345,27345,27345,27346,27346,27346,27346,27346,27346,29394,29394,25232,8522,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4393,4393,4393,4393,4393,4361,4393,4361,4361,4361,4361,8424,14568,14892,14925,14925,14925,14925,14925,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12941,10893,10893,10893,10892,10893,10893,10893,10893,10893,10892,10892,10892,10892,10892,8844,8844,8844,8844,8844,8844,8844,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8845,6732,6764},
-	{6342,8423,8423,8423,8391,8423,8423,8423,8423,8423,8423,8391,8423,8423,8423,8391,8391,8391,8423,8423,8423,8423,6342,6342,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8423,8423,8423,8423,8423,8423,8391,8391,8391,8423,8423,8423,8423,8391,8423,8423,8424,8424,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,8424,8391,8390,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8423,10472,10472,10472,10472,10504,12584,12584,12585,12617,12617,12585,10504,10504,10504,10505,10505,12553,12585,12585,12585,12553,12585,12585,12553,12553,12553,10472,10505,12554,12554,12586,14666,14667,14666,14634,12554,12554,12586,12586,12586,12586,12586,12555,12555,12587,12587,14635,14635,18828,14668,12555,12587,4426,4426,10539,12587,12587,12555,12587,12587,12587,12555,12587,8491,12652,4395,4394,4427,16781,10604,10539,12587,16780,10604,2347,2346,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2346,4395,4394,4394,4394,4394,4394,6475,19023,25265,27345,27345,27345,27345,27346,27346,27346,27346,27346,27346,27346,27346,27314,16910,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4395,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4393,4393,4393,4393,4393,4361,4393,4361,4361,4361,4360,6408,14601,14892,14925,14925,12877,12877,12877,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,10893,10893,10893,10892,10892,10892,10892,10892,10892,10892,10892,10892,10892,8844,8844,8844,8844,8844,8844,8844,8876,8844,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,8876,6764,6764,4587,6700},
-	{6342,8423,8423,8423,8391,8423,8423,8423,8423,8391,8423,8423,8391,8423,8391,8423,16806,12614,8391,8391,8423,8423,6342,6342,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8423,8423,8423,8423,8423,8423,8391,8391,8391,8423,8423,8423,8391,8391,8423,8424,8424,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,8424,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8423,8423,8423,10471,10472,10472,10472,10504,12584,12584,12617,12617,12617,12617,10504,10504,10504,10505,10505,10505,12553,12553,12553,12585,14665,12585,12553,12553,12553,10472,10505,12554,12554,12586,14666,14666,14666,14634,12555,12554,12554,12586,12586,12586,12587,12587,12587,12587,12587,12587,12587,18828,14668,12555,12587,4426,4426,10539,12587,12587,12587,12555,12587,12587,12587,12555,12587,12652,4395,4394,4395,14732,10604,10539,12587,16780,10604,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,2347,4395,2347,2347,2346,4394,4394,4394,2346,4394,4394,4394,10669,16943,16910,25233,27345,27346,27346,27346,27346,27346,27346,27346,27346,27346,27314,29394,21072,10637,8556,4394,6476,6476,4395,4395,4395,4395,4395,4395,4395,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4393,4393,4361,4393,4393,4393,4361,4361,4361,4361,4361,4360,10505,14860,14925,14925,14925,14925,12877,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,10893,10893,10892,10892,10892,10892,10892,10892,10892,10892,10892,10892,10892,8844,8844,8844,8844,8844,8844,8844,8844,8876,8876,8876,8876,8876,8844,8876,8876,8844,8876,8844,8876,8876,8876,8876,8844,8844,8844,8844,8844,8876,8876,8876,8876,8876,8876,8876,8876,6732,6732,6732,6699},
-	{6342,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8391,8423,8391,8455,23142,14758,6343,8391,8423,8423,6342,6342,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8423,8423,8423,8423,8423,8423,8391,8391,8391,8423,8423,8423,8391,8423,8423,8424,8424,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,8424,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8423,8391,8423,8423,8423,10471,10472,10472,10472,10504,12584,12584,12584,12584,12585,12585,10504,10504,10505,10505,10505,10505,10505,10505,12553,12585,14665,12585,12553,12553,12553,10472,10505,12554,12554,12586,14666,14666,14666,12586,12555,12554,12554,12554,12586,12586,12587,12587,12587,12587,12587,10507,12587,16748,14668,12555,10539,4426,4426,10539,12555,12587,12587,12587,12587,12587,12555,12555,12587,12652,4395,4394,4395,16780,12652,10539,12587,16780,10604,2347,2347,2347,2347,2347,2347,2347,2346,2346,2346,4395,4395,4394,4394,4395,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,8620,10669,16942,18991,18991,18991,18991,25265,27346,27346,27346,27346,27346,27346,27314,27314,21072,12717,14830,8557,8524,8556,4395,4395,4395,4395,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4393,4394,4394,4393,4393,4361,4361,4361,4393,4361,4361,4361,4361,4360,6506,14828,17005,14958,14957,14925,14925,14925,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,10861,10861,10892,10892,10892,10892,10892,10892,10892,10892,10892,10892,10892,8844,8844,8844,8844,8844,8844,8844,8844,8844,8876,8844,8844,8844,8844,8876,8876,8844,8844,8844,8876,8876,8876,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8812,4619,4587,4555,4555,4555,4555},
-	{6342,8423,8423,8423,8423,8391,8423,8423,8423,8391,8423,8423,8391,8423,8391,8423,12615,10503,8391,8423,8423,8423,6342,6342,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8423,8423,8423,8423,8423,8423,8423,8423,8391,8423,8423,8423,8423,8424,8424,8424,8424,8424,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,8424,10471,10471,10471,10471,10439,8391,8391,8391,8391,8391,8391,8391,8391,8423,8423,8423,8423,8423,8391,10472,10472,10472,10472,10504,10504,10471,8423,10472,10505,10505,10504,10504,10505,10505,10505,10505,10505,10505,12553,12617,14665,12585,12553,12553,12553,10472,10505,10506,12554,12586,14666,14666,14666,12587,12555,12554,12555,12554,12554,12554,12554,12587,12587,12587,12555,12587,12587,12587,12587,12555,12587,6474,4426,10539,12555,12587,12587,12587,12587,12587,12587,12555,12587,12652,4395,4394,4395,14732,14668,12555,12587,14700,10603,2346,4394,2346,2346,2347,2347,2346,4394,2346,2346,4394,4394,4394,4394,4395,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,6475,14829,14830,14830,25233,29394,27346,27346,27346,27346,27314,27346,27346,27346,27346,23153,14830,14830,8556,4395,4395,4395,4395,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4393,4394,4393,4393,4393,4393,4361,4361,4361,4361,4361,4361,4361,2312,8586,17006,14957,14957,14925,14925,14957,14925,14957,14957,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,10861,10861,10892,10892,10892,10892,10892,10892,10892,10892,10892,10892,10892,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,4619,4555,4555,2442,2442,2442,2443,2443,2443},
-	{6342,8423,8423,8423,8423,8423,8391,8423,8423,8423,8391,8391,8423,8423,8391,8391,6343,8391,8423,8423,8423,8423,6342,6342,8391,8391,8391,8391,8391,8391,8391,8391,8391,8423,8423,8423,8423,8423,8423,8423,8423,8423,8423,8391,8423,8423,8423,8423,8424,8424,8424,8424,8424,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,8456,12584,12584,12584,12584,10471,8391,8391,10439,10439,8391,8391,8391,8391,8423,8391,8391,8391,8423,8391,10472,10472,10472,10472,10472,10471,10471,8423,10472,10505,10505,10504,10504,10505,10505,10505,10505,10505,10505,10505,12585,12585,12585,10505,12553,12553,10472,10505,10506,12554,12586,14666,14666,14667,12586,12587,14667,16747,16747,16747,16747,16747,12587,12555,12555,12587,12587,12587,12555,12555,12555,12587,10539,4426,10539,12555,12587,12587,12587,12587,12555,12555,14635,14667,12652,4395,2346,4395,14732,14668,12555,12587,10571,10603,4394,4394,2346,2346,2346,2346,2346,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,2346,2346,4394,4394,4394,4394,4394,4394,4394,4394,4394,6475,14829,14830,14830,14830,21072,27346,27346,27346,27346,27346,27346,27314,27314,27314,27346,29394,25233,16911,12717,4395,4395,4395,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4393,4393,4393,4393,4361,4361,4361,4361,4361,4361,4361,2312,8586,14957,14925,14925,14925,14925,14957,14957,14957,14957,14957,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12908,10860,12941,12909,10860,10892,10892,10892,10892,10892,10892,10892,10892,10892,10892,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,6731,2443,2442,2442,2442,2442,2442,2443,2443,2443},
-	{6342,8391,8423,8423,8423,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,6342,6342,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8423,8391,8391,8423,8424,8424,8424,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,10472,8456,12552,14632,14632,12552,10439,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,10471,10472,10472,10472,10472,10471,8423,8423,10472,10505,10504,10504,10504,10504,10505,10505,10505,10505,10505,10505,10505,10505,10505,10505,10505,10505,10472,10505,10506,10506,12586,14666,14666,14666,12586,12587,18827,18859,18859,18859,18860,18828,12587,12555,12555,12555,12555,12555,12555,12555,12555,12587,12587,6474,10539,12555,12555,12555,12555,12555,12555,12555,14667,14700,12652,6443,4394,4394,14732,14668,12554,12554,14667,10603,2346,2346,2346,2346,2346,2346,2346,2346,2346,2346,2346,2346,2346,2346,2346,2346,2346,2346,2346,2346,2346,4394,4394,4394,4394,4394,4394,4394,12749,16943,18991,18991,18991,16910,23184,27346,27346,27346,27346,27346,27346,27346,27314,27314,27314,27346,27346,25233,18991,14798,6443,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4394,4361,4393,4393,4393,4393,4361,4361,4361,4361,4361,4361,4361,4361,4361,2312,2312,8586,14957,14925,14925,14925,14925,14925,14925,12877,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12909,12908,10860,12909,17103,15022,10860,10860,10860,10860,10860,10892,10892,10860,10892,10892,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,8844,6764,4619,2442,2442,2442,2442,2442,2442,2442,2443,2443},
-	{10536,10537,10537,10537,10537,10537,10537,10537,10537,10537,10537,10537,10537,10537,10537,10536,10537,10536,10536,10536,10536,10536,10536,10536,10537,10537,10537,10537,10537,10537,10537,10537,10537,10537,10537,10537,10537,10537,10537,10537,10537,10537,10537,12585,12585,12585,12585,12585,12585,12585,12585,12585,12585,12585,12585,12585,12617,12617,12617,12617,12617,12618,12618,12617,14665,14665,14665,14665,14665,14665,14665,12618,14698,16746,16746,16745,12585,12584,12584,12584,12584,12584,12584,12584,12584,12585,12585,12585,12585,12585,12585,12617,12617,12617,12617,12617,12617,12585,12617,12618,12618,12618,12618,12618,12618,14698,14698,14699,14699,14699,14699,14699,14699,14699,14699,14699,14699,12618,14667,14699,14699,14700,16780,16780,16780,16780,14700,20940,20973,20973,20973,20973,20941,16748,14700,14700,14700,14700,14700,14701,14701,14701,14701,16781,12684,14700,14701,14701,14701,14700,14700,14700,14700,16781,18861,16813,12652,10604,8556,12717,16813,14700,14700,16780,12716,6508,6508,6508,6508,6508,6508,6508,6508,6508,6508,6508,6508,6508,6508,6508,6508,6508,6508,6508,6508,6508,6508,8556,8556,8556,8556,8556,8556,14862,27346,29426,29426,29427,25265,25265,29426,29426,29426,29426,29427,29427,29427,29427,29427,29427,29427,29427,29427,29427,27314,21104,16911,8556,8556,8556,8556,8555,8555,8555,8555,8555,8555,8555,8555,8555,8555,8555,8555,8555,8555,8555,8554,8554,8554,6506,6506,6506,6506,10700,17038,17006,17038,17038,17038,17038,17038,17038,17038,17038,17038,17038,17038,17038,14990,14990,14990,14990,14990,14990,14989,17103,25426,23313,15021,15021,15021,12973,12973,12973,12973,12973,12973,12973,12973,12973,12973,12973,12973,12973,12973,12973,12973,12973,12973,12973,12973,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,10925,8748,6604,6604,6604,6604,6604,6604,6604,6604,6604,6604},
-
-};
@@ -0,0 +1,260 @@
+/* MONTE CARLO TREE SEARCH PLAYER */
+// Host-only reference opponent. Every thread grows its own UCT tree from the same root
+// with its own random stream (root parallelism), and the root visit counts are summed
+// at the end. Threads share nothing while they search, so playouts per second scale
+// with the number of cores. Playouts are random legal colors played with fill() on a
+// copy of the 8x8 Board until the winner is settled (see aiDecided()).
+
+#ifndef MCTS_H
+#define MCTS_H
+
+/* LIBRARIES */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <math.h>
+#include "engine.h"
+#include "ai.h"
+
+#ifndef HOST_BUILD
+#error "mcts.h needs threads and is only built for the host"
+#endif
+
+#include <pthread.h>
+#include <unistd.h>
+
+
+/* MCTS INITIALIZATIONS */
+#define MCTS_MAX_NODES (1 << 20) // per thread; past this, leaves stop expanding
+#define MCTS_MAX_PLAYOUT (BOARD_SIZE * BOARD_SIZE * 4) // moves before a playout is scored as it stands
+#define MCTS_EXPLORATION 1.4
+#define MCTS_LENGTH_PENALTY 0.001 // per move, so equal outcomes are reached sooner rather than stalled
+
+typedef struct {
+    int threads; // worker threads, 0 for one per core
+    int budgetMs; // thinking time per move, 0 for no limit
+    long playouts; // playouts per thread before stopping early, 0 for no limit; with
+                   // neither limit a thread stops after one playout
+    uint64_t seed; // random streams are derived from this and the thread index
+} MctsOptions;
+
+typedef struct {
+    long playouts; // over all threads
+    int threads;
+    double value; // share of playouts the chosen move won, a label for the position
+} MctsStats;
+
+typedef struct {
+    int firstChild; // children are contiguous, -1 until expanded
+    int8_t childCount;
+    int8_t move; // color that led here
+    int8_t player; // player who played move
+    uint32_t visits;
+    double wins; // for player
+} MctsNode;
+
+typedef struct {
+    const Board *root;
+    int player;
+    MctsOptions options;
+    Rng rng;
+    MctsNode *nodes;
+    int nodeCount;
+    long playouts;
+    uint32_t visits[COLOR_COUNT]; // root visit counts by color, the thread's result
+    double wins[COLOR_COUNT];
+} MctsWorker;
+
+
+/* SEARCH */
+static inline int mctsOtherPlayer(int player) {
+    return (player == PLAYER1) ? PLAYER2 : PLAYER1;
+}
+
+// colors a player may pick; the same for both players, since both territory colors are excluded
+static inline int mctsLegalMoves(const Board *board, int moves[COLOR_COUNT]) {
+    int count = 0;
+    for (int c = 0; c < COLOR_COUNT; c++) {
+        if (c != board->territoryColor[0] && c != board->territoryColor[1]) moves[count++] = c;
+    }
+    return count;
+}
+
+// play random colors until the winner is settled; 1 if player wins, 0.5 for a draw.
+// *length counts the moves played.
+static inline double mctsPlayout(MctsWorker *worker, Board *board, int toMove, int player, int *length) {
+    for (; *length < MCTS_MAX_PLAYOUT && !aiDecided(board); (*length)++) {
+        int moves[COLOR_COUNT], count = mctsLegalMoves(board, moves);
+        fill(board, toMove, moves[rngBelow(&worker->rng, count)]);
+        toMove = mctsOtherPlayer(toMove);
+    }
+    int me = player - 1, margin = board->score[me] - board->score[1 - me];
+    return (margin > 0) ? 1.0 : (margin < 0) ? 0.0 : 0.5;
+}
+
+// give a node one child per legal color; false once the tree is full
+static inline bool mctsExpand(MctsWorker *worker, int index, const Board *board, int toMove) {
+    int moves[COLOR_COUNT], count = mctsLegalMoves(board, moves);
+    if (worker->nodeCount + count > MCTS_MAX_NODES) return false;
+
+    MctsNode *node = &worker->nodes[index];
+    node->firstChild = worker->nodeCount;
+    node->childCount = (int8_t)count;
+    for (int k = 0; k < count; k++) {
+        MctsNode *child = &worker->nodes[worker->nodeCount++];
+        child->firstChild = -1;
+        child->childCount = 0;
+        child->move = (int8_t)moves[k];
+        child->player = (int8_t)toMove;
+        child->visits = 0;
+        child->wins = 0;
+    }
+    return true;
+}
+
+// child with the best UCT score; unvisited children go first
+static inline int mctsSelect(const MctsWorker *worker, const MctsNode *node) {
+    int best = node->firstChild;
+    double bestScore = -1, logVisits = log((double)node->visits + 1);
+    for (int k = 0; k < node->childCount; k++) {
+        const MctsNode *child = &worker->nodes[node->firstChild + k];
+        if (child->visits == 0) return node->firstChild + k;
+        double score = child->wins / child->visits + MCTS_EXPLORATION * sqrt(logVisits / child->visits);
+        if (score > bestScore) {
+            bestScore = score;
+            best = node->firstChild + k;
+        }
+    }
+    return best;
+}
+
+// one selection, expansion, playout and backup
+static inline void mctsIterate(MctsWorker *worker) {
+    int path[MCTS_MAX_PLAYOUT + 1], depth = 0, index = 0, toMove = worker->player;
+    Board board = *worker->root;
+    path[depth++] = 0;
+    while (worker->nodes[index].firstChild >= 0 && depth < MCTS_MAX_PLAYOUT && !aiDecided(&board)) {
+        index = mctsSelect(worker, &worker->nodes[index]);
+        fill(&board, toMove, worker->nodes[index].move);
+        toMove = mctsOtherPlayer(toMove);
+        path[depth++] = index;
+    }
+    if (worker->nodes[index].visits > 0 && depth < MCTS_MAX_PLAYOUT && !aiDecided(&board) && mctsExpand(worker, index, &board, toMove)) {
+        index = worker->nodes[index].firstChild + rngBelow(&worker->rng, worker->nodes[index].childCount);
+        fill(&board, toMove, worker->nodes[index].move);
+        toMove = mctsOtherPlayer(toMove);
+        path[depth++] = index;
+    }
+
+    // a line that only delays the same result is worth slightly less to both players,
+    // otherwise a forced draw can be put off forever
+    int length = depth - 1;
+    double result = mctsPlayout(worker, &board, toMove, PLAYER1, &length); // from player 1's side
+    double penalty = MCTS_LENGTH_PENALTY * length;
+    for (int k = 0; k < depth; k++) {
+        MctsNode *node = &worker->nodes[path[k]];
+        node->visits++;
+        node->wins += ((node->player == PLAYER1) ? result : 1.0 - result) - penalty;
+    }
+    worker->playouts++;
+}
+
+static inline void *mctsWorkerMain(void *arg) {
+    MctsWorker *worker = arg;
+    uint32_t start = aiTicks(), budget = (uint32_t)worker->options.budgetMs * TICKS_PER_MS;
+    long playouts = (budget || worker->options.playouts) ? worker->options.playouts : 1;
+
+    MctsNode *root = &worker->nodes[0];
+    root->firstChild = -1;
+    root->childCount = 0;
+    root->move = -1;
+    root->player = (int8_t)mctsOtherPlayer(worker->player);
+    root->visits = 1;
+    root->wins = 0;
+    worker->nodeCount = 1;
+    mctsExpand(worker, 0, worker->root, worker->player);
+
+    while (!budget || aiTicks() - start < budget) {
+        if (playouts && worker->playouts >= playouts) break;
+        mctsIterate(worker);
+    }
+
+    for (int k = 0; k < root->childCount; k++) {
+        const MctsNode *child = &worker->nodes[root->firstChild + k];
+        worker->visits[(int)child->move] = child->visits;
+        worker->wins[(int)child->move] = child->wins;
+    }
+    return NULL;
+}
+
+// once the winner is settled every playout agrees, so just take the most cells
+static inline int mctsGreedyMove(const Board *board, int player) {
+    int gains[COLOR_COUNT], legal = moveGains(board, player, gains), best = -1;
+    for (int c = 0; c < COLOR_COUNT; c++) {
+        if (((legal >> c) & 1) && (best < 0 || gains[c] > gains[best])) best = c;
+    }
+    return best;
+}
+
+// pick a color for the player; always returns a legal color. stats may be NULL.
+static inline int mctsChooseMove(const Board *board, int player, const MctsOptions *options, MctsStats *stats) {
+    if (aiDecided(board)) {
+        if (stats) {
+            int me = player - 1, margin = board->score[me] - board->score[1 - me];
+            stats->playouts = 0;
+            stats->threads = 0;
+            stats->value = (margin > 0) ? 1.0 : (margin < 0) ? 0.0 : 0.5;
+        }
+        return mctsGreedyMove(board, player);
+    }
+
+    int threads = options->threads;
+    if (threads <= 0) threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (threads <= 0) threads = 1;
+
+    MctsWorker *workers = calloc(threads, sizeof(MctsWorker));
+    pthread_t *ids = calloc(threads, sizeof(pthread_t));
+    int started = 0;
+    for (int t = 0; workers && ids && t < threads; t++) {
+        MctsWorker *worker = &workers[t];
+        worker->root = board;
+        worker->player = player;
+        worker->options = *options;
+        worker->rng = newRng(splitSeed(options->seed, (uint64_t)t));
+        worker->nodes = malloc(sizeof(MctsNode) * MCTS_MAX_NODES);
+        if (!worker->nodes) break;
+        if (pthread_create(&ids[t], NULL, mctsWorkerMain, worker) != 0) {
+            free(worker->nodes);
+            break;
+        }
+        started++;
+    }
+
+    uint64_t visits[COLOR_COUNT] = {0};
+    double wins[COLOR_COUNT] = {0};
+    long playouts = 0;
+    for (int t = 0; t < started; t++) {
+        pthread_join(ids[t], NULL);
+        for (int c = 0; c < COLOR_COUNT; c++) {
+            visits[c] += workers[t].visits[c];
+            wins[c] += workers[t].wins[c];
+        }
+        playouts += workers[t].playouts;
+        free(workers[t].nodes);
+    }
+    free(workers);
+    free(ids);
+
+    int moves[COLOR_COUNT], count = mctsLegalMoves(board, moves), best = moves[0];
+    for (int k = 1; k < count; k++) {
+        if (visits[moves[k]] > visits[best]) best = moves[k];
+    }
+    if (stats) {
+        stats->playouts = playouts;
+        stats->threads = started;
+        stats->value = visits[best] ? wins[best] / visits[best] : 0.5;
+    }
+    return best;
+}
+
+#endif
@@ -1,243 +0,0 @@
-int Player2Win [240][320] = {
-	{2147,2115,4196,6277,4229,2147,2115,2115,2147,2147,2147,2147,2147,2147,2147,2147,2115,2115,4228,4228,4228,4228,4228,4228,4228,4228,4228,4196,4196,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4229,4228,4229,4229,4228,4228,6309,6309,8390,8390,8390,8390,8390,8391,8391,8358,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6278,6310,6310,8358,8358,8358,8391,8391,8358,8358,10406,10406,10406,10406,10406,10439,10406,10406,10406,10406,10406,10406,10406,8358,8358,8358,6310,6310,6310,6310,6310,6310,6278,6278,6278,6278,4196,2115,2114,2115,2115,2115,2114,2114,2082,2115,2115,4163,2115,2115,2115,4163,2115,2115,4163,4164,4163,4164,4164,8358,8358,8358,10406,10406,10406,10406,10406,10406,8358,10406,8358,8358,10406,10439,10406,22825,31083,41421,41453,41453,43534,41486,43501,43470,43470,39373,20744,6278,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6310,6278,6277,6277,6277,6277,6277,6277,6277,6277,6310,6310,6277,6277,6277,6278,6310,6277,6277,6277,6277,6277,6278,6277,6277,6277,6277,6277,6277,6277,4196,4164,4197,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6310,6310,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6278,6278,6277,6277,6278,6277,6277,6278,6310,6278,6310,6310,6310,6310,6310,6310,8358,8358,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310},
-	{2147,2115,4196,6277,6276,4228,4163,2115,2115,2115,2147,2147,2147,2147,2115,2147,2115,2147,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4196,4196,4228,4228,4228,4228,4228,4228,4228,4228,4229,4228,4229,4229,4229,4228,4228,4229,6277,6309,6310,8390,6310,6310,8390,8391,8358,8358,6310,8358,8358,8358,8358,8358,8358,8358,8358,8358,8358,8358,8358,8358,8358,10406,10406,10406,10439,12455,22825,29035,29035,29035,29034,29035,31115,31147,29067,29035,29035,29035,29035,29035,16615,8358,8358,8358,8358,8358,8358,8358,6310,6310,6310,6310,6277,4163,2082,2082,2082,2115,2115,34,2081,2082,2115,2115,4163,2115,2115,4163,4163,2115,4163,4163,4164,4163,4163,6212,10439,18696,29035,29035,29035,29035,29035,29035,29035,18696,10406,10406,10406,10406,10406,20809,39405,43501,43469,43469,43469,43502,43534,41454,43470,43470,41454,26986,6277,6309,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6278,6310,6278,6277,6277,6277,6277,6277,6277,6277,6277,6310,6310,6277,6277,6277,6310,6310,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,4229,4196,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6278,6277,6277,6277,6277,6277,6277,6277,6277,6278,6278,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6278,6278,6278,6278,6278,6310,6310,6310,6310,6310,6310,6310,6310,6310,8358,8390,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,8358,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310},
-	{2147,2147,4196,6309,4196,6276,4195,2115,2115,2115,2147,2115,2115,2147,2147,2147,2147,2147,4228,4228,4228,4228,4229,4229,4228,4228,4228,4228,4228,4228,4228,4229,4228,4228,4228,4228,4228,4229,4228,4229,4229,4229,4228,4229,4229,4229,4229,4229,6277,6309,6310,6342,6310,6310,8391,8391,6310,8358,8358,8358,8358,8358,8358,8358,8358,8358,8358,8358,8358,8358,10438,24938,31116,31115,33164,33228,39405,43502,43502,43502,43501,43501,43502,43534,43566,43502,43502,43502,43502,43502,33196,14567,10406,10439,8358,8358,8358,8358,8358,8358,8358,8358,6278,6277,2115,2082,2082,2083,2115,2114,2082,2083,4163,4163,4163,2115,2115,4163,4163,2115,4163,4164,4163,4164,4163,10373,31116,37324,41453,43502,43502,43502,43502,43502,43502,35244,18664,12487,12487,12455,10406,29035,43534,43502,43502,43501,43501,41453,29035,20777,18696,18696,18696,14535,8326,6278,6277,6278,6278,6278,6278,6278,6277,6278,6310,6278,6277,6278,6278,6278,6278,6278,6278,6278,6278,6278,6277,6277,6277,6278,6277,6310,6278,6278,6278,6278,6278,6278,6278,6278,6277,6278,6310,6310,6277,6277,6277,6310,6310,6277,6277,6277,6277,6277,6278,6310,6277,6277,6277,6277,6277,4196,6277,6277,6278,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6310,6310,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6278,6278,6278,6278,6278,6278,6278,6278,6278,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,8358,8391,8358,6310,6310,8358,6310,6310,6310,6310,6310,6310,6310,6310,6310,8358,8358,6310,6310,6310,8358,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310},
-	{4228,2147,4196,6277,4196,6276,4195,2147,4196,4196,2115,2147,4163,2147,2147,2147,2115,2147,4228,4228,4228,4228,4229,4228,4228,4228,4229,4228,4229,4229,4228,4229,4228,2148,2148,4228,4229,4228,4228,4228,4229,4228,4228,4229,4229,4229,4229,4229,4229,4229,6277,6309,4261,4261,6342,8423,8391,6310,8390,8390,8390,8390,8390,8390,8390,8358,8358,8358,8390,10407,10439,18696,37325,39406,41453,43534,43566,43534,43501,43501,43502,43502,43502,43501,43502,43502,43534,43501,43501,43501,41454,37324,35244,33228,24906,10439,8358,8358,8358,8358,8358,8358,8358,8358,2115,2114,2082,2115,2083,2115,2115,2115,4164,4163,4163,2115,2115,4163,4163,2115,4163,4164,4164,4164,4163,12454,39406,29067,20777,33228,41453,43501,43502,43502,43502,43502,37324,35244,35244,29002,22825,39373,41454,39405,39405,39405,39405,29067,10438,8358,8358,8358,6278,6310,8358,6310,6310,6278,6278,6278,6277,6277,6277,6278,6310,8358,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6277,6277,6278,6278,6278,6278,6310,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6310,6310,6277,6278,6278,6277,6277,6310,6310,6278,6278,6277,6277,4196,6277,6277,6277,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6310,6310,6278,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,8358,8358,6310,6310,6310,6310,6310,6310,6310,8390,8391,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310},
-	{4196,4228,4196,6277,4196,6276,4195,2147,4196,6277,4196,4228,4196,2115,2147,2147,2115,2147,4228,4228,4228,4228,4229,4228,4228,4228,4229,4229,4229,4228,4228,4228,4228,4196,2116,4228,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4261,4229,4261,4261,4261,6310,6342,8423,6342,6342,8391,10439,10439,8391,10439,10439,10439,10439,10439,10439,10439,10439,10439,16616,16616,24906,41453,43534,43566,43534,43501,43502,43502,43502,43501,43501,43534,41518,41453,43501,43502,41453,39373,39405,39405,35277,22858,14567,14535,14535,14535,12487,8358,10439,12487,4163,2115,2115,2115,2083,2083,2115,2115,4164,4163,4163,2115,2115,4163,4195,2115,4163,4164,4164,4164,4163,10373,26986,10373,8326,14535,35244,43502,43502,43502,43502,43534,43534,43534,43534,41453,39405,43534,29003,18696,16648,16616,16616,12487,8358,8358,8359,8391,8358,6310,6310,6310,6310,6310,6310,6278,6278,6278,6278,6278,6278,6310,8358,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6310,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6310,6278,6278,6278,6278,6277,6278,8358,6310,6277,6277,4196,4164,4164,4197,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6310,8358,6310,6278,6278,6278,6278,6278,6277,6278,8358,6278,6277,6278,6278,6278,6278,6278,6278,6278,6278,6278,6277,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,8358,6310,6310,6310,6310,6310,8358,8391,8358,6310,6310,6310,6310,6310,6310,8358,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310},
-	{2147,4228,6309,8357,4196,6277,4195,2147,4196,6309,6244,6276,4196,2147,4196,2147,2115,2147,4228,4229,4228,4228,4228,4228,4228,4228,4229,4228,4228,4228,4228,4228,4229,4228,4228,4229,4229,4229,6309,6309,6277,6277,4229,4229,4229,4229,4229,4229,4229,4229,4229,4261,6309,4261,6309,6342,6342,6375,6374,8391,10439,10439,10439,10439,10439,10439,10439,12519,16616,16648,16616,12487,10439,10439,12487,29035,43534,43534,43566,43502,43502,43502,43502,43502,43502,43534,35244,24905,41486,43502,29003,20745,20745,20745,18696,24906,33196,31180,31148,31148,24938,10406,22858,31148,8324,2115,2115,2115,2083,2115,2115,4196,4196,4196,4195,2115,2115,4196,4195,2115,4163,4163,4163,4164,4164,4164,6244,4163,2116,6244,33196,43534,43534,43534,43534,43534,43534,43534,43534,43534,43502,43534,35277,16616,10438,10439,8391,8391,8391,8390,8358,8391,8391,8358,8358,8358,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,8358,8358,6278,6278,6310,6310,6310,6310,6278,6278,6278,6278,6278,6278,6278,6310,6310,6310,6310,8390,6310,6310,6310,6310,6310,6278,6278,6278,6310,6310,6310,6310,6278,6278,6278,6310,6310,6278,6277,6277,6277,6277,6276,4164,4164,4163,4164,4164,6277,6310,6310,6310,6310,6310,6310,6310,6278,6278,6278,6310,6310,6310,8390,6310,6278,6277,6278,6278,6278,6278,6310,8390,6310,6278,6277,6277,6277,6277,6277,6277,6277,6277,6277,6278,6278,6278,6278,6278,6278,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,8358,8358,8358,6310,6310,6310,8358,8358,8391,8391,8390,8358,6310,6310,6310,6310,8358,6310,8390,8358,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310},
-	{2147,2147,6277,8390,4228,6276,4195,2147,4196,8357,6309,6309,4196,4196,6277,4196,4195,2147,4228,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,6309,6309,4229,6277,8358,8358,6277,6277,4229,4229,4229,4229,4261,4229,4229,4229,6309,6309,4261,6309,4261,4262,4294,6374,6374,8423,14600,18729,18729,18729,18729,18729,26986,39437,39437,37357,22826,12487,10439,14568,31115,43534,43534,43534,43534,43534,43534,43534,43534,41453,37324,31115,16648,35309,35276,33196,31148,33196,33196,22858,12487,16616,16648,14600,14568,12519,10439,12519,12519,4164,2115,2115,2115,2083,2115,2115,4196,4228,4196,4196,2115,2115,4196,4196,2115,4163,4163,4164,4196,4196,2116,2083,2115,2115,6212,33228,43566,43534,43534,43534,43534,43534,43534,43534,43534,43534,41486,24938,12487,10439,10439,10439,10439,8391,8391,8390,8358,8391,8391,8358,8358,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,8358,8391,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6278,4164,4164,4164,4197,6277,4196,4164,4164,4164,4164,4164,6277,6310,6310,6310,6310,6310,6310,6310,6310,6278,6310,6310,6310,6310,8390,6310,6278,6310,6310,6278,6278,6310,6310,8358,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6278,6310,6278,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,8358,8358,8358,8358,8358,8358,8390,8390,8390,8358,8358,8358,8358,8358,8391,8423,8391,8390,8358,8358,8358,8358,8390,8391,8390,6310,8358,8358,8358,8358,8358,8358,8358,8358,8358,6310,8358,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310},
-	{2147,4163,6244,8390,6276,6276,4196,2147,4196,8357,8358,8358,4196,4196,8357,8357,4228,2147,4196,6309,8358,6309,6277,4229,4229,4261,4261,4261,4229,4229,4229,4229,4229,4229,4229,6277,6309,4229,6309,8358,8358,8358,8358,6309,6277,4229,4261,4229,4229,4261,4261,6277,6277,6309,6309,6309,4262,6310,6342,6375,6342,14632,35341,41518,41518,41518,41518,41486,43534,43566,43566,39437,24906,20777,29067,41486,43534,43534,43534,43534,43534,43534,43534,43534,39405,26986,29067,6245,8358,10439,8390,10439,12487,14568,12487,10471,10504,12520,12552,12520,10439,10439,10439,10439,4196,2115,2115,2115,2115,2115,2115,2115,4196,6276,4196,2116,2116,4196,4196,2116,4163,4164,4196,4196,4196,4196,2115,2115,2116,6244,33196,43566,43566,43566,43566,43566,43566,43566,43566,43566,43566,41518,22858,10439,10471,10439,10439,8391,8391,8391,8391,8390,8358,8391,8391,8358,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,8391,8390,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,8390,8391,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,4196,4164,4164,4164,4164,4196,4196,4164,4164,4164,4164,4196,6310,6310,6310,6310,6310,6310,6310,6278,4197,6310,6310,6310,6310,6310,8391,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,8358,8358,8358,8358,8358,8358,8358,8358,8358,8390,8390,8390,8359,8359,8359,8359,8391,8358,8390,8391,8423,8391,8391,8391,8358,8358,8390,6277,6277,8390,8358,8358,8358,8390,8358,8358,8358,8390,8358,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310},
-	{2147,2147,4196,6277,4228,6277,4196,2147,6277,8358,8358,6310,4196,4196,8357,8358,6276,2147,6309,8358,8358,8358,8358,6309,6309,4261,4261,4261,4229,4229,4229,4261,4261,4261,4229,6277,6277,4229,8358,8358,8358,8358,8358,8358,6277,6277,4229,4229,4229,4261,4261,6309,6309,6309,6309,6309,4261,6342,4261,4294,6407,6374,18761,37390,33261,31180,41518,43566,43566,43566,43566,43566,41518,41518,41486,43534,43534,43566,43566,43566,43534,37325,37357,43534,43534,41518,31148,4197,4197,4229,4229,4197,4197,12519,22857,22954,25035,22890,22858,24939,22858,22858,22858,22858,18761,6244,2115,4163,2115,2115,2115,2115,4196,4196,4196,2116,2116,4196,4196,2116,4163,4164,4196,4196,4196,4196,4196,4196,2116,4196,33228,43566,43566,43566,43566,43566,43566,43566,43566,43566,43566,43566,22858,10471,10471,10439,10439,8391,8391,8391,8391,8390,8390,8390,8391,8423,8358,6310,6310,6310,6310,8358,8358,6310,6310,6310,6310,6310,6310,8391,8391,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6310,6277,6277,6309,6310,6310,6310,4196,4164,4164,4164,4164,4164,4196,4196,4164,4196,4164,4164,6310,8358,8358,8358,6310,6310,6310,6310,6277,6310,6310,6310,6310,6310,8358,8391,8358,6310,6310,6310,6310,6310,6310,8391,8391,6310,6310,6310,6310,6310,6310,6310,6310,8391,8358,6310,8358,8358,8358,8358,8358,8358,8358,8358,8358,8358,8358,8358,8358,8358,8390,8390,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8423,8423,8391,8391,8391,8391,8390,4229,4196,8391,8391,8391,8391,8358,8391,8390,8358,8390,8390,8358,8358,8358,8358,8358,8358,8358,8358,8359,8359,8359,8358,8358,8358,8358},
-	{2147,2147,2115,6276,4228,6277,4196,4196,8357,8358,8358,8358,4196,6276,8358,8358,6276,4196,6309,8358,8358,8358,8358,8358,8358,6310,6309,4261,4229,4229,4229,4261,4261,4261,4228,6277,6309,4229,8390,10438,8358,8358,8358,8358,8358,6309,6309,6309,6309,6309,4261,6309,6309,6309,6309,6309,4261,6309,6309,4294,6374,6375,6342,18761,12552,8423,29099,43566,43598,43566,43566,43566,43566,43566,43566,43566,43566,43566,43566,43566,43566,33228,33228,43566,43566,43566,31148,4229,2149,2149,4229,4261,2149,16616,41518,41518,43566,41518,41518,41518,41518,41550,41518,43566,37357,10373,2115,2147,2147,4195,2115,2115,4196,4196,4196,2116,2116,4196,4196,2116,4164,4196,4164,4196,4196,4196,4195,4163,4164,6244,33228,43599,43566,43566,43566,43566,43598,43598,43598,43598,43599,35309,18729,10472,10472,10471,10439,10439,8391,8391,8391,8391,8391,8390,8390,8391,8423,8390,8358,8358,8358,8358,8358,8358,8358,8358,8358,8358,8358,8390,8391,8390,8358,8358,8358,8358,8358,8359,8358,8358,8358,8358,8359,8358,8358,8358,8358,8358,8359,8358,8358,8358,8358,8358,8358,8391,8358,6310,6277,6277,6277,8358,8391,6310,4196,4164,4164,4196,4164,4164,4196,6276,4196,4164,4164,4196,6310,8391,8390,8359,8358,8358,8358,6310,6309,8359,8358,8358,8358,8358,8358,8391,8391,6310,6310,6310,6310,6310,6310,6310,8391,8391,8358,6310,6310,6310,6310,6310,8358,8358,8391,8391,8358,8359,8359,8359,8391,8390,8391,8391,8391,8391,8391,8391,8390,8390,8390,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8423,8423,8391,8391,8391,8390,6277,4196,6310,8391,8423,8391,8391,8391,8391,8391,8391,8390,8390,8391,8391,8390,8390,8390,8390,8390,6278,6277,6277,6309,6310,6310,8390},
-	{2147,2147,2147,4228,4228,6277,4196,4228,8357,8358,8358,8358,4228,8357,8358,8358,6276,4196,6309,8358,8358,8358,8358,8358,8358,8358,8358,6309,6309,6309,4261,4261,4261,6309,4229,6309,6309,4261,8357,10438,8390,8358,8358,8358,8358,8358,8358,8358,8358,8358,6310,6309,6309,4261,6309,6309,6309,6309,6309,4294,4326,4326,6374,4326,6374,4326,10471,22922,33260,43599,43599,43566,43566,43566,43566,43598,43566,43566,43566,43566,43566,43566,43566,43566,43566,43599,33228,4229,2149,2149,2181,4261,4229,16648,41518,43566,43566,43566,43566,43566,43598,43631,43599,43566,37389,8325,2115,2147,4195,4195,4163,2115,4196,4196,4196,4196,2115,2115,2115,2116,4163,4196,4196,4196,4196,2115,2115,2115,4195,6244,33260,43599,43599,43599,43631,43599,43599,41550,31180,29100,29132,20874,12552,12552,10472,10471,10503,10568,8455,8391,8391,8391,8391,8391,8391,8391,8423,8423,8391,8391,8390,8390,8391,8391,8391,8391,8391,8391,8391,8390,8390,8390,8390,8391,8359,8359,8359,8391,8391,8391,8391,8391,8391,8391,8391,8391,8390,8390,8391,8391,8391,8391,8391,8391,8391,8390,6310,6277,6277,6277,8324,10340,10373,8358,6277,6277,4197,4196,4196,4196,4196,4196,6277,4196,4196,4196,6310,6278,6310,8391,8391,8391,8391,6310,4197,6310,8391,8390,8390,8390,8390,8390,8358,8358,8358,8358,8390,8390,8390,8390,8358,8391,8423,8391,8358,8358,8358,8390,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,10439,10439,10439,8423,8423,8423,8423,8423,8391,8391,8391,8391,8391,8391,8423,8423,8391,8391,8391,6277,4196,6310,8391,8423,8423,8391,8391,8391,8391,8391,8391,8391,8423,8391,8391,8391,6310,6277,6277,4196,4196,4196,4196,4196,4196,6277},
-	{2147,2147,4195,4196,4228,6277,4196,4195,6309,8358,8358,8358,4228,8358,8358,8390,6277,6277,8390,8390,8358,8358,8358,8390,8358,8358,8358,8358,8358,6309,4261,4228,4260,6309,4261,6309,6310,6309,6309,8358,10438,8390,8358,8358,8358,8358,8358,8358,8358,8358,8358,8358,6309,4261,6309,6309,6309,6309,6309,4294,6342,4326,6374,4326,4326,4327,6342,4294,12584,20874,35341,41551,43598,43598,43598,43598,43598,43598,43598,43598,43566,43566,43566,41518,26986,20809,14600,4229,4229,2181,2181,4229,4229,16648,43598,43566,43566,43566,43566,43566,43566,43599,43631,43599,37389,8357,2115,2147,4196,4196,4163,2115,4196,4196,4195,4195,4163,4163,4163,4163,4163,4196,6244,4196,4228,4196,4195,4195,4196,6244,33260,43631,43599,43631,43631,41615,31212,27019,16681,14664,16842,14794,14729,12681,12649,10600,10632,10696,10600,8455,8391,8391,8391,8391,8391,8391,8391,8423,8423,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8390,6309,6277,6309,8357,12484,16611,16612,10437,8390,8391,6309,4196,4196,4196,4196,4196,4196,6277,4197,4196,6310,4196,4197,6310,8391,8391,8391,6277,4197,6310,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8423,8423,8391,8391,8391,8391,8391,8391,8391,8391,10471,10471,10439,10439,10439,10439,10439,10439,10439,8391,8391,8391,8391,8391,8391,8391,8391,10471,10471,10471,10471,10471,10471,8424,10440,10471,10471,10471,10472,8424,10439,8423,8423,8423,8423,8391,8391,8423,8391,8391,8391,6277,4196,8390,8391,8423,8456,8423,8391,8391,8391,8391,8391,8391,8391,8391,8423,6277,4229,4196,4164,4196,4196,4196,4195,4196,4196,4228},
-	{2147,4195,4195,4195,4196,6277,4196,2147,4228,8358,8358,8358,4228,8358,8390,8390,8358,8390,8390,8390,8390,8390,8390,8390,8390,8390,8390,8390,8358,6310,4261,4228,4260,4261,4261,6309,6310,6309,8358,8358,8390,8390,8358,8358,8358,8358,8358,8358,8358,8358,8358,8358,8358,6309,6309,6309,6309,6309,6309,6342,6342,4326,4326,4326,4327,4327,4327,6375,4327,4326,14632,20874,37422,41550,41550,43599,43598,43598,43598,43598,43598,43599,43599,39470,12519,2149,4229,4229,4229,4229,2181,4229,2181,16648,43598,43598,43598,43598,43598,43598,43598,43598,43631,43663,37389,8325,2148,4196,4196,4195,4163,2115,4164,4196,4163,4163,4196,4195,4195,4196,4196,4196,6244,4196,4228,6276,6276,4196,4196,6244,33292,43631,43631,43631,43631,43663,35405,33293,33293,33325,33357,33357,33357,33325,31309,31277,23051,10696,10696,8552,8455,8423,8423,8423,8423,8423,8391,8391,8423,8423,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8423,8423,8391,8391,8391,8390,6309,6309,10372,16611,16643,14597,8389,8357,8422,10600,6374,4196,4196,4196,4196,4196,4196,6277,4197,4229,4196,4196,4197,6310,8391,8391,6310,6277,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8423,8423,8391,8391,8391,8391,8391,8391,8391,10471,10471,24971,29132,29132,29132,29132,29132,16713,10471,10471,10471,10471,10471,10471,10471,10471,10472,10472,10472,10472,10472,10472,12520,12520,12520,12520,22890,31180,14632,10471,10471,8423,8423,8423,8423,8391,8391,8391,8391,8391,6277,4196,6278,8391,8391,8423,10504,8423,8391,8391,8391,8391,8391,8391,8391,8391,4196,4196,4196,4196,6276,4196,4196,4196,4195,4228,6309},
-	{4195,2147,2147,2147,4195,6309,4196,2147,4228,8390,8358,8358,6276,8358,8390,8390,8390,8390,8390,8390,8390,8390,8390,8390,8390,8390,8390,8390,8390,8358,8358,4228,4260,4261,4261,6309,8390,6309,8358,8390,8358,8358,8358,8358,8358,8358,8358,8358,8358,8358,8358,8358,8358,8358,8358,8358,6309,6309,6309,6341,6342,4326,4326,6374,6375,6375,4327,4327,6375,4359,4326,6375,14664,16712,27051,41550,43598,43599,43599,43599,43599,43599,43599,41518,12519,4229,4229,2181,4229,4229,4229,4229,2181,16648,43599,43599,43599,43599,43599,43599,43599,43599,43599,39502,20776,6244,4196,4196,4196,4196,4195,4163,4164,4196,4163,4195,4195,4195,4195,4228,4196,4196,6276,4196,4196,6276,6276,6276,4196,6276,33292,43663,43663,43663,43663,43663,43695,43695,43695,43663,43663,43663,43663,39566,25131,21003,16874,10697,10697,10697,10633,10568,8455,8423,8423,8423,8423,8423,8423,10504,10504,8423,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8423,8423,8423,8488,8423,8391,8391,8391,8391,8423,8423,8456,8455,8423,8391,8391,8390,8389,10340,16643,16740,10501,8389,8357,8390,8520,6406,4196,4196,4196,4196,4196,4196,4197,4196,4196,4196,4196,4196,4197,6277,6277,6277,6277,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8391,8423,8423,8391,8391,8391,8423,8391,10471,10471,20874,22922,20809,20874,20906,20842,20810,14633,10472,10472,10472,10472,10472,10472,10472,10472,10472,10504,10504,10504,10504,14600,27084,31244,31213,31213,37422,41551,31213,12552,10472,10472,8423,8423,8423,8423,8423,8423,8423,8423,6277,4196,6277,8391,8391,8391,8423,10504,8423,8391,8391,8391,8391,8391,8391,8390,4229,6277,4228,4228,4196,4196,4196,4196,4195,4228,6308},
-	{4195,4195,2115,2115,4196,6309,4228,4196,4228,8390,8390,8390,8358,8390,8390,8390,8390,8390,10438,10438,10439,8391,8390,8390,10439,10438,8390,8390,8390,8390,8390,4228,4261,6309,6310,6310,8390,8358,8358,8358,8358,8358,8358,10471,10439,8358,8358,8358,8358,8358,8358,8358,8358,8390,8390,8390,8390,6310,6310,6342,6342,4326,4326,4326,4326,6375,6375,6375,6375,6374,6375,6375,4327,6374,8423,14632,29132,39502,43631,43631,43631,43631,43630,41550,12519,4229,4229,4229,4229,4229,4229,4229,4229,16680,41583,43599,43631,43631,43631,43631,43630,43630,39502,20776,4196,6277,4196,4164,4164,4164,4164,4195,4196,4196,4195,4195,4195,4195,4196,4228,4196,4196,6276,4196,4196,6276,6276,6276,4228,6276,33324,43695,43663,43663,41647,43663,43663,43695,43695,43695,43695,43663,41615,25164,14857,12777,10729,10729,10729,10697,10697,10697,10600,8456,8424,8423,8423,8423,8423,8424,8424,8423,8423,8423,8423,8423,8423,8423,8423,8424,8423,8391,8391,8391,8391,8423,8423,8423,8423,8423,8423,8423,8423,8552,8584,8455,8423,8423,8423,8423,8423,8423,8424,10504,10504,8423,8423,8456,10534,12387,12484,10534,8422,8390,8390,10372,10404,6309,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,6277,8391,8391,8423,8423,8423,8424,8424,8424,8424,8423,8423,8391,8423,8455,8423,8423,8391,8423,8423,8423,10504,8456,8423,8423,8423,8424,12520,14600,18761,16681,16713,16810,16809,14632,14601,14600,14600,12552,12520,12552,12552,12520,14600,16681,16681,14632,12552,12552,14600,16681,20842,22890,22890,22890,22890,22890,20842,14632,10504,10504,10472,10472,10472,8424,8424,8423,8423,8423,8358,6309,8357,8391,8423,8423,8423,8424,10504,8423,8423,8423,8423,8423,8423,8391,6277,6276,6309,6276,6276,6276,6276,6276,6276,6276,6308},
-	{4195,4195,2147,2147,4196,4228,4196,4196,4196,6309,8390,8390,8390,8390,8390,10438,10438,6277,8357,10438,10439,10439,10439,10439,10439,10439,10438,10438,10438,10438,8390,6276,4261,6310,8390,6342,8390,8390,8390,8390,8390,8358,8358,8390,10471,10439,8358,8358,8358,8358,8358,8358,8358,8390,8390,8390,8390,8390,8390,6342,6342,4294,6374,4326,6374,6407,6375,6375,6375,6375,6375,4359,6407,6407,6407,6406,8487,14632,33293,39470,37454,39502,43630,39534,12552,2213,4261,4261,4261,4261,4229,4261,4229,16680,41583,43631,43631,43631,43631,43631,43631,39534,20841,6276,2115,4228,6309,4196,4164,4164,4196,4196,4196,4196,4196,4195,4196,4196,4196,4228,4196,4196,6276,4196,4196,4196,4196,4196,4196,8324,33325,43695,43695,43695,43695,43695,43695,43695,43695,41647,39599,39599,37551,21035,12810,12810,12778,10729,10729,10729,10697,10697,10697,10568,8424,8424,8424,8423,8423,8424,8424,10504,10504,8423,8423,8423,8423,8424,8424,8424,8424,8424,8424,8424,8423,8423,8423,8423,8423,8423,8423,8423,8455,8584,8617,8552,8455,8456,8456,8424,8424,8424,8424,8424,10536,8488,8552,8585,10632,10631,10503,8390,8390,8390,8357,12355,10340,8358,6277,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4229,6277,4197,8391,8424,8424,8424,8424,8424,8424,8424,8424,8424,8520,12778,10633,8424,8424,8424,8423,8423,8423,8423,8423,8424,8424,10472,18762,33325,35373,37454,37454,37519,37486,37454,37422,37454,35374,16713,12552,14600,12552,16681,31212,37454,37454,31245,16681,16681,29164,37454,37454,37422,37454,37454,37454,37454,37454,33293,14600,10504,10504,10504,10472,10472,10472,10472,10472,10472,8390,8357,8357,8390,8423,8424,8424,8424,8424,10536,8456,8423,8423,8423,8391,8391,8390,6309,6309,6309,6309,6309,6309,6308,6308,6308,6308},
-	{4195,4195,4195,4195,4196,4196,4196,4196,4196,6277,8390,8390,8390,8390,10439,10439,10439,6277,4228,8390,10471,10439,10439,10439,10439,10439,10439,10439,10439,10439,10438,6277,6309,6342,8390,8390,8390,8390,8390,8390,8390,8390,8390,8390,8390,10471,8390,8358,8358,8358,8358,8358,8358,8358,10438,10439,8390,10438,10438,10438,8390,6342,6374,6374,6374,6375,6375,6375,6375,6407,6407,6407,6407,6407,6407,4359,6407,6407,10504,10503,10503,25002,43663,41582,12552,4261,4262,4262,4261,4262,4262,4261,4261,14600,37454,43663,43663,43631,43631,43631,43663,25002,6244,4196,4196,4196,4228,6309,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4228,4228,4196,4196,4228,4196,4196,4196,4196,4195,8357,16679,37486,43696,43695,43728,39599,37551,37551,37551,37551,33454,25228,21067,19019,16938,12842,12810,12810,12778,10729,10729,10729,10697,10729,8585,8456,8456,8456,8424,8424,8424,8424,10504,10536,10504,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8488,8617,8649,10665,10664,10665,10633,8488,8456,8488,8488,8488,8552,10665,10665,10664,8649,10665,8520,8422,8390,8390,10372,12388,8389,8390,8390,6277,4197,4196,4197,4197,4197,4197,4197,4197,4229,4197,4197,6309,4229,4197,4197,4197,6310,8423,8423,8424,8424,8424,8424,8424,8424,8424,8520,12810,10826,10794,8585,8456,10504,8456,8423,8424,8424,8424,10472,10472,10504,12649,16842,29228,41582,43663,43663,43695,43663,43663,43663,37454,18762,14633,14633,14633,29164,41615,43663,43663,41615,31245,31212,41615,41615,39534,37454,37454,37454,37454,37454,37454,33325,14633,12552,10504,10503,10471,10503,10504,10504,10504,10472,8390,8357,8357,8357,8390,10503,10503,8423,8423,10504,10568,8455,8390,8389,6341,6341,6309,6309,6309,8389,6341,6309,6309,6308,6308,6308,6308},
-	{4228,4195,4195,2147,4196,4196,4196,4196,4196,6277,8390,10438,8390,10439,10439,10439,8390,4229,2148,6277,8391,10439,10439,10439,10439,8390,10439,10439,10439,10439,10439,8390,6342,6342,8390,8390,8390,8390,8390,8390,8390,8390,8390,8390,8358,8390,8390,8390,8358,8390,8390,8358,8390,8390,10439,10471,8390,8390,8390,10438,10438,10439,8423,6374,4326,6375,6375,6407,6407,6407,6407,6407,6407,6407,6407,6407,6407,6439,6407,6407,4359,18825,33325,37486,12584,4261,4262,4262,4262,6342,6342,4262,4262,4262,16713,33325,39534,43663,43663,43663,43663,24970,4196,4229,4196,4196,4196,4228,6277,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4228,4228,4196,4196,4196,4196,2116,20873,35502,35502,37550,37550,37551,29325,25196,27277,23148,21100,21100,19084,19052,16971,14891,14890,14858,12810,12810,12810,10730,10729,10729,10729,10729,10601,8456,10504,10504,10504,8456,10504,8456,10504,10537,10504,8456,8456,8456,8456,8424,8456,8456,8456,8456,8456,8456,8456,8456,8456,8456,8424,8456,10601,10697,10697,10697,10697,10697,10697,10665,10665,10665,10665,10697,10697,10697,10697,10729,8649,8649,10697,8519,8422,8357,10372,10438,8389,8389,8390,8390,6277,4197,4197,4197,4197,4197,4229,4229,4229,4197,4229,8520,8455,4229,4229,4229,6277,6277,6277,8424,8456,10504,8456,8456,10536,10601,12810,12874,10794,10761,10697,10665,10665,10633,8488,8456,8456,8456,10536,10536,10600,12746,12746,16874,35437,43663,43663,43695,43695,43663,41615,24971,16681,16681,16682,16681,31244,43663,43663,43663,43663,41615,41615,43663,35406,20842,16713,18761,16713,16713,16713,16713,16713,12585,12584,10471,8389,8390,8390,10503,10472,10472,8423,8390,8357,8357,8389,8390,12614,12614,8390,8421,10534,10566,12645,8389,8389,6309,6309,6309,6309,6309,6308,6309,6309,4228,4228,4228,4228,4228},
-	{4260,4228,4196,2147,4195,4196,4228,4228,4228,6309,10439,10439,10439,10439,10439,10439,8357,4195,4228,8390,10471,10439,10439,10439,10471,8358,8391,10439,10439,10439,10439,10439,6342,8390,8390,8390,10439,10439,10439,10438,8390,8390,8390,8390,8390,8390,10438,10503,10438,8358,8358,8390,8390,8390,8390,8390,8390,8390,8390,10438,10439,10439,10439,8423,6375,6375,6407,6407,6407,6407,6407,6407,6407,6407,6407,6407,6407,6439,6439,6439,6439,6439,8488,20939,10536,4262,4262,4262,4262,4262,6375,6342,4262,4262,4262,6310,22922,39534,43663,43663,43695,25002,4228,4228,4228,4228,4196,4228,6309,6309,4228,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,6309,6309,4196,4196,4196,2148,2115,16777,29325,29325,29325,29325,29325,29325,35534,39663,25228,21100,19084,19051,19084,17003,16971,14891,14890,12842,12842,12810,12810,10762,12810,10730,10729,10633,8488,10504,10504,10504,10504,10504,10536,10504,10536,10569,10537,8456,8456,8456,8456,8456,8456,8456,8456,8456,8456,10504,8456,10504,8456,8456,10536,10665,10729,10697,10697,10697,10697,10697,10697,10697,10697,10697,10697,10697,10697,10729,12810,10730,10697,10697,10697,8520,8422,10438,8390,10405,10405,8422,8422,8390,6277,4197,4197,4229,4229,4229,4229,4229,4229,4229,4261,10665,6342,6277,4229,4229,6277,6277,8424,10504,10504,10536,10633,12810,12875,12842,10762,10729,10697,10697,10697,10697,10697,10697,10633,10568,10568,12713,12745,12745,12778,12778,14858,33390,43663,43663,43695,43695,43727,41647,22923,16713,16713,16713,20842,35374,43695,43695,43728,43695,43695,43695,43695,31244,25003,22955,16713,14665,14665,14665,14665,14633,14633,14633,12552,8390,8389,8390,8389,8390,8390,8390,8390,8389,8389,8389,8422,12646,12645,8422,10501,12709,12646,12677,8422,8389,6341,6341,6341,6309,6309,6309,6341,8422,6341,6308,6309,6341,6341},
-	{4196,4260,4228,2147,4195,4228,4228,4228,4228,6309,10439,10439,10439,10439,10439,10439,8357,4196,4228,8422,10471,10471,10471,10471,10471,10471,10471,10471,10471,10439,10439,10439,8390,10471,8390,8390,10439,10439,10439,10439,10438,10438,10438,10438,10438,8390,8390,10439,10503,10439,8390,8390,8390,8390,8390,8390,8390,10471,10439,10438,10439,10439,10439,10439,10471,10471,6375,6375,6407,6407,6407,6407,6407,6407,6407,6439,6439,6439,6439,6439,6439,6439,6439,6439,6439,6374,4326,4294,4262,4262,4294,6375,6374,4262,4261,4261,6342,33325,43695,43663,43695,25002,4228,4228,4228,4229,4261,6342,4261,6342,6341,4261,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4228,4228,2148,8389,31308,41712,41712,41712,41712,41712,41744,43792,41712,25228,21132,21132,19084,19051,17003,17004,16971,14923,14891,12842,12842,12810,12810,12843,12810,10762,10730,10601,10504,8456,10537,10537,10537,10537,10537,10537,10537,12617,10537,8456,8456,8456,8456,10504,8456,8456,10504,8456,8456,8456,10504,10504,8456,10633,10729,10729,10697,10729,10729,10729,10729,10729,10729,10729,10729,10729,10729,10729,10729,10730,12842,12810,10729,10729,10697,8520,8422,8391,8422,8422,8422,8422,8422,8390,6277,4229,4229,4229,4229,4229,4229,4229,4229,4261,10600,6342,6277,4229,6277,6277,6277,10568,10601,10601,10697,12842,12842,12842,10730,10729,10729,10729,10729,10729,10729,10729,10729,10730,10698,12746,12778,12778,12778,12778,14858,14858,27213,33390,33390,33389,37518,43728,41679,25003,25035,27116,27083,33325,43695,43695,43695,43695,43695,43695,43695,37486,31277,31277,29165,16714,16713,16713,16713,16714,16714,16681,16713,14632,10470,8390,8422,10534,8422,10502,10501,8389,8390,8389,8389,8422,12645,12645,8422,8454,12645,12646,12678,8421,8389,6341,6341,6341,6341,6341,6341,6341,6341,8422,6373,6341,6341,8422},
-	{2147,4228,4228,2147,4195,4228,4228,4227,4228,6309,10439,10439,10471,10439,10439,8391,6277,4228,4228,8358,10471,10471,10471,10471,10471,10471,10471,10471,10471,10471,10471,10471,8422,10439,8390,8390,10439,10439,10439,10439,10439,10439,10438,10439,10438,8390,8390,8390,10471,10503,10439,8390,8390,8390,8390,8390,8390,10471,10503,10439,10439,10439,10439,10439,10471,10439,10439,10471,6407,4359,6407,6407,6407,6439,6407,6407,6439,6439,6439,6439,6439,6439,6439,6439,6439,6439,6439,6407,4294,4262,4262,4294,6375,4294,4294,4261,4262,20906,39567,43695,43695,27147,10535,10535,8455,4261,4261,6309,4228,4228,6341,6342,4228,4196,4196,4196,4196,4196,4196,4196,4196,4261,6277,4228,4228,4228,2115,20873,37583,33454,33486,33486,33486,33486,33486,33486,31438,23180,21132,21132,21132,19084,19084,19084,19084,16971,14923,14923,12843,12842,12810,12810,12810,10762,10762,10665,10569,10601,10569,10537,12617,12617,12617,12617,10537,10537,12617,10537,8456,10504,10504,10504,10504,10504,10504,10504,10504,10504,10504,10504,8521,10665,10729,10729,10729,10729,10729,10729,10729,10729,10729,10729,10729,10729,10729,10729,10729,10729,12810,12810,10729,10729,10730,10697,8520,8422,8422,8454,12679,10535,8423,8422,8390,6277,4229,4229,4229,4229,4229,4229,4229,4261,8455,6309,6277,6277,6277,6277,8455,10697,12778,10729,12778,10730,12778,12778,12778,12778,10730,10730,10730,10730,12778,12810,12778,12778,10730,12778,12778,12778,12810,14858,14858,14858,16906,16907,16939,18987,29293,43695,41680,33357,39567,43695,43696,43695,43695,43695,43695,43695,43695,43728,35437,18792,25003,27116,18794,20875,29165,29165,29165,29165,29165,29197,22955,10471,8390,8390,8422,10534,10470,14663,12615,8422,8390,8389,8389,8422,10533,10534,8422,8390,8422,10534,10565,8421,8389,6341,6309,6309,6309,6309,4260,4260,4260,4260,6341,6341,4260,6342},
-	{2148,2147,2147,4228,4228,4228,4196,2147,4228,6309,10439,10471,10471,12520,10471,8358,4196,4196,4196,4196,6277,8358,10471,10471,10471,10471,12519,10471,10471,10471,10471,10471,10471,10471,10471,10439,10471,10471,10439,10439,10439,10439,10439,10439,10439,10471,10439,10438,8390,10471,10503,10439,8390,8390,8390,8390,8390,10438,10471,10503,10438,10438,10439,10439,10439,10471,10471,10471,8423,6407,4359,6407,6407,6439,6439,6439,6439,6439,6439,6439,6439,6439,6439,6439,6439,6440,6440,6440,6407,6407,4294,4262,4294,6342,6343,4294,4262,8423,35438,43695,43727,29228,10568,8455,8455,4229,6309,6309,4228,4228,4228,8422,6374,4228,4196,4196,4196,4196,4196,4196,4196,4261,6309,4228,4228,4228,2148,16744,33486,33486,33486,33486,33486,33486,33486,33486,33486,33486,31438,23213,21164,21132,21132,19084,19084,19084,14923,14923,12875,12843,12843,12842,12842,12842,12843,12810,10698,12746,10698,12714,12650,23181,18988,12650,12617,10537,10537,12617,10537,10504,10536,10504,10504,10505,10505,10505,10505,10504,10537,10601,10666,10730,10730,10730,10729,10729,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,12810,10762,10730,10730,10729,8520,8422,10502,14760,10535,8422,8422,8422,8390,6309,4229,4229,4229,4229,4229,4229,4229,4229,4229,6277,6277,6277,6309,10633,12810,12810,12810,12810,12810,12810,12810,12810,12810,12778,12778,12778,12778,12810,14891,14891,12810,12810,12810,12810,12810,14858,14858,14891,16939,16939,16939,16939,16939,23116,37550,41680,41680,43727,43695,43695,43727,43727,43695,43695,43695,43695,43760,27147,10470,33357,31245,16746,27084,41680,43728,43727,43728,43728,37518,18793,8389,8421,8390,10470,25034,29164,29229,29229,27116,25035,14600,10503,8423,8422,8487,8487,8487,8422,8421,8421,8390,6309,4229,4196,4196,4228,4228,4228,4228,4228,4196,4261,8422,8422,8423},
-	{2148,2148,2147,4228,6309,4228,4196,4195,4228,6309,10471,10471,10471,10471,10471,8389,4195,4195,4196,4195,2115,6276,8390,6277,6277,10439,12520,10471,12519,12519,12519,12519,12519,10471,10471,10471,10471,10471,10439,10439,10439,10439,10439,10439,10439,10471,10439,10439,10438,8390,10471,12552,10439,8390,10438,8390,8390,10438,10439,10471,10438,10438,10439,10439,10439,10471,10471,10471,10471,8455,6407,6407,6407,6439,6439,6439,6439,6439,6439,6439,6439,6439,6439,6439,6439,6439,6439,6439,6440,6472,6407,6407,4294,4294,6407,6343,4262,8423,37486,43727,43727,35470,14600,4196,4196,4229,4261,6309,4229,4229,4228,4293,6341,4228,4228,4196,4196,4196,4196,4196,4196,4196,4228,6276,4196,4196,4196,16744,39695,43824,43824,43824,43824,43824,43824,43824,43824,43824,41776,35567,35567,35567,33519,33518,33518,31470,19084,17003,14955,14923,14923,12843,12842,12875,14955,12843,12810,12842,12874,14955,16971,31697,25294,14762,12649,10569,10537,10537,10537,10537,10537,10537,10537,10537,10537,10537,10537,10633,10697,10730,10730,10730,10730,10730,10730,10730,10730,10730,10762,10730,10730,10730,10730,10762,10730,10730,10730,10762,10730,10730,10633,10730,12810,10762,10762,10730,10568,10503,8454,10535,14793,10503,10470,8422,8422,6309,4229,4229,4229,4229,4229,4229,4229,4229,4229,6309,6309,8326,23019,16939,12810,12810,14858,14858,14858,14858,14858,14858,14858,14858,14858,14858,14858,14859,14923,14891,14858,14859,14858,16906,16907,16939,16939,18987,18987,18988,18988,18988,18987,23148,29293,39599,43728,43728,43727,43727,43728,43727,43727,43728,43727,43728,25067,10535,16777,18794,18794,20907,22987,20841,20841,18793,20841,16712,8390,8422,8389,10470,27115,41680,43728,43728,43728,43728,43695,29197,14665,8424,8423,10600,10633,10568,6309,6309,6309,6309,4229,4228,4228,4228,4228,4228,4228,4228,4229,8390,8423,10504,10536,10504},
-	{2147,2148,2148,2147,4228,6309,4196,4195,4228,6309,10471,10471,10471,8390,6277,6277,4195,4195,4195,2115,2147,4196,4228,2115,4164,10438,12519,12519,12519,12519,12519,12519,12519,12519,10471,10471,10471,10471,10471,10471,10471,10439,10439,10439,10439,10439,10439,10439,10439,10439,10439,10471,12551,10439,10438,10438,10439,10439,10439,10438,10471,12551,10439,10439,10439,10471,10471,10471,10471,8455,8520,6439,6407,6439,6439,6439,6439,6439,6439,6439,6472,8552,6439,6439,6439,6439,6440,6440,6440,6440,6472,6440,6407,4326,14697,16810,6343,22987,41647,43728,43727,43728,20841,2148,4228,4229,4229,4228,4228,4228,4196,4228,4228,4228,4228,4228,4196,4196,4196,4196,4196,4228,4228,6277,4196,4196,2148,20873,43824,43824,43824,43824,43824,43824,43824,43824,43824,43824,43824,43824,43824,43824,43824,43824,41776,35599,21165,19084,17003,14955,14923,14923,12843,12843,12875,14987,17067,17099,19212,21292,23405,33873,27471,16874,12713,10601,10537,10537,10537,10537,10537,8488,10601,10666,10665,10697,10697,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,8487,10632,14923,12810,10762,10762,8552,8390,10470,10535,12680,12615,10502,10470,8454,8422,6277,4229,4229,4229,4229,4229,4229,4229,4229,6309,6309,6310,29261,21068,14891,14891,14891,14891,14891,14891,14891,14891,14891,14891,14859,14891,14891,14891,14891,16972,16971,14891,18987,29326,33454,33454,33454,33454,33454,33454,33454,33454,33454,33454,33454,39631,41680,41711,41711,41679,43727,43727,43728,43728,43728,35470,16745,10597,10534,10535,12551,12551,8390,4228,4229,4229,4229,4261,8422,8422,8390,12518,37486,43728,43728,43728,43727,43727,41647,25036,14665,12585,10504,10568,8455,8423,4229,4229,4229,4229,4229,4229,4228,2180,4228,4197,4228,8390,8423,10504,10505,10505,10504,12585},
-	{2148,2147,2147,2148,4196,4228,6308,4196,4228,4228,8358,10471,10438,6244,4196,4196,4195,4195,4195,4195,4195,4195,4196,2147,4196,10438,12519,12519,12519,12520,12520,12519,12520,12520,12519,12519,12519,12519,10471,10471,10471,10471,10471,10439,10439,10471,10439,10471,12552,10439,10439,10439,10471,12552,10439,10439,10439,10439,10439,10439,10471,12551,12551,10439,10471,10471,10471,10471,10471,8423,8455,10503,8455,6407,6439,6439,6439,6439,6439,6439,6471,6472,6439,6439,6439,6439,6440,6472,6472,6472,6472,6472,6440,6439,10568,10568,4294,14664,37518,43727,43727,43728,20841,2148,4229,4229,4229,4228,4228,4228,4196,4228,4228,4228,4228,4196,4196,4196,4196,4261,6341,4228,4228,6277,4228,4196,4196,20905,43825,43824,43824,43824,43824,43856,43856,43856,43857,43856,43856,43856,43856,43856,43824,41776,29390,25261,21132,21165,19084,17004,14956,14955,14923,14923,17067,19212,19244,21324,23436,25517,27597,31759,33841,23373,17067,12810,10698,10698,10698,10698,10698,10698,10730,10762,10794,14954,15018,15018,15018,15018,15018,15019,15019,15019,14987,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,8519,8584,12843,14923,12778,8584,6341,6309,8422,10503,8454,12712,14857,8455,10502,10503,8422,6309,4229,4229,4229,4229,4229,6309,4261,6309,6277,8390,29261,21068,14891,14891,14891,16939,16939,16939,14891,14891,16939,16939,14891,16939,16939,16939,16939,16939,16971,16939,16939,23116,25196,25197,25197,27245,27245,27245,27245,27245,27245,27245,27245,27245,27245,27212,27148,29196,35438,43760,43728,41679,37518,22987,12616,8485,8454,8454,8422,8422,6341,6309,8358,8358,8358,8390,10471,10502,8422,10470,37518,43728,43728,41679,41647,39599,27116,16746,14666,14666,12585,12584,6310,6309,6342,4229,4229,4229,4229,4228,4228,2180,4228,8390,12584,14633,14665,14633,12585,12585,12553,12585},
-	{2148,2148,2148,4196,4196,4196,4228,6309,4228,2147,4196,8390,6276,4163,4163,4163,4228,4196,4163,4196,4195,4163,4164,4163,4195,6276,8390,6276,8357,12520,12520,12519,12520,12520,12520,12519,12519,12519,12519,12519,12519,10471,10471,10471,10471,10471,10439,10471,12552,12552,10439,10439,10439,10471,10439,10439,10439,10439,10439,10439,10439,10471,12552,12551,10471,10471,10471,10439,8423,8423,10471,10471,12584,8455,6407,4391,6439,6439,6439,6439,6439,6439,6439,6471,6439,6439,6439,6439,6471,6472,6472,6472,6472,6472,6440,6439,6439,6374,20874,41679,43760,43760,22922,4229,4229,4229,4229,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4261,6342,4196,4196,4228,2148,4195,4196,20938,43857,43824,43824,43857,43856,41776,37647,39696,39696,43856,43856,43856,43856,43856,43856,41776,27341,23213,21165,21132,21197,19116,17036,19116,21260,21260,21292,21324,23372,25485,25517,27630,33873,40115,31760,23405,19243,17099,15019,12874,10762,10762,12874,15019,15018,15018,15018,17098,17131,17131,17131,17131,17099,17099,17099,17099,17099,15018,12906,10794,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10730,12810,6472,8584,14858,25197,10568,6342,4229,4229,4261,8422,8455,10535,12648,10535,8455,10503,10503,8422,6309,4229,4261,4261,4261,6309,4261,4261,6309,10600,18987,19019,18988,19020,19019,21035,21036,21036,21036,18988,21068,21068,21036,21068,16907,16907,16907,21036,21068,23181,21100,21068,21068,21068,29325,37583,37583,37583,37583,37583,37583,37583,27277,23116,35503,37583,37551,37583,41712,43760,41679,29164,25036,20907,16745,12583,12583,12583,14696,12616,12680,25099,35470,35470,35470,35470,35470,35470,20905,12551,35470,41679,35438,22987,22955,22955,18794,16714,16714,14666,14633,12584,6310,4229,6309,6342,4229,4229,4229,4228,4228,4228,2180,16745,33421,33389,33358,33358,27117,12585,12585,12553},
-	{4196,4196,4196,4196,4196,4196,4196,4228,6309,4196,2148,4196,4163,4163,4195,4163,4195,4195,4195,4195,4163,4163,4163,4163,4163,4195,4196,4163,6277,12519,12520,12520,12520,12520,12520,12520,12520,12520,12519,12519,12519,12519,10471,10471,10471,10471,10471,10471,10471,12552,12519,10439,10439,10439,10439,10439,10439,10439,10439,10471,10471,10471,10471,12584,12551,10471,10471,10471,8423,8423,10471,10471,10471,10471,8487,4391,6439,6439,6439,6439,6439,6439,6439,8552,6472,6439,6439,6439,6471,6471,6472,6472,6472,6440,6472,6472,6472,6439,14665,35470,41647,43760,33422,10503,2180,2181,4229,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4261,6309,4261,4196,4228,2148,2148,4228,18825,39696,43856,43856,43856,41776,27212,12551,12551,14632,33454,43857,43856,43856,43856,43856,43857,37680,29390,25293,25261,27405,29550,27469,25453,25485,25485,23405,23405,23436,27565,33841,40115,40115,35889,25485,21324,19211,19179,17099,17099,14954,14987,17099,17130,17131,17099,17131,17131,17131,17131,17131,17131,17131,17131,17131,17131,17131,17130,17099,17099,12906,10762,10762,10762,10762,10762,10762,10762,10762,10697,6471,12842,8519,10664,12842,10503,6342,6342,4261,4229,4229,6309,8422,8455,10503,10503,10503,10503,10503,10503,8390,4229,4261,4261,4261,6309,6309,6309,6309,14761,23116,35535,39663,39631,39631,39663,39663,39663,39631,39631,39663,37583,33454,31406,12616,6374,16777,37583,39631,39663,39696,39663,39631,39632,41712,43760,43760,43760,43760,43760,43760,43760,41711,39663,43760,43760,43760,43760,43760,43760,43760,39599,39599,39599,39599,37551,37550,37550,39631,39631,37583,41711,43760,43760,43760,43760,43760,43760,37551,20873,33390,29196,25035,22955,22955,22955,22923,18794,16714,14698,10504,6310,4261,4229,4229,4261,4229,4229,2180,2180,2180,4228,6309,18889,29389,25099,22955,22955,20874,14633,12585,12585},
-	{4196,4196,4196,4196,4196,4228,4196,4196,4228,4261,4196,2115,4163,4163,4195,4195,4163,4163,4196,4196,4163,4163,4228,4260,4196,4163,4163,4195,4195,8358,12520,12520,12520,12520,12520,12520,12520,12520,12519,12519,12519,12519,12519,12519,12519,12519,10471,10471,10471,10471,10471,12519,10471,10471,10471,10471,10471,10471,10471,10471,10471,10471,10471,10471,12584,12551,10471,10471,8423,8423,10471,10471,10471,12552,10568,6439,6439,6439,6439,6439,6439,6439,6439,6471,8552,6472,6439,6439,6439,6471,6472,6440,6472,6440,6472,6440,6440,6440,8455,14632,22954,35470,20873,4229,2181,2181,2180,2180,4228,4228,4228,4228,4228,4260,4260,4228,4228,4228,4228,4261,6342,4293,4228,4228,4196,4196,4261,6309,25067,41776,43856,43889,33486,10470,6310,6342,6310,12583,33486,43889,43889,43889,43888,43856,43857,41808,41776,41808,37712,37775,35759,31663,29679,27598,27565,27565,29646,31760,38034,35954,27630,25485,23404,19244,19211,17131,17131,17131,19212,17131,17130,17130,17131,17131,17131,17131,17131,17131,17131,17131,17131,17131,17131,17131,17131,17131,17131,17131,17099,12906,12874,10762,10762,10762,10762,10762,10762,10697,6406,12842,10664,12809,14922,6373,4261,6342,6374,4261,4261,4261,6309,8422,10503,10503,12616,10536,10503,10503,8422,4261,4261,4261,4261,6309,8422,6309,6309,27148,39664,43760,43759,39631,35470,35470,39663,37550,35470,35470,35470,25099,14729,12681,8423,6310,18792,41712,43759,43759,43792,43792,43760,43760,43760,43760,43760,43760,43760,43760,43760,43760,43760,43759,43760,43760,43760,43759,43759,43760,43760,43760,43760,43760,43760,43760,43760,43759,43792,43792,43824,43760,43760,43760,43760,43760,43792,43792,41712,20905,35470,41679,39631,39631,41679,41679,39599,27116,22955,18826,8423,4229,4229,4229,4229,4229,6309,6341,4228,6373,6406,6373,14664,33486,35534,35502,35502,35502,29293,16810,14697,12585},
-	{4196,4196,4196,4196,4228,4228,4196,4196,2148,4228,4228,2115,2115,4195,4195,4163,4163,4163,4196,6276,4196,2115,8518,12745,6309,4163,4163,4195,4163,8358,12552,12520,12520,12552,12552,12552,12520,12520,12520,12520,12520,12520,12519,12519,12519,12519,12519,12519,12519,10471,10471,14632,12552,10471,10471,10471,10471,10471,10471,10471,10471,10471,10471,10471,10471,12584,12552,10471,10471,10471,10471,10471,10471,10471,8455,4391,4391,4391,6439,6439,6439,6439,6439,6439,6471,8552,6471,6439,6439,6439,6471,6472,6472,6472,6472,6440,6440,6440,6407,10504,14600,14600,12552,6310,2181,2181,2181,2180,4228,4228,4228,4228,4228,8422,8422,4228,4228,4228,4228,4261,6341,4261,4260,4228,4260,6341,4261,6309,10438,33453,43889,43889,33454,8390,6310,8390,6342,6342,16744,41808,43889,43889,43888,43888,43856,43857,43856,43856,37743,35727,35759,35889,40115,33872,33840,33775,40050,38002,27598,27565,25517,23404,21292,19211,17131,17131,17131,17131,17131,17131,17131,17131,17131,17131,17131,17131,17131,17131,17131,17131,17131,17131,17131,17131,17131,17131,17131,17131,17131,17099,15019,12874,12874,12874,12875,10794,12875,12842,6438,10664,10664,10632,8486,4261,4261,4229,6341,6309,4229,4261,4229,6309,8422,10503,10535,12616,10567,10503,8455,6342,4261,4261,4261,4261,6309,6342,6341,29228,43792,43759,43791,31308,10438,10438,29261,16745,8390,8390,8390,8390,6342,6342,6342,6310,18793,41712,43760,43760,43760,43760,43760,43760,43760,43760,43760,43760,43760,43760,43760,43760,43760,43760,43792,41711,37582,37614,37646,39695,41743,43760,43760,43760,43760,43760,43759,43759,43759,43791,43792,43792,43792,43760,43760,43760,43760,43792,41711,20873,35470,43760,43759,43760,43760,43760,43760,41680,41680,27148,4261,4229,4229,4229,4229,4229,4228,6341,12583,25195,29389,25163,20937,31437,31437,31437,31437,29421,33485,35502,23084,22955},
-	{4228,4195,4195,4196,4228,4228,4196,2148,4196,2147,4163,4163,4195,4195,4195,4163,4163,4195,4195,4196,6276,4228,8551,14954,6405,4163,4195,4195,4163,8357,12552,12552,12520,12552,12520,10439,10439,12519,12552,12520,12520,12520,12520,12520,12520,12520,12520,12519,12519,12519,12519,12519,14632,12552,10471,10471,10471,10471,10471,10471,10471,10471,10471,10471,10471,12519,14632,12552,10471,10471,10471,10471,10471,10471,8455,6439,6471,6439,4391,6439,4391,4391,6439,6439,6439,6439,6471,6504,6439,6471,6471,6471,6472,6471,6440,6440,6472,6439,6407,10504,12552,12552,12519,6310,4229,4229,4229,4261,6309,4228,4228,4228,6341,6341,4228,4228,4228,4196,4228,6341,4293,2180,2148,4261,6406,6374,6309,6341,6309,23018,41808,43889,33454,8390,6342,6342,6342,6342,14664,41808,43889,43889,43889,43889,43889,43857,43856,43856,43920,41905,42001,42099,44277,42196,40082,37904,35759,27533,23405,23404,23404,21324,19211,17131,17131,17131,17131,17099,17099,17099,17164,17131,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,12939,15019,17131,12841,10664,10664,4229,4261,4229,4229,4196,4196,4196,2180,4229,4228,4261,6309,8454,10503,8454,10600,10567,8454,6341,6309,4261,4261,4261,4261,6342,6342,23051,41743,43792,43792,31309,6342,6341,20906,12552,6310,8390,6310,6310,6310,6310,6342,6309,14664,35535,43792,43792,43792,43792,43792,43792,43792,43760,43760,43760,43792,43792,39663,35502,35503,33454,35535,31406,23180,23244,25356,25356,35598,41743,43760,43760,43792,43792,43760,43760,43760,43760,43760,43792,43824,43792,43760,43760,43760,43760,41711,22953,37550,43792,43759,43792,43792,43760,43760,43760,39631,20905,4229,4261,4229,4229,4229,4260,4260,4261,29260,43760,43727,43727,41679,43727,43727,41679,41679,41679,43727,43727,41679,41647},
-	{4196,4195,4195,4228,4228,4228,4196,2148,4196,2147,4163,4163,4163,4163,4163,4163,4163,4163,4163,4195,4195,6373,10696,12873,6405,2115,4196,4196,4195,6276,8390,12519,12552,12552,10439,4164,4164,8357,12519,12552,12552,12552,12552,12520,12520,12520,12520,12520,12520,12519,12519,12519,12552,14632,12584,12519,10471,10471,12519,10471,12551,12552,12519,12519,10471,10471,12552,12584,10471,10471,10471,10471,10471,10471,8455,6439,6504,8552,6439,6439,4391,4391,6439,4391,4391,4391,6471,8584,6472,6439,6439,6471,6471,6471,6439,6439,6439,6439,6439,10503,12552,12551,10471,4229,2180,2180,2180,6342,8390,6341,8389,4228,6341,4228,4228,4228,2180,4196,4228,4293,4260,4228,4228,6341,6374,8422,4261,6309,6309,6309,25099,41841,33486,8390,6342,6342,6342,6342,14664,41808,43889,43889,43889,43889,43889,43889,43856,43888,43921,43985,42033,44244,42163,35921,29647,27533,25453,23372,21292,21292,19211,19212,19212,17131,17099,17131,17131,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17131,12841,10664,10664,4261,4261,4196,4196,4196,4196,2148,4229,4261,4228,4261,4261,6341,8454,8422,8454,10567,8455,6374,6374,4261,4261,4261,4261,6374,8520,14826,27309,31406,31438,23052,6342,6341,6341,6310,6342,10503,10503,8390,6310,6310,6342,6342,8422,23083,35598,35566,35598,35598,35598,35598,35598,35598,35598,35598,35598,33518,27277,18988,19020,19052,21132,21164,23276,23276,23308,23308,25324,33550,35566,37647,43792,43792,43792,43792,43792,43792,43760,43760,43824,43792,43792,43760,43760,43760,33389,27179,39663,43792,43759,43760,43760,43760,43760,39631,22986,6277,4229,4229,4229,4229,4261,4261,4229,14664,35470,43728,43727,43727,43727,43727,43727,43727,43727,43727,43728,39631,33486,33486},
-	{4228,4195,2147,4196,4228,4228,4196,2148,2147,2147,4195,4163,4163,4163,4163,4195,4195,4163,4163,4228,6438,10664,14986,12906,10663,8486,4228,4164,4196,4163,4164,8325,8358,8358,6309,4196,4195,4196,10471,12552,12552,12552,12552,12552,12552,12520,12520,12520,12552,12552,12520,12520,12584,14761,14729,14729,12519,12519,12519,12519,12552,12584,12520,12519,12519,12519,10471,10471,12551,10471,10471,12551,10503,8455,8455,6439,6439,8552,8552,6471,6439,4391,6439,4391,4391,6439,6471,6472,8584,6472,6439,6471,6471,6471,6471,6471,6471,4391,6407,10503,12552,12551,6309,2148,2148,2148,2180,6342,6374,8422,8422,4228,2180,2180,6308,6341,4293,4293,4293,6373,6373,4325,6374,6374,6374,6341,4228,4228,4261,6341,8389,20970,18890,8390,6342,6342,6342,6342,14664,41840,43889,43889,43889,43889,43889,43889,43889,43889,43953,43985,44050,42164,35888,31726,27566,25453,21325,21292,19212,19180,17132,17131,19212,19212,17131,17131,17099,17099,17099,17099,17099,17099,17131,17131,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,12777,10664,8551,8487,8487,4261,4261,4196,4196,4196,4196,4196,4229,4229,4228,4261,4261,4261,6341,6374,4261,6341,10535,8454,6374,4261,4261,4261,4261,6406,12746,16972,16939,14859,12681,10535,6309,6310,6342,6342,6342,8423,12648,10503,6310,6310,6342,6342,8422,14793,27341,33550,25325,23276,23276,23276,23276,23276,23276,23276,23276,21196,19115,19084,19083,21196,21228,21228,21228,21228,21228,23308,23308,23308,23308,27405,33550,35598,33550,33550,33550,33550,37647,43792,43792,43792,43792,43792,43792,43792,31308,35502,43824,43824,43792,43760,43760,43792,41744,22986,6309,4229,4229,4229,4229,4229,4261,4260,2147,22986,43728,43728,43727,43727,43727,43727,43727,43727,43727,43727,43728,33486,21164,19115},
-	{4196,2147,2147,4196,4228,4228,4196,4195,2147,4163,4163,4163,4163,4163,4163,4195,4163,4163,4163,4260,12809,12873,12906,14986,14954,12809,4260,2147,4195,4195,4195,4163,4163,4163,4164,4196,4195,4196,10439,8358,8390,12552,12552,14600,12552,12552,12552,12552,12552,12552,12552,12552,12616,17003,17002,16938,12584,12552,12552,12552,12552,12552,12552,12520,12519,12520,12552,12552,12552,12552,12552,12552,10504,8487,8487,6439,6439,6471,8584,8584,6439,6439,4391,4391,6439,8487,8487,8487,6472,8584,6471,6471,6471,6471,6471,6471,6471,4391,6406,10503,12551,12551,6341,2180,2180,2147,2180,4261,8422,8390,4228,2180,4228,4228,6308,6308,4260,4260,4293,4293,4293,4293,4293,4293,4293,4228,4228,4228,4228,6341,6342,6309,6309,6342,6342,6342,6342,6342,14696,41840,43921,43889,43889,41840,37743,35695,35695,35727,37807,37872,42098,40049,35856,29646,27533,23405,23341,21292,19212,19180,17131,17131,17131,17132,17131,17099,17099,17099,17099,17099,17099,17099,17131,19212,17131,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,14986,10664,10664,10664,10632,6342,4229,4261,4261,4261,4261,4261,4196,4196,2148,2148,2148,4261,2180,4228,4261,4261,4261,4261,4261,4261,6374,6374,8487,8454,4261,4261,4261,4261,4261,6407,12746,14891,14827,6374,6309,6341,6310,6310,6342,6342,6342,10503,8423,6310,6342,6342,6342,8422,10567,16776,23018,23212,21260,21228,21228,21228,21228,21228,21228,21228,21228,21228,21228,21228,21228,21228,21228,21228,21228,21228,21228,23276,23276,23308,23308,23308,25357,25357,25357,25356,27405,37647,41744,41744,35598,33550,33518,33518,33518,33518,33518,33550,33550,33518,33518,31406,31438,23051,8422,4261,4261,4229,4229,4229,4229,2181,10502,14630,22953,43760,43759,43727,43727,43727,43727,43727,43727,43727,43727,43727,33486,21163,19115},
-	{4196,4195,2147,4196,4228,4228,4196,4195,4163,4163,4163,4163,4163,4195,4195,4195,4163,4195,4163,4228,12776,12841,12841,12874,14954,12841,10664,8486,4195,6373,10631,6308,4163,4196,4196,4196,4196,8357,12519,4196,6277,12552,14600,12552,14600,14600,14600,14600,14600,12552,12552,12584,14858,17067,17099,16906,14665,14632,12552,12552,12552,12552,12552,14665,14632,12552,12552,12552,12552,12552,12552,12552,10504,8487,8487,6439,6471,6471,6471,8584,8552,6439,4391,6439,8487,10504,12552,10503,8487,6472,8584,6471,6439,6439,6471,6439,4326,6438,6438,10503,12551,12551,6341,2180,2180,2147,2147,4260,6341,6309,4228,2180,4260,8422,10470,8389,6341,4325,6373,6405,6405,6406,6406,6406,6406,6373,4260,4228,4228,6309,6342,6342,6310,6342,6342,6342,6342,6342,14664,41808,43921,43888,43889,41840,37744,35696,33647,29582,31694,33807,42163,35856,33743,29614,25485,25453,23373,23341,21292,19212,19180,17131,17131,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,19180,17131,17099,17099,17099,17099,17099,17099,17099,17099,15051,17099,12873,8583,8584,8584,10664,12809,6342,6310,4261,6309,4261,4261,4261,4261,4261,4261,4261,4228,4196,2148,2148,2148,4260,4228,4261,4261,4261,4261,4261,4261,4293,8454,4261,6342,8454,4293,4261,4261,4261,4261,4261,6407,8520,12746,8455,6309,6309,6341,6342,6342,6342,6342,8422,8423,8423,8422,6342,6342,8423,8455,6309,6342,17002,21228,21228,21228,21196,21196,21228,21228,19180,19180,19180,19180,19180,19148,19180,19148,19148,19148,21228,21228,21228,21228,23276,23276,25324,25324,25356,25356,25260,25196,31470,33518,31470,35598,35599,35598,35598,35598,35566,35598,27373,33518,35599,35599,33486,18890,6341,6342,6374,4261,4229,4229,4229,4261,4228,16712,25067,12518,35437,43727,43727,43727,43727,43727,43727,43727,43727,43727,43727,33454,19115,17067},
-	{4195,4195,2147,4228,4228,4196,4196,4228,4195,4163,4163,4163,4163,4195,4195,4163,4163,4195,2115,4228,10728,12841,12841,12841,12873,12841,12873,10664,4195,8518,12874,6373,4196,4164,4163,6405,10696,12616,12551,4196,6277,12552,14600,12552,12584,12584,12584,14600,14600,14600,12552,12584,17035,17067,17068,14858,14632,16713,14632,12552,12552,14600,12552,14632,16745,14632,12552,12552,12552,12552,12552,12552,10536,6472,6471,6471,6471,6471,6471,6471,8584,8552,6471,8487,10504,12552,12552,10504,10503,8487,6472,8584,6471,6439,6439,6439,4293,6406,6471,10535,10503,10503,6341,2180,2180,2147,2180,4261,4260,4260,4260,4260,6308,8389,8389,6341,4260,4260,6341,6373,6405,6406,6405,6405,8519,8486,4260,4228,4228,6309,6309,6342,6342,6342,6342,6342,6342,6342,10503,22986,29292,39695,39663,31340,27179,27244,31598,31630,35791,39985,42163,37936,31694,29614,27533,27534,27534,25453,23373,21293,21260,19212,19212,19180,19179,17099,17099,17099,17099,17099,17067,17067,17067,17067,17099,19180,17099,17067,17067,17067,17067,15019,17099,17099,17099,17099,14986,12841,8519,10664,8454,6407,6310,6310,6309,6310,6310,4261,4261,4261,4261,4261,4261,4228,4196,2148,2148,2148,4260,2180,4261,4261,4261,4261,4261,4261,4261,4293,4261,4261,4293,4261,4261,4261,4261,4261,4261,4261,4261,6406,6374,8423,6309,6309,6309,6342,6342,6342,8422,8423,8422,8455,8390,6310,8422,8455,6341,6342,17002,19180,19148,19148,19148,19148,19147,19147,19147,19147,19147,19147,19147,17099,17099,19147,19147,19147,19148,19148,19148,21228,21228,23276,29453,29421,27373,33550,35567,35534,31470,31470,35599,41744,43792,43792,43792,43792,43792,41744,29421,27373,29421,29454,23083,8390,4229,4261,4293,4261,4261,4261,20938,31309,25067,8422,10503,4228,29196,43728,43727,43728,43727,43727,43727,43727,43727,43727,37550,25260,19083,17035},
-	{4195,4195,2147,4228,4228,4196,4195,4196,4228,4195,4163,4163,4163,4163,4163,4163,4163,4163,2115,4228,10728,12809,12809,12809,10793,12841,14954,10664,4195,8518,12873,10729,10632,4228,4163,8486,14922,10567,10471,4228,6277,12552,14600,12584,14826,14858,14664,14600,14632,14600,14600,14664,17003,17099,17099,17036,14761,14632,14600,14600,14600,14600,14600,12584,14665,16745,14632,12552,12552,12552,12552,12552,10536,6472,6472,6472,6472,6471,6471,6471,6471,8584,8552,10535,12552,12552,12552,12552,10503,10503,6439,6472,8584,8519,10503,8487,6341,6406,6470,8487,6439,6374,4260,4260,2180,2147,2180,4260,4260,4260,4260,4292,6406,4260,4260,4260,4228,4195,4228,4292,4292,4260,4260,6341,6340,6309,6308,4228,4228,6309,6309,6310,6310,6342,8390,8390,6342,8390,10471,14632,14599,18792,22954,22953,31373,27179,39792,39856,41969,44082,42195,37936,33807,31726,31694,35921,33808,29647,27566,25453,23373,23341,21292,21292,19212,19212,19180,17131,17099,17099,17067,17067,17067,17067,15019,17099,19180,17099,17067,17067,17067,15019,15019,17067,17067,15051,15019,17035,10600,12777,8455,6310,6310,6310,6309,6310,6310,6310,6310,4261,4261,4261,4261,4228,4196,2148,2148,4196,4260,2180,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,8422,8422,6341,6309,6309,6310,6342,6342,6342,6310,8422,8455,6342,8422,8455,6341,6342,14922,19148,17100,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,17099,19147,19148,19148,19148,19148,21228,23276,33550,39695,37647,31470,31469,31469,35566,33550,29421,39695,41743,43792,43792,43792,43792,39695,27341,21196,21196,21196,12745,4293,4261,4261,4261,4293,6342,4261,18986,27341,21099,4261,4228,4260,27179,41711,41711,41679,41679,41679,41679,41679,41679,37582,25228,19083,17035,17035},
-	{4195,4195,2147,4195,4228,4196,4163,4163,4228,4228,4163,4163,4163,4195,4196,4163,2115,4163,2115,4228,10696,12809,12809,12809,12809,12809,12841,10664,4196,8518,12841,12873,12809,4293,4196,8486,14922,12841,12777,4260,4196,8390,12552,12552,14858,16971,14664,14600,14632,14632,14632,14665,17003,17099,17100,19148,16842,14600,14600,14632,14600,14632,14633,14633,16745,16745,14632,14632,14632,14632,14632,14632,12584,8520,6472,6472,6472,6472,6472,6471,6471,6472,6472,10536,12552,10504,10504,12552,10504,10503,10503,6439,8520,12616,12551,10503,10471,6341,6406,6438,6406,4260,4260,4260,4228,2147,4227,4260,4260,4260,4260,4260,4292,4292,4260,4260,4227,4227,4228,4261,4293,4260,4260,6341,4228,4228,4260,4261,4261,6309,6309,6277,6310,6342,12583,10503,6342,6342,8390,6277,10438,29259,39695,39695,41808,41808,43921,43985,44049,44212,42228,37968,35887,33839,35887,40115,42196,40115,33808,29646,27533,25453,23405,23373,23373,21292,21292,21260,19212,17132,17100,17099,15019,15019,17067,17067,17099,19180,17099,17067,17067,17067,17067,17067,15019,17099,12809,8487,8487,8487,6342,6310,6310,6310,6310,6310,6310,6310,6310,6309,4261,4261,4261,4228,4196,2148,2148,4196,4228,4228,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,8422,10535,6342,6309,6310,6310,6342,6342,6310,6342,8422,8455,8423,8455,6342,6342,14922,17099,17099,17099,17099,17099,17099,17099,17099,17067,17067,17067,17067,17067,17099,17099,17099,17099,21196,23244,23244,23244,23277,31469,41743,43792,43792,35535,35535,39695,41744,31470,23276,27373,29421,39695,43792,43792,39695,29421,21196,21196,19116,12745,6374,6374,6342,4261,4228,4261,8454,8454,16938,21164,16970,4293,4229,4228,16873,23180,25260,25260,25260,25260,25260,23212,23180,21132,17035,17035,17035,17035},
-	{4195,4195,2147,4195,4196,4196,2115,2115,4163,4196,4196,2115,2115,4260,8486,2147,2115,4163,2115,4228,10696,10729,12809,12809,12809,12809,12809,10664,6276,8518,12841,12841,12841,12809,8551,8486,12874,14922,12841,4261,4228,6406,8454,6309,12777,16971,14664,14632,14632,14632,14632,14665,17003,19116,19148,19148,16842,14632,14633,14632,14632,14601,14601,14633,14665,16778,16745,16746,14633,14632,14632,14632,14632,10568,8520,6472,6504,6472,6472,6472,6472,6472,6472,10633,12616,10504,12552,12552,12552,12552,12551,10503,10503,12551,10503,10503,10503,10471,4260,4260,4260,4228,4228,4260,4228,4195,4227,4260,4260,4260,2179,4260,8550,6405,4260,4260,4260,4228,4260,2213,4293,4260,6308,6341,4228,4261,6309,6308,4261,6341,6276,6276,6309,6342,12616,12584,6342,6342,6342,6277,20938,41840,43921,43889,43889,43889,43921,43953,44017,44211,44276,40081,37968,37968,40115,42196,38001,40115,42195,38034,31727,29679,29647,29647,27599,27566,25486,23373,21292,19212,17132,17099,15019,15019,17067,17067,17067,17099,17132,17067,17067,17067,17067,17067,15019,17067,12809,12745,14987,14922,6406,6310,6310,6342,6310,6310,6310,6310,6310,6309,6310,4261,4261,4261,4196,4196,2148,2148,4228,4228,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,6374,12648,8455,6341,8422,8390,10503,8422,6309,6309,6342,8422,8455,6342,6310,6342,12809,17067,17099,17067,17067,17067,17067,17067,17067,17067,17067,17067,17067,17067,17067,17067,17067,17067,29422,39728,39696,39696,39695,37647,41743,43824,35502,14664,16744,37583,41744,29421,23244,23244,23244,27341,37647,37647,29389,21164,19147,19115,12777,4293,4261,4261,6374,4293,6373,10631,17003,19083,19115,19115,14890,4293,4229,4229,12745,10567,16970,19083,19083,19083,19083,17035,17035,17035,17035,17002,14954,14954},
-	{4195,4195,2115,2115,4195,4228,2115,2115,2115,2115,2115,4195,4163,4260,8519,2147,2115,4163,2115,4228,10664,10728,10728,10728,10729,10729,10729,8583,4228,8551,12841,12809,12809,12841,10631,8486,12842,12842,12809,4260,6341,14890,12809,8422,12744,14922,12616,14632,14632,14632,14632,14665,19051,19116,19116,19148,16842,14633,14633,14632,16745,20906,16809,16809,14665,14665,16778,16777,16778,14665,14632,14632,14632,12584,8552,6504,6504,6504,6504,6504,6472,6472,6472,6472,10536,12584,12552,12552,12552,12552,10503,10503,10503,10503,10503,10503,10503,10471,6276,4228,4228,4228,4228,4260,4260,4195,4195,4195,4228,4260,2179,4260,6438,4292,4260,4260,4260,4228,4260,2213,2213,4260,6308,6341,4261,4261,4228,4228,6309,6341,6276,6276,6309,6342,10471,10471,6342,6342,6310,4229,23019,43921,43889,43889,43889,43889,43889,43953,43985,44082,44211,42195,38000,42162,42196,37969,33807,35824,37937,42164,40083,38035,38035,38035,38035,38035,35922,29647,25486,21292,19180,17099,15019,15019,15019,15019,15019,15019,15019,17067,17067,15019,15019,15019,15019,15019,14987,17035,15019,14890,8422,6310,6342,6310,6310,6310,6310,6310,6310,6309,6309,6309,4261,4261,4196,4196,2148,2148,4228,2180,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,6342,10535,8455,6374,8422,8390,10535,8422,6309,6309,6309,6342,8422,8455,6342,6341,8487,12809,14890,14922,17067,17067,17067,17067,17067,17067,17067,15019,17067,17067,17067,17067,17067,17067,27373,37647,35599,37647,33518,23244,29357,39631,18793,6310,6310,16745,29357,23212,21196,21164,16971,19019,23212,21164,19116,19115,17067,12777,4293,4261,4261,4261,6406,10664,16971,17002,17035,17035,19116,19116,14858,4261,4229,4229,12713,8487,14890,17035,17035,17003,17003,17003,17002,16970,14954,14922,14922,14922},
-	{2115,4195,2115,2115,4195,4196,2115,2115,2115,2115,2115,4196,4195,4260,8486,4163,2115,2115,4163,4228,10664,10696,10696,10729,10729,10729,10729,8583,4195,8519,12842,12809,12809,12809,10631,8486,12842,12842,12809,4260,6373,14922,8583,4228,12744,14922,10600,12649,12552,14632,14633,14665,19051,19116,19116,21196,16842,14633,14665,14633,20906,31406,29422,31470,25132,16713,16713,16778,16745,16778,16713,14633,14633,12617,8552,6504,6504,6504,6504,6504,6504,6504,6472,6472,10568,14697,14664,12552,12552,12552,12552,12551,12551,10503,10503,10503,10503,10471,6276,4228,4228,4228,4228,4228,4260,4195,4195,4195,4228,4260,2179,2179,6373,4325,4260,4260,4260,4260,4260,4261,2213,4260,4260,4293,4261,4261,4228,4228,4261,6341,6276,6276,6341,6342,8390,8390,6342,6342,4261,4261,23018,43921,43889,43889,43889,43889,43889,43921,43953,44017,44082,42163,40114,44276,40050,35823,35791,39921,43985,44017,37840,31663,27566,27501,27534,27566,33808,40116,35922,25454,21260,17100,17067,15019,14987,15019,14987,15019,15019,17067,17100,15019,15019,15019,15019,15019,15019,15019,14987,8519,6342,6342,6342,6310,6310,6310,6310,6310,6310,6310,6309,4261,4261,4261,4228,4196,2148,2148,2148,4228,4261,4261,4261,4261,4261,4261,4261,4293,4293,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,6341,8422,6341,8455,8454,8389,10503,8422,6309,6309,6309,6309,6341,8422,8455,6342,8422,6374,6342,8552,17035,15019,17067,15019,15019,14987,14987,14987,14987,17067,17067,17067,17067,17067,19115,19116,19116,19116,19116,19148,14793,25131,16745,6342,6310,6310,12713,21164,16971,14858,8422,8455,16970,17068,17068,17035,12777,6374,4261,4261,4261,6406,12810,17035,17068,17035,14955,14955,17003,19116,14890,4261,4228,4229,12712,8487,14858,17003,17002,14954,14922,14922,14922,14922,14922,14922,14922,14922},
-	{2115,4195,2115,2115,2115,4195,4195,2115,2115,2115,2115,4163,4196,6341,8487,4163,2115,2115,4163,4228,10696,10696,10696,10729,10729,10729,10729,8551,4163,8486,12809,12809,12809,12809,10631,8486,12842,14890,12809,4260,6308,10632,6406,4196,12745,17003,17003,14890,12680,16809,14697,14665,19051,21164,21164,21196,18922,14665,16713,16713,16681,27148,43856,43856,39728,20874,14665,16713,16745,18826,18794,14665,14665,14665,10568,10600,10600,8552,8552,6504,6504,6504,6472,6472,8552,10568,14697,14664,12552,12552,12552,12552,12552,10503,10503,10503,10503,10503,6309,4228,4260,4260,4228,4260,4260,2180,2147,4228,4260,4260,2179,2212,8583,8518,4292,4260,4260,4260,4260,4261,4261,4260,4260,4293,4293,4261,4228,6276,6309,6341,6276,6276,6342,6342,6374,6374,6309,4294,4229,6406,25195,41840,43889,43889,43889,43889,43888,43888,43921,43953,44017,44082,44179,44147,44049,43985,43953,43953,43921,43921,43953,31598,25421,25453,23373,25485,27566,35954,44277,29647,21292,19148,17067,15019,15019,15019,15019,15019,15019,15019,15019,17067,15019,14987,14987,15019,15019,15019,14987,8519,6342,6342,6342,6310,6310,6342,6310,6310,6310,6310,6309,4261,4293,4261,4261,4229,2148,2148,2180,4261,4261,4261,4293,4260,4260,4261,4261,4293,6374,4293,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,6341,6341,8454,8454,8422,8454,6342,4261,4261,6309,6309,6309,6309,6374,8455,8455,6342,6309,8551,15019,15019,15019,15019,15019,15019,15019,15019,14987,14987,14987,17067,17067,17067,17067,17067,17067,17068,19116,19116,12712,12648,10568,8423,6342,6309,12712,16971,8487,6341,6309,6309,8487,12777,12777,12745,6374,4261,4261,6374,8519,12809,14955,14955,14987,17067,14955,14955,14955,14955,14922,6341,4229,4229,10664,8487,14858,16971,14922,14922,14922,14922,14922,14922,14922,14922,12842,12842},
-	{2115,4195,2115,2115,2115,4195,4195,2115,2115,2115,2115,2115,4163,6341,8487,4195,2115,4260,4196,4228,10697,10696,10696,10697,10697,10697,10697,8551,4163,8486,12809,10761,12777,12809,10599,8486,12842,12842,12809,6341,6373,2148,4196,6374,14890,17003,17003,21132,29389,31437,29260,27180,29357,31470,31470,31470,23051,16681,16713,16713,16681,27148,43856,43856,41776,20906,16713,16713,16746,18858,18858,21003,18955,16713,14665,14665,14665,8553,6504,8552,6504,6504,6504,6504,8584,8520,12616,14665,12552,12552,12552,12552,12552,10503,10503,10503,10503,10503,8422,4228,4228,4260,4260,4260,2180,2147,2147,4228,4260,4260,2179,2179,6405,6405,4260,4260,4260,4260,4260,4261,4261,4260,4292,4293,4293,4261,4228,6276,6309,6341,6276,6276,6309,6341,6342,6342,6342,8423,10503,18986,27438,31566,41840,43889,43856,41743,41775,43888,43889,43921,43953,43985,43985,43985,43953,43921,43889,41808,33615,33582,31567,25357,21228,21293,23341,25453,27534,35921,40083,27566,21292,19148,17067,14987,14987,14987,14987,14987,14987,14987,14987,17068,17100,15019,14987,14987,14987,14987,14987,8519,6342,6342,6342,6310,6310,6342,6310,6310,6310,6310,6309,4261,4261,4261,4261,4261,4229,4228,4261,4261,4261,4261,2180,4260,4260,4261,4261,4261,4293,6374,4293,4260,4261,4261,4261,4261,4261,4261,4261,4229,4261,4261,4261,8422,8454,8454,8454,10535,8422,6341,4261,4261,4261,6341,8422,6342,4261,8422,8455,6342,4261,8551,14987,14987,14987,14987,14987,14987,14987,14987,14987,14987,14987,14987,17035,17035,17035,17067,17067,17067,17067,17067,12712,6342,6342,8455,8423,6310,8487,8487,6341,6309,6309,6309,4261,4261,4261,4261,4261,4325,8551,10729,14955,14955,14954,14954,14954,14954,14922,14923,14923,14923,12809,6374,4261,4228,8487,6374,8519,10664,14890,14922,14890,14890,14890,14890,12842,12842,12842,12842},
-	{2115,4195,2115,2115,2115,4195,2115,2115,2115,2115,2115,4163,2115,4228,8486,4195,4163,8486,6309,4228,10632,10664,10664,10664,10696,10696,10697,8551,4163,8486,10729,10729,10729,12777,8551,8486,12809,12842,12777,6406,10632,4196,4164,10632,25261,31405,31405,35534,41744,43792,43792,43792,43792,43792,43792,43825,27180,16681,16713,16713,16713,27148,43856,43856,41776,20907,16713,16745,16713,21003,25228,33615,31503,16778,16713,16713,16713,10601,8552,8552,8552,6504,6504,6504,8584,8552,12584,14632,12552,12552,12552,12552,12552,12552,10503,10503,10503,10503,10470,6308,4228,4228,4260,4260,2148,2147,2147,4228,4260,4260,2179,2179,6405,6373,4260,4260,4260,4260,4260,4261,4261,4260,4260,4293,4293,4261,4228,4196,6309,6341,6276,6276,6342,8390,4229,4261,4262,16681,20842,27277,35663,35663,41808,43889,43856,39695,41775,43888,43889,43889,43888,43920,43921,43921,43888,43888,41808,31502,21196,19148,19148,19116,19116,19148,21260,23373,25453,35921,33808,23373,21260,17100,14987,14987,14987,14987,14987,14987,14987,14987,14987,14987,17067,17100,14987,14987,14987,14987,14987,8487,6342,6342,6342,6310,6310,6310,6342,6342,6342,6310,6309,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,2180,2147,4228,4228,4260,4261,4261,4260,4293,6374,4261,4228,4228,4228,4228,2180,2180,4260,4229,4228,4228,6341,8454,8454,8454,8454,8454,10535,8454,4261,4261,4261,6341,10503,8422,4261,6309,8455,6342,4261,6406,12810,14987,14987,14987,14987,14987,14987,14987,14987,14987,14987,14987,14987,14987,17035,17035,17035,17035,17035,17067,12712,6310,6342,6342,8455,8423,6310,6310,6310,6309,6309,6309,4261,4261,4261,4261,4293,10664,14923,14955,14955,14955,14955,14922,14922,14922,14922,14923,14923,14923,12777,4293,4261,4228,4228,4228,4229,6374,12810,12842,12842,12842,12842,12842,12842,12842,12842,12842},
-	{2115,4196,2115,2115,2115,2115,2115,4228,6341,4163,2115,2115,2115,4228,8486,4195,2115,6406,4261,4228,8552,10664,10697,10697,10664,10664,10665,8519,4195,6406,10697,10729,10729,12777,8551,8454,12810,12810,12745,6373,10600,12550,25067,29261,39631,41712,41712,41712,43760,43792,43824,43824,43792,43792,43792,43824,27180,16713,16713,16713,16713,27180,41809,43857,39728,22955,16713,16714,16713,27277,37776,41873,37712,20939,16713,16713,14697,10601,8584,8584,8584,8584,6504,6504,8552,8552,12584,14632,14632,12552,12552,12552,12552,12552,10503,10503,10503,10503,10471,8390,4228,4228,4228,2179,2147,2147,2147,4227,4260,4260,2179,2212,8583,8518,4260,4260,4260,4260,4260,4261,4261,4260,4292,4293,4293,4261,4228,4196,8390,8422,4228,6276,6342,8422,6374,4293,4261,16681,18762,22922,29229,29229,37615,43889,43889,43888,43889,43856,43856,43856,43856,43888,43856,43856,43856,41808,31502,21164,19116,19116,17068,17035,17035,17068,19180,23373,27502,35921,31728,21293,19180,17067,14987,14987,14987,14987,14987,14987,14987,14987,14987,14987,14987,15019,14987,14987,14987,14987,14955,8487,6342,8455,12745,8520,6310,6310,6310,6342,6310,6310,6309,4261,4261,4261,4261,4261,4261,4261,4261,4261,2180,2148,2147,2180,2180,4228,4228,4228,4228,4229,4293,4261,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,6309,8422,8422,8422,8422,8422,10503,10535,6342,4261,4261,6341,10502,8422,4261,6309,8455,6342,6374,4261,6406,8584,12842,14987,14987,14987,14987,14987,14987,14987,14987,14987,14987,14987,14987,14987,14987,17035,17035,17035,14890,8487,6310,6310,6342,8422,6310,6310,6310,6309,4261,4261,4261,4261,4261,4293,8584,14922,14922,14922,14923,12874,12874,12874,12874,12874,12874,12842,12842,12842,10729,4261,4228,4196,4228,4228,4229,6374,12810,12842,12810,12810,12810,12810,12810,12810,12809,12809},
-	{2115,4196,4196,2115,2115,2115,2115,4260,8454,4163,2115,4163,4163,4228,8454,4195,2115,6406,8487,4260,8552,10632,10665,12745,10697,10664,10665,10632,8519,8584,10697,10697,10697,10729,10665,18922,31374,31374,27245,10470,10696,14825,25196,25197,25196,25228,27276,31405,41744,41744,41776,41776,41744,41744,41776,41776,37582,31374,25196,21035,18793,25099,31502,33550,31470,20906,18794,18794,16713,27245,33615,33615,31470,18858,16745,16745,16713,10633,8585,12649,8585,8585,6536,6504,8552,8552,12616,14632,14632,12584,12552,12552,12552,12552,10503,10503,10503,10503,10503,10503,6341,4228,4228,2147,2179,2147,4195,4195,4228,4260,2179,2179,4325,4292,4260,4260,4260,4260,4260,4261,4261,4260,4292,4293,4293,4261,4228,4228,10471,8455,4228,4228,6309,8422,10567,6374,6309,16648,18762,18729,18729,18729,22955,29196,39696,43856,43888,43856,43856,43856,41808,41808,41841,41808,41776,33550,23244,19116,19116,17068,17036,17035,17035,17068,19180,23341,31696,35889,27534,21260,19148,17067,14987,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14987,14955,8519,6342,8519,14987,10664,6342,6342,6310,6342,6310,6309,6309,4261,4261,4261,4261,4261,4261,4261,4261,4261,2180,2148,2147,2180,2180,2148,2148,2148,4228,4229,4228,2180,4261,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,6341,8422,8422,8422,8422,8454,10535,10567,8422,4261,6309,8454,8422,4261,4261,6342,6342,6374,6374,4261,4261,6439,8584,14923,14987,14955,14955,14955,14955,14955,14955,14955,14955,14987,14987,14955,14987,14955,14955,14987,10600,6310,6310,6310,6310,6342,6342,6342,4261,4293,4293,4261,4261,4261,4293,12809,12906,12874,14922,12874,12874,12874,12874,12874,12874,12842,12842,12842,12842,12810,8551,4261,4229,4229,4229,4229,4261,8552,12778,12778,12810,12810,12810,12809,12809,10761,10761},
-	{2115,2115,4196,4195,2115,2115,2115,4261,6406,2147,2147,4163,4163,4228,8454,2147,2115,6406,8552,4293,8552,10632,10632,10665,12777,10665,10664,10664,10697,10697,10697,10697,10697,10697,10729,14858,21035,21035,18922,8422,12777,14858,14858,25197,21068,16971,27309,21068,25228,25228,25260,25261,27373,27309,27341,29389,29390,31470,37712,37679,35535,37615,37680,37712,35631,20907,18794,18794,18794,29325,39792,39792,35599,18826,16745,16746,16746,14697,14697,14697,8585,8585,6537,8584,8552,8552,10568,14632,14632,14632,12584,12552,12552,12552,12552,12552,10504,10503,10503,10471,6309,4228,4228,2147,2179,2179,4227,4227,4228,4260,2147,2147,4228,4260,4260,4260,4260,4260,4260,2213,2213,4260,4292,4293,4293,4261,4228,4228,10470,8422,4228,4261,6309,8389,12615,8455,8390,16681,18761,18729,18729,18729,18729,20777,25003,29197,41776,41808,41808,33551,29422,29422,29422,27341,35599,27373,19116,19116,19084,17036,17035,17035,17035,17068,19180,23373,33841,35889,25453,21261,19148,17035,14987,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,12810,12778,12842,14955,12842,12778,8487,6310,6310,6310,6310,6310,4261,4261,4261,4261,4261,4261,4261,4261,4261,2180,2148,2147,2180,2180,2147,2147,2148,4228,4228,2148,2147,4228,4261,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4260,6341,8422,8422,10566,10566,8487,8454,8422,6309,8454,8454,8422,8454,6341,4261,4261,6374,6374,4261,4261,6374,14890,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,8552,6310,6310,6310,6310,6310,8423,6374,4261,4293,4293,4261,4261,4261,4293,10729,12875,12875,12874,12874,12874,12874,12874,12842,12842,12842,12842,12842,12842,12842,12810,10665,10665,10664,10664,8584,4261,4261,6374,6374,10632,12777,12810,12809,12809,12809,10761},
-	{2115,2115,2115,2115,2115,2115,4195,8487,8552,6373,6373,4260,2115,4228,8454,4195,4196,8454,8551,4261,8552,10632,8584,10632,10665,10664,10664,10664,10665,10665,10665,10697,10697,10697,10729,10729,10729,12777,10697,6406,12777,12810,12842,16971,16939,16939,21068,23148,27309,17003,17003,19052,21164,21165,21132,29390,39696,39728,41808,41841,43857,43856,43856,43857,41808,25067,20874,18794,18794,33422,43921,43921,39728,22987,20874,18794,16746,16746,16746,14697,8585,8585,8617,8585,6536,8552,8552,12616,14633,14632,14632,12584,12552,12552,12552,12552,10503,10504,10503,8423,8422,6341,4228,2147,2179,4227,4227,4228,4228,4228,2179,2147,4260,4260,4260,4260,4260,4260,4260,2213,2213,4260,4293,4293,4293,4261,4228,4228,10470,8357,4228,6309,6309,8422,10535,6374,6309,16680,18761,18729,18729,18729,18730,18730,18730,20778,22922,25132,27342,25293,23245,23245,21165,21164,23245,21164,19116,17036,17036,17036,17035,17035,17035,17068,19180,27567,42196,35921,25453,23341,19180,17067,14987,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,8519,6310,6310,6310,6309,6309,4261,4261,4229,4261,4261,4261,4261,4293,6406,4260,2148,2147,2180,2180,2147,2147,2148,4228,2148,2147,2147,2115,4228,4261,4228,2180,2180,2180,4196,4196,4196,2180,2180,4228,6309,8389,8421,8454,8454,8454,8422,8422,8422,8454,8454,8455,8455,6341,4261,4261,4293,6342,4294,6309,6374,12842,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14923,8519,6310,6310,6310,6310,6310,6342,8455,6374,4261,4261,4261,4229,4261,4293,6471,12842,12875,12874,12874,12874,12874,12842,12842,12842,12842,12842,12842,12842,12842,12842,12842,12842,12842,12842,10697,4261,4229,4229,4229,6341,6374,10665,10761,10761,10761,10761},
-	{2115,2115,2115,2115,4196,4196,4196,8520,8552,8552,8520,4260,2115,4228,6406,4293,8519,8552,8552,4293,8520,8584,8584,8584,8584,10632,12745,10665,10665,10665,10665,10665,10697,10697,10697,10697,10729,10730,12777,10697,12810,12810,12810,12842,14890,14891,14891,16971,19020,16971,17003,17003,19051,19084,19084,29389,39728,39728,37679,31470,39760,43856,43856,43857,43856,39728,35535,22987,22987,35502,43921,43889,43889,39760,39760,29325,18826,16745,16745,10633,8617,8585,14891,12778,8584,8584,8584,8552,10568,14633,12584,12584,12584,12552,10503,10471,10503,10503,10503,6342,4293,4261,2212,2180,2179,4228,4228,2212,4260,4228,2179,2179,4228,4260,4260,4260,4260,4260,4260,2213,4260,4260,4293,4293,4293,4261,4196,4195,8390,8390,4228,6277,8390,14632,10504,4261,4196,14600,18729,18729,18729,18729,18730,18730,18729,18729,18729,18761,18794,21036,21132,21100,19084,19116,21197,19116,17036,17036,17035,14955,14955,14955,14987,17068,19148,27535,40116,35921,29647,25453,21228,17068,14987,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14955,14923,14923,14923,14923,14955,14955,14955,14923,8487,6309,6310,6310,6309,4229,4261,4261,4261,4261,4228,4261,4261,4261,4293,4228,2148,2147,2180,2180,2147,2147,2147,2147,2147,2147,2147,2115,2147,4196,4228,2180,2180,2180,2180,2148,2148,4228,2148,2148,4228,6341,8389,8422,8422,8422,8422,8422,8454,8455,6374,6374,8454,6341,4261,4293,4261,4261,6374,6374,6374,12842,14955,14955,14955,14923,14923,14923,14923,14955,14955,14955,14955,12907,12907,12875,12811,10632,6342,6310,6342,6310,6309,6309,6309,6342,8455,4293,4229,4229,4228,4293,8487,12777,12843,12875,12875,12842,12842,12842,12842,12842,12842,12842,12842,12842,12810,12810,12810,10762,12810,12810,12810,10697,4261,4229,4229,4229,4229,4229,6374,10697,10729,10729,10729},
-	{2115,2115,2115,2115,4163,4196,4228,8520,8552,8552,8552,4260,2115,4228,6406,4293,8552,8552,8552,8520,8552,8552,8584,8584,8584,10632,10665,12745,10665,10665,10665,10665,10665,10697,10697,10697,10697,10730,12778,12778,12778,12810,12810,12810,12842,14890,14891,14891,14891,16971,16971,16971,17003,17003,19052,21132,23212,23212,23213,23212,31470,43856,43856,43856,43888,43889,43889,41808,41808,43857,43889,43889,43921,43921,43921,41841,27245,18890,16842,8617,8617,8585,14923,12810,8584,8584,8584,6536,8552,10568,10568,12584,12584,12552,8422,6341,8422,10503,10471,8422,8422,8422,4261,2180,2212,4228,2180,2180,4228,4228,2180,2179,4260,4260,4260,4260,4260,4260,4260,2213,4260,4260,4292,4293,4293,4261,4196,4195,10438,12584,8390,12552,14632,16713,16681,10438,8325,16648,18729,18729,18729,18729,18729,18729,18729,18729,18729,18729,18729,18761,16714,16713,16778,16971,18987,19052,17036,17003,14955,14955,14955,14955,14955,14987,17100,21293,27534,33841,40147,31728,23341,19148,14987,14955,14923,14923,14923,14923,14923,14923,14923,14923,14923,14923,14923,14923,14923,14923,14923,14923,14923,14923,14923,14923,14923,8487,6310,6310,6309,4261,4228,4229,4261,4261,4261,2180,4228,4261,4261,4261,4228,4228,2180,2180,2148,2147,2147,2147,2147,2147,2115,2115,2147,2115,2147,4196,2180,2180,2148,2148,2148,2148,2148,2147,2147,2148,4228,6341,8389,6342,8422,8422,10534,8421,8422,6342,6341,8422,6374,6341,6374,4261,4261,6309,6375,8455,12842,14955,14923,14923,14923,14923,14923,14923,14955,14955,14955,12907,12907,12875,10665,6374,6342,6310,6310,6341,6309,6309,6309,6309,6309,4293,4261,4229,4228,4293,10664,12810,12843,12843,14923,14955,12810,10697,10697,10729,12810,12842,12810,10730,12778,12810,12810,12810,12810,12810,12810,12810,10665,4261,4229,4229,4229,4229,4229,6406,10697,10729,10729,10729},
-	{2115,2115,2115,2115,2115,4163,6309,8552,8552,8552,8552,4261,2115,4228,6407,6374,8552,8552,8552,8552,8552,8552,8584,8584,8584,8584,10632,10665,10697,10665,10665,10665,10665,10665,10697,10697,10730,10729,10730,12778,12778,12778,12810,12810,12810,14858,14890,14891,14891,14891,14923,16971,14955,17003,17003,19084,21165,19084,21164,21164,27341,39760,43889,39760,37711,37712,37712,37712,39760,39760,37712,37712,37744,37744,37744,39760,33583,27374,25293,16939,8617,8617,19052,14859,8584,8584,8584,8552,8552,10600,8520,10536,12551,8422,4293,4293,6341,8422,6342,4261,2213,4261,2212,2179,2180,2180,2180,2180,4228,4228,2180,2179,4260,4260,4260,4260,4260,4260,4260,2213,4260,4260,4292,4293,4293,4261,4195,4195,10438,14632,14632,14633,14633,16713,16681,16681,16681,16681,18729,18729,18729,18729,18729,18729,18729,18729,18729,18729,18729,18729,16681,16681,16681,16745,16745,16713,16972,17003,14955,14955,14955,14955,14955,14955,17068,19180,23341,27534,35921,40115,25454,19148,17035,14955,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,14923,14923,14923,12875,12875,12875,12875,8487,6342,6310,6309,4261,4228,4229,4229,4261,4261,2180,4228,4261,4261,4261,4261,4261,4261,4228,2148,2147,2147,2147,2147,2147,2115,2147,2147,2115,2147,2148,2148,2148,2148,2148,2148,2147,2147,2115,2147,2147,2148,4228,6341,6341,8390,8454,14791,12484,8421,8454,6341,4261,4261,4261,4261,4261,4261,4261,4262,8487,14923,14955,12875,12875,12875,14923,14923,14955,12875,12875,12875,12907,12875,10697,6374,6310,6342,6310,6310,6309,6309,6309,6309,6309,4261,4261,4293,6342,6374,10664,12843,12842,12842,12842,12810,10697,6439,4293,4293,4326,12810,12810,12810,6471,10632,12810,10665,10697,12778,12778,12778,12778,10697,4261,4229,4229,4229,4229,4261,10665,10729,10729,10729,10729},
-	{2115,2115,2115,2115,2115,2115,6341,10632,8552,8520,8520,4261,4228,4228,8519,8520,8552,8520,8520,8552,8552,8552,8552,8552,8584,8584,8584,8584,10665,10697,10665,10665,10665,10665,10665,10730,12778,10697,10729,10730,10730,12778,12778,12810,12810,12810,12810,12810,14891,14891,14891,14891,14923,14923,17003,17003,19084,19117,19084,19084,21132,27342,33616,31502,29422,31502,31502,31502,33551,29454,27373,31503,33583,33583,33583,33583,35663,29454,33583,33551,10698,8617,27309,21068,10730,10730,8585,6537,6504,8552,6472,8519,6374,6374,4325,4293,4293,6341,6374,4261,4261,4260,2180,2148,2180,2180,2180,2180,4228,4228,2180,2179,4228,4260,4260,4260,4260,4260,4260,2213,4293,6341,4292,4293,4293,4261,4196,4195,8422,14632,14632,14633,16681,16681,16681,16681,16681,16681,16681,18729,18729,18729,18729,18729,18729,18729,18729,18729,18729,18729,18697,16681,16649,16746,16778,16681,14858,14955,14955,14923,14923,12875,14923,14955,14987,19148,23309,25453,31728,40083,25454,19148,17035,14955,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,8487,6342,6310,6342,4261,4228,4261,4229,4261,4261,2148,4228,4261,4261,4261,4261,4228,4228,6341,4228,2147,2147,2147,2147,2147,2115,2147,2147,2115,2115,2115,2115,2148,4196,2148,2148,2115,2115,2115,2115,2115,2147,2148,4228,6309,6342,8421,14596,10469,8422,8422,8454,6341,4261,4261,4261,4261,4261,4261,4261,6374,12778,12810,12875,12875,12875,12875,14923,14956,12875,12875,12875,12875,10697,6374,6310,6310,6310,6310,6309,6309,6309,6309,6309,4261,4229,4261,4261,4228,8487,12778,12843,12842,12842,12843,10665,4293,4261,4293,4261,4325,12778,12810,12810,6439,10632,10729,4293,4326,10665,12778,12778,10730,8552,4229,4229,4229,4229,4229,4261,10665,10697,10697,10697,10697},
-	{2115,2115,2115,2115,2115,2148,8487,8552,10633,8552,8520,4261,6374,4261,8519,8520,8520,8520,8520,8520,8552,8552,8552,8552,8552,8552,8552,8584,10632,10665,12745,10665,10665,10665,10665,10665,10697,10697,10697,10697,10730,10730,10730,12778,12810,12810,12810,12810,12811,12843,12843,12843,14891,14923,14923,14923,17004,17036,17036,19084,19084,19116,21164,29454,39793,41840,35631,35664,33583,27374,25293,31535,35663,33615,33615,39792,37712,35631,41840,35599,10698,8617,27309,21068,23213,19084,8617,6537,8585,8552,6406,6439,6374,6374,6406,6341,4293,4293,4261,4260,4260,4260,2180,2179,4228,4228,2212,2180,4228,4228,2180,2180,2180,4260,4260,4260,4260,4260,4260,2213,4293,6341,4292,4293,4293,4261,4196,4228,8422,14632,14632,10471,12519,14633,16681,16681,16681,16681,16681,16681,16681,18729,18729,18729,18729,18729,18729,18729,16681,16681,18697,16681,16681,16681,16681,16681,14858,14923,17036,14956,12875,12875,14923,14923,14955,19116,21229,23341,35922,35922,23341,19148,17036,14923,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,14891,8487,6342,6310,6309,4229,4196,4229,4229,4261,4261,4196,4228,4261,4261,4261,4261,4228,2148,4228,4228,2115,2115,2147,2147,2147,2147,2147,2147,2115,2115,2115,2115,2148,4196,4196,2148,2115,2115,2115,2115,2115,2115,2148,2148,4228,6309,8389,10404,8389,10405,8422,8422,6341,4261,4261,4261,4261,6309,6309,4261,4261,6342,10600,14923,12875,12843,12875,12875,12875,12875,12875,12843,10697,6374,6310,6342,6342,6310,6309,6309,6309,6309,4261,4229,4229,4196,4261,4261,2148,4228,10632,12875,12843,12842,12843,10665,4261,4261,6373,6341,4293,8584,12810,12810,6439,6439,8519,4261,4261,8552,10730,8584,10665,4293,4228,4229,4229,4229,4229,4261,10633,10697,10697,10697,10697},
-	{2115,2115,2115,2115,2115,2148,8487,8520,8552,10633,8552,6374,6407,4261,8487,8520,8520,8520,8520,8520,8520,8552,8552,8552,8552,8552,8552,8584,8584,8584,10665,10697,10665,10665,10665,10665,10665,10697,12778,10698,10698,10730,10730,10730,10730,10730,12810,12810,12810,12810,12810,12843,12843,12843,12843,14923,14923,14923,17004,17036,17004,19084,19084,27374,31535,31535,23245,23245,21165,21197,21197,23245,23245,23245,23277,29422,39793,43921,43921,35599,10698,16907,33551,23116,31471,23181,8617,8585,8585,8519,6438,6471,6374,6406,6438,6341,4293,4293,4260,4260,4260,4260,2180,2179,2180,2180,2212,2180,4228,4228,2180,2180,2180,4260,4260,4260,4260,4260,4260,2213,4261,4293,4292,4293,4293,4293,4228,4228,8389,12552,12584,6276,8325,14632,16681,16681,16681,16681,16681,16681,16681,18729,18729,18729,18729,18729,18729,18729,18729,18729,18729,16681,16681,16713,14762,14665,14826,12875,12875,14988,14955,12843,12875,14923,14955,19116,21229,27535,33809,25422,19148,17068,14955,12875,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,10697,8423,6342,6310,6309,4229,4229,4196,4228,4229,4229,4196,4228,4261,4261,4261,4261,4228,2148,2116,2148,4228,2148,2147,2115,2147,2147,2115,2115,2115,2115,2115,2115,2148,4196,2148,2148,2115,2115,2115,2115,2115,2115,2148,2148,2148,6277,6342,6373,8422,12582,8422,8422,8422,4261,4261,4261,4261,4261,4261,4261,4261,6342,10665,14956,14923,12843,12843,12843,12843,12843,12810,10665,6374,6310,6310,6310,6310,6310,6309,6309,6309,6309,4229,4196,4196,4196,4261,4261,2148,2148,8552,14956,12843,12842,12843,10665,4261,4261,4261,4293,6341,4358,12778,10762,6439,2180,4228,2180,6406,10730,10730,6407,8520,4293,4228,4228,4229,4228,4229,4261,10633,10697,10697,10697,10697},
-	{2115,2115,2115,2115,2115,2148,8487,8520,8520,8552,8585,8552,6439,4260,8487,8520,8520,8520,8520,8520,8520,8552,8552,8552,8552,8552,8552,8584,8552,8584,10633,10665,10698,10665,10665,10665,10665,10665,12778,12810,10698,10697,10730,10730,10730,10730,12810,12810,12810,12810,12810,12843,12843,12843,12843,12875,14923,14923,14955,17036,17068,17036,17036,19084,19084,21197,21197,19116,19117,19117,21165,21197,21197,21165,21197,23245,27406,39760,43889,35599,10666,23149,41873,23116,31470,21133,8617,8585,10698,12713,8519,6504,6407,6406,6406,6341,4293,4260,4261,4261,4260,4260,2212,2179,2180,2180,2180,2180,4228,4228,4228,2180,4260,4260,4260,4260,4260,4260,4260,2212,4260,4260,4292,4293,4293,4293,6341,4260,4261,6342,8357,4196,8357,14632,14632,16681,16681,16681,16681,16681,16681,18729,18729,18729,18729,18729,18729,16681,16681,18729,16681,16713,14762,14826,12843,14826,12811,12875,12875,12875,14956,14923,14923,14955,17036,19148,25455,31761,25422,19180,17068,14955,12875,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,8520,6310,6342,6310,6309,4229,4229,4196,4196,4196,4196,4228,4261,4261,4228,4228,4260,4260,4196,2148,2148,4228,4260,2148,2115,2147,2147,2115,2115,2115,2115,2115,2115,2148,2148,2148,2148,2115,2115,2115,2115,2115,2147,2148,2148,2148,6308,6341,6341,8454,10599,8390,8422,8422,4261,4261,4229,4229,4261,4261,4261,4261,6375,12843,14923,14956,14923,12843,12843,12843,12778,8487,8422,6342,6310,6310,6310,6310,6310,6309,6309,4261,6309,4229,4196,4196,4196,4261,4261,2148,2148,4293,10730,14923,12843,12843,10665,4261,4260,4260,4260,4293,4358,10730,10762,6439,2180,4228,4228,4358,10730,10698,8455,6374,4261,4228,4228,4229,4228,4229,4261,10633,10697,10697,10697,10697},
-	{2115,2115,2115,2115,2115,4196,8487,8520,8520,8520,8552,8520,6439,4261,8488,8520,8520,8520,8520,8520,8520,8520,8520,8552,8552,8552,8552,8552,8584,8585,8585,10633,10665,10665,10665,10665,10665,10665,10697,12778,12810,10698,10730,10730,10730,10730,10730,12810,12810,12810,12810,12810,12843,12843,12843,12843,12843,12875,14923,14955,17036,17068,17004,17036,17036,17036,19117,19149,19116,19149,19116,19116,19117,19117,21165,21165,21197,29422,39793,39760,25197,25196,41841,35567,37680,21132,10698,10730,10762,12745,12712,14923,8552,6439,4359,4261,4261,2213,2213,2213,2212,2212,2212,2179,2180,2180,2180,2180,4260,4260,2180,2180,2212,2212,2212,4260,4260,4260,2212,2212,4261,4293,4293,4293,4293,4293,4293,4293,4293,4228,4228,4228,6342,14632,14633,14632,14632,12584,12519,16681,16681,18729,18729,16681,18729,18729,18729,16681,16681,16681,16681,14794,12843,12843,12843,12843,12843,12843,12843,12843,12875,14956,14955,14987,17068,23374,33809,25422,19148,17068,14955,14923,12875,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,8552,6342,6342,6310,6310,4261,4229,4196,4196,4196,4196,4228,4261,4228,4196,4196,4228,4261,4228,4196,2148,2147,4228,4260,2147,2115,2115,2115,2115,2115,2115,2115,2148,2148,2148,2148,2147,2115,2115,2115,2115,2115,2148,2148,2148,2148,4228,6309,6341,6341,6341,8422,8422,8422,4261,4229,4229,4261,4261,4261,4261,4261,6374,12811,12843,12875,12875,12843,12843,12778,8455,6309,6309,6342,6342,6310,6310,6310,6310,6310,4261,4261,4261,4228,4196,4196,4196,4261,4260,2148,2148,2148,4293,12778,14923,12843,8585,4261,4260,4260,2212,2180,6406,12810,12778,6439,4228,2180,2180,6374,10698,8552,6374,4229,4228,4228,4228,4228,4228,4228,4261,10633,10665,10697,10665,10665},
-	{2115,2115,2115,2115,2115,4196,6439,8520,8520,8520,8520,8520,6439,4261,8488,8520,8520,8520,8520,8520,8520,8520,8520,8520,8552,8552,8552,8552,8552,8552,8584,8585,10633,10633,10633,8617,10665,10665,10665,10697,10698,10698,10698,10698,10730,10730,10730,10730,10762,10762,12810,12810,12811,12811,12843,12843,12843,12843,12875,14923,14923,17036,17036,14956,14956,17004,17036,19117,19117,17068,19149,17068,17036,19085,19117,19117,21165,21165,27342,31503,37712,37648,41841,43889,39760,21132,14923,12843,10730,10632,10599,14825,8584,8552,4358,4326,2180,2213,2213,2213,2212,2212,2180,2179,2180,2181,2181,2180,2212,2212,2180,2180,2212,2212,2212,4260,4260,4260,2212,2212,4293,4293,4293,4293,4293,4293,4293,4293,4293,4228,4261,4261,4293,10471,14633,14632,10536,8455,8391,16681,16681,16681,16681,18729,16681,16681,16681,16681,16681,16810,16745,14859,12843,12843,12843,12843,12843,12843,12843,12843,12843,14923,17068,17068,19148,27568,33841,21228,19116,17036,14923,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,10730,10665,10633,6374,6310,6309,4229,4196,4196,4196,4196,4228,4261,4229,4228,4196,4228,4229,4228,4196,2147,2147,2147,4228,4260,2147,2147,2147,2147,2115,2116,2148,2148,2148,2148,2148,2147,2115,2115,2115,2115,2148,2148,2148,2148,2148,2148,4228,4228,6341,6341,8421,8422,6341,4229,4229,4261,4261,4261,4261,4261,4261,6407,12811,12843,12843,12843,12843,12778,6439,6310,6310,4229,6277,6310,6310,6310,6309,6310,6310,4261,4261,4261,4196,4196,4196,4196,4228,2180,2148,2148,2148,2180,8584,12843,14923,8585,4261,4260,4260,2212,4228,6406,12810,12811,6407,4228,4228,2180,4261,8520,6407,4229,4228,4228,4228,4228,4228,4228,4228,4229,6407,10665,8649,10665,10665},
-	{2115,2115,2115,4163,2115,4196,6439,8520,8488,8488,8520,8520,6439,4261,8488,8520,8520,8520,8520,8520,8520,8520,8520,8520,8520,8552,8552,8552,8552,8552,8584,8585,10633,10633,10633,8617,8617,10665,10665,10665,10665,10730,12778,10698,10698,10730,10730,10730,10730,10762,10762,10762,10763,12811,12811,12843,12843,12843,12843,12843,12875,14923,17036,17036,14924,14956,14956,14956,14988,14956,17036,17069,17036,17036,17036,17036,19085,19085,19085,21165,25293,33519,41809,39792,27341,19084,17036,12810,8552,8519,8487,8519,8584,8584,4293,2245,4260,4261,2213,2213,2212,2212,2180,2180,2180,2181,2181,2180,2212,2180,2180,2180,2212,2212,2212,4260,4260,4260,2212,2213,2244,4292,4293,4260,4292,4293,4293,4293,4293,6309,4261,4261,4261,6406,18954,14728,8487,6440,8455,14633,16681,16681,16681,18729,16681,18729,16681,16681,14730,14859,14730,12811,12843,12843,12843,12843,12843,12843,12843,12843,12843,12875,17036,21229,25454,35890,27502,21261,19148,17036,14923,12875,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,10665,6374,6309,4229,4229,4196,4196,4196,4229,4229,4196,4196,4196,4228,4229,4228,4196,2147,2115,2148,4196,4260,6308,4228,4228,6341,4196,4196,2148,2148,2148,2180,2148,2115,2148,2147,2115,2115,2148,2148,2148,2148,2148,2148,2148,4196,4228,6341,6341,4261,4228,4228,4228,4261,4261,4261,4261,4261,6374,10665,12811,12843,12843,12843,12778,6439,4294,6310,6310,6309,4229,6310,8423,6342,6309,6310,6310,4262,4261,4229,4196,4196,4196,4196,2148,2148,2148,2148,2148,2180,8584,12810,12811,8585,4261,4260,4260,2212,4229,4326,10697,8617,4325,4228,4228,4228,2180,4261,4261,4228,4228,6341,4228,4228,4228,4228,4228,4229,4261,8585,8617,8617,10665},
-	{2115,2115,4163,2115,2115,4196,6407,8488,8488,8488,8488,8488,6439,4261,8488,8488,8488,8520,8520,8520,8520,8520,8520,8520,8520,8552,8552,8552,8552,8552,8584,8585,8585,10633,10633,8585,8617,10665,10665,10665,10665,10698,12778,12778,10698,10730,10730,10730,10730,10730,10762,10762,10763,12811,12811,12811,12811,12843,12843,12843,12843,12875,14923,17036,14956,14924,14956,14956,14956,14956,14956,14988,14956,14988,14956,17004,17036,19053,17037,19085,19084,21132,33551,29390,19052,17004,14956,12778,8519,8487,8487,8487,6471,6439,4326,2213,2213,2213,2213,2213,2213,2212,2181,2180,2180,2181,2181,2180,2180,2180,2180,2180,2212,2212,2212,4260,4260,4260,2213,2213,2212,2244,4293,4260,4292,4292,4293,4293,4293,6341,4261,4261,4261,4326,8519,6373,4358,4391,4261,10439,16681,16681,16681,18729,16681,16681,16681,16681,14762,12843,12811,12811,12843,12843,12843,12843,12843,12811,12811,12843,12843,14923,17068,21261,29680,35922,25422,23341,21229,17068,17036,14956,14956,14923,12875,12843,12843,12843,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12843,12843,12843,12811,10665,6374,6277,4229,4196,4196,4196,4196,4196,4164,4196,4196,4228,4229,4228,2148,2148,2115,2147,4196,4228,6276,6308,4228,4195,2115,4196,2148,2148,8519,10665,4293,4228,6406,8487,4228,4228,2148,2148,2148,2148,2148,2148,2148,4196,4196,4228,6341,4261,4228,4228,4228,4261,4261,4261,4261,4294,10665,12843,12811,12811,12843,12778,6439,4262,6310,6310,6310,6310,4229,6310,6342,8423,6310,4261,4261,4261,4229,4196,4196,4196,4196,4196,2148,2148,2148,2148,2148,2180,8584,12810,12811,8585,4261,4260,4260,2212,2212,4261,4293,4293,4293,4293,4228,4228,2180,2180,2180,4261,4228,4228,4228,4228,4228,4228,4228,4229,4229,6406,10633,10665,10665},
-	{2115,2115,4163,2115,4163,4196,6374,8488,8488,8488,8488,8488,8487,4261,8488,8488,8488,8488,8520,8520,8520,8520,8520,8520,8520,8520,8520,8552,8552,8552,8553,8553,8585,10633,8585,8585,8585,10665,10665,10665,10665,10666,10698,12810,12778,10698,10698,10730,10730,10730,10730,10730,10763,10763,12811,12811,12811,12843,12843,12843,12843,12843,12843,14923,17036,14956,12876,12876,12876,12876,14924,14924,14956,17068,14956,14956,14956,17004,17004,17004,17004,17004,21165,19084,17004,16972,12778,10599,8519,8519,8487,8486,4326,2245,4293,2213,2213,2213,2213,4261,2213,2213,2181,2181,2181,2181,2181,2180,2212,2212,2212,2212,2212,2212,2212,4260,4260,4260,2213,2213,2213,2213,4261,4260,4260,4292,4293,4293,4293,4293,4261,4261,4261,4326,4359,2213,4359,4360,2181,6342,14633,16681,16681,16681,16713,16810,16778,14730,14794,12843,12843,12811,12843,12843,12811,12811,12811,12811,12811,12843,12875,17004,19116,25390,38035,33809,29615,25454,21261,19148,19116,17068,17036,17036,14956,14923,14891,12843,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12778,8520,6310,4229,4229,4229,4196,4196,4196,4164,4196,4196,4228,4228,2148,2116,2148,2148,2115,2148,4229,4261,6373,6340,4195,2115,2148,4261,4261,8585,12811,10730,10730,10730,10762,10698,10697,4261,2148,2148,2148,2148,2148,2148,2148,2148,2148,4261,6341,4261,4228,4228,4229,4229,4229,4229,4293,10698,12843,12811,12779,10698,8488,6310,6310,6310,4262,6310,6310,6277,6278,6310,6342,8423,6342,4261,4229,4196,4196,2148,2148,2148,2148,2148,4228,2148,2180,2147,2180,8584,10730,10730,8552,4261,4260,4260,2212,2212,2212,2180,2180,4260,6341,4261,2180,2180,4228,4228,6407,4293,2180,4261,4293,4228,4228,4228,4228,4228,4229,6406,8585,8617},
-	{4163,4163,2115,4163,4163,4163,4228,8487,8488,8488,8488,6472,8488,8487,8488,8488,8488,8488,8488,8520,8520,8520,8520,8520,8520,8520,8520,8552,8552,8552,8553,8553,8585,8585,8585,8585,8585,10665,10665,10665,10665,10666,10698,10698,12811,12778,10698,10730,10730,10730,10730,10730,10763,10763,10763,10763,12811,12811,12811,12843,12843,12843,12843,12843,12875,14988,12876,12876,12876,12876,12876,12876,14924,14956,17037,14956,14956,14956,14956,17004,17004,17004,17004,16972,17004,14891,10600,8519,8519,8487,8486,6406,4293,2245,4261,2213,4261,2213,4293,6374,2213,2180,2212,2180,2181,2181,2180,2181,2213,2213,2212,2212,2212,2212,2212,4260,4260,2212,2213,2213,2213,2213,2212,2212,2213,4261,4293,4293,4293,4293,4261,4261,4261,4359,4457,4327,4359,4392,2181,4229,4295,12585,16714,16713,16714,14762,14730,14762,14762,12843,12811,12811,12811,12811,12811,12811,12811,12811,12811,12843,14923,17036,21197,27535,38003,38035,40116,35922,29583,27535,27503,25422,21196,19116,17068,17036,14923,12843,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,10666,6342,6310,6309,6309,4261,4229,4196,4196,4196,4196,4196,4196,4196,2148,2116,2116,2148,2115,2116,4294,12778,12778,12843,12778,4326,6407,10730,10730,12810,12811,12811,12811,12811,12811,12811,12778,4293,2115,2147,2147,2148,2148,2148,2148,2148,2148,4196,4228,4228,4228,4228,4229,4229,4261,4261,4261,8585,10763,12811,8520,6342,4262,6309,6310,6310,6310,4229,6277,6310,8358,6310,6309,6374,6374,6310,4228,4196,2148,2148,2148,2148,2148,4228,4196,2148,2148,2147,2180,8584,10730,10698,6439,4261,4260,4260,2212,2180,2180,2212,2180,4228,4261,6406,4326,2180,2180,2180,4261,4293,4228,2180,4228,4228,4228,4228,4228,4228,4228,4229,6439,10665},
-	{2115,2115,2115,2115,4163,4163,4196,6407,8488,8488,8488,6440,6440,8488,8488,8488,8488,8488,8488,8488,8520,8520,8520,8520,8520,8520,8520,8520,8552,8553,8553,8553,8553,8585,8585,8585,8585,10633,8617,10665,10665,10666,10698,10698,10698,12811,10730,10698,10730,10730,10730,10730,10730,10730,10730,10763,10763,10763,12811,12811,12811,12811,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12875,12875,14956,17036,14924,14924,14924,14924,14924,14924,14924,14924,17004,12778,8520,8487,8519,6406,4293,4326,4293,4293,4261,4261,2180,2213,2213,4261,2213,2180,2180,2180,2181,2181,2181,2213,2213,2212,2212,2212,2212,2212,2212,2212,2212,2212,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,4293,4293,4261,4261,4261,4326,4424,4326,2245,6537,2246,2148,2148,4326,10666,14827,16746,14794,14762,14762,14794,12811,12811,12811,10763,12811,12811,12811,12811,12811,12843,14923,17004,19116,25422,33809,27470,25422,29648,38003,35922,35922,35922,33842,29615,27535,27503,21229,17004,14923,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,10633,6342,6310,6309,4261,4261,4261,4196,4196,4196,4196,4196,4196,4196,2148,2148,2116,2148,2147,2116,4327,12811,12811,12811,14924,12779,12779,10763,10763,10763,10763,10763,12811,12811,10762,10762,10730,6439,4326,4293,2148,2148,2148,2148,2148,2148,2148,2148,2148,4228,4228,4228,4229,4229,4261,4261,4261,4294,10633,8552,4294,6309,4261,4261,6310,6310,6310,4229,4197,6278,8358,4261,4261,6309,6342,8390,6277,4229,4196,2148,2148,2148,2148,4229,6277,4196,2148,2147,2180,8584,10730,10730,8552,4261,4260,4261,2212,2212,2180,2212,2180,2180,4294,10633,10665,4293,4261,4293,2180,8455,6374,4228,2180,4228,4261,4228,4228,4228,4228,4228,6407,10633},
-	{4163,4163,2115,2115,2115,4163,4196,6407,8488,8488,8488,6440,6440,8488,8488,8488,8488,8488,8488,8488,8488,8488,8520,8520,8520,8520,8520,8520,8552,8553,8553,8553,8553,8553,8585,8585,8585,8585,8585,8617,10665,10665,10666,10666,10698,10698,12811,10730,10698,10730,10730,10730,10730,10730,10730,10730,10763,10763,10763,12811,12811,12811,12811,12811,12811,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,14956,17004,14924,12844,12843,12778,12778,12778,12778,12746,10632,10600,4326,6374,6374,4294,6374,4293,4293,4293,4261,2180,2213,2213,2213,2213,4261,4261,2213,2181,2180,2180,2212,2212,2213,2213,2212,2212,2212,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,4293,4293,4261,4261,4261,2245,2246,2246,4359,6602,4424,2213,2180,2148,8487,12746,14730,12779,12811,12811,12811,12811,10763,10763,10763,10763,10763,10763,10763,12811,14891,14956,17068,25390,31729,23342,21229,21197,21229,21261,23309,21229,21229,25422,35890,35922,40116,27503,17036,14923,12811,12811,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,12811,10633,6310,6310,6309,6309,6309,6309,4229,4196,4196,4196,4196,4196,4196,2148,2148,2148,2116,2115,2116,4327,12811,12811,12811,12811,12811,12811,12811,10763,10763,10763,10763,12811,12811,10763,10763,10763,12779,12779,8584,2148,2148,2148,2148,2148,2148,2148,2148,2148,2180,4228,4228,4229,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4229,4229,6278,8358,4261,4229,6309,4229,8390,8423,6310,6277,4196,2148,2148,2148,4196,6277,4229,2148,2147,2180,8552,10730,10730,8552,4261,4260,4261,2212,2212,2180,2180,2180,2212,8552,10698,10633,4293,4294,6374,2180,4261,8520,4261,4228,2180,4261,6341,4228,4228,4228,4228,6374,8552},
-	{4163,2115,2115,2115,2115,2115,4196,6407,8488,8488,6440,6440,6440,6440,6440,6440,8488,8488,8488,8488,8488,8488,8520,8520,8520,8553,8520,8520,8520,8553,8553,8553,8553,8585,8585,8585,8585,8585,8617,10665,10665,10665,10665,10666,10698,10698,10698,12811,12778,10698,10730,10730,10730,10730,10730,10730,10731,10763,10763,10763,10763,12811,12811,12811,12811,12811,12843,12811,12811,12843,12843,12843,12843,12843,12843,12843,14924,14956,12876,12811,10600,10600,10599,10567,10567,10600,10600,4326,4294,4294,4294,4293,4293,4293,4293,4261,2212,2213,2180,2213,2213,4293,6374,4261,2181,2181,2181,2213,2213,2213,2213,2213,2212,2213,2212,2213,2213,2213,2213,2213,2213,2213,2245,2213,4261,2213,2213,2213,4293,4293,4261,4261,4261,4261,2245,4326,6505,6603,4457,4359,4262,4262,4261,8488,14697,12779,10763,10763,10763,12811,12811,12811,12811,12811,12811,10763,10763,12843,14923,17036,23342,33777,25390,19148,19116,17036,17036,17036,19117,19149,19148,21229,23309,23341,35890,29616,19116,14956,12843,12811,10763,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,10698,8520,8520,8520,6374,4261,6309,4261,4196,4196,4196,4196,4196,4196,4196,2148,2148,2148,2115,4228,8520,10763,10763,12811,12811,10763,12811,12843,10763,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,8585,2148,2148,2148,2148,2148,2148,2148,2148,2148,2180,4228,4228,4229,4261,4293,4261,4261,4261,4228,4261,4261,4261,4261,4261,4261,4261,4261,4229,6310,8326,6310,4261,4228,4229,6277,6277,8391,8391,6310,6277,4228,2148,2148,4229,6277,4229,2148,2179,4325,10665,10730,10730,8552,4261,4260,4261,2212,2212,2180,2180,2180,2212,8552,10698,8585,4261,2180,2180,2180,2213,6406,6374,4228,2180,2180,4261,4293,4228,4228,4228,4228,8487},
-	{4196,4229,2115,4163,2115,2115,4196,6407,8488,8488,8488,6440,6440,6440,6440,8488,8488,8488,8488,8488,8488,8520,8520,8520,8520,8553,10633,8520,8520,8553,8553,8553,8553,8553,8553,8585,8585,8585,8617,8617,10665,10665,10665,10666,10666,10698,10698,10698,12779,10698,10698,10730,10730,10730,10730,10730,10730,10731,10763,10763,10763,10763,12811,12811,12811,12811,12811,12811,12811,12843,12843,12843,12843,12843,12843,12843,12843,14924,14924,10697,10600,10600,10599,10599,10568,8487,6406,4326,4294,4294,4326,4294,4293,4293,4293,2213,2213,2213,2213,2213,2213,2213,4293,6374,4261,2213,2213,2213,2213,2213,2213,2212,2212,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,4261,4261,4261,2213,2213,4261,2213,6309,6310,6310,4262,4262,2245,4327,4457,4425,4360,4327,4327,4262,6310,14633,12779,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,12843,17004,19116,31696,31696,21196,19116,17004,14924,14891,14923,14923,17004,17036,19116,21229,25389,35890,29648,21197,17036,14923,12811,12811,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10731,12779,12811,8585,6374,4261,6309,4261,4196,4196,4196,4196,4196,4196,4196,4196,2148,2148,2147,4228,8552,10763,10763,10763,10763,10763,12811,12844,12843,10763,10763,10763,10763,10763,10763,10763,10763,10763,12811,8584,2148,2148,2148,2148,2148,2148,2148,2148,2148,2180,4228,4228,2180,4229,4293,6374,4293,4261,4228,4261,4261,4261,4261,4261,4261,4261,4228,6277,8326,8326,6310,4261,4228,6277,6277,6277,6310,8391,6310,6310,4229,2148,2148,4228,4228,4228,2148,2180,8519,10730,10730,10730,8552,2213,4260,4260,2212,4261,6406,4294,6373,2212,8552,10698,8585,2213,4293,4293,2180,2180,4261,6374,4260,2180,2180,4228,4293,6341,4228,4228,4228,6342},
-	{4228,6342,4163,4163,2115,2115,4196,6407,8488,8488,8488,6440,6440,6440,6440,8488,8488,8488,8488,8488,8488,8520,8520,8520,8520,8520,8553,10633,8553,8553,8552,8553,8553,8553,8553,8585,8585,8585,8585,8617,8617,10665,10665,10665,10666,10666,10698,10698,10698,10698,10698,10698,10730,10730,10730,10730,10730,10730,10731,10731,10763,10763,10763,10763,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12811,12843,12811,12811,10828,12745,10600,10599,10599,10567,6439,4326,4326,4294,6406,6374,4326,4294,4293,4293,4293,2213,2213,2213,2213,2213,2213,2213,2213,4293,4261,2213,2213,2213,2213,2213,2213,2212,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,4261,6309,6309,4261,4261,4261,2213,6309,6310,6310,6310,4262,4261,4294,4424,6505,6538,4327,4261,2181,6310,14665,12779,10731,10730,10730,10730,10730,10730,10730,10730,10730,10731,10763,12843,17004,23342,38035,31696,19149,17036,14923,12811,12811,12811,12811,12811,14923,19117,21197,29615,35889,27535,23309,19117,17004,14891,12811,12811,10731,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,10731,10731,10731,10731,6439,4261,4262,4261,4229,4196,4196,4196,4196,4196,4196,4196,4196,2148,2148,2116,2115,4326,10730,10730,10730,10730,10730,10730,12811,12844,12811,10730,10730,10730,10730,10730,10730,10730,10731,10698,4326,2148,2148,2148,2148,2148,2148,2148,2148,2148,2180,4228,4228,2180,4261,4261,4293,6374,4293,4229,4261,4261,4261,4261,4261,4261,4261,4196,4229,6310,8326,6310,4261,4228,6310,6277,4229,6310,6278,6310,6310,4229,2148,2179,2148,2148,2148,2148,2148,8520,10731,10730,8617,6407,4261,2212,4261,4261,4261,6374,4293,4293,6406,8617,10698,8617,6406,6407,6407,2180,2180,2180,2180,4228,2180,2180,2180,4228,6341,6341,4228,4228,4229},
-	{4228,6342,4163,4163,2115,2115,4196,6407,6440,8488,8488,6440,6440,6440,6440,8488,8488,6440,8488,8488,8488,8488,8520,8520,8520,8520,8521,8553,8585,8553,8553,8553,8553,8553,8553,8585,8585,8585,8585,8585,8617,10665,10665,10666,10666,10666,10666,10698,10698,10698,10698,10698,10698,10698,10730,10730,10730,10730,10730,10731,10731,10731,10731,10731,10731,10763,10763,10763,12811,12811,10697,10632,10665,10697,12811,12811,10697,10665,8617,10632,8519,8487,10567,8487,4326,4326,4326,4326,4326,6439,4326,4293,4293,4293,4293,4261,4261,2213,2213,2213,2213,2213,2213,2213,2213,4326,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,4261,6309,6310,4262,4261,4261,2213,6309,6310,6310,6310,6310,4261,4293,4327,6505,6569,4294,4228,2148,4294,12617,10731,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,10731,12843,17004,21229,35890,31728,19149,17036,14923,12811,10731,10731,10731,10731,12843,17036,21229,31729,35889,27502,25422,23309,17068,14924,12843,12811,10731,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,8487,6309,6310,6309,4229,4196,4196,4196,4196,4196,4196,4196,4196,2148,2148,2116,2115,6342,10730,10731,10730,10730,10730,10730,10730,10763,10763,10730,10730,10730,10730,10730,10730,10730,10731,10665,2181,2148,2148,2148,2147,2148,2148,2148,2148,2148,2180,4228,4228,2180,4228,4261,4261,4293,6374,4261,4261,4261,4261,4261,4261,4261,4261,2148,4229,6310,6310,6310,6309,4228,6310,4229,4229,6310,6310,6310,6310,4229,2148,2147,2180,4228,4229,2148,2147,8520,10730,10730,8617,4261,4260,2212,6407,8552,8552,6439,4228,2180,8520,10698,8618,10666,8520,6407,8553,4293,2180,2180,2180,4228,4228,2180,4228,2180,4228,6341,6341,4228,4228},
-	{4228,6342,4163,4163,2115,2115,4196,6407,8488,8488,8488,8488,8488,6440,6440,6440,8488,8488,6440,6440,6440,8488,8520,8520,8520,8521,8521,8521,8553,8553,8553,8553,8553,8553,8553,8585,8585,8585,8585,8585,8585,8617,8617,8618,8618,10666,10666,10666,10698,10698,10698,10698,10698,10698,10698,10698,10698,10730,10730,10731,10731,10731,10731,10731,10731,10731,10763,10763,10763,10763,10633,10568,10568,10633,12811,10763,10664,10567,10567,8519,6406,6439,8519,6407,4326,4326,4326,4326,4293,4326,6439,4326,4293,4293,2245,4261,4229,2213,2213,2213,2213,2213,2213,2213,2213,4326,4326,2213,2212,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,4261,6309,6310,4262,4261,4261,2213,6309,6310,6310,6310,6310,4261,4261,2245,4326,4327,4262,4229,2180,4262,10633,10731,10731,10730,10730,10730,10730,10730,10730,10730,10730,10730,10731,12811,14956,17068,23309,33809,25422,17036,14923,12811,10731,10730,10730,10731,12811,17004,21229,33809,40116,38003,38035,35922,23310,17068,14955,12843,10731,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,10731,10730,10730,10698,10698,8487,6309,6310,6310,6277,4196,4196,4196,4196,4196,4196,4196,4196,2148,2148,2115,2115,2180,6472,10731,10730,10730,10730,10730,10730,10730,10730,12843,10763,10730,10730,10730,10730,10730,10731,10730,6471,2148,2148,2148,2115,2148,2148,2148,2148,2180,2180,4228,4228,2180,4228,4228,4261,4261,4261,4261,4261,4261,4293,4293,4261,4261,4261,4196,4229,6310,6310,6310,6277,4229,6310,4229,4229,6309,6278,6277,6310,6309,4228,2148,2148,4229,6277,2148,2147,8520,10698,10730,8617,4261,4260,2212,4326,8585,10698,8552,4260,2180,6472,8650,8618,10666,8520,6407,10666,8552,4261,2180,2180,4228,4228,4228,2180,4228,4228,4228,6341,4293,4228},
-	{4228,6342,4163,4163,2115,2115,4196,6407,8488,8488,8488,8488,8488,6440,6440,6440,8488,8488,6440,6440,8488,8488,8520,8520,8520,8521,8521,8521,8520,8553,8553,8553,8553,8553,8553,8585,8585,8585,8585,8585,8585,8585,8617,8618,10666,10666,10666,10698,10698,10698,10698,10698,10698,10698,10698,10698,10730,10730,10730,10731,10731,10731,10731,10731,10731,10731,10731,10731,10731,12779,10633,8552,8552,10633,10763,8714,8584,8519,8519,8519,4326,6439,8551,6407,4326,4326,4294,4294,4294,4293,4326,6439,4326,4293,2245,4228,4196,2213,2213,2213,2213,2213,2213,2213,2213,2213,4326,4326,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,4261,6309,6310,6310,4262,4261,4261,6309,6310,6310,6310,6310,4229,4261,4261,2245,4262,4262,4261,2181,4229,8650,10730,10698,10730,10730,10730,10730,10730,10730,10730,10730,10730,10731,12811,14923,17036,19148,33841,29616,19116,17004,14891,12779,10731,10730,10731,12811,17004,19149,31729,35922,31696,33776,40116,35890,21197,17068,14924,10731,10731,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,10666,8455,6375,6375,6342,6310,6310,6310,6277,4196,4196,4196,4196,4196,4196,4196,4196,2148,2148,2115,2115,2115,6374,10698,10730,10730,10730,10730,10730,10730,10730,10763,12844,10731,10730,10730,10730,10730,10730,10731,8584,2148,2148,2148,2115,2148,2148,2148,2148,2148,2180,4228,4228,2180,4260,4260,4261,4261,2180,4261,4261,4293,4261,4261,4293,4261,4261,2148,4229,6310,6310,6310,6277,4228,6310,6309,4261,6309,6278,6277,6310,6309,4228,2148,4228,6277,4229,2148,2148,8520,10698,8617,8585,4358,2212,4228,2180,4294,8617,8553,4228,2180,8488,10730,10665,10665,8520,6407,10666,8586,4326,2180,2180,2180,2180,2180,4228,4228,4228,4228,4228,4261,4261},
-	{4228,6342,4195,4195,2115,2115,4228,6407,6440,6440,6440,6440,6440,6440,6440,6440,6440,6440,6440,6440,8488,8520,8520,8520,8520,8521,8521,8521,8520,8553,10633,8585,8553,8553,8553,8585,8585,8585,8585,8585,8585,8585,8617,8618,8618,8618,10666,10666,10666,10698,10698,10698,10698,10698,10698,10698,10698,10698,10698,10731,10731,10731,10731,10731,10731,10731,10731,10731,10731,10731,10633,10599,8552,10633,10731,8585,4359,6374,6406,4326,4326,6407,8519,6406,4294,4294,4294,4294,4294,4293,4293,4326,6407,4293,4293,4228,4196,4261,2213,2213,2213,2213,2213,2213,2213,2213,2213,4326,4326,2213,2213,2213,2213,2213,4326,4326,2213,2213,2213,2213,2213,2245,2213,4261,6310,6310,6310,4262,2213,4261,4261,6310,6310,6310,6277,4196,4261,4261,4293,4293,4294,4262,4262,4261,10633,8617,6472,10730,10730,10730,10730,10730,10730,10730,10730,10730,10730,10731,12843,14956,19116,31729,31696,21229,19116,14924,12811,10731,10730,10730,12811,14924,19116,31697,33841,27502,27502,31696,38003,23310,17068,14923,12811,10731,10730,10730,10730,10730,10730,10730,10730,10730,10698,10698,10698,10698,10730,10666,6342,6310,6310,6310,6310,6310,6309,4229,4196,4196,4196,4196,4196,4196,4196,4196,4196,2148,2147,2115,2115,2148,6440,10665,10730,10730,10730,10730,10730,10730,10730,10763,12844,10731,10730,10730,10730,10730,10731,8585,4229,2116,2147,2115,2148,2148,2148,2148,2148,2180,4228,4228,2180,4260,4260,4261,4261,2180,4261,4293,6406,4261,4261,4293,4293,4261,2148,4229,6310,6310,6310,6277,4228,6310,6309,4261,6309,6310,6309,6310,6309,4228,2148,4229,4229,4229,2148,2148,8520,6439,4293,2245,4326,4293,2147,2148,4261,8585,8553,4228,2180,6407,6407,6374,6407,6439,6407,10666,8618,8553,4293,2180,2180,2180,4228,4228,4228,4228,4228,4228,4228,6341},
-	{4228,6342,4293,4261,2115,4228,6375,6408,6408,6408,6408,6408,6408,6440,6408,6408,6440,6440,6440,6440,6440,6440,6440,8488,8520,8521,8521,8521,8521,8521,8553,10634,8585,8553,8553,8553,8553,8553,8553,8586,8586,8586,8586,8586,8618,8618,8618,10666,10666,10666,10666,10666,10666,10666,10666,10698,10698,10698,10698,10698,10698,10699,10698,10699,10699,10699,10731,10731,10731,10731,10633,10567,10600,10632,10731,8553,4326,4326,4326,4326,4326,4326,6439,6406,4294,4294,4294,4294,4294,4293,4293,4293,4326,6406,4293,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,2213,4326,4326,4261,2213,2213,2213,4261,4261,2213,2213,2245,2245,2213,2245,2213,4261,6310,6310,6310,4261,2213,4262,4261,6310,6310,6310,4229,4229,4261,4261,4293,4293,4261,4294,4294,4262,6375,8520,6440,10699,10699,10699,10698,10698,10698,10699,10699,10699,10698,10698,12811,14924,17036,23309,35922,29616,21197,17004,12812,10731,10699,10699,10731,14891,17004,29616,31728,23341,23342,27502,40083,33809,17036,14923,12811,10699,10667,10666,10666,10667,10666,10698,10699,10699,8586,8586,8586,8586,10699,8618,6375,6310,6342,6310,6310,6310,4261,4196,4196,4196,4196,4196,4196,6276,6276,4196,4196,4196,2148,2148,2116,2115,2148,4228,8520,10698,10699,10699,10699,10699,10699,10699,10731,12812,10731,10699,10699,10699,10699,10731,8552,2148,2147,2115,4196,4196,4196,4196,2148,2180,4228,4228,2180,4260,4261,4261,4261,2180,4261,4261,6374,6342,4261,4293,4293,4260,2180,4229,6309,6310,6310,4229,4228,6309,6310,4261,6309,6310,6310,6309,6309,4228,2148,4229,6277,6277,2148,2147,6407,4293,2147,2148,4325,4326,2147,2147,4260,8585,8552,2181,4261,4261,2180,4260,6374,4261,6374,8586,8586,8586,8521,4293,2180,4228,4228,4228,4228,4228,4228,4228,4228,4229},
-	{4229,8520,8552,6439,4325,8519,8552,8584,8584,8584,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8617,8617,8617,8617,8617,8617,8649,8649,8649,10698,10698,10730,12811,10730,10730,10730,10730,10730,10730,10730,10730,12810,12810,10762,12810,12810,12811,12843,12843,12843,12843,12843,12843,12843,12843,12843,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12810,8584,10568,8520,10664,12875,8617,4359,4358,4326,4326,4326,4326,6406,6374,4294,4294,4294,4293,4293,4293,4293,4293,4293,4326,4325,2212,2212,2213,2213,2180,2213,2213,2213,2213,2213,2213,2213,2213,2213,6374,4326,2213,2213,2213,2213,2213,4261,4293,2213,2245,4261,2245,4261,6309,6310,6310,6310,4262,2213,4262,4262,6310,6310,6277,4196,4261,4294,4294,4294,4262,4261,4294,4294,4262,4262,4294,8520,12844,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,14956,17068,19181,31761,33842,21261,17068,14956,12843,12843,12843,12875,14956,14988,25455,27535,19148,21261,21261,27502,29648,17068,14956,12876,12844,10731,10699,10699,10699,10699,12811,12843,12843,12843,12811,12811,12843,12843,12843,10665,6342,6342,6310,6310,6310,4261,4196,4228,4196,4196,4196,6276,6276,6276,4228,4196,4196,2148,2148,2148,2147,2115,2115,4228,8520,8617,12843,12843,12843,12843,12843,12843,12876,14956,12843,12843,12843,10795,12843,8584,2148,2147,2115,2115,4196,4196,4196,4196,2180,4228,4228,4228,4260,4260,4260,4261,2180,4261,4261,4293,4293,4293,4261,4293,4260,2180,4229,6309,6310,6310,6342,4229,6309,6310,4261,6309,6310,6310,6309,6309,4228,2148,4196,6277,6277,4229,2148,4261,2180,2147,2148,4260,2180,2147,2147,6406,10698,8584,2180,6439,6407,2180,2180,4261,4293,6407,10698,10698,10698,10698,8584,4325,2180,2180,4228,4228,4228,4228,4228,4228,4228},
-	{4293,12810,12842,12874,12874,12907,12906,12906,12939,12939,12939,12971,12971,12971,12971,12971,15019,15019,15019,15019,15051,15052,15052,15052,15052,15052,15084,15084,15084,15084,15084,15116,15116,17164,17164,17164,17164,17165,17165,17165,17197,19277,19277,17197,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19309,19309,19309,19309,19310,21358,21358,21358,21358,21358,21357,21358,21358,21358,21358,12874,8519,8520,8519,12777,21326,12842,6439,6439,4326,4326,4326,4326,4326,4294,4294,4294,4294,4293,4293,4293,4293,4293,4293,4261,4228,4228,4196,4261,2213,2213,2213,2245,2213,2213,2213,2213,2245,2213,2213,4261,6406,4326,4293,2245,2213,2213,4261,6406,6374,4261,4261,4261,4261,6310,6310,6310,6310,4294,2213,4262,4262,6310,6310,6309,4196,4261,4294,4261,4261,4293,4293,4293,4294,4294,4262,4262,8520,14891,15020,17165,17165,17165,17165,17133,17133,17133,17133,17133,17133,17133,17165,17165,19212,19212,17164,17164,17165,17133,17133,17133,17133,17165,17164,17165,17165,17133,17165,19245,17164,17132,17132,17132,17133,17133,19245,17165,17132,17133,17133,17133,17133,17133,17133,17133,17132,17132,17132,17133,12875,6342,6342,6310,6310,6310,4261,4197,4197,4196,4228,6277,6276,6276,6276,6276,4228,4196,2148,4196,2148,2147,2115,4195,4195,4195,6373,14954,17132,17100,17100,17100,17100,17100,17133,19213,17132,17100,17100,17100,10729,2148,4196,2115,2115,4196,4196,4196,4228,2180,4228,4228,4228,4228,4228,4261,4261,2180,4261,2180,4261,4228,4261,4325,4293,2212,2180,4229,6309,6309,6310,8423,6310,6309,6310,4261,6309,6310,6309,6309,6309,4228,2148,4228,6309,6277,6277,4196,2180,2180,2147,2147,2180,4228,2147,2180,10729,14956,10729,2212,6439,6406,2180,2180,2180,2180,8519,14955,12875,12907,12907,14955,10664,2180,2180,4228,4228,4228,4228,4228,4228,4228},
-	{4293,10762,10826,12906,12907,12907,12939,12939,12939,12971,12971,12971,12971,12971,12971,13003,15051,15051,15051,15051,15052,15084,15084,15084,15084,15084,15084,15084,15116,15116,15116,17164,17164,17196,17229,17197,17196,17197,17197,17197,17197,17197,19277,19277,19277,19277,19277,19277,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19310,21357,21357,21357,21357,19341,19341,21390,12874,8519,8520,8519,12777,21357,12842,4326,6439,6439,4326,4326,4294,4294,4294,4294,4294,4294,4293,2245,4293,4293,4261,4293,4261,4260,4261,4228,2212,2213,2213,2213,2213,2213,2245,2213,4261,4261,4261,4261,4261,4293,6374,4293,2213,2213,2213,4261,4293,8455,6374,4261,4261,6310,6310,6310,6310,6310,4262,4261,4262,4262,6310,6310,6310,4229,4261,6310,4262,4262,4262,6310,4262,4294,4294,4262,4262,4262,4294,10762,17165,17165,17164,17165,17132,17132,17132,17132,17133,17133,17133,17132,17132,17132,17132,17132,17132,17132,17132,17132,17132,17133,17133,17132,17132,17132,17133,17132,17132,17132,17132,17132,17132,17133,17133,17133,17165,17132,17132,17132,17132,17132,17132,17132,17132,17132,17132,17132,17133,14987,8520,6342,6310,6310,6310,6309,4197,4197,4196,6277,6277,6276,6276,6276,6276,4228,4196,4196,4196,2148,2147,4196,4196,4196,4196,4163,6405,14954,17100,17100,17100,17100,17100,15052,17165,17165,15052,15052,15052,10729,2148,4228,4228,2148,4196,4196,4196,4228,4228,4228,4228,4229,4228,4260,4261,4261,2180,4228,2148,2180,2180,4260,6406,6374,4261,2180,6277,6309,6309,6309,6310,6309,6310,6310,4261,6309,6310,6310,6310,6309,4229,4228,6309,6309,6309,6309,4229,2180,2148,2148,2147,2180,4228,2147,2180,10729,14955,10729,2212,2180,2180,2180,2180,2180,2180,8551,14988,12907,12875,12875,12875,10729,6471,4293,4228,4228,4228,4228,4228,4228,4228},
-	{4293,10762,12874,12906,12906,12906,12939,12939,12939,12971,12971,12971,12971,12971,13003,13003,15051,15051,15051,15052,15052,15084,15084,15084,15084,15084,15084,15084,15116,15116,17164,17164,17164,17164,17197,19277,17197,17196,17197,17197,17197,17197,19245,19277,19309,19277,19277,19277,19277,19277,19277,19277,19309,19309,19309,19309,19309,19309,19309,19309,19309,19310,19309,19309,19309,19309,19309,19212,14954,10697,8519,8519,8519,10729,19278,12842,2278,4326,6439,6568,4488,4488,4455,4455,2310,4293,4293,2245,2245,2245,4293,4261,4293,4261,4261,4228,4196,4293,2245,2245,2212,2180,2213,2245,2213,4261,4261,4261,6310,6310,6310,2213,2245,2213,2245,2213,4261,6310,6342,6374,4293,4262,6310,6310,6310,6310,6310,6310,6310,6310,4262,6310,6310,6310,4229,6277,6310,6310,6310,6310,8358,6310,6310,6342,4294,4294,4294,4262,10730,12875,15020,17132,15085,17132,17132,17132,17132,17132,17132,17132,17132,17132,17132,17132,17132,17132,17100,15052,15052,15052,17132,19245,19277,19277,19277,19277,19277,19277,19245,19245,19277,17164,17100,17100,17100,15052,17133,17133,15052,15052,15052,15052,15052,15052,17100,17100,17100,17100,17100,12778,6342,6310,6310,6310,6309,4197,4196,4197,6277,6277,6276,6276,6276,6276,4228,4196,2147,2147,2148,2148,4196,4196,4196,4196,4196,4163,10632,17100,15020,15020,15052,15052,15052,15052,17100,17068,15020,15020,10729,2148,2148,4228,4228,4196,4196,4196,2180,4228,4228,4228,4261,4260,4261,4261,4228,2148,2148,2180,4261,4228,4229,4261,6374,6374,4229,6310,6309,6309,6310,6309,6310,8390,8390,4261,6310,6310,6310,6310,6310,6277,6277,6310,6309,6309,6309,6309,4228,2148,4229,2148,2147,4228,4228,2148,6471,12843,10697,4261,2180,2180,2180,2180,2180,2180,6471,14955,14988,12875,12875,12875,12875,12875,6471,2180,4228,4228,4228,2180,4228,4228},
-	{4293,10761,10826,12906,12906,12906,12939,12939,12939,12971,12971,12971,12971,12971,15051,13003,15051,15051,15052,15052,15084,15084,15084,15084,15084,15084,15084,15084,15116,15116,17164,17164,17164,17164,17164,17197,19277,17197,17197,17197,17197,17197,19245,19245,19309,19310,19277,19277,19277,19277,19277,19277,19277,19309,19309,19309,19277,19309,19309,19277,19309,19309,19277,19309,19277,19277,19309,17067,8519,8519,8519,8519,8519,10729,19277,10859,4488,6536,4552,6762,4714,4714,4682,4649,4552,4488,4520,4488,4455,4358,2245,4261,4293,4261,4261,4196,4196,4326,4358,2245,2213,2212,2213,2213,2213,4261,4261,4261,6310,6310,6310,4261,2245,2245,2245,2245,4293,6342,6310,4262,4326,6375,6310,6310,6310,6310,6310,6310,6310,6310,4262,6310,6310,6310,4229,4229,6310,6310,6310,6310,8358,6310,8358,8390,4262,4294,4262,4262,8520,6439,12907,17100,15052,15052,15052,15052,15052,15052,15052,15052,15052,15052,15052,15052,15052,15052,15052,15020,15052,15052,15052,17165,19245,19245,19245,19245,19245,19245,19245,19245,19245,17132,15020,15020,15020,15020,17100,17133,17100,15020,15020,15052,15020,15020,15020,15020,15020,15020,15052,10729,6310,6310,6310,6310,6309,6245,4197,4196,4228,6277,6276,6276,6276,4228,4196,4196,2148,2148,2148,2148,4196,4196,4196,4196,4196,4196,8584,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,10697,2148,2147,2115,4228,4197,4197,4197,4228,4228,4196,4228,4228,4260,4261,4260,2180,2148,2148,4260,4261,4228,4229,6309,6309,6374,6341,6310,6309,6309,6310,6309,6310,8390,8455,6374,6342,8390,6342,6342,6310,6310,6310,6310,6309,6309,6309,6309,4228,2148,4229,2148,2147,4228,4228,2115,4261,10762,10697,4261,2180,2180,2180,2180,2180,2180,6471,12843,12875,12875,12843,12843,12843,12843,10665,4293,4228,4228,2180,4228,4228,4228},
-	{6374,10762,10826,10826,12906,12906,12939,12939,12939,12971,12971,12971,12971,12971,13003,13003,15051,15051,15052,15052,15084,15084,15084,15084,15084,15084,15084,15084,15116,15116,17164,17164,17164,17164,17164,17164,17197,19277,17197,17197,17197,17197,17197,19245,19245,19277,19310,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,17164,10761,8616,8519,8519,8519,8519,8519,10729,19245,13004,6730,6730,6730,4649,6697,6698,4649,4617,4682,4681,4649,4681,4617,4390,2213,4261,4293,2213,4260,4196,2180,2213,4326,4358,2245,2213,4261,2245,2213,4261,4261,4261,6310,6310,6310,4261,2245,2245,2245,2245,4293,6342,6342,4294,4294,8455,6343,6310,6310,6310,6310,6310,6310,6310,4262,6310,6310,6310,4229,4229,6310,6310,8358,6310,6278,8358,8358,8358,6278,6310,6310,4262,4262,4326,12875,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15052,19245,19245,19245,19245,19245,19245,19245,19245,19245,19277,21358,19277,19245,17165,15020,15020,15020,15020,15020,15020,15020,10729,6310,6310,6310,6310,6310,6245,4197,4196,4196,4228,6276,6276,4228,4196,4196,4228,4196,4196,4196,2148,4196,4196,4196,4196,4196,6374,12842,15020,15020,15020,15020,12842,8519,8519,12810,14988,14988,14988,10697,2180,2147,2147,4196,6277,8358,4229,4228,4196,4196,4228,4228,4261,4261,4260,2148,2148,4261,4261,6309,4229,4229,6310,6309,6309,6342,8390,6309,6309,6310,6310,6309,6310,8422,10630,12678,12678,12678,10566,6310,6310,6309,6310,6309,6309,6309,6309,4228,2148,4229,2148,2147,2147,2147,2147,4261,10730,10697,4261,2180,2180,2180,2180,2180,2180,6471,12842,12843,12843,12843,12843,12842,12842,12842,10664,4293,2180,2180,4228,4228,4228},
-	{6341,10762,10826,10826,12906,12907,12939,12939,12939,12971,12971,12971,12971,15019,15019,15019,15084,15084,15052,15052,15084,15084,15084,15084,15084,15084,15084,15084,17132,17164,17164,17164,17164,17164,17164,17164,17165,17197,19277,17197,17197,17197,17197,17197,19245,19245,19277,19245,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,17197,10696,4325,6406,8519,8519,8519,8519,6600,8649,10794,8843,6762,4650,4552,4585,4585,6698,6697,4584,4649,4649,4584,4649,4617,2342,2245,2245,2245,2213,2180,4196,2212,2213,2245,4325,4261,2213,4293,4293,2245,4293,4261,4261,6310,6310,6310,4293,2245,2245,2245,2245,4294,6310,4294,4262,4262,6342,8455,6343,6310,6310,6310,6310,6310,6310,4294,6310,6310,6310,4229,6277,6310,4229,4229,6277,6310,8359,8358,6277,4197,8358,6310,4262,4262,4326,12875,15020,15020,15020,15020,15020,15020,15019,15020,15020,15020,14988,14988,15020,15020,15020,15020,15020,15020,15020,15020,15020,14988,14988,15019,15020,15020,15020,17100,17100,17100,17132,17132,17132,17132,17100,17101,17100,17133,19213,17133,17100,15020,14988,14988,14988,14988,14987,15020,10697,6310,6310,6310,6310,6310,6245,4197,4196,4196,4196,4196,4196,4196,4228,4228,6276,4228,4228,4228,4196,4196,4196,4196,4196,4196,8519,14988,14988,14988,14987,14955,10665,4196,4196,6374,12843,14988,14987,12842,10697,10697,10665,6309,4197,6310,6310,4197,4196,4196,4228,4228,4260,4261,4261,2180,2180,6309,6309,6309,6277,6309,6310,6309,6309,4261,8423,8390,6310,6310,6310,6310,6310,6342,12678,12678,10599,12678,12678,8390,6310,6310,6309,6309,6309,6277,6309,4228,2148,4229,2148,2147,2147,2147,2148,6374,10762,8649,2212,2180,2180,2180,2180,2180,2180,4293,8584,10762,10762,10762,12842,12842,12842,10794,12810,4325,2180,2180,2180,4228,4228},
-	{4325,12842,12939,10826,12906,12907,12939,12939,12939,12971,12971,12971,12971,15019,15051,15051,15052,15052,15052,15052,15084,15084,15084,15084,15084,15084,15084,15084,17132,17164,17164,17164,17164,17164,17164,17165,17165,17165,19245,19277,17197,17197,17197,17197,19245,19245,19245,19277,19310,19277,19277,19277,19277,19277,19277,19277,19277,19277,17197,17197,17197,17229,17197,19245,17164,6471,4325,8487,10632,8519,8519,6503,4617,6633,6601,6762,4714,4682,4617,4585,4585,4585,6698,6665,4520,4617,4520,4520,4552,4488,2278,2245,2245,2212,2148,4196,4260,2213,2213,2213,2213,2213,2245,2245,2245,4293,4294,4294,6310,6310,6310,4293,2245,2245,2245,4293,4262,6310,4262,4262,4262,4294,6343,8455,6343,4262,4262,4262,6310,6310,4294,6310,6310,6342,4229,4229,6310,6310,6310,6310,6310,8359,8358,4196,4197,8358,6311,4262,4262,4326,12875,19245,19245,19245,19245,19245,19245,15020,14988,14988,14988,14988,14988,15020,17133,15020,14988,14988,14988,14988,14988,14988,14988,14988,14988,14988,14988,14987,14987,14987,14987,17133,19245,19245,19213,14988,14988,14987,14987,15020,17101,14988,14988,14988,14987,14987,14987,14987,14988,10697,6310,6310,6310,6310,6310,6245,4197,4196,4196,4196,4196,4196,4228,4228,6276,6276,4228,4228,4228,4228,4196,4196,4196,4196,4196,8519,14988,14988,14988,12875,6407,6310,4197,4197,4229,12810,14988,12907,12907,12907,12908,12875,6342,4197,4229,6342,6310,4196,4196,4196,4228,4261,4261,4261,4228,4228,6309,6310,6310,6310,6310,6310,6310,6309,6309,6310,8423,8390,6310,6310,6310,6310,6342,10630,10599,12745,12679,12678,8390,6310,6310,6309,6309,6277,8390,8390,4228,2148,4229,2148,2147,2147,2147,2148,4293,12810,10664,2212,2180,2180,2180,2180,2180,2180,2180,4293,4326,4326,4326,10697,12778,12778,10730,6471,4260,4228,2180,2180,4228,2180},
-	{10729,12842,12874,12906,12906,12907,12939,12939,12939,12971,12971,12971,12971,12971,15019,15051,15051,15051,15052,15084,15084,15084,15084,15084,15084,15084,15084,15084,17132,17164,17164,17164,17164,17164,17164,17164,17164,17165,17165,19245,19277,17197,17197,17197,17197,17197,19245,19245,19277,19277,19245,19245,17197,17197,19245,19245,17197,10891,8778,8778,10891,13004,6729,8778,12971,6503,6439,8519,8519,8519,8519,6503,6762,6762,6730,4714,6795,4714,4617,4585,4584,4584,4585,4585,4649,4649,2504,4585,4552,4520,4358,2245,2245,2212,2148,2148,2148,2213,2180,2245,2213,2245,2245,2245,2245,4293,4293,4294,6310,6310,6310,4294,4293,2245,2245,4294,4294,6310,4262,4294,4294,4294,6310,6343,8456,6343,6310,4262,6310,6310,4294,6310,6310,6310,4229,4197,6310,6311,6310,6310,6310,8358,6277,4196,4197,8358,6310,6342,4294,4326,12842,17100,15052,15020,15020,15020,15020,14988,14988,14988,14988,14988,14988,14988,15020,14988,14988,14988,14988,14988,14988,14988,14988,14988,14988,14988,15020,15020,15020,15020,15020,15020,17100,17100,15020,14988,14988,14987,14987,14987,15020,17069,14988,14988,14987,14987,14987,14987,14988,10697,6374,6375,6342,6310,6309,6245,4196,4196,4196,4196,4196,4196,4196,6276,6276,6276,6276,4228,4228,4228,4196,4196,4196,4196,4196,8487,12907,12907,12907,10762,4229,4196,4197,4197,4229,10730,12907,12907,12907,12907,12907,12875,6342,4197,4197,6277,8390,6309,4229,4196,4229,4229,4261,4261,4228,4261,6309,6309,6309,6310,6310,6310,6310,6309,6309,6309,6310,8423,8390,6310,6310,6310,6342,12678,10630,12712,14854,12709,8390,6310,6310,6309,6310,6309,6310,6310,4228,4196,4229,2148,2147,2147,2147,2148,4228,4358,6438,4228,2180,2180,2180,2180,2180,2180,2180,2180,2180,2180,2180,4261,4261,4293,4293,4260,4228,4228,2180,2180,4228,2180},
-	{10794,10794,12842,12907,12907,12907,12907,12939,12939,12939,12971,12971,12971,12971,15019,15051,15051,15051,15052,17164,15084,15084,15084,15084,15084,15084,15084,15084,17132,17132,17132,17164,17164,17164,17164,17164,17164,17165,17164,17197,17197,17197,17197,17197,17197,17197,17197,17197,17197,19277,19277,19245,17197,17197,19245,19245,17197,8778,4617,6730,6665,6697,4617,4617,4617,6601,6471,6471,6503,6471,8519,6535,4746,4778,4714,4746,4746,4617,4585,4585,4552,4552,4584,2536,4681,2633,4584,4617,4552,4552,2310,2213,2213,2213,2148,2148,2148,2213,2180,2245,2245,2245,2245,2245,2245,4293,4294,4294,6310,6310,6310,4294,4294,4294,4294,4294,4294,6310,4262,4294,4294,4262,4262,4262,6343,8455,6342,4262,6342,6342,4294,6310,6310,6310,6310,6310,6310,6310,6310,6311,6310,6310,6310,4196,4197,8358,8359,8358,6310,6440,8681,17197,17197,14988,12939,12939,12907,12907,12907,12907,12907,12907,12907,12907,12907,12907,12907,12907,12907,12907,14987,12907,12907,12907,12907,17101,19213,19213,19213,19213,19213,19213,19213,17133,12939,12907,12907,12907,12907,12907,12907,14988,17068,14956,12907,12907,12907,12907,12907,12875,12843,12843,6407,6310,6309,6245,4196,4196,4196,4196,4196,4196,6276,6276,6276,6276,6276,4228,4228,4228,4228,4196,4196,4196,4196,8487,12907,12907,12875,6406,4197,4197,4197,4197,4229,10730,12907,12907,12875,10762,10762,10729,6310,6245,4197,4197,6277,6309,6309,4196,6277,6277,4261,4261,4228,4261,6309,6310,6310,6310,8390,8390,6310,6309,6309,6309,6309,6310,6310,6310,6310,6310,6342,10598,12710,12710,14789,12710,8422,6310,6310,6309,6310,6309,6277,6309,6341,4228,4229,2148,2147,2147,2147,2148,4228,2212,2212,4228,4260,2180,2180,2180,2180,2180,2180,2180,2180,2180,2180,2148,2148,2180,2180,4228,4228,2212,4228,2180,2180,4228},
-	{10762,10794,12842,12874,12874,12907,12907,12907,12939,12939,12939,12971,12971,12971,12971,12971,15019,15051,15051,15052,17164,15084,15052,15084,15084,15084,15084,15084,17132,17132,17132,17196,17196,17197,17164,17132,17164,17165,17164,17164,17164,17132,15051,17164,19277,19277,19277,19277,19277,19277,21358,17197,15084,15052,15052,15052,17165,8810,4585,4617,4617,4617,4617,4617,2504,4585,6504,6471,6568,6568,8584,6665,4778,4746,4681,4746,4649,4552,4584,4584,4455,2342,4584,2536,4681,4713,4616,4649,4552,4552,2310,4261,2180,2213,2148,2148,2148,2213,2180,2245,2245,2245,2245,2245,4294,4294,4294,4294,4262,6310,4294,4294,4294,4294,4262,4294,4294,4262,4262,4262,4262,4262,4262,4262,4262,6375,8456,6343,4294,4294,4294,4294,6310,6342,4261,2148,4196,4261,6310,6310,6277,6277,6310,4197,4197,8359,8359,8359,8359,8391,6569,17133,19245,17133,12907,12907,12907,12907,12907,12907,12907,12907,12907,12907,12907,12907,12907,12907,12907,12907,15020,14987,12907,12907,12907,12907,12907,12907,12907,12907,14988,15020,15020,15020,15020,14988,14988,15020,15020,15020,14988,12907,14988,14988,12907,12907,12907,12907,12907,12907,12907,12875,6407,4261,6309,6277,4197,4196,4196,4196,4196,6277,6276,6276,6276,6276,6276,6276,4228,4228,4228,4196,4196,4196,4196,8487,12907,12907,12843,6342,4197,4197,4197,4197,4229,8584,10729,10729,8551,4228,4228,4196,4196,4197,4197,4229,6277,4197,8390,6310,6277,6277,4261,4261,6309,4261,6309,8423,10537,6310,10534,8422,6310,6309,6309,6310,6310,6310,6310,6310,6310,6310,6310,8390,8422,8454,8454,8455,8455,6310,6309,6309,6309,6309,6277,6309,4228,2148,6309,2148,2147,2147,2147,2180,4260,2212,2180,4261,6341,4228,2180,2180,2180,2180,2180,2180,2180,2180,2180,2180,2180,2180,2180,2212,2212,2180,4228,2212,2212,4228},
-	{10762,10794,10794,12842,12874,12874,12907,12906,12971,15052,15051,15084,15084,15084,15084,15084,15116,17164,15052,15051,15052,17132,15052,15052,15052,15084,15084,17132,17197,17164,15084,19309,21390,19309,17164,17132,17132,17132,17132,17164,17164,12939,4552,15084,21422,21390,19309,21390,21422,21390,21390,12971,6698,6665,6665,6665,13003,8810,4585,4585,6665,6698,4617,4617,4585,4585,6600,6471,4552,6568,6439,6665,4811,4746,4584,4649,6729,6665,4584,4584,4455,2278,4488,4488,4681,4681,4616,4648,4552,4552,2310,2180,2180,2213,2148,2148,2148,2213,2180,2245,2245,2245,2245,2245,4359,4326,4294,4294,4294,4262,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,6375,6375,4294,4294,4294,4294,6310,6342,4229,4228,4228,4229,6310,6310,6310,6310,6310,4197,4197,8358,8359,8359,8359,8391,6536,12875,14988,15020,12875,12875,12875,12875,12875,12875,12875,12875,12875,12907,12907,12907,12875,12875,12875,12875,12907,14988,12908,12875,12875,12875,12875,12875,12907,14988,17133,19245,19245,19245,17133,17133,17133,17133,17133,17133,17101,12907,12875,12875,12875,12875,12875,12875,12875,12875,12875,12843,6407,4261,6309,6277,4197,4196,4196,4196,4196,6277,6276,6276,6276,6276,6276,6276,4228,4228,4228,4196,4196,4196,4196,8487,12875,12907,12843,6342,4197,4197,4197,4197,4197,4196,4196,2147,4196,6245,4197,4164,4164,4197,4229,6277,6277,6277,6277,8423,6342,6277,4261,4261,6309,4261,6309,8391,10504,6309,6342,6310,6310,6309,6309,6310,6310,6309,6309,6309,6309,6310,6310,6310,6342,6342,6343,6342,8423,8423,6310,6309,6309,6309,6309,4228,2147,2180,8390,4228,2147,2147,2147,2180,2212,2212,2180,2180,4293,6341,4260,2180,2180,2180,2180,2180,2180,2180,2180,2180,2180,2180,2180,2212,2212,2180,4228,2212,4228,4228},
-	{10762,10762,10794,12842,12874,15019,17132,15084,15084,17165,17165,17197,17197,17197,17197,17229,17229,17197,15084,15051,15051,15052,15052,17100,15052,15052,15052,17164,19278,17197,15084,15084,17132,17132,17132,17132,17132,17132,17132,17132,17164,12939,4552,8778,15084,12971,6697,10891,13004,17165,17133,8746,6698,6698,4585,4585,4616,4617,4585,4585,4617,4585,4585,4585,4585,4585,4552,6504,4553,4488,4293,4552,6859,4745,4519,4584,4648,6665,6665,4552,4390,4261,6342,4326,4520,4649,2503,4616,4552,4552,2310,2180,2180,2213,2148,2148,2148,2213,2180,2245,2245,2245,2245,2245,2245,6407,6375,4294,4294,4262,4294,4294,4262,4262,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,6310,6342,4229,4229,4229,4262,6311,6310,6310,6311,6310,4197,4197,8358,8359,8359,8359,8391,10762,14988,15020,15020,12907,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,14988,12907,12875,12875,12875,10827,12907,17101,17101,17101,17101,17101,14988,10827,10827,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12843,6407,4261,6309,6277,4197,4196,4196,4196,4196,4228,6276,6276,6276,6276,6276,6276,4228,4228,4228,4196,4196,4196,4196,8487,12875,12907,12875,6342,4197,6245,6245,6245,4197,6277,8519,8486,4196,6245,4197,4196,4196,4229,6277,6277,6277,6277,6277,6310,8422,6309,4261,4261,4261,6309,6309,6310,6310,6310,6310,6310,6309,6309,6309,6310,6309,6309,6310,6310,6310,6310,6309,6310,6342,8486,10566,8454,6342,8423,8423,6310,6309,6310,6309,4228,2147,2148,4229,2148,2147,2147,2148,2180,2212,2180,2180,2180,2180,4293,4293,4228,2180,2180,2180,2180,2180,2180,2180,2180,2180,2180,2180,2212,2212,2180,4228,4260,4229,4229},
-	{10762,10762,10762,10794,12874,15020,15084,17165,15084,12907,12939,12939,12939,12939,12971,15019,15019,15019,15019,15019,15019,15019,17100,17132,15052,15052,15052,15052,15052,17164,19245,17132,17100,17100,17132,15052,15052,17197,19277,19277,19277,13003,4552,4552,8778,6665,4552,4552,6697,10891,10891,6665,4617,6698,6697,4617,4585,4585,4617,4585,4585,4585,4585,6665,4617,4585,4520,4423,4488,4423,4293,2374,4746,4746,4649,4681,4616,4552,6665,4488,2180,4229,6342,6342,6374,4487,2439,4616,4552,4552,4358,2180,2180,4261,2148,2148,2148,4261,2180,2245,2245,2245,4293,2245,2245,4326,8455,6375,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4295,4294,4294,4294,6342,6342,4229,2148,4196,6309,6310,6310,6310,6311,6311,4229,4197,8358,8359,8359,8359,8423,17068,19246,19213,17100,12939,12875,12875,14988,12875,12875,12875,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12875,12907,12843,12843,12843,12843,12843,12843,12843,12843,12843,12875,15020,15020,15020,15020,12907,10795,10795,10795,10795,10795,12843,12843,12843,12843,12843,10795,10697,10730,6407,4261,6309,6277,4197,4196,4196,4196,4196,4196,4228,6276,6276,6276,6276,6276,4228,4228,4228,4228,4196,4196,4196,6341,10762,15020,17068,8455,4197,4197,6245,4197,4197,6310,14955,12810,4228,4197,6277,6374,4229,4229,6277,6277,6277,6277,6277,6277,6309,6277,4261,4261,4261,6309,6309,8390,8423,6342,8454,8421,6310,6310,6310,6309,6310,6310,6309,6277,6309,6277,6310,6310,8422,12710,12742,12678,6342,6310,8423,8423,6310,6309,6309,4229,2147,2148,4229,2148,2180,4260,2180,4260,2212,2212,2212,2212,2180,2180,4293,4293,2212,2180,2180,2180,2180,2180,2180,4228,2180,2180,2180,2212,2212,2180,4228,4228,4229,6277},
-	{10729,10762,10762,10794,12842,12842,12874,12906,14987,14987,12907,12939,12939,12939,12939,12939,14987,15019,15019,15019,15019,15019,15019,15052,17132,15052,15052,15052,15052,17164,19277,19245,17132,17100,15052,15019,15020,17197,19277,19277,19277,13003,4552,4552,4553,4584,4552,4584,4520,4424,4456,4456,4553,4617,6665,4552,4585,4585,4585,4585,4584,4584,4585,6665,6698,4617,4487,4358,4391,4260,4228,2212,4648,4746,6698,6730,4616,2472,4584,4520,4293,4229,6342,6342,6310,4294,4390,4488,4584,4552,2277,2148,2180,4261,2148,2148,2148,4228,2180,2213,2245,2245,2246,2246,2246,2246,4326,6375,4294,4294,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4294,4294,4229,2148,2148,4262,6310,6310,6310,6310,6342,6407,6439,10665,10665,10666,10666,12778,14988,15020,14988,12843,10795,10795,12875,14988,12875,10795,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,10795,10795,12842,10794,12842,12843,12843,10795,12907,15020,15020,14988,12875,15020,15020,15020,12875,10795,10795,12875,15020,15020,15020,15020,15020,15020,15020,15020,10632,8422,6342,4261,6309,6277,4197,4196,4196,4196,4196,2148,4228,6276,6276,6276,4228,4228,4228,4228,4228,4228,6244,6244,4196,4261,10697,14859,12713,8423,6310,4197,4197,4197,4197,6309,10730,10665,6277,4197,6277,8585,6342,6277,6277,6277,6277,6277,6277,6277,6277,6309,4261,4261,4261,6309,6309,8423,10537,6342,12645,8454,6310,6310,6310,6309,6310,6310,4229,4196,4229,4228,6310,6310,8422,12710,10630,12678,6342,6310,6310,8390,6310,6309,6310,4229,2148,2148,4229,2148,4228,6373,4293,2212,2213,2213,2212,2212,2212,2212,2212,4293,4293,2212,2212,2212,2180,2212,2212,2212,2212,2212,2212,2212,2180,4228,4228,4229,6277,6277},
-	{10729,10729,10762,10762,10794,12842,12874,12874,12907,14987,12939,12939,17100,14987,12939,12939,14987,12939,12971,15019,15019,15019,15019,15019,15052,17132,15052,15020,15019,17132,17132,17164,17164,17132,17165,15052,12907,8745,8778,15020,15052,10859,4552,4552,4553,4552,4455,4488,6407,6343,6343,6343,6440,4488,4520,4553,4520,4552,4584,2536,2536,4552,4520,4584,4649,6730,4520,4293,4326,2180,2180,2212,4552,4713,4617,6762,4616,2471,4584,4520,4293,6342,6342,4294,6310,6310,6342,6374,4456,4455,4261,2148,2180,4261,2148,2148,2148,2148,2148,2181,2245,2245,2245,2245,2246,2246,4294,4294,4294,4294,4294,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4294,4294,4229,2148,2148,4262,6310,6310,6310,6342,4262,8553,10827,15020,15021,12908,10795,10827,12842,10794,10795,12843,12843,10795,10795,10795,10795,10795,12843,12843,10795,12843,12843,12843,12843,10795,10763,10795,10795,10762,10794,10794,10794,12875,12843,10794,10794,10762,12875,14988,14988,14988,12843,10795,10794,10794,10794,10795,10795,12875,14988,14988,14988,14988,14988,15020,17165,19245,14987,12777,6406,4261,4261,4261,4229,4228,4196,4196,4196,2148,4228,6276,6276,6276,6276,6276,4228,4228,4228,4228,4196,4196,4261,8584,10665,6310,4197,6245,6310,4197,4197,4197,4197,6309,10665,6407,4229,6245,6277,6375,6310,6277,6277,6277,6277,6277,6277,6277,6309,6309,4261,4261,4261,6309,6309,8390,8423,6342,12678,8486,6310,6310,6309,4229,6277,4229,2148,4228,4228,4228,6310,6310,8422,12709,10598,10566,6342,6310,6310,6310,6309,6310,6309,4229,2148,2148,4229,4228,4260,4293,6374,4293,2212,4261,4260,2212,2212,2212,4228,2180,4293,4293,4260,4260,2212,2212,2212,2212,2212,2213,4229,4229,4229,4229,4229,6277,6277,6277},
-	{10729,10729,10762,10762,10794,12842,12842,12874,12874,12907,15019,12939,15020,12939,12939,12939,14987,12939,12939,15019,15019,15019,15019,15019,15019,15052,17132,15052,15019,17132,17132,15052,17132,15084,17132,15052,8746,4520,4552,12972,12972,6665,4552,4552,4552,4520,4391,6472,6342,6343,6343,6343,6343,6375,6407,6440,4391,4488,2504,2536,4584,4456,4359,4520,4585,4682,6600,4261,4261,2180,2180,2180,4423,4681,4584,4649,4649,4552,4584,4487,4261,8423,6375,4294,6342,6310,6342,6342,4294,4261,4196,2148,2180,2213,2148,2148,2148,2148,2148,2180,2245,2213,2213,2245,4294,4294,4294,4294,4294,6407,6375,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4294,4294,4261,2148,2148,6310,6342,6342,6342,4262,6375,6407,12875,12908,10763,10795,12875,10827,15020,17100,17068,17100,17100,17068,12875,10794,10794,10795,10795,10795,10795,10795,10763,10763,10795,10795,10795,10795,10795,10794,10794,10794,10794,12875,12907,12843,10762,10794,10762,10762,10763,10763,10794,10795,10795,10795,10795,10795,10795,10794,10794,10762,10763,10763,10794,15020,17165,19213,19213,17165,8519,4261,4261,6374,6374,4229,4196,4196,4196,4196,4228,6276,6276,6276,6276,6276,4228,4228,4228,4228,4228,4293,10697,10697,6342,4229,4229,6245,4197,4197,4197,4197,4197,6277,6342,6277,4229,6245,6277,6277,4229,6277,6277,6277,6277,6277,6277,6277,6309,6309,4261,4261,4261,6309,6309,6310,6310,6342,12678,10534,6310,6310,6309,4228,4229,4228,2179,2179,4228,4228,6310,6310,8422,12710,10631,10566,6342,6310,6310,6310,6309,6310,6309,4228,2148,4228,4228,4260,4261,4261,4293,6374,4293,4260,4260,4261,2212,4260,2180,2147,2147,4293,6341,4260,4261,2213,4260,4228,4229,4229,4229,6277,6277,6277,6277,6277,6277,6277},
-	{10729,10730,10730,10762,10794,12842,12842,12874,12874,12875,12907,15020,12939,12907,12939,12939,12939,12939,15019,15019,15019,15019,17132,19277,15084,15019,17100,17132,17132,19277,19309,19309,17197,8713,6632,6665,6600,4488,4552,12907,8681,4520,4520,4520,4423,4488,6375,6375,6343,6342,6342,6342,6343,6343,6342,6343,6343,6536,4584,4584,4488,6375,6342,6375,6407,6472,6536,6342,4228,2148,2148,4228,4294,4456,4488,4488,4584,6632,4584,4487,2213,6342,8456,6375,4294,4294,6342,6342,4229,4261,4228,2148,2180,2213,2148,2148,2148,2148,2148,2148,2213,2245,2245,2246,4294,4294,4294,4294,4295,4327,8488,6375,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4294,4294,4294,4261,2180,2212,12778,8585,6473,8553,6504,8585,6505,8650,10730,12875,12908,10795,8682,12875,12907,12907,12907,12907,12907,12843,10763,10762,10763,10763,10763,10763,10763,10763,10763,10763,10763,10795,14988,15052,15052,15020,15020,15020,15020,17101,17101,10794,10763,10762,10762,10794,10794,10762,10762,10763,10763,10763,10763,10762,10763,10763,10763,10763,10762,10794,12875,12875,15020,17133,17133,8584,4294,4262,8520,12811,10730,6406,2148,4196,2148,2148,4228,4228,6276,4228,4228,4228,4228,4228,6308,6471,10762,12843,6375,6245,4197,4197,6245,4197,4197,6310,6310,4197,4197,4197,6245,4229,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6309,4261,6309,6309,6309,6309,8391,10504,6310,12646,8454,6310,6310,6309,4229,4229,4228,2148,2148,2148,2148,4229,6310,8422,12710,14789,12678,8390,6310,6310,6310,6309,6310,6310,4229,2148,4229,4228,4260,4261,4261,2213,4293,6374,4261,4260,4260,2180,2148,2147,2147,2147,2148,4293,4293,2212,2212,2212,4229,4229,6277,6277,6277,6277,6277,6277,6277,6277,6277},
-	{10729,10729,10730,10762,10762,10794,12842,12842,12842,12875,12874,12907,12907,12907,12907,12939,12939,12939,17132,19245,19245,19245,17165,15052,15020,15020,15020,17100,17132,19277,21390,21358,15052,6600,6536,8552,6439,4326,6504,6439,6375,4294,2245,4261,4294,4456,6375,6310,6342,6342,6342,6342,6342,6342,6342,6343,6343,6375,6568,4552,4359,6342,6342,6342,6342,6342,4261,4261,4261,2180,2148,2180,6310,6343,6375,6375,4423,4487,6697,4520,2213,6342,6343,8455,6375,4294,4262,6310,4229,2180,2180,2148,2180,2213,2148,2148,2148,2148,2148,2148,2180,2245,2245,4294,4294,4294,4294,4294,4295,4295,6472,8488,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4295,4294,4294,4294,4294,4294,4294,4261,4358,6535,14988,12843,8586,10698,12876,12844,8650,8585,8617,8650,8650,8586,8585,10730,10763,10763,10762,10762,10762,10763,10763,10762,10762,10762,10762,10762,10762,10762,10762,10762,10763,10763,12875,12875,12875,12875,12875,12875,12875,12875,12875,10762,10763,10762,10762,10762,10762,10762,10762,12843,12843,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10763,10795,12875,12843,6536,6472,8520,8553,8650,12875,12843,4326,4229,4261,4260,4261,4261,6309,6309,6309,6309,6309,6309,8584,12875,12908,10730,4229,6245,4197,6245,4197,4197,4197,6277,8390,6310,4229,4229,4229,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6309,6309,6309,6309,6309,6309,6310,8391,6310,8421,8390,6310,6309,6309,6309,6309,6277,4229,6309,4228,2148,4196,6309,8422,12709,12709,8454,6342,6310,6309,6309,6310,6310,6310,4229,2148,4229,2180,4261,4261,4260,4261,2213,4293,6374,4260,2180,2147,2147,2147,2147,2180,2147,2148,2180,2148,2180,4260,4229,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277},
-	{10697,10729,10729,10729,10762,10762,12810,12842,12842,12842,12874,12874,12907,14987,12907,12907,12907,12939,12971,15020,15019,15019,15019,14987,14987,14988,15019,15020,17133,19245,15052,15052,12907,4552,6471,8455,8455,6310,6343,6311,6311,4262,4196,4196,6310,6472,6375,6342,6342,6342,6342,6343,6342,6342,6342,6310,6342,6342,6536,6600,6343,6343,6342,6310,6342,6310,4196,2180,4261,4261,2148,2180,4294,4295,6310,6310,4294,4455,4585,6601,4293,4294,4294,6343,8456,6375,4262,2180,2148,2148,2148,2148,2180,2180,2148,2148,2148,2148,2148,2148,2181,2245,2245,4294,4294,4294,4294,4294,4295,4295,4327,4327,4295,4295,4295,4295,4295,4295,4295,4295,6375,6408,4295,4295,4295,4295,4327,4327,4327,4359,4295,4294,4294,4294,4294,6504,6601,8682,8650,8618,8618,8618,8618,8585,8585,8585,8585,8585,8585,8617,10730,10763,10795,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10763,10763,10762,10762,10762,10795,10795,12843,12843,12843,10794,12843,12875,10794,10795,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10763,10763,10762,10762,8617,8585,8585,8585,10762,12940,14988,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12843,10698,8618,8650,8618,8520,6277,4261,4229,6245,4197,4197,4197,4197,6277,8390,6310,4229,6277,6277,6277,6277,6277,6277,6277,6310,6277,6277,6277,6277,6277,6277,6309,6309,6310,6309,6310,6309,6309,6309,6310,6310,6310,6309,6309,6310,4229,4229,6277,4197,6277,4196,2148,4228,6310,6342,8422,8422,6342,6342,6310,6309,6309,6310,6310,6309,4228,2148,2148,2180,4261,4261,4260,4261,4261,2213,4293,6373,2147,2147,2147,2147,2147,2147,2147,2147,2147,2147,2180,2180,6277,6277,6277,6277,6277,6277,6277,6277,4197,4196,4228},
-	{10697,10697,10729,10729,10762,10762,10762,10794,12842,12842,12874,12874,12874,12907,12907,12907,12907,12907,12907,12907,12939,12939,12939,14987,14987,14987,15019,17132,15019,15019,14987,14955,8552,6504,6342,6310,8423,8391,6310,6310,6310,6310,4229,2148,6310,6343,6310,6342,6342,6310,6342,8456,8423,6342,6310,6342,6310,6342,6407,6536,6343,6342,6310,6310,6342,6310,2180,4196,4228,2180,4228,4228,6310,4294,4294,6310,4294,4423,4520,4488,4326,4294,4294,4294,6343,8455,4261,2148,2148,2148,2148,2180,6341,4228,2148,2148,2148,2148,2148,2148,2180,2213,2148,4262,4294,4294,4294,4295,4295,4295,4295,4295,6375,8456,4295,4295,4295,4295,4327,4294,4295,4295,4295,4295,4295,4295,6440,8585,10698,12875,6440,4294,4294,4295,4294,10697,12939,12907,12875,12875,10730,8585,6537,6537,8585,8585,8585,8585,8585,8650,10762,12843,14956,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10763,10762,10762,10795,15020,15020,15020,15020,17133,17133,15020,12907,17068,17068,12875,12843,12843,12843,12843,12843,12843,12875,12843,12843,12843,12843,12843,10762,10762,10762,10762,10762,10730,10762,10730,8585,6505,8618,12875,12907,12907,12907,12907,12907,12907,12907,12907,12907,12907,12907,12907,12908,10827,12843,10795,8585,6440,4229,8488,8455,4229,4229,4229,4229,4229,4197,6277,6277,6277,6277,6277,6277,6277,6277,6277,6310,8390,6277,6277,6277,6277,6309,6309,6309,6310,6310,6310,6310,6309,6309,6310,6310,6310,6309,6309,6310,6309,4228,4229,6277,4229,4229,2148,2148,4229,6310,6310,6310,6310,6310,8390,8423,6310,6310,6310,6309,4229,2148,2148,2148,2180,4261,4261,4260,4261,4261,4261,4260,4260,2148,2180,2147,2147,2147,2147,2147,2147,2147,2147,4292,4260,6277,6277,6277,6277,6277,6277,6277,6277,4196,4228,6471},
-	{10697,10697,10729,10729,10730,10762,10762,10762,12842,12842,12842,12842,12842,12874,12907,14987,12907,12907,12907,14955,12907,12907,12907,12907,12907,14987,14987,15019,15020,15052,15052,14988,8487,6440,8391,6310,6310,6342,8391,6310,6310,6342,4261,2148,4229,6310,6310,6342,6342,6342,6342,6343,8456,6375,6310,6342,6310,6310,6343,6472,6342,6310,6342,6342,6342,6310,2180,2148,2148,2148,4293,4229,4262,4294,4294,4294,4294,4294,4295,4294,4229,4294,4294,4294,4294,6342,4293,2180,2148,2148,2148,4229,4261,6341,4228,2148,2148,2148,2148,2148,2180,2213,2148,4262,4295,4295,4295,4295,4295,4295,4295,4295,4295,6375,8456,6343,4295,4359,4423,2246,4294,4295,4295,4327,4295,4295,4295,8585,12940,12875,6472,6375,6375,6375,6375,8650,12875,12843,8617,8585,8585,8585,8585,6537,6537,6537,6537,6537,8585,10730,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10763,10762,10794,15020,15052,15052,15020,14988,12875,14988,15020,15020,15020,15020,15020,15020,17101,17101,15020,15020,15020,15020,12843,10762,10762,10762,10762,10762,10762,10730,8585,6505,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,6537,6537,6440,4229,8455,6375,4197,4229,4229,4229,4229,4229,4229,6277,8390,6309,6277,6277,6277,6277,6277,6277,6309,6277,6277,6277,6277,6309,6310,6309,6310,6310,6309,6309,6310,6310,6310,6310,6310,6309,6309,6309,6309,4228,4229,4229,4228,4228,2147,2148,6277,6310,6310,6309,6309,6309,6310,8423,8423,6310,6310,4261,2148,2147,2148,2147,2148,4261,4261,4260,4260,4260,4260,4260,2148,4228,4260,2147,2147,2147,2147,2147,2147,2147,2147,2180,6341,6310,6277,6277,6277,6277,6277,6277,6277,4261,6472,10698},
-	{8617,8584,10697,8617,10697,10762,10762,10762,10762,12810,12842,12842,12842,12842,12874,12907,14987,12907,12875,12907,12907,12907,12907,12907,12907,12907,12907,15020,19278,19310,19310,19278,10729,8391,8359,6342,6310,6342,8455,8423,6310,6342,4229,2148,4229,6310,6342,6310,6310,6342,6310,6310,6343,8456,6375,6342,6342,6310,6342,6342,6342,6342,6310,6342,6342,6310,2180,2180,2148,2148,2148,2180,6374,4294,4294,4294,4294,4294,4294,4262,4229,4294,4294,4294,4294,4262,2181,4228,2148,2148,2180,8487,2181,4229,4261,2148,2148,2148,2148,2148,2180,2180,2148,4262,4295,4295,4295,4295,4295,4295,4295,4295,4327,4295,6375,6407,4359,4456,4456,2278,4294,4295,4295,6408,6408,6407,4328,8585,12843,8650,6537,8553,8553,8553,8553,8585,8585,8585,8585,6537,6537,6537,8585,8585,8585,6537,6537,8585,10698,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,12843,12875,10762,10763,10763,10762,10762,10762,10762,12875,12843,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10730,8585,6505,6505,6505,6505,6505,6505,6505,6505,6505,6505,6505,6505,6505,6505,6505,6505,6505,6505,6537,6537,6472,6310,4229,4229,6245,6277,6277,6277,4229,4229,4229,4229,6277,8390,6310,6277,6277,6277,6277,6277,6277,6277,6310,6310,6277,6309,6310,6310,6310,6309,6310,6310,6309,6310,6310,6309,6309,6310,6310,6310,6309,4229,6277,4261,4229,4261,2148,4228,6310,6310,6310,6309,6310,6310,6310,6310,8423,8423,6310,4228,2148,2147,2147,2147,2180,4261,4261,4260,4260,4260,4260,4260,2148,2147,2147,4228,4196,2147,2147,2147,2147,2147,2147,2147,4228,8390,6277,6277,6277,6277,6277,6277,6277,8455,10698,10730},
-	{6407,4294,8519,6374,6407,10697,10730,10730,10762,12810,12810,12842,12842,12842,12874,12874,14955,12907,12874,12874,12907,12907,12907,12907,12907,12907,12907,14987,17132,17164,17164,17165,17100,10600,6343,6342,6310,6342,8520,8488,8423,6310,8455,8551,8552,6375,6310,6310,6310,6342,6310,6310,6310,6343,8423,6342,6310,6342,6342,6310,4294,4294,6342,6342,6342,6310,4261,6471,6503,6503,8519,4294,8455,6375,4294,4294,4294,6342,6342,4262,4229,4294,4294,4294,4294,4262,2148,2148,2148,2148,2180,8584,4261,2148,2148,4228,4228,2148,2148,2148,2148,2180,2180,4262,4295,4295,4295,4295,4295,4295,4295,4327,4489,4424,4424,6504,6568,4520,6633,8584,6472,6408,6408,6408,8553,8586,8553,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,6537,8585,8585,8585,6537,8585,6537,8650,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,12811,10763,8650,10730,10762,10762,10762,10762,10763,12843,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10730,8618,6537,6505,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,6537,8553,8585,8488,6277,6277,6277,6277,6277,6277,6342,8455,8455,8455,6407,6310,8390,6309,6277,6277,6277,6277,6277,6277,8390,8423,6310,6309,6309,6310,6310,6309,6310,6310,6309,6310,6310,6310,6310,6310,6309,6310,6310,6309,6309,4228,4228,6309,2148,4228,6310,6310,6310,6309,6310,6310,6277,6277,6310,8423,6277,2148,2147,2147,2147,2147,2180,4261,4260,4228,4260,4260,4260,4260,2148,2147,2147,4260,4260,2147,2147,2147,2147,2147,2147,2147,2148,6277,6310,6310,6277,6277,6277,6277,6277,8455,10730,10730},
-	{4261,4229,4229,4229,4229,6439,10697,10730,10762,10762,12810,12810,12810,12842,12842,12842,12874,12874,12874,12875,12875,12875,12875,12907,12907,12907,17100,17100,17100,17100,17100,17100,17132,15020,12778,10665,10665,10697,14955,12778,12778,10730,12875,17100,12810,8423,6310,6310,6310,6310,6342,6342,6310,6310,6310,6375,6343,6310,6342,6342,6310,6342,6342,4294,6342,6342,8649,14988,12875,12875,14988,10697,6375,8456,6375,6342,6342,6342,6342,4262,4229,4294,4294,4294,4294,4262,2213,6438,8552,8552,8584,12875,10697,6472,4326,4294,4293,4228,2148,2148,2148,2148,2180,4262,4295,4295,4295,4295,4295,4295,4295,4327,4521,4554,6666,8714,10826,10859,12940,14988,12875,8650,8553,8553,8585,8618,8585,8553,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,6537,8585,8585,8585,8585,8585,8585,6537,8585,10730,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10730,10698,10730,10730,8650,8650,8650,8650,8650,8650,8618,10698,10730,8650,10730,10730,8650,8650,8650,8650,10730,12843,10730,8617,8553,6505,6505,6505,6505,6505,6505,6505,6505,6505,6505,6505,6505,6505,6505,6505,6505,6505,8585,10698,8552,6277,6277,6277,6277,6277,6310,8585,10762,12843,10762,10730,8520,8552,10633,8520,6342,6277,6277,6277,6277,6277,8390,8423,6310,6309,6310,6310,6309,6310,6310,6309,6310,6310,6310,6310,6310,6309,6310,6310,6309,6309,4228,4261,4229,2148,4228,6310,6310,6310,6309,6309,6310,6277,6277,6310,6309,4228,4260,2148,2147,2148,2147,2180,4261,4260,4228,2180,2148,2148,2180,2148,2147,2147,2147,4260,4260,2148,2147,2147,2147,2147,2147,2148,6277,6310,8423,6310,6277,6277,6277,6277,8455,10730,10730},
-	{4261,4229,4229,4229,4261,6439,10697,10730,10730,10762,10762,12810,12810,12842,10794,10794,12842,12842,12875,12875,12875,12875,12875,12875,12875,12907,15020,15052,15052,17100,17100,17100,17100,17100,15052,15020,17100,15052,15052,15052,15085,17165,17133,15052,8520,6310,6310,6310,6310,6311,6343,6342,6310,6310,6310,6375,8455,6343,6342,6342,6342,6342,4294,4294,4294,6407,14988,12907,10730,10730,10762,12907,6407,6343,6375,4294,6342,6342,6342,4262,4229,4294,4294,4294,4294,4262,4326,12875,12908,10763,10763,10795,12908,10795,10795,8649,6406,4293,2180,2148,2148,2148,4229,4262,4295,4295,4295,4295,4295,4295,4295,4327,4521,2473,8683,12875,10762,12843,12875,10762,10762,8650,8585,6537,6537,6505,8586,8618,8585,6537,6537,6537,6537,6505,6505,8585,8618,8585,6537,8585,8553,8553,8585,8585,6537,8585,10698,10763,10763,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10763,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10698,8618,8618,8650,10730,10698,6537,6505,8553,8553,8553,6505,8618,10763,10730,10730,8650,6537,8553,8553,8553,8617,10730,8650,10730,8650,8617,6537,6537,6537,6537,6537,6537,6537,6537,6537,6537,6537,6537,6537,6537,6537,8585,8650,10762,8552,6277,6277,6277,6310,8520,8585,10762,10762,12843,10762,10762,10762,10762,12843,12843,8455,6277,6277,6277,6309,6277,6309,8390,6310,6309,6309,6310,6310,6309,6309,6310,6310,6309,6309,6309,6310,6310,6309,6310,6310,6309,4228,4228,2148,2148,4228,6310,6310,6309,6309,6309,6309,6277,4229,4229,6309,4228,4293,4260,2147,2148,2147,2180,4261,4260,4228,2212,2147,2147,2147,2147,2148,2148,2147,2148,4260,2148,2147,2148,2148,2148,2147,2148,6277,6277,6310,8423,6310,6277,6277,6277,8455,10730,10730},
-	{4229,4229,4229,4229,4261,6407,10697,10730,10730,10762,10762,12810,12810,12810,12810,12842,12842,12842,12875,12875,12875,12875,12875,12875,12875,12875,12875,12907,12907,12907,12907,12907,12875,12907,12907,12907,14988,12875,10795,12843,10795,12843,15020,17101,8552,6342,6342,6342,6342,6342,6342,6342,6310,6310,6342,6310,6343,8488,10698,10730,10730,10730,10730,8585,6472,8552,10762,10730,10730,8650,8617,10730,8520,4295,4294,4294,4294,4294,4294,4262,4294,8520,8520,6472,6472,6472,6504,10763,8650,8585,8617,8618,8650,8649,12875,15020,10794,10730,12810,8552,2180,2181,4294,4295,4295,4295,4295,4295,4295,4295,4295,4327,4521,4489,8682,12875,10763,8617,8650,8650,8585,8585,8585,8585,8585,8585,8586,10698,8618,6537,8585,6537,6537,6505,6505,8585,8618,8585,8585,8585,6505,6505,6537,6537,8585,10698,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10763,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10730,8617,8553,8585,8585,8618,8585,8585,8585,8585,8585,8650,10730,12843,12843,8650,8585,8585,8585,8585,8585,8585,8585,10698,12843,10762,10730,8650,8650,8650,8650,6537,6537,6537,6537,6537,8585,8585,8585,8585,8585,8585,8650,10762,10763,8552,6277,6277,6277,6342,10730,10762,10762,10762,10762,10762,10762,10762,10762,8585,8520,8455,6310,6277,6277,6277,6309,6309,6309,6310,8390,6310,6309,6310,6310,6310,6310,6310,6309,8390,8390,6309,6309,6310,6310,6310,6309,4261,4229,4261,4261,4228,6310,6310,6309,6310,6309,4229,6309,4229,4229,6309,2180,2180,4293,4260,2148,2147,2148,2212,4260,4228,2212,2148,2147,2147,2147,2147,2148,2148,2147,2147,2147,2148,2148,2148,2148,2147,2148,6277,6309,6277,8390,8423,6310,6277,6277,6439,10730,10730},
-	{4228,4229,4229,4229,4261,8487,10697,10730,10730,10762,10762,10762,12842,10697,6406,6374,8584,12842,12842,12875,12875,12875,12875,12875,12875,12875,12875,12907,12907,12907,12907,12907,12907,12907,12907,12907,12875,10730,8650,8650,10730,8650,10762,15020,14955,12810,12810,12810,12810,12842,12810,8487,6342,6342,6342,6342,6343,10730,14988,10795,10762,10762,10763,8650,8617,8617,8618,8618,8618,8618,8617,8617,8617,8552,8552,8552,8552,8552,8552,6472,6504,8618,8617,8617,8617,8617,8617,8586,8585,10763,12843,8650,8649,10827,12908,12940,12972,15020,15053,17068,8584,4262,4295,4295,4295,4295,4295,4295,4295,4295,4295,4327,4489,2376,6537,10762,8682,8617,8585,8618,8585,8585,8585,8585,8585,8585,8585,8586,10698,8618,8585,8585,8585,8585,8585,8585,6537,8585,8650,8585,8585,8585,8585,6537,8585,10730,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10795,15020,15020,15020,12843,10698,10698,10698,10698,10730,10730,10730,10730,10730,10762,10730,8617,8617,10698,8617,8650,10730,10730,10698,10698,10698,10762,12843,10763,10763,8650,8618,8618,8618,8585,8585,8585,8585,8585,8585,6537,6537,8585,8585,8650,10762,10762,10763,8552,6277,6277,6277,6342,10698,10762,10762,10762,10762,10762,10763,12875,10762,8520,6277,8358,8423,6310,6277,6277,6310,6310,6309,6310,8390,8423,6310,6309,6310,6310,6310,6310,6309,6310,6310,6310,6310,6309,6310,6310,6309,4229,4229,6309,4228,4228,6310,6310,4228,6309,6277,4228,6309,6309,6309,6309,2180,2148,4228,4228,2148,2147,2147,2180,2180,2180,2180,2180,2147,2148,2148,2148,2147,2147,2148,2147,2147,2148,2147,2147,2148,2147,2148,6277,6309,6277,6309,8390,8423,6310,6374,8617,10730,10730},
-	{4228,4228,4228,4228,4229,6374,10665,10697,10697,10729,10730,10762,10697,6373,4196,4196,4260,6373,10697,12842,12843,12875,14956,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,8682,8650,10730,8650,8618,10730,12876,12843,10762,10762,12875,15021,15021,12875,12843,12843,12843,12843,12843,14956,10763,8650,8618,8618,8617,8618,8618,8618,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8585,8585,8585,8585,8586,8585,8650,8650,8618,8617,8650,8650,8650,8650,10698,10698,10763,10698,4327,4327,4327,4327,4327,4327,4327,4327,4327,4359,4488,4521,6602,8780,8650,8618,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8618,10698,8618,8585,8585,8585,8585,8585,8585,8585,8618,8585,8585,8585,8585,8585,8617,10731,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,12875,12875,12875,10795,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10730,10730,10762,12843,10763,10763,10763,8682,8617,8617,8649,10730,12843,12843,10730,10698,10698,10698,10730,10730,10730,10730,10698,8585,8585,8585,8618,10730,10762,10762,10762,10762,8584,6310,6310,6310,6374,10698,10762,10762,10762,10762,10762,10762,12843,12875,8520,6309,6309,6310,6309,6309,6309,6309,6310,6310,6309,6310,8423,8423,6310,6309,6310,6310,6310,6309,6309,6310,8423,6310,6309,6309,6310,6309,4228,4229,6309,2148,4228,6310,6310,4228,4228,6277,4228,6277,4228,4229,6309,2180,2148,2148,2147,2148,2147,2148,2148,2148,2148,2147,2147,2148,2148,4196,4196,4195,4195,4228,2147,2147,2180,2147,2147,2148,2147,2148,6277,6309,6277,6309,6277,8390,8423,8455,10730,10730,10730},
-	{4228,4229,4228,4228,4228,4261,8552,6374,6374,6374,10632,10697,6373,4196,4196,4196,4196,4196,6341,10697,12842,12843,14955,14955,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,10730,8650,10730,8650,8650,8618,8650,10731,10698,8617,8650,10730,10730,10730,10730,10730,10730,10730,10730,10730,8618,8618,8617,8617,8618,8618,8618,8618,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8585,8586,8586,8586,8585,8586,8585,8585,8585,8585,8585,8585,8585,8585,8585,8617,8617,10731,12908,12843,12843,12875,12875,12843,12843,10795,10795,12843,10827,10827,12907,10957,10924,12875,12843,8618,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8618,10698,8618,8585,8585,8585,8585,8585,8585,8585,8618,10698,8585,8617,8650,8618,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,10762,12843,12876,10795,10763,10763,10730,10730,10730,10762,10763,10795,10762,8650,8617,8617,8617,8617,8617,8617,8618,8585,8585,8585,8585,10730,10763,10762,10762,10762,10730,10698,10698,10698,10698,10762,10762,10762,10762,10762,10762,10762,10762,12875,10633,6309,6309,6277,6277,6309,6310,6310,6310,6310,6310,6309,6310,8423,8390,6310,6309,6310,6310,6310,6309,6309,6310,6310,6310,6310,6310,6309,4228,4261,6309,2148,4228,8423,8423,4228,2180,6277,4228,4229,2148,4196,6277,4196,4195,4228,4196,4196,4196,4196,4196,4196,6244,6244,6244,6244,6244,16517,18597,18565,18565,16549,6276,2179,2148,2148,2148,2147,2147,2148,6277,6309,6309,6277,6277,6309,8390,10568,10730,10730,10762},
-	{4196,4228,4228,4228,4228,4260,4293,4261,4261,6341,6374,4293,4196,4196,4196,4196,4196,4196,4196,6341,10697,12843,12875,14956,14955,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12843,10762,10730,8650,8618,8618,8617,10698,10763,10698,8617,8617,8617,8617,8617,8617,8617,8617,8618,8618,8618,8618,8617,8617,8618,8618,8618,8618,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8618,10730,8618,8617,8617,8585,8586,8586,8586,8585,8585,8585,8585,8585,8585,8586,8586,8586,8585,8617,12843,12843,8617,10730,10730,8649,12875,12875,8649,8649,8650,8650,8650,8650,8650,8618,8650,8650,8649,8649,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8618,10699,8618,8585,8585,8585,8585,8585,8585,8585,8585,10698,10762,10762,10762,10762,10763,10763,10763,10763,10763,10763,10763,10763,10762,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,12843,12875,10795,10763,10763,10762,10763,10763,10763,10763,10762,10762,8617,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8650,10763,10763,10763,10763,10763,10763,10763,10763,10795,10795,10763,10763,10763,10763,10763,10763,10763,10795,8552,6310,6309,6309,6309,6309,6310,6310,6310,6310,6310,6310,6309,6310,8423,8390,6310,6309,6310,6310,6310,6309,6309,6310,8423,6310,6309,6309,4228,2148,2148,2148,4228,6310,8423,6309,4228,6277,4228,4261,2148,2148,4261,4228,8324,18597,18597,18596,18596,18597,18597,18597,18597,18597,18597,16549,8292,18565,20644,20645,18597,16549,6244,2147,2148,4196,4196,2147,2147,2148,6309,6309,6309,6309,6309,6309,6277,8390,10633,10762,10762},
-	{2115,2115,2115,4195,4195,4228,4261,4229,6309,6309,6309,4228,4196,4196,4196,4196,4196,4196,4196,4196,6342,10730,12843,12875,14956,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,10762,10730,8618,8618,8618,8617,8617,8650,10730,8617,8617,8617,8617,8617,8617,8617,8617,8618,8617,8617,8617,8617,8617,8618,8618,8618,8618,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8650,10731,8618,8617,8617,8618,8617,8618,8618,8618,8586,8586,8586,8586,8586,8586,8585,8586,8586,8618,8618,8586,8586,8586,8585,8618,8618,8617,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8586,8586,8586,8586,8586,8586,8586,8618,10731,8618,8585,8585,8585,8585,8585,8585,8617,10730,12843,10794,10794,10794,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10763,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10763,10763,10763,10763,12843,12875,10763,10763,10763,10763,10763,10763,10763,10763,12875,12811,8617,8585,8585,8585,8585,8585,8585,8585,8585,8585,8650,10763,10795,10795,10795,10795,10763,10763,10763,10795,10795,10795,10762,10730,10730,10730,10730,10730,10762,8520,8422,8390,6309,6309,6310,6310,6310,6310,6310,6310,6310,6309,6309,6310,8423,8390,6310,6309,6310,6310,6310,6309,6310,6310,6310,6309,6309,4228,2180,2147,4196,8324,10405,10406,8389,6308,6277,4228,4261,2148,2148,4229,6276,18565,20645,22693,22693,22693,22693,22693,22693,22693,22693,22693,20645,10340,12420,16516,16516,14468,8292,8324,6244,6244,10372,10372,2147,2147,2180,6309,6277,6277,6277,6277,6277,6277,6277,8487,10795,10763},
-	{2115,2115,2115,4163,4163,4196,6309,4261,6342,6309,6309,4229,4196,4196,4196,4196,4196,4196,4196,4196,4196,6374,10730,12843,12843,12843,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,10763,10730,8618,8618,8617,8617,8618,8618,8618,8650,8650,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8618,8618,8618,8650,10730,8618,8617,8617,8617,8617,8618,8618,8618,8618,8618,8618,8618,8585,8585,8586,8586,8586,8586,8586,8586,8586,8586,8585,8585,8586,8586,8586,8586,8586,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8586,8585,8585,8618,10698,8585,8617,8617,8617,8617,8650,10730,10730,12875,12875,10794,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10795,10794,10794,10795,10795,10794,10794,10794,12843,12811,12811,12875,12875,10794,10794,10794,10794,12875,12907,12907,12907,12907,14955,14955,12907,12907,12907,12907,12907,12907,12907,14955,12875,12875,10730,8617,8585,8585,8585,8585,8585,8585,8585,8585,8617,10730,12843,10795,10795,10795,10795,10795,10795,10762,10762,12875,10795,10730,10762,10762,10730,10730,10730,8520,6310,8423,8390,6310,6309,6310,6310,6310,6310,6309,6309,6309,6310,6309,6310,8423,8390,6310,6309,6310,6310,6310,6309,6309,6309,6342,6342,4228,8356,8324,12420,20645,20645,20645,12420,16549,10406,8356,10404,8324,8324,10373,12420,20645,22693,22693,22693,22693,22693,22693,22693,22693,22693,22693,22693,20645,20645,20645,20645,20645,20645,20645,20613,16516,14468,10372,2147,2147,2148,4229,4196,4196,4197,2148,2148,6277,6310,8552,10697,8585},
-	{2115,2115,2115,2115,4163,4196,6341,6342,6374,6309,6309,4229,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,8519,12843,12843,12843,12843,12875,12843,12843,12843,12843,12843,12875,12875,12875,12875,12875,12875,10762,10730,8618,8617,8617,8617,8617,8617,8617,10698,10730,8650,8617,8617,8617,8617,8617,8618,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8618,8618,8618,8617,10698,10698,8617,8617,8617,8617,8618,8618,8618,8618,8618,8618,8618,8618,8618,8618,8618,8618,8618,8618,8618,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8586,8618,8618,8618,8618,8617,8585,8585,8585,8585,8617,8585,8617,8617,8617,8650,10730,10730,10730,12843,12907,12875,10795,10795,10795,10795,10795,10795,10795,10795,12843,10795,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,10794,10794,10794,10794,10794,10794,10794,10763,10795,10795,14956,12907,10794,10794,10794,10794,14955,17068,17068,17068,17068,17100,17100,17100,17100,17100,17100,17100,17100,17100,17100,12875,12842,10730,8650,8585,8585,8585,8585,8585,8585,8585,8617,8617,10730,12843,12842,12842,12843,12843,12811,10730,8617,8650,12843,12875,12875,15020,12875,12875,12908,12875,8552,6277,6310,8423,8390,6309,6309,6309,6309,6309,6310,8390,6310,6309,6309,6309,6310,8423,6310,6309,6310,6310,6310,6310,6310,6309,8390,8423,6276,16549,20645,20645,22693,22693,20645,20645,20645,18662,20678,20645,20645,20645,20645,20645,22693,22693,22693,22693,22693,22693,22693,22693,22693,22693,22693,22693,22693,22693,22661,22693,22693,22693,22693,22693,20645,20645,14468,10372,8324,10372,10340,10340,10340,8324,4197,2117,4229,8455,10698,6374,2149},
-	{2115,2115,2115,2115,4163,4196,6341,6342,6374,6309,6309,4229,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,8487,12843,12843,12843,12875,14955,12875,12842,12842,12843,12843,12843,12843,12843,12843,12843,12843,10762,10730,8618,8617,8617,8617,8617,8617,8617,8617,10698,10730,8617,8617,8617,8617,8617,8617,8618,8618,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8617,8586,8586,8617,8617,8617,8617,8617,8617,8617,8617,8618,8618,8618,8618,8586,8618,8618,8618,8618,8618,8617,8617,8617,8617,8617,8617,8617,8618,8618,8618,8617,8617,8617,8617,8585,8585,8585,8585,8586,8586,8586,8617,8617,8618,8618,8586,8618,8618,8650,8650,8650,8650,8618,8585,8585,8617,8617,8617,8617,8617,8617,10763,10795,8682,8682,10795,12843,14955,12875,12843,10795,10795,10795,10795,10795,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12843,12875,14988,14987,14987,14987,12875,14987,14987,14987,14988,14988,14988,15020,14988,14988,15020,15020,15020,14988,14988,15020,15020,15020,15020,12875,12843,12843,12843,12843,12843,12843,12843,12842,10730,10731,8650,8585,8585,8585,8585,8617,8617,8617,8617,10762,12875,12843,12843,12843,12843,10762,8617,8585,8617,6569,8617,10762,12811,8650,8650,12811,10730,6439,6309,6277,6310,8422,8390,6309,6277,6277,6277,6310,8422,6310,6309,6309,6309,6309,6309,6309,6309,6309,6309,6309,6310,6309,6309,6309,8390,12486,18597,22693,20645,20677,18630,20645,22692,22693,22725,24806,22725,22693,22693,20644,20644,20644,22693,22693,22693,22693,22693,22693,22693,22693,22693,22693,22693,22693,22693,22693,22661,22693,22693,22693,22693,22692,22692,22693,20645,20645,20645,20645,20645,20645,20613,14469,8293,4229,4294,6407,2149,2149},
-	{2115,2115,2115,2115,4163,4195,6341,6342,6374,6309,6309,4229,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,6342,10697,10697,8585,10665,12842,14923,12843,10762,12810,12810,10794,10794,10762,10762,10794,10794,10762,10762,10730,10730,10730,8649,8617,8617,8585,8585,8585,8649,10698,8617,8617,8617,8617,8617,8617,8617,8618,8618,8618,8617,8617,8617,8617,8617,8617,8650,8649,8617,8617,8617,8617,8617,8617,8585,8585,8585,8585,8617,8617,8617,8617,10698,8617,8617,8585,8585,8585,8585,8585,8585,8617,8617,8618,8618,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8585,8617,8649,8650,8650,8650,8617,8585,8585,8585,8585,8585,8585,8585,8617,10762,10762,10762,10762,10795,10795,12875,14956,12907,10795,12843,12843,12875,10827,12843,12843,12843,12843,12875,12875,12875,12875,12875,12875,12875,12875,12843,12843,12843,12843,12843,12843,10795,10794,10794,10794,10762,10762,10762,10794,14987,14987,14987,14987,12874,14987,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,12907,12843,12875,12875,12843,12843,12843,12843,12843,10762,8618,10698,8618,8585,8585,8585,8585,8617,8617,8617,10763,12907,12843,10794,10794,10794,8649,6537,8617,10698,8650,8650,10794,10762,10762,14955,14988,12875,10729,10632,6342,4229,6342,12713,10665,10632,10632,10600,6342,6277,6277,6277,6277,6277,6277,6309,6309,6309,6309,6309,6310,6309,6309,6309,6277,10373,18629,22726,18629,16613,16646,16678,18662,20677,20645,20644,22693,22757,22693,20612,20612,20612,20644,20612,20644,20645,20645,22693,22693,22693,22693,22693,22693,22693,22693,22693,22693,22693,22693,22693,22693,22661,22693,20612,18532,18532,18532,18532,18564,18564,18564,18532,18564,18565,6212,2149,2149,2149,2149},
-	{2115,2115,2115,2115,2147,4195,6309,4229,4228,4196,6309,4229,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,6374,8519,12681,12745,17004,17068,17036,14987,14987,14987,14987,14988,14987,14987,17036,17068,17036,14955,12810,12842,12842,10762,8617,12810,12843,12811,12811,12810,10730,10698,8585,8585,8617,8617,8617,8618,8618,8618,8618,8617,8617,8617,8650,8650,8650,8650,10698,12843,14923,12875,12843,12843,12843,12810,12810,8617,8585,8585,8585,8617,8617,10698,10730,10730,12843,12811,12811,12811,10730,8585,8585,8585,8585,8618,12811,12843,12811,12811,12810,10697,8585,8585,10730,12811,12811,12811,12811,12810,12810,12810,12810,12810,12810,12810,12810,12810,12810,12810,8649,8585,8617,12810,12843,12843,12843,12843,12811,12810,12810,12810,12810,12810,12810,12810,12875,14988,14987,10794,10762,10794,10794,10794,12875,12907,12907,10827,12875,12875,12875,10827,10827,10795,10827,10827,10827,10827,10827,10827,10827,10827,10827,10827,12907,14988,10827,10795,12875,15020,15020,14988,14988,14988,14987,14987,14987,14987,14987,14987,14987,14987,12842,10762,10794,10794,10794,10795,10795,10827,10827,10827,10827,10827,10827,10827,10827,10827,10827,10827,10827,10827,10827,10827,10827,10827,10827,10827,12874,14956,12843,12843,14924,12843,10730,8617,10762,12843,12843,12843,14988,15020,17101,17133,15020,14988,12875,14955,12843,12875,15020,17101,17100,14988,14988,17101,17133,17068,17068,17036,12745,12713,14890,19181,19213,19213,17100,14987,10664,8454,10535,12616,12616,10535,10503,6309,6277,6277,6309,6309,6309,4229,6341,10535,14631,20775,22855,24935,22822,16613,16646,16646,14631,16743,24903,24870,24870,24903,26984,24903,24870,22822,24870,24870,22725,20644,20644,20645,22693,22693,22693,22693,22693,22693,22693,22693,22693,22693,22693,22693,22693,22661,22693,18564,16451,14403,14403,16451,14403,14403,14403,14403,14435,16516,10406,4197,2149,2149,2149},
-	{2115,2115,2115,2115,2115,4195,4261,4195,4163,4163,6309,4229,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,21164,50745,52825,52890,52890,52858,52890,52890,52890,52890,52890,52890,52890,52890,52890,52890,42326,14923,10730,10762,10762,14923,42326,52858,50810,50810,50810,31761,8617,8617,8585,8585,8617,8618,8618,8650,8650,8650,8650,8650,8650,10698,10698,10698,8650,12810,40213,52858,52858,52858,52858,50810,50810,50745,23342,6504,8584,8585,8585,8617,8617,10730,38100,52858,50810,50810,52858,36020,8617,8585,8585,8585,12843,44439,52858,50810,50810,50777,27568,6504,8585,38100,52858,50810,50810,50810,50810,50810,50810,50810,50810,50810,50810,50810,50810,50810,50777,25488,6504,14923,46519,52858,50810,50810,50810,50810,50810,50810,50810,50810,50810,50810,50810,52858,52890,48664,19181,10729,10762,10794,10794,10794,12875,14988,12907,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12907,12908,12875,10794,21294,48697,52890,52890,52890,52890,52890,52890,52890,52890,52890,52890,52890,50777,23407,10729,10762,10762,10794,10794,12875,12875,12875,12875,12875,12875,12875,12908,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,38132,52890,50810,52858,52858,38100,10665,8649,10730,10730,10762,12907,12939,25520,50810,52890,52890,52858,48697,19213,8649,23407,50810,52922,52890,52890,52858,52858,52858,52858,52858,50809,52858,52890,52890,52890,52922,44471,17068,12874,31761,50745,52793,50745,50745,42228,10503,6277,6277,6277,6309,4261,2148,12680,46486,52793,54841,54841,52760,29453,14631,12615,12615,14598,31501,52760,54841,54841,54841,54841,54841,54841,54841,54841,54808,33484,18564,20644,20644,20645,20645,22693,22693,22693,22693,22693,22693,22693,22693,22693,22693,22693,20645,22693,18564,18597,18695,18695,18696,20776,20776,20776,20776,18696,18728,16680,12552,8390,4197,2149},
-	{2115,2115,2115,2115,2115,4195,4261,4195,4195,2116,4261,4228,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,25357,63422,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,52858,12842,8649,10729,10729,14955,52890,65535,65535,65535,65535,38132,8584,10665,10697,8617,8649,8650,10698,10698,10698,10698,10698,10698,10698,10698,10698,8650,8617,12810,48697,65535,65535,65535,65535,65535,65535,63454,27535,6439,6504,8552,8585,8585,8585,10698,46551,65535,65535,65535,65535,44471,8584,6504,8584,8617,17004,55003,65535,65535,65535,65535,33906,6471,8584,46552,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,31794,6472,17003,57116,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61309,21261,8648,10729,10762,10762,10794,12843,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,10794,10762,23407,61341,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63422,27600,8616,10729,10761,10762,10794,12842,12875,12875,12875,12875,12875,12875,12908,14988,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,46551,65535,65535,65535,65535,46584,10665,6504,6504,6537,8650,10794,10794,27600,63422,65535,65535,65535,61309,23342,8584,23407,63390,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,54971,14923,8616,38132,65535,65535,65535,65535,52857,10567,4196,4228,6277,6309,8552,10632,21164,59196,65535,65535,65535,63454,31598,14565,16646,16581,16516,37743,65503,65535,65535,65535,65535,65535,65535,65535,65535,65503,37775,16483,18564,20644,20644,20644,20645,22693,22693,22693,22693,22693,20612,18532,18532,18532,18532,18532,20644,18564,18663,18761,20842,20874,22955,22955,22955,20874,22890,20842,18761,16713,14633,8358,2149},
-	{2115,2115,2115,2115,2115,2147,4261,4196,2147,2147,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4164,25325,63422,65535,65535,65535,63454,57115,55003,55003,54970,54970,54970,55003,57083,63422,65535,54970,23341,19116,14922,10697,14923,52890,65535,65535,65535,65535,38132,8552,8584,10697,10698,8649,10698,10698,10698,10698,10698,10698,10698,10698,8650,8650,14923,19149,21262,50810,65535,63422,57083,55003,59229,65535,63454,33874,14923,14923,8584,8552,8584,8585,10697,46519,65535,65535,65535,65535,44438,8552,6471,6504,8584,14923,55003,65535,65535,65535,65535,33874,6439,8552,46551,65535,65535,65535,65535,61341,55003,55003,55003,55003,55003,55003,55003,55003,55003,54971,27568,6471,17003,57116,65535,65535,65535,65535,59196,55003,55003,55003,55003,55003,55003,55035,61309,65535,61309,27600,17068,17035,10729,10762,10794,12842,12875,12875,14988,12907,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,19181,19214,29745,61342,65535,61309,55035,55003,55003,55003,55003,55003,55003,59229,65535,63454,33906,17068,17068,10761,10762,10762,10794,12875,12875,12875,12875,12875,12875,12875,12908,14988,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,46551,65535,65535,65535,65535,46551,8584,6471,6504,8584,10730,12843,10794,27600,63422,65535,65535,65535,61309,21261,6503,19148,52890,57083,55035,55035,57083,63422,65535,65535,65535,65535,61309,55003,55003,55003,57083,46584,14923,8649,38132,65535,65535,65535,65535,55003,23341,16971,10567,6309,6439,10633,14598,27178,59164,65535,65535,65535,63422,31598,10469,16645,25000,27080,42033,65503,65535,59196,57018,57018,57018,57018,59164,65535,65503,42065,25000,25000,20677,18564,20644,20645,22693,22693,22693,22693,22693,20612,16451,14435,14435,14435,16484,20644,18564,12453,10470,16713,20842,22954,23019,20906,20874,20842,18794,16680,14599,16713,8391,2149},
-	{2115,2115,2115,2115,2115,2147,4261,2148,2147,2147,2147,4195,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4164,25325,63422,65535,65535,65535,59196,23309,14857,14857,12679,10566,10566,12744,19116,54970,65535,63422,59196,59196,33906,8616,12842,52890,65535,65535,65535,65535,38099,6471,8551,8584,8617,8649,10698,10698,10730,10730,10730,10730,10698,10698,8650,8649,31826,59196,59196,63422,65535,55003,19116,12777,35954,65503,65535,61277,57116,48697,12810,6472,8552,8584,10665,46519,65535,65535,65535,65535,44438,8551,6471,6503,6504,14923,55003,65535,65535,65535,65535,31793,6406,6471,46519,65535,65535,65535,65535,46518,14857,12777,12777,12777,12809,12809,12810,12810,12810,12810,8616,6471,16971,57116,65535,65535,65535,65503,33873,12744,12777,14857,14857,14890,14922,17002,44406,65535,65503,59229,59196,44471,12842,10729,10762,12842,12875,12875,12907,12907,12907,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,14988,46584,59228,59229,65535,65535,42325,17002,14922,14922,14922,14922,14922,14922,35986,65503,65535,61309,59196,50745,17035,10697,10762,10794,12875,12875,12875,12875,12875,12875,12875,12907,14988,14988,12875,12875,12875,12875,12875,12875,12875,12875,12875,12875,46551,65535,65535,65535,65535,46519,8584,8551,8552,8552,10730,10794,10794,27600,63422,65535,65535,65535,61309,21261,6503,8616,17003,17035,17035,17003,19148,52890,65535,65535,65535,65535,42293,12777,12777,14857,14890,12809,8584,8584,36051,65535,65535,65535,65535,63454,59196,59196,36019,10697,12810,14825,16581,27113,59164,65535,65535,65535,63422,31533,12387,22952,54873,59164,61277,65535,63422,37840,20806,20839,20839,20806,35727,63422,65535,61277,59164,54841,25032,18564,20644,20645,22693,22693,22693,22693,20612,16484,16451,16483,14436,8292,8292,16549,10437,8357,8390,10470,12519,12583,14696,14696,12551,10439,10471,10471,12551,10471,4197,2149},
-	{2115,4228,4195,2115,2115,2147,4261,2147,2147,2147,2115,4195,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,2116,25325,63422,65535,65535,65535,57116,14889,4357,2179,2114,4195,2115,2115,10599,52857,65535,65535,65535,65535,36019,8551,12809,52858,65535,65535,65535,65535,38067,6438,6471,8552,8616,8649,10698,10698,10730,10730,10730,10730,10730,10698,8649,8617,36019,65535,65535,65535,65535,54938,12776,4325,29680,65503,65535,65535,65535,55003,12809,6439,6471,8552,8617,44471,65535,65535,65535,65535,44438,8519,6471,8551,8552,14923,55003,65535,65535,65535,65535,31793,4325,6470,46519,65535,65535,65535,65535,42325,6405,4293,4325,4358,6406,6438,6438,6438,6439,6439,6471,6471,17003,57116,65535,65535,65535,65503,27567,4292,4325,6406,6470,6470,8551,8583,40212,65535,65535,65535,65535,50745,12809,10696,10761,10794,12875,12875,12875,12907,14988,12907,12907,12907,12907,12907,12907,12907,12907,12907,12907,12907,12907,12907,12875,17068,52890,65535,65535,65535,65535,38132,8551,8551,8551,8551,8583,8583,6503,29680,65503,65535,65535,65535,57083,17035,8648,10729,10794,12875,12875,12907,12907,12907,12907,12907,12907,12907,12907,14955,12907,12907,12907,12907,12907,12907,12907,12875,12875,46551,65535,65535,65535,65535,46519,8551,6439,8584,8584,10729,12842,10794,27600,63422,65535,65535,65535,61309,21260,6470,8583,8616,8616,8616,8616,12809,50777,65535,65535,65535,65535,38099,4325,4357,6471,8583,8616,8648,10696,38132,65535,65535,65535,65535,65535,65535,65535,40245,10728,12744,14597,16516,27113,59164,65535,65535,65535,63422,31501,12354,22952,59196,65535,65535,65535,63422,31533,12354,12355,12387,12354,31436,63422,65535,65535,65535,59196,27145,16516,18564,20644,20645,22693,22693,20644,18531,16451,16451,16484,16517,12388,6212,6277,8390,10438,10438,8390,8390,12551,10503,12616,10503,10438,10438,10471,8390,4229,2149,2149},
-	{2115,4195,4228,2147,2115,2147,4261,2148,4196,2147,2115,4195,4195,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,2116,23277,63422,65535,65535,65535,59164,16937,4357,2147,2114,4195,4228,2115,8453,50745,65535,65535,65535,65535,36019,8551,12777,52857,65535,65535,65535,65535,38067,6438,6470,8552,8616,8649,10698,10730,10730,10730,10730,10730,10698,12843,23375,25455,44438,65535,65503,54970,48664,40212,10664,4357,23341,48664,50744,59229,65535,59196,27567,23309,17035,8584,8616,46519,65535,65535,65535,65535,44406,8518,6438,6503,8552,14923,55003,65535,65535,65535,65535,31761,4325,6438,46519,65535,65535,65535,65535,42325,6405,4325,4325,6406,6438,6439,6471,6471,6471,6471,6471,6471,17003,57116,65535,65535,65535,65503,27567,4292,6405,6438,6470,8551,8583,8616,40244,65535,65535,65535,65535,50744,12776,8616,10729,10762,12842,12875,12907,12907,14955,15020,14988,12907,12907,12907,12907,12907,12907,12907,12907,12907,12907,12907,12907,14988,42326,50809,50777,50777,50745,29680,8583,8551,8583,8583,8583,8583,8583,29680,65503,65535,65535,65535,55003,17002,8616,10729,10762,12842,12875,12907,12907,12907,12907,12907,12907,12907,12907,14988,15020,12907,12907,12907,12907,12907,12907,12875,12875,46551,65535,65535,65535,65535,46518,8518,6406,8551,8617,10729,12842,10794,27600,63422,65535,65535,65535,61309,21260,6470,8583,8616,10696,10696,8648,12842,50777,65535,65535,65535,65535,38067,4292,4325,6406,6438,6471,6503,6503,36019,65535,65535,65535,65535,65535,65535,65535,46551,25454,25292,18725,16484,25033,59164,65535,65535,65535,63422,29453,10274,20903,59196,65535,65535,65535,63422,31533,12354,12387,12387,14435,27178,50615,50679,52727,52728,48469,22919,16516,18564,20644,20645,22693,20612,18531,16483,16484,14436,16615,18761,10406,4197,4197,8358,8390,10470,8358,8390,10503,10535,10535,10535,10471,10439,10471,10471,8390,4229,2149},
-	{2115,2115,4195,4195,2115,2148,4261,4260,4261,2148,2147,2147,2147,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,2116,23277,63422,65535,65535,65535,57116,14824,4260,2147,2115,2115,4196,4228,8453,50744,65535,65535,65535,65535,35986,8518,12776,52857,65535,65535,65535,65535,36019,6405,6470,8584,8616,8649,10730,10730,10730,10730,10730,10730,8650,21262,57116,61342,63422,65535,61342,25454,8583,8551,6438,6438,6471,8584,10696,46551,65535,65503,61342,61342,40245,8584,8584,44471,65535,65535,65535,65535,44438,8518,6438,6471,6503,14922,55003,65535,65535,65535,65535,31761,4325,6438,46519,65535,65535,65535,65535,42325,6405,4325,4357,6438,6439,6471,6471,6504,6504,6504,6504,6504,17003,57116,65535,65535,65535,65503,29615,4324,6405,6470,6503,8616,10696,10696,40245,65535,65535,65535,65535,50744,10696,8583,10697,10762,12842,12875,12907,12907,12907,14988,15020,12907,12939,12939,12939,12939,12939,12939,12939,12939,12907,12907,12907,12907,14987,14987,14954,12842,12809,10696,8583,8583,8615,8616,8616,8616,8583,29680,63455,65535,65535,65535,55003,14922,8615,10728,10761,12842,12875,12907,12907,12907,12939,12939,12939,12939,12907,12939,15020,15020,12939,12907,12939,12907,12907,12907,14955,46551,65535,65535,65535,65535,46518,8518,6406,6471,8584,10729,12842,10794,27600,63422,65535,65535,65535,61309,21228,8550,8583,8616,10696,10729,10696,12874,50777,65535,65535,65535,65535,38067,4292,4325,6406,6439,6471,6504,6504,36019,65535,65535,65535,65535,65535,65535,65535,63422,61341,59196,27275,14403,25032,59164,65535,65535,65535,63422,29453,10274,20903,59196,65535,65535,65535,63422,31533,10306,12386,14435,14435,16548,18661,18661,18693,18725,18661,16516,16516,18564,20644,20644,20644,18532,16484,16516,14501,12486,16680,20842,18761,10438,4164,6276,10471,10471,8325,8357,12584,14664,12584,10471,10438,10439,10471,10471,10471,8390,4229},
-	{2115,2115,2115,2115,4196,2148,4261,4294,4294,4261,2147,2147,2147,4195,4196,4196,4196,4196,4196,4196,4196,4196,4196,2116,23277,63422,65535,65535,65535,59164,12711,34,2114,2115,2115,2147,4196,8454,50744,65535,65535,65535,65535,35986,6437,12744,52857,65535,65535,65535,65535,36018,6405,6438,8551,8616,10697,10730,10730,10762,10730,10730,10730,8650,21294,61309,65535,65535,65535,61342,23309,4325,6405,6438,6470,8583,8583,8616,46519,65535,65535,65535,65535,44438,8616,10696,46519,65535,65535,65535,65535,44438,8550,6470,8551,8583,14955,55003,65535,65535,65535,65535,31793,4325,6438,46519,65535,65535,65535,65535,42293,6405,4292,4357,6438,6471,6471,6503,6503,6504,6504,8584,8584,17035,57116,65535,65535,65535,65503,29615,4325,6438,8583,10696,10729,12841,12841,40277,65535,65535,65535,65535,50744,10664,8583,10696,10761,12842,12875,12907,12907,14988,14987,14987,15020,14988,14988,14988,14988,14988,14988,14988,14988,14988,14987,12907,12907,12875,12842,10761,10729,8648,8616,8616,8616,8616,8648,10696,10696,8616,29680,63454,65535,65535,65535,55003,14922,8615,10729,10761,12874,12907,12907,14987,14988,14988,14988,14988,14988,14988,14988,14988,15020,14988,14988,14988,14988,12907,12907,14987,46551,65535,65535,65535,65535,46486,6438,6406,6471,8584,10729,12842,10762,27568,63422,65535,65535,65535,61309,21196,6470,8615,10696,10729,10761,10729,14922,50809,65535,65535,65535,65535,38067,4324,4325,6438,6471,6504,8584,8584,36019,65535,65535,65535,65535,65535,65535,65535,65535,65535,63390,27307,12322,22952,59164,65535,65535,65535,63422,29452,8226,20903,59196,65535,65535,65535,63422,31501,10306,12354,10371,10404,10404,12420,14435,14435,14467,16516,16515,16516,18564,20644,20612,16484,14436,12388,10406,10406,10406,14567,18761,18761,14600,6244,6276,10471,10471,10471,10471,14632,14632,14632,12551,10439,10439,12551,10471,10471,10471,6309},
-	{2115,2115,2115,2115,4196,6309,4293,4294,4294,4261,2115,2147,2147,2147,2147,4196,4196,4196,4196,4196,4196,4196,4196,2116,25325,63422,65535,65535,65535,59164,12711,2082,2114,2115,2147,2147,2147,8453,50745,65535,65535,65535,65535,35986,6405,10663,52825,65535,65535,65535,65535,36018,6405,6438,8551,10697,10729,10730,10730,10762,10762,10762,10730,8682,21294,61309,65535,65535,65535,61341,23309,4325,6405,6438,8551,8616,8648,10728,46551,65535,65535,65535,65535,44406,8616,8616,31761,44406,46551,61342,65535,52858,31760,31760,31793,31793,36019,59228,65535,59196,42357,42293,23276,4325,6438,46519,65535,65535,65535,65535,50777,29647,27567,29647,29680,29680,29712,29713,29713,29713,29681,19116,8584,17035,57116,65535,65535,65535,65503,29615,4325,6470,10664,10729,19148,33906,36018,50777,65535,65535,65535,65535,48664,10663,8551,10696,10761,12874,12875,12907,12939,14988,14988,14988,15020,17068,14988,14988,14988,14988,14988,14988,14988,14988,14988,14987,12907,12907,12874,12842,10761,10729,21229,33906,33906,33906,33906,33906,33906,33906,44438,65503,65503,50744,42325,36019,12776,8583,10696,10761,12874,12907,12907,14988,14988,14988,14988,14988,14988,14988,14988,14988,14988,14988,14988,14988,14988,12939,12907,12907,46551,65535,65535,65535,65535,46486,6438,6405,21196,33874,31826,17067,10729,27567,63422,65535,65535,65535,61309,21196,6438,8583,10729,10761,10761,10761,14955,50777,65535,65535,65535,65535,38067,4325,6405,6471,6503,8584,8584,8584,36052,65535,65535,65535,65535,65535,65535,65535,65535,65535,63422,42163,31533,37937,61309,65535,65535,65535,63422,29452,8226,16677,42130,46356,52792,65535,65502,44276,31565,31566,29615,29647,29647,31663,33646,33646,33646,31566,16775,14533,16581,14565,14501,14469,10373,10406,8325,8325,6245,6277,8358,10438,10438,6244,8325,10471,10471,10471,12519,14632,14664,14664,12551,10439,10439,12584,12552,10471,10471,6310},
-	{2115,2115,2115,2115,2148,6374,6406,4294,4294,4261,2148,2147,2148,2148,2148,4196,4196,4196,4196,4196,4196,4196,4196,2116,23277,63422,65535,65535,65535,59164,12679,2082,2114,2115,2115,4195,2115,8422,50745,65535,65535,65535,65535,35954,6405,10663,50777,65535,65535,65535,65535,36018,6405,6438,8551,8616,10697,12810,10762,10762,10762,10762,10762,10730,21294,61309,65535,65535,65535,61341,23276,4325,6405,6438,8551,8551,8552,8616,46519,65535,65535,65535,65535,42325,6470,6438,6471,8583,17035,57083,65535,65535,63454,63454,63454,63454,63454,65535,65535,46551,8583,8518,8550,8551,8615,46551,65535,65535,65535,65535,65535,63454,63454,63454,63455,63455,63455,63455,63455,63455,63422,31793,6536,17035,57116,65535,65535,65535,65503,29615,4325,6438,8551,8584,27567,61342,63455,65535,65535,65535,65535,65535,48664,10663,8551,8648,10761,12874,12907,12907,12939,14988,14988,14987,14987,15020,17100,14988,14988,14988,14987,14987,14987,14987,14987,14987,12907,12907,12874,12874,10793,10761,33938,63454,65503,65503,65503,65503,65503,65503,65535,65535,63422,27567,8582,10663,10663,10728,10761,10794,14955,12907,12907,14987,14987,14987,14987,14987,14987,14987,14987,14987,14987,14987,14987,14987,14987,12939,12907,12907,46551,65535,65535,65535,65535,46486,6438,6405,38099,65535,61309,23374,8648,25487,63390,65535,65535,65535,61309,21195,6437,8583,10728,12842,12842,10794,14955,50809,65535,65535,65535,65535,38067,4325,6406,6471,6504,8584,8617,8616,36052,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,63454,65502,65535,65535,65535,65535,63422,29452,10274,12387,14467,14467,33646,65502,65535,65503,63454,63454,63454,63454,63454,63454,63454,63454,65503,57116,21163,10567,12583,8486,8389,10405,8325,8358,8325,8325,6277,6277,8358,10471,10471,4197,6277,10406,10471,10471,12519,14664,14664,14664,12551,10439,10439,10471,12584,12552,10471,6310},
-	{2115,2115,2115,2115,4229,4293,6374,6406,4294,4294,4293,2148,2148,4228,6341,4196,4196,2148,4196,4196,4196,4196,4196,2116,23277,63422,65535,65535,65535,59164,12711,2082,2115,2147,4195,4195,4195,8454,50745,65535,65535,65535,65535,35954,6405,10663,50777,65535,65535,65535,65535,36018,6405,6438,8551,8616,10729,12842,10762,10762,10794,10762,10762,10729,21294,61309,65535,65535,65535,61341,23276,4325,6438,6471,8551,8584,8584,10696,46519,65535,65535,65535,65535,42325,6438,6438,6470,6470,14922,57083,65535,65535,65535,65535,65535,65535,65535,65535,65535,46551,8550,6438,6470,8551,10696,46583,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,31825,6535,17035,57116,65535,65535,65535,65503,29615,4357,6470,8583,8584,27568,63422,65535,65535,65535,65535,65535,65535,48664,10663,8551,10696,10761,12874,12907,12907,14988,14988,14988,14987,14987,14987,15020,15020,14987,14987,14987,14987,14987,14987,14987,14987,14987,12907,12907,12874,12874,12841,36019,65535,65535,65535,65535,65535,65535,65535,65535,65535,63422,27534,8550,8583,10696,10760,10761,12842,14987,15020,14987,14987,14987,14987,14987,14987,14987,14987,14987,14987,14987,14987,14987,14987,14987,14987,12907,12907,44503,65535,65535,65535,65535,46486,6438,6405,38132,65535,61341,23374,8616,25486,63390,65535,65535,65535,61309,21195,6469,8583,10696,12841,14955,12874,14987,50810,65535,65535,65535,65535,38067,4325,4358,6471,8584,8617,8617,8617,36052,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63422,29452,8258,12386,12387,12387,31598,63454,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,59196,19083,10599,10664,10566,12453,8325,8292,8325,8325,8357,8325,10438,10471,10471,10438,4197,4196,8325,12487,10471,12519,14664,14664,14664,12552,10439,10471,10471,10471,12551,10471,6310},
-	{2115,2115,2115,2148,4261,4293,4294,6374,6407,4294,4294,4293,4293,4294,6406,4261,2148,2148,2148,4196,4196,4196,4196,2115,23277,63422,65535,65535,65535,61341,40147,33841,33841,33841,35889,35921,35889,38035,59164,65535,57116,38067,35954,21195,6437,10664,52825,65535,65535,65535,65535,38066,6405,6438,8583,8616,10729,10762,10762,10794,10795,10762,10762,10730,21294,61309,65535,65535,65535,63422,44406,35986,36018,36019,38099,38100,38100,38132,55003,65535,65535,65535,65535,42325,6438,6438,6470,6503,10729,31793,35986,46519,65503,65535,65535,65535,61341,40212,33906,25454,6470,6437,6470,6470,8616,46551,65535,65535,65535,65535,52890,33873,33873,33874,35986,35986,35986,35987,35987,35987,35987,19148,6535,17035,57116,65535,65535,65535,65535,46551,35986,36019,38099,38099,46551,63455,65535,48664,35986,35954,35954,35986,27567,8583,8583,10728,12841,12874,12907,14987,14988,14988,14988,15020,15020,15020,15020,15020,17100,15020,15020,15020,15020,15020,15020,14987,14987,14987,12907,19213,38197,40277,50809,65535,65535,65535,65535,59229,38132,35986,35986,35986,35954,17002,8550,8583,8616,10729,10794,12874,12907,15020,17068,14987,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,14987,14987,12907,12907,46551,65535,65535,65535,65535,55003,36018,35986,52858,65535,63422,46519,38132,46551,63454,65535,65535,65535,61309,21195,6469,8583,10728,12841,12874,12874,14987,50810,65535,65535,65535,65535,38099,4357,6438,6503,8584,10697,8616,8552,38067,65535,65535,65535,65535,59164,37969,33775,48566,65535,65535,65535,65535,65535,65535,65535,65535,65535,63422,29452,8258,10339,12419,10436,19050,35954,35954,35889,35921,35954,35954,35954,35954,35954,35986,52890,65535,61342,42325,38067,31728,14760,10470,8324,6243,8357,8357,10438,10438,10438,12551,12551,10438,4197,4196,8325,12519,10471,10471,14664,14664,14664,12551,10471,10471,10471,10471,10471,12552,8390},
-	{2115,2115,2115,2180,4293,4294,4294,4294,6407,6407,4326,4326,4326,4326,4326,4326,4261,2148,2148,2148,4196,4196,4196,2115,23277,63422,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,50712,8518,6437,6438,6470,12744,52857,65535,65535,65535,65535,38067,6405,6470,8583,8616,8617,8649,10730,10762,12843,10762,10730,8649,21262,61309,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,42325,6437,6405,6470,6503,6503,8583,6503,27567,63454,65535,65535,65535,57116,14889,4324,4357,6437,6470,6503,6503,8616,46551,65535,65535,65535,65535,42293,6372,4292,4357,6438,6470,6471,6503,6503,6503,8584,8584,8583,17035,57116,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,33873,6438,6437,6437,6437,6470,8583,10696,10761,12842,12906,14987,14988,15020,15020,15020,15020,15020,15020,15020,15020,17100,17100,15020,15020,15020,15020,15020,15020,15020,14987,12907,23439,61309,65535,65535,65535,65535,65535,65535,54970,12808,6470,8550,8550,8583,8583,8615,8648,10728,10761,12874,12907,12939,15019,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,14987,14987,14955,46551,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61309,21195,6469,8615,10728,12841,12874,12874,17068,52858,65535,65535,65535,65535,38099,6405,6438,6503,8551,10632,10664,8551,36019,65535,65535,65535,65535,52825,10468,4129,31663,65535,65535,65535,65535,65535,65535,65535,65535,65535,63422,29452,8290,8388,8421,8485,8486,8453,8453,6405,6405,6437,6437,8485,8486,8486,8518,42293,65535,65535,65535,65535,46551,10631,8454,6244,4163,8357,8325,6244,6309,6309,10470,12551,10438,4197,4196,8358,12519,10471,12519,14632,14664,14664,12551,10471,10471,10471,10471,10471,10471,8423},
-	{2148,2180,2115,2180,4293,4294,4294,4294,4294,6407,6407,4326,4326,4326,4326,4326,6374,4229,2148,2148,2148,4196,4196,2115,23277,63422,65535,65535,65535,65535,63422,63422,63422,63422,63422,63422,63422,63422,63422,63454,48599,8518,8583,8615,8647,12809,52857,65535,65535,65535,65535,38067,6437,8518,8615,10728,10761,12842,12874,12875,14987,14987,12875,8681,21261,61309,65535,65535,65535,65535,63454,63422,63422,63422,63422,63422,63422,63422,65503,65535,65535,65535,65535,42325,6437,6405,6471,8551,8584,8584,8584,27600,63454,65535,65535,65535,57116,14889,4324,6405,6438,6471,6504,8584,8648,46551,65535,65535,65535,65535,42325,6405,4324,4357,6438,6470,6503,8583,8583,8584,8616,8616,8584,17067,57116,65535,65535,65535,65535,63454,63422,63454,65535,65535,65535,65535,65503,33873,8550,8550,6470,8518,8583,8615,10728,12841,12874,14955,14987,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,17101,17101,15020,15020,15020,15020,15020,15020,17100,17068,25519,61309,65535,65535,65535,65535,63454,63454,52857,12776,6470,8550,8583,8615,8648,10728,10761,10793,12874,12907,14987,15019,15020,15020,17100,17100,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,14987,14987,46551,65535,65535,65535,65535,65535,65535,65535,63455,63422,63422,65535,65535,65535,65535,65535,65535,65535,61309,21195,6470,8615,10728,12842,12874,12874,17068,52858,65535,65535,65535,65535,38099,6405,6405,8486,8518,8551,10631,10664,38067,65535,65535,65535,65535,52825,10533,4194,31663,63422,63422,65503,65535,65535,65535,65535,65535,65535,63422,27437,4259,6340,8485,10631,10631,10631,10631,8518,8486,6438,8518,8518,8518,8518,8518,42293,65535,65535,65535,65535,48599,10599,8486,6309,6276,8357,8325,2115,4164,6342,10471,10471,10470,8358,10406,12487,16680,14632,12552,14664,14664,14664,12551,10471,10471,10471,10471,10471,10471,6310},
-	{2148,4228,2115,2180,4293,4293,4294,4294,4294,4326,6407,4327,4326,4326,4326,4326,4326,6342,4228,2148,2148,4196,4196,2115,23277,63422,65535,65535,65535,61277,31695,23244,23276,23276,23276,25324,25324,25324,25324,25324,19018,6372,8582,8615,8615,12841,52858,65535,65535,65535,65535,38066,6437,6470,8583,10696,10761,12842,12874,12875,12875,14987,14955,10794,23374,61309,65535,65535,65535,63422,35986,25389,25422,25454,27535,27535,27535,27567,52857,65535,65535,65535,65535,42325,6437,6438,6503,8584,8616,8648,8616,29680,63454,65535,65535,65535,59164,16969,6437,8550,8583,8583,8616,8616,10729,46584,65535,65535,65535,65535,42325,6405,4324,6437,6470,6503,8583,8648,8616,8616,8616,8648,8616,17068,57116,65535,65535,65535,65503,42292,25421,31760,59196,65535,65535,65535,65535,54938,44438,42292,14921,8550,8615,10696,10761,12874,12907,14987,15019,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,17133,17133,15020,15020,15020,15020,17100,40310,50777,52890,63454,65535,65535,65535,63422,38099,25454,23308,8582,6502,8583,8615,10696,10728,10761,10793,12874,12906,12939,14987,15020,15020,15020,15020,17133,17100,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,15020,12939,12907,46551,65535,65535,65535,65535,65535,65535,65535,42325,25454,29679,57116,65535,65535,65535,65535,65535,65535,61309,21195,6469,8615,10728,12841,12874,12874,14955,50777,65535,65535,65535,65535,38066,6340,6373,8518,8518,8519,8551,8551,38067,65535,65535,65535,65535,52825,10533,4226,14792,25389,27502,52890,65535,65535,65535,65535,65535,65535,63422,25421,4259,12711,42325,48631,46551,46583,46519,23309,8518,8518,8518,8550,8550,8550,8518,42293,65535,65535,65535,65535,48631,10631,8518,6341,6277,8357,8325,2115,2115,4228,10439,12551,14599,20842,22890,20874,18826,16745,14632,14664,14664,14664,12551,10471,10471,10471,10471,10471,10471,6310},
-	{2148,4228,2115,2180,4294,4293,4294,4294,4294,4294,4326,4326,4326,4326,4326,4326,4326,4261,4261,4228,2148,2148,4196,2115,23277,63422,65535,65535,65535,57116,12679,1,33,2082,2082,2082,2082,2082,2082,2082,2082,4292,10728,12873,10728,14987,52890,65535,65535,65535,65535,36018,6405,6438,6470,6503,8616,8648,8649,8649,8681,8681,10762,10729,21261,61309,65535,65535,65535,61341,21195,2211,4292,6437,6470,8550,8551,8615,46518,65535,65535,65535,65535,42325,8550,8550,10696,10761,12842,12842,10793,29745,63454,65535,65535,65535,59164,16969,6469,8583,10696,10729,12810,10729,10761,46584,65535,65535,65535,65535,42325,6405,4357,6438,6470,6535,8616,8648,10729,8681,8648,8681,8648,17100,57116,65535,65535,65535,65503,29615,4291,12744,55003,65535,65535,65535,65535,65535,65535,59229,19147,8550,8615,10728,12841,12874,14987,15019,15020,15020,15020,15052,15052,15052,15052,15052,15052,15052,15052,15052,15052,17133,17133,15052,15020,15020,17133,52922,65535,65535,65535,65535,65535,65535,61341,23276,4324,4356,6437,8550,8583,8648,10728,10761,10793,12874,12906,12939,14987,15019,15020,15020,15020,15020,15052,17133,17132,15052,15052,15052,15052,15052,15052,15052,15052,15052,15020,15020,12875,12842,44503,65535,65535,65535,65535,65535,65535,65503,31728,4324,10663,52890,65535,65535,65535,65535,65535,65535,61309,21195,6469,8615,10728,12841,12874,12842,14889,50777,65535,65535,65535,65535,38066,4260,8356,8518,8551,8518,8551,8519,38067,65535,65535,65535,65535,52825,10533,6243,4259,4260,6405,46551,65535,65535,65535,65535,65535,65535,63422,27437,4259,14889,59196,65535,65535,65535,63454,29648,6438,8518,8550,8550,8551,8551,8453,42228,65535,65535,65535,65535,48631,10631,8518,6341,8325,8357,8325,2115,2115,4196,10471,14697,16712,25035,25035,27116,20939,16745,12552,14664,14664,14664,12551,10471,10471,10471,10471,10471,10471,6309},
-	{2148,4228,2115,2180,4294,4293,4294,4294,4294,4326,4326,4326,4326,4326,4326,4326,4326,4326,4261,2148,4228,2148,2148,2115,23277,63422,65535,65535,65535,57116,12679,33,2082,2114,2114,2115,2115,2115,2115,2114,4195,8550,14986,14986,12873,17035,52890,65535,65535,65535,65535,40180,10663,12776,12809,12809,12842,12842,12875,12875,12875,12875,10729,8649,21294,61309,65535,65535,65535,61341,21196,4292,4325,6437,6470,6503,8583,10664,46519,65535,65535,65535,65535,42325,8550,8550,10696,10761,12874,12874,12842,31793,63454,65535,65535,65535,59164,17002,6470,8583,10696,10729,10761,10761,10794,46584,65535,65535,65535,65535,44438,12744,10663,10728,12809,12842,12874,14954,14955,17068,14987,12842,10729,19148,57116,65535,65535,65535,65503,29647,4324,12776,50777,61309,61341,65535,65535,65535,65535,61277,23373,12808,14921,12809,12841,12906,14987,15019,15020,15052,15052,15052,15052,15052,15052,15052,15052,15052,15052,15052,15052,15052,17133,17133,15052,15019,17133,52890,65535,65535,65535,65535,65535,65535,61342,27502,10630,10695,12776,12809,14921,14954,17035,17067,17099,17100,14987,14987,15019,15019,15020,15052,15052,15052,15052,17100,17165,17133,15052,15052,15052,15052,15052,15052,15052,15052,15052,15020,15019,14987,46583,65535,65535,65535,65535,63422,61277,59228,29647,6404,10695,50744,61309,61341,65535,65535,65535,65535,61309,21195,6469,10696,14954,17067,17035,14954,19115,52857,65535,65535,65535,65535,40179,10598,10598,12712,14857,14825,8551,8518,38034,65535,65535,65535,65535,52825,10598,6275,8323,6340,8486,44406,61309,61309,65503,65535,65535,65535,63422,27469,4259,14856,54970,61309,63390,65535,63454,31793,12744,12776,14857,14857,14857,14792,12679,42260,65535,65503,61309,61309,44406,10631,8518,6341,8325,8357,8325,4163,2116,4196,10471,12551,16745,22954,25067,27116,18826,14665,12552,14664,14664,14664,12551,10471,10471,10471,10471,10471,10471,6309},
-	{2148,4228,2115,2180,4294,4293,4294,4294,4294,4326,4326,4326,4326,4326,4326,4326,4326,4326,4326,4261,4261,4228,2148,2115,23277,63422,65535,65535,65535,59164,12679,33,2082,2114,2114,2115,2115,2115,2115,2115,6373,14986,15051,17099,15051,19245,54970,65535,65535,65535,65535,59196,52857,52857,52890,52890,52858,52858,52890,52890,52890,50777,23374,8584,21262,61309,65535,65535,65535,61341,21228,4324,6437,6470,8551,8584,8616,10728,46551,65535,65535,65535,65535,42357,8550,8550,8648,10729,10794,12874,12842,31825,63454,65535,65535,65535,59196,17002,6470,8583,8648,10761,10794,10794,12874,48664,65535,65535,65535,65535,59229,52857,52857,52857,52858,52890,52890,52890,52890,52890,52890,27632,10729,19148,57116,65535,65535,65535,65503,29647,6405,8550,17034,19147,33906,63422,65535,65535,65535,63454,55003,52890,46551,14986,12841,12906,15019,15020,15052,15052,15052,15052,15052,15052,15052,15052,15052,15052,15052,15052,15052,15052,17100,17165,17132,15019,17132,52890,65535,65535,65535,65535,65535,65535,65503,55003,50777,52857,52857,52857,52890,52890,52890,52922,52922,46584,19213,12939,15019,15019,15020,15052,15052,15052,15052,15052,17132,19213,17132,17100,17100,17100,15052,15052,15052,15052,15052,15052,15020,15019,46583,65535,65535,65535,65535,50744,21195,19082,12743,8517,8582,19115,21228,33873,63422,65535,65535,65535,61309,21195,6469,19180,50777,52922,52857,50745,52857,63389,65535,65535,65535,65535,59196,50777,52825,52825,52858,44438,14825,8486,38002,65535,65535,65535,65535,52857,10631,4292,8388,8389,8485,16937,19083,27534,59229,65535,65535,65535,63422,27437,6307,8518,19082,21163,38099,65503,65535,57083,52857,52857,52857,52858,52857,52793,52793,59196,65535,61277,29583,19082,16937,8518,8518,8389,8325,8357,8325,4164,2116,4196,10471,12551,12552,18826,25035,27148,20907,14665,12552,14664,14664,14664,12552,10471,10471,10471,10471,10471,10471,6309},
-	{2147,2148,2115,2180,4294,4294,4294,4294,4294,4294,4326,4326,4326,4326,4326,4326,4326,4326,4326,4326,4261,4261,4228,2115,23277,63422,65535,65535,65535,59164,12711,33,2114,2114,2115,2115,2115,2115,2147,2115,4292,12873,17099,15019,15019,19180,52922,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63422,27568,6503,21229,61309,65535,65535,65535,61342,23309,6405,6470,8583,8616,8648,10696,12809,46583,65535,65535,65535,65535,44406,8582,8583,10728,10761,12842,12874,12874,31825,63454,65535,65535,65535,59196,17034,6502,8615,10728,10794,12874,12874,12907,48664,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,36019,10729,19180,57148,65535,65535,65535,65503,29679,6437,8550,8582,6502,25486,63422,65535,65535,65535,65535,65535,65535,55035,17067,12841,12906,14987,15020,15052,15052,17100,17100,17100,17100,17100,17100,17100,17100,17100,17100,17100,17100,17100,17132,17133,15020,17132,52890,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,57116,21293,12906,14987,15019,15020,15052,15052,17100,15052,17100,17100,17132,19213,17133,17100,17100,17100,17100,17100,17100,17100,15052,15020,15019,46584,65535,65535,65535,65535,46518,8517,6404,6469,8582,10663,8615,8582,25421,63390,65535,65535,65535,61309,21228,6470,23373,63390,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,54970,16938,8518,36019,65535,65535,65535,65535,52857,12679,6340,6405,6437,8486,6438,6405,16970,59164,65535,65535,65535,63422,27405,6307,8421,8453,6437,29680,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,59164,16905,4227,6340,8486,8550,8421,8357,8357,8325,4164,2116,4196,10503,14664,12584,12584,18826,22987,18826,14665,12552,14664,14665,14664,12551,10471,10471,10471,10471,10471,10471,6277},
-	{2115,2115,2115,2180,4294,4294,4294,4294,4294,4294,4326,4326,4326,4326,4326,4326,4326,4326,4326,4327,4326,4261,4261,2147,21131,52890,54970,54970,54970,48631,10598,2082,2114,2115,2115,2115,2115,4195,4163,4195,2180,8583,17132,15051,15019,17132,46616,57148,57115,57083,57083,57083,57083,55003,55035,57083,57083,57083,57083,57083,57083,54970,25454,8616,19148,52890,57083,57083,57083,52890,21196,6438,6470,6503,8616,8616,8681,12842,40277,57116,57083,57083,57083,38099,8583,8615,10728,10793,12906,12907,12874,27632,55003,57083,57083,57083,50745,17034,8583,8648,10761,12842,12875,12907,12907,42358,57116,57083,55035,55003,55003,55003,55003,55003,55035,57083,57083,57083,57083,57083,55035,29745,10761,19148,50777,57083,57083,57083,55003,27534,8550,8583,10696,10696,25454,54970,57083,57083,57083,57083,57083,57083,48664,14986,12841,12906,14987,15020,15052,17100,17132,17132,17132,17132,17132,17132,17132,17132,17132,17132,17132,17132,17132,17132,17100,15052,17132,46584,57116,57083,57083,57083,55003,55003,55003,55003,55003,57083,57083,57083,57083,57083,57083,57083,57115,48696,19180,12906,14987,15019,15020,15052,17100,17132,15084,15084,17132,17132,17132,19213,17133,17132,17132,17132,17132,17132,17132,17100,15052,15020,42358,57116,57083,57083,57083,40212,8582,8550,8583,8615,10728,12809,10728,23373,54970,57083,57083,57083,52857,19147,8550,21261,54970,55003,54970,54970,54970,57018,57018,57018,57018,57018,57018,54970,57018,57018,57051,48534,16808,14630,35824,57019,57018,57018,57051,46454,10598,6372,6405,8486,8518,8518,8486,16938,50712,55003,54970,57018,54905,25259,6372,8421,10501,8518,27534,54970,55003,55003,57051,57051,54970,55003,54970,54970,54970,57051,57051,50680,14760,4163,6276,8518,10631,8422,8357,8358,8357,4164,4164,4197,14664,16778,16745,12552,12584,16777,16745,14665,12552,14664,14665,14665,12551,10471,10471,10471,10471,10471,10471,6277},
-	{2115,2115,2115,2180,4294,4294,4294,4294,4294,4294,4294,4326,4326,4326,4326,4326,4326,4326,4326,4326,4326,4326,4261,4260,6341,10567,10567,10566,10566,8485,4195,2114,2114,2115,4195,4260,4228,4195,2147,4228,2212,8583,17132,15052,15051,15019,19212,19180,17099,17067,17002,14921,14921,14921,14921,14954,17002,17034,17035,17035,17035,17035,12841,10728,12841,17067,17067,17034,17002,14921,10695,8583,8615,8648,10761,10794,12874,12874,17067,19148,17067,17002,17002,12809,8615,8648,10761,12874,12907,14987,14987,17067,19213,19148,17067,17034,14954,10696,10696,10761,10793,12874,12907,12907,12907,17132,19148,17067,14954,14922,14889,14889,14921,14922,14954,17034,17034,17035,17067,17067,17067,12874,10761,12841,17067,17067,17067,17034,17002,12776,8615,10696,10728,12841,14922,17067,17067,17034,17002,17001,17002,17034,17034,12809,12841,12906,15019,15052,17100,17132,17132,17132,17132,17132,17132,17132,17132,17132,17132,17133,17133,17132,17132,17132,17132,17100,15052,19213,19213,19148,17067,17002,14921,14921,14921,14889,14921,17002,17002,17034,17067,17067,17067,17099,19148,17099,12874,12906,14987,15019,15052,17100,17132,17132,17132,17132,17132,17132,17132,17165,17165,17132,17132,17132,17132,17132,17132,17132,17100,15020,19213,19213,19148,17067,17034,12841,8615,8615,10696,10760,12841,12874,12873,14954,17099,17067,17034,17002,17002,12776,8647,12841,19148,14857,10567,10567,12615,18791,18791,18790,16742,16742,16742,12646,14695,14727,18856,18759,12517,12550,16808,16872,16840,16840,16808,14759,8486,8421,12517,10534,8551,8551,8551,10567,12679,12712,12679,14662,14630,8420,8453,8486,8518,8551,12744,12712,12679,14889,16937,16937,14759,14824,10598,10566,14728,16840,14728,12615,6308,6243,6308,10631,10663,8454,8357,10438,8357,4164,4196,4229,12616,16778,14697,14664,14664,16745,18858,16745,14664,14665,14665,14665,12552,10471,10471,10471,10471,10471,10471,8390},
-	{2115,2115,2148,4261,4294,4294,4294,4294,4294,4294,4294,4326,4326,4326,4326,4326,4326,4326,4326,4326,4326,4326,4293,4228,4228,2115,2083,2082,2082,2082,2114,2114,2115,2115,4228,6374,6342,6309,4229,4261,4261,6471,10826,12907,12907,12906,10794,10761,8648,8615,8615,8550,8550,8550,8583,8583,8615,8615,8615,8616,8648,10696,10728,10728,10729,10728,10728,8648,8647,8615,8615,10696,10761,12841,12874,12906,12907,12906,12874,10793,10728,8648,8615,8615,10696,10729,10793,12906,14987,15020,15019,15019,12906,12841,10760,10728,10696,10728,10761,10793,12874,12907,12939,12939,12939,14987,12874,10729,8648,8615,8583,8583,8583,8583,8615,8615,8648,8648,8648,10728,10728,10761,10761,10793,12841,10761,10728,10696,8647,10696,10728,10761,12841,12874,14954,12841,10760,10696,8647,8615,8615,10695,10728,12841,12874,14986,15019,15052,17100,17132,17132,17133,17132,17132,17132,17132,17132,17132,17132,17133,17133,17133,17133,17133,17132,17100,15052,14987,12906,12841,10728,8647,8615,8582,8615,8583,8583,8615,8647,10696,10728,8648,8615,8648,10760,10793,12873,12906,14987,15019,15052,17100,17132,17132,17132,17132,17132,17132,17133,17132,17132,17133,17132,17132,17132,17132,17132,17132,17100,15052,15019,12906,12841,10760,10696,10696,10696,10728,12841,12873,12906,12906,12906,12906,12841,10761,10728,10695,10696,12808,10760,10793,12841,6406,2083,2083,4163,12387,12387,12387,10307,10307,10339,4195,4195,4260,8421,8356,8453,8518,10534,12517,10404,10404,8421,6405,8486,10566,12582,12679,10632,8486,8454,8421,6275,4195,6243,8226,10274,8291,10372,12420,10501,10501,10534,2147,2147,8518,8518,8518,6308,6373,2114,2082,8357,10470,6276,6244,6276,6244,6340,10567,10599,8487,8358,10438,8357,4164,4196,4229,12584,16778,16745,16745,16745,16745,16778,18858,16745,14697,14665,14665,12552,10471,10471,10471,10471,10471,10471,10471},
-	{2115,2115,2180,4294,4294,4294,4294,4294,4294,4294,4294,4326,4326,4326,4326,4326,4326,4326,4326,4326,4326,4326,4326,4261,4196,4228,2147,2115,2115,2115,2115,2115,2115,2115,4228,6374,6374,6374,6342,4261,4261,8551,12971,15084,17164,17132,12906,10793,10761,10728,10696,8616,8615,8615,8616,8648,10696,10696,10696,10728,10728,10728,10761,10761,10761,10761,10761,10760,10760,12809,10761,10761,12841,12874,12907,14987,14987,14987,12906,12874,12841,10761,10760,10760,10761,12841,12874,14987,15020,15052,15052,15019,14987,12906,12874,12841,12841,10793,12841,12874,12906,14987,15019,15020,15019,12939,14987,12874,10761,10728,10696,8648,10696,10728,10728,10728,10728,10760,10761,10761,10793,12841,12873,12874,12906,12874,12873,12841,12841,12841,12841,12874,12906,14954,14987,14954,12874,12841,12809,10760,10760,10761,12841,12873,14954,14987,15019,17100,17132,17132,17133,17133,17133,17133,17133,17133,17133,17133,17133,17133,17133,15020,12939,15019,17132,17132,17100,15019,14987,12906,12841,12809,10728,10728,10728,12808,10728,10728,10760,10761,12809,10761,10761,10761,12841,12873,12906,14954,14987,15019,17100,17132,17132,17133,17133,17133,17133,17133,17133,17133,17133,17133,17133,17133,17133,17133,17133,17132,17132,17100,15019,14987,14954,12873,12841,12841,12841,12873,12906,14986,14987,15019,15019,14987,14986,12874,12873,12841,12841,12841,14921,14922,12874,8486,2115,4163,6211,12420,8324,10372,10372,6276,10371,6276,4260,6372,8486,6373,6438,8518,14533,14566,12582,10501,8453,8486,8518,8519,8551,12615,12615,8454,6373,8389,12387,10339,12387,12355,12322,12354,12354,14403,14436,14468,12614,4195,4228,10631,10631,10599,4260,8453,4195,2115,8357,12583,8390,6276,6276,6276,8421,10567,10567,10535,10406,10438,8357,4164,4196,6277,12584,16778,16745,16745,16745,16745,16745,16777,14697,14665,14665,14665,12552,10471,10439,10471,10471,10471,10471,10471},
-	{2115,2115,2180,4326,4326,4294,4294,4294,4294,4294,4294,4326,4326,4326,4326,4326,4326,4326,4326,4326,4326,4326,4326,4293,2180,4196,4228,2115,2115,2115,2115,2115,2147,2147,4228,6374,6374,6374,6342,4261,6374,10697,10794,12939,15052,15051,12939,12906,12874,12841,10761,10761,12841,10761,10761,10761,10761,10761,10761,10761,10761,10793,12841,12842,12842,12874,12874,12841,12841,12841,14954,12874,12906,12907,14987,15019,15019,15019,14987,14987,12906,12874,12874,12874,12874,12906,14987,15019,15020,15052,15052,15020,15019,14987,14986,12906,12906,12906,12906,14987,15019,15020,15052,15052,15020,15019,14987,14987,12906,12841,10793,10793,10793,10793,10793,12841,12841,12841,12873,12874,12874,12906,12906,12906,14986,14986,15019,14954,12906,12906,14954,14987,15019,15019,15019,15019,14987,14986,14954,12874,12874,12874,14954,14954,14987,15019,17100,17100,17132,17133,17133,17133,17133,17133,17133,17133,17133,17133,17133,17165,17164,17133,17133,17132,17132,17132,17132,17100,15019,14987,14954,12874,12874,12873,12873,12873,14954,12874,12874,12874,12874,12874,12906,14954,14954,14954,14987,15019,15019,17100,17132,17132,17133,17133,17133,17165,17165,17165,17133,17133,17133,17133,17165,17133,17133,17133,17133,17133,17133,17132,17100,15019,15019,14987,14954,14954,14954,14987,15019,15019,17100,17100,17100,17100,15019,14987,14986,14954,14954,12809,6405,6373,10664,8519,2116,4164,6212,12452,6308,6308,6308,4260,6308,6308,4260,6373,8486,6373,8486,8519,10534,10566,10631,10599,8519,8519,8551,8519,8518,8422,8422,6373,8389,12388,14403,14403,14403,14403,14403,14403,14403,16483,16451,16483,12614,4228,4228,10664,10696,10664,6340,8486,4195,4163,8389,10503,12551,8390,8357,8325,8421,10599,8422,10438,10438,10438,8358,4196,6276,10503,14697,16777,16745,14632,12584,14664,16745,14697,12584,14665,14697,14697,12584,10471,10471,10471,10471,10471,10471,10471},
-	{2115,2115,2180,4294,4326,4326,4294,4294,4294,4294,4294,4294,4294,4326,4326,4326,4326,4326,4326,4326,4326,4326,4326,4326,4293,2180,2148,2148,2115,2115,2115,2115,4261,4293,6342,6342,6374,6374,6406,6439,8681,10794,12907,15019,17165,17197,17196,17164,17132,15083,15051,15051,17099,17132,15051,15051,15051,12906,12874,12874,12874,12874,12906,12906,12906,12906,12906,12906,12906,12906,12938,12938,14987,15019,15019,15052,15052,15052,15019,15019,14987,14987,14987,14987,14987,15019,15019,15052,15052,15052,15052,15052,17100,15019,15019,15019,15019,15019,15019,15019,15052,15052,17100,17132,15052,15052,15020,15019,15019,14987,12906,12906,12906,12906,12906,12938,12938,12938,12938,12939,14987,14987,15019,15019,15019,15019,17099,17100,15019,15019,15019,15051,17100,17100,17132,17100,17100,17132,15019,15019,15019,15019,15019,15019,17099,17100,17132,17132,17164,17165,17165,17165,17165,17165,17165,17165,17165,17165,17165,17165,17165,17165,17165,17165,17165,17164,17164,17132,17100,17100,15019,15019,15019,14987,14986,14986,15019,17067,15019,14987,15019,15018,15019,15019,15019,15019,15019,17099,17100,17132,17133,17165,17165,17165,17165,17165,17165,17165,17133,17133,17133,17132,17165,17133,12972,12972,15052,17165,17165,17164,17132,17132,17100,15051,15019,15019,14987,14987,17067,17132,17132,17132,17132,17132,17132,17100,15051,15019,14922,6374,4164,4164,6341,6341,4196,4164,6244,12453,6341,6341,6341,6341,6341,6309,6309,6341,8486,6406,8519,8551,8551,10599,10631,10664,10631,10567,10567,6374,6374,6374,6374,4227,14533,16484,16451,16451,16451,16451,16451,16451,16451,18564,16517,8259,10567,4228,4260,12744,12776,12744,6373,8518,4228,4164,10470,10470,10438,12551,10470,8357,10470,12616,8390,10438,10438,10438,10438,10438,12583,16777,16777,16777,14697,12584,12584,14665,16745,14697,12584,14697,14697,14697,12552,10471,10471,10471,10471,10471,10471,10471},
-	{2115,2115,2180,4293,4294,6407,4326,4294,4294,4294,4294,4294,4294,4294,4294,4326,4326,4326,4326,4294,4326,6471,6471,6471,4358,4294,4294,4293,4228,2212,4292,2180,4196,4293,4326,6342,6342,6374,12906,17165,15116,15084,17197,17132,15019,15019,15019,15019,14987,12939,12939,12938,12938,14987,15019,12938,12938,12906,12907,12906,12906,12938,12939,12939,12939,12939,14987,12939,12939,12939,12939,15019,15019,15019,15052,15052,15052,15052,15052,15052,15019,15019,15019,15019,15019,15052,15052,15052,17132,17132,17132,17132,17132,15052,15052,15052,15052,15052,15052,17100,17100,17132,17132,17132,15084,15084,15052,15052,15051,17100,17100,15019,15019,15019,15019,15019,15019,15019,15019,15019,15051,15052,15052,17100,17100,17100,17100,17132,17132,15052,17100,17132,17132,17132,17164,17132,17132,17132,17164,17132,17100,17100,17100,17132,17132,17132,17164,17164,17165,17165,17165,17165,17165,17165,17165,17165,17165,17165,17165,17165,17165,17165,17165,17165,17165,17165,17165,17164,17132,17132,17132,17100,17100,17099,17099,15051,17099,17132,19213,17132,17132,17132,17100,17100,17100,17100,17132,17132,17132,17164,17165,17165,17165,17133,17133,17133,17133,15085,12972,12972,12940,12971,12971,12972,12940,15020,17165,17165,17165,17164,17132,17067,14987,14987,14987,14955,10729,10697,12874,17164,17164,17164,17164,17164,17164,17132,17132,17100,8519,4196,4164,4164,6277,8422,6277,4196,6244,14501,8389,6341,6341,6341,6341,8357,10373,6373,8486,8454,8519,10599,8551,8551,8551,8486,8487,14566,8422,6374,6374,6374,6406,8421,12485,18629,16484,16451,16451,16451,16451,16451,16451,16484,10339,4164,10599,4228,4260,12777,12777,12777,6373,10599,4228,4164,10471,12551,8358,10438,12583,10438,8357,10438,10438,10438,10438,10438,12486,12518,16712,18858,18825,16777,16745,14664,14664,14697,16745,14697,14632,14697,14697,14665,12584,12551,12519,12551,14664,12552,10471,10471},
-	{2115,2115,2180,4293,2246,4294,4326,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,6439,12939,15084,15084,8681,6503,6503,6503,8551,12842,17132,10697,8519,8487,6342,6407,8552,8552,12971,15117,15052,15052,17197,15084,15019,15019,12971,12971,12939,12939,12939,12939,12939,12939,12939,12939,12939,12939,14987,14987,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15051,15052,15052,15052,15052,15052,17132,17132,15052,15052,15052,17100,15052,15052,17100,17132,17132,17132,17133,17132,17132,17132,17132,17132,17132,17132,17132,17132,17132,17132,17133,17133,17133,17132,17164,17132,17132,17132,17132,17165,17132,17100,17100,17100,15084,17132,17132,17132,17132,17132,17132,17132,17132,17132,17164,17164,17164,17132,17132,17165,17165,17165,17165,17165,17165,17165,17164,17165,19245,17164,17164,17164,17164,17164,17165,17165,17165,17197,17197,17197,17197,17197,17197,17197,17197,17197,19245,19245,17197,17197,17197,17197,17197,17197,17197,17197,19245,19277,19277,19245,19245,19245,19245,19245,19245,19245,21357,21390,23470,21390,21358,19245,17132,17164,17164,17164,17164,19245,19277,19277,19277,17165,15052,15052,13004,13004,13004,15020,12972,12940,12940,12940,12940,12940,15052,17197,17197,19245,17197,17068,8551,8519,8519,8519,8519,10632,10665,12842,17165,17165,17165,17165,17165,17165,17165,17164,17132,6406,4164,4196,4196,4196,6309,8422,6277,8292,14533,8421,6374,6342,6342,6342,6341,6373,6373,6373,8421,10502,8422,6374,6374,6374,6373,8421,6374,6374,6374,6374,6374,8422,10437,14436,18564,20645,18532,16483,18499,18531,18531,16484,16516,12388,6277,10632,4228,4261,12777,12841,12809,8453,10599,6276,6245,12551,12551,10438,10438,10470,10470,10438,10438,10439,10471,10438,10438,12518,14599,16712,18858,16810,16778,16778,16777,16777,16745,16745,16745,16745,16745,14697,14665,14665,14665,14664,14664,14664,12584,10471,10471},
-	{2115,2115,2180,4293,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4358,10794,15117,13004,15052,15020,15020,12972,15052,17165,17197,15052,13004,12939,6471,10697,12972,15084,15117,12972,10794,12907,15052,15019,15019,15019,15019,15019,15019,15019,15019,15019,12971,12971,12971,12971,15019,12971,15019,15019,15019,15019,15019,15019,15020,15020,15020,15020,15020,15052,15052,15052,15052,15052,15084,17132,17132,17132,17132,17132,17132,17132,17132,17132,17132,17132,17132,17164,17165,17165,17165,17165,17165,17164,17164,17164,19245,17165,17165,17165,17165,17165,17165,17165,17165,17165,17165,17165,17165,17164,17165,19245,17164,17132,17132,17164,17164,17164,17164,17165,17165,17165,17165,17165,17165,17132,17100,17165,17100,17068,17068,19213,19245,19245,19245,17197,17197,19213,17165,17165,19245,19245,17165,17165,17165,17197,17197,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19278,19277,19245,17197,17197,17197,19245,19245,19245,19245,21357,23470,21422,21390,21390,21390,21390,21390,21390,21390,19245,17165,19245,19245,17165,17165,17165,17165,17165,17165,17165,21358,23470,23470,21390,19245,19213,19245,19245,19245,19245,19245,17133,15052,15052,15052,15052,15052,15085,17197,19245,19213,15019,12842,8487,8486,8486,8454,6406,8487,10664,12842,17197,17197,17197,17197,17197,19245,17197,19245,17165,8486,4164,4196,4196,4196,4196,6309,8390,8325,12453,6341,6341,6309,6342,6374,6374,8454,6341,6341,6373,8422,8422,6341,6341,6341,6309,6341,6374,6374,6374,6374,6374,8422,12485,16484,16483,18564,20645,18532,18499,18531,18532,16581,16581,14534,10405,10502,6309,6309,14857,14890,12744,10469,12680,6309,8390,12519,12551,10438,10438,10438,10438,14664,12551,10439,10439,10439,10438,12519,12551,16713,18858,18858,16778,16778,16778,16777,16777,16777,16745,16745,16745,14697,14665,14665,14697,14665,14664,14664,12584,10471,10471},
-	{2115,2115,2180,4293,4294,4294,4294,4294,4326,4326,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,6471,12971,12939,10794,10794,10794,10794,10794,10794,10794,10794,10794,10826,13004,10826,12939,12939,12971,12972,10794,10794,12939,17132,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15052,15052,15052,15052,15052,15052,15052,15052,17100,17132,17132,17132,17132,17132,17132,17132,17132,17132,17132,17164,17164,17164,17164,17164,17164,17164,17164,17165,17164,17164,17165,17165,17165,17165,17165,17197,17197,17165,17165,17165,17165,17165,17165,17165,17165,17165,17165,17165,17165,17165,17165,17165,17165,17197,17133,17035,17035,17035,17035,17035,17035,16971,14858,17036,16906,14761,14793,17003,17036,17036,17036,17035,17165,19245,19213,17197,19245,21325,19245,17197,19245,19245,19245,19245,19245,19245,19245,19245,19245,17197,17197,19277,21358,21390,23470,21390,21358,21358,21358,21357,21357,21357,19277,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,17165,17165,17165,17165,17165,17165,17165,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,17165,8584,6439,8487,8486,8486,8519,8519,8552,10665,14890,19245,17197,19245,19245,19245,19245,19245,17068,12809,6342,4196,4196,4196,4196,4196,4196,4197,8390,6277,4229,6277,4196,6309,6374,8422,8422,6277,6309,6374,6374,6374,6341,4196,4196,2115,4228,6374,6374,8422,6374,10502,12518,12518,16516,16483,18531,18564,18597,18532,18532,16550,14599,16582,16582,14501,8260,6276,6309,14858,14890,8486,4196,12680,6309,10438,10439,10438,10471,10471,10438,8325,12551,14664,12551,10438,10438,10439,12519,14600,16713,18858,18858,18858,16778,16778,16777,16777,16777,16777,16745,16745,16745,14697,14665,14665,14665,14665,14664,12584,10471,10471},
-	{2115,2115,2148,4261,4294,4294,4294,4294,4326,6407,4326,4294,4294,4294,4294,4294,4294,4294,4294,4294,4391,8745,10794,10794,10794,10794,10794,10794,10794,10794,10794,10794,10826,13036,13004,15084,12972,10826,8746,10762,10794,15019,15052,15052,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15052,15052,15052,15052,15052,15052,15052,15052,15052,17132,17132,17132,17132,17132,17132,17132,17132,17132,17164,17164,17164,17164,17164,17164,17164,17164,17164,17165,17165,17165,17165,17197,17197,17197,17197,19245,19277,19245,17197,17197,17197,17165,17197,17197,17197,17197,17197,17197,17197,19245,17197,17197,19245,19213,17067,16971,14761,14761,14761,14761,14761,14761,14761,14729,14761,14761,14729,14729,14761,14761,14761,14729,14761,16938,17067,21358,21390,21390,23470,23470,21390,21390,21390,21390,21390,21390,21390,21358,17067,17003,19180,21390,21390,23470,25583,25615,27696,25615,25583,25583,25615,25615,25615,23503,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21358,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,12842,8519,8486,8486,8486,8551,12745,10697,10665,12810,17100,17100,14987,14987,19213,19245,19245,10697,8486,6341,4196,4196,4196,4196,4196,4196,4196,6342,8390,4196,4196,4196,4196,6309,6309,4196,4196,6309,6374,6374,6374,6341,4196,4196,2115,2115,6341,8422,8422,6374,14566,16517,14404,14436,14404,12355,10307,14566,18759,16582,14599,14600,14567,14567,14567,10405,4164,6309,14858,12745,6341,6276,12713,8422,10439,12519,12519,12519,12519,10471,12519,12519,12551,14664,12519,10438,10439,12519,14600,16745,18858,18858,20971,18858,16778,16778,16777,16777,16777,16745,16745,16745,14697,14697,14665,14665,14665,14665,12584,10471,10471},
-	{2115,2115,2147,2213,4294,4294,4293,4294,4294,4326,6407,4326,4294,4294,4294,4293,4294,4294,4294,4358,10762,12971,12971,12971,12971,12971,12971,12971,12971,12972,10859,8746,10794,10923,12972,10859,10794,10762,10794,10794,12907,15019,15019,15052,15052,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15020,15020,15052,15052,15052,15052,15052,15052,15052,15084,15052,15084,15084,17132,17132,17132,17132,17132,17132,17164,17164,17164,17164,17164,17164,17164,17165,17164,17165,17165,17165,17165,17165,17197,19245,19245,19245,17197,19245,19277,19277,19245,19245,19245,19245,19245,19245,19245,17197,17197,17197,19245,19245,19245,19245,19245,14955,14761,14729,14761,14761,14761,14729,14729,14729,14761,14761,14729,14761,14761,14761,14729,14729,14729,14729,14761,14761,14793,19116,19148,21293,21422,23470,23471,23438,23438,21390,21390,21390,21390,21229,16841,14728,17003,23438,21325,19277,21390,21390,21422,23470,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21422,21422,21422,21422,21422,21390,21390,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,19245,17133,8551,8486,8486,8486,8486,12745,12778,10665,10665,12810,12778,10632,12745,19181,19245,15019,6406,8487,6341,4196,4196,4196,4196,4196,4196,4196,4196,6310,6309,4196,4196,4196,4196,4196,4196,4196,6342,8454,6374,8422,8422,4196,2115,2083,2115,6341,8422,6374,6374,12420,14403,14404,14436,8259,4131,4131,8486,16906,16777,14632,14632,14632,14632,14632,14632,4196,6309,14825,8454,4163,8358,12616,12519,12487,12519,12519,12519,12519,12519,12519,12519,12519,14631,14664,12551,12519,12519,14600,16745,18858,18858,20971,18858,16778,16778,16778,16777,16777,16745,16745,16745,14697,14697,14665,14697,14665,14665,14632,12552,12584},
-	{2115,2115,2115,2180,4294,4294,4261,4294,4294,4294,4326,4326,4294,4294,4293,4294,4294,4294,4294,6471,17165,15149,15149,15149,15149,15149,12971,12939,12939,12939,10826,10794,10794,8746,8746,10794,10794,10794,8746,10826,15019,15051,15019,15019,15019,15084,15051,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15019,15051,15051,15052,15052,15052,15052,15052,15052,15084,15084,15084,15084,15084,15084,17132,17132,17132,17132,17164,17164,17164,17164,17164,17164,17164,17165,17197,17197,17197,17197,17197,17197,17197,17197,17197,17197,17197,19245,19245,19245,19245,19309,19277,19245,19245,19245,19245,19245,19277,19277,19245,19245,19245,19277,19277,19277,19245,10696,10535,12615,14761,14761,14729,14729,14729,14729,14761,14761,14761,14761,14761,14761,14729,14729,14761,14729,14729,14761,14761,14729,14729,14793,16938,16970,17003,19051,16970,16970,16970,16970,19148,16906,14761,14761,16971,19245,21390,23470,23470,23470,23470,23470,23470,23470,23470,23470,23470,23470,23470,23470,19309,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,17165,8551,8486,8486,8486,8486,10632,12778,14826,12713,10665,12681,12681,12745,19213,19277,12842,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,6309,6277,4196,4196,4196,4196,4196,4196,6342,10535,8454,8422,12518,4196,4164,4163,2115,4228,8421,8422,8422,12452,14404,14404,8260,4195,6276,6244,12647,14793,14696,14632,14632,14632,14632,14632,14632,10471,10470,10470,12519,10438,10438,12519,12487,12519,12519,12519,12519,12519,12518,12519,12519,12519,12518,14631,16712,12519,12519,16712,18858,20971,20939,20939,18858,18858,16778,16778,16778,16745,16745,16745,16745,16745,14697,14697,14665,14665,14665,14664,14664,14664},
-	{2115,2115,2115,2180,4294,4294,4293,6471,8649,4325,4326,4293,6406,4294,4293,2246,8616,10762,8649,8681,12971,10923,10891,10891,10891,10891,10826,10826,10794,10794,10794,10826,10826,10826,10826,10794,10794,10794,10826,12939,15051,15051,15051,15051,15051,15084,15084,15051,15019,15019,15019,15019,15019,15052,15020,15019,15051,15051,15051,15051,15052,15052,15051,15052,15084,15084,15084,15084,15084,15084,15084,15084,17132,17132,17132,17164,17164,17164,17164,17164,17164,17197,17165,17197,17197,17197,17197,17197,17197,17197,17197,17197,19245,19245,19245,19245,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,12712,8422,8454,12615,14761,14761,14729,14729,14729,14761,14761,14761,14761,14729,14729,14729,14729,14729,14729,14729,14729,14729,14729,14729,14729,14729,14729,14761,16841,16842,14761,14761,14761,16874,14793,14761,14729,16971,19277,21358,21390,21390,21390,21390,21390,21390,23470,21422,21390,21390,21390,21390,21390,19309,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,17132,8551,8486,8486,8486,8486,10632,12713,12745,12713,12713,12681,12681,12745,19213,19309,14858,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4164,4196,6276,6245,4196,4196,4196,4196,4196,6309,8454,10535,10502,12518,4196,4196,4164,2083,2115,8421,8422,8422,12453,10340,8292,4196,6244,10405,8357,14728,14793,14664,14600,14632,14632,14632,14632,16680,16712,14664,12519,12519,16712,14600,12519,12519,12519,12519,12519,12519,12519,12519,12519,12519,12519,12519,12519,14632,16712,12519,14664,20971,20971,20971,20971,18858,18890,20971,16778,14697,14664,16745,16777,16745,16745,14697,14632,12552,12552,12551,12584,14664,14664},
-	{2115,2115,2115,4390,8681,10858,12971,13004,13004,10826,12971,6535,4358,6439,4326,6471,10794,10859,10827,10827,10826,10826,10826,10826,10826,10826,10826,10826,10826,10826,10826,10826,10826,10826,10826,10826,10826,10826,10826,15051,15051,15051,15051,15051,15051,15051,15084,15084,15051,15019,15052,15052,15051,15052,15052,15051,15051,15052,15052,15052,15052,15052,15052,15052,15084,15084,15084,15084,15084,15084,17132,17132,17132,17132,17164,17164,17164,17164,17164,17165,17197,17197,17197,17197,17197,17197,17197,17197,19245,19245,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,21358,21357,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19309,19277,12776,8454,8422,10502,12615,14761,16809,16809,14761,14761,14761,14761,14729,14761,14761,14761,14761,14729,14761,14761,14761,14761,14761,14729,14729,14729,14761,14761,14761,16841,16842,14761,14761,14761,14729,14729,16809,16906,17068,19277,19277,19277,19277,19277,19277,19277,19309,21390,19309,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,10761,8518,8486,8486,8486,8454,10632,12713,12713,12713,12681,12681,12680,12745,19213,17068,6374,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,2116,4164,2115,6277,6277,4196,4196,4196,4196,6309,6374,8454,10470,12518,4196,4196,2115,2083,2115,8389,8422,8422,8357,6212,6212,4196,6244,10405,8325,14728,14793,14664,14632,14632,14632,14632,16680,16680,16712,16712,14632,12487,14599,16713,14600,12519,12519,14567,14567,14567,14567,14599,14599,14567,14567,14567,14567,12519,14632,16712,16712,20938,20939,20939,20938,18858,18858,18891,18858,14664,14632,16745,16777,16745,16745,14697,12552,10471,10471,10471,12552,14632,14632},
-	{2115,2115,2115,8616,13036,15149,15213,15181,15181,15181,15181,13036,13003,15084,15052,10826,10826,10826,10827,10827,10826,10827,10859,12939,10827,10826,10826,10826,10826,10826,10826,10826,10826,10826,10826,10826,10826,10826,12971,15051,15051,15051,15051,15051,15051,15051,15051,15084,15084,15052,15052,15052,15051,15051,15052,15051,15052,15052,15052,15052,15084,15084,15084,15084,15084,15084,15084,15084,15084,17132,17132,17164,17164,17164,17164,17164,17164,17164,17165,17165,17197,17197,17197,17197,17197,17197,17197,19245,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19309,21390,19310,19277,19309,19277,19277,19277,19309,19309,19309,19309,19309,19309,19180,10632,8454,8422,8454,14761,19051,19084,19083,19084,21100,14793,10567,16906,21132,21132,16906,10535,14825,19084,19084,19051,16841,14761,14761,14761,14729,14761,14729,14761,16841,16841,14761,14761,14761,14761,14761,16841,16906,19180,21358,19310,19309,19309,19309,19309,19277,21357,21390,19309,19277,19309,19309,19309,19309,19309,19309,19309,19309,19277,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19277,10664,6438,8486,8486,8454,8454,10632,12713,12713,12681,12745,14793,12681,12681,12777,12648,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,2116,4164,2083,4163,6277,4229,4196,4196,4196,6309,6374,6373,10502,14631,6244,4196,4163,2083,2115,8389,8422,8422,8389,4164,4196,6244,8325,10405,8357,14728,16841,16712,16680,16680,16680,16680,16680,16680,16712,16713,16680,12519,12519,14600,16745,14600,14567,14567,14567,14567,14567,14599,14599,14599,14567,14567,14567,14567,12519,14632,18858,20939,20938,20906,18858,18858,20939,18890,18890,16777,14632,16745,16777,16745,16745,16745,12584,12519,10471,10471,12552,14632,14632},
-	{2115,99,2115,6471,10859,13036,13101,15149,17261,17229,15116,15149,15149,15149,15149,13036,10826,10826,10826,10826,10859,10826,10859,12939,10891,10859,10858,10858,10859,10859,10859,10827,10826,10826,10826,10826,10826,10826,13003,15052,15052,15052,15052,15052,15051,15051,15051,15052,15084,15116,15051,15051,15052,15052,15052,15052,15052,15052,15084,15084,15084,15084,15084,15084,15084,15084,15084,15084,15084,15084,17164,17164,17164,17164,17164,17164,17164,17164,17197,17197,17197,17197,17197,17197,17197,17197,17197,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19309,19309,19309,19277,19309,21390,21357,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19180,10567,8454,8454,10534,16906,21164,21196,21164,16970,10567,14825,21164,21164,19019,12680,14792,21131,21164,21164,21164,19083,21131,21131,16938,14761,14729,14729,14761,14761,14761,14761,14761,14761,14761,14729,14761,16841,21293,23535,23535,23535,25583,23470,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,21390,21390,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19277,10664,8486,8486,8486,8454,8454,10632,12713,12681,12680,12680,14793,14761,12680,12648,10535,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,2116,4163,2083,2083,2115,6309,4196,4196,4196,6309,8422,8422,10470,14599,8358,4196,4196,4164,4163,8389,8422,8422,6308,4163,6244,4164,8325,10438,10502,16841,16809,16680,16648,16680,16680,16680,16680,16680,16712,20906,16680,14567,14567,14567,14600,18793,14600,14599,14599,14599,14599,14599,14599,14599,14599,14567,14599,14567,14567,14567,18825,23084,20938,20938,20906,18858,18858,16777,16745,14697,14664,16745,16777,16777,16745,16745,12584,12519,12519,10471,12584,14664,14664},
-	{2115,67,2179,8616,10858,10891,10923,10923,10923,10923,10923,12971,12971,12971,10923,13004,13004,10923,10891,10858,10859,10858,10858,10858,12971,12939,10890,12971,15052,15052,15084,12939,10858,10858,10858,10858,10858,12971,15084,15083,15052,15052,15052,15052,15052,15052,15052,15052,15084,15116,15116,15083,15052,15052,15052,15052,15052,15052,15084,15084,15084,15084,15084,15084,15084,15084,15084,15116,15116,15116,17164,17164,17164,17164,17164,17164,17197,17197,17197,17197,17197,17197,17197,17197,17229,19277,19277,19277,19277,19277,19277,19277,19277,19277,19277,19309,19309,19309,19309,19309,19309,19309,19309,19309,21357,21422,21390,19309,19309,19309,19309,19309,19309,19309,21357,21357,21357,19245,10567,8454,8454,8454,10534,16906,21164,21164,16970,14825,21164,21164,19051,14792,19051,21164,21164,21164,21164,21164,21164,21164,21164,21164,16906,16841,14761,14761,14729,14729,14729,14729,14729,14761,14729,14729,14826,19180,21390,21390,21357,21357,23470,19309,19309,19309,19309,21390,21390,21357,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19277,10664,8486,8486,8454,8454,8454,10632,12713,12681,12680,12680,12680,14793,14729,12648,10535,4196,4196,4196,4196,4196,4196,4197,4196,4196,4196,4196,4196,2083,2083,2083,2083,2083,4196,4196,4196,4196,6309,8422,8422,10470,12518,6277,8358,4197,4196,4163,8389,8422,8422,6276,4163,8357,6244,8325,12583,16809,16841,16744,16680,16680,16680,16680,16680,16680,16680,16712,18761,16680,14567,14567,14567,14567,16680,18793,14599,14567,14567,16647,16647,16647,16647,16647,14599,14599,14599,14567,14567,16712,23052,23052,20938,20938,18858,16713,14664,16745,16745,16778,18858,16777,16777,16745,16745,12584,12519,12519,12552,14665,14665,14664},
-	{2147,4292,8680,15149,15181,13133,15181,15181,15148,13068,13068,13068,13068,13068,15116,15116,15149,15149,15085,10891,10858,10858,10858,10891,15051,15084,15084,15084,15084,15084,15084,15084,12971,10891,10858,10858,12971,13003,13003,12971,15051,15084,15052,15084,15084,15084,15052,15052,15084,15084,15116,15116,15084,15084,15084,15084,15084,15084,15084,15084,15084,15084,15084,15084,15084,15084,15116,15116,17164,17164,17164,17164,17164,17164,17197,17197,17196,17196,17196,17197,17197,17197,17229,19277,19277,19277,19277,19277,19277,19277,19309,19277,19309,19309,19309,19309,19309,19309,19310,19309,19309,19309,19309,19309,19309,21390,21422,21390,21390,21390,19309,19309,19309,19309,21357,21358,21358,19245,10567,8422,8454,8454,8454,10534,16938,21164,21164,21164,21164,19051,14792,19051,21164,21164,21164,21164,21164,21164,21164,21164,21164,21164,21164,19019,16809,14761,14761,14761,14761,14729,14761,14761,14761,14761,17035,21358,21390,21293,17068,17002,21357,21358,21357,21357,19309,19309,21390,21390,21357,19309,19309,19309,19309,19309,19309,19309,21390,19309,21357,21357,19309,19309,19309,19309,21357,19309,21357,21389,21357,21357,21357,21357,21357,21357,21357,21357,21357,21357,21357,21357,21357,21357,21357,21357,21357,21357,21357,21389,21325,10664,8486,8486,8454,8454,8454,10600,12681,12681,12680,12680,12680,12680,14696,14729,10535,4196,4196,4196,4196,4196,6277,6310,4196,4196,4196,4196,4196,2083,2083,2083,2115,2115,4196,4196,4196,4196,6309,8422,8422,10470,12518,6244,6309,8358,4196,4164,8389,8422,8422,6276,4164,6244,6244,6276,8389,16809,18889,16744,16680,16680,16680,16680,16680,18728,18728,18760,18760,16680,14599,16647,14567,14567,14599,16647,16680,12486,12486,16648,16648,14599,14567,16647,16647,16647,14599,14599,14567,16680,20939,23084,23051,20938,18858,16713,14664,16745,16810,16777,18923,18858,16777,16745,16745,12584,12519,12551,12551,12584,14697,14697},
-	{6567,10923,15149,15181,15181,15181,13068,13068,13003,10858,10858,10858,10859,10859,10859,10859,10859,12971,12971,12939,12939,10891,15052,15116,15084,15084,17196,17164,15084,15084,15084,15084,15084,12971,10858,10891,10891,10858,10858,10858,10858,13003,15084,15084,15084,15084,15084,15084,15084,15083,15084,15116,15116,15084,15084,15084,15084,15084,15084,15084,15084,15084,15084,15084,15084,15116,15116,15116,15116,15116,17164,17164,17164,17164,17197,19309,17229,17196,17196,17196,17196,17197,17229,17229,19277,19277,19277,19277,19277,19277,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19341,21390,21390,23502,25583,23535,21422,21357,21357,19309,19309,21358,21390,21390,19277,12777,8454,8454,8454,8422,8454,10535,16906,19019,21164,19051,14793,19051,21164,21164,21164,21164,21164,21164,21164,21164,21164,21164,21164,19051,16841,14761,14761,14729,14729,14729,14761,14729,14729,14728,14728,17035,21357,19277,16938,16809,16906,19148,19148,21325,21358,21357,21357,19309,21390,21422,21357,19309,19309,19309,19309,19309,19309,21422,21390,21389,19309,19309,21357,21357,21357,19309,19309,21389,21389,21389,21389,21389,21389,21389,21389,21422,23502,23502,23502,23502,23502,23502,23502,23502,23502,21422,21390,23502,21390,17100,8551,8486,8486,8454,8454,8454,10600,12681,12681,12680,12680,12680,14696,14696,16809,12616,4196,4196,4196,4196,4196,4196,4197,4196,4196,4196,4196,4196,2083,2083,2083,4163,4163,4196,4196,4196,4196,6309,8422,8422,10470,14566,6244,4196,8358,8357,4196,8389,8422,8389,6244,6244,6245,6277,8357,8389,16744,18857,18825,16680,16680,18728,18728,18728,18728,18728,18760,18760,16680,16680,18760,16647,16647,16647,16647,18760,12518,10405,12486,14566,12518,10373,16647,16648,16647,16647,14599,14599,18793,20939,20939,23052,20971,18858,16713,16713,16777,16745,16777,18891,20971,16810,16745,16745,12584,12551,12551,12552,14664,16777,16745},
-	{13004,13036,13036,13036,13036,13036,10858,10858,10858,10858,10858,10858,10859,10859,12971,12971,12971,12971,13004,15084,13003,12971,15148,17261,13003,12971,13003,15084,15052,12971,12971,13003,15116,13036,10955,13004,13004,13036,13004,10858,10858,10891,12971,13004,15084,15084,15084,15084,13035,13035,13035,15084,15116,15084,15084,15084,15084,15084,15084,15084,15116,15084,15084,15116,15116,15116,15116,15116,15116,15116,15116,17164,17164,17196,17229,21422,17261,17196,17229,19341,19341,19373,19373,21422,21421,21389,19309,19277,19277,19277,19309,19309,19309,19309,19309,19309,19309,19309,19309,19309,19341,21390,21358,17132,15019,17100,19245,19245,21389,21389,21389,21389,21389,21389,21390,21390,21390,21390,19277,12776,8454,8422,8454,8454,8454,8454,12680,19051,14825,19051,21164,21164,21164,21164,21164,21164,21164,21164,21164,21164,21164,19051,16841,14761,14761,14761,14729,14729,14729,14728,14728,14728,12648,12648,17035,19341,19277,17035,16874,16809,14761,14761,17003,19148,19309,21389,21357,21389,21390,21422,21389,19341,19341,19341,19341,19341,21389,21422,21422,21389,21389,21389,21389,21389,21389,21389,21389,21389,21390,21390,21390,21390,21390,21390,23502,25583,23535,23535,23535,23535,23535,23535,23535,25583,23502,23470,25583,23470,10728,6438,8486,8486,8454,8454,8454,10600,12681,12681,12680,14696,14696,14696,14696,14696,14696,6277,4196,4196,4196,4196,4196,4196,4196,6277,6245,4196,4164,2083,2114,2115,4163,4163,4196,4196,4196,4196,6309,8422,8422,10470,14566,6244,6244,6244,8357,6276,8389,8422,8357,6244,6245,6245,6245,6245,12486,16712,16712,20841,20840,18728,18728,18728,18728,18728,18728,18760,18760,18728,16615,18728,18792,16648,16647,16647,16647,12453,6243,6243,8291,10404,10405,16648,16648,16648,16647,16647,16712,20906,23019,22987,20938,20938,18858,16712,16713,18825,16713,14664,18890,18858,18890,16809,16745,12584,12551,10503,12552,14664,14665,14664},
-	{8778,8778,10826,10826,10826,8810,8810,10858,10858,10858,10858,10858,10858,10891,12971,12971,12971,12971,12971,12971,10890,10890,10923,13036,13036,13036,13036,13036,15116,13036,13036,13036,13036,13036,13036,13036,13036,13068,13004,10891,10858,10858,8810,10891,12971,12971,12971,15084,15084,15084,15084,15084,15084,15084,15084,15084,15084,15084,15084,15116,15116,15116,15116,15116,15116,15116,15116,15116,15116,15116,15116,17196,17196,17197,17196,17196,17197,17197,17229,19342,21422,21422,21422,21422,21454,21422,19309,19277,19277,19309,19309,19309,19309,19309,21357,17132,12939,12939,12939,12939,12939,12971,12940,8681,6568,6569,6568,6568,15020,23502,21390,21390,21390,21390,21390,21390,21390,21390,21390,19245,14922,12680,8454,8454,8422,8454,10567,12680,14825,21164,21164,21164,21164,21164,21164,21164,21164,21164,21164,21164,19083,16873,14761,14761,14761,14761,14761,14729,14728,14696,14696,12648,12648,14793,19180,19341,21357,17035,14793,16841,16809,14729,14729,14793,19277,19341,21389,21389,21389,21422,21422,21389,19341,19341,21389,21389,21389,21390,21422,21389,21389,21389,21389,21389,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21358,10728,6438,8486,8454,8454,8454,8454,10600,12681,12681,14696,14696,14696,14696,14696,14696,12583,8358,6277,4196,6244,4196,4196,4196,6244,6277,8358,6245,4196,2115,2114,2083,8325,8389,4196,4196,4196,4196,6309,8422,8422,10470,14566,6244,6244,6244,6244,8357,10503,10470,8357,6244,6245,6245,6245,10373,18663,18728,18728,18695,20808,18728,18728,18728,18728,18728,18728,18760,18760,18728,16615,16647,18760,16680,16647,16648,16648,14566,8356,8324,6243,6243,10405,16680,16648,16648,16648,16648,18825,23019,23019,22987,20938,20938,18858,16712,16713,18825,16713,14632,16777,16810,18890,18890,16778,12584,12551,10503,12551,14664,14665,14665},
-	{10891,8810,8810,8810,10858,10858,10858,10858,10858,10858,10955,13068,13068,13068,13068,13068,13068,13068,13068,13068,13036,10890,10890,10890,10955,13036,13036,13036,13068,15148,13068,13036,10891,10858,10858,10858,8810,8810,10890,10923,10858,10891,12971,12971,13003,12971,13003,15084,15084,15084,15084,15084,15084,15084,15116,15116,15084,15084,15116,15116,15116,15116,15116,15116,15116,15116,15116,15116,15116,17196,17196,17196,17196,17196,17196,17197,17197,17229,17229,17229,17229,17229,17229,17229,19309,21422,19309,19309,19309,19309,19309,19309,21389,23503,19277,8681,6536,6568,6568,6568,6568,6568,6568,6568,6568,6569,6569,6569,15020,21422,21390,21390,21390,21390,21390,21390,21390,21390,21390,21390,21422,19212,10631,8454,8454,8454,8454,8454,12647,14792,14760,14825,21164,21164,21164,21164,21164,21164,21131,16938,16873,14728,14728,14729,14761,14729,14728,14728,14728,14728,14728,14728,14761,14923,17100,17067,16970,14761,14729,14761,16842,14761,14729,14793,21325,19341,19341,21390,21389,21389,21422,21422,21389,19341,21389,21390,21390,21390,21389,21390,21422,21390,21390,21390,21390,21390,21390,21390,21390,21422,21390,21390,21390,21390,21390,23535,25615,25615,25615,25615,25615,25615,25615,25615,25615,25583,25583,25583,12809,6438,8486,8454,8454,8454,8454,12648,12681,12681,14729,14696,14696,14696,14696,14696,12583,6277,8357,8324,6244,6244,10470,12519,10405,6244,8325,8358,4196,4196,6308,4131,10470,16712,6244,4164,4196,4196,8390,8422,8389,10470,14566,6244,6244,4196,6244,6244,8390,8389,8357,6244,6244,6244,6244,8293,16647,18728,20841,18728,18695,18760,20841,18728,18728,18728,18760,18760,18760,18728,16647,16647,16647,16680,20841,18728,16648,16680,10405,6276,8324,6243,10405,18728,16680,16680,16648,16680,20873,23019,23019,22987,20939,20938,20906,16712,16712,18826,16713,14632,16777,18858,18890,18890,18891,14665,12551,10503,12552,14664,14665,14665},
-	{10891,10923,10858,8810,8810,10858,10858,10858,10890,10890,13068,15245,15245,15245,15213,15245,15245,15213,13068,13036,10955,10890,10890,10891,10891,10891,10891,10891,10891,10923,13003,10923,10891,10891,10923,13068,13068,10923,10890,10923,10890,10890,13003,15116,15116,15116,15116,15116,15116,15116,15116,15116,15116,15116,15116,17197,15148,15116,15116,15116,15116,15116,15116,15116,15116,15148,15116,15148,15148,17196,17196,17196,17197,17196,17197,17197,19341,21454,17261,17229,17229,19341,21454,21454,23534,23567,23534,23535,23535,23535,23535,23534,23534,23535,17164,6568,6568,6568,6569,6568,6568,6569,6568,6568,6536,4391,6568,6569,8714,12907,12906,12906,12906,12907,12907,12907,12907,12907,12971,21357,21421,21422,19212,17035,10599,8454,8454,8454,8454,8454,8422,8454,12680,16906,21164,21164,21164,21132,16906,14729,14729,14729,14729,14729,14728,14728,14728,14728,14728,14729,14729,14729,14793,14955,14955,14793,14728,14729,16777,14729,14761,16842,14761,14793,21325,21389,19342,21389,21389,21389,21389,21422,21422,21389,21389,21389,21389,21389,21389,21422,23502,21422,21389,21389,21390,21390,21390,21390,21390,21422,21422,21422,21422,21422,21422,23502,23534,23534,23534,23534,23534,23502,17099,14954,14954,14986,17035,14922,8583,8486,8486,8486,8454,8454,8454,12648,12680,14728,14696,14696,14696,14696,14696,16744,12551,6244,8324,10405,8324,8324,16712,16744,16680,10405,8292,8324,6244,6276,10470,4131,12518,16712,6244,4164,4196,6244,8325,6277,8389,14631,14566,6244,4196,6244,6244,6244,6244,8324,8357,6244,6244,6245,6244,8292,16647,18695,18728,20841,18728,18728,20841,20841,18728,18728,18760,18760,20808,18728,16647,18695,18696,18728,20841,20841,18728,18728,10405,6243,6275,8324,14567,18728,18728,18728,16648,18728,20873,23019,23019,22987,22987,20938,20906,16713,16713,18793,16713,14632,16777,16778,18826,18890,18890,16777,12584,10503,12552,14664,14665,14664},
-	{8810,10891,8810,8810,10890,10890,8810,10890,10890,10890,10923,10955,10955,10955,10955,13003,13003,10955,10923,10891,10891,10891,10891,10891,13004,13036,13036,13036,13036,15116,15116,15148,10923,10891,10923,10955,13003,10923,10890,10890,10890,10890,13003,15116,15116,15116,15116,15116,15116,15116,15116,15116,15116,15116,15116,15116,17229,15148,15116,15116,15116,15116,15116,15116,15116,15148,15148,15148,15148,15148,17196,17196,17196,17229,17229,17229,17261,19341,17229,17229,17229,19309,19341,21422,21422,21422,21422,21422,21422,21422,25615,25647,25615,23502,17164,6536,6537,6536,6568,6536,6568,6568,6439,4326,6536,6504,6568,6601,6569,6569,6569,6601,8681,6569,6569,6569,6569,6569,6601,12971,21390,21390,21422,21390,19180,17003,8487,8422,8454,8454,8454,8454,8422,10534,12679,12679,16970,16906,14760,14761,16841,14729,14729,14728,14728,14728,14728,14728,14729,14729,14728,14728,14793,14955,14987,14793,14729,14729,16777,14729,14728,14761,16842,23213,21325,21389,19342,21389,21389,21389,21389,21389,21422,21389,21389,21389,21389,21389,21389,21389,21422,23502,21422,21421,21421,21422,21422,21422,21422,21422,21422,23502,21422,21422,21422,21422,21422,21422,21422,21422,23502,15019,6502,6438,6438,8486,8519,6438,6438,8486,8486,8454,8454,8454,8454,12648,12680,14728,14696,14696,14696,14696,16744,16744,12551,8292,8291,8324,12485,14599,16712,16712,18760,12485,8291,12518,12519,10438,12486,8325,16712,16712,6277,4164,4196,4196,8325,6277,6277,14631,10405,6244,6244,6213,6245,6244,6245,10470,8357,6244,6244,6245,6244,8292,18695,18695,18695,20808,22889,18728,20776,22921,20841,20808,18760,18760,20808,18728,18695,18696,18696,18696,18728,20841,20873,18728,10405,6243,6243,10372,18728,18728,18728,18728,18728,18728,20874,23019,23019,22987,22987,22987,20906,16713,16712,18793,16713,14632,16777,16778,16777,16778,18890,16777,12584,12551,12552,14664,14664,14664},
-	{10890,10890,10890,10890,10891,10891,10891,10890,10891,10891,10891,10891,10891,10891,10891,10891,10891,10891,10891,10923,13068,13003,15116,15116,15116,15148,15180,15180,17261,19374,19374,17261,15148,15116,15116,15116,15084,15084,13068,15149,15149,17261,21454,19374,17228,15148,15148,15148,15116,15116,15116,15116,15116,15116,15116,15116,15148,15116,15116,15116,15116,15116,15148,15148,15148,15148,15148,15148,15148,17196,17197,17197,17197,17197,17229,17229,17229,17229,17229,17229,17229,17229,19309,21454,21422,19341,19341,19309,19341,21390,21422,23502,25615,17196,8713,6536,4390,4325,4325,4293,4325,4293,4260,4260,6536,6569,6568,6601,6601,6601,6569,6601,8681,8682,6601,6569,6569,6569,6569,8713,17100,17100,17100,17100,17100,15020,12777,8487,8486,8454,8454,8454,8454,8454,8454,8454,10599,14728,14696,10535,14728,16841,14728,14728,12648,14696,14728,14729,14761,14728,14728,14760,14793,14955,14987,14793,14728,14728,14696,14696,14728,14728,14729,14728,12776,21389,21422,21390,21390,21390,21390,21390,21390,21390,21390,21390,21422,21390,21389,21389,21422,21422,23502,21422,21422,21422,21422,21422,21422,21422,21422,23470,21422,21422,21422,21422,21422,21422,21422,23470,17099,8551,6470,6438,6438,6438,8486,8486,8486,8486,8486,8454,8454,8454,8454,12648,14728,14728,14696,14696,14696,16744,16712,16744,14599,8291,8291,8291,10372,18792,18792,18760,18760,14533,10307,16679,16680,8324,8325,10438,18760,16712,8357,6245,6244,4196,6245,6245,6277,12647,12518,6244,4196,6245,6244,6244,6245,8357,8357,6245,6244,6245,8293,12454,18695,18695,18696,18696,20808,22921,20808,20776,20808,20776,18760,18760,20808,18760,18696,18696,18728,18728,18728,18728,22921,16679,8291,6243,8323,16647,18728,20841,20841,18728,18728,18728,20874,22987,22987,22987,22986,22986,20906,16713,16680,18793,18794,16713,18826,16778,16777,16777,16777,16777,12584,12551,12552,14664,14664,14664},
-	{10890,10891,10891,10891,10891,10891,10923,10923,10923,10923,10923,10923,10923,10923,10923,10923,10923,10923,10923,10955,15213,19341,17196,15148,15148,19341,21454,21454,19341,17228,19373,17229,15148,17228,19373,19374,17261,15148,19341,19374,17260,19406,21486,19373,19341,19374,19374,17261,15116,15116,15116,15116,15116,15116,15116,15116,15116,15116,17229,15148,15116,15148,15148,15148,15148,15148,15148,15148,17196,17196,17197,17197,17229,17229,17229,17229,17229,17229,17229,17261,17261,19309,19309,19341,23534,23567,23567,23534,23502,25615,25615,23567,21422,17132,6536,6536,6503,6438,4292,6307,6307,6275,4227,4260,6504,6601,6569,6601,6568,6569,6569,6569,6601,8681,8682,6569,6569,6569,6536,8649,14954,14987,14987,14987,14987,14987,14987,14922,14955,10632,8486,8584,6568,6568,6568,6568,8616,12680,10535,8422,10502,14728,14761,14728,14728,12648,14728,14729,14826,14793,14858,14922,14923,14987,14955,14793,14696,14728,14696,14696,14728,14728,14728,10502,10599,19245,21421,21422,21390,21390,21422,21422,21422,21422,21422,21422,21422,21422,21422,21422,21422,21422,21422,23502,23470,21422,21422,21422,21422,21422,21422,21422,23502,23502,21422,21422,23502,23502,21454,23502,14954,8551,6471,6438,6439,6438,8486,8486,10600,8519,8486,8454,8454,8454,10502,12616,14696,14696,14696,16744,16744,16744,16712,16712,14599,8291,8291,8291,8292,16711,18760,18760,18760,14533,10339,16679,16679,4163,6212,12519,18760,18760,16680,12551,6245,6244,6244,6244,10438,14696,16646,6244,6244,6245,6244,6244,6244,8324,8357,6245,6244,6245,8292,10373,18695,18695,18696,18696,18728,20808,22921,20776,20776,20776,20808,20808,20808,20808,18696,18728,18728,18728,18728,18728,18728,14566,8323,6243,8323,16647,18728,20808,20808,18728,18728,18728,18760,20873,20841,20841,20841,18793,18793,18793,16712,18793,16713,16680,18826,18826,16777,16777,16745,14664,14697,12584,12552,14664,14664,14664},
-	{10923,10955,10955,10955,10955,10955,13133,15213,13165,13133,13133,13133,13133,13133,15181,15181,15181,15181,15181,13067,17228,19373,19373,17228,17228,17229,17228,17228,15180,15148,15180,15148,15148,15148,15180,15180,15148,15148,15148,17228,17228,17260,17261,17293,17261,17260,17260,17228,15148,15148,15148,15148,15148,15148,15148,15148,15148,15148,15148,17229,15148,15148,15148,15148,15148,15148,15148,17228,17228,17228,17228,17228,17229,17229,17229,17229,17261,17261,17261,17261,17261,19309,19309,19309,19341,19341,21454,23567,25615,23502,21422,21422,21422,15018,6340,6308,6340,6340,6307,6307,6307,4259,4228,4260,6471,6536,6569,6569,6568,6569,6600,6601,6569,6601,6601,6569,6536,6504,4357,6405,10696,14987,14987,15019,14987,14987,14987,14987,10794,6569,6569,6601,6601,6601,6601,6601,6601,8617,10632,8486,8454,8454,14728,14728,12648,12648,14696,14696,14728,12680,12712,14922,14987,14923,14825,12680,12648,14728,14728,14728,14728,14728,14696,10502,8422,12776,21389,21422,21421,21421,21422,21422,21422,21422,21422,21422,21422,21422,21422,21422,21422,21422,21422,23502,23503,23502,21422,21422,21454,21454,21454,21454,23502,23502,21454,21454,21454,21454,23502,23502,14954,14987,10696,6438,6438,8486,8486,8486,8487,10600,10535,8454,8454,10502,10470,10470,12550,14663,14631,16744,16744,16744,16744,16744,14599,8291,8291,8291,10340,16679,18760,18760,18760,12485,10339,16679,16680,8292,6244,14599,20873,18760,18760,16679,6244,6244,6244,6212,6277,14695,16614,8292,6245,6245,6245,6244,6244,6244,6244,8358,10406,6245,6212,10340,18695,18696,18728,18696,18728,20776,20809,22889,20776,20776,20776,20808,20808,20776,18728,18728,18728,18728,18728,18728,16614,8323,8324,8323,6243,10405,18728,20776,20776,20808,20808,18728,18728,20841,20841,20809,18761,18760,18761,18761,18793,16713,16680,16680,18826,18826,16777,16777,16745,12584,12584,14697,12584,14664,14664,14664},
-	{13100,13100,13100,13101,13101,13133,13165,13165,13101,11020,10988,10988,10988,10988,13036,13036,13036,13036,15181,19374,19406,19406,19374,19374,19374,15180,15148,15148,15148,17293,19341,17260,17260,17260,17261,17261,17261,17229,17260,21454,21486,21486,21486,21486,23567,21518,21486,19373,17260,17229,17229,17261,17228,15148,15148,15148,15148,15148,15148,17196,17229,15148,15148,15148,15148,15148,15180,17228,17228,17228,17228,17228,17228,17228,17229,17261,17261,17261,17261,17261,17261,19309,19309,19341,19341,19341,19341,19341,19373,19342,19341,19341,21422,15018,4259,6275,6307,6307,6307,6307,6307,4260,4228,4228,4260,4325,6536,6569,6569,6569,6600,6568,6504,6504,6536,8551,6406,4325,4292,8518,14955,14987,14987,14987,14987,14987,10794,8649,6601,6601,6601,6601,6601,6569,6569,6569,6601,6569,8617,8616,8551,8454,10502,12615,12648,12648,10535,8454,8454,10567,12648,12744,14858,14728,14728,14696,12648,12648,12648,12647,12680,12647,10502,8422,8454,12841,21422,21422,21422,21422,21422,21421,21421,21422,21422,21422,21422,21422,21422,21422,21422,21422,21422,21422,23502,23535,23502,21454,21454,21454,23502,23502,21454,21454,23502,23502,23502,23502,23502,23502,14954,14954,10696,6438,6438,8486,8486,8486,8454,8487,10599,8454,8454,10502,10470,10470,12550,14663,14599,16744,16744,16744,16744,18760,16679,10372,8291,8291,10340,16679,18760,18760,18760,14566,12452,16679,18760,18760,18759,18760,20873,20873,18792,16679,6244,6244,6244,6244,6276,14663,16581,10340,6244,8358,8358,6244,6244,6244,6244,8293,10406,10405,8260,10340,18695,20808,20808,20776,20776,20776,20776,20776,20808,20808,20776,20808,20776,18696,18728,18728,18728,18728,18728,20776,14566,8291,8291,8324,8323,8324,16679,20808,20808,22954,25067,20841,18760,20841,20841,18761,18761,18761,20906,20906,20906,18793,16680,16680,18825,18826,16777,16777,16745,14632,12551,12584,14697,14664,14664,14664},
-	{10923,10923,10923,10923,10923,10923,10923,10923,10988,13133,13133,13132,13133,15181,15245,15245,15245,15245,15245,15277,15277,15213,13068,15181,17261,17261,15180,15148,15148,17261,19374,19406,21486,21518,21486,19374,19374,19374,19374,19374,19373,19373,19373,19373,19374,21486,21454,19373,19373,19373,19373,19373,17293,15180,17261,17261,15180,15148,15148,15148,17229,17229,15148,15148,15148,15148,15148,17228,17261,17228,17228,17228,17228,17229,17229,17229,17261,17261,17261,17261,17261,19309,19341,19341,19341,19341,19341,19341,19341,19341,19341,19373,21422,15018,4259,6307,6307,6307,6307,6307,4259,4228,4228,4227,4228,4293,6536,6569,6569,6569,6503,6471,4293,4261,4293,4293,8454,6405,4292,8518,14987,14987,14987,14987,14987,12906,8648,6569,6569,6601,6601,6601,6601,6601,6601,6569,6601,6601,6601,6601,6504,8454,8454,8454,10567,12615,8454,8422,8422,8454,10567,12680,14728,14728,14728,12680,12615,10567,10535,10502,10567,10502,8421,8422,10599,19212,19309,21421,21422,21422,21421,21421,21421,21422,21421,21421,21422,21422,21422,21422,21422,21422,21422,21422,21422,23502,23502,23502,21454,21454,21454,21454,21454,21454,23502,23535,23534,23502,23502,23502,14954,6470,6470,6438,8486,8486,8486,8486,6341,8422,8454,10534,10534,10470,10470,10470,12518,14663,14599,16744,16712,16712,18792,18760,18760,14566,10307,10339,10340,16679,18760,18760,20808,18760,18760,18760,18760,18760,18760,18760,18760,20873,20873,16679,6244,6244,6244,6244,6277,12583,8292,6244,6244,6245,10406,8357,6244,6244,6244,6244,8293,10406,8260,8292,18695,18695,20808,20809,20776,20776,20776,20776,22889,22889,20776,20776,18696,18696,18728,18728,18728,20776,20776,20808,14566,8291,8291,8291,8323,8291,12453,20808,20808,20808,22954,25066,20873,20841,20841,20841,18761,18761,20906,22986,20938,18793,16680,16680,18825,18826,18858,18858,16777,14665,14632,14632,14632,14665,14664,14664},
-	{10923,8875,10923,10923,10923,10923,10923,10923,10923,10923,10923,10923,10923,10987,13132,13133,13133,13132,13132,13133,13133,13133,13133,13133,17293,21454,17229,15180,15180,15180,15180,15180,19373,19406,19373,17293,17293,17293,17293,17293,15180,15148,15148,15148,15148,15148,17261,17228,17228,17293,17293,17293,17293,19373,21518,21518,19373,15180,15148,15148,15148,17229,17261,15180,15180,15180,17228,17228,17228,17228,17228,17228,17228,17261,17261,17261,17261,17261,17261,17261,19309,19341,19341,19341,19341,19341,19341,19341,19341,19373,21421,21422,21422,17196,8518,6275,6307,4259,6373,6405,6373,4325,4325,6405,4358,4390,6568,6569,6569,6568,4390,4260,6309,4293,4292,6340,6341,6406,6405,8519,14987,15019,15019,14987,15019,14954,6535,6568,6569,6601,6601,6569,6569,6569,6569,6601,6601,6601,6601,6601,6536,6504,8487,8422,8454,12615,10567,8422,8422,8454,8454,12648,14696,14696,14728,12616,8454,8422,8421,8421,8421,8421,8422,8421,8486,14954,17132,21422,21422,21422,21422,21422,21422,21422,21422,21422,21422,21422,21422,21422,21422,21422,21422,21422,21454,21454,21454,21454,21454,21454,23502,23502,23502,23502,23502,23502,25583,23535,23502,23502,14954,6438,6438,6438,8486,8486,8486,6406,6309,8422,8454,10535,12615,10502,10470,12518,12550,14663,14599,18760,16647,16679,18792,18760,18760,14566,10339,10339,10340,18727,18760,18760,20808,20808,20808,20808,18760,18695,20808,20808,18760,18792,20905,16712,6244,6212,6244,6244,8325,16776,8325,6244,8325,8325,6244,10406,8357,6245,6244,6244,6245,8292,6211,8291,18695,18695,18696,20809,20776,20776,20776,20776,20776,20776,20841,20808,18696,18696,18728,20776,18728,18728,20776,18728,12485,8291,8291,8291,8291,8291,10405,20808,20776,20776,20808,22954,25034,20841,20841,20841,20809,20809,22954,22986,22954,18793,16712,16680,18825,18826,18858,20971,18891,18858,18858,16778,16778,16778,16778,16777},
-	{10923,8907,10923,10825,10728,10728,10761,10923,10955,10923,10955,10955,10923,10955,10955,10955,10955,10955,10955,10955,10955,10955,10955,10955,10955,17261,15213,15180,15180,15213,15180,15180,15180,15180,17261,19374,19406,19406,19373,17325,15180,15148,15180,15180,15148,15180,17293,19406,19373,19373,19373,19373,19373,19373,19373,19373,19373,17260,15148,15148,15148,15180,17261,17261,15180,15180,15180,15180,15180,17228,17261,17261,17261,17261,17261,17261,17261,17261,17261,17293,19341,19341,19341,19341,19341,19341,19341,19373,19374,17164,15019,15019,15019,15051,10761,6405,6405,4390,6536,6568,6568,6568,6569,6569,6569,6569,6568,6569,6569,6569,6568,6406,4293,4292,4292,4293,4292,6341,8454,8518,12809,15019,14987,14987,14987,10663,6405,6568,6569,6569,6601,6569,6569,6569,6569,6601,6601,6569,6569,6569,6569,6569,8487,8422,8421,8422,10535,8454,8422,10534,8454,10567,12680,14728,12616,8454,8421,8421,8390,8422,8421,8421,8421,8422,10664,14954,15019,19309,21422,19373,21422,21422,21422,21422,21454,21454,21422,21422,21422,21454,21454,21454,21454,21454,21454,23502,21454,21454,21454,21454,23502,23502,23502,23502,23502,23502,23502,25615,25582,23534,14954,6438,6438,6438,8486,8486,8486,6373,6341,8454,10502,10502,10535,12615,12550,12518,12550,16711,14599,18760,16647,16680,18760,18760,18760,16614,10339,10339,10340,18727,20808,20808,20808,20808,20808,20808,18728,16647,20808,20808,20808,20808,20840,18760,6244,6212,6244,6244,8324,14663,8325,6244,8325,10406,8293,8293,10406,6245,6244,6244,6244,6244,6211,8324,18728,18695,18728,18696,20776,20809,20776,20776,20776,20776,22921,22921,20776,20776,20776,20776,20776,20776,20776,16647,8291,8291,8291,8291,8291,8291,12453,20808,20808,20808,20776,20808,22921,22921,22954,20841,20840,20841,22954,22986,22954,20873,18761,16712,18825,18826,18825,18858,20971,18858,16777,16777,16777,16777,16745,16745},
-	{10923,10955,10825,10566,12485,12485,12517,10664,10696,10696,10696,10858,10955,10955,10955,10955,10955,10955,10955,10955,10955,10955,10955,10955,10955,15148,15180,15180,15180,17261,17293,15213,15180,15180,15180,15180,15180,15180,17293,19373,19373,19373,19373,19373,19373,19373,17325,17325,17293,17228,17293,19373,19373,19373,19373,19373,19373,19373,19373,19373,19373,19373,19373,19406,21486,19405,19406,19406,19406,19406,21486,21486,19406,19406,21454,21454,21486,21454,19341,17293,19341,19341,19341,19341,19341,19373,19373,19374,15148,8681,6504,6504,6504,6536,6536,6536,6568,6568,6568,6568,6568,6568,6568,6568,6569,6569,6568,6569,6569,6569,6569,6536,4293,4260,4260,4293,4293,4292,6340,10599,17099,19276,19277,19277,17131,6372,6340,6503,6569,6568,6568,6569,6569,6569,6569,6601,6568,6568,6568,6568,6568,6568,8552,12777,12809,14857,14890,12712,8421,8422,8422,8422,10567,10600,8454,8422,10502,8422,8421,8421,8519,12712,8486,8454,14922,14986,14954,17164,21454,21421,21422,21422,21422,21422,21454,21454,21422,21422,21422,21454,21454,21454,21454,21454,21454,23502,23502,23502,23502,23502,23502,23502,23534,23567,25647,25647,25647,27695,27727,25615,14986,6438,6438,6438,8486,8486,8486,8486,8486,8454,8454,10502,10470,12550,14631,12518,12550,16711,14599,16712,16614,18792,20840,18760,20840,16614,10339,10339,10340,18727,20808,20808,20808,20808,20808,20808,20808,20840,20808,20808,20808,20808,20808,16679,8292,6212,6244,6244,6244,6244,6244,6244,6244,8325,10406,8293,6244,8325,8325,6244,6244,4163,6211,8324,20808,20808,18695,18696,20776,22889,22889,20776,20776,20776,20808,22921,22889,20776,20776,18728,20808,16712,16712,16647,8291,8291,8291,8291,8291,8291,12453,20808,20808,20808,20808,20776,20808,22921,25034,20873,20841,20841,22954,22954,22954,20873,16712,16712,18825,18826,18826,18826,18890,20971,18826,16777,16777,16745,14665,14665},
-	{10955,10955,10728,12485,12484,12485,12485,12485,10404,10372,10437,12841,10955,10955,10987,10955,10955,10955,10987,10987,10987,10987,10987,10987,13068,15180,15180,15180,15180,15180,17261,17293,15212,15180,15180,15181,15181,15181,17293,17325,17325,17325,17325,17325,17325,17293,15180,15180,15180,17260,19406,23567,23566,23567,21486,19373,17325,17325,17325,17325,17325,19438,19438,17325,19374,19373,19373,19373,19373,19373,19405,21454,21486,19406,19406,19406,21454,21454,19341,19341,19341,19341,19341,19341,19341,19373,19373,17196,8681,6504,6536,6536,6536,6536,6536,6536,6536,6536,6568,6568,6568,6568,6568,6568,6568,6569,6569,6568,6568,6568,6569,6504,4260,4228,6308,4293,4292,4293,4261,8486,19147,23535,23534,23534,21357,8420,6275,6405,6536,6568,6568,6568,6569,6569,6569,6568,6439,4325,6405,6405,6471,6568,6470,14954,17132,19213,19212,14954,14857,10567,8422,8422,8422,8454,8422,8422,8454,8486,10632,8519,12841,14986,10599,10664,14954,14986,14954,17164,21454,21453,21422,21422,21422,21422,21454,21454,21454,21454,21422,21454,21454,21454,21454,21454,23502,23534,25679,25679,25647,25647,25647,25647,23534,23566,25647,25647,25647,25647,25615,25615,14986,6438,6438,6438,8486,6406,6406,8486,8486,8454,10502,10502,10470,10470,12550,14631,14598,14598,14599,16679,14534,18760,20840,18760,20840,16614,10307,10307,10340,18727,20808,20808,20808,22856,20808,20808,20808,20840,20840,20840,20840,20808,20808,16679,8292,6244,6244,6244,6244,6244,6244,6244,6244,6244,8325,10406,8293,8293,10406,8357,6244,6212,6244,10373,18728,20841,20808,18696,20776,20776,22889,22889,20776,20776,20776,20808,20809,20776,20776,20808,16712,12647,10600,12615,10502,8388,8291,8291,8291,8291,12453,20808,20808,20808,20808,20776,20808,20841,25034,25067,20873,20841,22954,22954,22954,18793,16680,16712,18825,18826,18826,18826,18826,18858,16778,16745,16777,16778,16745,16745},
-	{10955,10955,10728,10437,12485,12485,12485,12485,12484,10404,10437,10825,10987,10955,10955,10793,8745,10987,10987,10955,10955,10955,10955,13036,15148,17229,17261,15180,15213,15180,15213,17261,17293,15212,15180,15212,15213,15181,15180,15180,15180,15180,15180,15180,15180,15180,15180,15180,15180,15180,17325,17325,17293,17293,17325,19406,19406,19406,19406,19406,19406,21486,21518,19406,17261,17261,17261,17261,17261,17261,17261,17261,17293,17261,17261,17293,17293,17293,17293,17293,19341,19341,15019,10761,10761,10761,12939,15019,6504,6504,6504,6504,6536,6536,6536,6536,6536,6536,6536,6536,6536,6568,6568,6536,6536,6536,6536,6568,6536,6536,6536,6504,4260,4228,6308,4292,4292,4293,4293,4260,6438,12809,12776,10696,10663,6340,6275,6307,8485,6438,6405,6405,6405,6405,6405,6373,4260,4227,6307,6307,6340,6373,6340,14922,19148,17067,17067,14987,17067,17003,14825,8454,8422,8421,8421,8421,8454,12777,14922,14889,14986,17132,14954,14922,14954,14954,14954,17164,21454,21453,21422,21422,21422,21422,21454,21454,21454,21454,21454,21454,21454,21454,23502,23502,23502,23534,25615,25615,25647,25615,25615,25615,23534,23534,23534,23535,23534,23534,23534,25615,17067,8519,6438,8486,8486,6373,6373,8486,8486,8454,10502,10502,10470,12518,12518,14598,16679,14566,16647,18760,18727,18760,20840,20840,20840,16646,10339,10339,12388,20775,20840,20808,20808,20808,20808,20808,20808,20840,20840,20808,20840,20808,22856,18727,8325,10374,6244,6244,8292,8260,8260,6244,6244,6244,6244,8325,10406,6245,8325,10438,8325,6245,6245,10373,18696,20776,20841,20808,18728,18728,20776,22889,22889,20776,20776,20776,20776,20776,20841,20971,14729,14664,12648,10600,10600,8422,8291,8291,8291,8291,12453,20808,20808,20808,20776,20776,20808,20841,22921,25067,25067,20873,22954,22954,22954,18793,16680,16712,18825,18826,18825,18793,16745,16745,16745,18858,16777,16778,16777,16777},
-	{10857,10728,12776,12485,12485,10404,8324,10404,12485,12485,12517,10825,10922,12679,12614,10533,10728,10987,10923,6568,6503,6503,6503,6503,8550,15051,15180,17228,17261,15213,15213,15212,17293,17261,15213,15213,15213,15213,15213,15212,15212,15212,15212,15212,15212,15212,15212,15212,15212,15212,15213,17293,15212,15180,15212,17293,17293,17293,17293,17325,17325,19406,21551,23599,21486,21486,21486,21486,19373,17261,17261,17261,17261,17293,19373,17293,17293,17293,17293,17325,15116,8681,6536,4423,4423,4423,6536,8648,6504,6504,6504,6536,6504,6536,6536,6536,6536,6536,6536,6536,6536,6536,6536,6536,6536,6536,6536,6536,6536,6536,6536,8552,4260,4260,4293,4260,4260,4292,4292,4292,4260,4293,4293,4260,4292,6308,6275,6275,6308,8420,6308,6307,6307,6307,6307,6307,4259,4259,6307,6307,6307,6308,6340,10696,17035,14987,14987,14987,14987,17067,17100,17035,17002,17002,12680,8421,12776,14954,14987,17067,14986,17228,19341,15019,14954,14954,14954,17164,21454,21454,21454,21454,21454,21454,21454,21454,21454,21454,21454,21454,21454,21454,25647,27760,25647,23534,23502,23534,23534,23534,23534,23534,23534,23534,23534,23534,23534,23534,23534,23502,14986,6470,8486,8486,8486,8454,8454,8486,8454,10502,10502,10502,10502,12550,12518,12518,16679,18792,16679,18727,16647,18760,20840,20840,22953,16646,10339,10339,12388,20775,22888,22888,22856,22856,22856,22856,22856,20840,20840,22856,22856,22856,24904,20743,8293,10341,8260,8260,8260,8260,8260,8260,8292,8292,6244,6244,10405,10438,8293,8325,8325,6245,6245,8293,14534,18696,18728,22889,20808,18728,18728,20776,22921,20841,20776,20776,20776,20776,20808,18956,12746,12648,12648,10600,10599,10567,8356,8291,8323,8291,12453,20808,22856,20808,20776,20776,20808,20809,22921,22954,27147,25067,22986,22954,22954,20841,16680,16680,18825,18793,16712,16713,16745,16745,16745,18826,18858,16778,16777,16745},
-	{10533,10469,10501,10437,10437,8324,8291,8324,10437,12485,8388,10792,10598,10437,12484,10437,12840,10760,6438,4325,4293,4293,4293,4293,8324,10469,8453,10663,15116,17196,17196,17196,15148,17196,17229,17196,17228,17261,17261,17261,17261,15213,15213,15213,15213,15212,15212,15212,15212,15212,15212,17261,17293,17260,15212,15212,15212,15212,15212,15212,17260,17293,17293,17293,17293,17293,17293,17325,17293,17261,17293,17293,17293,17293,19374,19374,19341,19341,19373,19373,15051,6439,6471,6471,6472,6472,6472,6471,6503,6471,6471,6503,6504,6504,6536,6536,6536,6536,6536,6536,6536,6536,6536,6536,6536,6536,6536,6536,6536,6536,6536,6536,6503,6471,6406,4228,4260,4260,4292,4292,4292,4260,4260,4292,4292,4260,6308,6340,6308,6308,6307,6307,6307,6307,6307,6307,4259,4259,6307,6340,8518,12745,10664,10665,14954,14987,15019,15051,17099,19180,19212,21325,19212,19212,12808,10696,14954,14986,14986,17067,17066,17228,21454,15019,14954,14954,14954,17164,21454,21454,19405,21454,21454,21454,21454,21454,21454,21454,21454,21454,21454,21486,25679,25647,27760,25647,23534,23534,23534,23534,23534,23534,23534,23534,23534,23566,23566,23567,19277,10696,8551,6438,10632,8519,8486,8486,8486,8486,8454,10502,10502,12583,14696,16744,16744,14598,16711,20873,20872,18760,18728,20808,20840,20840,22921,18727,12387,10339,12388,20775,22888,20840,22856,22856,22856,22856,22856,22856,22856,22856,24904,24872,24872,20743,10340,8292,8260,8292,8260,8292,8292,8260,8260,8260,8292,6244,8292,10405,10406,6245,6245,8293,8293,6245,10406,18696,18696,20776,22889,20776,20776,20776,20776,22921,22889,20808,20776,20776,18728,18923,16973,16973,16973,14860,10632,10599,8389,8291,8291,8291,12453,20808,22856,20776,22889,22921,22889,20809,22922,25002,22922,22921,25099,22986,22954,20841,18728,16680,18793,16713,16745,14632,16712,16745,16745,16745,16777,16810,14665,14665},
-	{10404,8324,8292,8324,8324,8292,8292,8292,8324,8324,8356,12874,10534,10436,10437,8388,10793,8680,4293,4293,6341,6341,6341,6308,8324,8292,8292,8356,8421,8421,8421,8421,8421,10469,10501,10502,12873,17261,17261,17261,17261,17261,17261,17261,17261,17261,17261,17261,15213,15213,15213,17261,17292,15212,15213,15212,15212,15212,15212,17261,17261,17261,17260,17260,17260,17260,17261,17261,17293,17293,17293,17293,17293,17293,17293,19374,19373,19373,19373,19373,15084,6504,6407,6439,6439,6439,6471,6471,6472,4358,4293,6471,6504,6504,6504,6471,6472,6471,6472,6504,6536,6536,6536,6536,6536,6536,6536,6536,6536,6536,6536,6537,6537,6537,6406,4227,4228,4260,4260,4292,4292,4260,4260,4292,4292,4260,8486,14922,10631,4259,4259,8420,6307,6339,6372,6372,6372,6372,8486,14890,14955,17036,14987,12810,15019,17164,21422,21422,21357,19244,21293,21357,21325,17099,14954,14955,14987,14954,14954,14986,17067,19277,21422,15019,14954,14954,14954,17164,21454,21454,21453,21453,21453,21453,21454,21454,21454,21454,21454,21454,21486,21486,23534,23534,25614,25647,23534,23534,23534,23534,23567,23567,23566,23567,23566,23566,23566,25615,19244,6470,6438,6438,8519,8519,8519,8486,8486,8486,8454,10502,10502,12583,16744,16744,16744,14598,14598,18727,16647,16647,16614,18728,20808,20808,20840,20775,14500,12387,12388,20775,22888,22888,22856,22856,22888,22856,22856,22856,22856,24872,26984,26952,26919,24871,18662,8292,8260,12421,10373,8292,8292,8292,8260,8260,8292,8292,8292,8292,8293,8325,8325,6245,6245,6245,10406,18696,18696,18696,20808,22889,20776,20776,20776,20808,22922,22889,20776,20776,20776,18891,19054,17038,17038,17006,14827,12615,10437,8291,8291,8291,12453,20808,22856,20776,24969,24970,22921,20809,22922,25003,22889,20841,27180,27179,22954,20841,18728,18728,18793,16680,16680,14600,14632,16713,16745,16745,16745,16745,14664,14664},
-	{8324,8324,8292,8291,8291,8291,8292,8292,8292,8291,8356,14857,10501,10404,8324,8324,10728,8616,4293,4293,4325,6406,6308,8324,8324,8324,8292,8324,8324,8324,8324,8324,8324,8324,8324,8324,14921,17293,17293,17293,17293,17293,17293,17293,17293,15245,15245,15245,15245,15245,15245,15245,15245,15245,15245,15245,15245,15245,15245,15245,15245,15245,15245,17293,17293,17293,17293,17293,17293,17293,17293,17293,17293,17293,17293,17325,19406,19405,19373,19373,17261,10696,4195,4227,4228,4196,4261,6471,6472,6471,6471,6504,6504,6504,6438,4293,4293,4293,4293,4326,6504,6536,6536,6536,6536,6536,6536,6536,6536,6536,6536,6536,6472,6471,6374,4228,4228,4260,4292,4260,4260,4292,4292,4292,4292,4260,6438,14955,14987,8583,6405,8485,8518,10663,14955,14955,14955,14955,14987,17068,17068,17068,15020,15020,21389,21454,21486,21486,23567,21422,21357,19244,17099,17067,14986,14987,14987,14986,14986,14986,14954,19276,21454,15019,14954,14954,14954,17164,21454,21453,19405,19405,21454,21453,21454,21454,21454,21454,21486,21486,21486,21486,21486,21486,23534,23567,23567,23534,23566,23566,23567,23567,23566,23567,23567,23567,23567,23567,17099,6471,8486,8486,8486,8519,10632,8519,8486,8454,10502,10502,10502,12583,12583,14598,14598,14598,16646,16614,16646,20808,18727,20807,20808,20808,22888,18694,12387,12388,12420,20775,22888,22888,22856,22856,22888,22888,22856,24904,24872,26919,26920,26984,26952,26920,20710,8292,8260,10309,14501,12388,8292,8292,8260,8260,8292,8292,8292,8292,8292,10405,8357,6245,6245,6245,10406,18696,18696,18728,18728,20776,18728,20776,20776,20776,20808,22922,20808,20776,22856,22856,20906,18989,19053,19053,16842,20677,16483,8291,8291,8291,12453,20808,22824,22824,24969,24970,22921,22857,22922,25003,22889,20809,25034,27180,25099,22954,20873,20841,18761,16680,16648,14599,14632,16713,16745,16713,16713,14665,14632,14632},
-	{8291,8324,10404,8324,8323,8324,8291,8291,8324,8324,8324,8356,8324,8324,8291,6308,4325,4325,4293,4293,4325,6438,10599,8421,8324,8324,8356,10534,8324,8324,8324,8324,8324,8324,8324,8324,12841,17293,17293,17293,17293,17293,17293,15245,15245,15245,15245,15245,15245,15245,15245,15245,15245,15245,15245,15245,15245,15245,15245,15245,15245,15245,15245,17293,17293,17293,17293,17293,17293,17293,17293,17293,17325,17325,17325,17325,19373,21454,19406,19406,15018,4228,2147,4195,4228,4260,4293,6471,6472,6472,6472,6504,6504,6504,6472,6471,6471,6503,6503,6504,6504,6504,6504,6536,6504,6504,6504,6504,6504,6504,6504,6439,4325,4325,4261,4260,4260,4260,4260,4260,4260,4292,4292,4292,4260,4260,4293,8584,17036,17035,17003,17035,17068,17100,17100,17068,17068,17068,17068,17068,17068,15020,17068,17100,21422,21486,21486,21486,21486,21486,21454,19244,17131,17164,17131,14987,14986,14954,14954,14954,14954,17196,21486,17099,14954,14954,12906,17164,21454,19405,19405,21454,21486,21453,21454,21454,21454,21454,21486,21486,21486,21486,21486,21486,23534,23534,23534,23567,23567,23566,23566,23567,23567,23567,23567,23567,25615,21389,8583,8487,8486,8486,8486,8486,8519,10600,10535,8454,10502,10502,12583,16776,16776,16679,16679,18792,18792,18759,18695,20840,20808,20808,20840,22888,22888,18694,12387,14500,16549,20775,22888,22888,22888,22888,22888,22856,24904,24872,26919,26919,26919,26920,26984,26952,20710,8260,8260,8260,12388,20807,10372,8260,8260,8260,8260,8260,8260,8292,8292,8292,8292,8325,8293,6245,10406,18696,18696,18696,18728,18728,18728,20776,20776,20776,20776,20808,20776,20776,27016,32998,28741,24807,26985,26985,26790,28708,16451,8291,8291,8291,12453,20808,22824,22824,24969,24970,22921,22857,22889,25002,22954,22889,24970,25034,27179,25067,22922,20874,18761,16680,14599,14599,16712,18825,16745,16713,14632,14632,14632,14632},
-	{8291,10404,10437,10437,8324,8324,8323,8291,8324,10404,8292,8292,8356,8324,8291,6308,4261,4260,4260,6309,6309,8518,14954,10599,8324,8291,10469,12744,8324,8324,8292,8324,8324,8324,8324,8323,12841,17293,17293,17293,17293,17293,17293,17293,17293,17293,15245,15245,17293,17293,17293,15245,15245,17293,15245,15245,17293,15245,15245,15245,15245,17293,17293,17293,17293,17293,17325,17325,17325,17325,17325,17325,17293,13035,13003,13003,13003,15051,17196,19406,15018,4195,2147,2147,4358,6439,6439,6471,6471,6472,6472,6471,6472,6472,6472,6472,6472,6504,6504,6504,6504,6504,6504,6504,6504,6504,6504,6504,6504,6504,6504,4358,6504,6536,6439,4260,4260,4260,4260,4260,4292,4292,4292,4292,4260,4260,4260,8584,17036,17068,15020,15020,17068,17100,19180,17068,17068,17068,17068,17068,17068,17068,17068,17100,21422,21486,21486,21486,21486,21486,21486,21486,21454,21454,21389,17067,14954,14954,14954,14954,14954,17196,21454,17132,14986,12906,12874,17164,19406,19405,19405,19405,19405,21486,21454,21454,21454,21454,21486,21486,21486,21486,21486,21486,23534,23534,23534,23567,23599,23567,23567,23567,23567,23567,23567,23567,25647,21389,8551,6438,6438,8486,8486,8486,8486,10567,10567,10502,10502,10502,12583,16777,16744,14599,16679,18759,18759,18727,16646,18759,18695,20776,22888,22888,22888,18695,12387,12387,16581,22888,22888,22888,22888,22856,22856,24872,26919,26919,26920,26919,26919,26887,28935,31016,22726,10308,10308,10275,12452,31530,14500,12356,8259,8260,8260,8260,8260,8260,8260,8260,8292,12453,10405,8292,10373,16615,20744,18696,18728,18728,18728,20776,20776,20776,20776,20776,20776,20776,29064,35142,32836,30756,30756,30756,30755,30723,22660,10371,8291,8291,10372,18695,22824,20776,22889,24970,24970,20808,22857,22922,25002,24937,27050,25002,22954,27180,25099,20873,18761,16680,14599,14599,14600,18826,18826,16712,14600,14632,14632,14632},
-	{8291,8291,8291,8324,8356,8324,8356,8324,10404,10404,8292,8292,8292,8292,8324,6276,4260,4228,4195,4195,6243,8324,8324,8356,10404,8324,8324,8324,8324,8324,10566,8421,8324,8324,8324,8453,15050,17325,17293,17293,17293,17293,17293,17293,17293,17293,17293,17293,17293,17293,17293,17293,17293,17293,17293,15245,17293,17325,17293,17293,17293,17293,17293,17293,17325,17261,12971,10890,10922,12938,12938,12971,10826,4423,4391,4391,4391,4359,6536,19374,15050,4195,4163,4195,6406,4391,6439,6439,6471,6471,6471,6471,6471,6471,6471,6472,6472,6472,6504,6471,6407,6406,6406,6406,6406,6406,6407,6407,6407,6407,6439,6438,6438,6439,6374,4260,4260,4260,4260,4260,4292,4292,4292,4260,4292,4260,4260,8584,17036,17068,17068,17068,17100,17100,19245,19245,19213,17100,15019,14987,14987,17068,17100,17100,21422,21486,21486,21486,21486,21486,21486,21486,21486,21486,21454,17131,14954,14954,14954,14954,12906,17228,21454,15019,14986,15019,15019,15051,19341,19405,19405,19405,19406,21486,21518,21486,21454,21486,21486,21486,21486,21486,21486,21486,23534,23566,23566,23566,23599,25647,23567,23567,23567,23567,23567,25647,25647,21389,8551,6438,8486,8486,8486,8486,8486,8486,8454,10502,10502,10502,12550,14664,14631,14598,16679,16679,16679,16647,16582,16614,18695,20808,22888,22888,20808,16581,12387,12387,12420,22889,24969,22888,22888,22888,24904,26920,26919,26919,26919,26919,28935,28935,28903,26855,20645,12356,10275,10307,23015,35723,14500,16582,20839,20807,20807,20807,18759,18759,18759,18791,18791,18824,20937,18857,16808,18792,18696,18696,18728,18728,18728,20776,20776,20776,20776,20776,20776,20776,31112,37384,28934,24676,30723,32836,32900,32900,35207,14565,8291,8291,8291,14533,20776,20776,22889,24970,24970,20808,22857,24970,25002,24937,24969,22921,20840,22986,27180,22953,18760,16648,14599,14599,14600,16713,18826,16713,14568,14632,14632,14632},
-	{8291,8291,8291,8291,8324,10405,10404,10404,10404,8324,8291,8291,8291,8324,10372,6276,4293,4293,4196,2115,4163,8323,8323,8291,10372,10404,8324,8324,8324,8324,14728,10502,8324,8292,8292,12744,17325,17325,17325,17325,17325,17325,17325,17325,17325,17293,17325,17325,17293,17325,17325,17293,17325,17325,17293,17325,17325,17325,19405,17325,17325,17325,17325,17293,12971,8745,4391,4359,4358,4358,4358,4359,4359,4359,4359,4359,4359,4359,6504,19341,17098,4195,4195,4195,6374,6439,6439,6439,6439,6439,6439,6439,6471,6472,6472,6472,6472,6472,6471,6438,4260,4260,4260,4260,4260,4260,4260,4260,4260,4260,4260,4260,4260,4260,4260,4260,4260,4260,4260,4292,4292,4292,4292,4292,4292,4260,4260,8583,17068,17068,17132,19213,19213,19245,19245,21325,21326,17100,17068,17035,14987,14987,14987,15019,19374,21486,21486,21486,21486,21486,21486,21486,21486,21486,21486,19309,15018,14954,14954,12906,15051,19341,19406,17228,17196,19341,19341,17195,19341,19437,19438,21486,21486,21486,21486,23566,21486,21486,21486,21486,21486,21486,23566,23566,23566,23566,23566,23566,23567,25647,23599,23599,23599,23599,23599,25647,25647,21389,8551,6438,8486,8486,8486,8486,8486,8486,8454,10502,10502,12550,12518,12518,12518,16679,20840,20840,20840,20808,16614,16582,20775,22888,22888,22888,18727,12388,12387,12387,12420,20808,25001,25001,22888,24904,26952,26919,26919,26919,26919,28935,28903,28903,28903,28935,24903,27016,22919,25128,39979,39979,24999,27113,35564,35532,35532,35532,35532,35532,35532,35564,35597,35597,33581,33646,33646,27243,18696,18728,18728,18728,18728,20776,20776,20776,20776,20776,20776,24872,35207,37384,20839,12517,26885,30982,35207,35207,35336,16612,8291,8291,8291,14533,20776,20776,22889,24970,24970,22824,20776,22889,25002,22856,22921,22921,20841,20873,22986,22986,20873,16648,14599,14599,14600,16712,16713,16713,14632,14632,14632,14632},
-	{8291,8291,8291,8291,8292,8324,8324,8291,8291,8291,8291,8291,8291,8292,8292,6276,4293,4228,2114,2114,6243,6210,8323,8292,8324,8324,8324,8324,8292,8324,10372,10404,8324,8324,8486,15051,17325,17325,17325,17325,17325,17325,17325,17325,17325,17261,8744,8679,8648,8648,8680,15148,17325,17325,17325,17325,17293,17293,17357,19405,17325,17325,17325,17293,6568,4326,4358,4359,4358,4359,4358,4359,4359,4359,4359,4359,4359,4358,6504,17293,17228,8550,4163,4195,4260,4293,4326,6439,6439,6439,6439,6439,6439,6439,6439,6471,6471,6471,6471,6439,6374,6374,6406,6406,6406,6406,6406,6373,4260,4260,4260,4260,4260,4260,6341,6341,4260,4260,4292,4292,4292,4260,4260,4260,4260,4260,6470,14987,17068,17100,19245,21358,21358,19245,17165,17165,19245,17132,17100,17068,17100,15019,12906,15019,21454,21486,21486,21486,21486,21486,21486,21486,21486,21486,21486,21486,19277,15018,12906,15018,19341,21486,19438,19438,19438,21486,21518,21486,21453,21453,21486,21486,21486,21486,21486,21486,21486,21486,21486,21486,21486,23566,23566,23566,23566,23566,23566,23567,23599,23599,23599,23599,23599,23599,23599,25647,25647,21389,8551,6438,8486,8486,8486,8486,8486,8454,10502,10502,10502,12550,12518,12518,12518,14598,16679,16647,18727,18695,16614,16614,20775,22888,22888,22888,18727,12388,12387,12387,12387,16581,16614,20808,24969,24904,26920,26919,26919,28935,28935,28903,28903,28903,28903,31047,35370,35435,37612,41996,44205,42092,35563,35500,35532,37612,35532,35532,35532,35532,35532,35532,35564,35596,35597,33581,33613,27243,18727,18728,18728,18728,18728,18728,20776,20776,20776,20776,22824,28967,35175,27015,10533,10501,31208,33224,37384,37384,35336,16613,8291,8291,8291,14533,20776,20776,22889,24970,24969,20776,26952,24937,22889,20808,22921,22921,22921,20873,20873,22954,22986,18792,16647,14599,14599,16712,16713,16712,16712,16745,14632,14632},
-	{4162,8291,8291,8291,8292,8292,8324,8324,8291,8291,8291,8291,8292,8292,6243,4162,2146,4195,2081,2081,6210,4129,8291,8292,8324,8323,8324,10404,8292,8324,8324,10372,8324,8324,8648,17325,17357,17325,17325,17325,17325,17357,17357,17325,10890,8680,4325,4261,4261,4261,4293,8616,8713,8713,8713,8681,8681,8745,15180,19406,17229,8713,8713,8681,6471,4358,4358,4358,4358,4359,4358,4358,4359,4359,4359,4359,4359,4358,6503,17293,19438,17228,14954,6437,2147,4195,4196,4261,4261,4261,4261,4261,4293,6341,6341,6341,6341,6341,6341,6341,6341,6341,6341,6341,6373,6373,6374,6341,4228,4228,4260,4260,4260,4260,6341,6374,6341,4260,4260,4260,4260,4260,4260,4260,4260,4260,10695,19309,17100,17132,19213,19245,19277,21358,21358,21390,19309,17164,15051,15019,15019,14987,15051,17196,21486,21518,21518,21518,21518,21518,21518,21518,21518,21486,21486,21486,21486,19341,19308,19341,21486,19438,21486,21486,19438,19438,21486,21518,21486,21485,21486,21486,21486,21486,21486,21486,21518,23567,21518,21518,21518,23566,23566,23566,23599,23566,23599,23599,23599,23599,23599,23599,25647,25647,25647,25647,25679,21389,8551,6438,8486,8486,8486,8486,8486,8454,10502,10502,10502,12550,12518,12518,14566,14566,14566,16582,16614,16614,16614,18694,20808,22888,22888,22888,20775,12387,12387,12387,12387,12387,12387,16581,27017,26952,26919,26919,28935,28935,30951,28903,28903,28903,30983,33289,35435,35467,35499,41996,44236,44172,39852,35531,37547,35564,37645,35564,35532,35532,37580,37580,35564,35564,35596,35629,33613,27243,18728,18728,18728,18728,18728,18728,25066,29356,29323,27211,22758,31047,31080,20936,14856,16904,33256,35272,35304,35207,33159,16613,8324,8291,8291,14533,20776,20776,22889,24970,24937,20776,29033,29032,22889,20808,22889,22921,22921,20873,20841,20841,20841,18792,18760,14599,14599,16680,16745,16680,14600,16745,16713,14632},
-	{6243,4162,6275,8291,8291,8291,8291,8292,8291,8291,8291,8291,8291,8324,8356,8324,8324,8389,2114,0,2081,4129,8324,8324,8323,8323,8324,8356,10404,8324,8292,8292,8324,8389,8648,17325,17357,17357,19373,17357,17325,17293,17293,10825,4358,4326,4326,4358,4326,4326,4326,4326,4326,4326,4326,4326,4326,4358,8648,15148,8616,4326,4326,4326,4326,4326,4358,4358,4358,4358,4358,4358,4358,4359,4359,4359,4359,4359,6503,19341,19438,15018,8550,4292,4163,4195,4195,4163,4163,4163,4195,4196,4196,4196,4196,4228,4196,4196,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4260,4260,4260,4260,4260,4260,4260,4293,6373,4293,4260,4260,4260,4260,4260,4260,4260,4260,8647,19309,17100,17132,17133,17164,17196,19309,19309,19341,19341,17261,17229,17197,17132,17132,17196,17228,21486,21518,21518,21518,21486,21486,21486,21454,21454,21486,21518,21486,21518,21518,21518,21486,21486,19438,21486,21486,19438,19438,19438,21518,21518,21518,23631,25679,25679,25679,25679,25679,25679,27760,27760,27727,25711,25712,27760,27760,25712,23599,23599,23599,25647,25647,25647,25647,25647,25647,25679,25679,25679,21421,8583,6438,8486,8486,6373,6341,8454,8454,10502,10502,12550,12550,14598,16679,14566,14566,16614,16614,16614,18727,18695,20808,22888,22888,22888,22889,20775,12388,12387,12387,12387,12387,12387,16549,24904,29032,29000,28935,28935,30951,28935,28935,30983,30983,31048,35402,35499,35499,35531,39948,44235,44204,42060,35563,37579,35532,37612,37644,35564,35564,35564,37612,37612,35564,35564,35596,35629,31501,29388,29356,29356,29356,29356,29356,31501,35694,31176,28934,24676,26887,23083,21099,19116,21131,31144,33095,35175,33095,33095,14532,8356,8323,10372,18695,20776,20776,22889,24937,22889,20776,29033,29065,22889,22825,22889,22889,22889,22889,20841,20841,18728,16648,18760,16712,14599,16680,16713,16680,14567,14664,16745,16713},
-	{8323,4162,2081,2081,2081,4129,4129,4129,4129,4129,4129,4129,2081,4162,6341,6341,6341,6341,2146,0,0,2081,8324,8324,8323,8292,8291,8324,10372,10372,8324,8324,8421,14922,10761,19373,17357,17357,17357,19405,15083,6470,6438,4260,4293,4358,4326,4358,4326,4326,4326,4326,4326,4326,4326,4326,4326,4326,6471,12971,4391,4326,4326,4326,4326,4326,4326,4326,4358,4358,4326,4358,4358,4358,4358,4358,4327,4327,6503,17228,15050,6340,4162,4163,4163,4163,4195,4195,4163,4195,4196,4196,4196,4196,4196,4228,4196,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4260,4260,4260,4260,4260,4260,4260,4293,6373,4292,4260,4260,4260,4260,4260,4260,4228,10695,21454,19277,17164,17165,17196,17196,17228,19341,21454,23534,23566,21454,19309,17229,17228,17228,17228,17228,19374,19405,21454,15019,8648,8681,8680,8680,15018,21454,19406,21454,21486,21518,21518,21518,21518,21518,21518,21486,21486,21486,21486,23631,25711,23599,23599,23567,23598,23598,23598,23598,23598,25647,25679,23599,23599,25647,25647,25679,27760,27760,27760,27760,27760,29808,29808,29808,29840,27760,25679,27760,25647,17067,6340,6340,4293,4260,6308,8454,8454,10502,10502,12550,12518,12518,16679,16679,14566,18727,18760,18695,20808,20808,22888,22888,22888,22888,22889,20775,12388,12387,12387,12420,14468,14500,18629,26920,26952,29032,28968,30951,30983,31080,35338,35402,35402,35402,35435,35499,35499,39820,42124,44236,44204,44172,39852,35499,35531,37579,37612,37644,37612,35564,37612,37612,37612,37612,37612,35629,33613,33646,33645,33645,33645,33645,33646,33646,33613,14596,10273,14532,21034,19084,19084,19083,21099,29064,33095,33095,33095,33063,16548,8291,8323,12485,20776,20744,20744,22857,22889,22857,22857,24937,24937,22889,20776,22889,22889,22889,22889,20841,20841,18728,16647,16647,16712,16680,16680,16712,16680,14567,14632,16712,16745},
-	{8291,6243,4162,6242,8356,8356,8356,8324,8324,8324,10372,8356,8356,6276,4293,4293,4293,4261,2114,2081,0,2081,8324,8323,8291,8291,8291,8324,8324,10404,8356,8292,10469,15051,10761,19438,17357,17357,17357,15116,6405,2147,2147,2148,4293,4358,4358,4358,4326,4326,4326,4326,4326,4326,4326,4326,4326,4326,4326,4325,4326,4326,4359,4359,4326,4326,4326,4326,4326,4326,4326,4326,4326,4326,4326,4326,4326,4327,6374,6405,4324,2147,4195,4195,4163,4163,4163,4163,4163,4195,4196,4196,4196,4196,4195,4195,4195,4196,4196,4196,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4260,4260,4260,4260,4260,4292,4260,4260,4260,4260,4260,4260,4260,4228,10728,25679,25647,21454,21390,21422,21390,21390,19341,19373,19406,19374,19373,17293,17261,17261,17229,17196,8648,8616,8616,8616,6472,6407,6439,6439,6439,6503,8616,8616,8680,19277,21486,21550,25711,25711,25679,25679,25711,25679,25679,23599,23631,25712,25711,23631,21486,21486,21486,21518,21518,21518,21518,23599,23599,23567,23567,23599,23599,25647,25647,25679,25679,25679,25679,25679,25679,27760,29840,29840,29840,27760,21325,6373,6341,6406,8422,6308,8454,10502,10502,10502,12550,12518,14566,14566,16679,18792,18727,18760,18695,20840,22888,22888,22889,22889,22888,22889,20775,12388,12387,12420,25033,29259,27243,29194,26984,29000,29000,31080,31047,31080,35338,35403,35403,37515,35435,35403,35402,35435,39884,44236,44236,44204,44236,39818,35369,37580,37612,35596,37644,37645,37612,37612,37612,37612,35564,37612,35597,35629,33645,33645,35726,33646,33646,33646,33646,33645,12645,23145,29452,25357,19116,19116,19083,29193,33127,33063,33095,33063,33095,16548,8291,8291,14566,22889,20744,20744,22857,22889,22856,20776,20776,20841,22889,20776,22889,22889,22889,20841,20841,20809,18728,16647,16647,14599,16712,16745,16712,16680,14567,14632,14632,14632},
-	{8291,8291,8291,8291,8291,8291,8323,8323,8323,8323,8324,6308,6341,4293,4293,4293,4293,4293,2114,0,2081,4130,8292,8324,8324,8324,8324,8324,6308,8324,10404,8324,8453,15019,8712,19438,19438,17358,17293,6469,2147,2180,4260,4260,4326,4358,4358,4358,4326,4326,4326,4326,4326,4326,4326,4326,4326,4326,4293,2180,4326,4326,4326,6407,4359,4326,4326,4326,4326,4326,4326,4326,4326,4326,4326,4326,4326,4327,6374,4294,4294,4326,6342,6341,4196,4163,4163,4163,4195,4195,4196,6276,6276,6276,4228,4228,4228,4228,6276,6276,6276,4228,4228,6308,4228,4228,4228,4228,4228,4228,4196,4228,4228,4260,4260,4260,4260,4260,4260,4260,4260,4260,4260,4260,4260,4228,10696,21518,21518,21486,21486,21454,19309,19309,19341,19373,19373,19373,19341,19341,17293,17261,17228,15084,8551,6407,6439,6407,6407,6439,6439,6439,6439,6439,4391,4391,6439,8648,17228,19341,19341,21453,21518,21518,21518,21518,21518,23599,23599,21518,21518,21518,21518,21518,21518,21518,21518,21518,21518,21518,23599,23599,23598,23599,23599,23599,23599,23599,23599,23599,23631,25679,25647,25679,25679,25679,25647,23502,23438,14922,8486,8487,8454,6308,8454,10502,10502,10502,10470,12485,12485,14533,16679,20905,18760,18760,18727,20840,20808,20776,22889,22889,22889,22889,20775,12388,12388,18694,25001,25065,33452,33419,33355,33322,35338,35370,35403,35370,35371,35403,35403,37483,35403,35371,35370,35402,39819,44236,44235,44204,42188,42124,39819,37580,35596,39916,37676,37612,37612,37612,35564,35564,35564,37612,37612,35597,33613,33645,33646,35726,33678,33646,33646,29452,18985,29485,33678,29517,21164,19116,19083,29096,33095,33063,33095,33063,33095,28967,12388,8291,12485,22889,20776,20744,22857,22889,22856,20776,20744,22856,22921,20776,22889,22889,22889,20841,20809,20808,18728,16647,16647,14599,14599,18793,18793,16680,14567,14632,14632,14632},
-	{8291,8291,8291,8291,8291,8291,8291,8291,8291,8291,8291,6243,6276,6276,4260,4260,4293,4293,2113,2081,2081,6211,8324,6309,4293,4293,8324,6276,6308,8292,8324,10404,10533,15018,8680,17357,19470,21486,15083,4292,4228,4326,4326,4326,4325,4326,4326,4326,4326,4326,4326,4326,4326,4326,4326,4293,4293,4293,2180,2180,4326,4326,4326,4326,6407,4358,4326,4326,4326,4326,4326,4326,4326,4326,4326,4326,4326,4327,4327,6374,6374,6374,6374,6374,4228,4196,4195,4195,4228,4228,6342,6374,6375,6374,6374,6374,6374,8422,8423,8455,6407,6342,6374,6407,6406,4261,4260,4228,4195,4195,4227,4227,4228,4260,4260,4260,4260,4260,4260,4292,6373,4260,4260,4260,4228,4228,8615,21486,21486,21486,21486,21486,21486,19405,19405,19405,19405,19405,19373,19373,19341,17261,15051,12906,6471,6407,6407,6407,6407,6407,6439,6439,6439,6439,6439,6439,4391,4391,6504,6504,4390,10793,19405,21518,21486,21486,21518,21518,21518,21486,21518,21518,21518,21518,21518,21518,21518,21518,21518,23566,23598,23631,23631,23598,23599,23599,23631,23631,25679,25679,25679,25679,25679,25711,25711,25711,23566,10696,8551,8519,8486,8486,8454,8389,10502,10502,10502,12518,10405,10372,10372,12453,16646,20841,16647,18760,20840,20840,22888,22888,22888,22889,22889,22889,20775,12388,12388,18695,24968,25001,31340,33420,35467,35435,35403,35403,35403,35403,35403,35435,37548,37547,35403,35403,35370,37223,39625,44236,44203,42187,44235,44236,39819,37515,37547,41964,37676,35564,37612,37612,35564,35564,35596,37644,37644,35597,35661,33646,33646,33678,35726,35726,33646,18952,12581,29452,33678,33646,25292,17002,19083,29064,33095,33095,33095,33063,33031,30950,14436,6211,10372,22856,22856,18695,18727,22889,22857,20744,20744,22856,25002,22857,22857,22889,22889,20776,20776,18696,18696,16647,16647,14567,14567,16680,18826,16680,14567,14632,14632,14632},
-	{4162,6242,8291,8291,8324,8292,8291,8291,8291,8291,8291,6210,6243,2114,4227,2147,4293,4293,2114,4194,4162,8324,8389,4293,4293,4293,6309,6308,6308,8292,8292,8324,10534,15051,8712,19405,19437,21454,8582,4195,4228,4326,4326,4326,2212,4293,4326,4294,4294,4293,4293,4294,4293,4293,4261,2148,2147,2147,2147,2148,4293,4293,4293,4293,4293,4293,4294,4293,4294,4326,4326,4326,4326,4327,6407,4326,4326,4326,6374,6374,6374,6374,6374,6374,6374,6342,6309,6276,6374,6374,6374,6375,6375,6375,6375,8423,8423,8423,8455,8455,6407,6407,8455,6439,6439,6439,6439,6373,4195,4195,4228,4228,4228,4260,4260,4260,4260,4260,4260,4260,4260,6341,4260,4228,4260,2180,8615,21486,21518,21518,21486,21486,21486,19438,19437,19405,19405,19405,19405,19373,17293,15051,12905,14986,6471,6406,6407,6406,6407,6407,6407,6439,6439,6439,6439,6439,4391,4391,4391,4423,4325,4260,15115,21518,21518,21518,21518,21518,21518,21518,21518,21518,21518,21518,21518,21518,21518,23566,23566,23599,23598,23598,25679,25679,23599,23631,25679,25679,25679,25679,25679,25679,23534,19308,19308,21357,19212,8551,6438,8486,8486,8486,8454,8454,10502,10502,10502,12518,12518,12518,14566,12485,14533,20841,14534,18727,22921,22889,22889,22888,22888,22889,22889,22921,20775,12388,12388,18695,24969,24936,27081,33420,35435,35403,35403,35403,35403,35403,37515,35467,37547,37547,35467,35435,37321,36997,39431,42059,44235,44203,42188,44236,39593,37353,37481,39915,37676,37612,37644,37644,37644,37644,37644,37644,37644,37645,35661,33646,33646,33646,33678,35726,33646,33646,31565,33646,33646,35726,18952,10631,21131,29064,33063,35014,32998,32998,32869,28708,10306,8291,14533,20744,22856,14533,10372,20776,22856,20744,20744,22856,22889,22889,22921,22889,22857,20776,20776,18728,18728,16647,16615,16615,14567,16680,16713,16680,14567,14632,14632,14600},
-	{0,2081,8291,8291,8324,8324,8291,8291,8291,8291,8291,6211,4195,2114,4227,2114,4293,4293,2113,6243,8323,8291,6276,6373,4293,4293,6341,6308,6308,8292,8292,8292,10501,17131,8712,19437,19438,15115,6405,4228,2180,4326,4326,4326,2180,4260,4293,2148,2148,2147,2147,4260,2147,2180,4228,2147,2147,2147,2147,2147,2148,2148,2147,2147,2147,2147,4228,4195,4228,4261,4261,4261,4261,4261,4261,4261,4260,4260,4261,6342,6342,6342,6342,6342,6342,6342,6310,4229,6374,6375,6374,6375,6375,6374,6374,6374,8423,8423,8423,6375,6407,6407,6407,6407,6439,6439,6440,4326,4195,4228,4228,4228,4228,4228,6373,6373,4228,2180,2180,4228,4325,8583,6405,4228,2180,4292,12873,21518,21518,21518,21518,21518,21518,21486,21486,19438,19405,19405,19405,19405,17196,12906,15051,19309,8584,6406,6406,6406,6406,6407,6407,6439,6439,6439,6439,6439,4391,4358,4326,4358,4293,4228,17131,21518,21518,21518,21550,21518,21518,21518,21518,21518,21518,21518,21518,21550,21550,23598,23599,23599,23598,23598,23599,25711,25711,23534,17229,17229,19277,17229,19341,23566,14986,6438,6438,6438,6438,8455,8486,8486,8486,8454,8454,10502,10502,10502,10470,12518,12518,12518,14566,12485,14533,20840,14533,18727,25002,22953,22889,22888,22888,22888,22888,22889,18662,12420,12388,20743,24969,24936,27081,33420,35435,35403,35403,35403,35403,35403,35435,37515,37547,35499,35467,37515,39304,39045,39044,39754,42188,44204,44204,44236,39592,37352,39948,42124,37676,37612,37644,37644,37644,37644,37644,37644,37645,37645,35629,35694,33678,33678,33678,33646,33646,33646,33678,35694,35726,29485,12613,12711,25324,31274,32966,30724,30723,30724,32966,31047,12451,14501,20743,20744,16615,10404,8323,18695,20744,20744,20744,22856,22857,20776,24970,22889,22856,18696,20776,20809,18728,16680,16648,16615,14567,16680,16713,16680,14567,14632,14632,14600},
-	{0,2081,6242,6211,8291,8324,8324,8291,8291,8291,6210,2081,0,2081,2115,2114,4293,4293,4195,6243,8291,8324,6308,6373,6373,4293,6341,6308,6341,8324,8292,8292,8453,17196,13035,19438,19438,8615,2147,4228,4228,4261,4293,4293,2180,4195,4228,4228,4195,2147,2147,4260,4195,2180,4261,4260,4260,4260,2180,4196,4195,4195,2147,2147,2147,2147,4194,4195,4195,2114,4162,4162,2114,2114,2114,4162,4195,4163,4163,4228,4261,6342,6342,6342,6342,6342,6309,6276,6342,6374,6342,6374,6342,6374,6374,6374,6374,6374,6375,6375,6407,6407,6407,6407,6439,6439,6439,6374,4228,4228,4228,4228,4228,4228,6438,6438,8486,8583,8551,8551,10729,17068,10729,10664,8616,10761,17261,21518,21518,21518,21518,21551,21518,19470,19438,19438,19438,19437,19405,19405,17260,15115,19341,15018,6405,4293,6341,4293,4293,4293,4293,4293,4293,4325,4325,4325,4293,4228,4228,4228,4228,4260,17131,21550,21518,21550,23599,21550,21518,21518,21518,21550,21550,21550,23599,23599,23599,23599,23599,23599,23599,23631,23599,17228,17197,15019,6568,6536,6536,6536,8649,12841,6438,6438,6438,6438,6438,8487,8486,8486,8454,8454,8454,8454,10502,10502,10470,12518,12518,12518,14566,14566,16647,20840,16647,18760,22921,25002,22953,22921,22889,22921,22888,18662,12388,12388,12388,20743,24969,24968,27049,35467,35435,35403,35403,35403,35403,35403,35403,37515,37580,35467,35435,37450,39077,39044,39044,41769,44236,42188,42188,41995,39366,37384,42028,41996,37644,37644,37612,37580,37612,37644,37645,37645,37645,37645,37677,35661,33614,33646,35694,33646,33646,33678,23178,25259,21000,12613,8355,25259,33646,35629,33225,31112,33160,31112,33451,33613,25129,20775,20743,20744,14501,8259,10371,20776,20744,20744,20743,22856,22857,20776,22857,22889,20776,18663,20776,20809,20776,18728,18760,18696,14567,18761,18761,16680,14567,14632,14632,14632},
-	{0,2081,4162,4130,8291,8291,8324,8324,8292,8324,4162,0,2048,4162,2147,2114,4293,4293,6276,8291,8324,6309,4293,4293,4293,6374,6341,6276,4293,6309,8324,8292,8452,19373,21518,17227,17195,8615,2147,2147,4195,4195,4260,4228,4195,4195,4195,4228,4195,4228,2180,4260,4228,4260,4293,4326,4326,4326,4326,4261,4228,2147,2115,2114,2115,2114,2114,4163,4196,4195,2114,2114,2114,2114,2114,4162,4195,4195,4163,4162,4195,4228,4228,4228,4229,4229,4228,4228,6342,6342,6342,6342,6342,6374,6374,6374,6374,6374,6375,6375,6375,6407,6407,6407,6407,6439,6439,6374,4228,4228,4228,4228,4228,4228,4228,4260,8519,14955,15020,15020,15020,15020,15052,17165,19245,17196,19341,21550,21518,21518,21518,21518,21518,21518,21518,21518,21518,19470,19470,19438,19437,19437,19405,6470,2147,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4228,4228,4228,2179,2212,15115,21550,21550,21550,21550,23630,21550,21550,21550,21550,23598,19309,12971,12971,15019,15019,15019,15019,15051,15051,12971,6568,6504,8617,8617,6536,6536,4391,4358,6373,6406,6438,6438,6438,6406,8486,8486,8454,8454,8454,8454,8454,10502,10470,10470,12518,12518,12518,14566,16647,18792,20840,20840,20840,20840,22921,22953,22888,22889,22921,22888,16581,18759,14436,12388,20808,25001,24936,29097,35467,35435,35403,35403,35403,35403,35403,35403,35435,37548,37516,35435,37386,39045,39012,39044,41769,42188,42156,42027,39399,39044,39401,39593,37384,37580,37644,37612,37548,37548,37612,37612,37613,37613,37613,37645,35629,33614,33613,35694,33678,33678,35726,23178,23211,16872,16839,25226,35694,33645,33645,33646,33613,33613,33645,33645,33613,31533,19147,18985,20775,12453,6242,8323,20776,22856,20744,20743,22824,22857,20744,22856,22856,22857,20744,20776,20809,20776,18728,18760,18696,14567,18760,18760,16680,14567,14600,14632,14632},
-	{6243,6243,6243,6211,8291,8291,8291,8324,8291,8324,4194,0,2048,4162,4227,2115,4293,4293,8324,6276,6341,4293,4293,4293,4293,6374,6374,6308,4293,6341,6308,8356,14953,19437,19470,17260,12840,6372,2147,4195,4195,2147,4260,4228,4195,4195,4228,4228,4228,6341,4228,4260,4228,4293,4293,4326,4326,4326,4326,4294,4294,4261,4229,4228,4228,4228,4228,4228,4261,6341,4261,4228,4228,4228,4196,4162,4162,4195,4195,4163,4162,4162,4162,4163,4163,4163,4196,6309,6342,6342,6342,6342,6342,6342,6374,6374,6374,6374,6374,6375,6375,6407,6407,6407,6407,6439,6439,6374,4228,4228,4228,4228,4228,4228,4228,4228,4228,8519,14987,15020,15020,15052,15084,17132,17197,19277,19341,21550,21550,21550,21550,21550,21550,21550,21550,21550,21550,21550,21550,21518,19438,19437,19405,6470,2147,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4228,8551,10696,10696,10696,10728,10760,17261,21550,21550,21550,21550,21550,23631,23598,21550,23598,23598,15083,4423,4423,4423,4423,4423,6503,6504,6504,6504,6504,6504,6536,8649,8617,6536,4293,4260,6406,6406,6438,6438,6406,6406,8454,8454,8454,8454,8454,8454,8454,10502,10470,10470,12518,12518,12518,14566,16647,18792,20840,20840,20840,22889,22889,22889,25001,20808,16582,16614,20807,25034,16582,16581,24969,25001,24936,29065,35435,35435,35403,35403,35403,35403,35403,35403,35403,35403,35435,37516,37353,39045,39012,39044,41770,42092,39592,39335,37028,39044,39400,37191,39045,37320,37612,37645,37612,37612,37645,37580,37580,37613,35500,37613,35629,33614,33613,35726,33678,33678,33678,35726,35758,33678,35694,35694,35693,33645,33645,33645,33613,33613,33613,33613,33613,29581,17356,16937,20775,14501,6242,8291,18663,20776,18695,20743,22824,22856,20744,22856,20776,20744,22824,20776,20808,20776,18728,18760,18696,14567,16680,18760,18761,14567,14600,14632,14632},
-	{8323,8292,8291,8291,8291,8291,8291,8291,8324,10404,8356,8323,6275,8323,6308,4260,4293,4293,6309,4293,4326,4293,4293,4293,4293,4293,6373,8389,6341,6341,6276,8388,19308,19470,19469,19470,17228,6469,2147,4195,2147,2147,4260,4228,4195,4195,4293,4293,4293,6374,6341,4293,4261,4293,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,6342,6374,6342,4262,6310,4228,4162,4162,4162,4163,4163,4162,4162,4163,4163,4163,4163,4196,6342,6342,6342,6342,6342,6342,6342,6342,6374,6374,6374,6374,6374,6375,6407,6407,6407,6407,6439,6439,6374,4228,4228,4228,4228,4228,4228,4228,4228,4228,4292,12907,15020,15052,15052,15084,17164,17197,19309,21454,21550,21550,21550,21550,21550,21550,21550,23630,21550,21550,21550,21550,21518,19438,19470,19437,17163,12905,4260,4227,4227,4227,4227,4227,4227,4227,4228,4228,4228,6438,8519,8519,8551,10793,17164,19406,21550,21550,21550,21550,21550,23630,23598,23598,23598,23598,15083,4423,6471,6471,4423,6503,6504,6504,6504,6504,6504,6536,6504,6536,8649,8616,6471,6439,6438,6406,8454,6438,6406,6406,8454,8454,8454,8454,8454,8454,8422,10470,10470,10470,12518,12518,12518,14566,16647,18792,20840,16647,20808,22889,22921,22921,22921,20775,14468,14468,22888,24969,22888,22888,24969,24969,24969,29097,35467,35435,35435,35403,35403,35403,35403,35403,35403,35403,37256,37450,37418,39109,39044,39045,39270,39367,39077,39012,39302,39722,41899,39335,39012,39174,37580,35532,37580,37644,37612,37548,37580,37645,37613,37645,35662,35694,33646,35726,35726,35726,33646,35694,35726,33646,33646,33645,33646,33645,33645,33646,33613,35694,35693,33387,31241,21420,13324,17130,21031,12580,8291,10371,18695,20743,18695,18663,22824,20776,18695,20744,20711,20679,20711,22857,20808,20744,18728,18760,18728,16615,16680,18728,16712,14567,14600,14632,16713},
-	{8291,8291,6210,2081,2081,2081,2081,2081,4162,8356,8356,8324,8323,8324,6341,4293,4293,4293,4293,4326,4326,4293,4293,4293,4293,4293,6341,6341,6309,8356,8388,8452,17260,19502,19470,19470,19438,8615,2115,4195,2147,4195,4228,4228,4228,4293,4293,4293,4293,4326,6406,4325,4293,4293,4294,4294,4294,4294,4294,4293,4294,4294,4294,4294,4294,4261,4262,4262,4262,4262,6342,6374,6342,4261,4228,4163,4162,4162,4162,4163,4195,4163,4163,4163,4163,4163,4196,6342,6342,8423,8422,6342,6342,6342,6342,6342,6342,6374,6374,6374,6375,6375,6375,6407,6407,6439,6439,6373,4228,4228,4228,4228,4228,4228,4228,4228,4228,4292,12874,15052,15052,15084,15116,17197,17229,17261,19406,23631,21550,21550,21550,21550,21550,21550,21550,21582,21550,21550,21550,21550,19470,19469,19470,19438,17228,12906,12874,12873,12873,12842,10794,10794,10794,10794,10794,12874,12874,12874,12874,12906,15019,15148,19438,21550,21550,21550,21550,21550,21550,21550,23631,23631,21583,15084,4423,6471,6472,6471,6472,6504,6504,6504,6504,6504,6536,6536,6536,6569,8649,6569,6504,4325,6406,8454,6373,6373,6406,6406,8454,8454,8454,8454,8422,10470,10470,10470,12518,12518,12518,12518,14566,16647,18792,20840,14534,18727,22921,22921,22889,22921,18694,20807,20840,22921,24969,24969,24969,24969,24969,24969,29162,35435,37483,35435,35435,35435,35435,35435,35403,35403,37451,37159,37353,37514,41867,39496,39045,39012,39012,39013,39270,41962,44236,44204,39367,39012,39174,37580,35500,37548,37612,37644,37612,37645,37645,37644,35532,35597,35694,35726,35726,35726,35726,33678,33646,33646,33678,35726,33646,33646,33646,33646,33614,33613,33646,33451,33128,31047,17227,6823,15274,19174,16870,20999,20871,22856,20776,20744,20743,20743,20711,20711,20711,20679,20679,18631,20776,22889,20776,18728,18760,16648,14567,16680,16712,16680,14600,16713,14632,14664},
-	{8291,8291,4162,2081,2081,4162,2049,0,2081,4162,6243,4162,4194,4162,4261,4293,4293,4293,4293,4326,4326,4293,4293,4293,4293,4293,4293,4293,4260,10695,17228,17260,19469,19502,19437,19405,12905,4260,2147,4196,4260,4195,4260,4293,4293,4293,4293,4293,4293,4293,4325,6406,4325,4293,4293,4294,4294,4294,4293,4261,4293,4293,4293,4262,4261,4261,4261,4261,4261,4261,4261,6342,6342,4195,4163,4162,4162,4162,4162,4162,6243,6243,4163,6276,6309,6276,4228,6309,6310,6342,6342,6342,6342,6342,6342,6342,6342,6374,6374,6375,6375,6375,6375,6407,6407,6439,6374,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,6470,14954,15019,15116,17196,17229,17261,17293,19405,23631,21582,21550,21550,21550,21550,21550,21550,21550,21550,21550,21550,21550,19470,19469,19469,19438,15148,15116,15116,15084,15084,15084,15116,15116,15084,15084,15084,15116,15116,17196,17197,17197,17197,15148,19438,21550,21550,21550,21550,21550,21550,21550,21582,23566,21486,15051,4423,6471,6471,6471,6504,6504,6504,6504,6504,6536,6536,6536,6536,6536,8616,6568,6504,4293,6373,6341,6341,4260,6309,8454,8454,8454,8454,8454,8422,10470,10470,10470,12518,12518,12518,12518,14566,16647,18792,20840,14566,18727,22921,22921,22889,22921,16614,20808,27114,25001,24969,24969,24969,24969,24969,24969,29162,37548,37515,37483,35435,35435,35435,35403,35403,35435,37515,39239,37321,37416,42092,39592,39044,39013,39012,39173,41930,44236,42188,42156,39367,39012,39174,37580,37548,37548,37580,37580,37580,37580,37613,37612,35532,35565,35694,35726,35726,35726,35726,33678,33678,33646,33646,35726,35726,33646,33645,33646,33646,33613,33613,33549,33257,31112,19340,13227,17323,21191,25290,31532,31436,29323,29291,29291,29324,29291,22856,20679,20679,20679,20679,18631,20744,20776,22889,20776,18728,16648,14567,16680,16712,16680,14567,16680,14632,14632},
-	{6243,8291,4162,4129,2081,4162,2081,4162,2081,2049,0,0,0,2113,4261,4293,4293,4293,4293,4293,2180,4260,4293,4293,4293,4293,4293,4293,4293,6405,13003,17325,17293,17293,13002,6437,4260,4195,4260,4228,4260,4228,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,6374,4293,4293,4293,4294,4262,4261,4228,4261,4293,4261,4262,4261,4261,4261,4261,4261,4261,4261,4261,4261,4162,4162,4162,4162,4162,4162,4162,4163,6244,6276,6277,6309,6309,6277,4196,4196,6276,6309,8422,6341,6309,6342,6342,6342,6342,6342,6342,6342,6342,6374,6374,6374,6406,6342,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4292,8648,17197,17229,17261,17293,17325,19405,21550,21582,21582,21550,21550,21550,21550,21550,21550,21550,21582,21550,21550,19502,19470,19470,19438,17228,15148,17197,17229,15116,15116,15116,15116,15116,15116,15116,15148,17228,19341,17261,17261,17261,17261,21518,23630,23630,23630,23598,23599,23631,23631,21453,8582,8582,6536,6471,6471,6471,6504,6504,6504,6504,6504,6504,6504,6504,6504,6472,6472,6504,6504,8584,6373,6341,6341,6309,4228,4228,8422,8454,8454,8454,8422,8422,10470,10470,10470,10470,12518,12518,12518,14566,16647,18792,20840,18792,20840,20841,22921,22921,22921,16614,20775,25001,27082,25001,24969,24969,24969,24969,24969,27082,35468,37516,35435,35435,35435,35435,35435,35435,37547,39596,39239,37417,41995,41865,37125,39013,39012,39012,39174,41963,44236,42188,42156,39367,39012,39174,39660,37612,37612,37612,39661,37580,37580,37612,37612,35565,35597,35694,35726,35726,35726,35726,35726,35726,33678,33646,33646,35726,35726,33646,33646,33646,33646,33613,33613,33581,35629,31597,29549,29517,29484,31532,33581,33581,31436,31436,29388,31468,31468,22889,20679,20679,20679,20679,18631,18695,20744,20776,20841,20808,18696,14567,16680,16712,14599,14567,14600,14600,14632},
-	{2081,6211,4162,2048,0,2081,2081,6243,4163,2082,0,0,2081,6243,4293,4293,4293,4293,4228,4228,4228,2180,4260,4293,4293,4293,4293,4293,4293,6341,6406,6438,6437,4357,4357,4293,4293,4228,4261,4228,4260,4228,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,6374,4293,4293,4261,4262,4261,4261,4262,4262,4262,4261,4261,4261,4261,4261,4261,4261,4261,4261,4229,4162,4162,4162,4162,4162,4162,4162,4163,4196,8390,8390,6309,6309,6308,4163,4163,4163,4195,4195,4195,6244,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,2147,8583,17229,17261,17293,19373,19406,21518,21550,21550,21583,21550,21550,21550,21550,21550,21550,21550,21550,23631,21550,21550,19502,19502,19470,17261,17229,17229,17229,17229,17228,15180,15180,15180,15180,15180,17229,17261,17293,21454,21454,21486,23599,25711,25711,25743,25743,25711,25712,25744,27792,23534,6340,4260,4390,4391,6471,6503,6504,6504,6504,6504,6504,6504,6504,6536,6471,4293,4293,4325,6373,6405,8486,8421,6340,6309,4228,4228,8422,8454,8454,8422,8422,8422,10470,10470,10470,10470,12518,12518,12518,14566,16647,18792,20840,20840,20840,20841,22921,22921,22921,16614,20775,24969,25001,27114,25001,24969,24969,24969,24969,27082,35435,37515,37515,37515,37515,37580,37580,37580,39628,39563,39206,37546,42156,41801,39044,39012,39013,39013,39045,39334,41930,42059,42156,39399,39141,39174,39563,39660,39692,37644,39660,37612,37612,37644,39725,37677,37709,35694,35726,35726,35726,35726,35726,35726,33678,33646,33646,33646,35726,35726,33646,33646,33646,33613,33613,33613,33613,33645,33613,33581,33581,33581,33580,31533,31468,31436,31436,31468,33516,24937,20679,20679,18631,18631,18631,18663,20744,18696,20808,20841,16615,14535,16680,16680,14599,14567,14599,14599,14664},
-	{0,2081,2113,0,33,4162,6243,6243,4163,2147,2114,6210,8291,6276,4293,4293,4293,4261,4228,4228,4228,2180,4260,4293,4293,4293,4293,4293,4293,4293,4293,4293,4325,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4325,6374,4293,4261,4261,4261,4261,4262,4262,4261,4261,4261,4261,4262,6310,6310,6309,6309,6277,4228,4162,4162,4162,4162,4162,4162,4162,4163,4196,6309,8390,6342,6309,6276,4196,4196,4196,4196,4196,6276,6277,6244,6244,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4195,8615,19406,19438,19405,19438,21550,21550,21550,21550,21550,21550,21550,21550,21550,21550,21550,21550,21550,21550,23630,21550,21550,21550,21518,17293,17261,17261,17261,17293,17261,17260,17261,17261,17293,17293,17325,17325,17325,19406,19406,21518,23631,21550,23598,23630,23630,23630,23630,23630,23663,21453,6372,4227,4227,4260,4391,6503,6504,6504,6504,6504,6504,6504,6504,6504,6504,6504,6504,6504,6504,6504,8552,8486,6373,6341,6308,6308,8422,8422,8422,8421,8389,8421,10470,10469,10470,10470,12518,12518,12518,14566,16647,18792,18792,20840,20840,20841,20873,22921,22921,16614,20775,24969,24969,25002,27114,25001,24969,24969,24969,27082,35500,37547,37612,37612,37580,37612,39660,39660,37612,39303,39077,39625,41963,41898,37286,39238,39077,41060,39012,39044,39076,39592,44172,39431,41705,39173,39271,39660,39660,39660,39692,37644,37644,39693,39725,37677,37742,35726,35726,35726,35726,35726,33678,33678,33678,33646,33646,33646,33646,35726,35726,33645,33645,33613,33613,33613,33613,33613,33646,33581,33581,33581,33581,31533,31501,33549,31501,31501,33549,24969,20679,18631,18631,18631,18631,18664,20744,18696,18695,16583,16583,14535,16648,16680,16648,12487,12487,12519,14600},
-	{0,0,1,2114,4162,6243,8291,6243,4163,2147,6243,6243,6243,8292,4293,4293,4293,4228,2148,4228,4228,4228,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,6406,6374,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,6374,6374,4228,4196,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4228,4196,4163,4162,4162,4162,4162,4162,4162,4162,4162,4195,6276,6277,6341,6309,4196,6309,6309,6309,6309,6309,6342,6342,6341,6341,6277,6276,6244,4195,4195,4195,4195,4195,4195,4195,4195,4195,4196,4196,4196,4228,4228,4228,4228,4228,4228,4228,4227,4195,10728,21550,21550,21550,21550,21582,21582,21582,21550,21550,21550,21550,21550,21550,21550,21550,21550,21550,21550,21582,23631,21550,21550,21518,17293,17261,17293,17261,17261,17293,17293,17293,17293,17357,21518,21550,23631,23631,23631,25679,27792,23631,21550,21582,23630,21582,21582,21582,23630,21582,17130,6339,4195,4227,6373,6503,6503,6504,6504,6504,6504,6504,6504,6504,6504,6536,6536,6504,6536,6536,6536,6504,6406,8454,8454,8422,8422,8422,8422,8422,6309,6243,8389,10470,10469,10470,10470,10470,12486,12518,12518,14599,18792,18792,20841,20840,20841,20873,22921,22921,16614,20775,24969,24969,24969,27082,27082,24969,24969,24969,27114,35565,37580,37580,37580,37580,37579,37580,37612,39628,39303,39238,37061,37254,42091,42124,39755,37126,39044,39334,39367,39303,37416,41995,39431,41770,37126,39174,39530,39660,39660,39692,37644,39693,39725,37677,37677,35694,35726,35726,35726,35726,35726,33678,35726,33678,33646,33646,33646,33646,33645,35726,33646,33613,33613,33613,33613,33613,33613,33581,33581,33581,31533,31533,31533,31501,31501,31501,31501,31500,27178,20743,18631,18631,18631,18631,18663,18696,18696,18663,16583,16615,14535,16648,16680,14600,12487,12487,12519,12552},
-	{33,0,2081,2115,4163,6243,8291,4195,2115,2147,4195,6243,6243,6276,4293,4293,4293,4228,2148,4196,2180,4228,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4325,6406,6374,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4196,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4163,4163,4195,6244,6244,6276,6276,6276,6276,6277,6277,6276,6276,6309,6309,6277,6276,4195,4195,4195,4163,4195,4195,4195,4195,4195,4196,4196,4196,4228,4228,4228,4228,4228,4228,2180,4195,2147,10727,21550,21550,21550,21582,21582,21582,21582,21582,21582,21582,21582,21582,21582,21582,21582,21582,21582,21550,21550,21582,23631,21550,19502,19405,17293,17261,17293,17293,17293,19374,17293,17293,21518,23630,25711,25711,25711,25711,23631,23630,23631,21582,21582,21582,21582,21582,23630,23630,21518,6436,4194,4195,4227,6405,6504,6504,6504,6504,6504,6504,6504,6504,6504,6504,6536,6536,6504,6471,6438,6471,6471,6406,8487,10567,8454,8422,8422,8422,8422,6308,6243,8389,10469,10469,10470,10470,10470,12486,12518,12486,14598,18792,18792,20841,20840,20841,20873,22921,22921,16614,16614,22889,24969,24969,24969,24969,24969,24969,24969,27114,35500,35467,35435,35467,37580,37579,37580,39660,39628,37255,39722,39592,39592,42123,42188,39915,39561,39527,42027,44204,39916,37256,39399,39302,39463,39109,39012,39207,37515,39692,37644,37644,37644,39693,37645,37677,35661,35726,35726,35726,35726,35726,33678,33678,35726,33678,33646,33646,33646,33645,33645,35726,33646,33613,33613,33613,33613,33581,33581,33613,33613,33581,31533,31533,31501,31501,31468,31468,31437,31469,22889,18663,18663,18631,18631,16583,18663,18663,16615,16615,16615,14535,16616,16680,14600,12487,12487,12519,16777},
-	{0,0,2082,2115,2115,4195,4195,2115,2115,2147,4163,6243,8291,6276,4261,4293,4261,4228,4228,4228,2148,4228,4260,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,6341,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4260,4195,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4130,4162,4162,4162,4162,4163,4163,4163,4162,4162,4162,4162,4162,4162,4162,4162,4163,4163,6243,4163,4163,4163,4163,4163,4163,4163,4163,6243,6276,4195,4163,4195,4195,4195,4163,4195,4195,4195,4195,4195,4195,4196,4196,4228,4228,4228,4227,4195,2147,2147,2147,6373,15082,21550,21550,21550,21582,21550,21550,21550,21582,21582,21582,21582,21582,21582,21582,21582,21582,21582,21582,21582,21582,23630,23630,21550,21518,17357,17293,17293,17293,17293,17293,17325,19438,21582,23663,23663,23663,23663,23663,23663,23663,25711,25711,25711,25711,25711,23663,21582,23631,21518,6436,4194,4195,4227,4292,6405,6373,6405,6405,6405,6405,6406,6406,6439,6471,6471,6471,6471,6373,6308,6373,6406,8454,8422,8487,10535,8454,8422,8422,8422,8356,6244,8389,10438,10469,10437,10438,10438,12486,12486,12486,14599,18792,18792,18793,20840,20840,20873,22921,22921,16614,12420,20808,24969,24969,24969,24969,24969,24969,24969,27114,33484,35468,35435,35435,37547,37580,37580,37547,39628,37417,41930,44204,44204,44204,44204,44204,44204,44204,44204,44236,42060,39690,39368,39109,39044,39044,39044,39013,39369,39692,37644,37644,39692,39692,37677,37677,37742,37774,35726,35726,33646,33646,35694,35726,35726,33678,33646,33646,33646,33645,33645,33645,33646,33613,33613,33613,33581,33581,33581,31533,33581,33613,31533,31501,31500,31500,31436,29356,29324,29388,27146,25002,18695,16582,16582,16583,18663,16583,16582,16582,14534,14535,14535,16648,14567,12486,14631,18889,25227},
-	{0,0,2114,4195,2115,2115,2115,2147,2147,2147,2115,4195,6243,6275,4261,4261,4228,2148,4228,4228,4196,4196,4228,4260,4228,4228,4228,4228,4228,4261,4293,4260,4228,2148,4260,6341,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4260,4228,4228,4195,6243,6243,6275,8324,8324,8324,6243,4162,4163,4162,4130,4130,4162,4162,4162,4162,4163,4163,4163,4163,4163,4162,4162,4162,4162,4162,4162,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4162,4163,4163,6244,6276,4195,4163,4163,4195,4163,4195,4195,4195,4195,4195,4195,4196,4196,4196,4228,2147,6405,10664,10696,8648,8680,12970,21550,21582,21550,21550,21550,21550,21550,21550,21582,21550,13035,10890,12938,12938,12938,12906,12906,12906,12906,12906,12906,12906,12938,15019,19438,21518,19437,19406,19438,19438,19438,19437,21550,21582,21550,21550,23630,23663,23663,23663,23663,27792,27792,27824,25711,25711,25711,23663,25744,25647,8485,4194,4227,4227,4227,4227,4227,4227,6275,4227,4227,6275,4227,6373,6406,6406,6406,6406,6374,6341,6341,6341,8422,8422,8422,8486,10535,8422,8422,8422,8356,6244,8389,12551,10470,10437,10437,10438,12486,12486,12486,14599,18792,18792,18793,20840,20840,20841,20841,22921,16614,12420,20808,24969,24969,24969,24969,24969,24969,24969,27114,33517,35500,35435,35435,37515,37548,37580,37580,39628,39660,42028,44236,44204,44204,44204,44204,44204,44204,44204,44204,44204,44204,42028,39625,39141,39012,39013,39174,39531,39660,37644,37612,39660,37644,37677,37709,37742,35726,35726,35726,35694,35662,35694,35726,33678,33678,33646,33646,33646,33645,33645,33613,33613,33613,33613,33613,33613,31533,31533,31533,31533,31533,33613,31533,31500,31500,31436,29324,29356,31468,29356,29324,25066,22985,22953,22953,22986,23018,22953,20905,20905,20905,20970,20970,20937,18889,21002,25259,25291},
-	{0,0,2082,4228,4195,2115,2147,2147,2147,2147,2147,2147,4163,4195,4260,4260,4228,2148,2148,4228,4196,4196,4196,2148,2147,4195,2115,4163,4163,4195,4228,4163,4195,4260,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4260,4228,4196,8356,6243,8324,8324,10404,10404,10437,12485,12485,12485,10404,8324,8324,6211,6210,8324,8324,8324,8324,8324,8324,6275,4163,4163,4163,4162,4162,4162,4162,4162,4162,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,6244,6276,4195,4163,4195,4163,4195,4195,4195,4195,4195,4195,4196,4196,4196,4228,2147,8583,15052,15052,15084,15116,17261,21550,21550,21550,21550,21550,21582,25711,25712,17196,10793,4423,4358,4358,4358,4358,4326,4326,4326,4326,4326,4326,4326,4326,6438,10761,10793,10793,10793,17228,21550,21550,19502,19502,21582,21550,21550,21550,19502,21550,21550,21550,23630,23631,27792,27792,25711,25743,25711,25711,23566,8485,4194,4195,6275,6275,6275,6275,6275,6275,6275,6275,6275,6275,6373,6405,6406,6406,6374,6374,6374,6341,6341,6308,6308,6308,6308,10502,10535,8422,8422,8356,6244,8389,10502,10470,10437,10437,10438,12486,12486,12486,14598,18792,18792,18792,18792,20840,20872,20873,22921,16614,12420,20808,24969,24969,24969,24969,24969,24969,24969,27114,33517,33485,35468,35435,37547,37580,37612,37612,39660,39628,37740,42092,44204,44204,44204,44204,44204,44204,44204,44204,44204,44203,44204,42124,39270,39044,39142,39530,37644,37612,37612,37644,39693,37677,35597,35629,35694,35693,35693,35694,35662,33613,33646,35726,33678,33646,33646,33646,33646,33645,33645,33613,33613,33613,33613,33613,33613,33581,31533,31533,31533,31500,31533,33613,31500,31500,31468,29388,29420,31468,29388,29388,29388,29388,27275,27276,29356,29356,27308,27308,27275,25227,27308,27308,25227,25227,25227,25259,25292},
-	{32,4162,4162,4195,4227,4195,2115,2147,2147,2147,2147,2147,2115,4195,4260,4228,4228,2148,2148,4228,2180,4196,2147,2115,4163,4163,4163,4163,4163,4163,4163,4163,4196,4293,4293,4293,4293,6374,4326,4293,4293,4293,4293,4293,4293,4261,4293,4261,4261,2180,4228,8324,10404,10404,10437,10437,8324,10404,10437,12485,12485,10405,10437,10437,10437,8356,8324,10437,10437,10437,10436,10436,10436,10437,8324,4163,4163,4163,6243,6210,4162,4162,4162,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,6244,6276,4195,4195,4163,4195,4195,4195,4195,4195,4195,4195,4195,4196,4196,2147,8583,15052,15052,15084,15116,17261,21550,21550,21550,21550,23663,21486,10825,12842,8584,4358,4359,4359,4359,4359,4358,4358,4358,4358,4358,4358,4358,4326,4326,6374,4326,4294,4294,4294,8583,17260,21550,19502,19470,21518,21582,21550,21550,21550,21550,21550,21550,21550,21550,23631,25679,25711,25679,23631,23630,21550,14985,6340,6275,4259,6307,6307,6307,6307,6307,6307,4227,6275,6275,6308,8518,19212,14921,6374,6374,6374,8454,6341,4228,4195,4195,6243,6276,10502,10535,8422,6276,6244,8357,10438,10438,10437,10437,10438,12486,12486,12486,14566,16744,18792,18792,18792,20840,20873,20873,22921,16614,12420,20808,24969,24969,24969,24969,24969,24969,24969,27114,33517,33517,35500,37548,37548,37580,37612,37612,39660,37548,35467,37675,42124,44204,44204,44204,44204,44204,44204,44204,44204,44204,44204,42060,39238,39141,39498,39660,37612,37612,37612,37644,39725,37709,37709,35662,35694,35694,35694,35694,35694,35694,35694,35726,33678,33646,33646,33646,33646,33645,33646,33645,33613,33613,33613,33613,33613,31533,31533,31533,31533,31500,31500,31533,31533,31500,31468,29420,29388,29356,29356,29356,29388,29388,27308,27243,27276,29356,27275,27275,25227,25227,25227,25259,25260,25227,23147,25227,23179},
-	{2081,6243,4195,2115,2147,4228,2147,4163,4163,2115,2147,2115,2115,4195,4228,4228,4228,2148,2148,4228,4228,2180,2147,4163,4163,4163,4163,4195,4195,4163,4163,4163,4195,4293,4293,4293,4293,6373,6406,6342,4293,4293,4293,4261,4293,4260,4293,4260,4261,4228,8356,12517,12517,12485,12485,12485,10404,10405,10437,10437,10404,10404,10404,12484,12485,10436,10437,10436,10437,12485,12485,10436,10436,12516,12485,8324,4163,4162,4162,4162,4162,4162,4162,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4195,6276,6276,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4196,4196,2147,10664,19245,19245,19277,19277,21422,25711,25711,25711,25711,21486,10729,4359,4359,4358,4358,4358,4358,4358,4358,4358,4358,4358,4358,4326,4326,4326,4326,4326,6374,6374,6374,6374,6374,6374,8583,19341,19502,19470,21518,21550,21582,21550,21550,21550,21550,21550,21550,21550,21550,21550,23631,23631,21550,21550,23598,19309,15019,14987,14986,14986,14986,14986,14986,14954,10697,6438,6439,6439,6439,6503,10761,8649,6471,6471,6471,6471,6439,6438,6341,6243,6243,6244,8389,10502,10502,6308,8356,8389,10437,10437,10470,12551,10438,10438,12486,12486,14566,16744,18792,18792,18792,20840,20873,20873,22921,16614,12420,20808,22921,24969,24969,24969,24969,24969,25033,31404,33517,33549,33485,35500,37516,37580,37580,37580,37580,37580,37547,37579,39819,44140,44204,44204,44204,44204,44204,44204,44204,44204,42092,39495,37126,39466,39660,37612,37612,39660,39660,37644,37677,37709,35662,35694,35726,35726,33614,33614,35694,35726,35726,35726,33646,33646,33646,33646,33645,33645,33645,33645,33613,33613,33613,33613,33581,31533,31533,31533,31500,31500,31500,31500,31533,31501,29356,29388,29356,27275,27275,27275,27275,27275,27275,27275,27275,27276,27308,25227,25195,25227,25227,25195,25227,23147,23147,23147,23147},
-	{2114,4163,4163,2115,2114,4195,4227,4195,4163,2115,2115,2115,2115,4195,2148,4228,4228,2148,2148,4260,4228,2180,2147,4163,4163,4163,4163,4195,4195,4195,4163,4163,4163,4228,4293,4293,4293,4293,4325,6374,4293,4293,4260,4228,4293,4260,4293,4260,4261,4228,4228,8324,12485,12517,12517,12485,12485,12485,12485,10404,8324,8356,10404,12485,12485,12485,12485,8323,8323,12517,12517,12517,8356,6242,12485,10437,8324,4163,4162,2114,4130,4130,4162,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4195,6276,4228,4163,4195,4195,4195,4195,4195,4195,4195,4195,4195,2147,2147,8615,17164,17196,17196,17197,17293,21550,21550,21550,21550,17261,6471,4359,4359,4358,4358,4358,4358,4358,4358,4358,4358,4358,4358,4326,4326,4326,4326,6374,6374,6374,6374,6374,6374,6374,6406,17260,19502,19470,19470,19470,21550,21582,21550,21550,21550,21550,21550,21550,21550,21550,23598,23631,23631,23598,23630,21518,19341,19277,19277,19277,19245,19245,19277,15084,8584,6504,6504,6504,6504,6504,6472,6472,6504,6504,6504,6504,8520,8519,6374,6243,6243,6243,6244,6276,8389,6308,8357,8389,10437,10437,10438,12551,12551,10438,12486,12486,14598,16744,18792,18793,18792,18792,20841,20841,20873,16614,12420,20808,22921,24969,24969,24969,22888,25001,31404,33549,33549,33581,35629,35565,37580,37580,37580,37580,37580,37580,37580,37580,37612,37676,39852,42092,42092,42092,44140,44140,44140,44172,39592,37125,39466,39628,37612,37612,37612,39660,37612,37644,37677,37709,35629,33613,35694,35694,35662,33581,33613,35726,35726,35694,33646,33646,33646,33645,33645,33645,33613,33613,33613,33613,33613,33581,31533,31533,31533,31501,31500,31500,31500,29452,29452,31501,29388,29356,27308,27275,27275,27275,27275,27275,27243,27308,27276,25195,27276,27308,25195,25195,25195,23147,23147,25227,25260,23147,23147},
-	{2115,2115,2115,2115,2147,2147,4195,4228,4163,2115,2114,2114,4195,2147,2148,2148,2148,2148,2148,4228,4260,4260,4260,4196,4163,4163,4163,4163,4195,4195,4163,4163,4162,4162,4195,4261,4261,4260,4228,4228,4228,4228,4228,4228,4293,4260,4261,4260,4261,4261,4228,6276,8324,8356,10469,10469,10469,12485,12485,10437,10437,10437,10437,10404,12485,12517,10437,6242,6242,12485,12485,10436,4129,4129,8324,8356,4261,4260,4227,4130,4163,4163,4162,4195,4163,4162,4162,4162,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4195,4163,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,2147,2179,10728,15148,15148,15180,15181,17293,19470,19502,21518,19437,8680,4359,4359,4359,4358,4358,4358,4358,4358,4358,4358,4358,6406,4326,4326,4326,4326,4326,4326,6374,6374,6374,6374,6374,6374,6406,17260,19502,19469,19469,19469,19470,21550,21582,21550,21550,21550,21550,21550,21550,21550,21550,21550,23631,23631,23598,21582,21518,19309,17229,17229,19309,19341,23567,17132,6503,6503,6504,6504,6504,6472,6472,6472,6472,6472,6472,6472,8520,8519,6341,6243,6244,6243,6243,6243,6243,6243,8356,8389,10437,10437,10437,10438,12551,12518,10437,10437,12518,16712,16744,18792,18792,18792,18792,20841,20873,16614,12388,20808,22921,22921,24969,24969,20807,29259,33549,33549,33549,33549,33549,33516,37580,37580,37580,37580,37580,37580,37580,37580,37580,37580,37612,37644,37644,37644,37676,37644,39724,39724,39627,39563,39628,37612,37612,37612,37612,37612,37612,37645,37709,35661,33581,33581,33581,35662,33613,33581,33613,35694,35694,35694,33646,33646,33646,33645,33645,33645,33613,33613,33613,31565,31533,31533,31533,31533,31533,31500,31500,31500,31500,29420,29420,29420,29388,29388,27308,27275,27275,27243,27243,27243,27243,27275,27308,27275,25195,25195,25195,25195,23147,23147,23147,23147,25228,25228,23147},
-	{4163,4163,2114,2147,4228,4260,4260,4260,4228,4195,4195,4195,2147,2148,2148,2148,2148,2148,2148,2148,2148,2180,2180,4196,4228,4195,4163,4163,4163,4163,4162,4162,4162,4163,4195,4196,4196,4196,4228,4261,4293,4293,4228,4228,4293,4228,4228,4228,4228,4228,4228,4260,6276,6308,6308,6308,8356,10372,10372,8324,8324,8324,10372,10372,10404,10437,8324,6242,4130,10404,10437,8323,2081,4129,8324,6276,6309,4261,4261,4261,4229,4196,4163,4163,6243,4163,4162,4162,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4196,4195,4163,4195,4163,4195,4195,4195,4195,4195,4227,8679,17196,17229,17261,17261,17261,17325,19470,19470,19470,19406,6536,4358,4359,4359,4358,4358,4358,4358,4358,4358,4358,6406,6406,6374,6374,6374,6406,6374,6374,6374,6374,6374,6374,6374,6374,6406,17260,19470,19469,19469,19469,19470,19470,21550,21582,21518,21518,21518,21518,21550,21550,21550,21550,21550,23631,23631,23630,23631,23566,21389,21421,23567,25680,21324,8485,6438,6439,6471,6471,6471,6439,6439,6439,8487,8487,6407,6407,6407,8487,6341,8356,8389,8357,6243,6243,6243,6243,8356,8389,10437,10437,10437,10437,10438,10437,10405,8292,12518,16712,16744,16744,18792,18792,18792,20840,20840,16614,12388,20808,22921,22921,24969,24969,27211,31469,33517,33517,33517,33517,31469,33517,33452,35467,35500,37580,37580,37580,37580,37580,37580,37580,37580,37580,37580,37580,37580,37580,37580,39660,39660,39660,37612,37612,37612,37612,37612,37644,35564,35564,35661,35661,33581,33549,33581,35662,33646,35694,35694,35694,35694,35694,33646,33645,33645,33645,33645,33613,33613,33613,33613,33613,31533,31533,31501,31500,31501,31500,31500,31500,29452,29420,29356,27275,27275,27308,29388,29356,27275,27243,27243,27243,25195,25195,25227,27308,25227,25195,25227,25228,23147,23147,23147,23147,23147,25227,25228},
-	{4163,4195,4195,4228,4261,4261,4261,4261,4261,4261,4260,4260,4228,4228,4228,2180,2148,2148,2148,2148,2148,2148,2148,2148,4260,4261,4196,4195,4195,4195,4195,4195,4227,4260,4293,4293,4293,4293,4293,4293,4293,4325,6373,4228,4261,4228,4228,4228,4228,4228,4228,4228,4228,4260,4293,4293,8356,8324,8324,6211,6243,8291,8324,6243,8323,8324,8324,6242,2048,4162,8324,8291,2049,4129,8324,8324,8324,6308,4293,4261,4229,6277,4196,4163,4163,6243,4162,4162,4162,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4195,4195,4195,4195,4163,4195,4195,4195,4195,2147,6437,19373,19406,17293,17293,17293,17325,19437,19438,19438,19438,17163,6470,4326,4358,4358,4358,4358,4358,4358,4358,6375,4327,4327,4359,6406,6374,6375,6407,6407,6374,6374,6374,6374,6374,6374,6374,6405,17228,19469,19437,19469,19469,19469,19437,19437,19437,19470,21518,21486,21518,21518,21518,21518,21550,23599,23631,25712,25712,25712,25712,25712,25712,25712,23501,8485,6243,6275,6308,6373,6373,6373,6374,6374,6342,8421,6308,6276,6276,6276,6308,8389,8389,8389,8357,6243,6243,6211,6243,8356,10437,10437,10437,10437,10437,10437,10437,12518,10404,12518,16712,16744,16744,18792,18792,18793,20841,20872,14566,12388,20808,22921,22921,22921,24969,29291,33549,33517,33517,33517,33517,33517,33517,33517,33452,35532,37580,37547,37547,37547,37547,37547,37548,37580,37580,37580,37580,37580,37580,37580,37580,39660,39660,37580,37548,37580,37580,37612,37645,35565,33517,35661,33613,33581,33581,33581,35662,33613,35693,35694,35694,35694,33646,33646,33645,33645,33645,33645,33613,33613,33613,33581,33581,31533,31468,29420,29388,31501,29420,29420,29420,29388,29388,27276,27275,27275,27308,27308,27308,27275,25195,25195,25195,25195,25195,25195,25195,25260,25195,23115,25228,25228,23147,23147,23147,23147,23147,25228},
-	{4196,4228,4228,4260,4261,4261,4261,4261,4261,4261,4261,4260,4260,4260,4261,4260,2148,2148,2148,4196,4196,2148,2148,2148,2180,4260,4228,4261,4260,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,6373,6341,4293,4228,4228,4228,4228,4228,4228,4260,4260,4228,4293,6341,6275,8323,6243,2081,2048,4129,4162,2081,6243,8324,8324,6242,2048,4162,8324,8291,2049,4129,8324,8324,8324,6308,4293,4261,4229,6277,6277,4163,4163,4163,4163,4162,4130,4162,4163,4163,4163,4163,4163,4163,4162,4162,4163,4163,4163,4163,4163,4195,6276,4196,4195,4195,4195,4195,4195,4228,10760,19405,19437,17325,19405,19405,19405,19437,19405,21518,21518,8582,2147,4228,4293,4326,6406,4358,4358,4358,6407,6375,6374,6374,6374,6374,4293,4294,6374,6407,8455,6374,6374,6374,6374,6374,6341,6308,17196,19437,19437,19437,19437,19437,19437,19437,19437,21518,21518,19438,21486,21486,21486,21486,23599,25712,23631,23598,21518,21518,21518,21518,21518,21550,21421,8420,6242,6243,6276,6308,6308,8389,8390,6341,6341,6341,8389,8389,8389,8389,8389,8389,8389,8389,8357,6243,6211,6211,6243,8356,10437,10437,10437,10437,10437,10437,10437,8324,10437,14599,16712,16712,16712,16712,18792,18792,18792,18760,14501,12420,18760,22921,22921,20808,20775,27210,31469,33517,33517,33517,33517,31469,31469,31469,33485,33484,33419,35435,35403,35403,35371,35370,35435,37580,37580,37580,37580,37580,37547,37547,37547,37580,39660,35467,35435,35467,35468,35500,33484,33484,33517,33581,33645,33613,33613,35662,33614,33614,33613,33613,33613,33646,33646,33646,33645,33613,33614,33613,31533,31533,33581,31533,31533,31533,29420,29420,29388,31469,29356,29388,29388,27308,27276,27275,27275,27243,27276,27275,25195,25195,25195,25195,25195,25195,25195,25163,23115,25195,25228,25195,23115,25228,23147,23115,23147,23115,23115,23147},
-	{4260,4260,4229,4261,4260,4260,4261,4261,4261,4261,4260,4260,4260,4260,4261,4260,4228,2180,4228,4228,4228,4228,2148,2148,2148,4228,4228,4228,4228,4293,4260,4260,4260,4260,4260,4260,4260,4260,4293,4293,4293,4293,4261,4261,6373,4228,4228,4228,4228,4228,4228,4228,4261,4261,4260,6276,4162,6242,4162,2081,2081,2081,2081,2081,6243,8324,8324,6242,2048,2081,8291,8323,2049,4129,8323,8324,8324,4260,4293,4261,4229,6277,6277,4163,4163,4163,4130,4162,4162,4162,4163,4163,4163,4163,4163,4163,4163,4162,4162,4163,4163,4163,4163,4163,4195,6276,4196,4163,4195,4195,4195,6405,21421,21550,21550,21550,23631,23598,21518,21518,21518,23631,25711,8582,4195,4195,4195,4261,6406,6406,6374,6406,6374,4261,4261,6309,4261,4261,4196,4228,4261,6309,6341,6342,6309,6309,6309,6308,4228,4228,17195,19437,19405,19405,19437,19437,19405,19405,19405,19437,19405,21486,21486,19438,19438,19438,23599,23630,21485,21486,21518,21518,21518,21518,21518,21518,21421,8420,6242,6243,6243,6243,6243,6308,8356,8356,8389,8389,8389,8389,8389,8389,8389,8389,8389,8389,8357,6243,6211,6243,6243,8324,10437,8389,10437,10437,10437,10437,10437,8324,8324,14631,14664,14599,14566,16712,18792,18792,18792,16614,10340,12420,18760,22921,22921,18695,12388,25097,31469,33517,33517,31469,31469,31469,31469,31469,33517,33549,33485,33452,35499,35467,37515,35435,37515,37580,37580,37579,37580,37579,35467,35467,35467,37548,37580,35500,35500,35500,33452,33452,33485,33517,33549,33581,33613,33581,33549,33613,33581,33549,33549,33549,33581,33613,33613,33581,33613,33581,33613,31533,31468,31468,31533,31533,31533,31533,29452,29420,29420,29420,29388,29388,29356,27275,27275,27275,27275,27243,27243,25195,25195,25195,25195,25195,25195,25195,25163,23115,23115,23115,23147,25227,23147,23115,23115,23114,23114,23114,23115,23115},
-	{4260,4228,4229,4229,4228,4260,4261,4293,4261,4261,4261,4260,4260,4261,4261,4261,4260,4260,4261,4261,4261,4260,4228,2148,2148,2148,4196,4196,4228,4293,4261,4228,4260,4260,4260,4228,2180,4228,4261,4260,4293,4293,4260,4228,6341,6309,4228,4228,4228,2180,4228,4228,4228,6308,6276,6243,4130,4162,4195,4162,4163,4163,4162,2081,6243,8324,8324,6243,2048,2048,4129,4162,2048,2081,8323,8324,8324,6308,4293,4261,4229,4229,6277,4195,4163,4163,4130,4162,4195,4162,4162,4163,4163,4163,4163,4163,4163,4196,4196,4196,4228,4228,4228,4228,4228,4196,4196,4195,4195,4195,4163,6372,19212,21357,23437,25582,25550,25582,25679,25711,25711,25711,19211,6373,2147,4195,4195,4228,4261,4261,4261,4261,4228,4195,4195,4195,4195,4195,4195,4195,4195,4195,4163,6276,4196,4163,4195,4195,4195,4260,15115,17357,17357,17357,19405,19405,19405,19405,19405,19405,19405,19438,21486,19406,19406,19405,23598,23598,19405,21486,21486,21486,21486,21486,21486,21486,19341,8420,4194,6243,6243,6242,6242,6243,6243,6243,8324,6276,6308,6308,8389,8389,8389,8389,8357,8357,6276,6243,6211,6211,6211,8324,10437,8389,10437,10437,10437,10437,10437,8357,8357,10470,14599,12518,12486,16711,16744,18792,18792,14566,10339,10340,14533,16614,16614,14533,12387,25097,33517,31469,31469,31469,33517,31437,31468,31468,31468,31468,33549,33549,35564,35564,37612,37612,37612,37612,37580,37579,37579,37580,37580,37612,37612,37612,37612,37645,37645,35597,35564,33549,33517,33517,33549,33613,33613,33613,33581,33581,33549,33549,33549,33549,33549,33581,33549,31501,33581,31469,31501,31533,31501,31501,31533,31533,31533,31533,31501,31501,29388,29388,29388,29356,27307,27275,27308,27275,27243,27243,25195,25195,25195,27276,25195,25163,23115,23115,23115,23115,23115,23115,23114,23147,23147,23115,23114,23114,23114,23114,23114,23115},
-	{4229,4229,4228,4228,4228,4229,4261,4260,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4228,2148,2148,2148,2148,2148,4228,4260,4260,4260,4228,4228,4260,4228,2180,4228,4260,4228,4260,4260,4260,4228,4228,4260,4260,4228,4196,2180,4196,6244,6244,8291,8291,6243,4162,4162,4163,4163,4162,4163,4162,2081,8323,8323,6242,6243,0,2048,2048,0,33,4195,8356,8356,8324,6308,4261,4261,4229,6277,4229,4195,4162,4162,4162,4130,4162,4163,4162,4162,4163,4163,4195,4196,4196,6277,6309,6309,6309,6310,6310,6342,6342,4229,4195,4195,4228,4195,4195,12647,18985,18985,21098,21163,21163,21163,23340,25517,25614,25679,10696,2147,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,6244,4163,4195,4195,8583,17228,17325,17325,17325,17325,17325,17325,17325,17325,17325,19373,19373,19406,21486,21454,23567,23631,23567,19406,19406,19406,19406,19406,19406,19405,19406,19405,12873,6275,6242,6243,6243,6242,6242,6243,6243,6243,6243,6243,6243,8357,8357,8357,8357,8325,6276,6243,6211,6243,6211,6211,8324,8357,8357,8389,8389,10437,8357,8324,8324,8324,8357,12518,14631,12518,14598,16712,16744,18792,14566,10339,10339,10339,10339,10339,12388,12388,25065,27210,25065,25097,25097,25065,25066,29324,31436,31468,31436,33485,33517,33516,33516,33516,35532,37613,37644,35564,37612,37580,35499,35499,35500,35500,35500,33452,33484,33516,33549,33581,33549,33517,31469,31469,33549,33581,33549,33581,33549,31469,31469,31469,31501,33581,33613,33581,33581,33581,31469,31469,31533,31501,31501,31500,31533,31533,31501,29453,29453,29356,27276,27276,27275,27275,27275,27308,27308,25195,25195,25195,25195,25163,25227,25227,23115,23115,23115,23115,23115,23114,23114,23114,23114,23114,23147,23115,23114,23114,23114,21066,21067},
-	{4261,4229,4228,4229,4229,4229,4229,4260,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4228,2148,2148,2148,2148,2148,2148,2148,2148,4196,4196,4196,4196,4196,4196,4196,4260,4228,4260,4260,4260,4228,2180,4228,4260,4260,4196,2180,6244,8292,8292,8291,6243,6243,4195,4163,4163,4163,4162,4163,4162,4162,8323,8323,4161,6275,2114,2048,4161,4195,4227,4228,6243,8356,8324,6308,4261,4261,4229,4229,4229,4195,4162,4162,4162,4162,4130,4162,4162,4162,4163,4195,4229,6309,6277,6309,6309,6309,6309,6309,6310,6342,6342,4261,6341,14727,14792,14760,14760,18953,18985,18985,18985,18985,18985,18985,19017,23178,21195,21227,10598,2147,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4163,4195,6276,6276,8454,10696,12939,17261,17293,17293,17293,17293,17293,17293,17293,17325,17325,19406,21519,21519,23599,23566,21486,21486,19406,19373,19373,19373,19373,19373,19373,19405,19405,19406,19341,10695,6275,6243,6243,6243,6308,10664,12744,12712,10696,12712,6308,6276,6276,6276,6276,6244,4163,4195,6243,6211,6211,6212,6244,6244,8324,8357,10437,8389,8357,8356,8357,8357,8357,10437,12518,14631,12485,14631,16744,18792,14566,10339,10339,10372,14566,16614,16614,16614,20840,20840,20807,20807,20807,20775,20808,22921,25065,31404,31437,31436,31437,31436,31436,31436,31404,33484,33484,33484,33452,35499,33387,33387,31371,33452,31404,33452,31404,31436,31468,33549,33517,31437,31469,31469,31469,33549,31468,33581,31501,31469,31469,33581,33581,33581,31501,31501,33581,33581,33549,31501,31533,31469,29388,29388,31501,31501,31501,29452,29452,29356,27276,27275,27275,27243,27243,27243,27276,27276,25195,25163,25163,25163,23115,25195,25195,23114,23114,23114,23114,23114,21066,21066,21066,21066,23115,23114,23114,23147,21066,21066,21066},
-	{4261,4261,4229,4228,4228,4228,4228,4260,4260,4260,4293,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4260,4228,2148,2147,2148,2148,4196,4196,4196,2148,2148,2148,2180,2180,4228,4196,4260,4228,4260,4228,4260,4228,4228,4228,4228,4228,4196,2180,6244,6243,6211,6211,4163,4163,6244,4163,4163,4163,4163,4163,4162,6243,8323,8324,8324,8324,2147,0,2113,4228,4261,4227,4162,8323,6308,4261,4261,4261,4229,6277,4196,4162,4162,4162,4162,4162,4162,4130,4162,4162,4163,4196,6277,6277,6277,6277,6309,6309,6309,4261,4261,4262,6310,4261,8454,18985,19018,21099,19018,18985,18985,18985,18985,18985,18985,18985,18985,19018,18986,18985,10534,4195,4195,4195,4195,4195,4195,4195,4195,4195,6276,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,6340,10729,12842,12907,15019,15019,21422,21518,21519,21519,21519,21518,21518,21518,21518,21518,21486,19406,19406,19406,19406,19406,17325,17325,19373,19373,19373,19373,19373,19373,19373,19373,19406,19341,15083,12873,12841,12809,12809,12809,14955,14988,14955,14956,14923,12777,12809,15019,17131,12711,6308,6342,6342,6342,8390,8390,8390,6276,6211,6243,8357,10437,8325,6244,8324,8324,8324,8324,10437,10437,12518,12518,16711,16712,16744,14566,12453,14598,14598,16679,16679,18760,18728,18728,20776,20808,20808,20808,20807,20807,20775,20808,25033,31404,31436,31436,31436,31469,31436,31436,31436,29388,31404,31404,31404,31404,31404,31404,31436,31436,33549,35597,33581,33581,33581,33581,33517,31436,31436,31469,33581,33549,33581,33581,33581,33581,33613,33581,31468,31468,31468,31469,31469,31469,31469,31469,29388,29356,29356,29388,29388,29388,29420,29420,27308,27275,27275,27243,27243,27243,25195,25195,27275,25227,25163,25163,23115,23115,23114,23115,23082,23082,23082,23082,21034,21066,21066,21066,21066,21066,23114,23179,23147,21066,21066,21098},
-	{2115,4260,4261,4228,4228,4228,4228,4228,4228,4228,4260,4261,4228,4228,4228,2180,4260,4228,4228,4261,4261,4260,4261,4228,2148,2148,2148,2148,2148,2148,2148,2148,2148,4196,4196,2148,2180,4228,4228,4196,4260,4228,4260,4196,4228,4228,4196,4196,4196,2180,6243,6211,4163,4162,4162,4163,4163,6243,4163,4163,4163,4163,4163,6243,8324,6276,6308,6308,2147,2048,4194,4260,4261,4227,2114,6276,6308,4293,4261,4229,6244,4196,4163,4162,4162,4162,4130,4162,4162,4130,4162,4162,4163,6277,6277,6277,6277,6277,6309,6309,6309,6310,4262,4262,4294,4262,8487,18953,18953,18986,18985,19017,18985,18985,18985,18985,19018,18986,18985,18986,19018,19018,16873,6340,4195,4195,4195,4228,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4195,4228,4228,4260,10664,12874,15019,15019,15019,12939,15019,21454,23599,23599,23599,21486,17325,17293,19341,19341,19373,17293,17261,17261,17261,17261,19342,19374,17293,17293,17293,19341,17325,17293,17229,17229,17229,17261,19309,17164,17132,17132,17100,15020,15020,14987,14955,14923,14923,14891,14987,17229,21422,17132,10600,8487,8455,8455,8455,8455,8455,8455,8422,6276,6243,8357,8357,8324,6243,6243,6243,6243,8324,10437,10437,10437,10405,14631,14631,12518,14631,14631,14664,16679,16679,16679,16680,18727,18728,18760,18728,18760,18760,18728,18728,20808,18728,20840,31404,31436,31436,31404,31436,31469,31436,31404,29356,31404,31404,31404,31404,31404,31404,31404,31436,31436,31436,31468,31468,31468,31468,31436,31436,31437,33549,33581,31501,31469,31469,33549,33581,33581,31501,31437,31437,31437,29388,29388,29388,29388,29388,29356,29356,27308,27308,27308,27308,27340,29420,27307,27275,27243,25195,25195,25195,25195,25163,25163,25163,23115,23115,23083,23083,23082,23082,23115,23147,21034,21034,21034,21066,21066,21034,21034,21066,21098,23147,23179,21098,21098,21098},
-	{2114,4228,4261,4261,4228,4228,4228,2148,2147,2148,2148,4228,2148,2148,2148,2148,4228,4196,2148,4260,4260,4260,4260,4228,4195,2147,4195,4195,4195,4195,4195,4195,4163,4163,4163,4195,4195,4195,4163,4195,4260,4228,4228,4196,4228,4261,4228,2180,4196,4195,6243,4163,4162,4162,4162,4163,4163,4163,4195,4163,4163,4163,4163,6243,8324,6308,4260,4293,4228,2114,4228,4261,4261,4228,4162,6243,6308,4261,6341,4228,4163,4163,4163,4162,4162,4162,4130,4130,4162,4130,4162,4196,4228,6277,6277,6277,6277,6277,4229,6309,6309,4261,4261,4262,4262,4293,8487,16937,18985,18985,18985,21098,18986,18985,16937,16905,16905,18986,18986,18985,18986,19018,18986,8485,6308,6308,10534,12647,6308,4227,4195,4195,4195,4195,4195,4195,4195,4163,4163,6341,12777,12809,12842,12939,12971,12971,15019,15019,14987,15116,21454,21518,21486,21518,21486,19373,17260,17261,17228,17261,17261,17261,17293,17261,17261,17293,19374,19341,17261,15148,15116,17196,12939,8583,8584,8584,8616,15084,17164,17132,17164,17132,17132,17197,19277,17132,14955,14955,14955,17165,19309,19341,14987,8455,10536,8455,8455,8455,8455,8455,8455,8455,8422,6244,6244,6244,6243,6243,6243,6243,6243,8324,10437,10437,10437,8324,14631,14631,8292,12485,14631,14631,14631,16679,16679,16679,16679,18759,20872,18760,18728,18760,18728,18728,18728,18728,20840,29356,31436,31436,29356,29356,31436,31469,29356,29356,29356,29356,29356,29356,31404,31404,31404,31404,29356,29356,29356,31404,31404,31404,31436,31436,31436,31436,31469,31469,31436,31436,31501,33581,31533,31501,31436,29388,29388,29388,29388,29388,29356,29356,29356,27308,27308,27308,27276,27276,27340,27340,27275,27243,25195,25195,25195,25163,25163,23115,23114,23114,25195,25195,23082,23082,23082,21034,23082,23147,23115,21034,21034,21034,21066,21034,21066,21066,21066,21066,23147,23179,21098,21098},
-	{2115,4228,4228,4261,4260,2148,2147,2147,2147,2147,2147,2147,2147,4228,4196,2148,2115,2147,2147,4228,4260,4260,4196,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,2180,2148,4228,4196,4196,4228,4228,4196,4195,4195,4163,4163,4163,4162,4162,4163,4163,4163,4163,4195,4163,4163,4163,6243,6243,4260,4293,4228,4163,4162,4228,4261,4228,4163,4162,6243,4260,4260,4195,4195,4162,4162,4162,4162,4162,4162,4162,4130,4130,4162,4162,4196,6277,6277,6277,6277,6277,4229,4229,6277,4261,4261,4261,4262,4262,4293,8455,14793,16905,18985,18985,18986,21098,18985,12680,6406,8454,14793,18986,18986,18986,19018,18986,18953,16905,16905,18985,18986,18953,8421,4163,4195,4195,4195,4228,6276,4195,6308,8388,10502,16906,18986,17003,15019,15051,15051,15051,15051,17164,17229,17261,17260,17228,17196,19341,21454,21486,21454,17293,19374,21422,21454,21454,21454,21454,21454,21454,17229,15051,10696,8519,8519,6471,6407,6407,6407,6407,8519,8520,8520,8519,8519,8552,15019,17132,17164,17197,17197,17197,17229,17261,17261,14986,6375,8423,10536,8455,8423,8423,8423,8455,8455,8423,6277,6244,6276,6244,6243,6243,6243,6243,8324,10437,10437,10437,8324,14631,14631,8291,10405,14631,14631,14631,14631,14631,16679,16679,16711,16711,16679,18727,18727,18727,18727,18727,18727,20840,29356,29388,29356,29356,29356,29356,29356,29356,29356,29356,29356,29356,29356,29356,29356,29356,29356,29356,29356,29356,29356,29356,29356,29356,29356,29356,29356,31436,31469,31468,29420,31501,31533,31533,31501,29388,29388,29356,29356,29356,29356,27308,27308,27308,27308,27308,27276,27275,27275,27308,27308,27275,25195,25195,25163,25163,25163,23114,23114,23082,23082,23082,25195,23115,23082,21034,21034,21002,21034,23147,21067,21034,21034,21034,21034,21034,18986,21066,21034,21034,21066,21066,21066},
-	{4228,4228,4228,4228,4228,4228,2147,2147,2147,2147,2115,2115,2115,4196,4228,4196,2147,2147,2115,4196,4228,4228,4163,4162,4162,4162,4162,4162,4162,4162,4162,4162,4163,4163,4162,4162,4162,4162,4163,4163,4196,4196,4196,4196,4196,4163,4163,4195,4195,4195,4163,4163,4162,4162,4162,4163,4163,4163,4163,4163,4195,4163,4162,6243,6243,4260,4260,4227,4162,4162,4228,4260,4228,4162,2114,4195,4228,4228,4163,4162,4163,4162,4162,4162,4162,4162,4130,4130,4130,4162,4162,4228,4229,6277,6277,6277,6277,4229,4229,4229,4229,4261,4261,4262,4261,4261,4294,6341,12680,18985,18985,16905,16873,14792,6406,4326,4326,6406,14792,18986,19018,19018,18986,19018,19018,19017,19018,19018,19018,12614,8388,8421,8421,8421,8421,10502,10502,16873,19018,18986,16873,19018,21163,21195,23276,23340,21325,19277,19309,19341,19406,19373,17261,15084,15116,15116,19341,19373,19341,15148,15116,17164,17164,17164,17164,15148,17196,10793,8551,8519,6407,6406,6407,6407,6406,6406,6407,6407,6407,6406,6375,6375,6375,8487,6439,10696,17196,17196,17196,17196,17197,17228,14987,8584,8487,8423,8423,8423,8423,8423,8423,8455,8455,8423,8423,8422,8357,8357,6244,6211,6243,8324,10437,10437,10437,8324,14631,12518,8292,10437,12583,12583,14631,14631,14631,14631,16679,16679,16679,16679,16711,18760,18727,18727,18727,18727,18759,25130,27243,29356,29356,29356,29356,29356,29356,29356,29356,29356,29356,29356,29356,29356,29356,29356,29356,29356,29356,29356,29324,27243,27243,27243,27243,27243,27243,27275,29356,29356,29356,29356,29356,29356,29356,29356,29356,29356,29356,27308,27308,27308,27308,27276,27276,27275,27275,27308,27276,25195,25195,25195,25162,25163,23115,23114,23082,23082,23082,23082,23082,21034,23115,23082,21002,21002,21002,21002,21034,23115,21066,21002,21002,21002,18986,18986,21066,21034,21034,21034,21066,21066},
-	{4228,4228,4228,4228,4228,4228,2147,2147,2147,2115,2115,2115,2115,2115,4196,4196,4163,4163,4195,4195,4195,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4163,4162,4163,4196,2148,2148,2148,4163,4163,6277,4229,6276,4195,4162,4162,4162,4162,4163,4163,4163,4162,4162,4163,4195,4162,6243,6276,4260,4228,4163,4162,4162,6276,6308,4196,4162,4162,4195,4195,4162,4162,4162,4163,4195,4162,4162,4162,4162,4162,4130,4130,4129,4162,4195,4196,4196,4196,4196,4196,4196,4229,4229,6277,4229,4261,4261,4261,4261,4261,4229,10599,18985,16905,12712,6374,6374,6407,4326,4326,4326,6406,14793,21066,21098,18985,18986,18986,19017,19017,19018,19018,19018,19018,19018,19018,19018,19018,19018,21099,21098,21066,21066,21066,21098,19018,19018,23211,23275,23275,23308,21292,19244,21389,17228,15148,15148,17197,17197,17196,17196,15148,15084,15083,15083,15083,15052,15084,15084,15084,10729,6406,8519,8487,6407,6407,6407,6407,6407,6407,6407,6407,6407,6374,6375,6375,6374,6374,10632,17164,17164,17164,17164,17164,17164,17196,17100,10600,8423,8423,8423,8455,8423,8423,8455,8455,8455,8455,8422,8357,8357,6244,6211,6211,6243,8324,8357,8357,8292,10437,8324,10437,12583,12583,12583,12583,14631,14631,14631,14631,16679,16679,16679,16712,18792,18760,16679,18727,16614,16614,16614,20872,29356,27243,27211,27211,27211,27211,27211,27211,27211,27211,29356,29356,29356,29356,29356,29356,29356,29356,29356,25131,20840,20808,20840,20840,20840,20840,20840,20840,20840,20840,20840,20840,23018,29356,27308,27308,27308,27308,27308,27308,27276,27276,27275,27275,27275,27275,25195,25195,25195,23147,23115,23114,23114,23082,23082,23082,23082,23082,21002,21002,21002,21002,21002,21002,21002,21002,21002,21002,21034,23115,21034,18954,18954,18954,18986,21034,18986,19018,19018,19018,19018},
-	{4228,4228,4228,4228,4228,4228,2148,2115,2147,2115,4162,4162,4162,4162,4163,4163,4163,4163,4163,4163,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4163,4163,4163,4162,4163,4196,2148,2148,4195,4163,4196,6277,6277,6277,4196,4196,4196,4196,4196,4196,4196,4195,4163,4163,4162,4163,4163,6243,6276,4261,4228,2115,4162,4162,4162,4195,4163,4162,4162,2114,4162,4162,4162,4162,4162,4163,4195,4162,4162,4162,4162,4161,4162,4161,4161,4162,4163,4163,4162,4162,4162,4163,4229,4229,6277,4229,4261,4261,4261,4261,4228,2115,10566,18953,12712,6374,4294,4294,6374,6407,4326,4326,4326,6438,12712,16873,18985,18985,18986,18985,18985,19018,19018,19018,19018,19018,19018,19018,21066,21066,21066,21098,21098,21098,21098,21098,21098,21066,19018,19018,19018,23211,25324,23308,25421,23437,23438,21390,19374,19342,17229,17229,17261,15148,15116,17164,15051,12971,12971,12971,15084,10761,6406,8455,8487,8487,6407,6407,6407,6407,6407,6407,8455,6375,6374,6374,6374,6341,6374,8520,12842,12842,12842,15019,15084,17196,19309,14954,6374,8423,8423,8423,10536,8455,8423,8423,8423,8455,8455,8422,8389,8357,6244,6211,6243,6243,6243,6243,6243,6243,6243,8324,12551,12583,12583,12583,12583,12583,14631,14631,14631,14631,14631,16679,16679,16712,18792,16712,16679,16614,16582,14533,20872,27243,22953,20808,20840,18792,18760,18760,20808,18760,20840,25066,25130,25130,25130,27243,29356,29356,29356,27275,22985,18760,20808,18760,20808,18760,18760,18760,18760,18760,18760,18760,18760,20873,25195,27308,27308,27276,27244,23050,23050,23050,23050,23050,23050,20970,20970,23082,25195,25227,25227,23114,23114,23082,23082,23082,23082,21034,21002,21002,21002,21002,21002,21002,21002,21002,18954,18954,18954,18954,21002,21067,21034,18954,18954,18986,21034,18986,18986,18986,18986,19018},
-	{4228,4228,4228,4228,4228,4228,4196,2115,2115,2114,2114,4162,4162,4162,4162,4162,4162,4195,4163,4164,4164,4164,4164,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4163,4162,4162,4162,4163,4162,4163,4196,2148,2148,4163,4163,6276,6277,4229,6277,6277,6277,4229,4229,4229,6277,6277,6277,4196,4163,4162,4163,4162,6243,6243,4196,4195,4162,4162,4162,4162,4163,4163,4163,4162,4162,4162,4162,4162,4162,4162,4162,4163,4195,4162,4162,4161,4161,4130,4161,4161,4162,4162,4162,4162,4162,4162,4163,4228,4229,6277,4229,4261,4261,4261,4228,2115,2115,6372,14792,8455,4293,4294,4294,4294,6374,6407,4326,4326,4326,4326,8487,16873,21098,18986,18985,18985,18985,19017,19018,19018,19018,19018,19018,19018,19018,21066,21098,23179,21131,21098,21066,21098,21098,21066,21066,21066,21098,21098,21098,23243,23276,23276,23276,19180,19212,19180,17164,17293,17293,19309,19309,17196,15084,15116,17164,17229,14987,8519,6374,6407,8487,8487,6406,6375,6375,6374,6341,6341,6309,6341,6374,6374,6309,6342,6374,6374,6374,6374,8551,12808,23405,23470,14922,8390,8423,8423,8422,8455,10536,8455,8423,8423,8390,8390,8390,8357,8324,6243,6211,6211,6211,6211,6211,6243,6243,6243,8324,12551,12583,12583,12583,12583,12583,12583,14631,14631,14631,14631,14631,14631,14631,16712,16712,16679,14566,14534,14534,20872,23050,18760,20808,18760,18760,18760,18760,18760,18760,18760,18760,18760,18760,18760,20905,27243,27276,27307,25130,18760,18760,18760,18760,18760,18760,18760,18760,18760,18760,18760,18760,18760,18760,23017,27276,27275,25196,20938,16712,16712,16712,16679,16680,16680,14631,14631,16744,20970,20970,20970,21002,23083,23082,21034,21034,21034,21002,21002,21002,21002,21002,21002,21002,18954,18953,18921,18954,18954,18922,18921,18954,21067,18986,18954,18986,18954,18954,18986,18986,18986,18986},
-	{4228,4228,4228,4228,4228,4228,2147,4162,4162,2114,2114,2114,2114,4162,4162,4162,4163,4196,6277,4229,4197,4197,4197,6277,4229,4229,4229,4229,4229,4229,4229,6277,6277,6277,4229,4196,4196,4196,4196,4196,4163,4195,4195,4195,4163,4163,6277,6277,6277,6277,4229,4229,4229,4229,4229,4229,4229,4229,4229,4196,4195,4163,4162,4162,4162,4163,4163,4162,4162,4162,4162,4162,4162,4195,4163,4162,4162,4162,4162,4162,4162,4162,4162,4163,4195,4162,2114,4161,4161,4130,2114,4162,4162,4162,4162,4162,4162,4163,4195,4196,4196,4196,4196,4196,4196,4163,4163,4163,2115,6341,6342,4293,4294,4294,4294,4294,6374,6407,4326,4326,4326,4326,8519,16938,21098,18986,18985,18985,18985,19018,19018,19018,19018,19018,19018,19018,19018,21066,21098,23179,21131,21098,21098,21098,21098,21098,21098,21098,21098,21098,21066,21098,21098,21066,21098,21098,21163,19147,19148,17164,17229,17229,17229,17261,17164,10728,10695,10631,8454,6406,6406,6407,8487,8455,6375,6375,6374,6309,6309,6309,6341,6374,6374,6374,6374,6374,8391,8390,8390,6243,6275,18984,27501,19018,8390,8422,8422,8422,10535,16874,16874,10535,8357,8357,8357,8357,8357,6244,6211,8324,6243,6243,6243,6211,6243,6243,6243,6276,10503,10503,12583,12583,12583,12583,12550,10470,12583,12583,14631,14631,14631,14631,14631,14631,16712,14566,14534,14534,16646,18792,18760,18760,18760,18760,18760,18760,18760,18760,18760,18760,18760,18760,18760,18760,20937,27243,27275,25130,18760,18760,18760,18760,18728,18760,18760,18760,18760,16712,16712,16712,16712,16712,20970,27275,25227,25163,16712,16680,16680,16680,16680,14632,14631,14631,14631,14599,14599,14599,12551,16712,20970,21034,21002,21002,21002,21002,21002,21002,21002,21001,18921,18921,18921,18921,18921,18921,18922,18921,18921,18921,18954,21034,18954,18954,18953,18921,18953,18954,18954,18954},
-	{4196,4228,2148,2148,2147,2147,2115,4162,4162,4162,4162,2114,4162,4162,4163,4196,4196,4197,6277,4229,4229,4229,4229,4229,4197,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4196,4163,4163,4163,4162,4163,6277,6277,6277,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4196,4163,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4195,4163,4162,4162,4162,4162,4162,4162,4162,4162,4163,4163,2114,2113,2081,2082,2114,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4163,4163,4195,4228,4228,4228,4261,4293,4294,4294,4294,4294,4294,4326,4326,4326,4326,4326,4326,10567,18986,21098,18985,18985,18985,18986,19018,19018,19018,19018,19018,19018,19018,19018,19018,21098,23179,21098,21066,21066,21098,21098,21098,21098,21066,21098,21098,21098,21098,21098,21098,21098,21098,21098,21098,19082,19115,19115,19115,19083,10598,6242,6210,4162,6341,6374,6374,6374,6407,8487,8455,6375,6375,6374,6374,6374,8455,8423,6342,6342,6342,6342,6277,6276,6276,6242,6210,10468,25291,16841,8357,8357,8357,8357,10470,14695,14695,12551,8357,8325,8357,8357,8357,6244,6211,6244,6243,6243,6243,6211,6211,6211,6243,8389,10503,10503,10535,10503,8390,10503,10503,10470,12583,12583,12583,14631,14631,14631,14631,14631,12550,14599,14566,14534,12485,14566,16712,16712,16712,18760,18760,18760,16712,16712,16712,16712,16712,16712,16712,16712,16744,25163,27276,23083,16712,16712,16712,16680,16680,16680,16680,16680,16712,16712,16712,16712,16712,16679,18824,18889,23114,25163,16712,16680,14632,14632,14632,14631,14631,14631,14599,12551,14599,12551,12551,12551,14664,18857,21002,21002,21002,18954,18954,18954,18921,18953,18953,18921,18921,18953,18954,18954,18922,18921,18921,18921,18921,18954,18954,18922,18922,18921,18921,18922,18922,18953},
-	{2147,4196,4196,2115,2115,2115,2115,4162,4162,4162,4162,4162,4162,4163,4196,4196,4197,4197,4196,4229,6277,4197,4197,4229,4197,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,6277,4196,4163,4162,4162,4162,4163,6245,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4196,4163,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4195,4163,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,2082,2082,2082,2082,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4163,4163,4163,4228,4261,4261,4262,4262,4293,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,6342,10567,18985,18985,18985,18986,18986,18986,19018,19018,19018,19018,19018,19018,19018,19018,19018,21098,23179,21098,21066,21066,21066,21098,21098,21066,21098,21098,21098,21098,21098,21098,21098,21098,21098,21098,21098,21066,21098,21098,18985,8323,6210,6210,6210,6276,6374,6374,6374,6374,8422,8455,8423,6374,6374,6342,6342,8422,8455,6342,6309,6309,6277,6244,6210,6210,6210,6210,10468,23146,14728,8324,8324,8324,8324,8325,8324,8325,8357,10438,8357,8325,8357,8357,6244,6211,6211,6211,6243,6243,6211,6211,6211,6244,10470,10503,10503,10503,10503,10470,10503,12551,12583,12551,12551,12551,12583,12583,12583,14599,14599,12486,14566,16647,14534,12485,14599,16712,16712,16712,16712,16712,16712,16712,16712,16712,16712,16712,16712,16712,16711,16712,25162,25195,18825,16680,16680,16680,16680,16680,16680,16680,16680,16680,16680,16680,16679,16679,16679,16679,14631,14630,20969,16712,14631,14631,14631,14631,14599,14599,14599,12551,12551,12551,12551,12551,12551,12519,16776,21034,21002,18921,18922,18922,18954,18954,18953,18921,18921,18921,18953,18921,18921,18921,18921,18921,18921,18921,16873,18921,18921,18921,18921,18921,18921,18921,18921},
-	{2115,2147,4196,4195,2115,2115,2115,4162,4162,4162,4162,4163,4164,4196,4196,4196,4197,4197,4196,4197,6277,4197,4197,4197,4229,4197,4197,4197,4197,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4196,4162,4162,4162,4163,4163,6245,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,6309,4229,4196,4163,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,2082,4162,4162,2082,2082,2081,4162,4162,4162,4162,4162,4162,4162,4162,4162,4163,4163,4163,4163,4163,4228,4229,4261,4262,4262,4261,4261,4294,4294,4294,4293,4294,4294,4294,4294,4294,4294,4294,4294,6341,10567,18985,21098,18986,18985,18986,18985,18985,19017,19018,19018,19018,19018,19018,19018,19018,21098,23179,21098,21066,21066,21066,21098,21066,21066,21066,21066,21066,21066,21066,21066,21066,21098,21098,21098,21066,21098,21098,18985,8323,6210,6210,6210,6276,6309,6309,6309,6309,6309,8357,6309,6309,6309,6309,6309,6277,8357,8389,6277,6276,6276,8324,6276,6276,6244,6244,10502,21098,21066,12582,8324,8325,8325,8325,8357,8357,8357,8357,10438,8357,8325,8357,6244,6211,6211,6211,6243,8324,6243,6211,6243,6243,6276,6276,8324,8324,8324,8324,8324,8357,10438,10438,12518,10470,12551,12551,12518,12486,12518,12486,12485,14566,14599,12485,14599,16712,16712,16712,16712,16712,16712,16712,16712,16712,16712,16712,16712,14599,12518,14598,23082,23082,16712,16680,16680,16680,16679,16679,16680,16679,16679,16679,16679,16679,16679,14631,14632,14632,14631,8324,10437,14599,14631,14631,14599,12551,12551,12551,12551,12551,12551,12551,12551,12551,10471,10471,14696,21067,21002,18921,18921,18921,18921,18953,18921,18921,18921,18921,18953,18921,18921,16873,16841,16841,16841,16841,16841,16873,18921,18954,18921,16873,18921,18921,18921},
-	{4162,4162,4162,4163,4162,2114,2114,4162,4162,4162,4162,4163,4196,4197,4196,4196,4196,4196,4197,4197,4196,6277,6277,4229,4229,4197,4197,4229,4197,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4228,4163,4163,4162,4163,4162,4163,6245,6277,4229,4229,4229,4229,4229,4229,4229,4196,4196,4196,6277,6309,4196,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4195,4162,4162,4162,4162,4162,4162,4162,2082,2082,4162,4162,2082,2082,4162,4162,4162,4162,4162,4162,4162,4162,4162,4163,4196,4228,4228,4229,4229,4229,4261,4261,4261,4261,4261,4261,4293,4293,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,4294,10599,19018,21098,18985,18985,18985,18985,18985,18985,19018,19018,19018,19018,19018,19018,19018,21066,21131,21098,19018,19018,19018,19018,21066,21066,21066,21066,21066,21066,21066,21098,21098,21098,21098,21066,21098,21098,18985,8323,6210,6210,6210,6276,6276,6276,6276,6276,6276,6276,6276,6276,6276,6276,6276,6276,6276,8325,8324,6276,6276,6276,8324,8324,8324,8293,10502,21099,21130,12615,6276,8325,8357,8390,8390,8390,8390,8357,8357,10438,8357,8357,6276,6243,6243,6243,6276,8356,8356,6276,6243,6211,6211,6211,6243,6243,6211,6211,6211,6243,6244,8357,10470,10437,12486,12486,10437,12485,12485,12485,12485,12485,14566,14599,14599,16712,16712,16712,16712,16712,16712,16712,16712,16712,16712,16712,16680,14631,14631,14663,18889,12550,14631,14632,14632,14632,14632,14632,14631,14631,14631,14632,14631,14631,14631,14631,14631,14631,14631,8324,8291,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12551,12519,10470,8357,8357,12583,18954,21034,18954,18921,18953,16873,18921,18921,16873,16873,16905,16905,16873,16873,16841,16841,16841,16841,16841,16841,16841,16841,18922,18954,18921,16841,16873,16873},
-	{2114,2114,2114,4162,4162,4162,2114,2114,2114,2114,2114,4163,4196,4197,4197,4197,4197,4197,4196,4196,4196,4197,6277,6277,4229,4229,4229,4197,4229,4197,4197,4197,4197,4229,4229,4229,4229,4229,4229,4229,4197,4196,4163,4162,4162,4163,6244,4196,4228,4197,4197,4196,4196,4196,4163,4163,4163,4163,4163,4163,6244,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,2082,2082,2082,2082,2082,2082,2082,4162,4162,4162,4162,4162,4162,4162,4162,4162,4195,4229,4229,4229,4229,4229,4229,4229,4261,4261,4261,4261,4261,4261,4261,4293,4293,4293,4293,4293,4294,4294,4294,4294,4294,4294,6342,12615,19018,21066,18985,18985,18985,18985,19017,18986,18986,19018,19018,19018,19018,19018,19018,21098,21131,21066,19018,19018,19018,19018,19018,19018,21066,21066,21066,21066,21066,21066,21066,21066,21066,21066,21098,18985,8388,6210,6210,6210,6243,6276,6276,6276,6276,6276,6276,6276,6276,6276,6276,6276,6276,6276,6276,8325,8389,8324,6276,6276,8357,8389,8389,12614,21098,21098,12582,6277,8358,8390,6342,8422,8422,8423,8390,8357,8389,10438,8357,10438,10502,10502,10502,10502,10503,12616,12583,10502,8324,6244,6276,6276,6243,6211,6211,6243,6243,6243,6244,8357,10437,10437,10437,10437,10437,10437,10437,10437,10437,12486,12550,16712,16712,14664,14664,14664,14664,14664,14664,14664,14664,14664,14632,14632,14632,14664,14631,10405,8291,10405,14631,14599,14599,14599,14631,14631,14631,14631,14631,14631,14631,14631,14631,14631,14631,12551,8324,6243,12551,12551,12551,12551,12551,12551,12551,12519,12519,12519,10471,10471,10470,10438,10438,14664,18921,18921,21034,18954,18953,18953,18921,18921,18921,18921,16905,16873,16873,16873,16841,16841,16841,16841,16841,16841,16841,16841,16841,18921,18954,16841,16841,16841},
-	{4228,4228,4228,4228,4228,4260,4195,2114,2114,2114,2114,4163,4196,4197,4197,4197,4197,4197,4196,4196,4196,4196,4197,6277,6277,4197,4229,4229,4229,4229,4197,4197,4197,4229,4229,4229,4229,4229,4229,4229,4229,4229,4195,4162,4162,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,6244,6277,4196,4196,4196,4196,4196,4196,4196,4196,4196,4163,4163,4162,4162,4162,4162,4162,4163,4195,4163,4162,2082,2113,2113,2082,2082,2082,2082,2082,4130,4162,4162,4162,4162,4162,4162,4162,4162,4162,4195,4229,4229,4229,4229,4229,4229,4229,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4293,4293,4294,4294,4294,4294,4293,4294,4294,4228,12647,21098,19018,16873,16873,16873,16873,18953,19018,19018,19018,19018,19018,19018,19018,19018,19018,19018,19018,19018,19018,19018,19018,19018,19018,19018,19018,19018,19018,21066,19018,19018,21066,21066,21066,19018,16872,8355,6210,6210,6210,6243,6276,6276,6276,6276,6276,6276,6276,6276,6276,6276,6276,6276,6276,6276,8325,8357,8325,6277,12647,18986,21066,21066,21066,12647,8324,6277,8390,8390,6342,8390,8422,6375,8390,8325,8324,8357,10471,12551,12551,12551,12551,12551,12583,12584,12584,12584,12583,12583,12583,12583,10437,6244,6211,6211,6243,6244,6244,8357,10437,10437,10437,10437,10437,10437,10437,10437,10437,10437,10437,14631,16745,14664,14664,14664,14664,14664,14664,14664,14632,14632,14632,14632,14632,14632,12551,8292,8291,10405,10438,8325,10405,10406,12551,14631,14631,14631,12551,12551,12583,12583,12583,12583,12551,10438,6243,6243,12550,12551,12551,12551,12551,12519,12519,10471,10471,10471,10471,10471,10470,10470,10470,14664,18921,18889,18922,21034,18985,16873,16841,16840,16873,16873,16873,16873,16873,16873,16841,16809,16809,16809,16841,16841,16841,16841,16841,16841,16841,16841,16841,16841},
-	{4228,4228,4228,2180,4228,4228,4260,4195,4162,4162,2114,4163,4196,4196,4196,4196,4197,4197,4196,4196,4196,4197,4197,4197,4197,4197,4197,4229,4229,4229,4229,4229,4197,4197,4197,4197,4229,4229,4229,4229,4229,4229,4196,4162,4162,4163,4163,4163,4196,4228,4228,4195,4163,4196,4228,4228,4196,4196,4196,6244,4196,4197,4229,4229,4229,4229,4197,4197,4197,4197,4196,4196,4163,4163,4163,4196,4163,4162,4162,4162,4163,4162,4130,2081,2113,2081,2082,2082,2082,2082,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4195,4229,4229,4229,4229,4229,4229,4229,4229,4229,4261,4261,4261,4261,4261,4261,4261,4261,4293,4293,4261,4293,4261,4293,4293,4261,4262,4228,10502,14760,16873,8454,6341,6341,6341,12647,16841,14792,14792,16840,14792,16905,19018,19018,19018,19018,19018,19018,19018,19018,19018,19018,19018,19018,21066,21066,19018,19018,19018,19018,21066,21066,19018,19018,21066,16840,10468,10468,10468,10469,10469,6276,6244,6244,6244,6244,6276,6244,6244,6244,6244,6244,6244,6244,6244,8357,8390,8390,8422,14792,21098,21066,12647,6276,8324,6276,6277,8390,8390,8390,8422,6374,6341,6243,6211,4163,8389,12616,12551,12551,12551,12551,12583,12583,12583,14696,14664,12584,12584,12584,12583,10437,6243,6211,6243,8324,8324,10437,10437,10437,10437,10437,10437,10437,10437,10437,10437,10437,10437,12551,16777,16745,14664,14664,14664,14664,14664,14632,14632,14632,14632,14632,14632,14632,10470,8291,8291,10405,10405,10405,10405,8324,12518,12551,12551,12550,8357,10437,12550,12550,12551,12551,10438,8357,6243,6243,10470,12551,12519,12551,10471,10471,10471,10471,10471,10471,10471,10471,10470,10470,10438,12583,16841,16841,16841,16873,18986,18953,16841,16841,16873,16873,16873,16873,16872,16873,16841,16809,16809,16841,16841,16841,16841,16841,16841,16841,16841,18921,18954,16841},
-	{4228,4228,4228,4228,4228,4228,4228,4228,4162,4162,2114,2114,4196,4196,4196,4196,4197,4197,4197,4196,4197,4197,4197,4196,4197,4197,4197,4229,4229,4229,4229,4229,4197,4197,4197,4197,4229,4229,4229,4229,4229,4229,4196,4162,4162,4196,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4197,4197,4197,6277,6277,4197,4196,4197,4197,4197,4197,4197,4196,4197,4196,4163,4196,4195,4162,4162,4162,4163,4162,2082,2081,2081,2081,2081,2081,2081,2081,2082,4162,4163,4162,4162,4162,4162,4162,4162,4162,4195,4228,4229,4229,4229,4228,4229,4229,4229,4229,4229,4229,4261,4261,4261,4261,4261,4261,4261,4261,4229,4261,4261,4261,4261,4261,4261,4261,6309,6309,6310,6342,6342,6310,6309,6310,6310,6310,6310,6309,6309,10567,14760,14792,18985,19018,19018,19018,19018,19018,19018,19018,21066,18953,14792,14793,18985,21066,21066,21066,21066,21066,19017,19018,19018,19018,19018,19018,19018,19018,18953,10468,6210,6210,6210,6243,6244,6244,6244,6244,6244,6244,10470,12550,10502,6309,8390,8423,6342,8422,14793,16873,8324,6244,8324,8324,8325,8357,8390,8422,8390,8390,6244,4162,4163,4163,8357,12584,12584,10503,12551,12551,12551,12583,12583,12583,14696,14664,12583,12583,12583,12583,8389,8356,8356,8356,10437,10438,8389,10437,10437,10437,10437,10437,10437,10437,10437,10437,10437,12518,12583,16745,14664,14664,14664,14664,14664,14664,14632,14631,12551,12551,12551,12551,10438,6243,6243,10405,10405,10405,8357,6244,8356,8357,8357,8357,8324,8324,8357,8357,10470,10437,8325,8325,6243,6244,10471,12519,10471,10471,10471,10471,10471,10471,10471,10471,10470,10470,10470,10438,8357,10502,16873,16841,16841,16841,16873,18954,16841,16840,16872,16872,16873,16873,16873,16873,16841,16809,16841,16840,16840,16841,16841,16841,16841,16809,16809,16841,18921,18922},
-	{4228,4228,4228,4228,4228,4228,4228,4196,4162,4162,2114,4163,4196,4196,4196,4196,4196,4197,4196,4196,4196,4197,4197,4197,4196,4197,4197,4197,4197,4229,4229,4229,4229,4229,4229,4229,4197,4197,4197,4229,4229,4197,4228,4163,4163,4196,4229,4229,4197,6277,6277,4229,4229,4229,4229,4229,4229,4229,4197,4197,4229,4197,4197,6277,6277,4197,4196,4196,4196,4196,4196,4196,4197,4196,4163,4196,4196,4196,4164,4163,4130,2082,2082,2082,2082,2082,2082,2082,2082,2082,2082,2082,4162,4162,4162,4162,4162,4162,4162,4162,4163,4228,4228,4229,4228,4196,4229,4229,4229,4229,4261,4229,4229,4229,4261,4229,4229,4229,4228,4228,4196,4196,4261,4261,4261,4261,4261,4261,4261,6309,6309,6309,6342,6342,6309,6309,6309,6310,6309,6309,6310,6310,6309,8390,16905,19018,19017,19017,19018,18986,14792,14760,14760,10567,6342,6342,12648,14760,14760,14760,14760,16905,19017,19018,19018,19018,19018,19018,19018,19018,19018,18953,12581,12581,10533,10533,12582,12615,12583,12615,12615,12614,16905,21066,16873,8390,6342,8422,8423,6342,8455,16840,6276,6244,8324,8325,8325,8324,6308,6308,8357,8358,6276,4163,4163,4163,8357,12551,10503,10503,12551,12551,12551,12551,12583,12583,12583,14696,14664,12583,12583,12583,10503,10503,10503,10503,12551,10470,8389,10437,10437,10437,10437,10437,10437,10437,10437,10437,10437,10437,10438,12518,12551,12551,12551,12551,12583,14664,14664,12583,10438,10470,10470,10438,8357,6243,6243,10405,10405,10405,8357,6244,8324,8357,8357,8357,8292,8324,8357,8325,8357,8325,8325,8324,6243,6244,10438,10438,10471,10471,10471,10471,10470,10471,10470,10470,8390,8358,8357,8357,8325,10502,16873,16841,16841,16809,16841,16873,18953,16873,16872,16872,16873,16840,16840,16840,16840,16809,16841,16841,16808,16809,16808,16840,16808,16809,16809,16809,16809,16873},
-	{4228,4228,4228,4228,4228,4228,4228,4196,4162,4163,4163,4196,4196,4196,4196,4196,4196,4197,4196,4196,4196,4197,4196,4197,4197,4197,4196,4197,4197,4229,4229,4197,4229,4229,4229,4229,4197,4197,4229,4229,4229,4197,4197,4196,4163,4196,4229,4229,4197,6277,6277,4197,4197,4197,4229,4197,4229,4229,4197,4197,4229,4197,4196,4197,6277,4229,4197,4196,4197,4196,4196,4196,4197,4196,4163,4196,4197,4197,4196,4196,4162,4162,4130,4162,4162,4162,4162,4162,4162,4162,4162,2082,2082,4162,4162,2114,2114,2114,2114,2114,4163,4163,4163,4195,4194,4162,4196,4229,4229,4229,4261,6309,4229,4229,4229,4229,4196,4196,4196,4196,4196,4196,4196,4229,4261,4261,4261,4261,4261,6309,4261,4261,6309,6310,6309,6309,6309,6309,6309,6309,6310,6310,6309,8390,16873,19018,18985,18985,19017,18985,8454,6309,6309,6309,6310,6309,6310,6310,6310,6310,6309,14760,19018,19018,19018,19018,19018,19018,19018,19018,19018,19018,21066,21066,21066,21066,21066,21066,21066,21066,21066,19018,19018,19018,16873,8390,6310,6342,8423,8423,8455,18953,12550,6276,6276,8324,8324,6243,6210,6210,8292,8325,8324,6211,4195,6276,8390,10503,10503,12551,10503,12551,12551,12551,12551,12583,12583,12583,14696,12583,10470,10470,10503,10503,10503,10503,10470,10438,10470,10438,10437,10437,10437,10437,10437,10437,10437,10437,10437,10437,10437,10437,10437,10438,12518,10437,10470,12518,12518,10470,10438,12518,12518,10438,8357,6243,6243,8357,8357,8357,8357,6244,8324,8357,8357,8357,6244,8324,8357,8325,8325,8324,8325,8324,6243,8324,8325,8357,8357,8357,8357,8358,8358,10438,10438,10438,8325,8325,8357,8357,6244,10502,16841,16841,16841,16808,16808,16840,16873,16873,16840,16840,16840,16840,16840,16840,16808,16776,16808,16841,16808,16808,16808,16840,16808,16808,16808,16808,16808,16808},
-	{2148,2148,2148,2148,2148,4228,4228,4196,2115,4196,4196,4196,4197,4196,4196,4196,4196,4197,4196,4196,4196,4197,4197,4197,4197,4197,4196,4197,4197,4197,4229,4229,4197,4229,4229,4229,4229,4229,4229,4229,4229,4197,4197,4197,4163,4196,4229,4229,4197,4197,4197,4229,4229,4229,4197,4229,4197,4197,4229,4197,4197,4197,4197,4197,4197,4197,4197,4197,4197,4196,4196,4196,4197,4196,4196,4196,4196,4196,4196,4196,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,4162,2082,2114,4162,4162,2082,2082,2082,2114,4162,4161,4161,4161,4161,4161,4163,4196,4229,4229,4229,4261,6309,4229,4229,4229,4228,4196,4196,4196,4196,4195,4196,4196,4228,4196,4229,4261,4229,4229,4261,4261,6309,6309,6309,6309,6309,6309,6309,6309,6309,6309,6309,6309,10535,12615,12615,14792,18985,18953,8454,6310,6310,6309,6310,6309,6309,6342,6342,6342,6342,10535,12648,18953,19018,19018,19018,21098,21098,19018,19018,19018,19018,19018,19018,19018,19018,19018,19018,19018,19018,19018,19018,19018,16873,8357,6310,6342,6342,8390,10535,19018,18953,10502,6276,6276,6243,6210,6210,6210,6244,8324,8324,6243,6243,8390,10470,10503,10503,10503,12551,12551,12551,12551,12551,12583,12583,12583,12584,14664,12551,10470,10503,10503,10503,10503,10470,8389,10470,10437,10437,10437,10437,10437,10437,10437,10437,10437,10437,10437,10437,10437,10437,10437,12550,10470,10437,10405,10405,10405,8357,8357,8357,8357,8357,6244,6243,8357,8357,8357,8357,6244,8324,8357,8357,8357,6244,8324,8325,8325,8325,8325,8325,8324,6243,8324,8325,8325,8324,6276,6276,6276,6277,8357,8357,8357,8325,8325,8357,8324,6244,10502,16808,16841,16808,16808,16808,16808,16840,16808,14792,14792,16840,16840,16808,16808,16808,16808,16808,16840,16808,16776,14760,16808,16808,16808,16808,16808,16808,16808},
-	{2115,2115,2115,2147,2147,4196,4228,4196,4196,4196,4196,4196,4196,4196,4196,4196,4197,4197,4197,4197,4196,4197,4197,4196,4197,4197,4197,4196,4196,4197,4229,4229,4197,4229,4229,4229,4229,4229,4229,4229,4229,4197,4197,4197,4163,4196,4229,4197,4229,4229,4197,4229,6277,4229,4197,4229,4197,4197,4197,4197,4196,4197,4197,4197,4196,4196,4197,4197,4197,4197,4197,4197,4196,4197,4196,4196,4196,4196,4196,4196,4162,2114,2114,2114,2114,2114,2114,2114,2114,2114,2114,4162,2114,2114,4162,4162,4162,2081,2081,4162,4162,4162,4162,4161,4161,2113,4194,4196,4229,4229,4229,4229,4261,6309,4229,4229,4229,4229,4196,4196,4196,4196,4195,6243,4195,6243,6244,4229,4229,4229,4229,4229,4229,6309,4229,6277,6277,6277,6277,6277,6277,6309,6309,6309,6309,6309,6277,8389,10468,10468,6276,6278,6310,6310,6310,6310,6342,6342,6310,6310,6310,6310,6309,10533,18985,19018,19018,21066,21131,21066,19018,19018,19018,19018,19018,18986,18985,18986,18986,18986,19018,19018,19018,21066,16873,8356,6277,6310,6309,6309,8422,18986,21066,18953,16808,8388,6210,6210,6210,6210,6244,8324,8324,6242,6243,8390,10470,10503,10503,10503,12551,12551,12551,12551,12551,12583,12583,12584,12583,12583,14696,14664,10503,10438,10438,10470,10438,8389,10437,10437,10437,10437,8389,10437,10437,10437,10437,10437,10437,10437,10437,10437,10437,8389,10437,12550,10470,10405,10405,10405,8357,8357,8357,8357,8357,6244,6243,8357,8357,8357,8356,6243,8324,8357,8357,8325,6244,8292,8325,8325,8325,8325,8325,6276,6244,6276,8324,8325,8324,8324,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,10502,16841,16841,16808,14760,16776,14760,16808,14760,14760,16873,16840,14792,16808,14760,14760,14792,16808,16808,16809,16809,16808,16808,14760,16776,14728,14728,14728,14760},
-	{2148,2148,2147,2147,2115,2115,4228,4228,4196,4196,4196,4196,4196,4196,4196,4196,4197,4197,4197,4197,4196,4197,4197,4196,4197,4197,4197,4197,4196,4197,4229,4229,4197,4229,4229,4229,4229,4229,4229,4229,4229,4197,4197,4197,4163,4196,4229,4229,4229,4229,4197,4229,6277,6309,4229,4229,4197,4197,4197,4196,4197,4197,4197,4197,4197,4197,4197,4197,4197,4197,4197,4197,4197,4196,4196,4196,4196,4196,4196,4196,4162,4162,2114,2114,2114,4162,4162,4162,4162,4162,4162,4162,2114,4162,2082,4162,4162,4162,2082,4163,4163,4163,4163,4163,4162,4195,4196,4196,4229,4197,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4196,4195,4162,4162,4162,4196,4229,4229,4229,4229,4229,4229,4229,4229,6277,6277,6277,6277,6277,6309,6309,6309,6309,6309,6309,6309,6243,4161,4161,4162,6277,6309,6309,6309,6309,6309,6309,6309,6277,6276,6244,6243,6275,16873,19018,19018,19018,21066,21131,21066,19018,18986,18986,14728,10534,10535,10535,10502,8422,14760,19018,19018,19018,18986,14695,6276,6277,6277,6276,6309,10502,12680,21066,21098,10500,6210,6210,6210,6210,6243,8324,8324,6242,6243,8389,8422,10503,10503,10503,10503,12551,12551,12551,12551,12551,12583,12584,12583,12583,12616,14696,12551,8389,8357,8357,8389,8389,8389,8390,10503,12583,10502,10470,10470,10470,10470,10470,10470,10470,10438,10437,10437,8389,8389,10438,10438,10437,10437,8357,8357,8357,8357,8357,8389,8357,6244,8357,8357,8357,8356,6243,8324,8357,8325,8325,6244,8324,8325,8325,8325,8325,8325,6276,6276,8324,8324,8324,8292,8292,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,10502,16840,16840,16840,16840,16808,16808,14760,14760,14760,16873,16905,16840,14792,14760,14728,14760,14760,14760,14728,14760,14760,14760,14728,14728,14728,14728,14728,14728},
-	{4196,4196,2147,4196,4196,4164,4228,4196,4196,4196,4196,4196,4196,4196,4196,4196,4197,4197,4197,4197,4197,4197,4197,4197,4197,4197,4197,4197,4197,4197,4229,4197,4229,4229,4229,4229,4229,4229,4229,4229,4229,4197,4197,4197,4163,4196,4229,4229,4229,4229,4229,4197,4229,6277,6277,4229,4197,4196,4196,4197,4197,4197,4197,4197,4196,4196,4196,4197,4197,4197,4197,4197,4197,4196,4196,4196,4196,4196,4196,4196,4195,4163,4162,4162,4162,4162,2114,2114,2114,2114,2114,4162,2114,4162,2114,2081,4130,4163,4163,4163,4163,4163,4163,6244,10502,6277,4197,4197,4196,4197,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4195,4161,4161,4162,4195,4228,4229,4229,4229,4229,4229,4229,4229,6277,6277,6277,6277,6277,6309,6277,6309,6277,6244,4195,4195,4162,4161,4162,4162,6244,6244,6244,6244,6276,6276,6244,6244,6244,6244,6244,6243,8356,16873,19018,19018,18985,18985,21066,21099,19018,18986,14760,8390,6309,6309,6309,6309,6276,12647,19018,19018,19018,19018,18985,12615,8356,6276,6276,6309,6309,8390,14760,21066,18920,8388,6210,6210,6210,6210,6211,6211,6210,6242,6243,8357,10503,10503,10503,10503,10503,10503,12551,12551,12551,12583,12584,12583,12583,12583,10503,10470,8389,8389,8389,10470,10471,10471,10503,10503,12616,12616,10503,10503,10503,10503,10503,10502,10470,10470,10437,10437,8389,10437,8389,8389,10470,10470,10437,10470,8390,10470,10470,10470,10470,6276,8357,8357,8357,8356,6243,8324,8357,8325,8325,6244,6276,8325,8325,8357,8389,8357,8357,8325,8324,8324,6276,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,10502,16840,16840,16840,16840,14728,14728,14760,14792,14760,14760,16873,16873,14760,14760,14728,14760,14728,14728,14728,14728,14760,14728,14728,14728,14728,14728,14728,14728},
-	{4228,4196,4228,4228,4196,4196,4228,4196,4196,4196,4196,4196,4196,4196,4196,4196,4197,4197,4196,4197,4197,4197,4196,4197,4197,4197,4196,4197,4197,4197,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4197,4229,4229,4197,4163,4196,4229,4229,4229,4229,4229,4197,4197,4197,4229,4229,4229,4197,4196,4197,4197,4197,4197,4197,4196,4196,4196,4197,4197,4197,4197,4197,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4163,4162,2114,2114,2114,2114,2114,2114,2114,4162,2114,2081,4130,4163,6244,4163,4163,4163,4163,4163,6276,4196,4196,4196,4197,4197,4197,4197,4197,4197,4197,6277,6277,4197,4197,4229,4229,4229,4163,4161,4161,4161,4162,4196,4228,4229,4229,4229,4229,4229,6277,6277,6277,6277,6277,6277,6277,6277,6277,6244,6243,6211,6210,6210,6210,4162,4162,6211,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,8324,8421,18953,18986,18985,18986,18986,18986,19018,18986,18986,12680,6309,6309,6309,6309,6309,6277,12583,18986,19018,19018,19018,19018,18985,16873,10470,6244,6309,6342,6342,8390,16840,21098,18920,8388,8323,8291,6210,6210,6210,6210,6210,4163,8357,10471,10503,10503,10503,10503,12551,12551,12551,12551,12583,12551,12551,12551,12551,10438,8422,8454,8422,10471,10503,10503,10503,10503,10503,10503,12616,12616,10503,10503,10503,10503,10503,10503,10470,10438,10437,10437,10437,10437,8389,10438,10503,10470,10471,10471,10503,10503,10471,8389,6244,8324,8325,8325,8324,6243,8357,8357,8325,8325,8325,8325,8325,8325,8389,8357,8357,8389,8357,8357,8324,6276,6244,6244,6244,6244,6276,8357,8357,8357,8357,8357,8357,6276,6244,10502,14792,16840,14792,14760,14728,14728,14760,14760,14760,14760,14760,14792,14760,14760,14760,14760,14728,14728,14728,14728,14728,14728,14728,14728,14728,14728,14728,14728},
-	{4261,4228,4228,4228,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4197,4197,4196,4197,4197,4197,4197,4196,4197,4197,4197,4197,4197,4197,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4197,4197,4229,4196,4196,4229,4229,4229,4229,4229,4197,4197,4197,4196,6277,6277,4197,4197,4197,4197,4197,4197,4197,4196,4196,4196,4197,4197,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4163,2114,2114,2114,2114,4163,4162,4162,4162,4162,4162,4162,4162,4163,4163,6244,4163,4163,4163,4163,4163,4196,6277,4197,4196,4197,4196,4196,4196,4196,4197,4229,6309,6277,4229,4228,4196,4196,4163,4161,4161,4161,4162,4196,4196,4196,4196,4196,6244,4196,4196,4228,4229,6277,6277,6277,6277,6244,6244,6244,6244,6244,6244,6244,6244,6275,8355,8356,8356,6243,6243,6244,6244,6244,6244,8389,8389,8389,14728,18953,18986,18986,18985,18986,18986,18986,18986,18986,19018,14728,6309,6310,6309,6309,6309,6277,6276,14760,19018,19018,19018,19018,19018,21066,10502,6244,6309,6310,6310,6277,14760,21098,21098,18985,18985,14727,8355,8356,8356,8355,6210,6243,8325,8357,10438,10470,10470,10471,10471,10503,12551,12551,12551,8390,10438,10438,8390,8389,10470,10503,8390,8422,10503,10503,10503,10503,10503,10503,10503,12616,12616,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10502,10503,12616,10503,10503,10471,10503,10470,6276,6243,6243,6211,6211,6211,6243,8390,8390,8357,8357,8390,8389,8324,6276,6309,8390,8390,8390,8390,8357,6277,6277,6277,6277,6244,6244,8292,8389,8390,8390,8390,8390,8390,8357,8357,8389,12615,14760,14760,14760,14728,14728,14760,14760,14760,14760,14760,14760,16840,16873,14760,14760,14760,14760,14728,14760,14760,14760,14728,14728,14728,14728,14728,14728},
-	{4228,4261,4228,4228,4228,4228,2148,4196,4196,4196,4196,4196,4196,4196,4196,4197,4197,4197,4197,4197,4197,4196,4197,4196,4196,4197,4197,4197,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4197,4197,4229,4196,4197,4229,4229,4229,4229,4229,4197,4197,4197,4197,4197,6277,6277,4197,4197,4196,4197,4197,4197,4196,4196,4196,4197,4197,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4163,2114,2114,2114,4163,4196,4196,4196,4196,4196,4196,4164,4164,4163,4163,4163,6244,4163,4163,4163,4163,4163,4196,6277,4197,4196,4197,4197,4197,4197,4197,4196,4197,6277,4229,4196,4196,4196,4163,4161,4161,4161,4162,6244,6211,6211,6211,6211,6243,6211,6243,6244,6244,6277,6277,6276,6244,6244,6244,6244,6244,6244,6244,6243,6244,14727,18953,18953,14760,8388,8388,8389,8421,8421,10534,18953,18953,18953,18986,18986,18986,18986,18986,18986,18986,18986,18986,18986,21066,14793,6310,6310,6309,6309,6277,6276,6244,14728,19018,19017,19018,19018,19018,19018,12647,6276,6244,6276,6276,8357,16840,21098,21098,21098,21098,21098,21066,21066,21066,18985,8420,6243,8325,8325,8357,8357,8357,8357,8357,10438,10470,10503,10470,8390,10470,10502,10438,8389,8422,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,12616,12616,10503,10503,10503,10503,10503,10535,10535,10503,10503,10503,10503,10503,10503,10535,12616,10503,8423,10503,8422,6244,6243,8357,6244,6244,6244,6243,8390,8390,8390,8357,8390,8390,6244,6244,8357,8390,8390,6342,6342,6342,6342,4294,2278,2246,4229,4229,6277,8390,8390,8390,8390,8390,8390,8358,8357,8357,8389,12647,14792,14760,14760,14760,14760,14760,14760,14760,14760,14760,14760,16841,16873,14760,14760,14760,14728,14728,14728,14760,14760,14760,14760,14728,14728,14728},
-	{4228,4228,4261,4228,4228,4228,4228,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4197,4197,4196,4197,4197,4197,4197,4197,4197,4197,4229,4229,4229,4229,4229,4229,4229,4197,4197,4197,4197,4197,4229,4229,4197,4197,4229,4229,4197,4229,4229,4229,4229,4229,4229,4229,4197,4197,4197,4197,6277,6277,4197,4197,4197,4197,4197,4197,4197,4197,4197,4197,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4163,2114,2114,4163,4196,4197,4196,4196,4196,4196,4196,4196,4196,4163,4163,4163,4163,4163,4163,4163,4163,4163,4164,4197,4229,4196,4196,4196,4196,4196,4196,4197,4197,4197,4197,4229,4197,4197,4163,4161,4161,4161,4162,6244,4163,6211,6211,6211,6212,6211,6212,6244,6244,6244,6244,6243,6212,6212,6212,6244,6244,6243,6276,10469,10469,16840,18985,18985,18985,18953,18953,18953,18953,18953,18985,16905,14760,14760,14760,14760,14760,14760,14760,14760,14760,14760,14760,14792,14792,12648,8390,6310,6277,6244,6244,6244,6244,14728,19018,19017,19018,19018,19018,19018,18986,12615,6276,6244,8356,16776,21066,21098,21098,21098,21098,21098,21098,21098,21131,21131,16872,6244,8325,8325,8325,8325,8325,8357,8357,8357,8357,8357,8357,8357,8357,8357,8357,8389,8422,8455,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,12616,10568,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,12616,10503,8422,8422,6308,6308,8422,8422,8422,8390,6276,8390,8390,8390,8390,8390,8390,6243,4195,8358,6342,6342,4327,2278,4294,2278,2278,2279,2279,4262,2246,4294,6342,6342,8390,8358,8358,8358,8358,8358,8357,8325,12615,14792,14760,14760,14760,14760,14760,14760,14760,14760,14760,14760,14760,16873,16841,14760,14728,14696,14696,14728,14760,14792,14760,14760,14728,14728,14728},
-	{4228,4228,4228,4261,4228,4228,4228,2180,2148,4196,4196,4196,4196,4197,4197,4196,4196,4197,4197,4196,4197,4229,4197,4229,4229,4197,4229,4197,4197,4197,4197,4197,4197,4197,4197,4197,4197,4228,4229,4197,4197,4197,4197,4229,4229,4197,4229,4229,4229,4229,4229,4229,4229,4197,4197,4196,4196,4197,6309,6277,4197,4196,4196,4196,4196,4197,4197,4197,4197,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4163,2114,2114,4163,4196,4196,4196,4196,4196,4196,4163,4196,4196,4163,4163,4163,4163,4163,4163,4163,4163,4163,4164,4196,4196,4229,4196,4196,4196,4196,4196,4196,4196,4196,4229,6309,4197,4196,4162,4161,4161,4161,4162,4164,4196,6244,6244,4196,4163,6211,6211,6212,6244,6244,6243,6212,6212,6212,6212,6244,6243,6211,10469,18953,18953,18953,18985,18985,18985,18985,18985,18985,18985,18953,14760,10567,6309,6309,6309,6309,6309,6309,6309,6310,6310,6310,6310,6310,6310,6309,6342,10535,10534,10534,10502,10502,10534,16840,19018,19018,21098,19018,19018,19018,19018,14760,8356,8356,14728,21066,21098,21098,21066,21098,21098,21098,21098,21098,21130,21130,16904,6244,8324,8325,8325,8325,8325,8357,8357,8357,8357,8357,8357,8357,10437,10438,8357,8357,8454,8455,10503,10502,10503,10503,10503,10503,10503,10503,10503,10503,10503,10535,12616,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,8455,10535,10568,10503,8422,8422,8422,8422,8422,10471,8422,6276,8390,8390,8390,8390,8390,8390,6276,6276,6342,4327,2279,2279,2279,2279,2279,2279,2279,2279,2279,2279,2279,2246,2246,2246,6342,8358,8357,8358,8357,8325,6276,12615,14760,14760,14760,14760,14760,14760,14760,14760,14760,14760,14728,14760,14760,16840,16840,14760,14728,14728,14728,14760,16840,14760,14760,14728,14728,14728},
-	{4228,4228,4228,4228,4261,4228,2148,2148,2115,4196,4196,4196,4196,4196,4196,4196,4196,4197,4197,4196,4197,4197,4229,4229,4229,4197,4197,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4196,4196,4229,4229,4229,4197,4229,4197,4229,4229,4229,4229,4229,4229,4197,4197,4229,4197,4197,4196,4197,4229,6277,6277,4197,4197,4197,4197,4196,4197,4197,4197,4197,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4163,2114,2114,4163,4196,4196,4196,4196,4196,4196,2115,4196,4196,4163,4163,4163,4163,4163,4163,4163,4163,4163,4163,4196,4196,4196,4228,4196,4196,4196,4196,4196,4196,4196,4196,6244,6244,6244,4162,4162,4163,4163,4196,4197,4197,6277,6277,4196,4195,6211,4195,6211,6212,6244,6212,6244,6243,4163,6211,6244,10470,10534,14727,18953,18953,18953,18953,18953,18985,18953,18985,18985,18985,16873,6341,6309,6309,6309,6309,6309,6309,6309,6309,6309,6309,6309,6309,6309,6309,6309,6309,14761,21098,19018,18986,18986,18986,18986,19018,19018,21098,19018,16873,12680,12680,8389,6276,8422,14728,14728,18953,21098,21098,21098,21098,21098,21098,21098,21130,21130,16872,6243,6277,8325,8325,8325,8325,8357,8357,8357,8357,8357,8357,8357,10437,10470,10438,8357,10470,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10535,10536,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,8455,10535,10536,10503,8422,8422,8422,8422,10503,10503,6276,8389,8422,8390,8390,8390,8390,8390,6374,2279,2311,2311,2279,2279,2279,2279,2279,2279,2279,2279,2246,2246,2246,2246,2246,2246,6342,8390,8358,8358,8357,8357,12615,14760,14760,14760,14760,14760,14760,14760,14760,14728,14760,14760,14728,14728,14760,16840,16840,14759,14727,14727,14728,14728,14728,14728,14696,14728,14728},
-	{4228,4228,4228,4228,4229,4261,4228,2148,2115,4196,4196,4196,4196,4196,4196,4196,4197,4197,4196,4196,4197,4197,4229,4197,4197,4197,4197,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4196,4197,4229,4229,4229,4197,4229,4197,4197,4229,4197,4197,4229,4229,4229,4229,4229,4229,4197,4196,4197,4196,4229,6309,6277,4197,4197,4197,4196,4197,4197,4197,4197,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4163,4162,2114,2114,4163,4196,4196,4163,4196,4196,4196,4196,4196,4196,4196,4163,4163,4163,4163,4162,4162,4162,4162,4163,4163,4163,4163,4195,4195,4163,4163,4163,4163,4163,4163,4163,4163,6211,6244,4195,4196,4196,4197,4197,4228,4196,6277,6309,4228,4195,6211,4163,4195,6244,6244,6244,4196,8389,12614,12614,12615,16873,18953,18953,16905,18953,18953,18953,18953,18985,18953,18953,18985,18985,16840,6308,6277,6309,6309,6309,6309,6309,6309,6309,6310,6310,6310,6310,6310,6310,6309,6309,10535,18986,21098,19018,18986,18985,19017,19018,19018,19018,19018,12680,6309,6309,6309,6309,6310,6310,6310,10535,18986,21098,21098,21098,21098,21098,21098,21130,21130,19017,14727,12550,8325,8325,8325,8325,8357,8357,8357,8357,8357,8357,8357,8357,10438,10470,10438,8357,10502,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10535,10536,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,8423,10503,10503,8422,8422,8422,8422,8422,10503,8389,8390,8422,8390,8390,8390,8390,4326,2311,2311,2311,2311,2279,2279,2279,2279,2279,2279,2279,2278,2246,2246,2246,2246,2246,2246,4294,4294,8358,8357,8357,8357,12615,14760,14760,14760,14760,14760,14760,14760,14760,14728,14728,14760,14728,14727,14727,14728,16840,16840,14727,14727,14727,14728,14728,14760,14728,14728,14728},
-	{4228,4228,4228,4228,4228,4229,4228,2180,2115,4196,4196,4196,4196,4196,4196,4197,4196,4197,4197,4197,4197,4197,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4197,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4197,4229,4229,4229,4229,4229,4229,4229,4229,4197,4196,4196,4197,4197,4229,6309,6277,4197,4197,4196,4196,4197,4197,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4163,2114,2114,2114,4163,4196,4196,4196,4164,4196,4196,4196,4196,4196,4196,4196,4163,4163,4163,4129,4129,4129,4129,4163,4163,4163,4163,4163,6244,6244,4163,4163,4163,4163,4163,4163,4163,4163,4196,6277,4197,4196,4196,4196,4197,4197,4196,6277,6309,4196,4196,4195,4196,6244,6277,6277,4196,6341,10535,10535,10535,10534,10535,10534,14728,18953,18953,18953,18953,18953,18953,18953,18985,18985,16840,6275,6277,6309,6309,6309,6309,6309,6309,6309,6309,6309,6309,6309,6309,6309,6277,6277,6309,10535,12648,12648,14760,18985,19017,19018,19018,19018,19018,14760,8390,6310,6310,6309,6342,6342,6342,6341,16873,21098,21098,21098,21098,21098,21098,14728,12615,14760,23179,14728,8325,8325,8325,8357,8357,8357,8357,8357,8357,8357,8357,8357,8357,10437,10470,6276,10470,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10536,10535,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,8455,10503,8423,8422,8422,8422,8422,8422,8422,8422,8422,8422,8390,8390,8390,8390,8390,4326,2311,2311,2311,2279,2279,2279,2279,2279,2279,2279,2278,2278,2246,2246,2246,2246,2246,2246,2246,2246,6309,6276,6276,6244,12583,14760,14760,14760,14760,14760,14728,14728,14728,14728,14728,14728,14728,14728,14727,14727,14760,16841,14792,14728,14727,14728,14728,14760,16873,14760,14695},
-	{4228,4228,4228,4228,4228,4228,4228,4228,2148,4196,4197,4196,4196,4196,4197,4197,4197,4197,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4197,4229,4229,4197,4197,4197,4197,4229,4229,4197,4197,4197,4197,4196,4196,4229,6309,6277,4197,4196,4196,4197,4197,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4162,4162,2114,4163,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4164,4163,4162,4129,4129,4129,4162,4163,4163,4163,4163,4163,6244,6244,4163,4163,4163,4163,4163,4163,4196,4196,4229,6277,4197,4196,4196,4197,4197,4196,4197,6277,4229,4196,6244,6244,6277,6277,4229,4229,4229,4229,4229,4229,4229,4229,4229,8390,10503,10503,8454,10567,16905,18985,18953,18985,18985,16840,6243,6244,6309,6309,6309,6309,6309,6309,6309,6276,4196,4196,4196,6309,6309,6309,6309,6310,6309,6309,6342,8421,14727,19018,19018,19017,19017,19018,14728,8390,8390,6310,6310,6342,6310,6342,6309,16840,21098,21098,21098,21098,21098,14728,8390,6309,8389,14760,14728,8357,8357,8325,8325,8325,8357,8357,8357,8357,8389,8389,8389,14695,21034,12582,6243,6276,6276,8389,10502,10502,10503,10503,10502,10503,10503,10503,10503,10503,10503,10503,10503,10535,12616,10535,10503,10503,10503,10503,10503,10503,10503,10503,8455,10503,10503,8422,8422,8422,8422,8422,8422,8422,8422,8422,8422,10503,8390,8390,8390,8390,6374,2311,2311,2311,2279,2279,2279,2279,2279,2279,2279,2278,2278,2246,2246,2246,2246,2246,2246,2246,2214,4229,6244,6244,6243,12614,14760,14760,14760,14760,12712,14760,14727,14727,14727,14727,14727,14728,14728,14728,14727,14727,14760,14760,14727,14727,14727,14727,14760,16873,16905,14760},
-	{4228,4228,4228,4228,4228,4228,4228,4261,4260,4196,4196,4196,4196,4197,4197,4197,4197,4197,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4197,4197,4197,4197,4229,4229,4197,4197,4229,4197,4197,4197,4197,4229,4229,4196,4196,4196,4197,4197,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4163,2114,2114,4163,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4195,4162,4161,4162,4162,4195,4195,4163,4163,4163,4163,6243,6243,4163,4163,4163,4163,4196,4196,4196,4196,4229,6277,4197,4196,4196,4197,4197,4197,4196,6277,6277,6245,6245,4229,4229,4229,4229,4229,4229,6309,6277,4229,6277,6277,6277,6277,6277,6277,6309,10567,16905,16905,16905,16872,8388,6210,6243,6309,6309,6309,6309,6309,6309,6309,6277,6277,6277,6277,6309,6309,6309,6310,6310,6310,6309,6309,6276,12647,19018,19017,19018,19018,19018,14696,6309,8422,6342,6310,6310,6310,6310,6309,16840,21098,21098,21098,21098,14760,8389,8390,8390,6342,8389,14728,18954,18921,10502,8389,8389,8389,14728,21034,18986,21034,21034,21066,23147,25260,12582,6243,8356,6243,6243,6276,6276,6276,6276,6276,8357,10503,10503,10503,10503,10503,10503,10503,10503,10535,12616,10535,10503,10503,10503,10503,10503,10503,10503,8455,10503,10503,8422,8422,8422,8422,8422,8422,8422,8422,8422,8422,8455,10503,8390,6342,4326,2311,2311,2311,2311,2279,2279,2279,2279,2279,2279,2279,2278,2278,2246,2246,2246,2246,2246,2246,2246,2246,2213,4228,6244,6244,10566,14760,14760,10599,4326,4326,10599,14728,12680,14727,14728,14728,14727,14728,14728,14727,14727,14727,14727,14727,14727,14727,14727,14727,14728,16873,16840},
-	{4228,4228,4228,4228,4228,4228,4228,4228,4228,4229,4197,4196,4197,4197,4197,4197,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4197,4229,4197,4197,4196,4196,4196,4197,4197,4196,4196,4197,4197,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4163,2114,2114,2114,4163,4196,4196,4196,4196,4196,4196,4196,4196,4163,4162,4163,4196,4196,4196,4196,10533,10566,12614,12647,8388,4162,4161,4129,4162,4162,6243,6211,4163,4163,4164,4196,4196,4196,4196,4196,4229,6277,4196,4196,4196,4197,4197,4196,4228,6277,6277,4197,4229,4229,4229,4229,4229,4229,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,6309,12647,12614,6307,6307,4162,6243,8357,6309,6309,6309,6309,6309,6309,6309,6309,6309,6309,6309,6309,6309,6309,6309,6309,6277,6243,6243,6210,14695,21098,19018,19018,19018,19018,14728,6276,6277,6276,6277,6277,6277,6277,8325,16841,21098,21098,21098,21130,14695,6309,8390,8390,8358,6277,14695,23211,23179,21066,21066,21066,21066,23179,23243,23243,25291,25291,25260,16873,10535,10437,6276,6276,8356,6243,6211,6211,6211,6211,6211,6276,10503,10503,10503,10503,10503,10503,10503,10503,10503,10535,10503,10503,10503,10503,10503,10503,10503,10503,8455,10503,10503,8422,8422,8422,8422,8422,8422,8422,8422,8422,8390,8390,10470,10503,6374,2311,2311,2311,2311,2279,2279,2279,2279,2279,2279,2279,2279,2278,2246,2246,2246,2246,2246,2246,2246,2246,2246,2246,2213,4196,4229,4326,10599,6406,4326,166,2214,8518,8455,4326,12647,12679,12679,14728,14728,14728,14728,14727,14727,14727,14727,14727,14727,14727,14727,14727,14728,16840},
-	{4228,4228,4228,4228,4228,4228,4228,4228,2148,4228,6277,4196,4197,4197,4197,4197,4197,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,6277,4229,4229,4229,4229,6277,6276,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4197,4197,4197,4197,4229,4197,4197,4197,4196,4196,4197,6309,4229,4196,4196,4197,4197,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4163,2114,2114,2114,4162,4162,4162,4162,4163,4195,4163,4163,4163,2114,2114,4196,4196,4196,4196,4196,4195,4195,6340,10502,6243,4163,4163,4130,4130,4163,6276,6308,6276,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4197,4196,4196,4197,6309,6277,4229,4229,4229,4229,4229,4229,4229,6277,6310,6277,4229,6277,6277,4229,6277,6277,6277,10535,10533,4129,4161,4161,6210,6276,6277,6277,6277,6309,6277,6277,6277,6309,6277,6309,6309,6309,6277,6276,6244,6244,6244,6210,6210,6210,12614,21131,21098,19018,19018,19018,18986,12615,8324,6244,8357,8324,6244,6244,6276,16840,21098,21098,21098,23211,16840,8357,6277,8325,8325,8357,14760,23179,23211,23211,25292,23211,23211,23211,23211,23211,25291,23211,18921,10502,8455,8455,8422,6244,8324,8324,6211,6211,6211,6243,6211,8324,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,8455,10503,10503,8423,8422,8422,8422,8422,8422,8422,8422,8422,8390,8390,8390,8454,6407,2311,2311,2311,2311,2279,2279,2279,2279,2279,2279,2279,2279,2278,2246,2246,2246,2246,2246,2246,2246,2246,2246,2246,2246,2213,2246,2246,2246,2246,166,2214,2214,2246,2246,2214,4294,4294,6407,12648,12679,14727,14727,14728,14728,14727,14727,14727,12679,12679,12679,12679,12679,14727},
-	{4228,4228,4228,4228,4228,4228,4228,4228,2148,4196,4197,4229,4197,4197,4197,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,6277,6277,4229,4229,4229,4229,4229,6277,4229,4229,4229,4229,6244,4196,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4197,4197,4197,4229,4197,4197,4197,4197,4197,4197,4196,4197,6277,6309,4229,4197,4196,4196,4196,4197,4197,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4163,4162,2114,4162,2114,2114,2114,4162,4162,4163,4163,4162,2114,2114,2114,4196,4196,4196,4196,4196,2114,2114,4163,4195,4163,4163,4163,4163,4163,8324,14695,14760,14728,6309,4196,4196,4196,4196,4196,4196,4196,4196,4196,4197,4196,4196,4197,4197,4197,4197,4229,6309,6277,4229,4229,4229,4229,4229,4229,6277,6277,6277,6277,6277,6277,6277,6277,6277,6277,10535,10533,4161,4161,4161,6210,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,12615,21066,21131,21066,19018,19018,19018,18986,12615,8389,8325,8357,8357,10469,10469,16873,21098,21098,21098,21098,21098,14696,8357,8324,8357,14695,21099,23179,23211,23211,23211,23211,23211,23211,23211,25259,25324,21098,10469,8390,8455,8455,8455,6276,6243,6243,6211,6243,6243,6243,6211,6276,10470,8390,8422,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,8455,10503,10503,10503,8422,8422,8422,8422,8422,8422,8422,8422,8390,8390,8422,8390,6407,4392,2311,2311,2311,2279,2279,2279,2279,2279,2279,2279,2279,2278,2278,2246,2246,2246,2246,2246,2246,2246,2246,2246,2246,2246,2246,2246,166,166,2246,198,2246,2214,2214,2214,2214,166,2246,2246,10567,14727,14727,14728,14728,14728,14727,12679,12679,12679,12679,12679,12679,12679},
-	{4228,4228,4228,4228,4228,4228,2148,4228,2148,4196,4197,6309,6277,4229,4197,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,6277,6277,6277,4229,4229,4229,4229,4229,4229,4229,4229,4229,6244,4196,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4229,4197,4229,4229,4229,4229,4197,4197,4197,4197,4197,4196,4197,4196,6277,6309,4197,4196,4196,4196,4197,4197,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4162,2114,4162,4162,4162,4162,4162,4162,4162,4162,4163,4163,2114,2114,2114,4164,4196,4196,4163,2114,2114,4162,4163,4163,4163,4163,4163,4163,4163,4163,8421,14760,14760,8421,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4196,4197,4197,4196,4197,4197,4229,6309,6277,4229,4229,4229,4229,4229,6277,4229,6277,6309,6277,6277,6277,6277,4196,4196,10534,10533,4161,4161,4161,6210,6244,6244,8324,8324,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,6244,12615,19018,19018,19018,19018,19018,19018,19018,19018,18953,10502,8421,14728,21066,21066,21098,21098,21098,21098,21098,21130,23179,12647,8421,12615,21098,23179,23179,23211,23211,23211,23211,23211,23211,23211,23211,25292,21066,8389,8357,8422,8455,8455,8357,6243,6243,6243,6243,6243,6243,6211,6243,8356,8422,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,10503,8455,10503,8423,10471,8422,8422,8422,8422,8422,8422,8422,8422,8390,8390,8422,6374,4327,4392,2343,2311,2311,2279,2279,2279,2279,2279,2279,2279,2279,2278,2246,2246,2246,2246,2246,2246,2246,2246,2246,2246,2246,2246,2246,2246,2246,2246,166,198,2246,2246,2246,2214,2214,2214,166,2214,8487,12647,12679,14728,14728,14728,12679,12679,12679,12679,12679,12679,12679,12679},
-
-};
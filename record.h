@@ -0,0 +1,175 @@
+/* GAME RECORDS */
+// A game is stored as its board seed (generateBoard() rebuilds the board) and the colors
+// picked, 3 bits per move; RECORD_PASS marks a turn that changed nothing (a timeout or
+// an illegal color in filler.c). A record file is a header with the rules the games were
+// played under (RecordHeader, RECORD_HEADER_BYTES of it, written a field at a time with
+// the 16 and 64-bit fields little-endian), then records back to back:
+//   seed      8 bytes, little-endian
+//   moves     2 bytes, little-endian
+//   colors    (3 * moves + 7) / 8 bytes, move k in bits 3k .. 3k + 2, low bits first
+// A 40-move game takes 25 bytes. The writer and reader stream through stdio, one record
+// at a time, so a file can hold any number of games. recordPack() and recordUnpack()
+// do the same in memory, for a game with no file to go to.
+
+#ifndef RECORD_H
+#define RECORD_H
+
+/* LIBRARIES */
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "engine.h"
+
+
+/* RECORD INITIALIZATIONS */
+#define RECORD_MAGIC 0x31454D4147464C46ULL // "FLFGAME1"
+#define RECORD_PASS 7 // a turn with no move
+#define RECORD_MAX_MOVES 65535
+#define RECORD_BYTES(moves) (10 + (3 * (moves) + 7) / 8) // packed size of a record
+#define RECORD_HEADER_BYTES 16
+
+// rules of every game in a file
+#define RULE_PASS_ON_TIMEOUT 1 // a turn can run out and pass
+#define RULE_PASS_ON_ILLEGAL 2 // picking a territory color passes the turn
+
+typedef struct {
+    uint64_t magic; // RECORD_MAGIC
+    uint8_t unused; // held the board size when it was one byte; 0 now
+    uint8_t colorCount;
+    uint8_t generator; // BOARD_GENERATOR the seeds were drawn with
+    uint8_t rules; // RULE_* bits
+    uint16_t turnSeconds; // time per turn, 0 for none
+    uint16_t boardSize; // BOARD_MIN_SIZE .. BOARD_MAX_SIZE
+} RecordHeader;
+
+typedef struct {
+    FILE *file;
+    RecordHeader header;
+    uint8_t buffer[RECORD_BYTES(RECORD_MAX_MOVES)];
+} RecordStream;
+
+
+/* PACKING */
+// write a record to bytes (RECORD_BYTES(count) of them); returns that size
+static inline int recordPack(uint8_t *bytes, uint64_t seed, const uint8_t *moves, int count) {
+    for (int i = 0; i < 8; i++) bytes[i] = (uint8_t)(seed >> (8 * i));
+    bytes[8] = (uint8_t)count;
+    bytes[9] = (uint8_t)(count >> 8);
+
+    uint8_t *colors = bytes + 10;
+    int size = (3 * count + 7) / 8;
+    memset(colors, 0, (size_t)size);
+    for (int k = 0, bit = 0; k < count; k++, bit += 3) {
+        unsigned value = (unsigned)(moves[k] & 7) << (bit & 7);
+        colors[bit >> 3] |= (uint8_t)value;
+        if ((bit & 7) > 5) colors[(bit >> 3) + 1] |= (uint8_t)(value >> 8);
+    }
+    return 10 + size;
+}
+
+// the moves of a packed record; bytes holds at least the 10 bytes before them
+static inline int recordMoveCount(const uint8_t *bytes) {
+    return bytes[8] | (bytes[9] << 8);
+}
+
+static inline uint64_t recordSeed(const uint8_t *bytes) {
+    uint64_t seed = 0;
+    for (int i = 0; i < 8; i++) seed |= (uint64_t)bytes[i] << (8 * i);
+    return seed;
+}
+
+// read the colors of a packed record into moves[]; returns the number of moves
+static inline int recordUnpack(const uint8_t *bytes, uint8_t *moves) {
+    int count = recordMoveCount(bytes);
+    const uint8_t *colors = bytes + 10;
+    for (int k = 0, bit = 0; k < count; k++, bit += 3) {
+        unsigned value = colors[bit >> 3] >> (bit & 7);
+        if ((bit & 7) > 5) value |= (unsigned)colors[(bit >> 3) + 1] << (8 - (bit & 7));
+        moves[k] = (uint8_t)(value & 7);
+    }
+    return count;
+}
+
+
+/* STREAMS */
+// the header as it is on disk: the fields in order, each little-endian
+static inline void recordPackHeader(uint8_t *bytes, const RecordHeader *header) {
+    for (int i = 0; i < 8; i++) bytes[i] = (uint8_t)(header->magic >> (8 * i));
+    bytes[8] = header->unused;
+    bytes[9] = header->colorCount;
+    bytes[10] = header->generator;
+    bytes[11] = header->rules;
+    bytes[12] = (uint8_t)header->turnSeconds;
+    bytes[13] = (uint8_t)(header->turnSeconds >> 8);
+    bytes[14] = (uint8_t)header->boardSize;
+    bytes[15] = (uint8_t)(header->boardSize >> 8);
+}
+
+static inline void recordUnpackHeader(const uint8_t *bytes, RecordHeader *header) {
+    header->magic = recordSeed(bytes); // 8 bytes little-endian, like a seed
+    header->unused = bytes[8];
+    header->colorCount = bytes[9];
+    header->generator = bytes[10];
+    header->rules = bytes[11];
+    header->turnSeconds = (uint16_t)(bytes[12] | (bytes[13] << 8));
+    header->boardSize = (uint16_t)(bytes[14] | (bytes[15] << 8));
+}
+
+// the header of files of games on size x size boards written by this engine
+static inline RecordHeader recordHeader(int size, int rules, int turnSeconds) {
+    RecordHeader header = { RECORD_MAGIC, 0, COLOR_COUNT, BOARD_GENERATOR, (uint8_t)rules, (uint16_t)turnSeconds, (uint16_t)size };
+    return header;
+}
+
+static inline bool recordCreate(RecordStream *stream, const char *path, const RecordHeader *header) {
+    stream->file = fopen(path, "wb");
+    if (!stream->file) return false;
+    stream->header = *header;
+    recordPackHeader(stream->buffer, header);
+    if (fwrite(stream->buffer, RECORD_HEADER_BYTES, 1, stream->file) == 1) return true;
+    fclose(stream->file);
+    stream->file = NULL;
+    return false;
+}
+
+// open a file for reading; false if it is missing, not a record file of this engine or
+// of games on a board size no engine plays
+static inline bool recordOpen(RecordStream *stream, const char *path) {
+    stream->file = fopen(path, "rb");
+    if (!stream->file) return false;
+    RecordHeader *header = &stream->header;
+    bool read = fread(stream->buffer, RECORD_HEADER_BYTES, 1, stream->file) == 1;
+    if (read) recordUnpackHeader(stream->buffer, header);
+    if (read && header->magic == RECORD_MAGIC
+        && header->colorCount == COLOR_COUNT && header->generator == BOARD_GENERATOR
+        && header->boardSize >= BOARD_MIN_SIZE && header->boardSize <= BOARD_MAX_SIZE) return true;
+    fclose(stream->file);
+    stream->file = NULL;
+    return false;
+}
+
+// append one game; count is cut to RECORD_MAX_MOVES
+static inline bool recordWrite(RecordStream *stream, uint64_t seed, const uint8_t *moves, int count) {
+    if (count > RECORD_MAX_MOVES) count = RECORD_MAX_MOVES;
+    int size = recordPack(stream->buffer, seed, moves, count);
+    return fwrite(stream->buffer, 1, (size_t)size, stream->file) == (size_t)size;
+}
+
+// the next game: its seed and moves (room for RECORD_MAX_MOVES); returns the number of
+// moves, or -1 at the end of the file or on a cut-off record
+static inline int recordRead(RecordStream *stream, uint64_t *seed, uint8_t *moves) {
+    if (fread(stream->buffer, 1, 10, stream->file) != 10) return -1;
+    size_t size = (size_t)(3 * recordMoveCount(stream->buffer) + 7) / 8;
+    if (fread(stream->buffer + 10, 1, size, stream->file) != size) return -1;
+    *seed = recordSeed(stream->buffer);
+    return recordUnpack(stream->buffer, moves);
+}
+
+static inline bool recordClose(RecordStream *stream) {
+    bool ok = fclose(stream->file) == 0;
+    stream->file = NULL;
+    return ok;
+}
+
+#endif
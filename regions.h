@@ -0,0 +1,306 @@
+/* REGION GRAPH ENGINE */
+// Splits a board into connected same-colored components with union-find and links
+// components that touch. A RegionGraph is built once per board and never changes; a
+// RegionGame is the play state on top of it, sized by the number of components, so a
+// move, a score and a copy for lookahead all cost regions rather than cells.
+// Every component is either wholly free or wholly owned, so a move just merges the
+// free components of the chosen color that touch the territory into it.
+//
+// The generator in filler.c never puts two equal colors side by side, so its boards
+// start with one component per cell; the graph pays off on boards that allow
+// same-colored neighbours and shrinks as territories merge.
+
+#ifndef REGIONS_H
+#define REGIONS_H
+
+/* LIBRARIES */
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "engine.h"
+
+
+typedef struct {
+    int size; // cells per side of the board it was built from
+    int count; // number of components
+    int *cellRegion; // component of each cell, row-major
+    unsigned char *color; // color index of each component
+    int *cells; // cells in each component
+    int *adjStart; // neighbours of component r are adj[adjStart[r] .. adjStart[r + 1] - 1]
+    int *adj;
+    int colorCount[COLOR_COUNT]; // components of each color
+} RegionGraph;
+
+typedef struct {
+    const RegionGraph *graph;
+    int *parent; // union-find over components; a territory is one set
+    int *setCells; // cells in each set, valid at the root
+    unsigned char *owner; // PLAYER1, PLAYER2 or 0 for each component
+    unsigned char *queued; // bit (player - 1) set once a component is in that player's frontier
+    int *frontier[2][COLOR_COUNT]; // free components touching each territory, by color
+    int frontierCount[2][COLOR_COUNT];
+    int territory[2]; // a component in each player's territory, -1 if they have none
+    int territoryColor[2];
+    int score[2];
+} RegionGame;
+
+
+/* UNION-FIND */
+static inline int findRoot(int *parent, int r) {
+    while (parent[r] != r) {
+        parent[r] = parent[parent[r]]; // path halving
+        r = parent[r];
+    }
+    return r;
+}
+
+// join two sets, keeping the larger one's root; returns the new root
+static inline int unionSets(int *parent, int *setCells, int a, int b) {
+    a = findRoot(parent, a);
+    b = findRoot(parent, b);
+    if (a == b) return a;
+    if (setCells[a] < setCells[b]) { int t = a; a = b; b = t; }
+    parent[b] = a;
+    setCells[a] += setCells[b];
+    return a;
+}
+
+static inline int compareEdges(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+
+/* GRAPH CONSTRUCTION */
+static inline void freeRegionGraph(RegionGraph *graph) {
+    free(graph->cellRegion); free(graph->color); free(graph->cells);
+    free(graph->adjStart); free(graph->adj);
+    memset(graph, 0, sizeof(*graph));
+}
+
+// free buildRegionGraph()'s working arrays, and the graph too when it failed; returns ok
+static inline bool endRegionBuild(RegionGraph *graph, bool ok, int *parent, int *setCells, unsigned char *cellColor,
+                                  uint64_t *edges, int *fillAt) {
+    free(parent); free(setCells); free(cellColor); free(edges); free(fillAt);
+    if (!ok) freeRegionGraph(graph);
+    return ok;
+}
+
+// label the components of a board (before or after claimCorners) and link the ones that touch
+static inline bool buildRegionGraph(RegionGraph *graph, const AnyBoard *board) {
+    int size = board->size, cellCount = size * size;
+    memset(graph, 0, sizeof(*graph));
+    graph->size = size;
+
+    int *parent = malloc(sizeof(int) * cellCount);
+    int *setCells = malloc(sizeof(int) * cellCount);
+    unsigned char *cellColor = malloc(cellCount);
+    uint64_t *edges = malloc(sizeof(uint64_t) * 2 * cellCount);
+    int *fillAt = malloc(sizeof(int) * (cellCount + 1)); // there are at most as many components as cells
+    graph->cellRegion = malloc(sizeof(int) * cellCount);
+    if (!parent || !setCells || !cellColor || !edges || !fillAt || !graph->cellRegion) {
+        return endRegionBuild(graph, false, parent, setCells, cellColor, edges, fillAt);
+    }
+
+    // union every cell with its right and lower neighbour when they share a color
+    for (int cell = 0; cell < cellCount; cell++) {
+        parent[cell] = cell;
+        setCells[cell] = 1;
+        cellColor[cell] = (unsigned char)board->ops->colorAt(board->board, cell / size, cell % size);
+    }
+    for (int cell = 0; cell < cellCount; cell++) {
+        int col = cell % size;
+        if (col + 1 < size && cellColor[cell + 1] == cellColor[cell]) unionSets(parent, setCells, cell, cell + 1);
+        if (cell + size < cellCount && cellColor[cell + size] == cellColor[cell]) unionSets(parent, setCells, cell, cell + size);
+    }
+
+    // number the roots, then point every cell at its component
+    int count = 0;
+    for (int cell = 0; cell < cellCount; cell++) {
+        if (findRoot(parent, cell) == cell) graph->cellRegion[cell] = count++;
+    }
+    graph->count = count;
+    graph->color = malloc(count);
+    graph->cells = calloc(count, sizeof(int));
+    graph->adjStart = calloc(count + 1, sizeof(int));
+    if (!graph->color || !graph->cells || !graph->adjStart) {
+        return endRegionBuild(graph, false, parent, setCells, cellColor, edges, fillAt);
+    }
+    for (int cell = 0; cell < cellCount; cell++) {
+        int r = graph->cellRegion[findRoot(parent, cell)];
+        graph->cellRegion[cell] = r;
+    }
+
+    // collect each touching pair of components once, smallest id first
+    int edgeCount = 0;
+    for (int cell = 0; cell < cellCount; cell++) {
+        int r = graph->cellRegion[cell], col = cell % size;
+        graph->color[r] = cellColor[cell];
+        graph->cells[r]++;
+        int next[2] = { (col + 1 < size) ? cell + 1 : -1, (cell + size < cellCount) ? cell + size : -1 };
+        for (int k = 0; k < 2; k++) {
+            if (next[k] < 0) continue;
+            int s = graph->cellRegion[next[k]];
+            if (s == r) continue;
+            int lo = (r < s) ? r : s, hi = (r < s) ? s : r;
+            edges[edgeCount++] = ((uint64_t)lo << 32) | (uint32_t)hi;
+        }
+    }
+    qsort(edges, edgeCount, sizeof(uint64_t), compareEdges);
+    int unique = 0;
+    for (int e = 0; e < edgeCount; e++) {
+        if (unique == 0 || edges[e] != edges[unique - 1]) edges[unique++] = edges[e];
+    }
+
+    // store both directions of every pair as adjacency lists
+    graph->adj = malloc(sizeof(int) * (2 * unique + 1));
+    if (!graph->adj) return endRegionBuild(graph, false, parent, setCells, cellColor, edges, fillAt);
+    for (int e = 0; e < unique; e++) {
+        graph->adjStart[(int)(edges[e] >> 32) + 1]++;
+        graph->adjStart[(int)(uint32_t)edges[e] + 1]++;
+    }
+    for (int r = 0; r < count; r++) graph->adjStart[r + 1] += graph->adjStart[r];
+    memcpy(fillAt, graph->adjStart, sizeof(int) * (count + 1));
+    for (int e = 0; e < unique; e++) {
+        int a = (int)(edges[e] >> 32), b = (int)(uint32_t)edges[e];
+        graph->adj[fillAt[a]++] = b;
+        graph->adj[fillAt[b]++] = a;
+    }
+    for (int r = 0; r < count; r++) graph->colorCount[graph->color[r]]++;
+
+    return endRegionBuild(graph, true, parent, setCells, cellColor, edges, fillAt);
+}
+
+/* PLAY STATE */
+// a RegionGame and its arrays live in one allocation, so copying it for lookahead is one memcpy
+static inline size_t regionGameBytes(const RegionGraph *graph) {
+    int n = graph->count;
+    return sizeof(RegionGame) + sizeof(int) * (2 * n + 2 * n) + 2 * (size_t)n;
+}
+
+static inline void regionGameLayout(RegionGame *game, const RegionGraph *graph) {
+    int n = graph->count;
+    game->graph = graph;
+    game->parent = (int*)(game + 1);
+    game->setCells = game->parent + n;
+    int *lists = game->setCells + n;
+    for (int p = 0; p < 2; p++) {
+        for (int c = 0; c < COLOR_COUNT; c++) {
+            game->frontier[p][c] = lists; // each bucket has room for every component of its color
+            lists += graph->colorCount[c];
+        }
+    }
+    game->owner = (unsigned char*)lists;
+    game->queued = game->owner + n;
+}
+
+// queue the free neighbours of component r into a player's frontier
+static inline void regionExtendFrontier(RegionGame *game, int me, int r) {
+    const RegionGraph *graph = game->graph;
+    for (int k = graph->adjStart[r]; k < graph->adjStart[r + 1]; k++) {
+        int s = graph->adj[k];
+        if (game->owner[s] || (game->queued[s] & (1 << me))) continue;
+        game->queued[s] |= 1 << me;
+        int c = graph->color[s];
+        game->frontier[me][c][game->frontierCount[me][c]++] = s;
+    }
+}
+
+// start a game on the graph: each player owns the component of their corner
+static inline RegionGame *newRegionGame(const RegionGraph *graph) {
+    RegionGame *game = malloc(regionGameBytes(graph));
+    if (!game) return NULL;
+    regionGameLayout(game, graph);
+
+    int n = graph->count;
+    for (int r = 0; r < n; r++) {
+        game->parent[r] = r;
+        game->setCells[r] = graph->cells[r];
+        game->owner[r] = 0;
+        game->queued[r] = 0;
+    }
+    memset(game->frontierCount, 0, sizeof(game->frontierCount));
+    for (int player = PLAYER1; player <= PLAYER2; player++) {
+        int me = player - 1, r = graph->cellRegion[cornerCell(graph->size, player)];
+        game->score[me] = 0;
+        game->territory[me] = -1;
+        game->territoryColor[me] = -1;
+        if (game->owner[r]) continue; // both corners in one component: the first player keeps it
+
+        game->owner[r] = player;
+        game->territory[me] = r;
+        game->territoryColor[me] = graph->color[r];
+        game->score[me] = graph->cells[r];
+    }
+    for (int me = 0; me < 2; me++) {
+        if (game->territory[me] >= 0) regionExtendFrontier(game, me, game->territory[me]);
+    }
+    return game;
+}
+
+static inline void copyRegionGame(RegionGame *dst, const RegionGame *src) {
+    memcpy(dst, src, regionGameBytes(src->graph));
+    regionGameLayout(dst, src->graph);
+}
+
+static inline RegionGame *cloneRegionGame(const RegionGame *src) {
+    RegionGame *game = malloc(regionGameBytes(src->graph));
+    if (game) copyRegionGame(game, src);
+    return game;
+}
+
+
+/* GAME LOGIC */
+// merge every free component of the chosen color touching the player's territory into it;
+// same rules as fill(), returns how many cells were absorbed
+static inline int regionFill(RegionGame *game, int player, int color) {
+    if (color < 0 || color >= COLOR_COUNT) return 0;
+
+    int me = player - 1, opp = 1 - me;
+    if (game->territoryColor[me] == color || game->territoryColor[opp] == color) return 0;
+    game->territoryColor[me] = color;
+    if (game->territory[me] < 0) return 0; // no corner to grow from, like fill() with an empty territory
+
+    const RegionGraph *graph = game->graph;
+    int *bucket = game->frontier[me][color], count = game->frontierCount[me][color];
+    int root = game->territory[me], gain = 0;
+    game->frontierCount[me][color] = 0;
+
+    // neighbours of a component never share its color, so the bucket is stable while we merge
+    for (int k = 0; k < count; k++) {
+        int r = bucket[k];
+        game->queued[r] &= ~(1 << me);
+        if (game->owner[r]) continue; // taken by the opponent since it was queued
+        game->owner[r] = player;
+        gain += graph->cells[r];
+        root = unionSets(game->parent, game->setCells, root, r);
+        regionExtendFrontier(game, me, r);
+    }
+    game->territory[me] = root;
+    game->score[me] += gain;
+    return gain;
+}
+
+// cells each color would absorb for the player right now, without playing it
+static inline void regionGains(const RegionGame *game, int player, int gains[COLOR_COUNT]) {
+    int me = player - 1;
+    for (int c = 0; c < COLOR_COUNT; c++) {
+        gains[c] = 0;
+        for (int k = 0; k < game->frontierCount[me][c]; k++) {
+            int r = game->frontier[me][c][k];
+            if (!game->owner[r]) gains[c] += game->graph->cells[r];
+        }
+    }
+}
+
+// the score is the size of the player's set in the union-find
+static inline int regionScore(RegionGame *game, int player) {
+    int r = game->territory[player - 1];
+    return (r < 0) ? 0 : game->setCells[findRoot(game->parent, r)];
+}
+
+static inline int regionIsGameOver(const RegionGame *game) {
+    return game->score[0] + game->score[1] == game->graph->size * game->graph->size;
+}
+
+#endif
@@ -0,0 +1,272 @@
+/* BALANCED BOARD SEEDS */
+// Generated by tools/fairness.c -n 700 -d 8 -w 2 -c 256 -s 1: boards that end
+// within 2 cells when alpha-beta plays both sides to depth 8. Board k of the
+// catalog is generateBoard(BALANCED_SEEDS[k]).
+
+#ifndef SEEDS_H
+#define SEEDS_H
+
+#include <stdint.h>
+
+#define BALANCED_SEED_COUNT 256
+
+static const uint64_t BALANCED_SEEDS[BALANCED_SEED_COUNT] = {
+    0x39B4332FD4168839ULL, // margin +2
+    0x87D564042C644B75ULL, // margin +0
+    0xBD2C0798AA49E5BEULL, // margin +0
+    0x92CE723D1E9AFACCULL, // margin +2
+    0xC256A749BAB0D87DULL, // margin +0
+    0x1219E86D0C93FA25ULL, // margin -2
+    0xEEF42CE9AABB2D06ULL, // margin -2
+    0x3D13606C1963D613ULL, // margin +0
+    0xDC24533C47EC6C09ULL, // margin -2
+    0xC3C0FE7E29D7F5D7ULL, // margin +2
+    0xEE34714BA916542CULL, // margin -2
+    0x5E096F072CE10E3CULL, // margin -2
+    0x6FA6BCD4ABB1C030ULL, // margin +0
+    0x57F823D9E2C62B64ULL, // margin -2
+    0xD386E9A4A8E19324ULL, // margin +0
+    0xF3B57B9B0437F466ULL, // margin +0
+    0x6E1E41061B8C69A9ULL, // margin +0
+    0xE0021A9A5D12F475ULL, // margin +2
+    0xA2415AB4888E28F8ULL, // margin +0
+    0x6EEEAD4805B46998ULL, // margin +2
+    0x512ECFEF39B091D3ULL, // margin +0
+    0x2A07C981565FA8D6ULL, // margin +0
+    0x2BBDB04D4D707530ULL, // margin +0
+    0x8C90F04ADDAD1A24ULL, // margin -2
+    0xEF3E62BDA39CA4A2ULL, // margin +2
+    0x05A9FBC9EEF5BC79ULL, // margin +2
+    0xDB30F5F025DACE78ULL, // margin +0
+    0x0806CAA3C5140E4CULL, // margin +2
+    0x29C4DD2C29287FCFULL, // margin +2
+    0x2624BA094E07791AULL, // margin +2
+    0x27A38FD7643586FAULL, // margin -2
+    0x4202C494A8E33489ULL, // margin +2
+    0xAAB70DA9EEA097D5ULL, // margin +2
+    0x7FD369F345885728ULL, // margin +0
+    0x7A78C694365B7ED2ULL, // margin -2
+    0x263FEAD19A569942ULL, // margin +0
+    0xC7EFB6D1A33E1F79ULL, // margin +0
+    0xA0131230873BD3C2ULL, // margin +0
+    0xFF6B554C81E3CAE8ULL, // margin +0
+    0xFFB69646DE80C186ULL, // margin -2
+    0xB81F349BB79ABF55ULL, // margin +0
+    0xA6CB894338DF91E3ULL, // margin +2
+    0xDDD454B87A397E0EULL, // margin -2
+    0x1124E1A26C040FA8ULL, // margin -2
+    0x179F4DFD3C0EDD1EULL, // margin -2
+    0x19F73D3F1E0848B2ULL, // margin +0
+    0x5A3B3E34BFF9A7E9ULL, // margin +0
+    0x3E8B89E87ED29C6BULL, // margin +0
+    0xFB4985525A59CA14ULL, // margin -2
+    0xF16E9D5261D3C456ULL, // margin +2
+    0xA22BC1F4141BC98FULL, // margin +2
+    0x03E74CB55A839A8BULL, // margin +2
+    0x774DF86CC735E45AULL, // margin +2
+    0xA431589DDFDEA65DULL, // margin +0
+    0xD882F96DF6342348ULL, // margin +2
+    0xD50D0F16D698B334ULL, // margin -2
+    0xC14388468505FC1CULL, // margin -2
+    0x88862933BB969F0CULL, // margin +2
+    0x1F90410239E8434CULL, // margin +2
+    0x42D946375D9B33EEULL, // margin +2
+    0xB91603F3FC9D6E29ULL, // margin +2
+    0x2889AF0350D76E96ULL, // margin -2
+    0xB59F6429C9EC037FULL, // margin +2
+    0xB79D20B8A0A37A8FULL, // margin -2
+    0xB330FACFBA6B2FECULL, // margin -2
+    0x833C7BEDB647F3DDULL, // margin +0
+    0x94BF63051043AAA8ULL, // margin +0
+    0x751112DCA2F6C6BFULL, // margin +0
+    0xFD55E3CF26585185ULL, // margin +2
+    0x9722E84E1C91A2B8ULL, // margin +0
+    0xC2BFE9076F39F684ULL, // margin -2
+    0x764B25C778C8D941ULL, // margin -2
+    0x539D03B88193DFD9ULL, // margin +0
+    0xA8E72FD10EF0CF22ULL, // margin +0
+    0xE43AC6220E86E244ULL, // margin +0
+    0x5D2F77F68E0E3630ULL, // margin +2
+    0xC60EB05C3C8362A5ULL, // margin +0
+    0xEE3A648C97F93D0CULL, // margin +2
+    0x03E9899C7344313AULL, // margin -2
+    0x46D9787A9B808457ULL, // margin +2
+    0x7D67CD31D14E17ABULL, // margin +0
+    0xDDA57AC1E9AA61ACULL, // margin +0
+    0xA1E4500148118607ULL, // margin +2
+    0x9A613CE1A7DD2606ULL, // margin +2
+    0x7567114B313302E9ULL, // margin +2
+    0x1BA6A93A63963A0AULL, // margin +2
+    0x308F968005B0CAD9ULL, // margin -2
+    0xD433F44CA9CBB1C1ULL, // margin +0
+    0xD182E709BF686798ULL, // margin -2
+    0x2C511025C81EF933ULL, // margin +2
+    0x75E6855452AECFA2ULL, // margin +0
+    0x765CCA172E2C9033ULL, // margin +0
+    0x5F490F06DBC804ECULL, // margin +0
+    0xEA90EA3F3044A909ULL, // margin -2
+    0x3116320B71DCAFECULL, // margin +2
+    0xBBCBF328D4807CCBULL, // margin +2
+    0x3EAB97AFA6271FFFULL, // margin +0
+    0xDA5FA05A49EF00DAULL, // margin +2
+    0x8A141AD649F2C7F0ULL, // margin -2
+    0xC82A89BF3E532DEFULL, // margin +2
+    0x8F78E2E9BF108779ULL, // margin +0
+    0xDE39D930C823E5B9ULL, // margin +0
+    0x717618185BF035A9ULL, // margin +2
+    0x618A9564E141E0A9ULL, // margin +0
+    0x3AD5343889ACADF6ULL, // margin -2
+    0x69883F06A3272409ULL, // margin +2
+    0xEB01BC4FC5D6C451ULL, // margin -2
+    0x8A21D88CEA65FA2FULL, // margin +2
+    0xAE95B62B19029FB6ULL, // margin +2
+    0x56BDE8ECC1B47B90ULL, // margin +2
+    0x4CFC8445DE18EAD5ULL, // margin -2
+    0xB44E49FE4F2AC54CULL, // margin +2
+    0xE78FBCFD85D160B7ULL, // margin +0
+    0x56BE18EB5BE63B9EULL, // margin +0
+    0xDFA4B7BCCA60F269ULL, // margin +2
+    0x5DE8F04BBFF137A8ULL, // margin +0
+    0xC0BC11046C9FA9DDULL, // margin +0
+    0x14E93E1B584DC60DULL, // margin -2
+    0x56C4AC5E366CC90DULL, // margin +2
+    0xE2871407A0829878ULL, // margin +2
+    0x597761FEBAE18092ULL, // margin +0
+    0xEF8884FD4FA59512ULL, // margin -2
+    0xF6987ACD2BB35D2AULL, // margin -2
+    0x9B0AEF5E0B9E9ABFULL, // margin +2
+    0x0C7283861FC965E2ULL, // margin +2
+    0xC59F2B73907A5424ULL, // margin +0
+    0x9C580D34919B9682ULL, // margin +2
+    0x82A30E099F61B599ULL, // margin -2
+    0x6D850B37FA5B3861ULL, // margin -2
+    0x3FBE601FDB279137ULL, // margin +0
+    0xD1931E3937112254ULL, // margin +2
+    0xB8EC6D230A6B29FDULL, // margin -2
+    0xFB181E01E8AB1E8EULL, // margin +2
+    0x5A17A3C669AE0A7CULL, // margin +0
+    0x00206B993A84DA05ULL, // margin -2
+    0x444DD1DAD647410EULL, // margin -2
+    0x80BC4D91765FA93FULL, // margin -2
+    0x3C765364F36D42ACULL, // margin +2
+    0xF1EBF9EF5AE6BDEFULL, // margin -2
+    0xDC3D4D86F8F7A019ULL, // margin -2
+    0xDE970B1BD16CE000ULL, // margin +2
+    0x058A8534DCAA499FULL, // margin +0
+    0x3D565B5D6D5440EFULL, // margin +0
+    0x328D76141D3CF34AULL, // margin +0
+    0xBDEFA071C2E325F5ULL, // margin +2
+    0x7B40262666A90612ULL, // margin +2
+    0x6294023CB234E2CFULL, // margin -2
+    0x55AD0AD424E02E28ULL, // margin +2
+    0xEC055602E50A6FAFULL, // margin +2
+    0x45BCDF108BAD6C94ULL, // margin +2
+    0x9EA084F295C89428ULL, // margin +2
+    0x3870A92E5182F672ULL, // margin -2
+    0x66B844B215F10F0CULL, // margin +2
+    0x46E323F7FC492CDEULL, // margin +0
+    0xC51579BCF20ED11FULL, // margin +2
+    0x399A8BB3C5E78513ULL, // margin +2
+    0x2F099240B0FD5441ULL, // margin +0
+    0x03F258864360C6F3ULL, // margin +2
+    0x35337E646DCBAFDCULL, // margin +2
+    0x61EF326347431775ULL, // margin +0
+    0xBC1BA30E876B6718ULL, // margin +2
+    0x39BB9BC5992B389AULL, // margin +2
+    0x62D8183D3DCCA4C2ULL, // margin +2
+    0x8502EA9A04A26ECFULL, // margin +0
+    0x6F8E190F751C5574ULL, // margin -2
+    0x2845FFBFB2B87AEAULL, // margin +2
+    0x0B2B725CBD4F859AULL, // margin +0
+    0x04E4C850180AE3A7ULL, // margin +0
+    0x07CD50A378E79A64ULL, // margin +2
+    0x581E029B2380D6AEULL, // margin -2
+    0x856B2440FE2C2A4DULL, // margin +2
+    0xB9F7E6E108410A62ULL, // margin +2
+    0x4B5218708CBF407CULL, // margin +2
+    0xEE81DDD74944F044ULL, // margin -2
+    0x809F41BF11403631ULL, // margin +2
+    0x9575D794E64F33DCULL, // margin +2
+    0x4FFFE171ABB3641EULL, // margin +0
+    0x42EAA751CFD35ECAULL, // margin +0
+    0x6E3C59E44E6FDFA7ULL, // margin +2
+    0x9BB85BF5E35ACA91ULL, // margin +0
+    0x05B4C985204DA120ULL, // margin +2
+    0x44C4699C039C47B3ULL, // margin +0
+    0xE0D403C5B1811602ULL, // margin +2
+    0xE9E16EFD03C895A8ULL, // margin -2
+    0xA1437255D99FF75DULL, // margin +2
+    0x885803738B052C02ULL, // margin +0
+    0x805D3E61E484204EULL, // margin +0
+    0xDFBE232E3717937BULL, // margin +0
+    0x269601DAF6A2E4F4ULL, // margin -2
+    0xF4D8B04D90BEA1C4ULL, // margin +2
+    0x790072355C995243ULL, // margin +2
+    0xC25A370AA3C94AFDULL, // margin +2
+    0xECF74BF5B3DFA9F1ULL, // margin +2
+    0x4E2EF227927F3C1CULL, // margin +2
+    0xA0A832E9533662A1ULL, // margin +2
+    0xBBC54A48E2D4619DULL, // margin -2
+    0xE2F684C803AB6E5FULL, // margin +2
+    0x2C371282C57B362CULL, // margin +0
+    0x66CD5732C7273E23ULL, // margin -2
+    0xD209037E955F0E60ULL, // margin +0
+    0xF7713D5DC2063D90ULL, // margin +2
+    0xE87497A76942030EULL, // margin +2
+    0x912FA4FEB52DDB8EULL, // margin +0
+    0x387468C73FA8D623ULL, // margin +2
+    0x7D48456654D3A566ULL, // margin -2
+    0x2DFE0A075B29AA55ULL, // margin +2
+    0x9CB12C410D6E5895ULL, // margin +0
+    0x1AA5C43B818DC19EULL, // margin -2
+    0xC65E81D23DE13A45ULL, // margin +2
+    0x1C18B74822494B57ULL, // margin -2
+    0x944FB9BA89D1BA6EULL, // margin +2
+    0xF6739EC97E63017FULL, // margin +2
+    0x1B07BBC227DD3254ULL, // margin +0
+    0x46953707A383D7D6ULL, // margin +2
+    0x1D7F9757667DB129ULL, // margin +2
+    0x455892A4ED224426ULL, // margin +2
+    0x883EC1EFBFDEF355ULL, // margin -2
+    0x78164285CDF27A22ULL, // margin -2
+    0xC5FF74E1B12122F1ULL, // margin +0
+    0x8A674F8A48C2E6E2ULL, // margin +2
+    0x00F413D2655C4F07ULL, // margin +2
+    0x049DFDF8A4ACD4BCULL, // margin +0
+    0x66476CDEB39902DEULL, // margin +2
+    0x69B4592938751C26ULL, // margin -2
+    0xFA2A60454BDD3ABAULL, // margin -2
+    0x5AFA61C015A7047AULL, // margin -2
+    0x866DAB32B602150FULL, // margin +0
+    0x7F81106805DC61CBULL, // margin +0
+    0xAC2679BB43B645E2ULL, // margin +2
+    0x6A5BC89C765C4A4CULL, // margin +2
+    0x3033ABACBDFD72BFULL, // margin -2
+    0x5657BA2FCFC86483ULL, // margin +2
+    0x00D14C998583984EULL, // margin +0
+    0x0C58A639F77485ACULL, // margin +0
+    0x62AD92FA1949DDA6ULL, // margin +2
+    0x3CCE08951395F31EULL, // margin +0
+    0xC0F33B5CE1B87C30ULL, // margin -2
+    0xCC8939457050D75CULL, // margin +2
+    0x3AA85FC998A75A8EULL, // margin +0
+    0xE2ADDF4B5753679AULL, // margin +0
+    0x48AF30DA4D9BCF3FULL, // margin -2
+    0x1E9F19B9A9F79ACDULL, // margin +2
+    0xF92D1CD499957800ULL, // margin -2
+    0xA024FA223A46F037ULL, // margin +0
+    0xDF603FBD5C379E77ULL, // margin +2
+    0x90D0C694ABC8C85DULL, // margin +2
+    0xEA88B9344205A79FULL, // margin -2
+    0x7E413FA4A8FEFB0DULL, // margin +0
+    0x236D11CD4B580984ULL, // margin +0
+    0x5780E269774E44F3ULL, // margin +2
+    0x548B160E7930AFD3ULL, // margin +0
+    0x9654D07A5048AB6EULL, // margin +2
+    0xD3781C35CA4AAA64ULL, // margin +0
+    0x2A647A06A8D8C995ULL, // margin -2
+    0xF11B54F64BFCDE50ULL, // margin +0
+    0xAA132ED05C49637BULL, // margin +2
+};
+
+#endif
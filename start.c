@@ -1,243 +0,0 @@
-[240][320] = {
-	{63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63195,63195,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63164,63164,63195,63196,63196,63196,63163,63164,63164,63164,63164,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63164,63196,63196,63164,63163,63163,63163,63163,63163,63195,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63195,63163,63163,63163,63163,63163,63163,63163,63163,63195,63195,63195,63195,63163,63163,63163,63163,63163,63195,63195,63163,63164,63196,63196,63164,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63163,63164,63196,63196,63196,63196,63196,63196,63196,63196,63163,63164,63196,63164,63163,63195,63195,63163,63163,63163},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,61083,61083,61083,61083,61083,63099,63099,63099,63131,63099,63099,63131,63131,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63131,63099,63131,63131,63131,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63131,63131,61083,63131,63099,63099,63131,61083,63131,63131,63131,63099,63099,63099,63099,63099,63131,63131,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63131,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63131,63131,63131,61083,63131,63099,63099,63131,61083,63131,63131,63131,63099,63099,63099,63099,63099,63131,63131,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,61083,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63131,63131,63099,63131,63131,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,63131,63131,63131,61083,61083,63131,63099,63131,63131,63131,63131,61083,63131,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63131,63131,63099,63131,63131,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,61083,61083,61083,61083,61083,63131,63099,63099,63131,63131,63131,63131,63131,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63131,63131,63099,63131,63131,63131,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63131,63131,63099,63099,63131,63131,63099,63131,63131,63131,63099,63131,63131,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63131,63131,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63099,63099,63131,63131,63099,63099,63131,63131,63131,63131,63131,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63131,61083,63099,63131,63131,61083,61083,61083,63131,63131,61083,61083,63131,63131,61083,63131,63099,63131,61083,63131,63099,63131,63131,61083,61083,61083,61083,63131,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61083,61082,56985,54969,56985,61082,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63131,63131,63131,61083,63131,63131,61083,61083,61083,61083,61083,61083,61083,63131,63131,63131,63131,63131,63131,61083,63131,63099,63099,63131,63131,63131,61083,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61115,52953,36403,28274,36435,54873,61018,61050,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63131,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,61083,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63099,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63098,63130,63131,55001,30258,26192,32306,50744,56889,58970,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63099,63131,61083,61083,61083,61083,59035,59035,59035,59003,59003,59035,61083,61083,61083,61083,63131,63131,63131,63131,63131,61083,61083,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63099,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63131,61082,50871,48823,44726,32402,30353,32370,42613,44630,48695,54777,54778,56858,61051,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63131,63131,61083,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,58938,56730,56730,56730,56730,54746,57019,57051,57019,52634,50521,52569,54682,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56762,58971,59099,57051,50810,46649,46650,40344,38198,36150,44504,57084,57052,54842,50649,50649,52665,54713,54681,56729,56730,56730,56698,56698,56698,56698,56698,56698,56698,56698,56698,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56762,56730,56730,56730,52697,30257,26158,26191,34611,36659,34579,30417,30386,32275,33875,33844,40053,54682,56762,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56730,56762,56762,56762,56730,56730,56698,58747,60828,60827,60955,63131,63131,58906,56762,56762,56762,56730,56762,61051,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,61083,61083,61083,54681,46135,46135,46135,44119,44215,52923,55067,52955,42198,40022,40022,44248,46265,48281,48281,48281,48281,50296,50296,50296,50296,50296,52344,52377,50392,50585,54907,52923,48730,46617,44569,38230,34037,34037,44504,55068,57084,44440,35989,35957,40086,46230,48247,48247,48215,48216,48216,50263,50263,50263,50263,50263,50263,50263,50263,50264,50264,50264,50264,50264,50264,50264,50296,50296,50296,50296,50296,50296,50296,50296,50296,50296,50296,50296,50296,50296,50264,50296,50296,50296,50296,50296,50296,50296,50296,50264,50264,50264,50264,50264,50296,50296,50264,50264,50264,50264,50264,50264,50264,50264,48248,48248,48248,48216,48216,48216,48216,48216,48248,48248,48248,48248,48248,48248,46265,46265,46265,50361,52409,46327,28144,24078,28207,40724,44821,42741,36530,34483,34291,33971,36020,40085,46200,46200,48249,50329,50297,50297,50297,50297,50297,50296,48280,48280,48280,50297,50297,50297,50297,50297,50265,50233,54395,58588,58587,58810,61083,61083,54649,48246,48247,48247,48247,50327,58939,61083,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,61083,61083},
-	{63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63131,63131,58906,54585,54585,52730,52762,52762,52762,54810,52794,48696,46647,46648,52794,52826,50714,40247,38134,38166,38166,38134,48439,54681,56729,56729,56729,54681,54682,56730,54682,44279,38135,38231,52858,57116,57083,44504,38263,38264,44537,46650,46650,38102,29619,31666,44279,54714,54713,56761,56730,56730,54682,54681,54681,54681,54681,54681,54681,54681,54681,54681,54681,54681,54681,54681,54681,54681,54681,54681,56729,54681,56697,56697,56697,56697,56729,54681,54681,54681,56729,54681,54681,54681,56729,56729,56729,56697,54649,54649,54649,54650,56698,56698,54649,54682,54682,54682,54682,54682,54682,54682,54682,54682,54682,54682,54682,54682,54682,54682,54682,54682,54682,54682,54682,54682,54682,54682,54682,52633,36116,29906,34002,52633,56795,52729,28176,24078,32337,51000,55098,55098,53017,53049,53017,52985,52986,48665,37845,35733,39990,54714,56762,56762,56730,54682,54681,54713,54713,54713,54713,56730,56666,54364,56380,54300,54300,54268,56635,58939,58939,58843,58748,58748,54746,54777,54777,54777,54777,54745,54617,54553,54585,61018,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,63099},
-	{63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63131,63131,63131,63131,63163,56762,48152,46072,52698,57116,57116,59196,59196,57116,44503,40341,42422,57083,59196,55035,38294,34133,34133,34133,36180,48567,61083,61083,61083,61083,61083,61083,61083,59068,46423,36022,38166,52890,59196,59164,42457,36216,38296,36217,36153,36153,31797,25393,25360,46391,61084,61083,61084,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61115,61115,61083,63131,63131,63131,61083,61083,61083,61083,61083,61083,61083,61083,63131,63131,63131,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,63131,63131,63131,63131,63131,63131,63131,63131,61083,61084,59067,34130,23725,27855,52792,59002,54906,30256,26094,32337,48951,55130,55130,55130,55130,55130,55130,57179,50809,29618,27474,35924,59035,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,60988,56476,56381,56350,56319,56318,56731,61211,61179,58844,58493,56477,58907,61243,61211,61211,61211,59131,52473,50200,50296,58938,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,61083,61019,56794,56762,54746,50553,50553,48600,46648,46681,52955,55067,55035,42487,38294,42422,52954,55067,50906,36277,34164,38294,46616,46616,46488,42198,42166,48407,54650,54650,54649,50552,48536,48600,50745,50778,50779,50748,48668,46618,46649,46618,38297,36153,36153,31991,29877,29877,38231,46520,46520,48504,52602,54650,52602,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,54618,54618,52570,52570,52570,52570,52570,52570,52569,52569,52569,52569,52569,52569,52569,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,52570,50585,38419,32272,34353,44724,46805,44725,26126,21997,28207,40691,46869,46837,46869,46869,46869,46869,46869,38516,19632,17520,27794,50522,54618,52570,52570,52570,52570,52570,52570,52570,52570,54586,54650,56859,56827,56700,56318,56287,58652,60956,60956,58748,58557,58588,58843,61083,61116,58876,58749,56701,54714,54682,54714,54682,54650,56762,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,61083},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,61115,56858,44086,44022,50617,59196,59196,44535,36116,36181,48761,50906,50874,40406,38294,40374,48825,50938,46777,34197,34164,44567,59196,59228,46552,29587,29586,42005,48247,48247,46199,40053,38004,48600,59196,59196,44411,33915,33946,50747,57147,57084,40377,34105,34105,34168,34200,34200,34135,34005,34005,35925,42007,44055,44055,44055,44055,44055,44056,44056,44023,44023,44055,44023,44024,44024,44024,44056,44056,44056,44056,44056,44056,44055,44055,44055,44055,44055,44055,44087,44087,44087,44087,44087,44087,44087,46135,46135,46135,46167,46167,46135,46135,44087,44055,44055,44055,44055,44055,44055,44055,44055,44055,44055,44055,44055,44055,44055,41976,41976,41976,41976,41975,41975,41975,41975,41975,41975,41975,42007,42008,42134,40563,38642,38642,38643,40691,38610,24045,19916,26094,36562,40691,40691,40691,40690,40690,40690,40722,34450,15631,13550,23697,42007,46072,44024,46072,46072,46072,46072,46072,46072,46072,46072,48312,59131,61211,58940,54269,54206,56445,60700,60669,60669,60669,60700,60796,60892,60924,58558,58271,56286,58907,61115,61083,48313,44056,48312,61050,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61019,61019,61019,56826,46263,46231,48633,53018,53018,42454,36148,36180,46713,50874,48794,46680,46680,46680,42583,40503,42551,44535,42487,46680,52954,55035,46584,35924,35989,35893,33781,33781,38006,40150,38101,48601,57084,57052,42363,33946,33977,48699,55067,55035,38266,29914,31961,36248,38392,38360,31830,29588,29588,35796,48344,48344,48344,48344,44087,39861,39861,41974,48312,50392,50392,50392,48376,48344,48344,48344,48344,48312,48312,48344,52569,52602,52602,54650,54650,54650,54682,54682,54682,54713,56794,56762,56762,56762,58778,60794,60795,60795,60794,60794,58778,56794,56730,54650,54649,56762,54714,54714,54714,54714,54714,54714,54714,54714,52666,50521,48344,48344,48344,48344,48344,48312,48312,48312,48312,48312,48312,39959,37848,37974,38483,38642,38611,36403,36340,36371,30256,28207,32304,34386,34355,36466,40691,40691,38643,34417,34417,28209,17774,17742,23760,35829,37846,41974,48313,50393,52409,50202,50139,50202,50329,50393,52569,58972,58972,56860,56668,54620,56573,56446,56445,58557,60669,60700,60796,60860,60860,58525,56286,56317,58843,61051,58971,50457,48280,50456,58939,61019,61019,61019,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,58874,50360,50328,50328,50456,57019,57083,46776,36470,34357,32148,34132,34132,38293,38294,40374,55002,59195,55066,30035,23793,34131,57083,59195,52922,40407,40407,50809,57083,57083,33973,19282,19313,34070,40440,40408,40282,38139,36090,38266,40442,40441,40408,42488,42457,34042,27770,27802,36281,42617,44569,33686,29364,27316,37877,61051,61051,61050,61051,42037,29394,29394,37812,58971,61083,61051,61051,61051,61051,61051,61051,61083,61083,61083,58971,50489,50457,50457,50457,50457,50457,50457,50425,50425,54682,61083,63099,61051,63099,62971,62907,62907,62907,62907,62907,62939,63099,61051,61019,61051,54713,50424,50425,50425,50425,50425,50425,50425,50425,50393,52569,61083,61083,61083,61083,61051,63099,63099,63099,61050,61050,58971,37911,29494,29588,36402,38642,38578,28016,25904,28016,36530,38643,34386,28017,25873,30129,40658,40691,38610,23918,21806,21870,24079,24111,26000,29715,31667,35860,54747,58907,58876,56445,56286,56444,58971,61147,59003,56477,56350,56604,61115,61147,54557,54143,52094,54301,58590,58589,58526,56414,56445,58557,58621,58621,56445,56413,56540,59003,59003,56763,50361,50296,50296,52504,63098,63130,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,61083,61083,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,48216,48216,48216,48376,57083,59195,50905,38486,38453,36245,34100,34100,36180,36212,38261,55002,59195,55034,30035,23793,32115,57115,59195,52922,40375,40375,50809,57147,57115,42391,33973,34005,40343,44568,42521,38201,31866,31865,36249,40569,40537,38297,38201,36153,29882,27771,27770,34136,38392,38264,35797,37845,37845,44182,61051,61051,61019,61019,46262,37812,37844,44149,59003,61083,61083,63099,63099,63099,63099,61019,58938,58970,58938,56859,48311,46167,46199,46199,46199,46199,46199,46199,46168,50488,61051,63099,63099,63099,63003,62971,62971,62971,62971,62970,60954,63131,61083,61083,61051,52600,46198,46231,46199,46199,46199,46199,46199,46199,46167,50424,58939,58971,58939,58971,61083,61083,63131,63131,63131,63130,61051,44215,37878,37973,36403,36530,36467,28048,25935,28048,36530,38611,34386,28017,25873,30097,40658,40691,38610,23918,21805,21838,26095,26127,28049,29683,29619,31700,40119,42232,46265,56381,58366,56476,61083,61179,59035,54429,54270,56572,61147,61147,56605,54143,54142,54270,58494,56478,56573,56572,56540,58620,58621,58621,56509,56476,56603,61083,61116,56730,48248,48216,48152,50392,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63131,61083,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,48216,54618,58907,54842,55035,55067,55067,55066,55066,50841,38262,34100,38293,40373,42421,55002,57147,55034,30035,23793,32115,55067,59196,57115,52954,52954,50841,48761,50809,52890,57115,57116,54906,50681,50681,48569,46522,46522,42521,40568,40569,36249,36090,34010,29881,27833,29881,29717,31764,29651,46262,61019,61051,48472,27473,27473,27441,27441,42101,61019,61018,58906,52570,52569,58906,63131,63099,63099,63099,50488,44086,46134,44086,48311,56858,58938,58938,58938,58938,58938,58938,58938,58938,61018,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,61050,61018,61018,61018,61018,61018,61018,61018,61018,61018,56762,46167,46135,46135,46199,56858,63131,63131,63131,61019,54584,52537,58874,60987,56890,30032,21741,23822,32209,36402,36402,38579,38579,38547,38451,38388,38451,40658,40690,38610,32304,32272,32304,36498,36498,38483,42390,44407,40278,27698,25617,31732,54587,58715,58811,61115,61179,61115,56731,56635,58811,61147,61179,56605,52094,52094,54206,56383,56382,58843,61115,61083,58716,58462,58462,58812,59035,58939,61051,61051,54649,56794,58874,50296,50392,61050,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63131,63131,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099,63131,61083,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58842,48216,54650,61051,54906,52986,52986,52986,50938,50938,46681,38229,38229,52922,57115,55066,53018,50969,50937,40437,36276,40438,46712,46680,50842,59196,59196,52922,46680,48728,50682,52763,52763,54746,58874,58874,58970,61211,59164,46682,34233,34234,32026,29850,29881,34200,34263,36311,29683,23184,23151,46229,63099,63131,44246,12781,12781,12781,12749,35795,63099,63098,58874,46200,44119,56761,63131,63099,63099,63099,56761,52536,52568,52568,52600,61051,61083,63131,63131,63131,63099,63099,63099,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58938,52568,52536,52536,52568,58970,63163,63163,61115,60987,50328,48247,58842,63067,58970,27920,19596,21709,40660,46934,44885,38610,38578,42708,46902,51032,46870,32337,30289,32369,38642,40723,40691,42772,42771,44788,50968,51001,46775,27856,23728,31859,56827,63035,63035,61019,63098,63066,63035,63035,61019,61147,61179,56764,54492,54492,54397,56350,54302,56763,63195,63195,58780,56318,56318,58684,61019,60987,58938,58938,50423,58874,61019,50329,50392,61050,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,61083,63131,63099,63131,61083,61083,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58842,48216,54650,61019,54874,55035,55066,53018,48890,46745,36181,36116,38229,55034,59195,57147,50938,46841,50970,55066,57147,52986,40438,38326,46648,59196,57148,52890,46649,48697,46425,46329,48409,52536,56697,56697,56857,61179,61212,44506,27897,27898,27834,27770,29849,36311,36406,38422,31730,23151,23118,46229,63099,63131,44278,14861,14861,16909,16877,35794,63099,63099,58906,48311,46231,56794,61083,61051,63099,63099,63099,63131,63131,63131,61083,63131,61083,61083,61083,63131,63099,63099,63099,63131,61083,61083,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63130,63131,63131,63131,63131,61083,61083,58971,50392,50359,58874,63035,58970,31953,21581,23694,36403,38548,38547,38546,38546,38579,42739,42740,38611,30225,28176,30256,38610,38642,40659,42739,42771,42740,46869,46870,40661,23791,21711,29747,54492,56573,56604,60892,60955,60955,63003,60955,60987,61115,61115,59036,59035,59036,56669,56382,54334,56731,63163,63163,58780,56349,56317,58620,62971,60923,58938,56890,48342,58874,60987,50329,50392,61050,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099},
-	{63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099,63131,63131,63131,63131,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58842,48216,54650,61019,56954,46744,46777,46809,48890,48857,44632,46648,48761,50905,50905,48857,42551,42519,44567,46615,46615,44567,42519,42488,46585,48601,46553,44344,42168,42168,50585,56826,58906,58906,60954,58906,58937,61179,59164,44506,31993,31993,34072,36152,36183,36342,36406,38390,44310,48407,48374,56793,63099,63131,56857,46390,48438,48470,48471,54712,61018,63067,63067,58906,58906,54682,50457,50457,58906,63099,63099,63099,63131,63131,63131,61083,61083,61083,63131,63131,63131,63099,63099,63131,61083,63131,63131,61083,63131,63131,63131,61083,63131,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,61019,52568,50455,52568,58874,58906,61019,63035,60986,52696,48535,46519,36084,31892,34035,36338,34353,36434,40659,42771,38579,30130,28050,28113,38610,38642,40658,42739,42771,42772,44821,46902,40629,23823,19695,25650,37783,37783,39832,52317,56477,56445,56445,56445,56478,54493,54493,54461,54429,54429,54556,56733,56700,58843,61019,61019,60955,58779,58747,60795,62939,60892,58812,58812,54586,58907,60987,50329,50392,61050,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099},
-	{63099,63099,63099,63131,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54650,63067,56954,44728,42647,46809,48890,48858,53018,57147,55099,50937,48857,48825,40406,38294,40342,40310,38262,40342,42456,42488,42392,40248,40216,37976,37880,37879,50553,63099,63099,63099,63099,63099,58970,61211,59164,48634,38137,38137,46617,55066,52986,40502,36406,38358,50616,63131,65179,63131,63131,61083,63131,63131,63131,63131,63131,63099,63034,63066,63067,63066,63099,52537,44087,46135,56794,63131,63099,63099,63099,63131,63131,63131,63131,63131,63099,63131,63131,63099,63099,63131,63131,63131,63131,63131,61083,61083,61083,61083,63131,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61018,48311,44086,48343,60986,63099,63067,63035,63066,63099,63099,58972,40086,31732,33907,34226,34321,36401,40691,42771,38548,30067,27987,30098,38578,38642,40691,42739,42771,42771,46869,44854,38548,25935,19727,23633,29524,29492,33590,50110,54207,54207,54207,54207,54207,54207,54239,54207,54175,54174,54619,61147,61083,60987,60987,61019,61019,61019,60988,60859,62939,60892,60796,58748,58716,60955,60987,50329,50392,61050,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63131,63131,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,63131,63099,63099,63099},
-	{63099,63099,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54650,63067,56922,44568,44535,46680,50906,48826,50906,52986,52986,55067,59196,57083,44503,40342,42390,46583,46616,46584,46489,46457,46425,44376,44344,38007,35798,35766,46328,58907,58875,58907,56859,54779,52730,54971,55003,46554,40248,40248,44505,48794,46713,40407,38327,38262,44342,54745,54744,54776,61083,63131,63131,63131,63099,61019,61019,63066,63066,63066,63067,63067,61051,52569,48279,48280,58874,63131,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63099,63099,63131,63131,63099,63099,63131,63131,63131,63131,63131,63131,63099,63099,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61019,50392,46199,50456,60987,61019,61019,63067,63035,58939,56922,54874,40213,33972,34035,32210,30225,34353,40691,42739,38547,30130,30098,30162,38578,38642,40658,42707,42708,42707,42772,42805,38548,25904,21711,25649,29556,29524,33558,46012,50141,54301,54302,56382,56382,56350,54302,54239,54175,54174,56572,60956,60955,60955,61019,61019,60988,60956,58876,60827,62939,60859,56635,54555,54554,58907,60987,50329,50393,61050,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63131,61083,63131,61083,61083,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,61083,63131,63099,63099,63099},
-	{63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54650,63068,48375,35668,33588,42134,54939,44568,38326,36245,36277,50874,59196,57083,46519,44406,46519,57050,59163,56987,54587,54555,52538,54811,56987,54907,42199,27346,33717,42135,42135,42103,39992,37880,35929,36186,36185,42489,44666,44666,40378,36153,36120,27539,25393,25393,23215,21102,21070,27375,54777,58970,61050,63131,61019,52474,52409,56697,63066,63067,58842,52504,52440,56794,58938,58938,61050,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,60986,60986,58874,54618,54585,58842,63067,60987,44278,35987,36051,38452,38515,36435,26064,23951,28111,40659,42739,38642,34514,34481,34513,36593,36593,36530,32242,32210,32242,36561,36626,34354,23504,21328,25458,29683,31668,31413,33493,35636,54554,62875,62875,62843,62843,60795,56446,54207,54207,56445,60700,60731,60859,61019,61019,58780,56477,56477,58683,62939,54618,33621,31508,35668,56762,60987,50329,50393,61050,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,61083,63131,63099,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,63131,63099,63099,63099},
-	{63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54650,61052,46199,33492,31443,42070,56956,46552,36245,34164,34164,50841,57116,55003,46519,44406,46519,57051,61244,59067,54587,54523,54618,56923,59164,61245,44343,25233,31603,38006,35926,37943,37911,35800,33849,34106,34137,42522,46810,46810,40410,36154,34041,23249,18991,18990,18990,16877,16877,18989,29456,29488,46293,63099,60987,50362,48217,54617,63099,63067,56698,46167,46103,56794,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63131,61083,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,58906,50360,50295,56697,63067,60987,40117,31762,31858,38515,38610,36530,23983,21870,26031,40659,42739,40722,36593,36593,36593,36593,36593,36530,30162,30130,30194,36561,36625,34354,23376,23249,27442,31731,31764,31604,29427,33523,56634,64987,64987,64987,64954,62907,58557,54207,54206,56445,60700,60700,60859,61019,61019,58748,56413,56413,60732,62939,52538,29428,29395,31508,56762,60987,50329,50393,61050,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61083,63131,63131,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,56794,48184,54618,61020,46199,33492,31443,42038,56892,48633,42487,44567,44566,46681,48762,48729,46584,46583,46616,50874,52954,52858,50553,52602,50489,46393,48537,48569,37973,25265,31635,38006,38006,37975,37911,35799,35896,36122,34105,42426,46650,46650,40314,36057,33944,23217,18990,18990,18989,16909,16908,18956,23181,23149,42099,63131,60987,54585,52473,56730,61019,60987,56762,52504,50424,58906,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,60986,52536,52504,56762,61019,58971,40213,31922,32017,38515,38611,36530,26063,25999,30160,38579,40659,38610,34514,34513,34545,34545,34513,34418,30099,30067,30130,34449,34513,34290,25393,25265,27442,31763,31795,31763,29459,31475,46168,52441,52441,54522,60732,60732,58620,56444,56444,58556,60669,60636,60827,61019,61019,58812,58557,58557,60764,62939,52538,31476,29427,31540,54714,60987,50329,50392,61050,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,61083,63131,63099,63099,63131,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,56794,48184,54618,61020,46199,31444,31443,41974,56731,52666,54907,57116,57147,46649,40343,40343,48793,53018,50938,42519,38422,40439,46584,48632,40118,25233,25233,25233,25232,27313,31635,38006,38006,37942,42103,52537,46361,31733,29653,29621,31636,29620,27476,25330,23217,23217,23216,31666,37971,35891,35890,35890,37970,37938,42165,46326,56792,61019,56762,54650,52506,52505,56794,61083,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63099,63099,63099,63131,60987,60860,60892,61019,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63098,61051,54714,48376,46327,42517,40597,40596,32305,30225,30225,36434,38515,36434,32241,30193,28144,26128,26128,26128,24015,24015,25968,25586,25490,25616,23951,24047,25904,23313,25265,25393,31763,31795,31763,29459,29363,29298,29299,29298,35542,50174,54270,56604,60955,60955,60764,58461,58429,58715,61019,61019,60891,58716,58716,60796,62907,52538,31476,29427,31540,54714,60987,50329,50392,61050,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63099,63131,61083,61083,63131,63131,61083,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63131,61083,61083,63131,63131,63131,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63131,56794,48184,54650,61052,46199,31444,31443,41942,56699,54682,56955,59164,57147,46649,40343,40375,48825,53019,50938,40503,38422,40439,46616,48665,40118,27313,29394,29394,29394,27346,31635,38006,38006,37942,44183,63003,54683,29524,27444,25331,25298,25298,25298,25265,21039,25265,27312,37971,44373,44341,44341,44341,44341,44341,42165,35762,50519,61019,52473,50329,50329,48281,56729,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63099,63131,60924,60764,58748,61019,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61051,54650,44120,40022,40501,42708,40660,28145,26032,28113,38483,42676,36435,28080,26000,23952,23984,23984,21936,19823,19822,21743,25425,25297,21391,19758,19822,21711,23280,23216,25393,31763,31795,31763,29459,29363,29363,31411,31379,33461,50141,52223,56636,60987,60987,60796,58461,58397,58683,61051,61051,60923,60796,60796,60828,62908,52506,31476,29427,31540,54714,60987,50329,50392,61050,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099,63131,63131,63131,63131,63131,63099,63099,63099,61083,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,61083,63131,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63131,56794,48184,54650,61052,46199,31443,31443,37781,48312,46328,52794,54971,54971,50681,48504,50553,54810,56923,54842,44568,42552,42488,40150,38006,33684,27313,29394,29426,29426,27378,31635,38006,38006,37974,42103,54683,50490,29524,27444,27379,25298,25298,27346,27346,25265,25265,25264,35891,42261,42261,42261,42229,42261,44309,42133,35762,50519,61019,52441,50329,50329,48280,56761,63131,63099,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63099,63131,60923,58684,58748,61019,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,61083,63099,63099,61051,54682,44119,40054,40501,42708,40628,28113,26000,28081,38483,40596,36435,28080,23920,21904,21904,21936,21904,21808,21807,23760,25425,25297,23407,21775,21838,23727,23280,23216,27441,31795,31795,31763,29458,27346,29426,37780,39860,41942,52411,54492,56668,58780,58812,58716,58556,58524,60763,60955,60955,60923,60859,60891,54586,46232,42007,29395,29428,31540,54714,60987,50329,50392,61050,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099,63131,63131,63131,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,48184,54650,61052,46199,31443,31475,31443,31442,31571,46553,48729,50745,54714,56666,58715,58716,58715,56699,48665,46680,44536,31602,27281,27281,27346,29394,33651,37941,35893,37973,38006,38006,37974,35862,35830,35797,29491,29491,27378,25297,25265,25265,25265,25265,25265,25264,23247,25327,27440,27504,27472,27375,27343,39987,50519,56825,61051,56762,56729,56729,56761,58938,63131,63131,59034,48760,46680,56954,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63131,63131,63131,61083,60987,58811,58843,61051,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,59034,48728,46648,59002,63131,61083,58938,54713,52697,34195,28017,25937,36243,46582,42485,27985,25905,23856,21808,19791,17743,17743,17743,19759,21488,21328,25456,42132,46294,44246,23504,19279,25456,33715,35796,35828,33844,31796,31763,27474,27410,31538,54713,61019,61019,61019,61019,56669,54366,54366,58621,60796,60796,60796,60796,60764,60859,60986,61019,46263,27347,29395,29427,29427,31508,54713,60987,50329,50392,61050,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,61083,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,48184,54650,61052,46199,31443,31475,31475,29395,31571,48601,48730,50746,56763,58747,58716,58716,58716,56699,48665,46680,46585,31603,27314,29394,29394,29393,33684,40086,40086,40086,40054,38006,38006,35862,33717,33684,33684,33684,31572,29491,29459,27346,25265,25265,25265,23216,18989,18989,23214,23247,23182,21038,18957,42068,63131,63131,63131,63131,63099,63099,63099,63131,63131,63131,54937,32244,32179,50776,61115,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63131,63099,63131,61083,61083,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61083,54971,36309,32148,54841,63131,61082,63131,63131,59067,30002,17551,17551,44437,63163,56953,23792,15534,15566,17679,17711,17743,15695,15694,17679,21360,21201,27409,54713,63099,58939,27474,21135,27409,42038,46231,42102,33844,31796,31764,27506,27442,31602,56793,63099,63099,63099,61051,56669,54334,54334,56573,60860,62908,62876,62812,60764,58811,56826,56858,44183,27347,29395,29427,29427,31508,54713,60987,50329,50392,61050,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,48184,54650,61052,46199,31444,31475,31475,31443,29427,33812,35893,35892,39957,44054,41974,41974,41942,41974,37909,35893,35861,29458,27346,27346,27345,27345,33651,40086,40086,40086,40054,40054,38006,35861,33716,33717,33717,33717,31604,29523,29523,27410,25265,25265,25265,23216,21038,21102,25294,25295,25263,21070,21069,42100,63131,63099,63099,63099,63099,63099,63099,63099,63131,63131,54937,30228,30131,50776,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,61083,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61082,54970,34293,32148,54873,63131,63131,63131,61083,59067,30002,17551,19566,44437,63131,54906,23857,17647,17680,17680,17679,17711,17679,17648,19664,23409,23281,27408,54681,60987,56826,27442,21135,29457,42038,48279,42102,33812,33811,31763,29554,27442,31602,56793,63099,60986,46295,44151,43992,39800,39800,41944,46136,46135,46136,46072,46072,39894,35733,35733,33588,27315,29395,29427,29428,31508,54713,60987,50329,50392,61050,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,48184,54650,61052,46199,31443,31475,31475,31475,27314,21071,21039,19023,23152,27313,27313,27313,27313,27313,27313,27314,27314,27314,27346,29393,33683,35795,35796,33748,33748,31667,29554,27474,27474,25394,23249,23249,23249,23248,31603,35829,35829,33748,33716,31635,25264,21071,18990,33714,50551,50551,50519,50487,50518,56825,63099,63099,63099,63099,63099,63099,63099,63131,61083,61115,54938,38453,40501,50776,61115,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61019,60924,60924,60924,60924,60924,60924,60924,60924,60924,60924,60924,60924,60987,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61082,55002,36341,32148,54905,61115,61083,63130,63131,61083,48631,44438,44438,54809,63131,59002,46551,44470,44470,23826,15535,17520,23441,25393,27441,42198,50552,46326,31570,29521,29489,23183,21071,27344,44150,48311,39989,25361,25296,27409,33748,35828,37908,58874,63099,58906,31507,27250,27282,29363,29331,29363,29363,31411,29363,29330,29331,27283,27251,27283,27283,29363,29395,29427,29428,31508,54713,60987,50329,50392,61050,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54618,61052,46199,31443,31475,29490,29522,27441,23248,23215,21167,23151,27313,27345,27345,27314,27314,27346,27346,27346,27346,27313,31473,52666,61019,48472,27442,27442,25329,21071,19023,19023,19023,19023,19023,19023,19022,29555,37974,37974,37942,37942,35861,23184,16910,16910,39988,63163,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,61083,46679,40470,38454,40566,38486,36340,40501,46615,61082,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,60987,60987,58812,58621,58589,58590,58590,58590,58590,56574,56574,56574,56574,56542,58589,58748,60987,60987,61019,63130,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,61082,44567,38390,38422,36374,38390,42454,46583,61082,63131,63131,63131,63131,63131,63099,63099,63131,63131,63131,61115,30035,15503,17488,27378,29362,29394,52601,63132,52666,23184,21039,21071,21071,21071,25264,44182,46295,39957,23151,21070,25264,35861,37909,40021,58874,63099,58874,31507,27250,27282,29363,29363,29363,29363,29363,29363,29331,29363,27346,27378,27378,27410,27410,27442,29459,29428,31539,54713,60987,50329,50392,61050,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,61083,61083,63131,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54618,61052,46199,31443,31475,33779,33939,33907,33906,33906,31826,23247,23184,29425,33651,33651,31570,27345,33651,35763,35763,35731,37843,56825,63131,50553,29522,27474,27409,21103,19055,19055,19055,19055,19055,19055,21071,29555,37974,37974,37974,37973,35893,21135,16909,16909,37939,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,59035,36309,28017,26002,26002,26002,25969,25969,36212,59002,63099,63099,63099,63099,63099,63099,63099,63099,63099,63130,63131,61019,58685,58621,58621,56542,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,56541,56573,56573,58875,63130,63130,63131,63099,63099,63099,63099,63099,63099,63099,63099,59003,36213,27955,28052,28052,27955,30002,38228,59002,63131,63131,63099,63099,63099,63099,63099,63099,63131,63131,59034,32051,17520,19504,27409,29361,29393,50553,61052,50618,23216,21071,21103,21103,21103,25296,44182,46295,39957,23151,21103,25297,35861,37909,39989,58874,63099,58906,39924,35699,37780,37780,35700,37813,37813,37813,35700,29362,29362,29650,31857,31889,29842,29810,31826,29523,29428,31539,54713,60987,50329,50392,61050,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63131,63099,63099,63131,63131,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56794,48184,54618,61052,46199,31475,31475,31666,31761,31762,33874,31889,31826,21199,19022,33650,50455,50455,44213,23214,48407,60986,60986,60986,60986,63067,63099,50585,29555,29555,29523,27442,27442,27474,27474,27474,29555,31668,31635,35829,37974,37942,31635,29522,29554,39988,42133,42133,52631,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61050,52824,50744,44599,26002,25970,40405,48695,52760,61050,63099,63099,63099,63099,63099,63099,63099,63099,63099,61051,61051,60956,58621,58590,58622,56542,56542,58590,58590,58590,58590,56542,58590,58590,58590,58590,56542,56542,56542,56541,58812,61051,61051,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,54809,46615,28084,28019,44535,50744,54841,61050,63099,63099,63099,63099,63099,63099,63099,63099,63130,63130,61083,52728,46551,48567,50519,50487,50487,37940,31666,29586,25329,25329,25329,25329,25329,27409,33715,33716,33716,31635,31635,33684,35829,35829,37908,58874,63099,63067,61018,61018,61018,61018,54681,58874,60987,60987,52536,29393,31474,31698,31859,31826,29713,29713,29713,29491,29428,31539,54713,60987,50329,50392,61050,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54618,61052,46231,31475,31475,25296,25327,25327,29649,31857,31825,21199,19022,33681,50519,50519,44245,21165,50519,65146,63066,63098,63098,63098,63099,50585,29555,29555,29555,31667,31667,31667,31667,31667,33780,38006,37974,37974,37973,35893,23248,19023,23183,54712,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63098,63130,63131,52857,26001,27985,48696,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58780,58685,58653,58622,58590,58590,56542,56542,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,56542,58653,58685,58716,60987,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,54938,32181,30067,54873,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,61051,29585,17006,19086,25361,27442,27442,27442,27442,27410,25361,27441,29587,33749,35797,35797,35797,33748,35861,58906,63099,63099,63099,63131,63131,61083,56793,60955,63067,63068,52568,31473,31538,33715,33812,29585,23214,23214,23214,27378,29428,31540,54681,60987,50297,50424,61050,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,46136,54618,61052,46232,31476,31475,25264,25263,23214,29617,31857,31825,21199,19022,31569,44278,44278,40085,23214,48439,60955,60859,60859,60891,60956,60956,54714,42166,35827,31602,31634,31667,31667,31667,31667,33780,37974,37973,37973,37973,35893,25296,21070,25231,54680,63130,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,52857,25969,27985,48696,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61051,58717,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,56542,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,58621,60987,63131,63131,63099,63099,63099,63099,63099,63099,63099,63131,54938,32181,30035,54873,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61051,31666,19054,21134,27408,27441,27442,27442,27410,27409,29489,35827,35828,35797,35796,35796,35796,35860,40053,56826,61019,60987,60860,60860,60923,61083,56826,54745,52600,52601,44214,29424,31537,33682,33779,29585,23214,23214,23182,27346,29428,31540,54681,60987,50297,50424,61050,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54618,61052,46232,31476,31443,33618,39956,37908,42101,42165,42133,39924,37812,37876,29618,27505,29618,35957,44279,50393,56477,56477,56446,56382,56382,58747,63131,56857,52599,48472,31698,33746,40053,40053,31666,27473,27441,33747,46294,48439,48439,48407,48439,60986,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56953,40372,40372,52825,63131,63099,63099,63099,63099,63099,63099,63099,61051,60988,60956,60924,58685,58590,58590,58590,58590,58590,58590,58590,58590,56542,56542,56542,58590,58590,58590,58590,58590,58590,56542,56542,56542,56542,56542,56573,58812,60924,60955,63099,63098,63098,63099,63099,63099,63099,63099,59002,46583,42422,56922,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,52632,46391,46391,48471,48471,48471,50487,50487,48439,52632,58970,52600,39958,42102,48471,52664,56858,58939,58748,58716,58621,56318,56286,56540,61115,61115,50745,38259,36212,36179,31986,34067,36179,36212,36147,33811,33747,31667,29459,29428,31540,54681,60987,50297,50424,61050,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54618,61052,46232,31476,31443,44086,58875,58875,56730,52505,54521,56602,56602,54585,40085,35924,35925,42263,42263,48346,56510,56510,56415,56255,56254,58715,63130,63131,63163,59003,31698,33746,44278,44278,29585,21134,21134,31633,48406,56793,63163,63163,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61082,61083,61083,61083,63131,63099,63099,63099,63099,63099,63099,63099,61051,56669,56574,56574,56574,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,56542,58590,58590,58590,58590,58590,56542,56446,56382,56508,61019,63130,63098,63099,63099,63099,63099,63099,63099,63131,61082,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63163,58938,39990,46327,61083,63163,63163,61051,58684,58621,58526,56255,56223,56509,61115,61115,52985,38645,38677,38677,38677,38677,38676,36628,38548,40214,38006,37974,31540,29427,31539,54681,60987,50297,50424,61050,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54618,61052,46264,33588,31507,44118,56763,56762,56698,54553,54553,54553,56602,54585,52665,50650,46457,44311,42264,46330,52476,52475,50396,48283,48283,52634,59002,56955,61083,58971,33714,33746,44278,42198,29586,21134,21134,33681,50486,56793,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61051,56637,56574,56574,56574,56574,58622,58590,58590,58590,58590,58590,58590,58590,58590,58590,56542,58590,58590,58590,58590,56542,58590,58590,58590,58590,58590,56542,56414,56382,56508,61019,63130,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61051,56858,54778,52633,39958,44214,61050,59066,54970,54938,50586,50555,50491,50330,50299,52474,58939,58971,50841,38645,36628,36628,36628,36628,38644,38612,40533,42326,42199,40119,33685,31539,33652,54713,60987,50297,50424,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54618,61051,48409,37846,39926,39958,42070,42070,50424,56665,54585,56634,56666,56666,52730,52762,50650,44344,44344,44312,44375,40374,36341,28244,28276,36309,42358,42326,56889,61050,44245,35826,29521,27473,25361,23248,27408,48406,58905,61018,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60923,58780,58781,58654,58622,58622,58622,58622,58622,58590,58590,58590,58590,58590,58590,58590,58590,58590,56542,56542,56542,56542,56542,56542,58590,58590,58590,58590,58590,58590,56446,56414,56509,58876,60955,60987,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58971,44150,37877,39990,48407,52600,59034,42551,34292,32276,32277,32309,32339,36499,38547,46550,52474,54491,46520,38644,36628,36628,36628,38645,44533,44342,44408,44441,46489,46457,40054,37942,40022,56794,60955,50297,50392,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54618,61051,50457,39958,42006,37877,35764,35764,48343,56698,56698,56698,58746,56730,54778,52762,50682,42328,42328,42327,38325,36372,30291,26291,26291,34292,40277,40246,56857,63163,63163,46359,27443,27443,29524,29556,39989,61050,63131,63131,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61051,58748,58590,58622,58622,58622,58622,58622,58622,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,58590,58621,58621,58715,61019,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61018,54778,52666,39958,35765,42102,61051,63131,61115,38455,28147,28180,28212,28244,30322,34545,36562,44534,52442,54458,46519,38644,36628,36628,36628,38645,42421,42197,42263,46488,46553,48537,42167,40022,42102,56826,60955,50297,50392,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54618,61020,50457,39958,42006,42038,42102,42102,52537,58810,58810,58810,58810,58842,54810,52730,48633,42359,40342,36308,30226,28210,26194,24178,26226,38388,46487,46455,56890,63131,63131,48472,29556,29588,29556,29524,39989,61050,63131,63131,63131,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61051,58749,58622,58622,58622,58622,56574,56574,58621,58590,56542,58622,58590,58589,58589,58590,58590,58590,58590,58590,58590,58590,58590,56542,58590,58590,58590,58590,56541,56573,58589,58590,58590,58590,58590,58589,58684,61019,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,52632,31538,33587,35733,35733,42102,61050,63131,61083,46648,40469,38421,28148,26068,28210,36561,36561,40531,44406,44406,42517,38612,38644,40660,40661,40661,38420,34163,38228,44406,48536,48505,42167,40022,42102,56826,60955,50297,50392,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,56794,48184,54618,61020,50457,39959,42038,50457,60955,60955,60955,63035,63035,63035,60987,60987,48537,46391,42359,40342,38325,32275,26161,26161,24113,19952,21967,46614,61083,61051,63099,63099,63131,54777,48407,48407,48407,48375,52600,61083,63099,63099,63099,63099,63099,61083,61115,61115,59067,61115,61115,61019,58843,58843,61019,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61051,58716,58622,58622,58622,58622,56605,56828,56860,56796,58716,58716,58716,58716,58716,58653,58621,58622,58622,58622,58590,58621,58653,58716,58716,58716,58716,58716,56795,56859,58844,58621,58590,58622,56574,58621,58684,61019,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63067,60987,60987,60987,60987,59035,59067,59067,60987,60955,61018,63099,63099,63099,63131,56858,48343,48375,48407,48375,52568,61051,63131,63131,61083,61114,54970,28019,17681,21872,36530,36561,36529,34417,34417,36498,40660,40660,42677,42676,42676,36403,30130,36243,44406,48504,50521,44183,40022,42103,56826,60955,50297,50392,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63131,63131,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63131,56794,48184,54618,61020,48409,39958,39958,50456,63035,63035,63035,63035,63035,63035,63035,60987,48472,42262,40278,40405,38357,34292,32243,32243,28146,24017,26001,48663,63131,63099,63099,63099,63099,63131,63131,63130,63131,63131,63131,63131,63099,63099,63099,63099,63099,61115,61179,61211,59163,59163,59132,56795,56539,58620,60923,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,58717,58590,58622,58622,56574,56637,59068,59164,61083,60891,62971,62971,62971,62971,60796,58621,58621,58621,58621,58621,58652,60796,62939,62971,62971,62971,60923,61115,61211,59068,56637,58590,58622,56574,58621,58684,61019,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60923,60828,60828,60828,58780,59067,59195,59131,58812,58716,60922,63131,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,63099,63099,63099,63131,57018,28019,19729,25937,40596,40627,40627,36466,34418,36467,42645,42677,44661,44692,44692,36403,30130,36211,44406,48504,50521,42103,37942,40022,56826,60955,50297,50392,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63131,63131,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54618,61020,44183,31508,31507,48311,63035,63035,63035,63035,63035,63035,63035,60987,46456,42263,42390,46743,44695,46648,46425,48473,44439,40438,40406,54841,63131,63099,63099,63099,63099,63131,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,60987,61115,61211,61211,61212,59164,59100,56795,56603,58652,60955,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61019,60956,60956,58748,58684,58684,58684,58684,56700,59004,59068,58971,62939,62971,60860,60828,58780,60860,60827,60828,58716,58717,60795,60827,60796,60796,60828,60891,62971,60923,59003,59067,58972,58716,58685,58684,58684,58685,58716,60956,60988,61019,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63067,60892,60796,60828,60828,58811,59035,59131,59099,58875,58811,58875,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,57018,38517,32340,38485,55001,55033,55001,50872,48856,50746,54651,54619,54681,56824,54808,42548,36370,40404,46486,50552,50489,33685,29492,33620,54714,60955,50297,50392,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,61083,61083,61083,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54618,61020,44151,29427,29427,46263,63035,63035,63035,63035,63035,60987,60987,61019,46487,40278,42454,46808,46808,48729,50522,50490,46489,44535,44535,54841,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63067,60891,60923,60987,60956,60956,60956,60924,60987,61051,61019,58780,58716,60923,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099,58716,58525,56509,60827,62971,62971,62971,62971,60892,56605,56573,58684,60891,62971,58685,56447,56446,58716,62971,62939,58717,58717,62971,62939,58653,56446,56445,60795,62971,62939,58684,56573,58652,60859,62939,62971,62971,60923,60860,56541,56510,56635,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63067,60859,60796,60796,60796,58844,59035,59067,59099,59131,59099,59067,59067,60987,58875,61019,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,57018,40598,36501,42646,59131,61179,59131,57083,55035,56860,58558,58558,60732,62907,60922,46677,40498,42484,48534,50520,50489,33652,27347,31507,54713,60955,50297,50392,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61083,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54650,61051,44151,29396,29427,46263,63035,63035,63035,63035,60987,52857,46710,46710,40596,40596,42614,46648,46648,46553,46361,46361,44312,42296,42295,52729,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63067,60892,60828,60828,60828,60828,60828,60828,61019,61147,61083,58716,58621,60859,63131,63131,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,58685,58462,56477,60827,63003,63003,62971,62971,60892,56541,56478,58620,60892,62971,58653,56447,56447,58716,62971,60891,58653,58653,62939,62971,58653,56382,56414,58715,62971,60892,58621,56478,58620,60891,62971,62971,62971,63003,60860,56478,56414,56604,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,61051,58748,60764,60764,60796,58844,59131,59163,59163,59163,59163,59100,61084,60956,58811,60987,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,59034,42455,36246,42391,54874,54875,54875,52827,52795,52699,52539,52539,52571,54682,54714,44596,40530,44532,48534,52568,50489,33652,27348,31540,54713,60955,50297,50392,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54650,61051,44151,29427,29427,44151,58842,58842,60955,63035,61019,44661,32369,34418,38611,40724,42614,38038,35926,37974,37942,37942,35797,31540,31540,48407,63131,63099,63099,63131,63099,61019,61019,61018,63099,63099,63099,63099,63099,63099,63131,60987,60860,60828,60828,60828,60828,60828,60828,60891,60923,60891,58779,58748,58875,61019,61019,63099,63131,63099,63099,63099,63099,63099,63099,61051,63099,63131,63131,63131,58685,58462,58525,60828,62971,62971,62971,62971,60891,58684,56572,58684,60796,60796,56542,56447,56447,58715,62971,60891,58684,58716,62939,62971,58621,56383,56414,58652,58780,58780,58653,56573,58683,60891,60923,60923,60923,60923,60860,56478,56415,56604,63131,63131,63131,63099,63099,63099,63131,63131,63131,63099,63099,63099,61019,61019,61019,58811,58747,60796,60828,60860,58907,58940,58940,60987,60987,60923,60860,60860,60859,60987,63099,63067,63099,63099,63099,61051,61051,61051,61051,63099,63099,63099,63131,58971,35765,29460,31573,40022,40022,40022,40022,40022,40213,38485,40534,38294,35957,35989,36307,38515,42516,44406,48407,46296,33684,29492,31604,54713,60955,50297,50392,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54650,61051,46328,35765,35797,37845,37877,39957,54682,60955,60954,44629,32369,34418,38612,40725,42582,37974,35862,35862,35894,35894,33717,29428,29427,48407,63131,63099,63099,63099,63099,59035,59035,59002,61018,63099,60987,60891,60955,61051,61051,60955,60860,60828,60828,60828,60828,60828,60828,60828,60828,60828,61019,61115,58908,58589,58588,60923,63131,63131,63131,63131,63131,63099,60923,60859,60986,63130,63131,63131,58685,58462,58493,58684,60796,60764,60764,60764,60764,60859,62939,60796,58525,58526,56447,56447,56447,58747,62971,62971,60923,60923,62971,62971,58621,56383,56383,56446,56446,56508,58780,60923,60891,60796,58716,58716,58716,58716,58685,56414,56382,56604,61051,63131,63099,60891,60891,61019,63131,63131,63131,63099,63098,61019,58684,58621,56732,59067,61115,60956,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60859,61019,60987,60860,60923,61115,61147,61146,59066,59034,61083,63131,63099,63099,63131,56923,33653,29396,31541,37911,37942,37910,37910,37910,38165,36499,38548,36245,33876,33909,32243,34483,36372,34004,33780,33717,35894,35958,40086,56826,60955,50297,50392,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54650,61051,48472,38006,38006,35830,35765,37812,54650,60956,60955,44629,34418,34418,38612,40725,42582,37974,35862,37942,42134,42134,40021,37845,37877,52600,63099,63099,63035,60891,60955,61179,61211,61147,61019,63099,60987,60860,60891,60923,60924,60892,60860,60828,60828,60828,60828,60828,60828,60828,60828,60859,61083,61179,58908,58493,58493,58843,63131,63131,63131,63131,63130,63099,60891,60859,60954,63131,63131,63131,58684,58461,58493,58621,58653,58653,58653,58653,58652,60891,62971,60796,56477,56478,56446,56446,56446,58715,63003,63003,63002,63003,63003,62971,58653,56414,56414,56446,56445,56508,60827,62971,60892,58653,58621,58621,58621,58653,58589,56414,56382,56604,63099,63131,63067,60859,60859,61019,63131,63131,63131,61083,63130,60987,58589,56445,56668,59131,61179,60987,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60860,60860,60828,60828,58875,61179,61179,61179,61179,61211,61115,63099,63131,63131,63131,58971,42038,37813,37877,42102,42134,42102,37910,37910,38165,36499,38548,36277,31828,31861,32243,34483,36372,33972,31700,31637,38007,38103,40151,56826,60955,50297,50392,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54650,61051,48440,37974,37974,35830,35829,37877,46329,52570,50521,40500,34418,36466,38516,40566,40342,31603,29459,39989,58970,61018,61050,61018,61050,61051,63099,63098,62971,60828,60860,61083,61115,61051,60987,60987,60923,60860,60860,60860,60860,60860,60828,60828,60859,60860,60828,60828,60828,60828,60828,60828,61019,61083,58939,58747,58748,60955,60955,60859,60923,63130,63130,63099,61019,60986,61018,63131,63131,63131,60859,58684,58684,58653,58653,58653,58621,58653,58653,60732,60765,58684,58684,58716,58716,58715,58715,58716,58685,58685,58685,58685,58685,58684,58716,58716,58716,58716,58684,58684,60764,60764,58717,58653,58621,58621,58621,58621,58621,56605,56605,58748,63099,63099,63099,60987,60987,63099,63131,63099,60987,58843,60891,60955,58779,58748,58811,61051,61051,60923,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60860,58843,58874,59003,59035,59003,59035,59067,61019,60892,60955,61051,63131,63131,61050,59002,59002,59002,59003,52666,35732,33620,33939,36499,38580,38325,33877,35926,34228,36436,38357,33941,33716,31669,37974,38071,40119,56826,60955,50297,50392,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,56794,48184,54650,61020,46232,31508,31540,33716,35861,35861,35861,35861,35893,36340,36563,38580,38388,40373,38133,27346,27282,37876,61051,63131,63131,63131,63131,63131,63131,63099,60923,60828,60891,61115,61147,61115,61115,61115,61019,60828,60828,60828,60828,60828,60828,60891,63003,62971,60860,60828,60828,60828,60828,60828,60828,60828,60860,60924,60924,60924,58716,58493,56571,61050,63130,63131,63099,63099,63099,63099,63131,63131,60923,60828,60828,58590,56478,58589,58621,58621,58621,58589,58558,58621,60828,62907,62939,62970,62971,60732,56446,56446,56414,56414,56414,56445,58747,63003,62971,62939,60891,60828,58653,58621,58621,58621,58621,58621,58558,58526,56510,58717,58717,58812,63099,63131,63099,63131,63131,63099,63131,63099,58780,56445,58493,60796,60923,60923,60891,60860,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60955,61115,59099,59099,59099,59099,59099,59131,61019,60828,58811,61019,61083,63130,61083,61115,61115,61115,61084,52666,31507,29395,31794,36531,38580,42487,46361,46361,40119,35925,35893,33749,33717,33717,31604,29524,31604,54713,60955,50297,50392,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,56794,48184,54618,61020,44152,29364,29396,33685,35862,35861,35861,35862,35893,36372,36596,38580,40436,40373,38134,27346,27250,37876,61051,63131,63131,63131,63131,63131,63131,63099,60955,60891,60955,61115,61115,61115,61115,61147,61051,60828,60828,60828,60828,60828,60828,62971,63003,63003,60860,60828,60828,60828,60828,60828,60796,60796,60797,58748,58748,58716,58621,58461,56571,61050,63130,63131,63099,63131,63131,63131,63131,63099,58812,58684,58717,56542,56478,58589,58621,58621,58621,58589,58557,58621,60828,60860,62939,62970,62971,58716,56446,56446,56446,56415,56414,56413,60795,63003,63003,62971,60892,60860,58653,58589,58589,58621,58590,58590,56446,56414,56446,58622,58622,58748,63099,63099,63099,63131,63131,63099,63099,63099,58780,56445,58461,58653,60764,60764,60796,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60955,61179,61179,61179,61179,61179,61179,61211,58971,58843,58875,61051,61083,61083,61083,63163,63163,63131,61083,52666,31506,29363,31762,38580,38580,46648,50522,50522,42103,35765,35765,35765,35765,33717,29459,27347,29491,54681,60955,50297,50392,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54650,61020,46199,31444,31475,33685,35862,35861,35861,35862,35894,38326,38486,40470,38262,40246,40118,33683,33618,42101,61051,63131,63131,63131,63131,63099,60987,60955,61019,61051,61051,60987,60955,60955,60956,60924,60892,60828,60828,60828,60828,60828,60859,62971,63003,60923,60828,60828,60828,60828,60828,60828,60796,60796,60765,58717,58717,58717,58652,58651,58746,63099,63131,63131,63099,63099,63099,63099,63131,63099,60859,58684,58716,58589,56510,58590,58621,58621,58621,60764,60764,60764,60796,60796,60827,62970,62970,60764,56477,56478,56478,56478,56478,56477,60827,63003,63003,60860,60796,60796,58716,58716,58716,58621,58590,58590,56446,56414,56446,56573,58621,58747,63099,63099,63099,63099,63099,63099,63099,63099,58875,56635,56635,58684,60764,60764,60797,60796,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60859,60859,60828,60828,60860,60924,60924,60924,60924,60924,60924,58876,58939,61083,59035,61019,60987,60987,61083,63131,63131,63131,61083,54778,39924,37811,35988,38421,40469,44472,46393,46361,40023,35797,35797,33749,33717,33717,31507,29427,31539,54713,60955,50297,50392,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56826,48184,54650,63067,52473,43990,41974,33619,29458,29458,33716,37910,37910,33813,33813,33781,31636,31572,35764,56825,58970,61018,63131,63131,63131,63131,63131,60987,60796,60827,61019,61147,61083,58843,60860,60828,60828,60828,60828,60828,60828,60860,62971,62971,62971,60859,60860,60860,60828,60828,60828,60828,60828,60828,60796,60796,60765,58717,58717,58716,58747,60987,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,60986,60922,60923,58621,56510,58590,58621,58621,58684,62939,62971,62907,58685,58653,60795,62970,62970,60828,58653,58653,58653,58653,58654,58653,60859,63003,63003,60796,58621,58652,60891,63003,60923,58653,58590,58558,56446,56414,56477,58811,58843,58907,61051,63099,63099,63099,63099,63099,63099,63099,61051,61082,61051,60828,58716,58716,60797,60797,60828,60828,60828,60828,60828,60828,60828,60828,60828,60891,63003,62971,60859,60828,60828,60828,60828,60828,60828,60828,60828,60828,58939,61179,61147,60923,60796,58811,61051,63131,63131,61083,61083,61083,61050,61050,52665,35861,35829,35829,35829,35829,35797,35797,33749,29522,27441,29458,39861,44086,46166,56794,60956,50329,50392,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,48184,56698,63067,56666,50328,50328,31474,23088,23087,31539,39991,37910,35797,33685,33685,31572,29460,33684,58938,63131,63130,63130,63131,63131,63131,63131,60955,60796,60796,60954,59034,58971,60860,60828,60828,60828,60828,60828,60828,60828,60859,63003,63003,62971,60860,60828,60828,60828,60828,60828,60828,60796,60764,60796,60796,58748,60796,60796,58747,58810,61019,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63131,63131,61051,58685,56510,58590,58590,58589,58620,60859,62939,60859,58653,58653,58716,62939,62939,60796,58653,58653,58653,58653,58653,58653,60828,62971,60923,60796,58621,58653,60860,60924,60892,58621,56510,56510,56446,58462,56541,61051,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63130,63099,60859,58748,58780,58780,58780,60828,60796,60796,60796,60828,60828,60828,60828,60827,62971,63035,63035,62939,60828,60828,60828,60828,60828,60828,60828,58843,58875,58939,59003,59003,58843,60796,58779,61050,63131,63131,61083,61083,63131,63131,63131,54681,35765,35765,35765,35765,35797,35797,35797,33749,25296,23151,23151,42005,52440,52472,58875,60956,50329,50392,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,50264,56666,61020,54585,46167,46135,31474,25168,25168,31539,37878,35830,33685,31540,31540,29460,29428,33619,58937,63130,63130,63130,63131,63131,63131,63131,60955,60796,60828,61019,61179,61115,60892,60828,60828,60828,60828,60828,60828,60828,60859,63003,63003,62971,60860,60828,60828,60828,60828,60828,58685,58525,56477,58779,61019,61019,63066,63066,61018,61018,63099,63131,63131,63131,63131,63099,63099,63099,63099,63131,63131,63131,63099,61051,58843,58812,58748,56478,56414,56477,58685,58716,58684,58653,58653,58653,58685,58685,58685,58653,58653,60764,60764,58685,58653,58685,58685,58685,58653,58621,58621,58653,58685,58653,56510,56446,56478,56510,56477,56603,61050,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,61019,61019,61019,61019,61019,60987,58621,58525,58589,60796,60828,60828,60828,60827,62971,63035,63035,62939,60828,60828,60828,60828,60828,60827,60828,61051,61147,61179,59131,61147,58875,60796,58779,61051,63131,63131,63131,61083,63131,63131,63131,52633,33652,31571,31571,31571,31604,31604,31572,33652,27313,23151,25199,39893,48280,48280,58842,60955,50329,50392,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,58843,50264,56698,61020,46199,31411,31443,37812,48343,50391,39893,25233,25201,29393,31538,31538,27314,23121,29425,56825,63130,63130,63130,63130,63130,63131,63131,60955,60828,60828,61019,61179,61147,60891,60828,60828,60828,60828,60828,60828,60828,60828,60860,60860,60859,60827,60828,60828,60828,60828,60828,58653,58462,56445,58779,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61019,56510,56415,56446,58653,58653,58653,58653,58653,58653,58653,58653,58653,58654,58685,60891,62971,60765,58653,58653,58621,58621,58621,58621,58621,58622,58622,56542,56478,56447,56509,58811,60955,60987,61082,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61019,58621,58493,58589,60796,60828,60828,60828,60828,60891,62971,62971,60860,60828,60828,60828,60828,60828,60828,60828,59035,61179,61179,61179,61179,60924,60764,58811,61051,63163,63131,63131,61083,63131,63131,63131,48440,23120,23120,27312,29457,27376,25231,23119,27280,39925,44118,42005,33587,29427,31507,54649,60987,50329,50392,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,50264,56698,61020,44118,27250,27282,44118,63067,63067,46295,23088,23088,44149,58970,56890,33684,21008,27312,54712,63131,63130,63130,63130,63130,63131,63131,60955,60828,60828,60923,60987,60955,60860,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,58621,58462,56413,58779,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61019,56509,56414,56446,56510,58558,58590,58621,58653,58653,58653,58653,58653,58654,58653,60828,60860,58717,58653,58653,58621,58621,58621,58621,58622,56542,56510,56478,56478,56446,56508,60987,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61019,58621,58493,58588,60764,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60924,60956,60956,60956,60956,60828,60765,58811,61051,61115,61083,63131,63131,63131,61083,63131,48408,20974,20942,37875,56891,54778,33650,23054,29327,52570,60956,56730,31539,27282,29394,54649,60987,50329,50392,61050,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,61051,56795,48249,54650,61020,44151,27283,27283,35700,44183,42102,33619,25169,29361,48374,63164,61084,37877,23056,27280,54712,63131,63131,63130,63131,63131,61083,61051,60987,58843,58843,60860,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60796,60796,58684,58588,56540,58811,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61051,58779,56700,56700,56509,56446,56446,58622,58653,58653,58653,58654,58622,58622,58654,58653,58621,58653,58653,58654,56606,56606,58622,58622,58622,56478,56414,56446,56604,56700,58779,61019,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61019,58684,58652,58684,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,58780,58812,58811,58874,61051,61083,61083,61083,63131,61083,61083,61115,48407,23022,27152,42037,61116,61116,37876,23119,27279,39957,44182,42070,31475,27314,29394,54649,60987,50329,50392,59003,61082,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,54778,31635,27443,31413,52284,56446,43962,29332,27283,25201,23120,23120,31538,44214,46294,42101,40020,40052,44214,42101,42133,37875,35763,44213,61083,61083,61019,58652,58621,58843,61083,61051,60892,60860,60860,60860,60828,60828,60828,60828,60828,60828,60828,60860,60860,60859,60828,58621,58589,58589,58589,58557,58557,58716,60892,60859,60955,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,61083,61051,56541,56414,56446,58590,58622,56574,56574,56574,58622,58622,58622,58622,58622,58622,58622,58622,56574,56574,56574,56542,56542,56478,56414,56445,58843,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61019,60891,60955,60892,58621,58557,58653,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,58939,59099,59067,58716,58556,58715,61051,61083,58970,39987,35762,39988,42069,44150,42101,40085,40053,46294,48407,48407,29424,23086,25135,31348,33365,35573,56730,60987,50298,41721,43865,50328,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63131,50585,16943,12751,25075,52062,56191,45915,29332,27316,25202,23088,21040,37940,61147,63163,35827,16877,18957,50519,63163,59035,27345,12620,29488,61083,61115,60988,56445,56382,56763,61115,61083,60924,60860,60860,60860,60860,60828,60828,60828,60828,60828,60828,60860,60923,60955,60892,58590,56446,56446,56446,56446,56446,58652,60859,60859,60955,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61051,58780,58716,56605,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56446,56414,56414,56541,56636,58716,60955,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61019,60891,60892,60860,58525,58430,58589,58780,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,61019,59131,59068,56540,56317,56508,61051,61115,54810,23117,14732,37843,61083,61116,42166,21038,21038,46294,63132,58972,31505,21005,25072,35351,39449,41784,58844,60988,50299,37369,37336,43927,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61019,58971,50553,21073,20977,29204,52094,56223,45915,29333,29332,25202,23120,23119,37940,59035,59035,37908,21038,23118,50487,61083,58971,31537,18925,33681,61051,61083,60988,56572,56508,56731,58940,60955,60892,60860,60860,60860,60828,60828,60828,60828,60828,60828,60860,60860,60924,60923,60892,58589,58494,56446,56446,56446,56445,58715,60923,60922,60987,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,61051,60892,56478,56446,56446,56478,56478,56446,56447,56447,56447,56447,56447,56447,56447,56447,56415,56414,56382,54334,56699,61051,61051,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60955,60955,60891,56508,56413,56541,58780,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60828,60796,58812,58876,58844,56603,56508,56635,61019,61051,54810,27343,21005,39955,61019,61052,44214,23118,23118,46326,59036,56859,33554,25135,29201,39480,41529,41785,54684,58844,50267,39480,39448,46008,60987,61019,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58938,31636,25330,29427,50170,54331,54299,56286,56255,45915,29333,29332,37877,50519,50519,42166,31635,33683,44214,52567,52568,54521,54490,54521,54713,54744,56826,58812,58716,58780,60955,60987,58717,58557,58557,58716,60796,60796,60733,58653,58653,58621,58621,58684,60828,62908,60828,58685,58653,58621,58526,58494,58494,58652,58811,58843,60987,63131,63131,63131,63131,63099,63099,63099,63099,63099,56953,46581,44532,54839,63130,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60955,56604,56573,56509,56478,56478,56510,56541,56541,56541,56509,56509,56509,56509,56478,56446,56477,54429,54429,56762,63131,63131,61083,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61051,61019,58875,58811,58748,58653,58653,58653,58653,60828,60892,60891,60828,58748,58717,58653,58653,58653,58716,60828,58717,58653,58589,58557,56477,56540,58875,61019,58907,58684,56636,58875,56793,54744,56730,58684,58652,54618,50487,48439,42070,35764,37781,48122,50203,52251,54301,54301,48060,35511,33462,41817,54397,54397,50108,45819,45818,54490,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63131,56858,19057,10607,20977,54428,60637,60573,56318,56287,45915,29333,27283,44182,63131,63131,44279,21103,23152,46327,63131,63067,56538,52217,54361,60986,63163,61051,58684,58589,58716,60987,61019,58716,58493,58525,58620,58684,58685,58558,56478,56478,56478,56478,58589,60828,62907,60828,58589,58526,58526,58526,58526,58494,58748,61083,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,50775,27950,25870,44468,61114,63131,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63098,61019,61019,58844,58716,58748,60891,60987,60987,60987,60987,60987,60987,60923,58716,58716,58811,60987,60987,61019,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,60892,56478,56446,56446,56414,58716,60955,63003,58780,58685,58590,56446,56446,56446,58653,58749,58653,56510,56478,58494,58494,56508,58907,61083,60988,58589,58556,60923,63131,63131,60892,58493,58492,60827,63068,61020,39958,25201,29363,54365,58526,56446,58494,56479,48060,27060,24980,39704,58622,58622,52093,41435,41434,50233,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,56858,21104,12686,23024,52411,56573,56542,54365,52317,43961,29363,29363,44182,61051,61051,44247,23151,23152,44214,60987,58939,54553,54393,54457,60986,63131,61051,58779,58684,58779,60923,60924,58811,56699,56699,58652,58621,58621,58558,56478,56478,56478,56478,58589,60764,60796,60765,58589,58526,58558,56509,56509,56540,58779,61050,63099,63099,63099,63099,63099,63099,63099,63099,61082,61082,61083,48726,27950,27918,42419,59098,59066,61082,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61083,60956,58780,58780,60987,63099,63099,63099,63099,63099,63099,63035,60860,60859,60955,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63130,60923,58588,56541,56509,56414,56573,60860,60892,58749,58685,58590,56446,56446,56446,56605,58717,58621,56510,56478,58621,58716,56699,58875,58908,58844,58684,56635,60954,63131,63131,60923,58619,58620,58779,58907,58907,39958,25233,31412,54333,58494,56478,56510,56542,48123,29140,27059,39703,56542,56542,50044,41466,41466,50265,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,61018,46359,42167,37974,27347,27283,31540,46521,48633,44407,38037,38005,42230,48504,46392,27409,23152,23152,27377,31571,33651,54713,61019,61019,61083,63131,61083,61051,61051,60923,58525,58493,60891,61083,61083,58684,58525,58557,58589,58589,58589,58589,58589,58621,58653,58654,58621,58558,58526,58557,58811,60955,60955,61018,61050,63131,63099,63099,63099,63099,63099,63099,61082,56952,44468,42419,36273,27950,27950,34129,40371,42419,50678,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61019,60955,60955,61019,63099,63067,63035,63035,63099,63099,63067,60955,60954,60986,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63130,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,61019,61019,60892,56446,56446,56541,58685,58685,58685,58653,56541,56541,58589,58653,58654,56542,56478,56477,58812,63131,61051,58684,56445,56572,60987,63066,63098,63131,63131,63099,61051,61051,48375,33618,33619,29426,25233,31444,54365,56478,54524,50618,48601,50459,48155,48123,43897,37590,35542,41879,52410,52409,56730,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61116,48602,14830,8526,14959,42647,44855,44662,44469,44438,42326,42295,40086,21070,21071,23152,23152,21072,25232,54712,63163,63131,63131,63131,63131,63131,61083,60956,58493,58461,60891,61083,61083,58716,58556,58588,58653,58653,58653,58653,58653,58653,58653,58654,58622,58526,58526,58557,60955,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,61114,54871,38193,34096,32079,27950,27950,29968,34064,32016,44436,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61051,61051,63099,63099,60987,60891,60923,63067,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63130,60955,58748,58748,58748,58748,58748,60860,58844,60987,63099,63099,60891,60828,58780,58716,58716,58716,58875,63099,63099,63099,63099,63099,63131,63131,60924,56446,56414,56510,58685,58685,58685,58685,58685,58685,58653,58653,58653,56541,56573,56572,60923,63131,61019,58652,56381,56539,61019,63099,63099,63131,63131,63131,63131,63131,44214,25232,25233,25233,25233,31444,54365,56478,54588,46647,44630,52666,56606,58654,43962,27091,25075,39925,61083,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63131,50617,17007,12782,17135,40630,42806,44693,44468,42389,42326,44344,40086,21071,21038,21071,23152,23152,25264,54712,63131,63099,63099,63099,63099,63099,63099,60987,58684,58652,60955,63130,63131,61019,60987,60923,58653,58653,58653,58653,58653,58653,58621,58622,58685,58716,58716,58747,60987,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61050,58969,59001,46613,25934,27918,40371,54904,54872,58969,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60987,60860,60891,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58780,56318,56318,56350,56350,56350,56382,56381,58779,61083,61051,58588,56350,56350,56350,56382,56382,58715,63131,63131,63099,63099,63099,63099,63131,60987,58716,56668,58716,58717,58653,58653,58685,58685,58685,58653,58622,56573,56669,58813,58844,60987,63099,63099,60827,58652,58747,61051,63099,63099,63099,63099,63099,63131,63131,44214,25233,25234,25234,25202,31412,54365,56446,54525,50649,48632,52603,56574,56574,43993,27186,27186,39957,61083,61083,61083,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,61018,52664,52632,50647,44692,42675,42580,42452,42421,42326,42264,40055,27345,25263,25296,23184,23153,27313,54712,63131,63099,63099,63099,63099,63099,63099,63099,63003,60923,63067,63131,63131,63131,63131,60987,58653,58653,58653,58653,58653,58558,56478,56446,58748,61051,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,48694,25933,27918,44500,61114,63130,63099,63098,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60923,60796,60827,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58780,56319,56350,54461,54461,54429,54429,54429,56700,58940,58876,56477,56350,56382,56414,56414,56414,58748,63131,63131,63099,63099,63099,63099,63099,63099,63099,61083,61019,58653,58494,58558,58685,58717,58685,56574,56510,56541,58748,60988,61051,63099,63099,63099,63035,60923,60987,63099,63099,63099,63099,63099,63099,63099,63131,44215,25201,27283,37622,41752,43801,54238,56319,56414,56541,56573,56541,56542,56542,52475,52600,54680,56857,61083,61083,61083,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63163,63163,59066,44691,42674,42579,44500,44469,42295,42200,42104,42199,52826,52858,40054,23121,27281,54712,63131,63099,63099,63099,63099,63099,63099,63099,60987,60955,63067,63131,63099,63099,63099,60987,56605,58653,58653,58653,58653,56509,56445,56445,58747,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,48662,29998,29966,44468,61114,63130,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60923,60764,60795,63067,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58780,56318,54397,59004,59004,56765,56702,56702,56574,56478,56478,56446,56446,56446,56510,58622,56510,58748,63131,63131,63099,63099,63099,63099,63099,63099,63099,63131,61019,58653,56446,56478,58685,58717,58685,56541,56509,56541,58748,60988,61083,63098,63099,63099,63035,60955,60987,61050,63099,63099,63099,63099,63099,63099,63131,44183,27218,35509,52157,56319,56287,56286,56287,56382,58526,58526,56446,56510,56542,54651,61083,63163,63163,63163,63163,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61051,56731,54588,54651,61051,63131,57017,50773,48725,48599,48377,48313,46170,46106,46075,48378,59132,59196,48504,37876,39956,56825,63099,63099,63099,63099,63099,63099,63099,63099,63067,61019,63099,63131,63099,63099,63099,61019,58811,58780,58812,58812,58812,58748,56667,56667,58875,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,59001,52791,52759,56920,61082,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60891,60764,60795,63067,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58780,56319,54429,59068,59068,56797,56734,56734,54557,56477,56478,56446,56446,56446,56510,56574,56510,58748,63131,63131,63099,63099,63099,63099,63099,63099,63099,63131,61019,58811,56668,56667,58811,58843,58811,58748,58748,58779,58843,61019,63099,63098,63099,63099,63067,61019,61019,63098,63099,63099,63099,63099,63099,63099,63131,52568,39956,44086,52315,54397,56414,56350,54302,56413,58557,58557,56477,56541,56605,54650,61083,61115,56827,54619,54619,60954,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61019,45884,41500,43770,58938,63162,56984,58937,60954,56700,50077,47901,47901,50013,50045,50267,54745,54777,54777,63099,63131,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60987,60923,60955,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58780,56319,54429,58972,58972,56797,56734,56734,56828,58972,56860,56542,56478,56478,56510,56542,56478,58748,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,59003,50617,52602,54588,56445,56414,56477,58653,58685,54492,50617,50713,48695,59034,61084,48218,41562,41562,54586,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63131,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61019,45852,41468,43738,58907,61083,56953,58906,60955,56700,50108,47932,47933,50014,52094,48155,44310,44341,50583,63130,63130,63130,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63131,63131,63131,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,61083,61083,63131,63131,61083,61083,63099,63099,63099,63099,63099,63099,63099,63131,61083,61083,61083,61083,61083,61083,61083,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58780,54238,54429,58940,58940,56797,56734,56765,56988,61179,59068,56605,56478,56478,56478,56510,56478,58748,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58970,48569,48600,52602,52380,52348,54460,58685,60733,52444,44471,40532,42549,59035,59005,46106,41530,43579,54586,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63131,63131,63099,63131,61083,63131,63131,63131,61083,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61019,60892,58748,54364,52252,52252,52220,52252,52221,56349,56382,54397,54554,54523,54333,52094,52095,48218,42547,42578,50742,61082,63130,63130,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,50649,29682,27602,27602,27602,27602,27602,27602,27601,27601,27601,27602,27602,27602,27601,27602,27602,25522,31763,58938,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,54842,33843,29682,29682,29714,29682,29682,33843,56890,63099,63099,63099,63099,63099,63131,56922,33843,27634,27634,27634,27634,27634,29682,50583,63131,63131,63099,63099,63099,63099,63099,63099,63099,58875,56540,56604,56733,56701,56701,56734,56734,56861,59004,56893,56574,56478,56478,56541,56700,56700,58875,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58938,44376,46520,44344,27442,27346,33524,54365,56446,46075,27506,23440,37846,54397,54366,52221,52156,52156,54333,54397,54459,58907,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63131,61083,61083,63131,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63098,63099,63130,63130,60987,60701,58589,58653,58685,56509,47868,47773,49822,54015,56095,54237,54618,54650,54429,54143,54143,48250,42611,40626,50805,63130,63130,63130,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63163,46423,10796,8716,8748,8748,8748,8748,8748,8748,8748,8748,8748,8748,8748,8748,6668,6668,6668,14989,56857,63099,63099,63099,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,50649,12941,8748,8780,8780,8780,8748,17070,54777,63099,63099,63099,63099,63099,63131,54809,15022,8748,8749,8781,8780,8781,8748,44277,63163,63131,63131,63099,63099,63099,63099,63099,63131,61083,61051,58876,54398,54334,54526,56734,56702,56702,56702,56702,56574,56478,56478,56636,61051,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58938,44343,44408,42230,16974,14829,23089,52189,56319,43931,18992,16911,33398,52031,52030,54270,58558,58558,54207,52062,50139,58875,63130,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099,63131,61083,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61019,61019,58844,58621,58589,58653,58684,54429,47964,45788,47837,54078,54110,52252,52634,52634,52412,52126,52094,48250,42643,40626,50805,63131,63131,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,46423,10796,8748,8781,8780,8780,8780,8780,8780,8780,8780,8780,8780,8780,8780,8780,8748,6700,17070,56857,63099,63099,63099,63099,61083,61083,63099,63099,61051,61051,61051,61051,63099,63099,63099,63099,61051,61051,48601,15022,8781,8812,8812,8813,8781,17102,54777,63099,63099,63099,63099,61050,61050,52729,15055,8781,8781,8781,8781,8781,10829,42261,61115,61083,61083,63099,63099,63099,63099,63099,63099,63099,61083,58876,54397,54334,54558,56734,56702,56670,56702,56670,56542,56478,56478,56636,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61083,56891,44344,44376,40118,16942,14830,23089,48061,52222,43898,23089,18992,35478,54110,52061,56349,58558,58558,54206,52063,52188,56764,58939,61019,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,63131,63131,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63130,60987,50140,45852,50076,58589,58621,56667,52666,48600,42359,40280,42327,44408,44440,42455,42614,42614,42519,42392,42392,42454,40628,38611,42517,46425,48473,58938,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,46423,10829,10829,10893,13198,13231,13134,8813,8780,8781,8780,8780,8780,8780,8780,8780,8877,10926,19216,56858,63099,63099,63131,54809,29682,27602,27602,27602,27602,27569,33810,56922,63131,63099,63099,61051,33843,23344,21263,10861,10893,13198,15343,15343,13134,19279,54809,63131,63099,63099,63131,40052,23246,19151,10829,8813,13133,13230,13198,10893,10829,19216,25489,27537,54712,63131,63099,63099,63099,63099,63099,63099,63099,61019,58843,58811,56637,54494,54494,56670,56734,56734,56542,56415,56414,56668,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,54777,50553,48505,40151,40119,35926,27474,27442,27411,33494,35511,37656,48155,48155,52284,56414,56414,56446,58558,58558,54239,52095,52094,47933,45820,52346,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,61083,63131,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,61083,63131},
-	{63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63131,60987,45852,43549,47868,58589,58621,54682,48695,42677,38645,38644,38644,38644,38644,36596,36564,36564,36596,36596,38644,38612,36596,38644,36213,29589,31669,54745,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,46423,12909,10861,10957,17617,17682,17553,8845,8780,8749,8781,8780,8780,8780,8780,6764,10990,13071,21361,56890,63099,63099,63131,50616,12909,8781,8781,8781,8781,8748,19117,54842,63131,63131,63099,59003,23376,8715,8748,8781,10925,17552,21873,21841,15408,21456,54841,63131,63131,63131,61083,31666,6506,6571,8716,8812,17520,23922,21777,10958,10830,8749,8716,12844,50551,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,56637,56383,54398,54654,56798,56766,56511,54335,54335,56668,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,48472,40054,38039,38039,38039,38039,38039,38071,35895,29396,29332,37655,56478,56510,56510,56510,56510,56510,58558,58558,54239,52127,52063,45694,43549,48090,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63131,61083,63131,63099},
-	{63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,60987,48058,45786,48026,56604,56604,50490,44470,40533,38613,38644,38612,40629,40597,38549,38549,38549,38580,38580,38581,38581,38581,38581,36182,31669,31669,54713,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,46423,16974,14894,13005,17585,17649,17521,8909,8844,8813,10861,12846,12846,12846,12846,10830,10990,11023,21329,56858,63099,63099,63131,50616,12974,8813,8845,6796,8845,8781,19150,56890,63131,63131,63130,61051,25457,10764,10796,8812,10925,17552,19793,19793,15408,21488,54841,63131,63131,63131,61083,31667,10603,8620,8748,8844,17519,21873,21777,10989,8813,10797,12813,14893,50551,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,58748,56509,56541,54589,54622,54590,54462,56477,54429,56731,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,48472,38039,38071,38039,38039,38039,38039,38039,35894,27378,25234,35574,56478,56478,56478,56478,56478,54397,48220,48188,50172,52220,50140,45851,43738,50233,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,63131,63131,63131,63131,63131,63099,63099},
-	{63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,61051,60986,58906,60986,61019,58875,39831,31509,31796,38549,38644,42646,52634,54651,46329,35893,33877,33941,36054,36054,36054,36054,36022,33846,31637,31669,54713,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,54715,43993,43962,35926,23890,21842,21842,19665,19665,19665,29780,43994,46042,46042,46043,39897,13007,6765,17135,56858,63099,63099,63131,50649,12974,10893,13229,15439,13263,8781,19150,58905,63131,63099,63131,61051,46168,39735,33685,21553,19569,15568,13551,13551,13456,23665,54873,63130,63130,63130,61083,48313,39735,35702,19408,15375,17552,17616,17584,15406,17360,35735,41849,43928,56762,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61051,61019,60987,52349,50014,50013,54427,60987,60955,61019,61082,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,46425,38039,38071,33845,31700,33781,38039,38039,38038,35893,35862,42009,56478,56478,54334,52125,52125,37624,23090,23089,44118,60987,60954,58874,58874,60986,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,61083,61083,61083,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63131,61083,63131,61083,63131,61083,61083,61083,63131,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,58939,35637,31380,29619,38549,38644,44663,56636,58621,46138,33654,31638,33750,35894,35894,35894,35894,35830,33718,31637,33717,54713,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63130,58844,54429,54397,44281,26003,23987,23986,23986,23986,23986,36119,56446,56414,56414,56415,50269,15024,4684,17102,56858,63099,63099,63131,50648,12974,10925,15406,19695,17456,8781,19151,56890,63099,63099,63131,61051,58621,58430,48316,28021,26035,15664,13550,13551,13520,23761,54904,63130,63130,63130,61051,58652,58430,50300,23698,17584,17584,17584,17584,17584,21617,48251,56415,58493,60955,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61051,52348,49949,49949,54459,61083,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,46425,38039,38071,33781,29587,31700,38039,38039,38071,38071,38039,46234,56510,56511,54302,50012,50044,35542,18928,18927,44149,63131,63131,63099,63099,63099,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63131,61083,63131,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63131,61083,61083,63131,63099,63131,63131,63131,63131,63131,63131,61083},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58907,35637,29332,31700,38517,38645,42615,48346,48218,37879,33718,33750,33814,35926,35926,35894,35893,35862,33750,33686,33717,54713,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60987,58810,58811,46552,26035,23986,23986,23986,23986,23954,38230,56636,56636,56668,56668,52508,25331,17008,25329,56858,63099,63099,63131,50649,12974,8845,13134,15278,13134,8781,19150,56858,63099,63131,63131,63131,58779,58684,48474,28051,23986,19792,17744,17744,17713,27922,54904,63130,63099,63099,63099,58811,58684,50523,23858,17712,17712,17712,17712,17680,21713,48441,58716,58715,61018,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,54587,52315,52315,54618,61083,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,48472,38007,38039,33813,29587,31700,38039,38071,38039,38071,38039,42105,46106,46107,43994,41849,41849,33493,21008,21007,44181,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,61083,61083,63131,63099,63099,63099,63099,63131,63131,63131,63131},
-	{63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,58939,37782,31540,33876,40534,40662,42583,40119,40055,38039,38007,38039,38039,38039,38039,38038,42232,46361,35862,31638,33717,54713,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63099,63131,63131,50809,26035,23986,23986,23986,23986,21906,42454,61083,61083,61083,61083,61019,52412,50205,50331,61019,63099,63099,63131,50649,12974,8813,8813,8813,8813,10828,21198,56890,63131,63099,63099,63099,63099,63099,52857,26035,23954,21938,21938,21938,21906,30067,56953,63131,63099,63099,63099,63099,63099,54938,28115,21938,21938,21938,21938,21906,25970,52793,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61051,61051,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,61083,46392,35893,35926,35926,35893,35893,38039,38071,38071,38039,40087,37943,31573,31540,31573,33654,33654,33621,31541,31540,48375,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63131,61083,61083,63131,63099,63099,63131,63131,63131,63099,63099,63131},
-	{63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,58939,39927,33685,33909,40502,40662,42615,40151,40119,40119,40087,38071,38071,38039,38039,42232,50586,46361,35798,31638,33717,54713,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56952,48725,50743,61050,63099,63099,63099,63099,63099,63099,63131,50809,26035,23986,23986,23986,23986,21906,42454,63131,63131,63099,63131,61019,56541,56382,54428,61019,63099,63099,63131,50649,12974,10829,10829,8781,8781,10796,21197,54842,63131,63099,63099,63099,63099,63099,52857,26035,23986,21938,21906,21906,21906,30067,56953,63131,63131,63099,63099,63099,63099,54938,28115,21906,23954,21906,21938,21906,25970,52792,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,54809,42100,40052,40052,40052,40053,35860,33748,33780,33813,33845,38006,38039,38039,38039,38039,40087,37943,31572,31540,33653,35766,33686,33653,33654,33653,48408,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63131,63131,63099,63099,63131,63131,63131,63131,63099,63131,63131,61083,63131,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58971,44183,40021,40150,40310,40439,42423,38070,38007,38007,38007,38039,38039,35926,38006,44280,48473,40023,33685,33685,33717,54713,63131,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,48726,28046,34160,58969,63099,63099,63099,63099,63099,63099,63131,50809,26035,23986,23986,23986,23986,21874,42454,63131,63131,63099,63099,61051,58779,58683,56699,61019,63099,63099,63131,54778,37782,35670,35670,35638,35638,35637,37845,58939,63099,63099,63099,63099,63099,63099,52857,26035,23986,23986,21906,21906,21906,30067,56953,63131,63131,63099,63099,63099,63099,56986,28115,21938,23986,21938,21906,21906,25970,52792,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61115,52696,29519,27440,27472,29521,29489,29522,31636,31635,29586,31698,33876,38038,38071,40087,38007,37975,37911,31605,31572,33653,35734,33686,35765,39958,39958,52568,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,61083,63131,63099,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63098,61083,61051,61051,54746,35828,33780,33780,33748,33749,33781,35862,35894,33781,31636,33716,35829,35798,35766,33686,33685,33717,54713,63131,63099,63099,63099,61050,54712,52632,54712,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,48726,28014,34159,58969,63131,63099,63099,63099,63099,63099,63131,50809,26034,23986,23986,23986,23986,21874,42486,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63131,60924,56446,56415,58463,58463,58463,56446,56571,60987,63099,63099,63099,63099,63099,63099,52857,26035,23986,23986,21906,21906,21906,30067,56953,63131,63131,63099,63099,63099,63099,56986,28115,21938,23986,21938,21906,21906,25970,52792,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61050,56825,54776,48502,35825,33745,33746,31634,29554,29521,29520,29520,29584,29616,31697,38101,40183,40151,35862,35798,35798,35766,35766,33685,33621,33589,42038,58939,61019,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63131,61083,63131,63131,63099,63099,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63131,56794,35796,33716,33716,33716,33716,33749,35830,35862,33749,33684,33717,33717,33685,33686,33686,33685,33685,54713,63131,63099,63099,63131,58970,33680,25294,33681,61018,63099,63099,63099,63099,63099,63130,61082,59001,56985,48694,40370,42419,54904,59033,61050,63099,63099,63099,63099,63131,50809,26034,23986,23986,21938,21906,21906,42486,63131,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63131,58908,56509,56478,56478,56478,56477,56508,56634,60987,63099,63099,63099,63099,63099,63099,52857,26035,23986,21938,21906,21906,21906,30067,56953,63131,63131,63099,63099,63099,63099,56986,28115,21938,23986,21938,21938,21906,25970,52793,63099,63098,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63099,63099,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58938,37873,33679,37905,44277,44277,35859,23247,23248,25327,25389,27438,27438,27534,29615,40149,42263,40183,35830,33750,33750,35798,35798,35734,33621,33589,42038,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63131,63131,63099,63131,63131,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63131,56794,33684,31604,33652,31604,31604,33749,35862,35862,35829,31636,31604,33685,35765,35765,33685,31605,31636,54713,63131,63099,56857,52632,50552,29520,23214,31633,61018,63099,63099,63099,63099,63131,61146,50775,36177,32112,34192,38386,36273,34225,34225,48598,63130,63099,63099,63099,63131,50809,26034,21938,23986,21938,21906,21906,42486,63131,61051,52762,52762,54810,61051,63131,63099,63099,63099,63099,63131,56891,44280,42232,42232,42232,42264,42231,46391,59003,61083,63099,63099,63099,63099,63099,52857,26035,23986,21938,21906,21906,21906,30067,56953,63131,63131,63099,63099,63099,63099,57018,28115,21938,23986,21938,21938,21906,25970,52793,63099,63098,63099,63099,63099,63099,63099,63099,63131,56890,52729,52761,52762,52729,52729,52729,52729,52729,58970,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,58970,54777,54777,54777,52729,52729,54777,63098,63131,59003,52729,52729,52729,52729,54777,61051,63131,63131,63131,63099,63099,63099,63099,63099,63099,63131,58905,35792,31566,35825,44277,44277,35859,21134,21134,25327,29583,31599,29487,27470,27503,38037,42231,40151,35830,33750,33750,33718,35766,33654,31541,31509,42006,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63131,63099,63099,63131,63131,63099,63099,63131},
-	{63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,35734,35702,35702,33654,33685,39990,44215,44216,35829,27378,27346,39926,48312,46265,33716,21168,23248,50551,63131,63131,42132,25326,25327,25295,23214,33681,61018,63099,63099,63099,63099,63131,61114,52823,40307,38322,34192,25934,28014,36273,38322,48630,63130,63131,63131,63099,63131,50809,23986,21938,23986,23986,21906,21906,42454,63131,54809,19248,12974,19183,52697,63131,63131,63131,63099,63099,63131,52697,17102,12941,12973,12973,12973,12941,23310,54842,63131,63099,63099,63099,63099,63099,52857,26035,23986,21938,21906,21906,21906,30067,56953,63131,63131,63099,63099,63099,63099,57018,28115,21938,23986,21938,21938,21906,25970,52793,63099,63098,63099,63099,63099,63099,63099,63099,63131,38068,15022,15022,15022,15022,15022,15022,12974,14989,46357,63131,63131,63099,63099,63099,63099,63099,63099,63099,63131,46390,17069,15022,15022,15022,15021,25391,58937,65179,48567,17101,15021,15021,17036,25358,56890,63131,63131,63131,63099,63099,63099,63099,63099,63099,63131,58905,35792,31566,35825,44309,44309,35859,21102,19022,33746,54777,56858,42133,21134,23215,33684,35798,35797,35798,35766,33718,33653,31573,33621,33622,33622,42038,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63099,63099,63131,63099,63099,63131,63131,63099,63099,63131},
-	{63131,63131,63131,63131,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56826,37814,35703,35703,35734,35734,42038,46296,46296,37877,27346,27345,42038,52570,52570,33748,19088,21167,50551,63131,63131,40052,23214,23246,23247,23247,33681,61018,63099,63099,63099,63099,63099,61083,63098,61050,61082,46646,28014,32112,54872,59034,61050,63131,63131,63131,63099,63131,50809,23986,21938,21938,23986,21906,21906,42486,63163,52793,13006,6733,12941,52696,63131,63131,63131,63131,61083,63131,50649,15022,10893,10893,10894,10894,10861,21262,56890,63131,63099,63099,63099,63099,63099,52889,26035,23986,21938,21906,21906,21906,30067,56953,63131,63131,63099,63099,63099,63099,57018,28115,23986,23986,21938,21938,21906,25970,52793,63099,63099,63099,63099,63099,63099,63099,63099,63131,33907,8780,8781,8781,8781,8781,8781,8781,8748,42229,63163,63131,63131,63099,63099,63099,63099,63099,63099,63131,44310,10764,8748,8748,8781,8748,21230,58970,63164,46488,10861,8780,8780,8780,19117,54810,63131,63131,63131,63099,63099,63099,63099,63099,63099,63131,58905,35792,31598,35825,44309,46357,35859,19054,19021,35859,61116,61116,46359,21071,21103,31572,35766,33718,35766,35766,35766,33653,33653,35702,35734,35734,42071,61050,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63131},
-	{63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61083,54779,39959,37815,35735,42007,42071,39990,39958,39958,35764,31538,31538,39958,44151,44151,35796,29521,29553,50519,54745,54777,40052,29487,29520,29520,27440,35826,61018,63099,63099,63099,63099,63099,63131,63099,63099,63131,48726,30063,36177,56953,63131,63131,63099,63099,63099,63099,63131,50809,23986,21938,21906,21906,21906,21906,29906,35955,31794,10893,8813,12941,52696,63131,63131,63131,63099,42197,27505,25424,10861,10893,10990,15279,15311,11118,21391,58938,63099,63099,63099,63099,63099,63099,52889,26067,21938,23954,21906,21906,21906,30067,56953,63131,63099,63099,63099,63099,63099,57018,28115,23986,23986,23986,21938,21906,25970,52793,63099,63099,63099,63099,63099,63099,63099,63099,63131,33907,8780,10829,8781,8781,8781,8781,8781,8748,25457,33876,40117,61018,63099,63099,63099,63099,63099,63099,63131,44278,10764,8748,8781,8781,10829,14989,29617,29649,23408,8813,8780,8781,8781,19150,56857,63099,63099,63131,63099,63099,63099,63099,63099,63099,63131,56857,33744,29550,35857,44309,46357,35859,19022,19021,31666,50650,52698,42134,21071,21103,29491,35797,37878,33717,31572,31572,37877,39958,37878,39926,39959,46231,61018,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63131,61083,63131,63099,63099,63131,63099,63099,63099,63131},
-	{63131,63131,63131,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58970,37972,27473,27442,37847,54650,58940,42070,27313,27313,35731,44182,46230,35732,23152,23151,44182,58938,58970,46358,23213,25262,46358,56890,56857,56857,56857,56889,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,59002,54872,56889,61050,63099,63099,63099,63099,63099,63099,63131,50809,23986,21906,21906,21906,21906,23954,15246,8649,8682,8780,8813,12973,52696,63131,63131,63130,61083,27537,4457,6570,8683,8780,13134,21874,21938,15536,21552,58970,63099,63099,63099,63099,63099,63099,52889,26067,23986,23954,21906,21906,21906,30067,56953,63131,63099,63099,63099,63099,63099,56986,28115,23986,23986,21938,21906,21906,25970,52793,63099,63099,63099,63099,63099,63099,63099,63099,63131,33907,8780,8781,8781,8781,8781,8781,8781,8781,8716,6635,19150,58938,63099,63099,63099,63099,63099,63099,63131,44310,10764,8716,8781,8813,10861,8748,4392,2312,4457,8812,8812,8813,8781,19150,56857,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,56858,33744,29551,35857,44309,46357,35859,19022,19022,21070,23183,23215,21135,19022,19022,23183,40021,46328,33651,23184,27377,54681,60955,52537,52505,56731,54617,58873,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63131},
-	{63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58938,23246,14860,18989,35734,54682,63036,44118,27313,27313,35731,46230,46262,35731,23119,21071,46262,63131,63132,46326,19020,19020,48438,63163,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,50809,23986,21906,21906,21906,21906,23954,15311,8716,10764,8780,8813,12973,48568,61083,61051,63131,61083,31666,10635,8651,6699,6764,13197,21906,21938,15568,23665,58970,63099,63099,63099,63099,63099,63099,52889,26067,23986,23954,21906,21906,21906,30067,56953,63131,63099,63099,63099,63099,63099,56986,28115,23986,23954,21906,21906,21906,25970,52793,63099,63099,63099,63099,63099,63099,63099,63131,63163,33907,8780,10829,12941,12941,12941,10861,8781,8781,8749,6668,19183,58938,63099,63099,63099,63099,63099,61019,61051,42230,8748,8748,8812,8813,10861,10796,8490,6377,4489,6796,8844,8844,6764,17133,56889,63131,63099,63131,63099,63099,63099,63099,63099,63099,63099,56858,33745,29519,35825,44309,46358,35859,19022,18990,18990,19022,19022,19022,19022,19022,23151,42069,48376,31571,23184,27345,56762,63067,54617,54585,58811,54584,58841,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131},
-	{63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58938,35794,29519,29521,39959,54682,63035,44118,27313,27313,35731,46230,46230,35731,23119,21071,42037,56761,54713,46294,31536,31504,52599,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,50809,23986,21906,21906,21906,19825,21873,15311,8780,10828,10829,8813,10861,21295,23376,31730,58970,63099,52506,46009,37847,15343,13295,15471,21906,21906,21874,30068,58970,63099,63099,63099,63099,63099,63099,52889,26067,21938,23954,21906,21906,21906,30067,56953,63131,63099,63099,63099,63099,63099,56986,28116,23954,23954,21906,21906,21906,25970,52793,63099,63099,63099,63099,63099,63099,58970,52697,52729,27666,8781,12877,38005,52569,50521,33844,8781,8781,8781,8748,19183,58938,63099,63099,63099,63099,60987,48087,45943,31539,10861,10861,10893,10893,8844,14958,37654,39735,27539,17360,17392,17392,17327,25584,56922,63131,63099,63131,63099,63099,63099,63099,63099,63099,63131,56858,27439,23214,27375,29585,31634,27440,16974,16941,21102,25296,25328,21135,19022,19022,25264,44182,48375,31571,23184,27377,56762,63067,52537,54585,58843,56729,58873,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61018,61050,56891,48378,54714,63067,44150,27313,27345,35764,46230,46230,35731,23119,23119,37779,48278,48246,46198,46198,46198,56793,63130,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,50809,23986,21906,21906,21874,15599,15567,13198,8780,8781,8781,8813,10829,8748,8716,21198,58938,63099,58780,58556,46297,19698,15568,17649,21906,21906,21906,32148,59002,63099,63099,63099,63099,63099,63099,52889,26067,21938,21906,21906,21906,21906,28019,56921,63131,63099,63099,63099,63099,63099,56986,28084,21906,23954,23954,21906,21906,25970,52793,63099,63099,63099,63099,63099,63131,44310,15022,15022,10893,8813,12877,46327,63004,60956,42199,8781,8781,8781,8749,19183,58938,63099,63099,63099,63099,58875,41718,41558,27282,10893,10893,10893,10893,8813,19088,52188,54334,35960,21650,21650,19602,21585,29842,56954,63099,63099,63131,63099,63099,63099,63099,63099,63099,63131,54777,23214,16909,16909,16941,16941,16941,16941,16941,29489,44181,42134,29521,19022,19022,29490,46295,48375,31571,23185,27377,56762,60987,50424,54617,61051,63099,63130,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63163,58971,48378,54714,63067,44150,27313,29393,35764,46230,46230,35763,23151,23151,37812,48279,48246,46198,46198,46166,56761,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,50809,23986,21906,21906,21874,17647,17647,15246,14925,14926,14926,14926,14926,14894,14861,25328,58938,63131,61019,60987,50777,26035,21906,21906,21906,21906,21906,32148,59002,63099,63099,63099,63099,63099,63099,52889,26067,21938,21906,21906,21906,21906,28019,56953,63131,63099,63099,63099,63099,63099,56986,28084,23954,23954,21906,21906,21906,25970,52793,63099,63099,63099,63099,63099,63131,42262,10828,10861,10861,10861,12877,46359,60988,60988,42167,8781,8781,8781,8749,19183,58938,63099,63099,63099,63099,58907,46038,43894,29522,10925,10957,10925,10925,10924,17103,50330,56540,44280,34036,34036,34004,34004,40212,56954,63099,63099,63131,63099,63099,63099,63099,63099,63099,63131,54777,23214,16909,16941,16941,16941,16910,16910,16909,29489,44214,44214,31602,21071,19023,29490,46295,48375,31571,23152,27345,56762,60955,50392,54617,63099,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61050,52599,48471,48407,44152,54714,63067,44150,27346,27346,29458,33651,33651,29522,27377,27377,33683,37876,37877,44150,46198,46166,56761,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,50809,23954,21906,21906,21906,21874,21874,31925,46074,46074,46074,46042,46042,46042,46042,48217,60987,63099,63099,63099,52857,26035,21939,21939,21906,21906,21906,32148,59002,63099,63099,63099,63099,63099,63099,52889,26067,21938,21906,21906,21906,21906,28019,56953,63131,63099,63099,63099,63099,63099,56986,28084,23954,23954,21906,21906,21906,25970,52793,63099,63099,63099,63099,63099,63131,42262,10828,10861,10861,10861,10829,27570,35925,35925,25458,8781,8781,8781,8749,19183,58938,63099,63099,63099,63099,63099,60986,61019,42422,17487,15471,15439,15439,15439,21584,54809,63098,61050,61050,61050,61018,61018,61050,61083,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,58970,48439,46326,44214,29523,27443,27443,27443,27411,33684,39990,37909,27409,21071,21071,29491,42103,42103,29491,23152,27345,56762,60955,50392,46263,48407,48439,56825,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58938,27343,18893,20973,35668,54682,63067,44150,27346,27346,23152,21071,21071,27345,31603,31603,31603,29555,31603,44118,46167,46166,56762,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,50809,23954,21906,21906,21906,21906,21906,36087,56446,56447,56447,56447,56446,56447,56447,56573,61019,63099,63099,63099,52857,26035,23987,23955,21906,21906,21906,32148,59002,63099,63099,63099,63099,63099,63099,52889,26035,21907,21906,21906,21906,21906,28019,56953,63131,63131,63099,63099,63099,63099,56986,28083,21906,21938,21906,21906,21906,25970,54841,63099,63099,63099,63099,63099,63131,42262,10861,10861,10861,8813,8813,8749,8748,8748,8749,8781,8781,8781,8749,19183,58906,63099,63099,63099,63099,63099,63099,63131,42486,17583,15567,15535,17583,15535,23696,54841,63131,63130,63130,63099,63099,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61084,54811,35862,35798,35830,35830,35830,33717,29524,27410,23184,21104,21103,29523,37910,35830,27410,23152,27345,54714,60987,50393,31539,18927,18958,46294,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58938,25231,18860,18861,35636,54682,63067,44150,27346,27345,23152,21071,21071,27345,31603,31603,31603,31603,33683,44118,48215,46166,52536,52632,54680,61019,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,50809,23954,21906,21906,21906,21906,21906,36182,56668,58684,58684,56636,56636,56636,56636,56699,61050,63099,63099,63099,52857,26035,23954,21906,21906,21906,21906,32148,59002,63099,63099,63099,63099,63099,63099,52889,26035,21907,21906,21906,21906,21906,28019,56953,63131,63131,63099,63099,63099,63099,56986,28083,21906,21906,21906,21906,21906,25970,54841,63099,63099,63099,63099,63099,63131,40215,10893,10893,10893,8813,8813,8781,8781,8781,8749,8749,8749,8781,8749,21231,58906,63099,63099,63099,63099,63099,63099,63131,44567,19729,19760,19729,19729,19729,25874,56889,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61083,54811,35829,33717,33750,33750,33718,31636,29491,27378,25265,25265,29491,31603,31604,31571,25297,23184,27345,54714,60987,50393,31507,16814,16846,46294,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61018,46293,42100,42037,42040,54714,63067,46295,35700,33652,33619,31571,31571,31538,25265,25264,33651,42005,42005,46134,46134,46134,50423,54712,56793,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,50809,23954,21906,21906,21906,21906,21906,38325,61050,61083,61051,61083,61083,61051,61051,61051,63099,63099,63099,63099,52857,26035,21906,21906,21906,21906,21906,32148,59002,63099,63099,63099,63099,63099,63099,52889,26035,21907,21906,21906,21906,21906,28019,56921,63131,63131,63099,63099,63099,63099,56986,28083,21906,21906,21906,21906,21906,25970,54841,63099,63099,63099,63099,63099,63131,42359,15248,15248,13006,10860,10828,8684,6603,14894,37783,39864,39863,42070,42198,46358,61018,63099,63099,63099,63099,63099,63099,63131,44600,23954,21906,21906,23922,21874,28019,56921,63130,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58938,46326,44246,35862,25298,25266,25233,23152,23152,21072,23185,33684,29458,23152,23152,23184,23184,27345,54713,60987,50360,44086,39988,42068,54712,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63163,60987,50394,54714,63067,50456,41974,42006,39958,39958,39958,37845,33555,31475,39893,46231,48247,46102,46070,46070,54616,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,50809,23954,21906,21906,21906,21906,21906,40405,63130,61083,63099,63131,63131,63131,61083,63131,63099,63099,63099,63099,52857,26035,21906,21906,21906,21906,21906,32148,59002,63099,63099,63099,63099,63099,63099,52889,26035,21906,21906,21906,21906,19858,28019,56921,63131,63131,63099,63099,63099,63099,56986,28083,21906,21906,21906,21906,21906,25970,54841,63099,63099,63131,63099,63099,63131,42391,15344,17425,13070,10860,10828,6570,4458,18927,54397,56479,56510,58843,63131,63131,63099,63099,63099,63099,63099,63099,63099,63131,44600,23954,21906,21906,21874,21874,28019,56921,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,44279,23152,23153,23152,21072,21071,21071,23152,33684,29458,23152,23184,23184,23152,27345,54713,60987,50360,54617,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61050,61051,58907,50394,54682,63067,50456,42006,39958,39958,39958,39958,42006,41941,39861,44054,46231,48246,46102,46070,46038,54584,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,50841,23954,21906,21906,21906,21907,21874,40405,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,52857,26035,21906,21906,21906,21906,21906,32148,59002,63099,63099,63099,63099,63099,63099,52889,26035,21906,21906,21906,21906,19858,28019,56921,63131,63131,63099,63099,63099,63099,56986,28083,21906,21906,21906,21906,21906,25970,54841,63099,63130,63131,63099,63099,63131,42359,15247,15247,10958,10860,10828,12844,14892,25232,52412,56541,56572,58875,63131,63131,63131,63131,63099,63099,63099,63099,63099,63131,44600,23922,21906,21906,21874,21874,28019,56921,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63130,63163,44278,23152,23152,23152,21103,21071,23119,25232,35765,29458,23152,23152,23152,23152,27313,54713,60987,50360,52569,58971,61018,61051,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58970,35859,29553,29522,39894,54682,63067,44150,31506,29458,29458,29458,29458,39828,48247,48247,46198,46198,46198,52536,54680,54680,58906,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,50841,23954,21906,21906,21906,21907,21874,40405,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,52857,26035,21906,21906,21906,21906,21874,32116,59002,63099,63099,63099,63099,63099,63099,52889,23987,21906,21906,21906,21906,19858,28019,56921,63131,63131,63099,63099,63099,63099,56986,28083,21906,21906,21906,21906,21906,25970,54841,63131,63130,63131,63099,63099,63131,42294,10893,10893,10893,10861,14989,44374,54809,56825,60987,60987,60987,63066,63098,63131,63131,63131,63099,63099,63099,63099,63099,63131,44600,23922,21906,21906,21874,21874,28019,54841,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,54745,46294,46294,29489,21071,21071,29458,33684,35829,29458,23152,23152,23152,23152,27313,54713,60987,50360,37812,27377,29456,50519,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58938,23248,12749,14830,33621,54650,63067,39957,21039,21071,21071,21071,21071,33586,48279,48279,48246,48246,46230,56825,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,50841,23954,21906,21906,21906,21907,21906,40405,63130,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,52857,23987,21906,21906,21906,21906,21874,30100,59002,63099,63099,63099,63099,63099,63099,52889,26035,21906,21906,21906,21906,19858,28019,56921,63131,63131,63099,63099,63099,63099,56986,28083,21906,21906,21906,21906,21906,25970,54841,63131,63130,63131,63099,63099,63131,42262,10893,10893,10861,10829,14989,50616,63163,63131,63131,63099,63131,63130,63130,63098,61051,61051,61051,63099,63099,63099,63099,63131,44600,23922,21906,21906,21874,21874,27987,54841,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,33747,18991,21071,31604,35830,35830,29458,23152,23152,23152,23152,27313,54713,60987,50361,31475,16813,16877,48406,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099},
-	{63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58938,27441,19022,18990,37749,54682,63067,39957,23088,23120,21071,21071,21071,33586,48279,48279,48247,46198,46262,56825,63131,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,50809,23954,21874,21874,21874,21907,21874,40373,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,52857,23955,19858,19858,21874,21874,21842,32116,56954,63131,63099,63099,63099,63099,63099,52857,23987,21906,21874,21906,19826,19826,28019,56921,63131,63131,63099,63099,63099,63099,56986,28083,21874,21874,21874,21874,21874,25938,52792,63131,63130,63131,63099,63099,63131,42262,10861,10860,10861,10861,14989,50583,63131,63131,63131,63099,63131,63130,63130,58938,27570,21264,27505,56825,63131,63099,63099,63131,44599,23922,21874,21874,21842,21874,27987,54841,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,61083,35763,21070,23119,31604,35830,35830,29458,23152,23152,23152,21104,27313,54713,60987,50360,33587,21038,23150,50486,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56825,52664,50520,48279,54714,63067,39957,23120,23120,21072,21071,21039,33586,48279,48279,48247,48343,56825,61050,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,61083,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,50777,19729,17648,17649,17649,17649,17648,36180,63098,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,52857,21809,15632,15632,15632,15600,19665,29938,54938,61083,63131,63099,63099,63099,63099,50808,21809,17648,17648,15600,15600,17648,25841,54873,63099,63131,63131,63099,63099,63099,56986,23889,17648,17648,17648,17648,17648,21713,52760,63131,63099,63131,63099,63099,63131,42262,8780,8747,10828,10861,14989,50583,63131,63130,63130,63130,63130,63130,65178,54809,14990,4556,12877,54745,63131,63131,63131,63131,44567,17616,17616,17616,17616,17648,23761,54809,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,52599,46326,42068,33650,35797,35798,27378,23120,21104,21104,21104,25265,54713,60987,50360,50424,52665,54745,61018,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63163,60987,48313,54682,63067,39957,23120,23151,27344,29424,27376,37811,50327,48279,48278,50422,61050,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,50809,19664,17583,17584,17584,17584,17584,34099,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63131,52857,19728,13519,15567,15567,15568,17551,27857,54970,61115,63131,63131,63099,63131,63131,52857,19696,15535,15535,15535,15535,15535,23760,54873,63131,63131,63099,63099,63131,63131,56986,23825,15567,15535,15535,15535,15535,19632,52792,63131,63131,63131,63099,63099,63131,40214,8748,8715,10796,10861,14989,50584,63163,63131,63163,63131,63131,63131,65179,56890,14991,6605,14925,54745,63131,63131,63131,63163,44567,17584,17584,17584,17584,17584,21680,54809,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63163,56857,44213,44182,39957,33716,31570,31570,27313,23120,25265,54713,60987,50328,54617,63131,63163,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099},
-	{63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61051,52729,52697,50553,48281,54682,63099,39957,23120,25200,46326,58938,56889,58906,52471,54648,58906,58906,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58970,50617,50617,42423,19632,17583,17616,17616,17584,17584,29938,50681,50649,54809,63131,63131,63099,63099,63099,63099,63099,52730,50617,42423,19664,15568,17616,17616,17616,17583,25777,44536,50681,54777,63098,63131,54809,50649,42455,19664,15535,17616,17616,15568,15535,21680,46519,50648,54744,63098,63099,56890,52696,46552,23761,17584,17616,17616,17616,15567,19632,42423,52729,50681,58970,63099,63099,63131,44311,14926,14894,12878,10861,12909,38101,48601,48568,48568,48568,50616,50616,50616,46424,25266,21041,27281,56793,63131,59002,50617,50648,36213,17584,17584,17616,17616,17616,21648,44407,50617,52697,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,61083,61051,48407,54745,61018,61018,37844,23120,25265,54713,60987,50328,50392,52632,52632,58938,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099},
-	{63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,54777,25360,21167,23216,39861,56698,63099,39957,23120,25200,48471,63163,63131,61050,52535,56793,63131,61083,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,46488,15023,12942,13103,17552,19729,23923,23923,17649,17584,17424,15086,12974,29681,61050,63099,63099,63099,63099,63099,61051,27635,12974,10989,15439,17616,23890,28019,23890,17616,15376,13038,12974,29650,61051,61051,29683,13006,13166,13391,15536,21875,23987,21874,15536,15375,15118,14989,25423,58937,63131,38068,15021,13038,15375,17616,21842,23955,23955,17648,15504,13135,13006,15054,48471,63131,63099,63131,56731,48156,48156,27411,10797,10829,12909,12909,10861,12909,10861,10861,10861,10861,19056,50171,56381,54395,60987,63131,50616,17103,14990,15182,17551,19729,23955,23923,19729,15472,10990,8846,19183,56858,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63163,63131,63131,61083,50487,56857,63131,61083,35828,21072,25265,54713,60987,50328,37716,27248,27247,48374,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,54745,21167,16974,19023,37781,54650,63099,39957,23120,25200,33682,37908,37876,48407,61018,61018,48439,37973,40053,54777,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,46456,10862,8782,11022,15504,19761,23987,23955,17648,17583,15343,8845,8813,27568,61050,63099,63099,63099,63099,63099,61051,25554,8813,8877,13359,15567,23890,28051,25971,17616,15376,8845,8781,27537,61051,61051,25522,8877,9005,13359,15536,23955,26067,21874,15536,13295,10989,8813,21295,58938,63131,35988,10860,8877,13294,17616,21874,26068,23987,17648,15504,8974,6797,10893,48471,63131,63099,61083,58780,56414,54399,29492,8749,10797,10797,8749,8749,8749,8749,8749,8749,6701,16943,52252,58462,58556,60987,63131,48536,12943,10862,11053,15503,21809,26035,26035,19729,15439,6830,4686,17103,56857,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61083,50552,39988,40020,54745,63131,58938,46263,37876,37876,27378,23120,25265,54713,60987,50329,37684,25103,25135,48342,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099},
-	{63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58938,42100,37972,37876,44022,54650,63099,42037,25168,25200,23151,23151,23151,42068,63131,61083,35859,19054,21134,50551,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,46456,14991,12911,15088,23602,25811,30037,30005,25779,23666,21425,14991,14959,31634,61051,63099,63099,63099,63099,63099,61051,29684,14959,15023,21489,23634,29940,34101,32020,23666,21457,14991,14927,31634,61019,61051,29588,14991,15087,19409,21586,27957,30069,27956,23634,21425,17103,14958,27408,58906,63131,38037,14958,15023,19376,23666,27924,32117,30037,23698,21554,15088,12943,17007,50519,63131,63099,63131,58875,56572,54556,33653,16943,16943,16943,16943,16943,16943,14895,14895,14895,14863,23120,52379,58620,58683,61019,63131,48537,19088,17007,17136,23601,25811,30037,30037,25779,21522,12975,12879,21200,56857,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,61116,40053,21071,23183,48439,63131,63131,37877,23152,23184,25201,23121,27313,54713,60987,50297,46102,44117,44116,54680,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099},
-	{63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,56795,46168,54650,63099,42037,27249,27248,37875,50519,50519,54777,63131,61083,35859,19054,21166,50551,63131,63099,63099,63098,63098,63098,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61083,54715,46138,46107,48187,50300,50300,52380,52380,50300,50300,48219,48154,48123,52410,63099,63099,63099,63099,63099,63099,61051,50395,48155,48155,48188,50268,50300,50300,50300,50268,48220,48155,48123,52442,63066,61019,50363,46074,48155,48219,48251,50364,50332,50332,50299,50267,48155,48123,50297,60986,61051,54586,46041,46074,48187,50267,50300,52348,50300,50267,48219,48155,48123,48122,56762,63131,63099,63131,61083,61050,61051,54555,48155,48155,48155,48155,48155,48123,48123,48123,48123,48123,48186,58875,61051,61051,61082,63131,56827,48186,48155,48155,50267,52348,52380,52380,50300,50268,48123,46075,48218,60987,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61050,61050,61051,61051,61051,63131,61116,40053,23151,23184,50487,63131,63131,54713,50519,48472,31571,23121,27313,54713,60987,50297,52472,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099},
-	{63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56794,46168,54650,61020,42038,27217,27217,46262,63163,63163,61115,63163,61083,33811,19086,21166,52567,63131,63131,58938,58873,58873,58873,58905,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58844,56479,56479,56479,56447,58495,56447,56447,58495,58495,58526,58526,58494,58652,63099,63099,63099,63099,63099,63099,61051,58653,56446,56447,56447,56447,56447,56447,56447,56447,56447,56479,56447,56604,61019,61019,58653,58526,58526,58494,58494,58494,58494,58494,58494,58494,58494,58494,56572,60987,61051,58716,56445,58462,58463,58463,58463,58462,56414,58463,58462,58494,58462,58494,58843,63099,63099,63099,63099,63131,61051,58748,58526,58527,58527,58527,58527,58527,58527,58527,58526,56446,56509,60955,63099,63099,63099,63130,58876,56477,58494,58495,58463,58462,58462,58462,56415,56415,56447,56446,56541,60987,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60986,58873,58873,58873,58873,61018,61083,61116,40053,23151,23184,48471,63163,63131,63163,63163,61083,35796,23121,27313,54713,60987,50297,50392,61051,63130,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099},
-	{63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,46168,54650,61020,42038,27217,27217,46262,63131,63131,61083,56955,56923,35859,23214,25294,52567,61051,61051,58938,58873,58873,58873,58905,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58844,56478,56478,56478,56478,56478,56478,56478,56477,56477,56477,56477,56477,56635,61051,63099,63099,63099,63099,63099,61051,56636,56477,56446,56446,56446,56478,56478,56478,56478,56478,56478,56478,56636,61051,61019,58652,56477,56477,58525,58525,58525,58525,56477,56477,56477,56477,56477,56571,60987,61051,58716,56444,56445,56446,56446,56446,56446,56446,56446,56446,58493,58493,56445,58843,63131,63099,63099,63099,63099,61083,56700,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56509,60955,63099,63099,63099,63131,58876,56476,56445,56445,56445,56445,56446,56446,56446,56446,56446,56446,56540,60987,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60986,58873,58873,58873,58873,58970,61051,59004,42133,27311,27344,46391,58971,58971,61083,63131,61083,35764,23121,27313,54713,60987,50297,50392,61051,63130,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099},
-	{61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,48184,54650,63068,42038,27217,27249,46262,63130,63162,48439,27376,27376,42133,52697,52697,54617,54521,54617,61018,61019,61019,61019,61051,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,60987,58843,58843,58843,58843,58843,58843,58843,58843,58843,58843,58843,58843,58875,63099,63099,63099,63099,63099,63099,63099,60955,58843,58843,58843,58843,58843,58843,58843,58843,58843,58843,58843,58875,63099,63099,60923,58843,58843,58843,58843,58843,58843,58843,58843,58843,58843,58811,58843,61019,63099,60955,58811,58811,58811,58811,58811,58811,58811,58811,58811,58811,58811,58843,61019,63131,63099,63099,63099,63099,61083,60955,58811,58811,58811,58811,58811,58811,58811,58811,58811,58811,58843,61019,63099,63099,63099,63099,61019,58843,58843,58843,58843,58843,58843,58811,58811,58811,58811,58811,58842,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63098,61018,61018,61018,63098,58874,48313,48312,52601,54745,54713,37876,29360,33617,58938,63163,61083,35764,23121,27313,54713,60987,50297,50392,61051,63131,63099,63099,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54650,63068,42038,27217,25201,44214,63163,63195,42198,16877,16877,44214,63131,63131,54586,50265,52409,61019,63131,63131,63099,63131,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63130,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63130,63131,63099,63099,63099,63099,63099,63099,63099,63098,61082,61082,63130,63130,63130,63131,63131,63131,63131,63131,63131,63131,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,61083,63131,63131,61083,63131,63099,63099,63099,61083,63131,63131,63131,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63130,63130,63131,63131,63131,63131,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,56794,44088,44055,56762,63131,63131,35731,18861,25166,56857,63195,61083,35764,23121,27313,54713,60987,50297,50392,61051,63131,63099,63099,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56794,48184,54618,63068,44086,27217,27249,35764,44279,44279,37941,29489,29488,50487,63131,63131,56730,54554,54585,56826,56826,58939,61083,63131,63099,63099,63099,63099,63099,63099,63099,63131,60987,60924,60956,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,61083,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63098,61018,56826,56826,61018,63099,63099,63099,63099,63099,63099,63099,63099,61051,58938,58906,56794,50425,50424,56858,63131,61051,44182,31537,35730,46294,46327,46327,31539,23153,27313,54681,60987,50297,50392,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099},
-	{63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56794,48184,54650,63067,44118,27249,27249,21072,18990,18958,35795,61018,61018,61051,63131,63131,63099,61051,61019,48280,44054,52536,61083,63130,63098,63099,63099,63099,63099,63131,63131,61083,56669,56414,56509,60987,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,54714,39926,39926,54649,63131,63099,63099,63099,63099,63099,63099,63099,61019,46199,41942,50457,61051,61083,61083,63131,61083,61051,61051,54778,29393,23087,23088,25233,25234,29394,56729,60987,50297,50392,61051,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099},
-	{63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56794,48184,54650,63099,44118,27217,25168,35731,42101,42101,50519,63131,63131,63131,61083,63131,63099,63099,61051,48280,41973,50488,61083,63131,63130,63099,63099,63131,63131,61083,61083,61083,56605,56319,54397,61019,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,61083,63131,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,54714,39862,37813,54648,63131,63131,63099,63099,63099,63099,63099,63099,61019,46167,41910,50456,61083,61083,61083,61083,63131,63131,61083,58971,46326,42133,40021,27345,23121,27313,56729,60987,50297,50392,61051,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56794,48184,54650,63099,42038,23055,23055,48375,63164,63164,63131,63131,63131,63131,63131,63131,63099,63099,61083,56826,54713,58906,63131,63131,63131,63099,63099,63131,63131,58876,58780,58781,56478,56287,56382,58748,58780,58812,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,61083,63131,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61019,54682,54649,48345,39863,39862,48344,52601,54681,58906,63099,63099,63099,63099,63099,63098,56793,54681,58906,61083,61083,63131,63131,63131,63131,63131,61083,63163,63195,59035,33618,21008,25200,54681,60987,50329,50392,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63131},
-	{63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54650,63099,44118,25136,25136,42102,52698,52665,52665,56858,63131,63131,63131,63131,63099,63099,61083,63131,63131,63131,61083,61083,63131,63099,63099,63131,63131,56603,54331,56349,56287,56255,56287,56350,56413,56539,61019,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63131,61083,63131,63131,61083,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,61083,61083,63131,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,58874,41974,39862,39863,39863,39863,37814,37814,37814,52568,63131,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63131,63131,58970,52633,50585,50553,31507,23121,27313,54713,60987,50329,50392,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63131,63131,63099},
-	{63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54650,63099,46199,29298,29330,25265,23184,23216,23183,42133,63131,63131,63131,63131,63099,63131,61083,63131,63131,63131,63131,61083,63131,63099,63099,63099,63131,58811,56667,56668,56446,56287,56350,56572,58684,58747,61019,61083,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63131,63131,63131,61083,63131,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63131,61083,61083,61083,61083,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63131,63131,61083,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60986,50456,50424,46200,39862,39863,44151,48376,48376,56793,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,48440,27313,25233,29362,29395,27347,31507,56761,60987,50329,50392,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63131,63131,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54650,63099,46199,29331,29362,23152,21071,21071,21038,42101,63131,63131,63099,63099,63131,63131,63131,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,61083,61083,61051,58653,56351,56445,60987,61051,61051,61083,61083,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63131,63131,63099,63131,61083,61083,61083,61083,63131,63131,63131,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63099,63099,63131,63131,61083,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,54682,39862,37782,54649,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,48407,25200,23120,27281,29394,29394,31507,56761,60987,50329,50392,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,61083,63131,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56794,48184,54649,63099,44151,35603,46135,44086,42006,42006,42037,52536,60987,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63131,63131,63099,63099,63099,63099,63098,63098,61051,56605,56351,56445,60987,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63131,63131,61083,61083,61083,61083,61083,63131,63131,63131,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,61083,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,54681,37814,37782,54649,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60987,60955,56698,46167,44119,46199,48313,42039,31507,56761,60987,50329,50392,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63131,63131,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56794,48184,54649,63099,44118,39796,60860,60892,60892,60892,60924,60924,60923,61019,63099,63099,63099,63099,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,58875,58780,58811,61051,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63131,61083,61083,63131,63099,63131,61083,61083,63131,63131,63131,63131,61083,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,58938,58906,58938,58938,58938,61051,63131,61051,58938,58938,58938,58938,58938,58938,61018,63131,63131,63131,63131,61019,58938,58906,60986,63099,63099,63099,63099,63099,61051,58938,58906,58906,58938,63099,63099,61019,58938,58938,58906,58906,58906,58906,58906,61019,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58906,52536,52536,58906,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60923,60859,60860,62940,62940,62940,62940,46265,29426,56761,60987,50329,50425,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,61083,61083},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56794,48184,54649,63099,52505,50296,60860,60892,60892,60892,60892,60892,60891,60987,63067,63067,61051,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63131,61083,61083,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63131,63099,63131,61083,63131,63099,63131,63131,63131,61083,63131,63099,63131,61083,61083,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,54746,25333,23220,23220,23220,21140,42168,61051,58906,27445,21140,23220,23252,23220,21140,37943,61019,63099,63099,63099,44216,21140,23220,29525,58906,63099,63099,63099,63099,48440,23220,23220,23220,25300,52633,63131,48441,21140,21140,23220,23220,23220,23220,23252,48441,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63067,63067,63035,60923,60860,60860,62907,62907,62907,60860,50426,39893,58842,60955,50329,50425,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,61083},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56794,48184,54649,61051,56763,56602,60859,60892,60892,60892,60891,60891,60891,60891,60891,60923,61019,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,61083,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63099,63099,63131,63099,63099,63099,63099,63099,63131,63099,63099,63131,61083,61083,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,25332,14867,42135,50521,48441,25333,19027,44216,56858,19027,12722,37943,50521,48473,29525,14867,37943,63099,63099,44216,19027,25332,37943,14835,29525,58906,63099,63099,48408,21108,21140,48408,44248,16947,25300,54714,46328,10674,19027,46328,50489,50489,48441,50489,58906,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60955,60891,60891,60891,60860,60860,60860,60860,60860,60860,56667,54586,60955,60955,50329,50424,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63130,56794,48184,54650,61051,56731,56602,60859,60892,60892,60892,60891,60859,60859,60860,60860,60891,60987,63131,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,61083,61083,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,61083,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,52633,14835,14867,54713,63131,63131,52633,46328,54714,56858,19059,12754,48473,65211,63131,35862,10610,29525,63099,44183,19027,25332,52633,58938,40023,14867,29525,58906,48408,21140,21140,50521,63099,61019,48440,46328,58938,46328,12722,21140,60986,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60955,60891,60892,60892,60860,60892,60860,60860,60860,60860,56667,54586,60954,60955,50329,50425,61051,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63130,56794,48184,54650,61051,58811,56634,60891,60923,60892,60892,60892,60892,60892,60860,60860,60891,60987,63131,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63131,61083,63131,63131,63131,63131,63131,61083,63131,63099,63099,63099,63099,63131,44248,31605,31605,31605,31605,31605,35830,58938,63131,48473,29557,40055,54714,33718,31605,33718,56826,63131,56826,33718,31605,31605,31605,31638,52633,63131,63131,63099,40055,29557,31605,31605,29557,42103,63099,63099,63131,44216,29557,31605,31605,29557,37943,61018,63099,63099,63099,63099,63099,58938,40023,16915,27413,31605,31605,31638,50521,65179,56826,19059,12722,25333,31605,31605,21108,25300,50521,63099,33718,8562,33718,63131,65179,52633,14835,16915,56794,40023,10610,27413,63099,63099,63099,63131,63131,63131,46328,12722,14835,29525,31605,33718,56794,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60955,60891,60892,60892,60892,60892,60892,60892,60891,60891,56699,54618,60954,60955,50329,50393,61051,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63130,56794,48184,54650,61019,61018,61050,63099,63098,60955,60892,60892,60892,60892,60892,60860,60891,60987,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,61083,63099,63099,63131,63131,63099,63099,63099,63099,63131,33750,8562,21140,37943,37943,33718,16915,35798,58938,40055,10642,16947,33750,37943,37943,40023,58906,56794,31605,16915,35830,40023,37943,19027,25365,52601,61051,40023,16947,29493,40023,40023,37943,46360,63099,63099,44216,19059,25332,40023,40023,37943,44248,61019,63099,63099,63099,63099,63099,63131,60986,42135,37943,37943,37943,21140,23252,48441,58906,19059,12722,31606,37943,37943,37943,50521,63131,63099,33718,10642,21140,33750,33750,29525,12754,16947,56794,40055,10642,27413,61019,63099,63099,63099,63099,63131,46328,12722,16947,35862,37943,40023,56826,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60955,60891,60892,60892,60892,60892,60892,60891,60987,63066,63066,60986,63066,60955,50329,50393,61051,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63130,56794,48184,54650,61019,61083,63163,63163,63131,60987,60891,60892,60892,60892,60892,60892,60891,60987,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63131,61083,63099,63099,63131,63131,63099,63099,63099,63099,63131,33750,10610,31638,63131,65179,52633,14835,16915,56794,42103,10642,16947,40055,61051,63131,63131,63131,48441,12754,14867,35830,39991,37911,19027,10610,42103,63099,40055,16947,27445,40023,37943,37943,48408,63131,63099,44216,19060,25300,39991,37943,37943,46296,63099,63099,63099,63099,63099,63099,63099,63131,65179,63131,63131,63131,29557,8562,35862,58906,19059,12754,50489,65179,63131,63131,63131,63099,63099,33718,10642,21140,35798,35798,29525,12754,16947,56794,40023,10610,27413,63099,63099,63099,63131,63131,63131,46328,12722,21140,60986,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60955,60891,60891,60891,60891,60892,60892,60891,60987,63098,63099,63131,63098,60955,50329,50393,61051,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54618,61020,58939,58907,60987,60987,60955,60891,60892,60892,60892,60923,60923,60891,61019,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,61083,63131,63131,63131,63131,63131,63131,63099,63099,63131,33750,10610,31638,63131,65211,52633,14835,14867,56794,42103,10642,25365,61051,63099,63099,63099,63131,48441,12754,14835,29525,31638,31638,31638,31638,50521,63131,63099,42103,31638,31638,31638,23220,21140,46360,63099,63131,46296,31638,31638,31638,25332,19027,44216,61018,63099,63099,63099,63099,58906,44216,44216,60986,63131,63131,29557,8562,35862,58906,19059,12754,48440,63131,63099,63099,63099,63099,63099,33718,10610,33718,63131,63131,52633,14835,16947,56794,50521,23220,19060,46328,63099,61018,46296,42135,58906,46328,12722,21140,60986,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60955,60923,60891,60891,60891,60892,60892,60891,60955,63003,60955,58907,61019,60955,50329,50393,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54618,61020,54617,52440,58811,60860,60860,60860,60860,60860,60892,60987,60955,60891,60987,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,63099,63099,63099,63131,33750,10642,25332,46296,46328,37943,14867,29525,58906,40055,10610,25332,61019,63099,63099,63099,63131,54713,25333,16947,42135,46328,46296,46328,56826,63131,61051,50489,46296,46296,46296,46328,31605,16915,37910,61019,50553,46296,46296,46296,46328,35798,14835,33718,60986,63099,63099,63099,63131,56826,27445,14867,40023,46328,46296,23220,19059,46296,58906,19027,12722,48440,63131,63099,63099,63099,63099,63099,33718,8562,31638,63099,63131,52601,12754,16915,54746,63131,50521,23220,19059,44216,42103,16915,25365,54746,46328,10674,16947,44215,46296,46296,46296,46296,56826,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60955,60923,60923,60923,60891,60892,60892,60891,60891,60892,54586,48312,58875,60956,50329,50393,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54618,61020,54617,50393,60827,60860,60860,60860,60860,60860,60891,60987,60987,60955,60987,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,33750,10642,16947,25332,25332,25300,29525,58906,63131,46328,23252,35798,61051,63099,63099,63099,63099,63099,54713,27413,25332,25332,25332,25333,50521,63131,61018,33718,25332,25332,25332,25332,25300,37910,61019,63099,37943,25300,25332,25332,25332,25300,33718,60986,63099,63099,63099,63099,63099,63099,56826,29525,25332,25332,25332,25300,46296,63131,58906,29557,25332,52601,63131,63099,63099,63099,63099,63099,42103,23220,40023,63099,63131,54714,27413,27445,56826,63131,63099,50521,25333,25332,25332,27445,54746,63131,50521,25332,25300,25332,25332,25332,25332,25333,50521,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60987,60987,60987,60923,60892,60891,60891,60892,60892,60892,54554,48280,58874,60955,50329,50393,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54650,61020,54617,50361,60828,60860,60860,60860,60860,60860,60891,60987,63067,63067,63067,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,33750,10642,31606,61018,61018,61018,61018,63099,63099,63099,61018,61019,63099,63099,63099,63099,63099,63099,63099,61018,61018,61018,61018,61018,63099,63099,63099,61019,61018,61018,61018,61018,61018,61019,63099,63099,61019,61018,61018,61018,61018,61018,61019,63099,63099,63099,63099,63099,63099,63099,63099,61018,61018,61018,61018,61018,63099,63099,63099,61019,61018,63099,63099,63099,63099,63099,63099,63099,61051,61018,61019,63099,63099,63099,61018,61018,63099,63099,63099,63099,61018,61018,61018,61018,63099,63099,63099,61018,61018,61018,61018,61018,61018,61018,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63067,63067,63067,63067,60923,60860,60892,60892,60860,60860,60892,54554,48280,58874,60955,50329,50392,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54650,61020,54618,50361,60828,60860,60860,60860,60860,60860,60891,63035,63067,63067,63067,63067,63067,63067,63067,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,33750,10610,31638,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63067,63067,63067,63067,63067,63067,60923,60860,60860,60860,60860,60860,60860,54522,48248,58874,60955,50329,50392,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54650,61052,54586,50361,60828,60860,60860,60860,60860,60859,60891,60987,63067,63067,63067,63067,63067,63035,63003,63003,63003,63035,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,37910,14835,35798,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63067,60987,60955,60955,60955,63035,63067,63067,63067,63067,63067,60923,60891,60892,60860,60860,60860,60860,54522,48248,58874,60955,50329,50392,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54650,61052,54586,50329,60827,60860,60828,60859,60923,60987,60987,63067,63067,63067,63067,63067,63067,60891,60860,60860,60860,60891,63067,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,58906,54713,58906,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56826,40023,42103,58938,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,50521,37943,37911,37911,37910,44215,61019,63131,54746,37943,37911,37943,37943,37943,37911,37911,52633,63131,63099,61018,42135,37911,37943,54713,63131,63099,63099,46328,37943,37943,37911,37911,37910,44248,63099,63099,48440,37910,37911,37943,37943,37943,37910,40055,58938,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60955,60859,60859,60859,60859,60923,63067,63067,63067,63067,63067,60987,60987,60955,60860,60860,60860,60860,54554,48248,58874,60955,50329,50392,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56794,48184,54650,61052,54586,50329,60828,60860,60860,60859,60955,63067,63067,63067,63067,63067,63067,63067,63067,60891,60860,60860,60860,60891,63067,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,50521,12754,16947,56794,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,50521,25300,19060,31638,31638,25333,16947,42135,61018,54681,31638,31638,21140,10642,19027,31638,31638,50521,63131,61018,42103,16915,25333,16915,31605,54714,63131,61019,27413,10610,23220,31638,31638,25300,19059,44248,61019,44248,31606,29557,14835,10642,25300,31638,35798,58906,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60955,60859,60860,60860,60859,60923,63067,63067,63067,63067,63067,63067,61019,61019,60892,60860,60860,60892,52506,48248,58874,60955,50329,50392,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63098,56794,48184,54650,61052,54586,50329,60828,60860,60860,60860,60955,63067,63067,63067,63067,63067,63067,63067,63067,60891,60860,60860,60860,60891,63035,61051,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,50553,14802,16979,56826,63131,63099,63099,63099,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,31605,10610,35830,65179,63131,54714,29557,33718,58906,63099,63099,63131,35830,10642,31605,63099,63099,63099,58938,42135,16947,27445,54713,37943,16947,31605,54714,61051,27413,10642,40023,65179,65179,46328,10674,21140,58938,63099,63099,58938,21172,12722,46296,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60923,60860,60860,60860,60860,60923,63067,63067,63067,63067,63067,63067,61019,63035,60892,60860,60860,60860,52506,46200,58874,60955,50329,50392,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63098,56794,48184,54650,61020,54586,50329,60828,60860,60860,60860,60955,63067,63067,63067,63067,63067,63067,60955,60955,60923,60891,60891,60860,60891,60891,60923,60923,63067,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58938,40055,12754,16915,44216,50521,58938,63131,63099,52601,48440,48440,48440,48440,56794,63131,63099,63099,63099,63099,63099,40023,16915,27445,48441,48440,48440,50553,61019,63099,63099,63099,63131,35830,10642,31606,63099,63099,63131,52633,14867,16915,54713,63131,63099,29525,10642,37911,63099,27413,10642,31638,50489,50489,35862,14835,31638,61018,63099,63099,58938,21172,12722,46328,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60955,60891,60891,60859,60860,60891,60923,60923,60923,63003,63035,63067,63067,63067,63067,61019,63035,60891,60860,60860,60860,52506,46200,58874,60955,50329,50392,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63098,56794,48184,54650,61020,54586,50329,60828,60860,60860,60860,60955,63067,63067,63067,63067,63067,63035,60923,60923,63035,63067,63035,60891,60891,60892,60892,60891,60987,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,50553,21140,12722,12754,21172,25333,54681,63099,50521,21140,21140,23252,23252,16947,31638,56826,63099,63099,63099,63099,63099,63099,40023,23220,23252,23252,21140,21140,50521,61051,63099,63099,63131,35830,10642,31605,63099,63099,63131,52633,14835,14835,46296,52601,52601,25333,10642,37910,63099,27413,10642,19027,23252,23252,19027,21172,52601,63099,63099,63099,58938,21172,12722,46296,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60891,60860,60859,60860,60860,60923,63035,63035,63003,60955,60987,63067,63067,63067,63067,63067,63035,60891,60860,60860,60860,52474,46200,58874,60955,50329,50392,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56794,48184,54650,61019,54554,50329,60827,60860,60860,60891,60955,63067,63067,63067,63067,63067,63035,60923,60955,63035,63067,63035,62907,60860,60891,60891,60891,60987,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,48408,12754,16947,52633,58938,63099,56826,21140,14802,48408,58938,58938,33718,10674,33750,63099,63099,63099,63099,63099,63099,61018,58938,58938,58938,46360,14802,21140,56826,63131,63099,63131,35830,10642,31605,63099,63099,63131,52633,14867,12722,21140,23220,23220,14867,10642,37910,63099,27413,10642,37911,58938,58938,44216,12722,25300,58938,63099,63099,58938,21172,12722,46296,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63067,60923,60891,60891,60859,60860,60923,63035,63035,63003,63003,63035,63035,63067,63067,63067,63067,63035,60891,60891,60859,60860,52474,46200,58874,60987,50329,50392,63067,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,63131,63131,63131,63131,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58842,48184,54650,61019,54554,50329,60891,60955,60955,60955,60955,60955,60955,63003,63003,63003,63003,63003,63003,63035,63067,63035,62907,60860,60923,60955,60955,60955,60923,60955,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,50521,12754,16979,56826,63131,63131,56794,16947,12754,50521,63131,63131,35798,10610,31638,63099,63099,63099,63099,63099,58938,56826,60986,63131,63131,50521,12754,16979,56826,63131,63099,63131,35830,10642,31605,63099,63099,63131,52633,14835,14867,50521,56858,56826,27445,10642,37910,63099,27413,10642,40023,63131,63131,46328,10674,21140,58938,63099,63099,58938,21172,12722,46296,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63067,60923,60923,63035,63035,60987,60891,60860,60923,63035,63035,63003,63003,63003,63003,60955,60955,60955,63003,63003,60923,60923,62971,60924,52474,48248,58874,60987,50329,50392,63067,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58842,48184,54650,61019,54554,50329,60923,60987,60987,60955,60955,62971,62971,60923,62971,62971,63003,63003,63003,63035,63067,63035,60923,60923,60923,60923,60956,60924,60892,60955,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,52601,16915,16947,52633,58938,63099,56826,21140,14802,48408,60986,58938,33718,10674,33750,63099,63099,63099,63099,63099,37943,19059,37910,58938,60986,48408,12754,21140,56826,63131,63099,63131,35830,10610,31605,63099,63099,63131,52633,14835,16915,54714,63131,63099,29525,10610,37910,63099,27413,10642,40023,63131,63131,46328,10674,21140,58938,63099,63099,58938,21140,12722,46296,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63067,62939,62939,63003,63067,63067,60955,60891,60954,63035,63035,63003,63003,62971,62971,62971,62971,60923,60923,62971,60955,60955,63003,60923,52474,46200,58875,60987,50329,50392,63067,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58842,48184,54650,61019,54554,50296,58811,60923,60955,60987,63003,60987,61019,61019,61019,63003,63003,63003,63003,63035,63067,63067,63067,63067,60955,60892,60892,60892,60892,60923,61019,63067,63067,61019,63067,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61018,46328,16947,21172,25333,54681,63099,50521,21108,21140,23252,23252,16947,31638,56826,63099,63099,63099,63099,63099,56794,29557,16947,23252,23252,21140,21140,50521,61051,63099,63099,63131,35830,10674,31638,63099,63099,63131,52633,16915,16947,54713,63131,63099,29557,10674,37943,63099,27445,12722,40023,63131,63131,46328,12754,23220,58938,63099,63099,58938,23220,12754,46328,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63067,63067,63003,62939,62939,62971,63003,60955,60987,61019,63067,63035,63035,63003,63003,62971,60955,61019,60987,61051,61051,60987,60987,60923,58811,58811,50394,48248,58874,60987,50329,50392,63067,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54650,61019,54554,48216,50360,50393,58810,60987,60955,61019,61179,61179,61179,63035,62971,63003,60955,63035,63035,63067,63067,63067,60955,60892,60892,60892,60892,60892,60891,60891,60892,60892,60891,60987,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61018,50521,48440,48441,58938,63131,63099,52601,48440,48440,48440,48440,56794,63131,63099,63099,63099,63099,63099,63131,54746,48440,48440,48440,48440,52601,63099,63099,63099,63099,63099,54746,48440,54713,63099,63099,63099,60986,50521,50521,61018,63099,63099,54713,48440,56794,63099,52633,48440,56826,63099,63099,58906,48441,52601,61051,63099,63099,61051,52601,48441,58906,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63067,63035,62971,62939,60859,60859,60859,60860,60860,60860,60891,60987,63067,63067,63067,63035,63003,63003,62971,61051,61179,61179,61211,61115,61019,60987,56698,50329,50361,48281,48280,58874,60987,50329,50392,63067,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56794,48184,54650,61019,54554,48216,48280,50328,58810,60987,60987,61019,61179,61211,61179,61019,60955,63003,63035,63035,63067,63067,63066,63067,63035,60891,60891,60891,60892,60892,60891,60891,60891,60891,60891,60955,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63131,63131,63131,63099,63131,63131,63131,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63067,63003,60859,60860,60859,60827,60860,60859,60859,60891,60923,60987,63067,63067,63067,63035,63035,63035,63003,61051,61179,61211,61211,61115,61019,63035,56698,50328,50329,48281,48281,58874,60987,50329,50392,63067,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56794,48216,54650,61019,54554,50296,56730,56762,60955,60987,61019,61019,61083,61083,61083,61147,61083,63067,63067,63067,63067,63067,63066,63067,63067,60987,60987,60923,60860,60891,60987,63035,60987,60923,60891,60955,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63067,62971,60923,63035,63035,63035,60891,60827,60827,60955,63035,63035,63067,63067,63067,63067,63067,63067,63067,63067,61019,61051,61051,61051,61019,63035,63035,60922,56762,56762,54618,48280,58875,60955,50329,50392,63067,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58842,48216,54650,61019,54554,50360,60987,63067,63067,61019,61019,63067,61019,60955,61019,61179,61115,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,60923,60828,60891,63099,63131,63099,60955,60891,60955,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63034,60923,60955,63099,63099,63099,60923,60796,60827,63035,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,60955,60955,63035,60987,61019,63067,63067,63067,56762,48312,58875,60955,50329,50392,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,48184,54650,61019,54554,50360,60986,63067,63067,63067,63067,63067,61019,60986,61018,61083,61051,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,60923,60859,60922,63099,63099,63099,60987,60955,60987,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63067,60955,60987,63099,63099,63099,60955,60827,60859,60987,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,60955,60987,63067,63067,63067,63067,63067,63067,56730,48312,58875,60955,50329,50392,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,48184,54650,63067,54554,50360,60987,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,60955,61018,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63099,63131,63131,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63067,61019,60987,60987,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,56730,48312,58875,60955,50329,50392,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,48184,54650,63067,54586,50360,60987,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,60954,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63131,63131,63131,63131,63131,63131,61083,61083,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63035,63035,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,56730,48312,58875,60955,50329,50392,61051,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58842,48217,54650,61019,54586,50392,60987,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,60987,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,61083,61083,61083,61083,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60987,60987,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,56762,48312,58875,60955,50329,52440,61051,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58842,48217,54650,61019,54586,50392,60987,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,61019,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,61083,61083,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,61019,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,56762,48312,58875,60955,50329,52440,61051,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58842,48217,54650,61019,54586,52441,60987,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,60987,63003,63003,63003,60987,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,63131,61083,61115,61115,61115,61115,61115,61115,61115,61115,61115,61115,61115,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61083,61082,61082,61083,61115,61115,61083,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,63131,63131,61083,63131,63099,63099,63099,63067,60987,60987,63067,63099,63099,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,56762,50360,58842,60955,50329,52440,61051,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58842,48216,54650,61019,54586,52441,61019,63099,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,60955,60955,62971,62971,60987,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63098,61082,50713,46552,46552,46552,46552,46552,46552,46552,46552,46552,46552,46552,46552,46552,46553,46553,46553,46553,46553,46553,46553,46521,46521,46521,46521,46521,46521,46521,46521,46521,46521,46521,46521,46521,46521,46521,46521,46521,46553,46553,46553,46553,46553,46553,46553,46553,46521,46521,46521,46521,46521,46520,46520,46520,46520,46552,44504,44504,44504,44504,44472,54841,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,61083,61083,63131,63099,63099,63099,60987,60923,60923,63035,63099,63099,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,56762,50393,58842,60955,50329,52440,61051,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,61083,61083,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,48216,54650,61019,54586,52441,58842,58874,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,60987,60987,60923,60860,60923,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63163,59067,42359,36117,36117,36117,36117,36117,36117,36117,36117,36117,36117,36117,36117,36117,36117,36118,36118,36118,36118,36118,36118,36086,36086,36086,36086,36086,38134,38134,38134,38134,38134,36086,36086,36086,36086,36086,36086,36086,36086,36086,36086,36086,36086,36086,36086,36086,36086,36086,36086,36118,36118,36118,36118,36149,36149,36149,34101,34101,34101,34101,36149,52761,63131,63163,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,63131,63131,63131,63131,63099,60955,60859,60891,63035,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,60987,58842,54618,50393,58842,60955,50329,52440,61019,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63131,61083,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,48216,54650,61019,54618,52409,52441,54585,60987,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,61019,60923,60860,60923,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61083,48599,40277,40341,48696,50777,50777,50777,50777,50777,50777,50809,50809,50809,50809,50809,50809,50809,50809,50809,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,50777,48729,48729,50777,50777,50777,50777,50777,46616,40309,42325,56889,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,61051,61051,61051,63099,63099,60955,60860,60891,63035,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63067,63099,63099,63067,63067,63067,63099,58842,52441,50392,50393,58842,60955,50329,52440,61019,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,48216,54650,61019,56666,52409,52409,54553,58842,58875,60923,60923,60923,60923,60955,60955,60923,60923,62971,62971,62971,60923,60955,60955,63035,63067,63067,63067,63067,63067,60923,60828,60859,60923,60923,60955,60955,60891,60955,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61083,27825,6922,13164,50841,59196,59196,59195,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59196,59228,38292,9003,11020,48534,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61019,60892,60859,60892,60923,60923,60892,60860,60891,60987,63067,63067,63067,63067,63067,60955,60923,60923,60923,60923,60923,60923,60923,60923,60955,60923,60923,60923,60923,60923,60923,56730,52473,50393,52473,58842,60955,50329,52440,61019,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61083,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63099,63099,63131,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,48216,54650,61019,56666,52409,52441,52441,54522,54522,54554,54554,56603,56635,56635,58684,58684,60764,60763,60763,60764,60764,60827,60859,60955,63067,63067,63067,63067,63067,60923,60859,60859,60828,60859,60891,60891,60827,60891,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61083,29873,6889,13164,52857,57115,42647,40567,40599,40599,40599,40599,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42648,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,42647,50905,59227,36212,6923,11019,48502,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61019,60827,60795,60828,60828,60828,60860,60860,60859,60987,63099,63099,63099,63099,63067,60859,60795,60795,60796,60796,60796,60796,60795,58747,58747,58715,56635,56635,56635,54554,54554,52473,52473,52441,52473,58874,60955,50329,52440,61019,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61083,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63099,63131,63131,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,48216,54650,61020,54618,50361,50361,50393,50393,50394,52570,54682,54683,54619,54556,54587,58779,60859,60891,60891,60891,60891,60923,60923,60923,60923,60923,60923,60923,60923,60987,60987,60987,60955,60955,60987,60987,60955,60955,63067,63035,60923,60955,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61083,44470,34034,36147,52953,52986,28148,24019,24019,24019,24019,26067,24051,24051,24051,24019,24019,24019,24051,24051,24051,24051,24019,26067,26067,26067,26067,26067,26067,26067,26067,26067,26067,26067,26067,26067,26067,26067,26067,26067,26067,26067,26067,26067,26099,26099,26099,26099,26099,26099,26067,26099,26099,26099,26099,26099,26067,26099,26067,26067,26067,24051,24019,40534,57147,46648,31987,34035,54808,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60955,60923,60923,60923,60955,60955,60955,60955,60955,60955,60955,61019,60987,60987,60955,60955,60955,60891,60891,60891,60859,60859,60859,60827,58747,56667,54587,54586,54650,54682,54650,52506,50394,50393,50393,48313,50393,58874,60955,52377,52440,61019,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48216,54650,61020,50457,44087,44087,44087,42039,42071,50649,55067,55035,48473,42040,42071,54714,61019,61019,61019,61019,61019,60987,60955,60891,60828,60828,60828,60827,60827,60987,63099,63099,63131,63099,63099,63099,63131,63099,63067,60891,60796,60859,61019,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,61115,59164,59228,55066,36373,32245,26099,24051,24019,26067,26067,26067,26067,26067,26067,26067,26067,26099,26099,26099,26067,26067,26067,26067,26067,26067,26067,26099,26067,26067,26067,26067,26067,26067,26067,26067,26067,26067,26067,26067,26099,26099,26067,26067,26067,26067,26099,26099,26099,26099,26099,26099,26067,26067,26067,26067,26067,26067,26067,26067,26067,26099,26067,30228,34357,48825,59196,59196,61115,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60859,60795,60859,61051,63131,63099,63099,63099,63099,63131,63131,63067,60892,60892,60860,60828,60859,60923,60955,60923,62971,60923,60891,58810,54618,44119,39926,42038,52858,55066,54970,46296,44119,44119,42039,42039,44087,56794,60955,52377,52440,61019,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63131,63131,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48216,54650,61019,50425,42007,42007,39959,39959,39959,46521,48858,50906,44344,37878,37910,52633,61051,61019,61019,61019,61019,60987,63035,60923,60859,60859,60891,60891,60891,61019,63099,63099,63099,63099,63099,63099,63099,63099,63067,60955,60891,60922,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,54874,40245,36117,42519,46809,44727,28115,26067,26067,24051,24051,28116,46456,50552,50552,50552,50552,36278,24051,26067,26099,26068,44439,50552,50552,50552,50552,48504,32213,24051,26067,26067,38294,50553,50552,50552,50552,50552,48504,32213,24051,26099,26099,26068,44439,50552,50552,50552,50552,48504,32181,24051,26099,24051,28116,48504,50552,50552,50552,50552,46456,28116,26099,26099,26099,24051,26067,38486,50905,48824,38229,34036,40213,61018,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60891,60859,60922,61051,63099,63099,63099,63099,63099,63099,63099,61019,60923,60923,60891,60891,60891,60955,60987,63003,60923,60890,58842,58810,52570,39926,37781,37877,48729,53017,52890,42167,42007,42007,42007,39959,42039,56794,60955,52377,52440,61019,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48216,54650,61019,48377,39927,39959,39991,40023,40022,42359,42584,42616,40183,35830,37910,50585,61050,61018,61019,61019,63099,63099,63099,63099,63066,63067,63099,63098,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63098,63130,48600,15150,11021,17552,28116,26067,26067,26067,26067,26099,24051,28116,58714,64827,64827,64827,64827,42391,24051,26067,26099,28116,56666,64827,64827,62779,64827,62779,34229,24051,26099,24051,46456,64827,62779,62779,62779,62779,62779,36277,24051,26099,26099,28116,54618,62779,58714,58714,60731,62779,36278,24051,26099,24051,32213,60763,64827,62779,62779,64827,60762,30164,24051,26099,26099,26099,26099,26099,26099,26035,11150,6828,19278,56889,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61051,63099,63067,63099,63099,63099,63067,60922,58841,58874,58939,52666,39926,35733,35829,44567,46776,46680,42231,40055,40023,39991,39959,42039,56794,60955,52377,52440,61019,63130,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48216,54650,61019,46264,35670,33653,42328,48761,48761,48825,48889,48857,44473,38103,40183,48569,54841,58938,61019,61019,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63098,63131,48600,15150,11053,17552,26068,26067,26067,26067,26067,26099,24051,28116,58714,56666,44439,44439,44439,34229,26067,26067,26067,26067,38326,42391,56666,62779,48504,40343,30164,24051,26099,24051,46456,62779,44439,34229,34229,52601,62779,36277,24051,26099,26099,28116,54618,60763,36277,30164,50553,62779,36278,24051,26099,26099,28116,40342,44439,60762,62779,46456,40342,28116,26099,26067,26067,26067,26067,26067,24051,23987,11182,6892,19311,58938,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63067,60890,58809,58906,61083,54810,42198,38070,38101,44632,46776,46744,46745,46745,48729,37974,33621,35733,54713,60987,52377,52440,61019,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48216,54650,61020,46232,31541,31573,42392,51002,51002,51002,51002,53018,46681,40376,40344,46552,50713,54809,61018,61019,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63098,63131,48600,15150,11021,17520,23922,23954,26067,26067,26067,26067,24051,28116,58714,60763,54618,54618,54618,38326,24019,26067,26067,26099,24051,26067,52569,62779,38326,24051,26099,26067,26099,24051,46456,62779,52569,48504,48504,56666,62779,36277,24051,26099,26099,28116,54618,62779,56666,54617,58714,62779,36278,24051,26099,26067,26099,24051,28116,56666,60731,32181,24051,26099,26067,26099,26099,26067,24019,23987,21874,19794,11150,6892,19311,58938,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63067,58842,58809,58874,59035,52794,44471,42423,42455,46712,46744,46776,48922,51002,50938,37974,31540,33652,54681,60955,52377,52440,61019,63130,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54650,61052,46232,33589,31541,42392,51002,50970,50970,50970,50970,48825,46712,46712,46680,48696,54809,60986,61019,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63098,63131,48600,15150,11021,15407,19696,19729,23987,26067,26067,26067,26067,28116,48504,52569,52569,58714,64827,42391,24051,26099,26099,26099,26099,26067,52569,62779,38326,24051,26099,26099,26099,24051,46456,62779,56666,54617,54617,58714,62779,36277,24051,26099,26099,28116,54618,62779,64827,58714,40343,36278,28116,26099,26099,26099,26099,26099,28116,56666,60731,34229,24051,26099,26099,26099,26099,26067,26067,21906,17648,15568,11150,6892,21327,58906,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63067,60890,58809,56826,50777,50777,48761,48761,48793,48824,46744,46777,48922,51001,50938,37974,31541,33652,54713,60955,52377,52440,61019,63130,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54649,61052,46232,33589,33621,42391,50970,50970,50937,46744,44696,50968,53081,53082,50905,46648,54809,60986,60986,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,48600,15150,11021,15407,19696,19729,26035,26067,26067,26067,26067,26068,36278,38294,38294,50552,62779,42391,24051,26099,26099,26099,26099,26067,52569,62779,38326,24051,26099,26099,26099,24051,46456,62779,38326,26067,26067,50552,62779,36277,24051,26099,26099,28116,54618,62779,58714,62779,48504,28116,24051,26067,26099,26099,26099,26099,28116,58714,60731,34229,24051,26099,26099,26099,26099,26099,26099,21939,17648,15568,11150,6892,21359,58938,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63067,60890,58809,54777,46648,48761,55098,55098,55098,48857,44696,46777,48922,51002,50938,37974,31540,33652,54713,60955,50329,52440,61051,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54649,61052,46232,33589,33621,42391,50970,50970,48889,44631,44631,46744,48857,48825,46745,46648,54841,61018,61019,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,48600,15150,11021,15407,17648,19696,21842,23922,24019,26067,26067,28116,56666,62779,62779,62779,62779,42391,24051,26099,26067,26099,26099,26067,50553,60763,38326,24051,26099,26099,26099,24051,44439,60763,36278,24051,26099,48504,60763,34229,24051,26099,26099,28116,54618,62779,40343,50553,62779,50553,28116,26099,26099,26099,26099,26099,28116,54618,58714,32181,24051,26099,26099,26099,26099,24019,21906,19793,17648,15568,11150,6892,19311,58938,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60922,58841,54809,46648,44633,46745,46777,48825,46745,44696,46777,48922,51002,50938,37974,31540,33652,54713,60955,50329,52440,61051,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54649,61052,46232,33589,33621,42391,48890,50938,48857,44663,44664,44664,44664,44664,44664,44600,54841,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,48600,15118,11021,15374,19664,17616,17616,19729,24019,24019,26067,26068,38294,40342,40342,40342,40342,32213,24051,26099,26099,26099,26099,26067,30164,32181,28116,26099,26099,26099,26099,26099,30164,32181,28116,26099,26099,30164,32181,28116,26099,26099,26099,26067,36278,38294,28116,28116,38326,40342,30164,26099,26099,26099,26099,26099,26067,32213,32181,26068,26099,26067,26067,26067,24019,21907,17648,15568,15567,15567,11149,6860,19279,56890,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63066,63066,56954,46648,44600,44632,44664,44696,44696,46777,46777,48889,48890,48858,35926,31540,33652,54713,60955,50329,52440,61051,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48184,54649,61052,46232,33589,33621,40278,46680,46648,46680,48889,48921,48921,48921,48921,46809,44632,54874,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,52697,27474,25393,31987,38420,34292,19696,17648,19761,21874,26067,26067,26067,26067,24019,24051,24051,26099,26099,26099,26099,26099,26099,26099,26099,24051,26099,26099,26099,26099,26099,26099,26099,24051,26099,26099,26099,26099,24051,26099,26099,26099,26099,26099,24051,24051,26099,26099,24051,24051,26099,26099,26099,26099,26099,26099,26099,26099,26099,26067,26099,26067,26067,26067,19794,17713,15568,23858,34292,34260,27667,23313,31634,58938,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56954,46680,46712,48890,48921,48921,48921,48921,46745,44600,44600,44569,35862,31540,33652,54713,60955,50329,52440,61051,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,61083,61083,63131,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63131,56794,48216,54650,61020,46232,33589,33621,40246,44568,44568,44600,48921,48953,48953,48953,51001,46809,44632,54874,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60924,56412,54300,50714,48953,44760,21777,17616,17616,19761,21874,21874,23954,23954,23955,23955,21907,21907,21906,23955,23955,23987,23987,23987,23987,23955,23954,23954,23954,21906,21906,21874,21874,21874,21874,21874,21874,21874,21875,21907,21907,21907,21907,21907,21906,21906,21906,21906,21906,21907,21907,21907,23987,23987,23955,23955,23955,23955,23955,23955,23955,23955,23955,21875,17649,15568,15536,30132,48953,50938,54589,54301,54427,61018,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56954,46712,46744,50970,51002,51002,51002,51002,46745,44536,44536,44505,35862,31540,33652,54713,60955,50329,52440,61051,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,63131,63099,63131,63131,63099,63099,63099,63099,63099,63099,63131,56794,48216,54650,61020,46232,33589,33621,40247,44568,44568,44600,48921,48953,48889,46777,46777,46745,46680,54874,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60955,56507,54428,34005,21681,25809,36341,34325,21777,19697,19697,17680,19729,19729,17713,17681,17681,17681,17681,17681,17681,17713,17713,17713,17681,17681,17681,17681,17681,17649,17649,17649,17649,17649,17649,17649,17649,17649,17649,17649,17649,17649,17649,17649,17649,17649,17649,17649,17649,17681,17681,17681,17681,17681,17681,17649,17681,17681,17681,17649,17649,17649,17649,17681,17648,26003,34325,30100,23729,25746,48281,56445,56602,61018,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56954,46680,46712,48825,48793,48825,50970,50970,46745,44536,44536,44505,35862,31540,33652,54713,60955,50329,52440,61051,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61083,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48216,54650,61020,46232,33589,33621,40247,44568,44568,44600,48889,48953,46745,42455,42456,44632,44665,52858,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63067,61019,25683,4812,15245,44728,44792,26035,23922,23922,21906,21906,21906,23922,21874,21874,21874,21874,21874,21874,21874,21874,21874,21874,21874,21874,21874,21874,21874,21874,21874,21874,21874,21906,21906,21906,21874,21874,21874,21874,21874,21874,21874,21874,21874,21874,21874,21906,21906,21906,21874,21874,21874,21906,21874,21874,21874,21874,21874,21874,21874,21874,21874,21874,36470,46905,30036,4811,8908,46390,60987,61019,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56954,46680,46681,44536,42456,44600,50970,50970,48793,44536,44537,44505,35862,31540,33652,54713,60955,50329,52440,61051,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,48216,54650,61020,46264,33589,33589,40247,44568,44568,44600,48889,51001,46745,42455,42456,42584,44665,52858,63099,63099,63131,63131,63099,63099,63131,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,42168,31637,33781,32020,27955,21777,21777,21777,21778,21778,21778,21746,21746,21746,21746,21746,21746,19697,21746,21746,21746,21746,21746,21746,21746,21746,21746,21746,21746,21746,21714,21714,21714,21714,21714,21714,21714,21714,21714,21714,21714,21746,21746,21746,21746,21746,21746,21746,19698,19698,19698,19698,19698,19698,19698,19698,19698,19698,19698,19730,17682,19730,25939,30068,31893,31606,33685,54713,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56954,46680,46681,44536,42456,44600,50970,50970,48793,44536,44537,44505,35862,31540,33652,54713,60955,50329,52440,61051,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63131,56794,48216,54650,61020,46264,33589,33589,40247,44568,44568,44600,48921,51002,46745,42455,42488,42584,44697,52858,63099,63099,61018,60986,60954,60954,60954,60954,60954,60954,60954,60954,60954,60954,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56636,56446,50301,21296,13037,13070,13070,13070,13102,13070,13102,13102,13102,13102,15151,15151,15151,15119,15119,15119,15119,15119,15120,15088,17136,17136,15088,15088,15088,15088,15088,15088,15088,15088,15088,15088,15088,15088,15088,15088,15088,15088,15088,15088,15088,15088,15088,15088,15120,15120,15120,15120,15120,15120,15120,15120,13071,13071,13071,13071,13071,11023,10991,10991,33590,54334,54429,58907,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61019,60954,60954,60954,60954,60954,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56986,46712,46681,44537,44504,46648,50970,50970,48794,44536,44537,44505,35862,31540,33620,54713,60987,50329,52440,61051,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63131,63131,56794,48216,54650,61020,46264,33589,33589,40183,42456,42456,44536,46713,48793,46617,40343,40344,42488,42520,52793,63099,61019,52407,45973,48021,50102,50135,50135,50103,50103,50103,50070,47990,48085,58874,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63098,60955,58811,54461,46106,44058,44058,44026,44058,44026,44026,44058,44058,44058,44058,44058,44058,44058,44058,46106,46106,46106,46106,46106,46106,46106,46106,46074,46074,46074,46074,46074,46074,46074,46074,46106,46106,46074,46074,46074,46074,46074,46106,46106,44058,46106,46106,46106,46106,46106,46106,46106,46106,46106,46106,46106,46106,46074,46074,46074,46074,44026,44026,43994,43994,50203,56700,56763,61019,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56601,52183,52183,52150,50102,50166,58841,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56954,46616,44536,44440,42360,44472,48761,48762,46649,44472,44472,44441,33782,31540,33620,54713,60987,50329,52440,61051,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,56794,48216,54650,61020,46264,33589,33589,35862,40183,40183,40183,40183,40183,40183,40182,40182,40182,38102,50584,63099,61019,50230,43732,45812,47925,49974,49974,47926,47926,47926,45813,45780,45908,58874,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63067,56572,56446,56446,56446,56445,56445,56445,56445,56445,56445,56445,56445,56445,56445,56445,56477,56477,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56478,56446,56446,56446,56446,56446,56446,56446,56414,54461,60987,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56536,49974,52054,49974,47894,47957,58809,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56922,42231,40151,40151,40119,40151,40151,40151,40151,38135,40183,40152,33685,31540,33620,54713,60987,50329,52440,61051,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63099,63099,63131,63099,63099,63131,63131,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,56794,48248,54650,61020,46264,33589,33589,35830,40151,40150,40150,38134,38134,38102,38102,38102,38102,38102,50584,63131,61019,54359,50006,50006,52119,54167,54167,54167,54167,52119,50006,47893,47989,58874,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,60923,58843,58843,58843,58843,58843,58843,58843,58843,58843,58843,58843,58843,58843,58843,58843,58843,58843,58843,58843,58843,58843,58843,58843,58875,58875,58875,58875,58875,58875,58875,58875,60923,60923,60923,60923,60923,60923,60923,60923,60923,60891,60891,58843,58843,58843,58843,60891,60891,60891,58843,58843,58843,58843,58843,58843,58843,58811,58811,58811,58811,58811,58811,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56569,54200,54200,52055,49942,50006,58809,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56923,42231,40119,40119,40119,40151,38103,38103,38103,38103,40151,40120,33685,31540,33620,54713,60987,50329,52440,61051,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63131,63131,63131,63099,63099,63099,63131,63131,63131,63131,61083,63131,63099,63131,63131,63099,63099,63131,63131,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56826,48248,54650,61052,46264,33589,33621,35830,40151,38102,42359,44600,44568,42327,38103,38103,38103,38071,50584,63131,63099,56473,54200,54200,56281,58361,58328,58361,58361,58328,54135,52054,50102,60922,63131,63099,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63099,63099,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58618,56313,56313,52088,49974,50038,58809,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,56923,42231,40119,40119,40119,38134,42488,44600,42392,38103,40151,40120,33685,31508,33620,54714,60955,50329,52440,61051,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099,63131,63131,63131,63131,63131,63131,63131,63131,63099,63099,63131,61083,63131,63131,63131,63099,63099,63131,63131,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56826,48248,54650,61052,46264,33589,33621,35830,40151,38102,42487,48953,48921,42424,38103,38103,38103,38071,50584,63131,61051,56473,54200,54200,56281,58329,58329,58329,58328,58328,54135,52054,50070,60922,63131,63099,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63098,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63098,63131,63131,58650,56313,56313,52119,49974,50038,58809,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,56923,42231,40119,40119,40119,40246,46809,48953,46649,38103,40151,40120,33685,31508,33620,54714,60955,50329,52440,61051,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,61083,61083,61083,63131,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63131,63131,63131,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56826,48248,54650,61052,46264,33589,33621,35830,40151,38103,42392,44633,46681,42360,38103,38103,38103,38071,50584,61083,61051,56441,54200,56248,58329,58329,58329,58297,58329,58329,54135,52055,52118,60922,63131,63099,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61018,46359,44214,41974,39765,39765,37652,35571,35603,39957,40021,46326,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,56923,42231,40119,40119,40119,40215,44568,46681,44472,38103,40151,40119,33685,31508,33620,54714,60955,50329,52440,61051,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,61083,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61083,63099,63099,63131,61083,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63131,61083,61083,63131,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56826,48248,56698,61052,46232,33589,33621,35830,40151,40151,38103,38134,38103,38103,38103,38103,38103,38071,50584,61083,61051,56473,54200,54232,56280,58329,58329,58329,58329,56313,54167,52055,52150,58874,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63035,63035,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099,63098,63098,63098,63099,63098,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56890,27409,21071,21072,21071,21071,21072,21072,19024,19023,18990,31569,61018,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56923,42231,40119,40151,40119,40151,38103,38103,40151,38103,40151,40119,33685,31508,33620,54714,60987,50329,52440,61051,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,61083,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63131,63131,63131,63131,63131,63099,63099,63099,61083,63131,63131,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56826,48248,56698,61052,44184,33589,33621,35862,40151,40151,38103,38103,38103,38103,38103,38103,38103,38071,50584,61083,61051,48246,37716,37748,40021,40086,40086,40086,40086,40086,39828,37684,41876,58906,63131,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,60987,60859,60860,60987,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61051,56858,54777,56858,61051,61051,61051,61051,61051,61051,61051,61051,56857,54777,56857,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58906,33620,29362,23152,16943,16943,16943,16943,18991,25234,27281,37811,61019,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56923,42231,40119,40151,40119,40151,38103,38103,38103,38103,40151,40119,33685,31508,33620,54714,60987,50329,52440,61051,63131,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63131,63131,63131,63131,63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56826,48248,56698,61052,44184,33589,33621,35862,40151,40151,38103,38103,38103,38103,38103,38103,38103,38071,50553,61083,61083,38004,14925,14989,17488,19729,19729,19729,19729,19698,19279,17006,27440,58938,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63098,63098,63098,63003,60764,60764,60987,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56890,23311,14893,27376,54748,58876,58939,59035,59035,58908,56797,54684,27442,17038,25360,58905,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,60987,56412,54301,25233,6507,6507,6507,6507,10636,46009,54332,56571,61019,63099,63099,63099,63099,63099,63099,61051,61051,61051,61051,61051,61051,63131,63131,56891,42231,40119,40151,40151,40151,38103,38103,38103,38103,40151,40119,33685,31508,33620,54682,60955,50329,52440,61051,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56826,48216,56698,61052,46232,33589,33621,35862,40151,40151,38103,38103,38103,38103,38103,38103,38103,38070,48536,59067,59099,40181,14988,17068,19535,21777,19729,19729,21745,21745,19310,17069,25456,54874,57018,59034,61083,63099,63099,63099,63099,63099,63099,63099,63099,63099,63003,63002,63002,63002,60827,58525,58525,60795,63003,63002,63002,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56890,14957,6506,21102,54716,58845,58971,59131,59131,58940,56765,52604,21168,10732,21166,56825,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63067,58620,56508,27378,4458,6507,6507,4458,10636,48121,56508,58715,63067,63099,63099,63099,63099,63098,61051,50520,46360,46361,46361,46360,50553,61051,63131,56891,42231,40119,40151,40151,38103,38103,38103,38103,38103,40151,40119,33685,31508,33620,54682,60955,50329,52440,61051,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63131,63131,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58843,48216,56698,61051,46232,33589,33621,35862,40151,40119,38103,38103,38103,38103,38103,38103,38070,38070,46520,55034,55066,50841,44535,44534,44662,44694,44694,44726,44694,44663,38294,34101,38230,46648,48728,50744,59002,63099,63099,63099,63099,63099,63099,63099,63099,63099,60922,62939,62939,62970,60764,58430,58429,60731,62939,62938,62970,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,61083,61083,56890,17006,8555,23151,54716,58845,58972,59131,59132,58941,56765,52636,23216,12780,21134,56858,63131,61083,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61019,61019,37877,12621,12653,12653,10605,16845,52568,61019,61019,63099,63099,63099,63099,63099,65146,61018,44279,40087,40087,40055,40054,46359,61051,63131,58938,42231,40119,40151,40151,38103,38103,38103,38103,38071,38071,38039,33685,31540,33620,54714,60987,52377,52440,61019,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58843,50265,56698,63099,46231,33588,33621,35862,40151,40119,38103,38103,38103,38103,38103,38103,38070,38070,46551,53050,55098,55130,55130,55130,53114,53114,53114,53114,55161,55130,46744,42551,42551,42551,42519,44567,59002,63099,63099,63099,63099,63099,63099,63099,63099,63099,63066,63034,63034,63066,60827,58461,58492,60859,63066,61018,63066,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,58971,35957,31731,33813,37942,37879,44120,56733,56733,58845,56860,56860,56765,56734,56701,42072,37815,35734,33812,31763,35956,58938,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,54459,45787,45787,45787,45786,45881,58842,63131,63099,63099,63099,63099,63099,61018,58938,54810,42263,40118,40119,40087,42134,46327,54779,56858,52698,40151,40119,40151,38103,38071,38071,38071,38071,38071,38071,38039,33685,31541,33620,54714,60987,52377,52440,61019,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,50265,56698,63099,46231,33588,33620,35862,40151,38102,38103,38103,38103,38103,38103,38103,38070,38070,44503,50937,36244,34163,34163,34163,34164,34164,34164,34196,34196,34164,27922,25810,25810,27923,40471,42551,59002,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,60923,58620,58683,60986,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56890,19151,8717,17039,50491,58782,56702,56702,56702,56702,56701,56701,56702,56702,56702,56670,56575,48220,17039,10829,19118,56825,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,54523,47964,47964,47932,45884,45978,56826,63131,63131,63099,63099,63099,61051,48504,42199,40150,40279,42359,42327,40119,40087,40087,40054,35861,35894,40119,40151,40151,38103,38071,38071,38103,38071,38071,38071,38039,33685,31540,33620,54714,60987,52377,52440,61019,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58842,50265,56698,63099,46231,33588,33620,35862,38102,38102,38103,38103,38103,38103,38103,38103,38070,40118,46551,44663,11051,4810,6858,6858,6858,6890,6890,6858,6858,4810,4777,4745,2697,11052,38390,42551,59002,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61019,60923,60922,61018,63131,61083,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56890,19184,8749,17039,50491,56701,56701,56702,56702,56702,56702,56701,56702,56702,56702,56670,56543,48188,17072,10829,19150,56825,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,38071,19186,19218,19218,19218,23410,54777,63131,63131,63099,63099,63099,61051,46424,38039,40151,42391,42424,42360,40119,40087,40119,35926,33781,33814,40119,40151,40151,38103,38071,38103,38103,38071,38071,38071,38039,33685,31540,33620,54682,60955,52377,52440,61019,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58842,50265,56698,63067,46231,33589,33621,35862,38070,38070,38070,38070,40119,40119,40119,40119,40119,40119,46552,44727,13356,9195,11275,11275,11275,9227,9195,7082,7082,7082,4938,4874,4874,11149,38358,42551,59002,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56890,19184,8749,17040,52476,58686,56638,56638,56638,56638,56638,56638,56638,56638,56638,56606,56479,48188,19120,10829,19118,56825,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,33973,13039,13071,13071,13071,19279,54776,63131,63099,63099,63099,63099,61051,46424,38071,40214,42423,42455,42392,40119,38071,38102,36054,35989,35958,38039,38039,38071,40151,38103,38103,38103,38071,35894,35862,35862,33653,31541,33621,56730,60955,52377,52440,63067,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58842,48216,56666,63067,46231,33589,33621,35830,38038,38038,38070,40150,40151,40151,40119,40151,40151,40119,46552,44791,22032,19983,19983,19983,19983,19983,19951,13612,13580,13549,9261,7149,7149,13358,36342,42519,59002,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56890,19184,10797,17008,50268,56479,56479,56447,56447,56447,56447,56447,56446,56446,56446,56446,56447,48188,19120,10829,19118,56825,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61082,44439,31923,31955,29907,29907,34035,56889,63131,63099,63099,63099,63099,61051,46456,38071,42327,48825,50873,46617,40151,38071,40247,42488,42488,40247,31700,31668,35894,40151,40151,38103,38103,38038,33748,33717,33685,31573,33589,33621,56730,60955,50329,52440,63067,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58842,48216,56666,63067,46232,33589,33621,33813,35990,35990,35990,40150,40151,40151,40151,40151,40151,40151,44504,44791,22064,19983,20016,19984,19983,19983,19951,15693,13612,15629,9293,7149,7149,13358,36310,42519,58970,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,61116,61116,63131,63099,63099,63099,63099,63131,63130,63098,63098,63098,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56890,19184,10797,17008,48220,54463,54431,56447,56447,56447,56447,56447,56415,56415,56415,56415,56447,50269,19120,10829,19118,56825,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61082,48728,40470,40470,42518,42486,46614,59002,61083,61083,63099,63099,63099,61083,46456,40151,42327,48826,50906,46649,40151,40119,40247,44568,44600,40279,31668,31636,35894,40151,40151,38103,38103,38006,33717,33685,33684,33621,33589,33621,56730,60955,50329,52440,63067,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,48184,56666,63067,46232,33588,33621,33845,36086,34037,36054,40151,40151,40151,40151,40151,35926,33813,42359,44791,22064,19983,19983,26129,38516,38516,34419,21999,19950,19919,11405,7149,7149,13358,36310,42519,58938,63067,63067,63067,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61018,61051,63131,63131,58938,46359,44279,50519,61050,63099,63099,63099,63131,63066,64922,64858,62906,63098,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56890,19184,10797,14959,37848,42010,46108,56447,56447,56447,56415,56415,56415,56415,56415,46075,41945,35768,17039,10829,19118,56825,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56922,50712,50712,40438,34261,34261,34261,34260,36309,44568,48664,54841,63131,63099,63099,61051,46424,38007,40151,44408,44408,44376,48441,48472,44344,40215,40215,38039,31668,31636,35894,40152,40151,38103,38070,40086,42134,44215,44183,35734,33589,33621,56730,60955,52377,52440,63067,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,48184,56666,61020,46232,33620,33621,36022,36278,36278,38198,40151,40151,40151,40151,40151,25362,21103,38133,44791,22032,19984,19983,32307,57147,57179,51000,26160,20014,19983,11405,7149,7149,13358,36310,42487,58906,63035,63035,63035,63067,63067,63099,63099,63099,63099,63099,63099,63099,63099,63099,61018,58873,61018,61083,63163,50552,14731,8457,25229,61018,63099,63099,63099,63099,63034,64794,64730,62778,63066,63130,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56890,19184,10798,10798,14863,16847,29300,54366,56447,56415,56415,56415,56415,56415,54367,27411,12910,12910,10862,10861,19118,54777,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63098,63130,61082,59067,57019,54970,52954,34387,24112,24112,24113,24145,28178,40534,44599,50713,59035,61083,61050,61051,46392,37975,37975,40087,40087,44280,56859,58907,50554,33782,33782,33749,31668,31636,35894,40152,40151,38071,38070,44247,54746,61020,58940,39926,31509,35669,56761,60955,52345,52440,63067,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,48184,56666,61020,46232,33620,33652,34005,36309,34293,36182,40151,40151,40151,40151,40151,25361,19022,38101,44791,22032,19984,19983,32307,57147,57147,51000,28208,19982,19951,11405,7149,7149,13358,36310,42487,56826,63003,63003,63003,63035,63067,63099,63099,63099,63099,63099,63099,63131,63131,63099,60987,58842,60986,63163,63163,50552,10571,6345,23118,61050,63131,63131,63099,63099,63035,64794,64730,62778,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,56890,23344,14958,14990,17006,16974,29395,54430,56479,56447,56415,56415,56415,56415,54398,29492,14990,17070,15022,14990,23279,56825,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,52888,36468,36436,46776,59195,57147,34483,22160,22160,22159,22191,26225,48888,53018,38390,36245,46551,59034,61051,46360,37974,37974,42135,42167,46328,60891,60923,52602,35893,35893,35861,33780,33780,35958,40183,40183,40183,40150,44279,54714,60956,58875,42006,33589,35669,56762,60955,52345,52440,63067,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,48184,56666,61020,46232,33620,33652,34005,34294,34293,38230,40183,40184,40184,40184,38104,25361,19023,38101,44759,22032,19984,19984,30258,46870,48950,42772,26159,19982,19951,11405,7149,7149,13358,36310,42487,56826,62971,62971,62971,62971,62971,63067,63131,63099,63099,63099,58938,40052,35891,44117,58650,60666,54521,46263,46263,46167,37586,35473,37650,42069,42069,46294,61019,63099,63035,64794,64730,60601,39989,35860,39989,58938,63099,63099,63099,63099,63099,63099,63099,63099,63099,61051,54777,52664,52664,52664,52665,48409,35638,33558,41881,56447,56447,46043,35639,35639,46263,52632,52632,52632,52632,54712,61018,63099,63099,63099,63099,63099,63099,63099,63099,63035,60955,61019,61115,61147,61147,61147,61115,61051,61019,61019,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,46743,22096,24080,38549,57146,57147,44758,38581,38613,28369,22159,24208,30386,32435,26097,27985,40341,59034,61051,46360,37974,40054,54681,56826,58778,60603,60572,56730,54906,54906,54906,54906,54906,54938,54970,54970,54970,54939,56923,58747,60636,60667,56794,42041,35638,56762,60955,52345,52440,63067,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,48184,54650,61020,46232,33589,33620,29747,25778,23730,25682,27699,27699,33942,40184,38104,25329,18991,38101,44759,22032,19984,19984,28208,40658,40689,36593,26158,22030,19951,11405,7149,7149,13358,36310,42487,56794,62907,62907,62907,62907,60859,60986,63131,63131,63099,63131,54745,19021,12715,25103,56281,60410,48023,27217,27185,43829,64698,64698,52247,20975,16846,27311,58938,63099,63035,64794,64730,60569,23087,10637,18958,54745,63131,63099,63099,63130,63131,63099,63099,63099,63099,63099,63131,63131,63131,63099,61116,48538,16878,10669,27284,54399,56479,35639,14799,16879,46294,65147,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63099,63130,63130,60828,58652,56827,59131,59163,61211,61179,61179,58907,58780,58843,63098,63130,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,46743,24144,24113,38581,53082,55098,55098,55098,55098,36596,24207,24208,24207,24208,24049,27986,40341,56986,61019,46360,37942,42070,58874,63067,62939,60540,60476,58779,59163,59163,59164,59164,59164,59196,59163,59163,59195,59164,59100,60731,60508,60603,61019,44154,35638,56761,60955,52345,52440,61051,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63099,63099,63099,63131,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,48184,54650,61052,46232,33589,33621,19183,6826,6826,6826,4746,6762,25554,40184,40152,25329,18991,36053,44759,22065,22032,22033,28209,38610,40658,36561,26127,21999,19951,11405,7149,7149,13358,36309,42455,56762,62907,60859,60859,60827,60827,58907,59003,61051,63067,63099,54713,21005,16747,27151,56281,60410,47991,27217,27153,43829,64699,64699,52248,22991,20910,29328,58842,60987,62971,64762,64698,58489,23088,14766,21007,54713,63067,61018,58970,58970,61050,63099,63099,63099,63099,63099,63098,63098,63098,63098,61083,50553,21038,16877,29363,50269,50301,33590,16847,18926,48310,65146,63066,63066,63099,63131,63131,63099,63099,63099,63099,63099,61019,60987,60987,58812,58716,56827,59100,59100,59100,59100,59099,58876,58780,58844,61051,61051,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,46743,24144,24145,36533,51032,53081,53081,55098,55098,38644,24208,24208,24208,24208,24049,27986,40373,59034,61019,46360,37942,40022,58874,63067,62939,62588,62556,60763,61083,63131,63131,63131,63131,63131,63131,63131,63131,61083,61051,62716,62524,60603,61019,44154,35670,56761,60955,50297,52440,61050,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,48184,54650,61052,46232,33589,33621,19248,8971,6954,8971,6955,6955,21553,34069,34037,23281,18991,36020,42647,15694,13614,15662,21871,30223,30223,28111,17677,13517,13517,9196,5003,5003,11213,34229,40406,56793,60923,60923,60923,60923,60891,42069,29521,35698,56601,60762,58618,46005,43893,45942,54201,56249,52183,46038,48085,48022,50007,52120,52152,39668,39667,41748,52216,52247,52215,52151,52151,50071,41748,39667,41780,50199,52312,48183,29490,27376,40020,61083,63099,63099,63099,63099,63131,63163,63131,63034,62970,60890,54551,54584,42038,18993,18959,33619,48311,48278,58809,63066,63066,63099,63131,63131,63131,63099,63099,63099,63099,63099,56604,54301,54491,59035,59035,56764,54461,54461,54461,54461,54461,56636,60892,58812,56573,54429,54522,61018,63099,58971,54746,58938,63099,63099,63099,63099,63099,46743,24145,24145,30354,34516,36564,36564,46839,55130,38644,24208,24208,24207,24208,24049,27986,40373,59034,61019,46360,35862,40022,58874,63067,62939,62588,62524,60730,63002,65050,65050,65050,65050,65050,65050,65018,65018,64986,64986,62683,62524,60603,60987,44154,35670,56729,60955,50297,52440,61051,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,48184,54650,61020,46232,33589,33620,25587,21808,21936,23984,23984,23984,36372,44694,44631,27474,18959,36020,40534,9292,7212,7180,21806,36497,36497,26031,11372,9260,11309,4971,2858,2858,7019,32148,40406,56857,63066,63066,63066,63066,61019,33650,16845,23055,54328,62586,60538,64731,64763,60538,54168,54136,56344,64858,64858,52216,35381,41622,50007,52119,50071,52119,52087,50039,50039,50038,50038,50039,50071,50071,50071,50039,50039,43862,23120,18957,33746,61084,63099,63099,63099,58970,46391,44278,48375,60730,62778,62810,65018,65051,46263,12717,12652,39892,65051,65018,65018,63002,63002,48439,46326,46390,58938,63099,63099,63099,63099,63099,54492,52158,54491,61115,61147,56733,54270,54270,54270,54270,54270,56572,60923,58812,54333,52125,52251,60986,63099,56826,44248,46360,58906,63099,63099,63099,63099,46743,24145,24145,24176,24176,24176,26224,30386,36595,30385,24208,24207,24207,24208,24049,27986,40373,56986,61019,46360,35862,40022,58842,63067,62938,62588,62524,62746,65018,65018,65018,65050,65050,65050,65050,65018,65018,64986,64986,62683,62524,60603,60987,44154,33622,56729,60955,50297,52440,61051,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63131,58842,48184,54650,61020,46232,33557,33620,27699,30162,30322,28241,28241,28209,44758,55130,55066,29555,18958,36020,40566,11341,7212,7180,21807,38577,36497,23951,13420,11308,9261,4971,2826,2858,7020,30068,38326,56890,61051,63099,63098,63098,61019,33651,16878,23088,56376,62586,62586,64699,64731,60506,54168,54136,56344,64826,64858,50168,35381,39542,50007,50039,50038,52086,52086,50039,50071,50039,50039,50039,50039,50039,50039,50039,50039,45910,23120,18990,35794,61084,63131,63131,63131,54810,21168,16942,25200,56345,60505,60633,64986,65051,46231,12717,14732,39891,65018,64954,64890,64826,60697,27376,19022,21166,52664,63131,63131,61083,61083,61083,54493,52158,54492,59036,59068,56701,54270,54270,54270,54270,54270,56540,60892,58812,54333,52126,52252,60987,63131,54779,44248,44248,54778,61051,61051,63099,63099,46743,24145,24176,24176,24176,24176,24208,24207,24207,24208,24208,24207,24207,24208,24049,28018,40405,54970,59035,46360,35894,40022,58874,63067,62939,60603,60539,60730,62970,62970,62970,65050,65050,65050,65050,65050,62970,62938,62938,60635,62524,60571,60923,44121,33622,56729,60955,50297,52440,61050,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63131,63131,63131,63131,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63131,58842,48184,54618,61020,46232,33557,33588,38165,44790,36531,34418,34418,34418,46838,55129,53018,25490,12813,31923,40566,11341,9260,7180,21807,36466,34450,23984,11372,9260,9261,4971,2826,2826,7020,28019,32116,38037,40022,46392,54842,54874,54842,31603,16878,25136,56409,64666,64666,64699,64731,60506,54168,54136,56344,64826,64826,50137,35382,39574,54264,56344,54264,52119,52087,50039,50039,52119,54200,54199,56279,56312,56312,54200,54200,48023,23152,18990,31666,52762,52730,52762,52762,46489,21168,16942,25200,56345,60506,62618,64794,64858,54585,40085,42132,52439,62746,64762,60537,58392,54296,25265,16974,21166,52664,63131,61083,52697,46392,46361,50237,54175,54238,52253,52253,52220,56413,58461,58461,58461,56382,54269,54301,54301,52062,52030,50108,48505,48569,46456,42231,42263,42167,37909,37941,54745,63099,46743,24177,24176,28305,34482,34482,34514,30384,24207,24207,24207,24208,24208,24176,26097,28050,34260,44663,46680,35957,27442,31603,46360,48473,52569,60826,62874,41972,21005,18957,39858,65050,65050,65050,65050,65050,35730,16877,18957,47991,62492,58395,52281,39863,35670,56729,60955,50297,52440,61050,63130,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63131,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,48152,54618,61020,46232,33557,33620,44503,48984,42740,40659,40659,40659,44756,46838,46838,15214,2538,29842,40567,11373,9260,9260,11373,15533,15533,13453,11340,9261,9261,4971,2826,2826,7020,23890,27955,25361,25233,33780,46585,46585,46553,27475,16878,27216,58489,64731,64698,64699,64731,60506,54168,54136,56312,64730,64730,50073,35382,43702,62650,64762,62650,52184,50038,50006,47958,54200,58393,60441,62618,64730,64698,60474,58426,52217,25201,18990,27506,40280,40280,40280,42328,38135,19120,16942,25200,56345,62522,62586,64699,64730,62874,63131,63131,62875,64667,64667,60441,56281,54232,27313,16974,21166,52664,63163,61083,46360,35893,37911,48060,54175,52094,49886,49885,50012,58525,60573,60573,60573,58494,52125,49949,49949,49918,51967,47996,42200,40215,40215,40215,40247,31700,21072,23151,48472,61083,46743,24177,24176,34482,48950,48951,46934,36627,24175,24207,24207,24208,24208,24177,26098,26002,30163,36437,38454,29683,23184,25297,38007,40152,46327,60922,65051,33617,6,5,27278,65050,65050,65050,65050,65050,23150,39,2119,41686,62493,58332,50072,37718,33653,56729,60955,50297,50360,61050,63130,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58810,48152,54618,61020,46232,33557,33620,44535,48984,42740,40659,40659,40659,42707,44755,42676,15181,2538,29874,40567,11373,9260,9260,9260,9260,9260,9260,9260,9261,9261,4971,2826,2826,7020,23890,25875,25361,25265,33780,44472,44472,42424,27474,18927,27216,58489,64730,64698,64698,64699,60506,54168,54136,56312,64698,64698,50041,37398,43702,62650,64762,62650,52184,50039,47926,47894,54200,58394,60441,62650,64730,64698,60474,58426,52216,25201,18990,27506,40280,40280,40280,42328,38136,19120,16942,25200,56345,62522,62554,64698,64698,64890,63098,63099,62843,64667,64667,60442,56313,54264,29361,19022,23214,52664,61115,61083,46360,35894,37911,48060,54175,52094,49917,49885,49980,58493,60573,60573,60573,58493,52125,49981,49981,49950,49950,45980,42232,40215,40215,40247,40247,31700,21104,23152,48472,61083,46743,24177,24176,34482,46901,44854,44885,34546,24176,24207,24208,24208,24176,24145,26066,26002,30163,38517,40534,29683,23184,25297,38007,40152,44280,58842,62971,33617,2086,2086,27310,62970,62970,62970,62970,62970,25231,2151,6248,39637,58396,56315,48024,37750,35701,56729,60955,50297,50360,61050,63130,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,48152,54618,61020,46232,33557,33620,44535,48952,36498,38546,40627,38578,38578,40691,38580,13133,2570,25746,36405,11341,9260,9260,9260,11308,11309,11309,11309,11309,9261,4971,2826,2826,4971,21842,25875,25361,25265,31732,42392,42392,42360,27474,18959,27248,60537,64730,64698,64698,64699,60506,54168,54136,56281,64698,64698,52057,37398,43702,62650,64730,62650,54232,50039,47958,47926,54200,58426,60473,62650,64730,64698,60474,60442,52216,25201,18991,27506,40280,40280,40280,40280,38136,21168,16942,25201,58393,62522,62522,64699,64699,64890,63098,63099,62843,64635,64667,60442,56313,50232,29361,21070,23214,52632,63131,61083,44344,35926,37942,37750,37686,43864,52187,54236,54268,60605,60604,60604,60604,60573,54300,52188,52188,39737,33494,33621,40151,40215,40215,40215,40215,31700,21072,23184,48472,59003,44694,26225,24176,28273,30354,30354,30354,26257,24208,24176,24176,24176,24177,24113,21938,21809,30163,42744,46841,31796,23152,25297,38007,40152,38006,31602,31569,37875,46229,46229,42004,27311,25264,27377,33715,39956,50358,48245,48277,35636,29363,29330,35637,35670,35701,56761,60987,50297,50360,61050,63130,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,58842,48152,54618,61020,46232,33557,33588,44535,44823,21935,34385,42707,38578,28207,24077,24015,8972,2569,17423,23890,11276,9196,9196,9196,9196,9196,9196,9196,9196,9196,4939,2794,2794,4971,21841,25875,25361,25265,31700,42392,42392,42360,27474,18959,27248,60537,64698,64698,64698,64699,60506,54136,54136,56281,64698,64698,52057,37366,43702,62618,64730,64731,62618,62586,60538,60538,62618,62618,62618,60505,60474,60474,60442,60442,52216,25201,18991,27538,40280,40280,38200,38135,36022,21168,16942,27249,58361,62523,62522,64699,64699,64890,63098,63098,64891,64635,64667,60442,56313,50233,29361,21070,23182,44279,50618,48569,42328,40183,40151,31603,27345,35635,60635,60668,60668,60668,60668,60636,62684,62684,62684,62684,60636,35702,23185,25330,38103,40215,40215,40215,40215,31700,21072,23184,48472,58970,44662,26257,24176,24177,24177,24177,24177,24177,24177,24177,24177,24145,22097,24114,21905,21809,32212,44792,48921,33844,23153,25297,38007,42200,35894,21135,19022,39988,63067,65115,48310,12651,10571,14764,23216,33619,62874,65018,65051,33651,16911,18959,29428,35670,35701,56761,60987,50297,50360,61050,63130,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61083,63131,63131,61083,63131,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56795,46136,52570,60987,46231,35636,33620,36212,34419,19854,32369,42738,38578,26158,17868,17805,6923,2569,13327,19761,4905,2793,745,2793,745,745,2793,2761,2761,2761,681,649,648,4874,21841,25875,25361,25265,31700,42360,42359,40311,27474,18959,27248,60537,64698,64698,64698,64698,60474,54136,54136,56281,64666,64698,52057,37366,43702,62650,64731,64731,64699,64699,64699,64699,64699,64731,64731,60474,58362,58394,60442,60442,52216,25201,18991,27538,40280,40280,38167,36023,33910,21168,16942,27217,58361,62491,64571,64699,64699,64890,63098,65114,62843,62620,64667,60474,56313,52281,29361,21070,21135,35990,40248,40248,42296,42264,44249,33620,29362,37684,58620,60700,60668,60668,60668,60668,60636,62684,62684,62716,60668,37719,27250,27379,38103,40215,40215,40215,40215,31700,21072,21136,46424,56955,42615,26225,24177,24177,24177,24177,24177,24177,24177,24145,24145,24146,24146,24114,21874,19729,30163,46872,48921,33844,23153,25297,38039,42200,37942,25231,21102,42036,63035,63035,48343,16780,14668,18893,29458,37812,62874,64986,62938,33651,18990,21039,31540,35766,37813,54682,58875,48248,48312,61050,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61083,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,46168,46199,48312,50488,54681,52632,32146,21903,21902,34417,42739,38610,28239,24078,26127,8972,2569,13327,21841,11309,11245,9197,9196,9164,9164,9164,9165,9165,9164,9132,9132,9132,11245,19761,23762,25329,25234,31700,42360,40311,40311,27474,16911,27248,58489,62650,62618,62618,64666,58426,52088,52088,54233,62619,62650,49977,37366,41623,58490,60570,60538,62586,62586,62586,62586,62586,62586,62586,60474,58362,58362,58394,58394,52184,25201,18991,27506,40280,40280,38135,36055,35990,21168,19023,27249,54202,58331,58395,60539,60539,60698,62937,62938,60666,56347,56347,52153,50073,46008,27313,21135,23215,38038,42328,42296,42169,44090,44058,37687,35510,39703,54300,54301,54301,54301,54301,54301,54301,56349,56349,56349,54301,41785,35511,35606,40151,40215,40215,40215,40215,31701,21072,21136,42295,50778,38422,19856,19824,19824,19824,19792,19792,17776,17776,17776,17775,22033,24146,24114,19825,19696,28083,42744,44760,31764,23185,25297,38039,42200,46200,52215,52215,56505,62843,62843,58618,50102,50070,52183,54329,56441,62778,64858,62778,43990,35636,37716,50520,54778,54714,50328,48248,46103,50360,61050,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,56794,46135,44087,44054,54617,63099,61083,38452,24015,23983,34450,42771,40690,32400,32399,32401,9036,521,13326,21874,21842,21841,21841,21841,21841,19793,19793,19793,19793,19761,19761,19793,19793,19793,19793,21713,25329,25234,31700,42360,40312,40312,27475,16943,23088,41782,45911,47959,50039,50040,45848,37495,37495,41687,45943,45975,39575,33205,37430,43767,45879,47927,56313,58361,58361,58361,58361,58361,58393,58361,58361,58361,54168,54167,47990,25201,18991,27475,38135,38135,38103,36055,36055,33877,33845,35734,35414,35382,37494,39671,39704,48055,62680,62713,54232,43703,39575,35414,31254,29236,33685,38038,38037,40215,42328,42296,46107,47933,45884,43771,43771,45852,49981,49982,49950,49982,49982,49982,49982,49982,49982,49982,50013,45884,45852,41850,40151,40215,40215,40215,40184,31669,21072,21136,36022,42391,32116,17679,15599,15631,17679,17647,17647,15632,15632,13583,13583,19921,22034,22033,17680,15535,19761,24019,26036,23506,23185,25297,38039,42200,50328,64667,64667,62683,62779,62779,64763,64699,64699,64699,64667,64731,64859,64859,60666,50168,43927,43990,56826,61083,58971,48247,46071,46071,50359,63066,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58906,50424,50424,50424,54681,58939,58939,42485,30129,30129,38483,44725,42676,38482,36401,34322,13101,4586,17360,25907,23826,23826,23826,23826,23826,23826,23826,23826,23826,23794,23825,23825,23825,23825,21777,23730,25329,27314,33748,42328,42328,40280,27475,18992,23088,37588,39669,41718,43799,45848,39608,33334,33334,35478,39734,39734,35446,33204,35382,41687,41719,43799,54266,56346,56346,56346,56346,56346,56346,56346,56346,56313,50039,50039,43862,25201,21072,27507,38135,38103,38103,38103,38103,38103,38103,39960,33333,31221,33333,35510,35575,43895,60568,60601,48024,37494,35447,31286,29173,27156,37879,44344,42296,42264,42296,44313,46107,47933,45853,43739,45820,45852,47933,47965,47965,50013,50013,50013,50013,50013,50013,50013,50013,47933,45853,45947,42167,40183,40183,40183,40184,33717,23120,21136,35990,42360,34133,21745,19664,19664,19664,19664,19664,19665,17617,17616,17616,19697,19729,19729,19632,17520,19697,23924,23892,23474,25233,27346,40087,42200,50329,62618,62619,62683,62779,62779,62715,62651,62651,62651,62651,62683,62811,62811,58618,50231,46070,46102,54714,58939,58906,52536,50456,52472,54617,63098,63098,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,61083,61083,63131,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61051,61051,54618,46136,46136,52569,56921,56921,50584,42070,42070,40022,40021,39990,33620,29427,33685,35830,35829,35829,35829,35829,33781,35829,35829,35829,35829,35797,35797,33749,33749,33749,33781,33749,33621,33589,35766,37943,37943,37943,33653,31540,33588,37717,39766,39766,39798,41847,39767,35606,35606,37686,39766,37718,35606,35541,35606,37686,39734,39766,41879,41879,41879,41879,41879,41879,41879,41879,41879,41879,41847,41846,39798,33620,31540,33685,37910,37878,39958,39990,39958,39990,39991,39927,37718,37686,37686,35605,33525,37685,43926,41910,37686,33493,33493,33525,35606,35606,37814,42039,39991,39959,39959,39959,41912,41816,41816,39768,41816,41816,41817,41816,41816,41816,41816,41816,41816,41817,41817,41817,41816,41817,41816,39799,39894,39926,37878,37878,37878,35734,33556,31540,35798,37911,37878,33750,31733,31733,31701,31701,33781,33781,33781,31733,31733,33749,33749,33749,33749,33717,33749,35862,33814,33685,35637,33621,37847,39927,41943,46008,46007,46040,46072,46072,46072,46040,46040,46040,46040,46072,44056,44023,46134,54682,58906,56827,48344,46136,48279,58907,61051,63099,63099,63130,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,61083,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,61083,52570,43991,43991,54617,63131,63131,52601,39862,39863,39863,39863,39862,39830,39830,39798,37750,37782,39798,39799,39799,39798,37750,37751,37751,37750,37750,37750,37750,37750,37750,37750,37718,37750,37750,37782,37782,37782,37782,37782,37783,37782,37782,37782,37782,37750,37783,37783,37751,37783,37750,37750,37750,37750,37750,37750,37750,37750,37750,37750,35702,35702,35702,35702,35702,37750,37750,37718,37750,37750,37750,37750,37750,37750,37750,37782,37782,39862,39894,39894,39894,39895,39895,39895,39895,37814,33556,33556,33556,31508,31508,31508,31508,31476,35669,39863,39862,39862,39862,39830,39830,39830,39830,39798,39799,39799,39799,39799,39799,39799,39799,39799,39799,39767,39767,39767,39767,39767,39767,39799,39799,37750,37750,37750,37751,37751,37750,37750,37750,37750,37782,35702,37751,37751,37750,37750,37750,37750,37782,37783,37783,37783,37783,37782,37782,37750,37750,37751,39799,39799,39798,39798,39798,39798,37750,37750,37750,37750,37750,37750,37750,37750,37750,37750,37750,37750,37750,37750,37782,37782,39798,42005,58939,61083,61051,48280,43991,46135,58906,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63099,63131,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,56794,50424,50424,54649,54682,54682,48376,41974,41975,41975,41975,39894,39894,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39830,39830,39830,39830,39830,37782,37814,37782,37782,37814,37814,37814,37814,37814,37814,37814,37814,37782,37782,37782,37782,37782,37782,37782,37782,37814,37814,39862,39927,39927,39927,39927,39926,39926,39926,37846,33620,33620,33620,33620,33620,33620,33620,33588,35733,39894,39894,39894,39894,39894,39894,39894,39894,39894,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39830,39830,39830,39830,39862,37814,37814,37814,37814,37814,37814,37814,37814,37814,37814,39862,39894,39894,39894,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39862,39894,39894,39894,39894,39894,39894,42006,52569,52602,54682,52568,50456,52536,61018,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63131,63131,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,61083,61083,61083,52601,43991,41943,48344,56827,56826,56826,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56826,56826,56826,56826,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56826,56826,56826,56826,56826,56794,56794,56794,54745,54745,54745,54745,54745,54745,54745,54745,56794,56826,56826,56826,56826,56826,56826,56826,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56793,56793,56793,56793,56793,56793,56793,56793,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56793,56794,56794,56794,56826,56826,56826,56794,56794,56794,56794,56826,56826,56826,56826,56826,56826,56826,56794,56826,56826,56826,56826,58874,56826,54714,44054,41910,44022,58906,63131,63131,63130,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,54681,44055,44055,50457,58972,58972,61020,61019,61019,61019,61019,61019,61019,61051,61019,61019,61019,61019,61019,61019,61019,61019,61019,61019,61019,61019,61019,61019,61019,61051,61051,61051,61019,61051,61051,61051,61051,61051,61051,61051,61051,61051,61051,61051,61051,61051,61051,61051,61051,61051,61051,61051,61051,61051,61051,61051,61051,61051,61051,61051,61051,61051,61051,61019,61019,61019,61019,61051,61051,61051,61051,61051,61051,61051,61019,61019,61019,61019,61019,61019,61019,61019,61019,61019,61051,61051,61051,61051,61051,61051,61051,61051,61051,61051,61051,61051,61051,61051,61019,61019,61051,61051,61051,61051,61051,61051,61019,61051,61051,61051,61051,61019,61019,61019,61019,61019,61019,61019,61019,61019,61019,61019,61019,61019,61019,61019,61019,61051,61051,61051,61051,61019,61019,61019,61019,61019,61019,61019,61019,61019,61019,61019,61019,61019,61019,61051,61051,61051,61051,61051,61019,61019,61019,61051,61051,61051,61051,61051,61019,61019,61019,61020,61020,61020,61019,61019,61019,58907,46166,43990,46135,58906,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,61083,61083,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61018,58906,58906,54681,48280,48280,48280,46233,46233,46265,46265,46265,46233,46265,46265,46265,46265,46265,46265,46265,46265,46265,46265,46265,46265,46265,46265,46265,46265,46265,46265,46265,46265,46265,46265,46265,46265,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,48281,48281,48281,48281,48281,46233,46233,46233,48281,48281,48281,48281,48281,48281,48281,48313,48313,48313,48313,48313,48313,48313,48313,48281,48281,48281,48281,48281,48282,48282,46234,46234,46233,46233,46234,46234,46234,46234,46234,46234,46234,46234,46234,46234,46234,46234,46234,46234,46234,46201,46202,46234,46234,46234,46234,46234,46234,46234,46234,46234,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46233,46234,46234,46234,46234,46234,46234,46234,46234,46234,46233,44185,44185,48377,58874,58874,58874,61051,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,61083,63131,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,54649,42006,42007,42007,42008,44056,44056,44088,44088,44088,44088,44088,44088,44088,44088,44088,44088,44088,44088,42040,42040,42040,42040,42040,42040,42040,42040,42040,42040,42040,42040,42040,42040,42040,42008,42008,42008,42008,42008,42008,42008,42008,42008,42008,42008,42008,42008,42008,42008,42008,42008,42008,42008,42008,42008,42008,42008,42008,42008,44056,44056,44056,44056,44056,44056,44056,44056,44056,44056,44056,44088,44088,44088,44088,44088,44088,44088,44088,44088,44088,44088,44088,44088,44056,44056,44056,44056,44057,44057,44057,44057,44057,44057,44057,44057,44057,44057,44056,44056,44056,44056,44056,44056,44056,44056,42009,42009,42009,44056,44024,44056,42009,42009,42009,42008,42008,42009,42009,42009,42009,42008,42008,42008,42008,42008,42008,42008,42008,42008,42008,42008,42008,42008,42008,42008,42040,42040,42040,42040,42040,42040,42040,42040,42009,42009,42009,42009,42009,42009,42009,42009,42009,42009,42009,42009,42009,42009,42009,42009,42009,42009,42040,42040,42041,46232,61019,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63099,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,58939,54746,56762,56794,56794,56794,56794,56794,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56794,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56794,56794,56794,56794,56794,56794,56794,56794,56794,56794,56826,56826,56826,56826,56826,56826,56826,56794,56794,56794,56794,56826,56826,56826,56826,56794,56794,56794,56826,56826,56826,56826,56826,56794,56794,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56826,56794,56826,56826,56826,56826,56794,56826,61051,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,61083,63131,63131,63131,63131,63131,63099,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63130,63130,63130,63130,63130,63130,63130,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63130,63130,63130,63130,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63130,63130,63130,63130,63130,63130,63130,63131,63131,63131,63131,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63131,63131,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63131,63131,63099,63099,61083,63131,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,61083,61083,61083,61083,63131,63131,61083,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,61083,63131,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,61083,61083,63131,63099,63099,61083,61083,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63131,63131,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63099,63131,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63099,63099,63099,63131,63099,63099,63099,63131,63099,63099,63099,63131,63099,63099,63131,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63131,63131,63131},
-	{63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,61083,61083,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63099,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,61083,61083,61083,63131,63131,63131,61083,63131,63131,63131,61083,61083,63131,63131,63131,61083,61083,61083,63131,63131,63131,63131,63131,63131,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63099,63131,63131,63099,63099,63099,63099,63099,63099,63131,63131,63099,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,61083,61083,63131,61083,61083,63131,63131,63131,61083,61083,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131,63131},
-
-};
@@ -0,0 +1,172 @@
+/* BOARD FAIRNESS ANALYZER */
+// Screens generated boards for balance and writes the fair ones out as a seed catalog
+// (seeds.h) for filler.c. Candidate k is generateBoard(splitSeed(seed, k)); it is played
+// out by the alpha-beta player (ai.h) on both sides to a fixed depth, and the final
+// margin, player 1's cells minus player 2's, is its advantage. Boards whose margin lies
+// inside the window are kept. Candidates are handed out to a pool of threads one at a
+// time, and the catalog lists the kept boards in candidate order, so the same options
+// always give the same catalog whatever the number of threads.
+//
+// build: gcc -O2 -march=native -pthread -I. tools/fairness.c -o fairness -lm
+// usage: fairness [-n candidates] [-t threads] [-d depth] [-w window] [-c count] [-s seed] [-o file]
+//   keeps boards with |margin| <= window, at most count of them, and with -o writes them
+//   to file (-o seeds.h replaces the catalog filler.c plays); a catalog with no boards
+//   is never written, since filler.c picks boards modulo BALANCED_SEED_COUNT
+
+/* LIBRARIES */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "engine.h"
+#include "ai.h"
+
+
+/* ANALYZER INITIALIZATIONS */
+#define MAX_GAME_MOVES (BOARD_SIZE * BOARD_SIZE * 4) // longer games are scored as they stand
+#define FAIRNESS_TABLE_BITS 12 // 64 KB transposition table per worker, cleared every game
+#define MAX_MARGIN (BOARD_SIZE * BOARD_SIZE) // margins run from -MAX_MARGIN to MAX_MARGIN
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static long next, candidates = 10000; // next candidate to hand out
+static int depth = 8;
+static uint64_t seed = 1;
+static signed char *margins; // margin of every candidate
+
+
+/* ANALYSIS */
+// player 1's cells minus player 2's once both sides have played the board out
+static int boardMargin(Ai *ai, uint64_t boardSeed) {
+    Board board;
+    generateBoard(&board, boardSeed);
+    aiClearTable(ai); // the margin must not depend on what this thread analysed before
+    int currentPlayer = PLAYER1;
+    for (int moves = 0; !isGameOver(&board) && moves < MAX_GAME_MOVES; moves++) {
+        fill(&board, currentPlayer, aiChooseMove(ai, &board, currentPlayer, 0));
+        currentPlayer = (currentPlayer == PLAYER1) ? PLAYER2 : PLAYER1;
+    }
+    return calculateScore(&board, PLAYER1) - calculateScore(&board, PLAYER2);
+}
+
+static void *workerMain(void *arg) {
+    Ai *ai = arg;
+    for (;;) {
+        pthread_mutex_lock(&lock);
+        long k = next++;
+        pthread_mutex_unlock(&lock);
+        if (k >= candidates) return NULL;
+        margins[k] = (signed char)boardMargin(ai, splitSeed(seed, (uint64_t)k));
+    }
+}
+
+
+/* CATALOG */
+static bool writeCatalog(const char *path, long count, int window) {
+    FILE *file = fopen(path, "w");
+    if (!file) return false;
+    fprintf(file, "/* BALANCED BOARD SEEDS */\n");
+    fprintf(file, "// Generated by tools/fairness.c -n %ld -d %d -w %d -c %ld -s %llu: boards that end\n",
+            candidates, depth, window, count, (unsigned long long)seed);
+    fprintf(file, "// within %d", window);
+    fprintf(file, " cells when alpha-beta plays both sides to depth %d. Board k of the\n", depth);
+    fprintf(file, "// catalog is generateBoard(BALANCED_SEEDS[k]).\n\n");
+    fprintf(file, "#ifndef SEEDS_H\n#define SEEDS_H\n\n#include <stdint.h>\n\n");
+    fprintf(file, "#define BALANCED_SEED_COUNT %ld\n\n", count);
+    fprintf(file, "static const uint64_t BALANCED_SEEDS[BALANCED_SEED_COUNT] = {\n");
+    long written = 0;
+    for (long k = 0; k < candidates && written < count; k++) {
+        if (abs(margins[k]) > window) continue;
+        fprintf(file, "    0x%016llXULL, // margin %+d\n", (unsigned long long)splitSeed(seed, (uint64_t)k), margins[k]);
+        written++;
+    }
+    fprintf(file, "};\n\n#endif\n");
+    return fclose(file) == 0;
+}
+
+
+/* MAIN FUNCTION */
+int main(int argc, char **argv) {
+    int threads = (int)sysconf(_SC_NPROCESSORS_ONLN), window = 2;
+    long count = 1024;
+    const char *path = NULL;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:t:d:w:c:s:o:")) != -1) {
+        switch (opt) {
+            case 'n': candidates = atol(optarg); break;
+            case 't': threads = atoi(optarg); break;
+            case 'd': depth = atoi(optarg); break;
+            case 'w': window = atoi(optarg); break;
+            case 'c': count = atol(optarg); break;
+            case 's': seed = strtoull(optarg, NULL, 0); break;
+            case 'o': path = optarg; break;
+            default:
+                fprintf(stderr, "usage: %s [-n candidates] [-t threads] [-d depth] [-w window] [-c count] [-s seed] [-o file]\n", argv[0]);
+                return 2;
+        }
+    }
+    if (threads < 1) threads = 1;
+    if (candidates < 1) candidates = 1;
+    if (depth < 1) depth = 1;
+    if (window < 0) window = 0;
+
+    margins = malloc((size_t)candidates);
+    Ai *ais = calloc(threads, sizeof(Ai));
+    pthread_t *ids = calloc(threads, sizeof(pthread_t));
+    if (!margins || !ais || !ids) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    for (int t = 0; t < threads; t++) {
+        if (!aiInit(&ais[t], FAIRNESS_TABLE_BITS)) {
+            fprintf(stderr, "out of memory\n");
+            return 1;
+        }
+        ais[t].maxDepth = depth;
+    }
+
+    double start = wallSeconds();
+    for (int t = 0; t < threads; t++) pthread_create(&ids[t], NULL, workerMain, &ais[t]);
+    for (int t = 0; t < threads; t++) pthread_join(ids[t], NULL);
+    double seconds = wallSeconds() - start;
+
+    // how many boards landed at each margin, and how many are fair
+    long histogram[2 * MAX_MARGIN + 1] = {0}, fair = 0, player1 = 0;
+    for (long k = 0; k < candidates; k++) {
+        histogram[margins[k] + MAX_MARGIN]++;
+        if (abs(margins[k]) <= window) fair++;
+        if (margins[k] > 0) player1++;
+    }
+    if (count > fair) count = fair;
+
+    printf("%ld boards on %d threads in %.2f s (%.0f boards/hour) at depth %d\n",
+           candidates, threads, seconds, candidates / seconds * 3600, depth);
+    printf("player 1 ahead on %.1f%%, player 2 on %.1f%%, even on %.1f%%\n", 100.0 * player1 / candidates,
+           100.0 * (candidates - player1 - histogram[MAX_MARGIN]) / candidates, 100.0 * histogram[MAX_MARGIN] / candidates);
+    printf("margin:");
+    for (int m = -MAX_MARGIN; m <= MAX_MARGIN; m++) {
+        if (histogram[m + MAX_MARGIN]) printf(" %+d:%ld", m, histogram[m + MAX_MARGIN]);
+    }
+    printf("\n%ld boards (%.1f%%) within %d cells", fair, 100.0 * fair / candidates, window);
+
+    if (path && count == 0) {
+        fprintf(stderr, "\nno boards to write, %s left as it was\n", path);
+        return 1;
+    }
+    if (path) {
+        if (!writeCatalog(path, count, window)) {
+            fprintf(stderr, "\ncannot write %s\n", path);
+            return 1;
+        }
+        printf(", %ld written to %s", count, path);
+    }
+    printf("\n");
+
+    for (int t = 0; t < threads; t++) aiFree(&ais[t]);
+    free(ais);
+    free(ids);
+    free(margins);
+    return 0;
+}
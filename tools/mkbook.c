@@ -0,0 +1,221 @@
+/* OPENING BOOK BUILDER */
+// Plays self-play games on the catalog boards (seeds.h) and writes the opening book that
+// ai.h plays from (book.h). Both sides are the alpha-beta player to a fixed depth, and
+// in the first plies each move is a random legal color with some probability, so the
+// games of one board branch out. Every position of those plies is recorded with the
+// move played and the points the mover finally took (2 for a win, 1 for a draw).
+// The records are sorted by position, and every position reached by enough games
+// keeps its best-scoring move. Games are handed out to a pool of threads, and each
+// game draws from its own random stream, so the book does not depend on the number of
+// threads.
+//
+// build: gcc -O2 -march=native -pthread -I. tools/mkbook.c -o mkbook -lm
+// usage: mkbook [-g games] [-p plies] [-d depth] [-e explore] [-m min] [-b boards] [-t threads] [-s seed] [-o file]
+//   games per board, book plies, search depth, percent of random moves in book plies,
+//   games a position needs to be kept, catalog boards to cover (all by default),
+//   output file (book.bin by default)
+
+/* LIBRARIES */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "engine.h"
+#include "ai.h"
+#include "book.h"
+#include "seeds.h"
+
+
+/* BUILDER INITIALIZATIONS */
+#define MAX_GAME_MOVES (BOARD_SIZE * BOARD_SIZE * 4) // longer games are scored as they stand
+#define MKBOOK_TABLE_BITS 12 // 64 KB transposition table per worker, cleared every game
+
+typedef struct {
+    uint64_t key; // positionHash() with the mover to play, 0 if the game ended before this ply
+    int8_t move;
+    int8_t points; // 2 if the mover won, 1 for a draw
+} Record;
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static long next, games; // next game to hand out, and games over all boards
+static int gamesPerBoard = 32, plies = 12, depth = 6, explore = 30;
+static uint64_t seed = 1;
+static Record *records; // plies of them per game
+
+
+/* SELF-PLAY */
+static void playGame(Ai *ai, long game) {
+    Record *record = &records[game * plies];
+    Rng rng = newRng(splitSeed(seed, (uint64_t)game));
+    Board board;
+    generateBoard(&board, BALANCED_SEEDS[game / gamesPerBoard]);
+    aiClearTable(ai); // a game's moves must not depend on what its thread played before
+
+    int currentPlayer = PLAYER1, moves = 0;
+    for (; !isGameOver(&board) && moves < MAX_GAME_MOVES; moves++) {
+        int color;
+        if (moves < plies && rngBelow(&rng, 100) < explore) {
+            int legal[COLOR_COUNT], count = 0;
+            for (int c = 0; c < COLOR_COUNT; c++) {
+                if (c != board.territoryColor[0] && c != board.territoryColor[1]) legal[count++] = c;
+            }
+            color = legal[rngBelow(&rng, count)];
+        } else {
+            color = aiChooseMove(ai, &board, currentPlayer, 0);
+        }
+        if (moves < plies) {
+            record[moves].key = positionHash(&board, currentPlayer);
+            record[moves].move = (int8_t)color;
+        }
+        fill(&board, currentPlayer, color);
+        currentPlayer = (currentPlayer == PLAYER1) ? PLAYER2 : PLAYER1;
+    }
+
+    int margin = calculateScore(&board, PLAYER1) - calculateScore(&board, PLAYER2);
+    for (int k = 0; k < plies && k < moves; k++) {
+        int mover = (k % 2 == 0) ? margin : -margin; // player 1 moves on even plies
+        record[k].points = (int8_t)((mover > 0) ? 2 : (mover < 0) ? 0 : 1);
+    }
+}
+
+static void *workerMain(void *arg) {
+    Ai *ai = arg;
+    for (;;) {
+        pthread_mutex_lock(&lock);
+        long game = next++;
+        pthread_mutex_unlock(&lock);
+        if (game >= games) return NULL;
+        playGame(ai, game);
+    }
+}
+
+
+/* BOOK */
+static int compareRecords(const void *a, const void *b) {
+    const Record *x = a, *y = b;
+    if (x->key != y->key) return (x->key < y->key) ? -1 : 1;
+    return x->move - y->move;
+}
+
+// sort the records and keep the best move of every position reached by at least minGames
+// games; entries[] gets one per kept position
+static long collectEntries(long count, int minGames, BookEntry *entries) {
+    qsort(records, (size_t)count, sizeof(Record), compareRecords);
+    long kept = 0;
+    for (long first = 0, last; first < count; first = last) {
+        long moveGames[COLOR_COUNT] = {0}, movePoints[COLOR_COUNT] = {0};
+        for (last = first; last < count && records[last].key == records[first].key; last++) {
+            moveGames[records[last].move]++;
+            movePoints[records[last].move] += records[last].points;
+        }
+        if (records[first].key == 0 || last - first < minGames) continue;
+
+        // best average, then the move seen most often
+        int best = -1;
+        for (int c = 0; c < COLOR_COUNT; c++) {
+            if (moveGames[c] == 0) continue;
+            if (best < 0 || movePoints[c] * moveGames[best] > movePoints[best] * moveGames[c]
+                || (movePoints[c] * moveGames[best] == movePoints[best] * moveGames[c] && moveGames[c] > moveGames[best])) best = c;
+        }
+        BookEntry *entry = &entries[kept++];
+        memset(entry, 0, sizeof(BookEntry));
+        entry->key = records[first].key;
+        entry->move = (int8_t)best;
+        entry->games = (uint16_t)((moveGames[best] > 65535) ? 65535 : moveGames[best]);
+        entry->score = (uint16_t)(movePoints[best] * 65535 / (2 * moveGames[best]));
+    }
+    return kept;
+}
+
+// lay the entries out as a table at most half full and write header and table
+static bool writeBook(const char *path, const BookEntry *entries, long count) {
+    uint32_t bits = 4;
+    while (((uint64_t)1 << bits) < 2 * (uint64_t)count) bits++;
+    uint64_t slots = (uint64_t)1 << bits, mask = slots - 1;
+    BookEntry *table = calloc(slots, sizeof(BookEntry));
+    if (!table) return false;
+    for (long k = 0; k < count; k++) {
+        uint64_t slot = entries[k].key & mask;
+        while (table[slot].key != 0) slot = (slot + 1) & mask;
+        table[slot] = entries[k];
+    }
+
+    BookHeader header = { BOOK_MAGIC, BOOK_KEY_CHECK, bits, BOARD_SIZE, (uint64_t)count };
+    FILE *file = fopen(path, "wb");
+    bool ok = file && fwrite(&header, sizeof(header), 1, file) == 1 && fwrite(table, sizeof(BookEntry), slots, file) == slots;
+    if (file && fclose(file) != 0) ok = false;
+    free(table);
+    return ok;
+}
+
+
+/* MAIN FUNCTION */
+int main(int argc, char **argv) {
+    int threads = (int)sysconf(_SC_NPROCESSORS_ONLN), minGames = 4;
+    long boards = BALANCED_SEED_COUNT;
+    const char *path = "book.bin";
+
+    int opt;
+    while ((opt = getopt(argc, argv, "g:p:d:e:m:b:t:s:o:")) != -1) {
+        switch (opt) {
+            case 'g': gamesPerBoard = atoi(optarg); break;
+            case 'p': plies = atoi(optarg); break;
+            case 'd': depth = atoi(optarg); break;
+            case 'e': explore = atoi(optarg); break;
+            case 'm': minGames = atoi(optarg); break;
+            case 'b': boards = atol(optarg); break;
+            case 't': threads = atoi(optarg); break;
+            case 's': seed = strtoull(optarg, NULL, 0); break;
+            case 'o': path = optarg; break;
+            default:
+                fprintf(stderr, "usage: %s [-g games] [-p plies] [-d depth] [-e explore] [-m min] [-b boards] [-t threads] [-s seed] [-o file]\n", argv[0]);
+                return 2;
+        }
+    }
+    if (threads < 1) threads = 1;
+    if (gamesPerBoard < 1) gamesPerBoard = 1;
+    if (plies < 1) plies = 1;
+    if (depth < 1) depth = 1;
+    if (minGames < 1) minGames = 1;
+    if (boards < 1 || boards > BALANCED_SEED_COUNT) boards = BALANCED_SEED_COUNT;
+    games = boards * gamesPerBoard;
+
+    records = calloc((size_t)games * plies, sizeof(Record));
+    BookEntry *entries = calloc((size_t)games * plies, sizeof(BookEntry));
+    Ai *ais = calloc(threads, sizeof(Ai));
+    pthread_t *ids = calloc(threads, sizeof(pthread_t));
+    if (!records || !entries || !ais || !ids) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    for (int t = 0; t < threads; t++) {
+        if (!aiInit(&ais[t], MKBOOK_TABLE_BITS)) {
+            fprintf(stderr, "out of memory\n");
+            return 1;
+        }
+        ais[t].maxDepth = depth;
+    }
+
+    double start = wallSeconds();
+    for (int t = 0; t < threads; t++) pthread_create(&ids[t], NULL, workerMain, &ais[t]);
+    for (int t = 0; t < threads; t++) pthread_join(ids[t], NULL);
+    double seconds = wallSeconds() - start;
+
+    long count = collectEntries(games * plies, minGames, entries);
+    printf("%ld games on %ld boards and %d threads in %.2f s, depth %d\n", games, boards, threads, seconds, depth);
+    printf("%ld positions reached by %d or more games in the first %d plies", count, minGames, plies);
+    if (!writeBook(path, entries, count)) {
+        fprintf(stderr, "\ncannot write %s\n", path);
+        return 1;
+    }
+    printf(", written to %s\n", path);
+
+    for (int t = 0; t < threads; t++) aiFree(&ais[t]);
+    free(ais);
+    free(ids);
+    free(entries);
+    free(records);
+    return 0;
+}
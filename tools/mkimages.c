@@ -0,0 +1,425 @@
+/* IMAGE PACKER */
+// Converts a picture of the game from a PNG or BMP file in assets/ to a packed image
+// (image.h) in a file of its own, which assets.c links into the game as it is. Colors
+// are rounded to RGB565; a picture saved from RGB565 values (each channel's bits repeated
+// to fill 8) comes back exactly. PNG files must be 8 bits per channel and not interlaced,
+// in any color type; alpha is ignored. BMP files must be uncompressed 24 or 32 bits per
+// pixel, or 16 bits per pixel with RGB565 bit fields, which are taken as they are.
+//
+// build: gcc -O2 -I. tools/mkimages.c -o mkimages
+// usage: mkimages [-o file] picture
+//   output file (the picture's name with .img by default)
+
+/* LIBRARIES */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include "image.h"
+
+
+/* PACKER INITIALIZATIONS */
+#define MAX_SIDE 4096 // widest and tallest picture read
+
+typedef struct {
+    int width, height;
+    uint16_t *pixels; // RGB565, row by row from the top
+} Picture;
+
+static uint8_t *readFile(const char *path, size_t *size) {
+    FILE *file = fopen(path, "rb");
+    if (!file) return NULL;
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    uint8_t *data = (length >= 0) ? malloc((size_t)length + 1) : NULL;
+    if (data && fread(data, 1, (size_t)length, file) != (size_t)length) {
+        free(data);
+        data = NULL;
+    }
+    fclose(file);
+    *size = (size_t)length;
+    return data;
+}
+
+static uint32_t readLe(const uint8_t *at, int bytes) {
+    uint32_t value = 0;
+    for (int i = bytes - 1; i >= 0; i--) value = (value << 8) | at[i];
+    return value;
+}
+
+static uint32_t readBe32(const uint8_t *at) {
+    return ((uint32_t)at[0] << 24) | ((uint32_t)at[1] << 16) | ((uint32_t)at[2] << 8) | at[3];
+}
+
+static uint16_t rgb565(int red, int green, int blue) {
+    return (uint16_t)((((red * 31 + 127) / 255) << 11) | (((green * 63 + 127) / 255) << 5) | ((blue * 31 + 127) / 255));
+}
+
+static bool newPicture(Picture *picture, long width, long height) {
+    if (width < 1 || height < 1 || width > MAX_SIDE || height > MAX_SIDE) return false;
+    picture->width = (int)width;
+    picture->height = (int)height;
+    picture->pixels = malloc(sizeof(uint16_t) * (size_t)width * (size_t)height);
+    return picture->pixels != NULL;
+}
+
+
+/* INFLATE */
+// The deflate decoder PNG needs (RFC 1951): stored blocks and blocks with fixed or
+// dynamic Huffman codes. Codes are decoded a bit at a time, which is plenty for pictures
+// of a few hundred kilobytes.
+#define INFLATE_MAX_BITS 15
+
+typedef struct {
+    const uint8_t *in;
+    size_t inSize, inAt;
+    uint32_t bits;
+    int bitCount;
+    uint8_t *out;
+    size_t outSize, outAt;
+} Inflate;
+
+typedef struct {
+    short counts[INFLATE_MAX_BITS + 1]; // codes of each length
+    short symbols[288]; // by code
+} Huffman;
+
+static const short LENGTH_BASE[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+static const short LENGTH_EXTRA[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+static const short DISTANCE_BASE[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+static const short DISTANCE_EXTRA[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+// the next count bits, first bit lowest; -1 past the end of the input
+static int inflateBits(Inflate *s, int count) {
+    while (s->bitCount < count) {
+        if (s->inAt == s->inSize) return -1;
+        s->bits |= (uint32_t)s->in[s->inAt++] << s->bitCount;
+        s->bitCount += 8;
+    }
+    int value = (int)(s->bits & ((1u << count) - 1));
+    s->bits >>= count;
+    s->bitCount -= count;
+    return value;
+}
+
+// canonical codes from their lengths; false if the lengths ask for more codes than fit
+static bool buildHuffman(Huffman *huffman, const uint8_t *lengths, int count) {
+    short offsets[INFLATE_MAX_BITS + 1];
+    memset(huffman->counts, 0, sizeof(huffman->counts));
+    for (int k = 0; k < count; k++) huffman->counts[lengths[k]]++;
+    int left = 1;
+    for (int len = 1; len <= INFLATE_MAX_BITS; len++) {
+        left = 2 * left - huffman->counts[len];
+        if (left < 0) return false;
+    }
+    offsets[1] = 0;
+    for (int len = 1; len < INFLATE_MAX_BITS; len++) offsets[len + 1] = (short)(offsets[len] + huffman->counts[len]);
+    for (int k = 0; k < count; k++) {
+        if (lengths[k]) huffman->symbols[offsets[lengths[k]]++] = (short)k;
+    }
+    return true;
+}
+
+// the next symbol; -1 on a code that is not in the table or past the end of the input
+static int decodeSymbol(Inflate *s, const Huffman *huffman) {
+    int code = 0, first = 0, index = 0;
+    for (int len = 1; len <= INFLATE_MAX_BITS; len++) {
+        int bit = inflateBits(s, 1);
+        if (bit < 0) return -1;
+        code |= bit;
+        int count = huffman->counts[len];
+        if (code - first < count) return huffman->symbols[index + code - first];
+        index += count;
+        first = (first + count) << 1;
+        code <<= 1;
+    }
+    return -1;
+}
+
+static bool inflateCodes(Inflate *s, const Huffman *lengths, const Huffman *distances) {
+    for (;;) {
+        int symbol = decodeSymbol(s, lengths);
+        if (symbol < 0) return false;
+        if (symbol < 256) {
+            if (s->outAt == s->outSize) return false;
+            s->out[s->outAt++] = (uint8_t)symbol;
+            continue;
+        }
+        if (symbol == 256) return true;
+        symbol -= 257;
+        if (symbol >= 29) return false;
+        int extra = inflateBits(s, LENGTH_EXTRA[symbol]);
+        int distanceSymbol = decodeSymbol(s, distances);
+        if (extra < 0 || distanceSymbol < 0 || distanceSymbol >= 30) return false;
+        int length = LENGTH_BASE[symbol] + extra;
+        int distanceExtra = inflateBits(s, DISTANCE_EXTRA[distanceSymbol]);
+        if (distanceExtra < 0) return false;
+        size_t distance = (size_t)DISTANCE_BASE[distanceSymbol] + (size_t)distanceExtra;
+        if (distance > s->outAt || s->outSize - s->outAt < (size_t)length) return false;
+        for (int k = 0; k < length; k++, s->outAt++) s->out[s->outAt] = s->out[s->outAt - distance];
+    }
+}
+
+static bool inflateFixed(Inflate *s) {
+    static Huffman lengths, distances;
+    static bool built;
+    if (!built) {
+        uint8_t sizes[288];
+        for (int k = 0; k < 288; k++) sizes[k] = (k < 144) ? 8 : (k < 256) ? 9 : (k < 280) ? 7 : 8;
+        buildHuffman(&lengths, sizes, 288);
+        for (int k = 0; k < 30; k++) sizes[k] = 5;
+        buildHuffman(&distances, sizes, 30);
+        built = true;
+    }
+    return inflateCodes(s, &lengths, &distances);
+}
+
+static bool inflateDynamic(Inflate *s) {
+    static const uint8_t ORDER[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+    int lengthCount = inflateBits(s, 5), distanceCount = inflateBits(s, 5), codeCount = inflateBits(s, 4);
+    if (codeCount < 0) return false;
+    lengthCount += 257;
+    distanceCount += 1;
+    codeCount += 4;
+    if (lengthCount > 286 || distanceCount > 30) return false;
+
+    uint8_t sizes[286 + 30] = {0};
+    for (int k = 0; k < codeCount; k++) {
+        int size = inflateBits(s, 3);
+        if (size < 0) return false;
+        sizes[ORDER[k]] = (uint8_t)size;
+    }
+    Huffman codes, lengths, distances;
+    if (!buildHuffman(&codes, sizes, 19)) return false;
+
+    int at = 0;
+    while (at < lengthCount + distanceCount) {
+        int symbol = decodeSymbol(s, &codes);
+        if (symbol < 0) return false;
+        if (symbol < 16) {
+            sizes[at++] = (uint8_t)symbol;
+            continue;
+        }
+        // 16 repeats the last length 3-6 times, 17 and 18 write 3-10 and 11-138 zeros
+        int extra = inflateBits(s, (symbol == 16) ? 2 : (symbol == 17) ? 3 : 7);
+        int repeat = ((symbol == 18) ? 11 : 3) + extra, size = 0;
+        if (symbol == 16) {
+            if (at == 0) return false;
+            size = sizes[at - 1];
+        }
+        if (extra < 0 || at + repeat > lengthCount + distanceCount) return false;
+        while (repeat--) sizes[at++] = (uint8_t)size;
+    }
+    if (sizes[256] == 0) return false; // no end of block
+    if (!buildHuffman(&lengths, sizes, lengthCount) || !buildHuffman(&distances, sizes + lengthCount, distanceCount)) return false;
+    return inflateCodes(s, &lengths, &distances);
+}
+
+// decompress a zlib stream into out; returns the bytes written, or 0 on a broken stream
+static size_t inflateZlib(uint8_t *out, size_t outSize, const uint8_t *in, size_t inSize) {
+    if (inSize < 2 || (in[0] & 0x0f) != 8 || ((in[0] << 8) | in[1]) % 31 != 0 || (in[1] & 0x20)) return 0;
+    Inflate s = { in, inSize, 2, 0, 0, out, outSize, 0 };
+    int last;
+    do {
+        last = inflateBits(&s, 1);
+        int type = inflateBits(&s, 2);
+        bool ok;
+        if (type == 0) {
+            s.bits = 0;
+            s.bitCount = 0; // stored blocks start on a byte
+            if (s.inSize - s.inAt < 4) return 0;
+            size_t length = readLe(s.in + s.inAt, 2);
+            if ((length ^ readLe(s.in + s.inAt + 2, 2)) != 0xffff) return 0;
+            s.inAt += 4;
+            ok = s.inSize - s.inAt >= length && s.outSize - s.outAt >= length;
+            if (ok) {
+                memcpy(s.out + s.outAt, s.in + s.inAt, length);
+                s.inAt += length;
+                s.outAt += length;
+            }
+        } else if (type == 1) {
+            ok = inflateFixed(&s);
+        } else if (type == 2) {
+            ok = inflateDynamic(&s);
+        } else {
+            ok = false;
+        }
+        if (!ok) return 0;
+    } while (last == 0);
+    return (last == 1) ? s.outAt : 0;
+}
+
+
+/* PICTURE FILES */
+static int paeth(int left, int up, int upLeft) {
+    int p = left + up - upLeft, dl = abs(p - left), du = abs(p - up), dul = abs(p - upLeft);
+    return (dl <= du && dl <= dul) ? left : (du <= dul) ? up : upLeft;
+}
+
+static bool readPng(Picture *picture, const uint8_t *data, size_t size, const char *path) {
+    static const uint8_t SIGNATURE[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+    static const int CHANNELS[7] = {1, 0, 3, 1, 2, 0, 4}; // by color type
+    if (size < 8 || memcmp(data, SIGNATURE, 8) != 0) return false;
+
+    long width = 0, height = 0;
+    int colorType = -1;
+    uint8_t palette[256 * 3] = {0};
+    uint8_t *compressed = malloc(size); // the IDAT chunks, joined
+    size_t compressedSize = 0;
+    if (!compressed) return false;
+    for (size_t at = 8; at + 12 <= size;) {
+        uint32_t length = readBe32(data + at);
+        const uint8_t *type = data + at + 4, *body = data + at + 8;
+        if (length > size - at - 12) break;
+        if (memcmp(type, "IHDR", 4) == 0 && length >= 13) {
+            width = readBe32(body);
+            height = readBe32(body + 4);
+            colorType = body[9];
+            if (body[8] != 8 || colorType > 6 || CHANNELS[colorType] == 0 || body[12] != 0) {
+                fprintf(stderr, "%s: only 8-bit PNG files without interlacing are read\n", path);
+                free(compressed);
+                return false;
+            }
+        } else if (memcmp(type, "PLTE", 4) == 0) {
+            memcpy(palette, body, (length < sizeof(palette)) ? length : sizeof(palette));
+        } else if (memcmp(type, "IDAT", 4) == 0) {
+            memcpy(compressed + compressedSize, body, length);
+            compressedSize += length;
+        } else if (memcmp(type, "IEND", 4) == 0) {
+            break;
+        }
+        at += 12 + (size_t)length;
+    }
+    if (colorType < 0 || !newPicture(picture, width, height)) {
+        fprintf(stderr, "%s: no picture header, or a picture of more than %d x %d\n", path, MAX_SIDE, MAX_SIDE);
+        free(compressed);
+        return false;
+    }
+
+    int channels = CHANNELS[colorType];
+    size_t stride = (size_t)width * channels, rawSize = (stride + 1) * (size_t)height;
+    uint8_t *raw = malloc(rawSize);
+    bool ok = raw && inflateZlib(raw, rawSize, compressed, compressedSize) == rawSize;
+    free(compressed);
+
+    // undo each row's filter in place, then convert it
+    for (int row = 0; ok && row < height; row++) {
+        uint8_t *line = raw + row * (stride + 1) + 1, *up = (row > 0) ? line - (stride + 1) : NULL;
+        int filter = line[-1];
+        for (size_t i = 0; i < stride; i++) {
+            int left = (i >= (size_t)channels) ? line[i - channels] : 0, above = up ? up[i] : 0;
+            int upLeft = (up && i >= (size_t)channels) ? up[i - channels] : 0;
+            switch (filter) {
+                case 0: break;
+                case 1: line[i] += left; break;
+                case 2: line[i] += above; break;
+                case 3: line[i] += (left + above) / 2; break;
+                case 4: line[i] += paeth(left, above, upLeft); break;
+                default: ok = false; break;
+            }
+        }
+        for (int col = 0; ok && col < width; col++) {
+            const uint8_t *pixel = line + (size_t)col * channels;
+            uint16_t *to = &picture->pixels[(size_t)row * width + col];
+            if (colorType == 3) *to = rgb565(palette[3 * pixel[0]], palette[3 * pixel[0] + 1], palette[3 * pixel[0] + 2]);
+            else if (channels <= 2) *to = rgb565(pixel[0], pixel[0], pixel[0]);
+            else *to = rgb565(pixel[0], pixel[1], pixel[2]);
+        }
+    }
+    free(raw);
+    if (!ok) {
+        fprintf(stderr, "%s: broken image data\n", path);
+        free(picture->pixels);
+    }
+    return ok;
+}
+
+static bool readBmp(Picture *picture, const uint8_t *data, size_t size, const char *path) {
+    if (size < 54 || data[0] != 'B' || data[1] != 'M') return false;
+    uint32_t start = readLe(data + 10, 4), compression = readLe(data + 30, 4);
+    int32_t width = (int32_t)readLe(data + 18, 4), height = (int32_t)readLe(data + 22, 4);
+    int depth = (int)readLe(data + 28, 2);
+    bool fields565 = depth == 16 && compression == 3 && size >= 66 && readLe(data + 54, 4) == 0xf800 &&
+                     readLe(data + 58, 4) == 0x07e0 && readLe(data + 62, 4) == 0x001f;
+    if (!(fields565 || ((depth == 24 || depth == 32) && compression == 0))) {
+        fprintf(stderr, "%s: only uncompressed 24 or 32-bit BMP files, or 16-bit RGB565 ones, are read\n", path);
+        return false;
+    }
+    bool bottomUp = height > 0;
+    if (!bottomUp) height = -height;
+    size_t stride = ((size_t)width * (size_t)depth / 8 + 3) & ~(size_t)3;
+    if (width < 1 || start > size || (size - start) / stride < (size_t)height) {
+        fprintf(stderr, "%s: broken image data\n", path);
+        return false;
+    }
+    if (!newPicture(picture, width, height)) return false;
+    for (int row = 0; row < height; row++) {
+        const uint8_t *line = data + start + stride * (size_t)(bottomUp ? height - 1 - row : row);
+        for (int col = 0; col < width; col++) {
+            const uint8_t *pixel = line + (size_t)col * (depth / 8);
+            picture->pixels[(size_t)row * width + col] = fields565 ? (uint16_t)readLe(pixel, 2) : rgb565(pixel[2], pixel[1], pixel[0]);
+        }
+    }
+    return true;
+}
+
+
+/* MAIN FUNCTION */
+int main(int argc, char **argv) {
+    const char *path = NULL;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "o:")) != -1) {
+        switch (opt) {
+            case 'o': path = optarg; break;
+            default:
+                fprintf(stderr, "usage: %s [-o file] picture\n", argv[0]);
+                return 2;
+        }
+    }
+    if (optind != argc - 1) {
+        fprintf(stderr, "usage: %s [-o file] picture\n", argv[0]);
+        return 2;
+    }
+    const char *source = argv[optind];
+    char defaultPath[4096];
+    if (!path) {
+        const char *dot = strrchr(source, '.'), *slash = strrchr(source, '/');
+        int stem = (dot && (!slash || dot > slash)) ? (int)(dot - source) : (int)strlen(source);
+        snprintf(defaultPath, sizeof(defaultPath), "%.*s.img", stem, source);
+        path = defaultPath;
+    }
+
+    size_t size;
+    uint8_t *data = readFile(source, &size);
+    if (!data) {
+        fprintf(stderr, "cannot read %s\n", source);
+        return 1;
+    }
+    Picture picture;
+    bool png = size >= 8 && data[0] == 0x89 && memcmp(data + 1, "PNG", 3) == 0, bmp = size >= 2 && data[0] == 'B' && data[1] == 'M';
+    bool ok = (png && readPng(&picture, data, size, source)) || (bmp && readBmp(&picture, data, size, source));
+    free(data);
+    if (!ok) {
+        if (!png && !bmp) fprintf(stderr, "%s is not a PNG or BMP file\n", source);
+        return 1;
+    }
+
+    uint8_t *packed = malloc(IMAGE_MAX_BYTES(picture.width, picture.height));
+    if (!packed) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    size_t bytes = imagePack(packed, picture.pixels, picture.width, picture.height);
+    FILE *file = fopen(path, "wb");
+    if (!file || fwrite(packed, 1, bytes, file) != bytes || fclose(file) != 0) {
+        fprintf(stderr, "cannot write %s\n", path);
+        return 1;
+    }
+    printf("%-28s %4d x %-4d %8zu bytes\n", path, picture.width, picture.height, bytes);
+    free(packed);
+    free(picture.pixels);
+    return 0;
+}
@@ -0,0 +1,150 @@
+/* HOST RENDERING HARNESS */
+// Runs filler.c's drawing code against the host pixel buffer (vga.h) and reports how many
+// pixels each part of the game's drawing writes and how long it takes: a screen clear,
+// the title screen, the game screen, a board redraw, one pass of the main loop with and
+// without a new selected color, and one move. Each stage ends by showing what it drew, so
+// its pixels include those copied to bring the new back buffer up to date. filler.c is
+// compiled in whole, without its main(), so what is measured is exactly what the game
+// draws. -o saves the game screen on show after the moves as a PPM image.
+//
+// build: make build/render, or after make images:
+//        gcc -O2 -march=native -Wall -Wextra -I. tools/render.c assets.c -o render -lm
+// usage: render [-n repeats] [-s seed] [-o file]
+
+/* LIBRARIES */
+#include <unistd.h>
+#define FILLER_NO_MAIN
+#include "filler.c"
+
+
+/* HARNESS INITIALIZATIONS */
+#define RENDER_MOVES 8 // moves played on the game screen before it is saved
+
+typedef struct {
+    const char *name;
+    uint64_t pixels;
+    double seconds;
+} Stage;
+
+static unsigned short renderMenu[6] = {YELLOW, MAGENTA, CYAN, BLUE, GREEN, RED};
+static Scene renderScene;
+
+
+/* STAGES */
+static void clearScreen(Board *board, uint64_t seed) {
+    (void)board; (void)seed;
+    clear_screen();
+    vsync();
+}
+
+static void boardRedraw(Board *board, uint64_t seed) {
+    (void)seed;
+    printBoardVGA(board);
+    vsync();
+}
+
+static void titleScreen(Board *board, uint64_t seed) {
+    (void)board; (void)seed;
+    clear_screen();
+    displayImage(0, 0, Image);
+    vsync();
+}
+
+static void gameScreen(Board *board, uint64_t seed) {
+    clear_screen();
+    displayImage(0, 0, BgImage);
+    initializeBoard(board, seed);
+    sceneInit(&renderScene, renderMenu);
+    sceneSetBoard(&renderScene, board);
+    sceneDraw(&renderScene);
+    vsync();
+}
+
+// a pass of the main loop with the switches as they were
+static void loopPass(Board *board, uint64_t seed) {
+    (void)board; (void)seed;
+    sceneSelect(&renderScene, renderScene.next.selection);
+    sceneDraw(&renderScene);
+    vsync();
+}
+
+// a pass of the main loop after a switch moved: two outlines change
+static void selectionPass(Board *board, uint64_t seed) {
+    (void)board; (void)seed;
+    sceneSelect(&renderScene, (renderScene.next.selection + 1) % COLOR_COUNT);
+    sceneDraw(&renderScene);
+    vsync();
+}
+
+// what the main loop draws after a move: the icon, the board and the score. Player 1
+// takes the color that absorbs the most, so the move changes cells and not just the
+// territory's color
+static void moveDrawing(Board *board, uint64_t seed) {
+    (void)seed;
+    int gains[COLOR_COUNT], legal = moveGains(board, PLAYER1, gains), color = -1;
+    for (int c = 0; c < COLOR_COUNT; c++) {
+        if (((legal >> c) & 1) && (color < 0 || gains[c] > gains[color])) color = c;
+    }
+    if (color < 0) return; // the game is over
+    fill(board, PLAYER1, color);
+    int changed[BOARD_SIZE * BOARD_SIZE];
+    sceneSetIcon(&renderScene, PLAYER1, color);
+    sceneSetCells(&renderScene, board, changed, changedCells(board, changed));
+    sceneSetScore(&renderScene, calculateScore(board, PLAYER1), calculateScore(board, PLAYER2));
+    sceneDraw(&renderScene);
+    vsync();
+}
+
+static Stage runStage(const char *name, void (*draw)(Board*, uint64_t), Board *board, uint64_t seed, int repeats) {
+    Stage stage = { name, 0, 0 };
+    vgaResetCounters();
+    double start = wallSeconds();
+    for (int k = 0; k < repeats; k++) draw(board, seed);
+    stage.seconds = (wallSeconds() - start) / repeats;
+    stage.pixels = vgaHost.pixels / repeats;
+    return stage;
+}
+
+
+/* MAIN FUNCTION */
+int main(int argc, char **argv) {
+    int repeats = 100;
+    uint64_t seed = BALANCED_SEEDS[0];
+    const char *path = NULL;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:o:")) != -1) {
+        switch (opt) {
+            case 'n': repeats = atoi(optarg); break;
+            case 's': seed = strtoull(optarg, NULL, 0); break;
+            case 'o': path = optarg; break;
+            default:
+                fprintf(stderr, "usage: %s [-n repeats] [-s seed] [-o file]\n", argv[0]);
+                return 2;
+        }
+    }
+    if (repeats < 1) repeats = 1;
+
+    vgaInitBuffers();
+    freopen("/dev/null", "w", stdout); // initializeBoard() prints the seed every time
+    Board board;
+    Stage stages[7];
+    stages[0] = runStage("clear screen", clearScreen, &board, seed, repeats);
+    stages[1] = runStage("title screen", titleScreen, &board, seed, repeats);
+    stages[2] = runStage("game screen", gameScreen, &board, seed, repeats);
+    stages[3] = runStage("board redraw", boardRedraw, &board, seed, repeats);
+    gameScreen(&board, seed);
+    stages[4] = runStage("main loop pass", loopPass, &board, seed, repeats);
+    stages[5] = runStage("new selection", selectionPass, &board, seed, repeats);
+    stages[6] = runStage("move", moveDrawing, &board, seed, RENDER_MOVES);
+
+    for (int k = 0; k < 7; k++) {
+        fprintf(stderr, "%-16s %8llu pixels %10.1f us %8.2f ns/pixel\n", stages[k].name, (unsigned long long)stages[k].pixels,
+                stages[k].seconds * 1e6, stages[k].pixels ? stages[k].seconds * 1e9 / stages[k].pixels : 0.0);
+    }
+    if (path && !vgaDumpPpm(path, vgaController()[VGA_FRONT_BUFFER])) {
+        fprintf(stderr, "cannot write %s\n", path);
+        return 1;
+    }
+    return 0;
+}
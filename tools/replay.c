@@ -0,0 +1,245 @@
+/* GAME RECORD REPLAYER */
+// Re-plays record files (record.h) through the engine as fast as it will go and checks
+// every game on the way: each color that is not RECORD_PASS must be legal, no move may
+// come after the game is over, and with -x every move is also played on the region graph
+// engine (regions.h), whose scores must agree. It prints per-move statistics (games still
+// going, cells absorbed and passes at each ply) and a digest of the final positions, so
+// a rerun after the engine changes can be compared with -e. Threads take chunks of games
+// from the file in turn and replay them; the statistics and the digest are sums over
+// games, so they come out the same for any number of threads.
+//
+// build: gcc -O2 -march=native -pthread -I. tools/replay.c -o replay -lm
+// usage: replay [-t threads] [-x] [-p plies] [-e digest] file...
+//   -p prints the statistics of the first plies (all of them by default)
+
+/* LIBRARIES */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "engine.h"
+#include "ai.h"
+#include "regions.h"
+#include "record.h"
+
+
+/* REPLAY INITIALIZATIONS */
+#define REPLAY_PLIES 256 // plies with statistics of their own; later ones share the last row
+#define CHUNK_MOVES (1 << 20) // moves a worker reads at a time, at least RECORD_MAX_MOVES
+#define MAX_REPORTED_ERRORS 10
+
+typedef struct {
+    long games, moves, passes, unfinished, errors;
+    long results[3]; // draws, player 1 wins, player 2 wins
+    long colorPicks[COLOR_COUNT];
+    long plyGames[REPLAY_PLIES], plyGain[REPLAY_PLIES], plyPasses[REPLAY_PLIES];
+    uint64_t digest;
+} Stats;
+
+typedef struct {
+    Stats stats;
+    AnyBoard board;
+    // the chunk being replayed
+    long first; // file-wide index of its first game
+    int count;
+    uint64_t seeds[CHUNK_MOVES / 16];
+    int starts[CHUNK_MOVES / 16 + 1]; // colors of game k are colors[starts[k] .. starts[k + 1] - 1]
+    uint8_t colors[CHUNK_MOVES];
+} Worker;
+
+static pthread_mutex_t readLock = PTHREAD_MUTEX_INITIALIZER;
+static RecordStream stream; // the file being read
+static long nextGame; // file-wide index of the next game read
+static bool crossCheck;
+static long reportedErrors;
+
+
+/* REPLAY */
+static void gameError(Stats *stats, long game, int move, const char *what) {
+    stats->errors++;
+    pthread_mutex_lock(&readLock);
+    if (reportedErrors++ < MAX_REPORTED_ERRORS) fprintf(stderr, "game %ld, move %d: %s\n", game, move, what);
+    pthread_mutex_unlock(&readLock);
+}
+
+// read the next chunk of games into the worker; false at the end of the file
+static bool readChunk(Worker *worker) {
+    pthread_mutex_lock(&readLock);
+    worker->first = nextGame;
+    worker->count = 0;
+    int used = 0;
+    while (worker->count < CHUNK_MOVES / 16 && CHUNK_MOVES - used >= RECORD_MAX_MOVES) {
+        int count = recordRead(&stream, &worker->seeds[worker->count], worker->colors + used);
+        if (count < 0) break;
+        worker->starts[worker->count++] = used;
+        used += count;
+    }
+    worker->starts[worker->count] = used;
+    nextGame += worker->count;
+    pthread_mutex_unlock(&readLock);
+    return worker->count > 0;
+}
+
+static void replayGame(Worker *worker, long game, uint64_t seed, const uint8_t *moves, int count) {
+    Stats *stats = &worker->stats;
+    const BoardOps *ops = worker->board.ops;
+    void *board = worker->board.board;
+    int size = worker->board.size;
+    ops->generate(board, seed);
+
+    RegionGraph graph;
+    RegionGame *regions = NULL;
+    if (crossCheck && buildRegionGraph(&graph, &worker->board)) {
+        regions = newRegionGame(&graph);
+        if (!regions) freeRegionGraph(&graph);
+    }
+    if (crossCheck && !regions) gameError(stats, game, 0, "out of memory for the cross-check");
+
+    int player = PLAYER1;
+    for (int k = 0; k < count; k++) {
+        int color = moves[k], ply = (k < REPLAY_PLIES) ? k : REPLAY_PLIES - 1;
+        if (ops->isGameOver(board)) {
+            gameError(stats, game, k, "move after the end of the game");
+            break;
+        }
+        stats->plyGames[ply]++;
+        if (color == RECORD_PASS) {
+            stats->passes++;
+            stats->plyPasses[ply]++;
+        } else if (color >= COLOR_COUNT || color == ops->playerColor(board, PLAYER1) || color == ops->playerColor(board, PLAYER2)) {
+            gameError(stats, game, k, "illegal color");
+            break;
+        } else {
+            int gain = ops->fill(board, player, color);
+            stats->plyGain[ply] += gain;
+            stats->colorPicks[color]++;
+            if (regions && (regionFill(regions, player, color) != gain || regionScore(regions, player) != ops->score(board, player))) {
+                gameError(stats, game, k, "the region engine disagrees");
+                break;
+            }
+        }
+        player = (player == PLAYER1) ? PLAYER2 : PLAYER1;
+    }
+
+    int score1 = ops->score(board, PLAYER1), score2 = ops->score(board, PLAYER2);
+    if (score1 + score2 > size * size) gameError(stats, game, count, "more cells owned than on the board");
+    if (!ops->isGameOver(board)) stats->unfinished++;
+    stats->results[(score1 > score2) ? 1 : (score2 > score1) ? 2 : 0]++;
+    stats->games++;
+    stats->moves += count;
+    stats->digest += mix64(ops->hash(board, PLAYER1) ^ mix64((uint64_t)game));
+
+    if (regions) {
+        free(regions);
+        freeRegionGraph(&graph);
+    }
+}
+
+static void *workerMain(void *arg) {
+    Worker *worker = arg;
+    while (readChunk(worker)) {
+        for (int k = 0; k < worker->count; k++) {
+            replayGame(worker, worker->first + k, worker->seeds[k], worker->colors + worker->starts[k],
+                       worker->starts[k + 1] - worker->starts[k]);
+        }
+    }
+    return NULL;
+}
+
+
+/* MAIN FUNCTION */
+int main(int argc, char **argv) {
+    int threads = (int)sysconf(_SC_NPROCESSORS_ONLN), plies = REPLAY_PLIES;
+    const char *expected = NULL;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "t:xp:e:")) != -1) {
+        switch (opt) {
+            case 't': threads = atoi(optarg); break;
+            case 'x': crossCheck = true; break;
+            case 'p': plies = atoi(optarg); break;
+            case 'e': expected = optarg; break;
+            default:
+                fprintf(stderr, "usage: %s [-t threads] [-x] [-p plies] [-e digest] file...\n", argv[0]);
+                return 2;
+        }
+    }
+    if (optind >= argc) {
+        fprintf(stderr, "usage: %s [-t threads] [-x] [-p plies] [-e digest] file...\n", argv[0]);
+        return 2;
+    }
+    if (threads < 1) threads = 1;
+    if (plies < 1 || plies > REPLAY_PLIES) plies = REPLAY_PLIES;
+
+    Worker *workers = calloc(threads, sizeof(Worker));
+    pthread_t *ids = calloc(threads, sizeof(pthread_t));
+    if (!workers || !ids) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    double start = wallSeconds();
+    for (int f = optind; f < argc; f++) {
+        if (!recordOpen(&stream, argv[f])) {
+            fprintf(stderr, "%s is not a record file of this engine\n", argv[f]);
+            return 1;
+        }
+        for (int t = 0; t < threads; t++) {
+            if (workers[t].board.board && workers[t].board.size != stream.header.boardSize) freeAnyBoard(&workers[t].board);
+            if (!workers[t].board.board && !newAnyBoard(&workers[t].board, stream.header.boardSize)) {
+                fprintf(stderr, "out of memory\n");
+                return 1;
+            }
+        }
+        for (int t = 0; t < threads; t++) pthread_create(&ids[t], NULL, workerMain, &workers[t]);
+        for (int t = 0; t < threads; t++) pthread_join(ids[t], NULL);
+        recordClose(&stream);
+    }
+    double seconds = wallSeconds() - start;
+
+    Stats total = {0};
+    for (int t = 0; t < threads; t++) {
+        Stats *stats = &workers[t].stats;
+        total.games += stats->games;
+        total.moves += stats->moves;
+        total.passes += stats->passes;
+        total.unfinished += stats->unfinished;
+        total.errors += stats->errors;
+        total.digest += stats->digest;
+        for (int k = 0; k < 3; k++) total.results[k] += stats->results[k];
+        for (int c = 0; c < COLOR_COUNT; c++) total.colorPicks[c] += stats->colorPicks[c];
+        for (int k = 0; k < REPLAY_PLIES; k++) {
+            total.plyGames[k] += stats->plyGames[k];
+            total.plyGain[k] += stats->plyGain[k];
+            total.plyPasses[k] += stats->plyPasses[k];
+        }
+        freeAnyBoard(&workers[t].board);
+    }
+    long games = (total.games > 0) ? total.games : 1;
+
+    printf("%ld games, %ld moves on %d threads in %.2f s (%.0f games/sec, %.0f moves/sec)%s\n", total.games, total.moves,
+           threads, seconds, total.games / seconds, total.moves / seconds, crossCheck ? ", cross-checked" : "");
+    printf("player 1 won %.1f%%, player 2 won %.1f%%, draws %.1f%%, %ld unfinished, %ld passes\n",
+           100.0 * total.results[1] / games, 100.0 * total.results[2] / games, 100.0 * total.results[0] / games,
+           total.unfinished, total.passes);
+    printf("colors picked:");
+    for (int c = 0; c < COLOR_COUNT; c++) printf(" %.1f%%", 100.0 * total.colorPicks[c] / (total.moves > 0 ? total.moves : 1));
+    printf("\n%5s %10s %9s %9s\n", "ply", "games", "gain", "passes");
+    for (int k = 0; k < plies && total.plyGames[k] > 0; k++) {
+        printf("%4d%s %10ld %9.2f %8.2f%%\n", k + 1, (k == REPLAY_PLIES - 1) ? "+" : " ", total.plyGames[k],
+               (double)total.plyGain[k] / total.plyGames[k], 100.0 * total.plyPasses[k] / total.plyGames[k]);
+    }
+
+    char digest[17];
+    snprintf(digest, sizeof(digest), "%016llx", (unsigned long long)total.digest);
+    printf("digest %s, %ld errors\n", digest, total.errors);
+    free(workers);
+    free(ids);
+    if (expected && strcmp(expected, digest) != 0) {
+        fprintf(stderr, "digest differs from %s\n", expected);
+        return 1;
+    }
+    return total.errors ? 1 : 0;
+}
@@ -0,0 +1,323 @@
+/* HEADLESS SELF-PLAY SIMULATOR */
+// Plays N games between two bots with the same rules as filler.c (generateBoard() as in
+// initializeBoard(), fill(), calculateScore()) but no VGA, PS/2 or audio, and reports
+// win rates, average game length and games per second. Games are split over a pool of
+// threads; each worker plays a range of games and an idle worker steals half of
+// another worker's remaining range. The bots swap seats every game.
+//
+// build: gcc -O2 -march=native -pthread -I. tools/selfplay.c -o selfplay -lm
+// usage: selfplay [-n games] [-t threads] [-a bot] [-b bot] [-s seed] [-r file] [-1]
+//   bots: random, greedy, ab:DEPTH (alpha-beta to a fixed depth), mcts:PLAYOUTS
+// When both bots are random or greedy, games are played BATCH_LANES at a time on the
+// batched engine (batch.h); -1 plays them one at a time instead.
+// Game g is played on generateBoard(splitSeed(seed, g)) and its bots draw from a stream
+// split off that seed, so results do not depend on the number of threads.
+// -r writes every game to a record file (record.h), in the order the games finish.
+
+/* LIBRARIES */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "engine.h"
+#include "ai.h"
+#include "mcts.h"
+#include "batch.h"
+#include "record.h"
+
+
+/* SIMULATOR INITIALIZATIONS */
+#define GAME_BATCH 64 // games a worker takes from its own range at a time
+#define MAX_GAME_MOVES (BOARD_SIZE * BOARD_SIZE * 4) // longer games are scored as they stand
+#define SELFPLAY_TABLE_BITS 16 // 1 MB transposition table per worker
+
+typedef enum { BOT_RANDOM, BOT_GREEDY, BOT_ALPHABETA, BOT_MCTS } BotKind;
+
+typedef struct {
+    BotKind kind;
+    int param; // search depth or playouts
+    const char *name;
+} Bot;
+
+typedef struct {
+    pthread_mutex_t lock;
+    long next, end; // games this worker still owns
+    int index;
+    Ai ai;
+    Rng rng; // random bots and MCTS seeds, reseeded every game
+    // results
+    long games, moves, capped;
+    long wins[2]; // by bot A and bot B
+    long seatWins[2]; // by player 1 and player 2
+} Worker;
+
+static Bot bots[2];
+static Worker *workers;
+static int workerCount;
+static uint64_t seed = 1;
+static bool batched; // both bots run on the batched engine
+static RecordStream records; // file is NULL unless games are recorded
+static pthread_mutex_t recordLock = PTHREAD_MUTEX_INITIALIZER;
+
+
+/* BOTS */
+static bool parseBot(const char *text, Bot *bot) {
+    bot->name = text;
+    bot->param = 0;
+    if (strcmp(text, "random") == 0) bot->kind = BOT_RANDOM;
+    else if (strcmp(text, "greedy") == 0) bot->kind = BOT_GREEDY;
+    else if (strncmp(text, "ab:", 3) == 0) bot->kind = BOT_ALPHABETA, bot->param = atoi(text + 3);
+    else if (strncmp(text, "mcts:", 5) == 0) bot->kind = BOT_MCTS, bot->param = atoi(text + 5);
+    else return false;
+    return bot->kind == BOT_RANDOM || bot->kind == BOT_GREEDY || bot->param > 0;
+}
+
+static int botMove(Worker *worker, const Bot *bot, const Board *board, int player) {
+    int moves[COLOR_COUNT], count = mctsLegalMoves(board, moves);
+    switch (bot->kind) {
+        case BOT_RANDOM:
+            return moves[rngBelow(&worker->rng, count)];
+        case BOT_GREEDY:
+            return mctsGreedyMove(board, player);
+        case BOT_ALPHABETA:
+            worker->ai.maxDepth = bot->param;
+            return aiChooseMove(&worker->ai, board, player, 0);
+        case BOT_MCTS: {
+            MctsOptions options = { 1, 0, bot->param, rngNext(&worker->rng) };
+            return mctsChooseMove(board, player, &options, NULL);
+        }
+    }
+    return moves[0];
+}
+
+
+// the batched engine's version of botMove() for every lane at once
+static Lanes batchBotMove(const Bot *bot, const BatchBoard *batch, int player, Lanes active, Lanes *rng) {
+    return (bot->kind == BOT_GREEDY) ? batchGreedyMove(batch, player, active) : batchRandomMove(batch, rng);
+}
+
+
+/* GAMES */
+static void recordGame(Worker *worker, long game, int scorePlayer1, int scorePlayer2, int moves, const uint8_t *colors) {
+    int seat = game & 1; // bot playing player 1
+    if (scorePlayer1 != scorePlayer2) {
+        int winner = (scorePlayer1 > scorePlayer2) ? 0 : 1; // seat
+        worker->seatWins[winner]++;
+        worker->wins[winner == 0 ? seat : 1 - seat]++;
+    }
+    worker->games++;
+    worker->moves += moves;
+    if (moves == MAX_GAME_MOVES) worker->capped++;
+
+    if (records.file) {
+        pthread_mutex_lock(&recordLock);
+        recordWrite(&records, splitSeed(seed, (uint64_t)game), colors, moves);
+        pthread_mutex_unlock(&recordLock);
+    }
+}
+
+// bot A plays player 1 in even games and player 2 in odd ones
+static void playGame(Worker *worker, long game) {
+    Board board;
+    uint64_t gameSeed = splitSeed(seed, (uint64_t)game);
+    generateBoard(&board, gameSeed);
+    worker->rng = newRng(splitSeed(gameSeed, 1));
+
+    int seat = game & 1; // bot playing player 1
+    int currentPlayer = PLAYER1, moves = 0;
+    uint8_t colors[MAX_GAME_MOVES];
+    while (!isGameOver(&board) && moves < MAX_GAME_MOVES) {
+        const Bot *bot = &bots[(currentPlayer == PLAYER1) ? seat : 1 - seat];
+        int color = botMove(worker, bot, &board, currentPlayer);
+        fill(&board, currentPlayer, color);
+        colors[moves++] = (uint8_t)color;
+        currentPlayer = (currentPlayer == PLAYER1) ? PLAYER2 : PLAYER1;
+    }
+
+    recordGame(worker, game, calculateScore(&board, PLAYER1), calculateScore(&board, PLAYER2), moves, colors);
+}
+
+// play games first .. first + count - 1 (count <= BATCH_LANES) side by side, one per lane
+static void playBatch(Worker *worker, long first, int count) {
+    BatchBoard batch;
+    Board boards[BATCH_LANES];
+    Lanes rng, inGame = lanesOf(0), seatA = lanesOf(0); // seatA: lanes where bot A plays player 1
+    generateBoards(boards, count, seed, first);
+    for (int l = 0; l < BATCH_LANES; l++) {
+        rng[l] = 1;
+        if (l < count) {
+            Rng laneRng = newRng(splitSeed(splitSeed(seed, (uint64_t)(first + l)), 1));
+            rng[l] = rngNext(&laneRng) | 1;
+            inGame[l] = ~0ULL;
+            seatA[l] = ((first + l) & 1) ? 0 : ~0ULL;
+        }
+        batchLoad(&batch, l, &boards[(l < count) ? l : count - 1]); // spare lanes repeat the last board but never move
+    }
+
+    Lanes moves = lanesOf(0);
+    uint8_t colors[BATCH_LANES][MAX_GAME_MOVES]; // only filled in when games are recorded
+    int currentPlayer = PLAYER1;
+    for (int move = 0; move < MAX_GAME_MOVES; move++) {
+        Lanes active = inGame & ~batchGameOver(&batch);
+        if (!anyLane(active)) break;
+
+        Lanes botA = (currentPlayer == PLAYER1) ? seatA : ~seatA;
+        Lanes colorA = batchBotMove(&bots[0], &batch, currentPlayer, active, &rng);
+        Lanes colorB = (bots[1].kind == bots[0].kind) ? colorA : batchBotMove(&bots[1], &batch, currentPlayer, active, &rng);
+        Lanes color = (colorA & botA) | (colorB & ~botA);
+        batchFill(&batch, currentPlayer, color, active);
+        for (int l = 0; records.file && l < count; l++) {
+            if (active[l]) colors[l][moves[l]] = (uint8_t)color[l];
+        }
+        moves += active & 1;
+        currentPlayer = (currentPlayer == PLAYER1) ? PLAYER2 : PLAYER1;
+    }
+
+    Lanes scorePlayer1 = batchScore(&batch, PLAYER1), scorePlayer2 = batchScore(&batch, PLAYER2);
+    for (int l = 0; l < count; l++) recordGame(worker, first + l, (int)scorePlayer1[l], (int)scorePlayer2[l], (int)moves[l], colors[l]);
+}
+
+
+/* WORK STEALING */
+// take a batch of games from our own range, or steal half of someone else's
+static bool takeGames(Worker *worker, long *first, long *last) {
+    for (;;) {
+        pthread_mutex_lock(&worker->lock);
+        if (worker->next < worker->end) {
+            *first = worker->next;
+            *last = (worker->end - worker->next > GAME_BATCH) ? worker->next + GAME_BATCH : worker->end;
+            worker->next = *last;
+            pthread_mutex_unlock(&worker->lock);
+            return true;
+        }
+        pthread_mutex_unlock(&worker->lock);
+
+        long from = 0, to = 0;
+        for (int k = 1; k < workerCount && from == to; k++) {
+            Worker *victim = &workers[(worker->index + k) % workerCount];
+            pthread_mutex_lock(&victim->lock);
+            long half = (victim->end - victim->next + 1) / 2;
+            if (half > 0) {
+                from = victim->end - half;
+                to = victim->end;
+                victim->end = from;
+            }
+            pthread_mutex_unlock(&victim->lock);
+        }
+        if (from == to) return false; // every range is empty
+
+        pthread_mutex_lock(&worker->lock);
+        worker->next = from;
+        worker->end = to;
+        pthread_mutex_unlock(&worker->lock);
+    }
+}
+
+static void *workerMain(void *arg) {
+    Worker *worker = arg;
+    long first, last;
+    while (takeGames(worker, &first, &last)) {
+        if (batched) {
+            for (long game = first; game < last; game += BATCH_LANES) {
+                playBatch(worker, game, (last - game < BATCH_LANES) ? (int)(last - game) : BATCH_LANES);
+            }
+        } else {
+            for (long game = first; game < last; game++) playGame(worker, game);
+        }
+    }
+    return NULL;
+}
+
+
+/* MAIN FUNCTION */
+int main(int argc, char **argv) {
+    long games = 10000;
+    int threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    const char *nameA = "greedy", *nameB = "random";
+    bool oneAtATime = false;
+
+    int opt;
+    const char *recordPath = NULL;
+    while ((opt = getopt(argc, argv, "n:t:a:b:s:r:1")) != -1) {
+        switch (opt) {
+            case 'n': games = atol(optarg); break;
+            case 't': threads = atoi(optarg); break;
+            case 'a': nameA = optarg; break;
+            case 'b': nameB = optarg; break;
+            case 's': seed = strtoull(optarg, NULL, 0); break;
+            case 'r': recordPath = optarg; break;
+            case '1': oneAtATime = true; break;
+            default:
+                fprintf(stderr, "usage: %s [-n games] [-t threads] [-a bot] [-b bot] [-s seed] [-r file] [-1]\n", argv[0]);
+                fprintf(stderr, "bots: random, greedy, ab:DEPTH, mcts:PLAYOUTS\n");
+                return 2;
+        }
+    }
+    if (!parseBot(nameA, &bots[0]) || !parseBot(nameB, &bots[1])) {
+        fprintf(stderr, "unknown bot; use random, greedy, ab:DEPTH or mcts:PLAYOUTS\n");
+        return 2;
+    }
+    batched = !oneAtATime && bots[0].kind <= BOT_GREEDY && bots[1].kind <= BOT_GREEDY;
+    if (threads < 1) threads = 1;
+    if (games < 1) games = 1;
+    RecordHeader header = recordHeader(BOARD_SIZE, 0, 0);
+    if (recordPath && !recordCreate(&records, recordPath, &header)) {
+        fprintf(stderr, "cannot write %s\n", recordPath);
+        return 1;
+    }
+
+    // give every worker an equal slice to start with
+    workerCount = threads;
+    workers = calloc(threads, sizeof(Worker));
+    pthread_t *ids = calloc(threads, sizeof(pthread_t));
+    bool search = bots[0].kind == BOT_ALPHABETA || bots[1].kind == BOT_ALPHABETA;
+    for (int t = 0; t < threads; t++) {
+        Worker *worker = &workers[t];
+        pthread_mutex_init(&worker->lock, NULL);
+        worker->index = t;
+        worker->next = games * t / threads;
+        worker->end = games * (t + 1) / threads;
+        if (search && !aiInit(&worker->ai, SELFPLAY_TABLE_BITS)) {
+            fprintf(stderr, "out of memory\n");
+            return 1;
+        }
+    }
+
+    double start = wallSeconds();
+    for (int t = 0; t < threads; t++) pthread_create(&ids[t], NULL, workerMain, &workers[t]);
+    for (int t = 0; t < threads; t++) pthread_join(ids[t], NULL);
+    double seconds = wallSeconds() - start;
+
+    long played = 0, moves = 0, capped = 0, wins[2] = {0}, seatWins[2] = {0};
+    for (int t = 0; t < threads; t++) {
+        played += workers[t].games;
+        moves += workers[t].moves;
+        capped += workers[t].capped;
+        for (int k = 0; k < 2; k++) {
+            wins[k] += workers[t].wins[k];
+            seatWins[k] += workers[t].seatWins[k];
+        }
+        if (search) aiFree(&workers[t].ai);
+    }
+
+    long draws = played - wins[0] - wins[1];
+    printf("%ld games on %d threads in %.2f s (%.0f games/sec", played, threads, seconds, played / seconds);
+    if (batched) printf(", %d per batch", BATCH_LANES);
+    printf(")\n");
+    printf("%s won %.1f%%, %s won %.1f%%, draws %.1f%%\n",
+           bots[0].name, 100.0 * wins[0] / played, bots[1].name, 100.0 * wins[1] / played, 100.0 * draws / played);
+    printf("player 1 won %.1f%%, player 2 won %.1f%%\n", 100.0 * seatWins[0] / played, 100.0 * seatWins[1] / played);
+    printf("average game length %.1f moves", (double)moves / played);
+    if (capped) printf(" (%ld games stopped at %d moves)", capped, MAX_GAME_MOVES);
+    printf("\n");
+
+    if (records.file && !recordClose(&records)) {
+        fprintf(stderr, "cannot write %s\n", recordPath);
+        return 1;
+    }
+    free(workers);
+    free(ids);
+    return 0;
+}
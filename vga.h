@@ -0,0 +1,280 @@
+/* VGA PIXEL BUFFER */
+// The DE1-SoC pixel buffer holds 320x240 RGB565 pixels in a 512x256 block: a row is 1024
+// bytes, so pixel (x, y) is at buffer + (y << 10) + (x << 1). The pixel buffer controller
+// at PIXEL_CONTROLLER_ADDRESS holds the front and back buffer addresses and swaps them on
+// the next vertical sync when 1 is written to its first register.
+// A host build (HOST_BUILD, on by default off the board) puts all of that in memory: two
+// 512x256 buffers with the same stride and a controller with the same four registers, so
+// filler.c's drawing code runs unchanged on Linux. It also counts the pixels written and
+// the buffer swaps, and vgaDumpPpm() saves a buffer as a 320x240 PPM image.
+// Rectangles are filled a row at a time (vgaFillRect()): each row is one run of
+// consecutive addresses, written two pixels per 32-bit store on the board and 16 pixels
+// per vector store on the host, instead of a 16-bit store 1024 bytes from the last one.
+// Drawing goes to the back buffer and vgaShow() asks for a swap at the next vertical sync
+// without waiting for it. vgaBackBuffer() waits only if that swap is still pending, then
+// brings the new back buffer up to date by copying over just the areas drawn for the
+// frame now on screen (a VgaDirty list), not the whole screen.
+
+#ifndef VGA_H
+#define VGA_H
+
+/* LIBRARIES */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#if !defined(HOST_BUILD) && (defined(__linux__) || defined(__APPLE__) || defined(_WIN32))
+#define HOST_BUILD
+#endif
+
+
+/* VGA INITIALIZATIONS */
+#define VGA_WIDTH 320
+#define VGA_HEIGHT 240
+#define VGA_COLUMNS 512 // pixels per row of the buffer, visible or not
+#define VGA_ROWS 256
+#define VGA_STRIDE (VGA_COLUMNS * 2) // bytes per row
+#define PIXEL_CONTROLLER_ADDRESS 0xFF203020
+#define VGA_MAX_DIRTY 16 // areas kept apart per frame; more are merged
+
+// controller registers, as uintptr_t so the host can hold real addresses in them
+enum { VGA_FRONT_BUFFER, VGA_BACK_BUFFER, VGA_RESOLUTION, VGA_STATUS };
+
+#ifdef HOST_BUILD
+typedef struct {
+    uint16_t buffers[2][VGA_ROWS * VGA_COLUMNS];
+    volatile uintptr_t controller[4];
+    uint64_t pixels; // pixels written since the last vgaResetCounters()
+    uint64_t frames; // buffer swaps since the last vgaResetCounters()
+} VgaHost;
+
+static VgaHost vgaHost;
+#else
+// the second buffer, in SDRAM with the program; the first is the on-chip one at reset
+static uint16_t vgaSecondBuffer[VGA_ROWS * VGA_COLUMNS] __attribute__((aligned(4)));
+#endif
+
+typedef struct {
+    int x, y, width, height;
+} VgaRect;
+
+// areas drawn in the back buffer since the last vgaShow()
+typedef struct {
+    VgaRect rects[VGA_MAX_DIRTY];
+    int count;
+    bool swapping; // vgaShow() asked for a swap that vgaBackBuffer() has not seen through
+} VgaDirty;
+
+
+/* CONTROLLER */
+// the pixel buffer controller's registers
+static inline volatile uintptr_t *vgaController(void) {
+#ifdef HOST_BUILD
+    if (!vgaHost.controller[VGA_FRONT_BUFFER]) {
+        vgaHost.controller[VGA_FRONT_BUFFER] = (uintptr_t)vgaHost.buffers[0];
+        vgaHost.controller[VGA_BACK_BUFFER] = (uintptr_t)vgaHost.buffers[1];
+        vgaHost.controller[VGA_RESOLUTION] = ((uintptr_t)VGA_HEIGHT << 16) | VGA_WIDTH;
+        vgaHost.controller[VGA_STATUS] = 0;
+    }
+    return vgaHost.controller;
+#else
+    return (volatile uintptr_t*) PIXEL_CONTROLLER_ADDRESS;
+#endif
+}
+
+// give the controller a second buffer to swap with
+static inline void vgaInitBuffers(void) {
+#ifdef HOST_BUILD
+    vgaController();
+#else
+    vgaController()[VGA_BACK_BUFFER] = (uintptr_t)vgaSecondBuffer;
+#endif
+}
+
+// swap the front and back buffers at the next vertical sync, without waiting for it
+static inline void vgaRequestSync(void) {
+    volatile uintptr_t *controller = vgaController();
+#ifdef HOST_BUILD
+    uintptr_t front = controller[VGA_FRONT_BUFFER];
+    controller[VGA_FRONT_BUFFER] = controller[VGA_BACK_BUFFER];
+    controller[VGA_BACK_BUFFER] = front;
+    vgaHost.frames++;
+#else
+    controller[VGA_FRONT_BUFFER] = 1; // start the synchronization process
+#endif
+}
+
+// true until the swap asked for has happened
+static inline bool vgaSyncPending(void) {
+#ifdef HOST_BUILD
+    return false;
+#else
+    return (vgaController()[VGA_STATUS] & 0x01) != 0; // S bit
+#endif
+}
+
+// swap the front and back buffers at the next vertical sync and wait for it
+static inline void vgaWaitForSync(void) {
+    vgaRequestSync();
+    while (vgaSyncPending()) {
+        // polling loop waiting for S bit to go to 0
+    }
+}
+
+
+/* PIXELS */
+static inline void vgaCountPixels(uint64_t count) {
+#ifdef HOST_BUILD
+    vgaHost.pixels += count;
+#else
+    (void)count;
+#endif
+}
+
+static inline void vgaPlot(uintptr_t buffer, int x, int y, uint16_t color) {
+    *(volatile uint16_t *)(buffer + (y << 10) + (x << 1)) = color;
+    vgaCountPixels(1);
+}
+
+static inline uint16_t vgaPixel(uintptr_t buffer, int x, int y) {
+    return *(volatile uint16_t *)(buffer + (y << 10) + (x << 1));
+}
+
+// fill the bytes from address to end (both even) with one color
+static inline void vgaFillSpan(uintptr_t address, uintptr_t end, uint16_t color) {
+#ifdef HOST_BUILD
+    // plain memory here, so whole vectors go at once
+    typedef uint16_t VgaVector __attribute__((vector_size(32)));
+    VgaVector pixels = {0};
+    pixels += color;
+    uint64_t quad = color * 0x0001000100010001ULL;
+    for (; address + sizeof(pixels) <= end; address += sizeof(pixels)) memcpy((void*)address, &pixels, sizeof(pixels));
+    for (; address + sizeof(quad) <= end; address += sizeof(quad)) memcpy((void*)address, &quad, sizeof(quad));
+#else
+    if (address < end && (address & 2)) { // up to a 32-bit boundary
+        *(volatile uint16_t *)address = color;
+        address += 2;
+    }
+    uint32_t pair = color * 0x00010001U;
+    for (; address + 4 <= end; address += 4) *(volatile uint32_t *)address = pair;
+#endif
+    for (; address < end; address += 2) *(volatile uint16_t *)address = color;
+}
+
+// fill width x height pixels from (x, y) with one color, one row span at a time
+static inline void vgaFillRect(uintptr_t buffer, int x, int y, int width, int height, uint16_t color) {
+    if (width <= 0 || height <= 0) return;
+    uintptr_t row = buffer + (y << 10) + (x << 1);
+    for (int k = 0; k < height; k++, row += VGA_STRIDE) vgaFillSpan(row, row + ((uintptr_t)width << 1), color);
+    vgaCountPixels((uint64_t)width * height);
+}
+
+
+/* FRAMES */
+// add an area to the list, clipped to the screen; when the list is full it goes into the
+// area it makes grow the least
+static inline void vgaMarkDirty(VgaDirty *dirty, int x, int y, int width, int height) {
+    if (x < 0) width += x, x = 0;
+    if (y < 0) height += y, y = 0;
+    if (x + width > VGA_WIDTH) width = VGA_WIDTH - x;
+    if (y + height > VGA_HEIGHT) height = VGA_HEIGHT - y;
+    if (width <= 0 || height <= 0) return;
+
+    int best = -1;
+    long bestGrowth = 0;
+    for (int k = 0; k < dirty->count; k++) {
+        VgaRect *rect = &dirty->rects[k];
+        int left = (x < rect->x) ? x : rect->x, top = (y < rect->y) ? y : rect->y;
+        int right = (x + width > rect->x + rect->width) ? x + width : rect->x + rect->width;
+        int bottom = (y + height > rect->y + rect->height) ? y + height : rect->y + rect->height;
+        long growth = (long)(right - left) * (bottom - top) - (long)rect->width * rect->height;
+        if (growth == 0) return; // already inside this one
+        if (best < 0 || growth < bestGrowth) best = k, bestGrowth = growth;
+    }
+    if (dirty->count < VGA_MAX_DIRTY) {
+        dirty->rects[dirty->count++] = (VgaRect){ x, y, width, height };
+        return;
+    }
+    VgaRect *rect = &dirty->rects[best];
+    int right = (x + width > rect->x + rect->width) ? x + width : rect->x + rect->width;
+    int bottom = (y + height > rect->y + rect->height) ? y + height : rect->y + rect->height;
+    if (x < rect->x) rect->x = x;
+    if (y < rect->y) rect->y = y;
+    rect->width = right - rect->x;
+    rect->height = bottom - rect->y;
+}
+
+// copy an area from one buffer to the other, a row span at a time
+static inline void vgaCopyRect(uintptr_t to, uintptr_t from, const VgaRect *rect) {
+    uintptr_t offset = ((uintptr_t)rect->y << 10) + ((uintptr_t)rect->x << 1), bytes = (uintptr_t)rect->width << 1;
+    for (int k = 0; k < rect->height; k++, offset += VGA_STRIDE) {
+#ifdef HOST_BUILD
+        memcpy((void*)(to + offset), (const void*)(from + offset), bytes);
+#else
+        uintptr_t address = offset, end = offset + bytes;
+        if (address < end && (address & 2)) { // up to a 32-bit boundary
+            *(volatile uint16_t *)(to + address) = *(volatile uint16_t *)(from + address);
+            address += 2;
+        }
+        for (; address + 4 <= end; address += 4) *(volatile uint32_t *)(to + address) = *(volatile uint32_t *)(from + address);
+        if (address < end) *(volatile uint16_t *)(to + address) = *(volatile uint16_t *)(from + address);
+#endif
+    }
+    vgaCountPixels((uint64_t)rect->width * rect->height);
+}
+
+// show the back buffer from the next vertical sync on, if anything was drawn in it;
+// returns at once
+static inline void vgaShow(VgaDirty *dirty) {
+    if (dirty->swapping || dirty->count == 0) return; // nothing new to show
+    vgaRequestSync();
+    dirty->swapping = true;
+}
+
+// the buffer to draw the next frame in: once the last vgaShow() has taken effect, the old
+// front buffer, with the areas drawn for the frame now on screen copied over
+static inline uintptr_t vgaBackBuffer(VgaDirty *dirty) {
+    volatile uintptr_t *controller = vgaController();
+    if (dirty->swapping) {
+        while (vgaSyncPending()) {
+            // polling loop waiting for S bit to go to 0
+        }
+        for (int k = 0; k < dirty->count; k++) {
+            vgaCopyRect(controller[VGA_BACK_BUFFER], controller[VGA_FRONT_BUFFER], &dirty->rects[k]);
+        }
+        dirty->count = 0;
+        dirty->swapping = false;
+    }
+    return controller[VGA_BACK_BUFFER];
+}
+
+
+/* HOST TOOLS */
+#ifdef HOST_BUILD
+static inline void vgaResetCounters(void) {
+    vgaHost.pixels = 0;
+    vgaHost.frames = 0;
+}
+
+// save the visible 320x240 of a buffer as a binary PPM; false if the file cannot be written
+static inline bool vgaDumpPpm(const char *path, uintptr_t buffer) {
+    FILE *file = fopen(path, "wb");
+    if (!file) return false;
+    fprintf(file, "P6\n%d %d\n255\n", VGA_WIDTH, VGA_HEIGHT);
+    for (int y = 0; y < VGA_HEIGHT; y++) {
+        unsigned char row[VGA_WIDTH * 3];
+        for (int x = 0; x < VGA_WIDTH; x++) {
+            uint16_t pixel = vgaPixel(buffer, x, y);
+            int r = pixel >> 11, g = (pixel >> 5) & 0x3F, b = pixel & 0x1F;
+            row[3 * x] = (unsigned char)((r << 3) | (r >> 2));
+            row[3 * x + 1] = (unsigned char)((g << 2) | (g >> 4));
+            row[3 * x + 2] = (unsigned char)((b << 3) | (b >> 2));
+        }
+        fwrite(row, 1, sizeof(row), file);
+    }
+    return fclose(file) == 0;
+}
+#endif
+
+#endif